@@ -17,10 +17,12 @@ LOCAL_SRC_FILES := \
 	executor/xeContainerFormatParser.cpp \
 	executor/xeDefs.cpp \
 	executor/xeLocalTcpIpLink.cpp \
+	executor/xeResultDatabase.cpp \
 	executor/xeTcpIpLink.cpp \
 	executor/xeTestCase.cpp \
 	executor/xeTestCaseListParser.cpp \
 	executor/xeTestCaseResult.cpp \
+	executor/xeTestLogIndex.cpp \
 	executor/xeTestLogParser.cpp \
 	executor/xeTestLogWriter.cpp \
 	executor/xeTestResultParser.cpp \
@@ -51,9 +53,12 @@ LOCAL_SRC_FILES := \
 	external/vulkancts/framework/vulkan/vkRenderDocUtil.cpp \
 	external/vulkancts/framework/vulkan/vkShaderProgram.cpp \
 	external/vulkancts/framework/vulkan/vkShaderToSpirV.cpp \
+	external/vulkancts/framework/vulkan/vkSharedPipelineCache.cpp \
 	external/vulkancts/framework/vulkan/vkSpirVAsm.cpp \
 	external/vulkancts/framework/vulkan/vkSpirVProgram.cpp \
+	external/vulkancts/framework/vulkan/vkStagingRing.cpp \
 	external/vulkancts/framework/vulkan/vkStrUtil.cpp \
+	external/vulkancts/framework/vulkan/vkSubmissionQueue.cpp \
 	external/vulkancts/framework/vulkan/vkTypeUtil.cpp \
 	external/vulkancts/framework/vulkan/vkWsiPlatform.cpp \
 	external/vulkancts/framework/vulkan/vkWsiUtil.cpp \
@@ -403,6 +408,7 @@ LOCAL_SRC_FILES := \
 	framework/common/tcuAstcUtil.cpp \
 	framework/common/tcuBilinearImageCompare.cpp \
 	framework/common/tcuCPUWarmup.cpp \
+	framework/common/tcuCaseIndex.cpp \
 	framework/common/tcuCommandLine.cpp \
 	framework/common/tcuCompressedTexture.cpp \
 	framework/common/tcuDefs.cpp \
@@ -410,6 +416,7 @@ LOCAL_SRC_FILES := \
 	framework/common/tcuFactoryRegistry.cpp \
 	framework/common/tcuFloat.cpp \
 	framework/common/tcuFloatFormat.cpp \
+	framework/common/tcuForkSessionExecutor.cpp \
 	framework/common/tcuFunctionLibrary.cpp \
 	framework/common/tcuFuzzyImageCompare.cpp \
 	framework/common/tcuImageCompare.cpp \
@@ -425,6 +432,7 @@ LOCAL_SRC_FILES := \
 	framework/common/tcuResource.cpp \
 	framework/common/tcuResultCollector.cpp \
 	framework/common/tcuSeedBuilder.cpp \
+	framework/common/tcuStatistics.cpp \
 	framework/common/tcuStringTemplate.cpp \
 	framework/common/tcuSurface.cpp \
 	framework/common/tcuSurfaceAccess.cpp \
@@ -439,6 +447,7 @@ LOCAL_SRC_FILES := \
 	framework/common/tcuTexLookupVerifier.cpp \
 	framework/common/tcuTexVerifierUtil.cpp \
 	framework/common/tcuTexture.cpp \
+	framework/common/tcuTextureDataCache.cpp \
 	framework/common/tcuTextureUtil.cpp \
 	framework/common/tcuThreadUtil.cpp \
 	framework/delibs/debase/deDefs.c \
@@ -464,6 +473,7 @@ LOCAL_SRC_FILES := \
 	framework/delibs/decpp/deMemPool.cpp \
 	framework/delibs/decpp/deMeta.cpp \
 	framework/delibs/decpp/deMutex.cpp \
+	framework/delibs/decpp/deParallelFor.cpp \
 	framework/delibs/decpp/dePoolArray.cpp \
 	framework/delibs/decpp/dePoolString.cpp \
 	framework/delibs/decpp/deProcess.cpp \
@@ -537,6 +547,7 @@ LOCAL_SRC_FILES := \
 	framework/egl/wrapper/eglwLibrary.cpp \
 	framework/egl/wrapper/eglwWrapper.cpp \
 	framework/opengl/gluCallLogWrapper.cpp \
+	framework/opengl/gluCallTrace.cpp \
 	framework/opengl/gluContextFactory.cpp \
 	framework/opengl/gluContextInfo.cpp \
 	framework/opengl/gluDefs.cpp \
@@ -550,9 +561,11 @@ LOCAL_SRC_FILES := \
 	framework/opengl/gluRenderConfig.cpp \
 	framework/opengl/gluRenderContext.cpp \
 	framework/opengl/gluShaderLibrary.cpp \
+	framework/opengl/gluShaderLibraryBinary.cpp \
 	framework/opengl/gluShaderProgram.cpp \
 	framework/opengl/gluShaderUtil.cpp \
 	framework/opengl/gluStateReset.cpp \
+	framework/opengl/gluStateTrackingRenderContext.cpp \
 	framework/opengl/gluStrUtil.cpp \
 	framework/opengl/gluTexture.cpp \
 	framework/opengl/gluTextureTestUtil.cpp \
@@ -0,0 +1,83 @@
+/*-------------------------------------------------------------------------
+ * drawElements Quality Program Test Executor
+ * ------------------------------------------
+ *
+ * Copyright 2019 The Android Open Source Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ *//*!
+ * \file
+ * \brief Batch result to result database export.
+ *//*--------------------------------------------------------------------*/
+
+#include "xeTestLogIndex.hpp"
+#include "xeResultDatabase.hpp"
+#include "deString.h"
+
+#include <cstdio>
+#include <exception>
+
+class ResultToDatabaseLogHandler : public xe::IndexedTestLogHandler
+{
+public:
+	ResultToDatabaseLogHandler (xe::ResultDatabase& database)
+		: m_database(database)
+	{
+	}
+
+	void testCaseResultComplete (const xe::TestCaseResult& result)
+	{
+		m_database.addCase(result);
+	}
+
+private:
+	xe::ResultDatabase&		m_database;
+};
+
+static void batchResultToDatabase (const char* batchResultFilename, const char* dstFileName, bool cacheIndex)
+{
+	xe::TestLogIndex			index;
+	xe::ResultDatabase			database;
+	ResultToDatabaseLogHandler	handler		(database);
+
+	xe::loadTestLogIndex(index, batchResultFilename, cacheIndex);
+	xe::parseIndexedTestLog(batchResultFilename, index, handler, false);
+
+	database.write(dstFileName);
+}
+
+int main (int argc, const char* const* argv)
+{
+	const bool	cacheIndex	= argc == 4 && deStringEqual(argv[1], "--cache-index");
+	const int	firstArg	= cacheIndex ? 2 : 1;
+
+	if (argc - firstArg != 2)
+	{
+		printf("%s: [--cache-index] [testlog] [destination database]\n", argv[0]);
+		printf("  --cache-index    Read and write test log index to <testlog>.idx\n");
+		return -1;
+	}
+
+	try
+	{
+		batchResultToDatabase(argv[firstArg], argv[firstArg+1], cacheIndex);
+	}
+	catch (const std::exception& e)
+	{
+		printf("FATAL ERROR: %s\n", e.what());
+		return -1;
+	}
+
+	return 0;
+}
@@ -22,7 +22,6 @@
  *//*--------------------------------------------------------------------*/
 
 #include "xeTestLogParser.hpp"
-#include "xeTestResultParser.hpp"
 #include "xeXMLWriter.hpp"
 #include "deFilePath.hpp"
 #include "deString.h"
@@ -62,7 +61,7 @@ static void parseCommandLine (CommandLine& cmdLine, int argc, const char* const*
 	cmdLine.outputFile		= argv[argc-1];
 }
 
-static void parseBatchResult (xe::TestLogParser& parser, const char* filename)
+static void parseBatchResult (xe::TestLogStreamParser& parser, const char* filename)
 {
 	std::ifstream	in			(filename, std::ios_base::binary);
 	deUint8			buf[2048];
@@ -80,7 +79,7 @@ static void parseBatchResult (xe::TestLogParser& parser, const char* filename)
 	}
 }
 
-class ResultToJUnitHandler : public xe::TestLogHandler
+class ResultToJUnitHandler : public xe::TestLogStreamHandler
 {
 public:
 	ResultToJUnitHandler (xe::xml::Writer& writer)
@@ -92,23 +91,18 @@ public:
 	{
 	}
 
-	xe::TestCaseResultPtr startTestCaseResult (const char* casePath)
+	void startTestCaseResult (const char*)
 	{
-		return xe::TestCaseResultPtr(new xe::TestCaseResultData(casePath));
 	}
 
-	void testCaseResultUpdated (const xe::TestCaseResultPtr&)
+	void resultItemParsed (const xe::TestCaseResult&, const xe::ri::Item&)
 	{
 	}
 
-	void testCaseResultComplete (const xe::TestCaseResultPtr& resultData)
+	void testCaseResultComplete (const xe::TestCaseResult& result)
 	{
 		using xe::xml::Writer;
 
-		xe::TestCaseResult result;
-
-		xe::parseTestCaseResultFromData(&m_resultParser, &result, *resultData.get());
-
 		// Split group and case names.
 		size_t			sepPos		= result.casePath.find_last_of('.');
 		std::string		caseName	= result.casePath.substr(sepPos+1);
@@ -130,7 +124,6 @@ public:
 
 private:
 	xe::xml::Writer&		m_writer;
-	xe::TestResultParser	m_resultParser;
 };
 
 static void batchResultToJUnitReport (const char* batchResultFilename, const char* dstFileName)
@@ -138,7 +131,7 @@ static void batchResultToJUnitReport (const char* batchResultFilename, const cha
 	std::ofstream				out			(dstFileName, std::ios_base::binary);
 	xe::xml::Writer				writer		(out);
 	ResultToJUnitHandler		handler		(writer);
-	xe::TestLogParser			parser		(&handler);
+	xe::TestLogStreamParser		parser		(&handler);
 
 	XE_CHECK(out.good());
 
@@ -21,8 +21,8 @@
  * \brief Batch result to XML export.
  *//*--------------------------------------------------------------------*/
 
-#include "xeTestLogParser.hpp"
-#include "xeTestResultParser.hpp"
+#include "xeTestLogIndex.hpp"
+#include "xeTestCase.hpp"
 #include "xeXMLWriter.hpp"
 #include "xeTestLogWriter.hpp"
 #include "deFilePath.hpp"
@@ -55,7 +55,8 @@ enum OutputMode
 namespace opt
 {
 
-DE_DECLARE_COMMAND_LINE_OPT(OutMode, OutputMode);
+DE_DECLARE_COMMAND_LINE_OPT(OutMode,		OutputMode);
+DE_DECLARE_COMMAND_LINE_OPT(CacheIndex,	bool);
 
 void registerOptions (de::cmdline::Parser& parser)
 {
@@ -68,7 +69,8 @@ void registerOptions (de::cmdline::Parser& parser)
 		{ "separate",	OUTPUTMODE_SEPARATE	}
 	};
 
-	parser << Option<OutMode>("m", "mode", "Output mode", s_modes, "single");
+	parser << Option<OutMode>		("m", "mode",			"Output mode", s_modes, "single")
+		   << Option<CacheIndex>	("i", "cache-index",	"Read and write test log index to <testlog>.idx");
 }
 
 } // opt
@@ -76,13 +78,15 @@ void registerOptions (de::cmdline::Parser& parser)
 struct CommandLine
 {
 	CommandLine (void)
-		: outputMode(OUTPUTMODE_SINGLE)
+		: outputMode	(OUTPUTMODE_SINGLE)
+		, cacheIndex	(false)
 	{
 	}
 
 	std::string		batchResultFile;
 	std::string		outputPath;
 	OutputMode		outputMode;
+	bool			cacheIndex;
 };
 
 static bool parseCommandLine (CommandLine& cmdLine, int argc, const char* const* argv)
@@ -101,28 +105,19 @@ static bool parseCommandLine (CommandLine& cmdLine, int argc, const char* const*
 	}
 
 	cmdLine.outputMode		= opts.getOption<opt::OutMode>();
+	cmdLine.cacheIndex		= opts.getOption<opt::CacheIndex>();
 	cmdLine.batchResultFile	= opts.getArgs()[0];
 	cmdLine.outputPath		= opts.getArgs()[1];
 
 	return true;
 }
 
-static void parseBatchResult (xe::TestLogParser& parser, const char* filename)
+static void parseBatchResult (xe::IndexedTestLogHandler& handler, const char* filename, bool cacheIndex)
 {
-	std::ifstream	in			(filename, std::ios_base::binary);
-	deUint8			buf[2048];
+	xe::TestLogIndex index;
 
-	for (;;)
-	{
-		in.read((char*)&buf[0], sizeof(buf));
-		int numRead = (int)in.gcount();
-
-		if (numRead > 0)
-			parser.parse(&buf[0], numRead);
-
-		if (numRead < (int)sizeof(buf))
-			break;
-	}
+	xe::loadTestLogIndex(index, filename, cacheIndex);
+	xe::parseIndexedTestLog(filename, index, handler, true);
 }
 
 // Export to single file
@@ -138,7 +133,7 @@ struct BatchResultTotals
 	int countByCode[xe::TESTSTATUSCODE_LAST];
 };
 
-class ResultToSingleXmlLogHandler : public xe::TestLogHandler
+class ResultToSingleXmlLogHandler : public xe::IndexedTestLogHandler
 {
 public:
 	ResultToSingleXmlLogHandler (xe::xml::Writer& writer, BatchResultTotals& totals)
@@ -147,25 +142,8 @@ public:
 	{
 	}
 
-	void setSessionInfo (const xe::SessionInfo&)
-	{
-	}
-
-	xe::TestCaseResultPtr startTestCaseResult (const char* casePath)
-	{
-		return xe::TestCaseResultPtr(new xe::TestCaseResultData(casePath));
-	}
-
-	void testCaseResultUpdated (const xe::TestCaseResultPtr&)
-	{
-	}
-
-	void testCaseResultComplete (const xe::TestCaseResultPtr& resultData)
+	void testCaseResultComplete (const xe::TestCaseResult& result)
 	{
-		xe::TestCaseResult result;
-
-		xe::parseTestCaseResultFromData(&m_resultParser, &result, *resultData.get());
-
 		// Write result.
 		xe::writeTestResult(result, m_writer);
 
@@ -177,7 +155,6 @@ public:
 private:
 	xe::xml::Writer&		m_writer;
 	BatchResultTotals&		m_totals;
-	xe::TestResultParser	m_resultParser;
 };
 
 static void writeTotals (xe::xml::Writer& writer, const BatchResultTotals& totals)
@@ -198,13 +175,12 @@ static void writeTotals (xe::xml::Writer& writer, const BatchResultTotals& total
 		   << Writer::EndElement;
 }
 
-static void batchResultToSingleXmlFile (const char* batchResultFilename, const char* dstFileName)
+static void batchResultToSingleXmlFile (const char* batchResultFilename, const char* dstFileName, bool cacheIndex)
 {
 	std::ofstream				out			(dstFileName, std::ios_base::binary);
 	xe::xml::Writer				writer		(out);
 	BatchResultTotals			totals;
 	ResultToSingleXmlLogHandler	handler		(writer, totals);
-	xe::TestLogParser			parser		(&handler);
 
 	XE_CHECK(out.good());
 
@@ -215,7 +191,7 @@ static void batchResultToSingleXmlFile (const char* batchResultFilename, const c
 		   << xe::xml::Writer::Attribute("FileName", de::FilePath(batchResultFilename).getBaseName());
 
 	// Parse and write individual cases
-	parseBatchResult(parser, batchResultFilename);
+	parseBatchResult(handler, batchResultFilename, cacheIndex);
 
 	// Write ResultTotals
 	writeTotals(writer, totals);
@@ -226,7 +202,7 @@ static void batchResultToSingleXmlFile (const char* batchResultFilename, const c
 
 // Export to separate files
 
-class ResultToXmlFilesLogHandler : public xe::TestLogHandler
+class ResultToXmlFilesLogHandler : public xe::IndexedTestLogHandler
 {
 public:
 	ResultToXmlFilesLogHandler (vector<xe::TestCaseResultHeader>& resultHeaders, const char* dstPath)
@@ -235,25 +211,8 @@ public:
 	{
 	}
 
-	void setSessionInfo (const xe::SessionInfo&)
+	void testCaseResultComplete (const xe::TestCaseResult& result)
 	{
-	}
-
-	xe::TestCaseResultPtr startTestCaseResult (const char* casePath)
-	{
-		return xe::TestCaseResultPtr(new xe::TestCaseResultData(casePath));
-	}
-
-	void testCaseResultUpdated (const xe::TestCaseResultPtr&)
-	{
-	}
-
-	void testCaseResultComplete (const xe::TestCaseResultPtr& resultData)
-	{
-		xe::TestCaseResult result;
-
-		xe::parseTestCaseResultFromData(&m_resultParser, &result, *resultData.get());
-
 		// Write result.
 		{
 			de::FilePath	casePath	= de::FilePath::join(m_dstPath, (result.casePath + ".xml").c_str());
@@ -275,7 +234,6 @@ public:
 private:
 	vector<xe::TestCaseResultHeader>&	m_resultHeaders;
 	std::string							m_dstPath;
-	xe::TestResultParser				m_resultParser;
 };
 
 typedef std::map<const xe::TestCase*, const xe::TestCaseResultHeader*> ShortTestResultMap;
@@ -331,7 +289,7 @@ static void writeTestCaseList (const xe::TestRoot& root, const ShortTestResultMa
 	dst << Writer::EndElement;
 }
 
-static void batchResultToSeparateXmlFiles (const char* batchResultFilename, const char* dstPath)
+static void batchResultToSeparateXmlFiles (const char* batchResultFilename, const char* dstPath, bool cacheIndex)
 {
 	xe::TestRoot						testRoot;
 	vector<xe::TestCaseResultHeader>	shortResults;
@@ -345,10 +303,9 @@ static void batchResultToSeparateXmlFiles (const char* batchResultFilename, cons
 
 	// Parse batch result and write out test cases.
 	{
-		ResultToXmlFilesLogHandler	handler		(shortResults, dstPath);
-		xe::TestLogParser			parser		(&handler);
+		ResultToXmlFilesLogHandler handler (shortResults, dstPath);
 
-		parseBatchResult(parser, batchResultFilename);
+		parseBatchResult(handler, batchResultFilename, cacheIndex);
 	}
 
 	// Build case hierarchy & short result map.
@@ -386,9 +343,9 @@ int main (int argc, const char* const* argv)
 			return -1;
 
 		if (cmdLine.outputMode == OUTPUTMODE_SINGLE)
-			batchResultToSingleXmlFile(cmdLine.batchResultFile.c_str(), cmdLine.outputPath.c_str());
+			batchResultToSingleXmlFile(cmdLine.batchResultFile.c_str(), cmdLine.outputPath.c_str(), cmdLine.cacheIndex);
 		else
-			batchResultToSeparateXmlFiles(cmdLine.batchResultFile.c_str(), cmdLine.outputPath.c_str());
+			batchResultToSeparateXmlFiles(cmdLine.batchResultFile.c_str(), cmdLine.outputPath.c_str(), cmdLine.cacheIndex);
 	}
 	catch (const std::exception& e)
 	{
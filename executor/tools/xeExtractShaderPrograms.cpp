@@ -21,8 +21,7 @@
  * \brief Extract shader programs from log.
  *//*--------------------------------------------------------------------*/
 
-#include "xeTestLogParser.hpp"
-#include "xeTestResultParser.hpp"
+#include "xeTestLogIndex.hpp"
 #include "deFilePath.hpp"
 #include "deStringUtil.hpp"
 #include "deString.h"
@@ -43,11 +42,13 @@ using std::map;
 struct CommandLine
 {
 	CommandLine (void)
+		: cacheIndex(false)
 	{
 	}
 
 	string		filename;
 	string		dstPath;
+	bool		cacheIndex;
 };
 
 static const char* getShaderTypeSuffix (const xe::ri::Shader::ShaderType shaderType)
@@ -128,7 +129,7 @@ static void extractShaderPrograms (const CommandLine& cmdLine, const std::string
 		std::cout << "WARNING: no shader programs found in '" << casePath << "'\n";
 }
 
-class ShaderProgramExtractHandler : public xe::TestLogHandler
+class ShaderProgramExtractHandler : public xe::IndexedTestLogHandler
 {
 public:
 	ShaderProgramExtractHandler (const CommandLine& cmdLine)
@@ -136,69 +137,43 @@ public:
 	{
 	}
 
-	void setSessionInfo (const xe::SessionInfo&)
+	void testCaseResultComplete (const xe::TestCaseResult& result)
 	{
-		// Ignored.
-	}
-
-	xe::TestCaseResultPtr startTestCaseResult (const char* casePath)
-	{
-		return xe::TestCaseResultPtr(new xe::TestCaseResultData(casePath));
-	}
-
-	void testCaseResultUpdated (const xe::TestCaseResultPtr&)
-	{
-		// Ignored.
-	}
-
-	void testCaseResultComplete (const xe::TestCaseResultPtr& caseData)
-	{
-		if (caseData->getDataSize() > 0)
-		{
-			xe::TestCaseResult					fullResult;
-			xe::TestResultParser::ParseResult	parseResult;
-
-			m_testResultParser.init(&fullResult);
-			parseResult = m_testResultParser.parse(caseData->getData(), caseData->getDataSize());
-			DE_UNREF(parseResult);
-
-			extractShaderPrograms(m_cmdLine, caseData->getTestCasePath(), fullResult);
-		}
+		extractShaderPrograms(m_cmdLine, result.casePath, result);
 	}
 
 private:
 	const CommandLine&		m_cmdLine;
-	xe::TestResultParser	m_testResultParser;
 };
 
 static void extractShaderProgramsFromLogFile (const CommandLine& cmdLine)
 {
-	std::ifstream					in				(cmdLine.filename.c_str(), std::ifstream::binary|std::ifstream::in);
+	const char* const				filename		= cmdLine.filename.c_str();
 	ShaderProgramExtractHandler		resultHandler	(cmdLine);
-	xe::TestLogParser				parser			(&resultHandler);
-	deUint8							buf				[1024];
-	int								numRead			= 0;
+	xe::TestLogIndex				index;
 
-	if (!in.good())
-		throw std::runtime_error(string("Failed to open '") + cmdLine.filename + "'");
+	xe::loadTestLogIndex(index, filename, cmdLine.cacheIndex);
 
-	for (;;)
+	// Cases without log data can't contain programs
 	{
-		in.read((char*)&buf[0], DE_LENGTH_OF_ARRAY(buf));
-		numRead = (int)in.gcount();
+		vector<xe::TestLogIndexEntry> casesWithData;
 
-		if (numRead <= 0)
-			break;
+		for (vector<xe::TestLogIndexEntry>::const_iterator entry = index.cases.begin(); entry != index.cases.end(); ++entry)
+		{
+			if (entry->dataSize > 0)
+				casesWithData.push_back(*entry);
+		}
 
-		parser.parse(&buf[0], numRead);
+		index.cases.swap(casesWithData);
 	}
 
-	in.close();
+	xe::parseIndexedTestLog(filename, index, resultHandler, false);
 }
 
 static void printHelp (const char* binName)
 {
-	printf("%s: [filename] [dst path (optional)]\n", binName);
+	printf("%s: [--cache-index] [filename] [dst path (optional)]\n", binName);
+	printf("  --cache-index    Read and write test log index to <filename>.idx\n");
 }
 
 static bool parseCommandLine (CommandLine& cmdLine, int argc, const char* const* argv)
@@ -216,6 +191,8 @@ static bool parseCommandLine (CommandLine& cmdLine, int argc, const char* const*
 			else
 				return false;
 		}
+		else if (deStringEqual(arg, "--cache-index"))
+			cmdLine.cacheIndex = true;
 		else
 			return false;
 	}
@@ -22,7 +22,6 @@
  *//*--------------------------------------------------------------------*/
 
 #include "xeTestLogParser.hpp"
-#include "xeTestResultParser.hpp"
 #include "deFilePath.hpp"
 #include "deString.h"
 
@@ -101,29 +100,29 @@ private:
 	vector<CaseValues*>	m_caseValues;
 };
 
-static Value findValueByTag (const xe::ri::List& items, const string& tagName)
+//! Store value of each number named in tagNames, first occurrence of each name is used.
+static void findValues (const xe::ri::Item& item, const vector<string>& tagNames, vector<Value>& values)
 {
-	for (int ndx = 0; ndx < items.getNumItems(); ndx++)
+	if (item.getType() == xe::ri::TYPE_SECTION)
 	{
-		const xe::ri::Item& item = items.getItem(ndx);
+		const xe::ri::List& items = static_cast<const xe::ri::Section&>(item).items;
 
-		if (item.getType() == xe::ri::TYPE_SECTION)
-		{
-			const Value value = findValueByTag(static_cast<const xe::ri::Section&>(item).items, tagName);
-			if (value.getType() != Value::TYPE_EMPTY)
-				return value;
-		}
-		else if (item.getType() == xe::ri::TYPE_NUMBER)
+		for (int ndx = 0; ndx < items.getNumItems(); ndx++)
+			findValues(items.getItem(ndx), tagNames, values);
+	}
+	else if (item.getType() == xe::ri::TYPE_NUMBER)
+	{
+		const xe::ri::Number& number = static_cast<const xe::ri::Number&>(item);
+
+		for (size_t tagNdx = 0; tagNdx < tagNames.size(); tagNdx++)
 		{
-			const xe::ri::Number& value = static_cast<const xe::ri::Number&>(item);
-			return value.value;
+			if (tagNames[tagNdx] == number.name && values[tagNdx].getType() == Value::TYPE_EMPTY)
+				values[tagNdx] = number.value;
 		}
 	}
-
-	return Value();
 }
 
-class TagParser : public xe::TestLogHandler
+class TagParser : public xe::TestLogStreamHandler
 {
 public:
 	TagParser (BatchResultValues& result)
@@ -136,70 +135,41 @@ public:
 		// Ignored.
 	}
 
-	xe::TestCaseResultPtr startTestCaseResult (const char* casePath)
+	void startTestCaseResult (const char*)
 	{
-		return xe::TestCaseResultPtr(new xe::TestCaseResultData(casePath));
+		m_caseValues.assign(m_result.getTagNames().size(), Value());
 	}
 
-	void testCaseResultUpdated (const xe::TestCaseResultPtr&)
+	void resultItemParsed (const xe::TestCaseResult&, const xe::ri::Item& item)
 	{
-		// Ignored.
+		findValues(item, m_result.getTagNames(), m_caseValues);
 	}
 
-	void testCaseResultComplete (const xe::TestCaseResultPtr& caseData)
+	void testCaseResultComplete (const xe::TestCaseResult& result)
 	{
-		const vector<string>&	tagNames	= m_result.getTagNames();
-		CaseValues				tagResult;
-
-		tagResult.casePath		= caseData->getTestCasePath();
-		tagResult.caseType		= xe::TESTCASETYPE_SELF_VALIDATE;
-		tagResult.statusCode	= caseData->getStatusCode();
-		tagResult.statusDetails	= caseData->getStatusDetails();
-		tagResult.values.resize(tagNames.size());
+		CaseValues tagResult;
 
-		if (caseData->getDataSize() > 0 && caseData->getStatusCode() == xe::TESTSTATUSCODE_LAST)
-		{
-			xe::TestCaseResult					fullResult;
-			xe::TestResultParser::ParseResult	parseResult;
-
-			m_testResultParser.init(&fullResult);
-			parseResult = m_testResultParser.parse(caseData->getData(), caseData->getDataSize());
-
-			if ((parseResult != xe::TestResultParser::PARSERESULT_ERROR && fullResult.statusCode != xe::TESTSTATUSCODE_LAST) ||
-				(tagResult.statusCode == xe::TESTSTATUSCODE_LAST && fullResult.statusCode != xe::TESTSTATUSCODE_LAST))
-			{
-				tagResult.statusCode	= fullResult.statusCode;
-				tagResult.statusDetails	= fullResult.statusDetails;
-			}
-			else if (tagResult.statusCode == xe::TESTSTATUSCODE_LAST)
-			{
-				DE_ASSERT(parseResult == xe::TestResultParser::PARSERESULT_ERROR);
-				tagResult.statusCode	= xe::TESTSTATUSCODE_INTERNAL_ERROR;
-				tagResult.statusDetails	= "Test case result parsing failed";
-			}
-
-			if (parseResult != xe::TestResultParser::PARSERESULT_ERROR)
-			{
-				for (int valNdx = 0; valNdx < (int)tagNames.size(); valNdx++)
-					tagResult.values[valNdx] = findValueByTag(fullResult.resultItems, tagNames[valNdx]);
-			}
-		}
+		tagResult.casePath		= result.casePath;
+		tagResult.caseType		= result.caseType;
+		tagResult.statusCode	= result.statusCode;
+		tagResult.statusDetails	= result.statusDetails;
+		tagResult.values		= m_caseValues;
 
 		m_result.add(tagResult);
 	}
 
 private:
 	BatchResultValues&		m_result;
-	xe::TestResultParser	m_testResultParser;
+	vector<Value>			m_caseValues;
 };
 
 static void readLogFile (BatchResultValues& batchResult, const char* filename)
 {
-	std::ifstream		in				(filename, std::ifstream::binary|std::ifstream::in);
-	TagParser			resultHandler	(batchResult);
-	xe::TestLogParser	parser			(&resultHandler);
-	deUint8				buf				[1024];
-	int					numRead			= 0;
+	std::ifstream				in				(filename, std::ifstream::binary|std::ifstream::in);
+	TagParser					resultHandler	(batchResult);
+	xe::TestLogStreamParser		parser			(&resultHandler);
+	deUint8						buf				[1024];
+	int							numRead			= 0;
 
 	if (!in.good())
 		throw std::runtime_error(string("Failed to open '") + filename + "'");
@@ -0,0 +1,290 @@
+/*-------------------------------------------------------------------------
+ * drawElements Quality Program Test Executor
+ * ------------------------------------------
+ *
+ * Copyright 2019 The Android Open Source Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ *//*!
+ * \file
+ * \brief Query and compare result databases.
+ *
+ * With one database, cases are listed. With two databases, cases whose
+ * status differs between them are listed. Output is CSV.
+ *//*--------------------------------------------------------------------*/
+
+#include "xeResultDatabase.hpp"
+#include "xeTestResultParser.hpp"
+#include "deStringUtil.hpp"
+#include "deCommandLine.hpp"
+
+#include <vector>
+#include <string>
+#include <cstdio>
+#include <iostream>
+
+using std::vector;
+using std::string;
+
+namespace opt
+{
+
+DE_DECLARE_COMMAND_LINE_OPT(Filter,		string);
+DE_DECLARE_COMMAND_LINE_OPT(Status,		string);
+DE_DECLARE_COMMAND_LINE_OPT(Value,		string);
+DE_DECLARE_COMMAND_LINE_OPT(All,		bool);
+
+void registerOptions (de::cmdline::Parser& parser)
+{
+	using de::cmdline::Option;
+
+	parser << Option<Filter>	("f", "filter",	"Case path pattern, * matches any characters",				"*")
+		   << Option<Status>	("s", "status",	"Comma-separated status codes to include, e.g. Fail,Crash",	"")
+		   << Option<Value>		("v", "value",	"Include first value with given name",						"")
+		   << Option<All>		("a", "all",	"Include cases with unchanged status when comparing");
+}
+
+} // opt
+
+struct CommandLine
+{
+	CommandLine (void)
+		: includeUnchanged(false)
+	{
+	}
+
+	vector<string>		databaseFiles;
+	string				filter;
+	vector<bool>		statusMask;			//!< Empty if all status codes are included.
+	string				valueName;
+	bool				includeUnchanged;
+};
+
+static bool parseCommandLine (CommandLine& cmdLine, int argc, const char* const* argv)
+{
+	de::cmdline::Parser			parser;
+	de::cmdline::CommandLine	opts;
+
+	opt::registerOptions(parser);
+
+	if (!parser.parse(argc-1, argv+1, &opts, std::cerr) ||
+		opts.getArgs().size() < 1 || opts.getArgs().size() > 2)
+	{
+		printf("%s: [options] [database] [[database to compare against]]\n", argv[0]);
+		parser.help(std::cout);
+		return false;
+	}
+
+	cmdLine.databaseFiles		= opts.getArgs();
+	cmdLine.filter				= opts.getOption<opt::Filter>();
+	cmdLine.valueName			= opts.getOption<opt::Value>();
+	cmdLine.includeUnchanged	= opts.getOption<opt::All>();
+
+	if (!opts.getOption<opt::Status>().empty())
+	{
+		const vector<string> statusCodes = de::splitString(opts.getOption<opt::Status>(), ',');
+
+		cmdLine.statusMask.resize(xe::TESTSTATUSCODE_LAST+1, false);
+
+		for (vector<string>::const_iterator statusCode = statusCodes.begin(); statusCode != statusCodes.end(); ++statusCode)
+		{
+			try
+			{
+				cmdLine.statusMask[xe::getTestStatusCode(statusCode->c_str())] = true;
+			}
+			catch (const xe::ParseError& e)
+			{
+				std::cerr << e.what() << "\n";
+				return false;
+			}
+		}
+	}
+
+	return true;
+}
+
+static bool matchPattern (const char* pattern, const char* str)
+{
+	for (; *pattern; pattern++, str++)
+	{
+		if (*pattern == '*')
+		{
+			for (const char* rest = str;; rest++)
+			{
+				if (matchPattern(pattern+1, rest))
+					return true;
+
+				if (!*rest)
+					return false;
+			}
+		}
+
+		if (*pattern != *str)
+			return false;
+	}
+
+	return *str == 0;
+}
+
+static bool isStatusIncluded (const CommandLine& cmdLine, xe::TestStatusCode statusCode)
+{
+	return cmdLine.statusMask.empty() || cmdLine.statusMask[statusCode];
+}
+
+static const char* getStatusName (const xe::ResultDatabase& database, int caseNdx)
+{
+	if (caseNdx < 0)
+		return "Missing";
+	else if (database.getStatusCode(caseNdx) == xe::TESTSTATUSCODE_LAST)
+		return "";
+	else
+		return xe::getTestStatusCodeName(database.getStatusCode(caseNdx));
+}
+
+static void printDuration (std::ostream& dst, const xe::ResultDatabase& database, int caseNdx)
+{
+	if (caseNdx >= 0 && database.getDuration(caseNdx) >= 0)
+		dst << database.getDuration(caseNdx);
+}
+
+static void printValue (std::ostream& dst, const xe::ResultDatabase& database, int caseNdx, const string& valueName)
+{
+	if (caseNdx < 0)
+		return;
+
+	for (int valueNdx = 0; valueNdx < database.getNumValues(caseNdx); valueNdx++)
+	{
+		if (database.getValueName(caseNdx, valueNdx) == valueName)
+		{
+			dst << database.getValue(caseNdx, valueNdx);
+			return;
+		}
+	}
+}
+
+static void listCases (const CommandLine& cmdLine, const xe::ResultDatabase& database, std::ostream& dst)
+{
+	dst << "CasePath,StatusCode,Duration";
+	if (!cmdLine.valueName.empty())
+		dst << "," << cmdLine.valueName;
+	dst << "\n";
+
+	for (int caseNdx = 0; caseNdx < database.getNumCases(); caseNdx++)
+	{
+		const string casePath = database.getCasePath(caseNdx);
+
+		if (!isStatusIncluded(cmdLine, database.getStatusCode(caseNdx)) || !matchPattern(cmdLine.filter.c_str(), casePath.c_str()))
+			continue;
+
+		dst << casePath << "," << getStatusName(database, caseNdx) << ",";
+		printDuration(dst, database, caseNdx);
+
+		if (!cmdLine.valueName.empty())
+		{
+			dst << ",";
+			printValue(dst, database, caseNdx, cmdLine.valueName);
+		}
+
+		dst << "\n";
+	}
+}
+
+static void printCaseDiff (const CommandLine& cmdLine, const string& casePath, const xe::ResultDatabase& databaseA, int caseNdxA, const xe::ResultDatabase& databaseB, int caseNdxB, std::ostream& dst)
+{
+	const bool statusChanged = caseNdxA < 0 || caseNdxB < 0 || databaseA.getStatusCode(caseNdxA) != databaseB.getStatusCode(caseNdxB);
+
+	if (!statusChanged && !cmdLine.includeUnchanged)
+		return;
+
+	if (!((caseNdxA >= 0 && isStatusIncluded(cmdLine, databaseA.getStatusCode(caseNdxA))) ||
+		  (caseNdxB >= 0 && isStatusIncluded(cmdLine, databaseB.getStatusCode(caseNdxB)))))
+		return;
+
+	if (!matchPattern(cmdLine.filter.c_str(), casePath.c_str()))
+		return;
+
+	dst << casePath << "," << getStatusName(databaseA, caseNdxA) << "," << getStatusName(databaseB, caseNdxB) << ",";
+	printDuration(dst, databaseA, caseNdxA);
+	dst << ",";
+	printDuration(dst, databaseB, caseNdxB);
+
+	if (!cmdLine.valueName.empty())
+	{
+		dst << ",";
+		printValue(dst, databaseA, caseNdxA, cmdLine.valueName);
+		dst << ",";
+		printValue(dst, databaseB, caseNdxB, cmdLine.valueName);
+	}
+
+	dst << "\n";
+}
+
+static void compareCases (const CommandLine& cmdLine, const xe::ResultDatabase& databaseA, const xe::ResultDatabase& databaseB, std::ostream& dst)
+{
+	dst << "CasePath,StatusCodeA,StatusCodeB,DurationA,DurationB";
+	if (!cmdLine.valueName.empty())
+		dst << "," << cmdLine.valueName << "A," << cmdLine.valueName << "B";
+	dst << "\n";
+
+	// Cases in A, in order of A
+	for (int caseNdxA = 0; caseNdxA < databaseA.getNumCases(); caseNdxA++)
+	{
+		const string casePath = databaseA.getCasePath(caseNdxA);
+		printCaseDiff(cmdLine, casePath, databaseA, caseNdxA, databaseB, databaseB.findCase(casePath), dst);
+	}
+
+	// Cases only in B
+	for (int caseNdxB = 0; caseNdxB < databaseB.getNumCases(); caseNdxB++)
+	{
+		const string casePath = databaseB.getCasePath(caseNdxB);
+
+		if (databaseA.findCase(casePath) < 0)
+			printCaseDiff(cmdLine, casePath, databaseA, -1, databaseB, caseNdxB, dst);
+	}
+}
+
+int main (int argc, const char* const* argv)
+{
+	try
+	{
+		CommandLine cmdLine;
+
+		if (!parseCommandLine(cmdLine, argc, argv))
+			return -1;
+
+		if (cmdLine.databaseFiles.size() == 1)
+		{
+			xe::ResultDatabase database;
+
+			database.read(cmdLine.databaseFiles[0].c_str());
+			listCases(cmdLine, database, std::cout);
+		}
+		else
+		{
+			xe::ResultDatabase databaseA;
+			xe::ResultDatabase databaseB;
+
+			databaseA.read(cmdLine.databaseFiles[0].c_str());
+			databaseB.read(cmdLine.databaseFiles[1].c_str());
+			compareCases(cmdLine, databaseA, databaseB, std::cout);
+		}
+	}
+	catch (const std::exception& e)
+	{
+		printf("FATAL ERROR: %s\n", e.what());
+		return -1;
+	}
+
+	return 0;
+}
@@ -21,11 +21,9 @@
  * \brief Test log compare utility.
  *//*--------------------------------------------------------------------*/
 
-#include "xeTestLogParser.hpp"
-#include "xeTestResultParser.hpp"
+#include "xeTestLogIndex.hpp"
 #include "deFilePath.hpp"
 #include "deString.h"
-#include "deThread.hpp"
 #include "deCommandLine.hpp"
 
 #include <vector>
@@ -72,6 +70,7 @@ namespace opt
 DE_DECLARE_COMMAND_LINE_OPT(OutMode,	OutputMode);
 DE_DECLARE_COMMAND_LINE_OPT(OutFormat,	OutputFormat);
 DE_DECLARE_COMMAND_LINE_OPT(OutValue,	OutputValue);
+DE_DECLARE_COMMAND_LINE_OPT(CacheIndex,	bool);
 
 static void registerOptions (de::cmdline::Parser& parser)
 {
@@ -96,7 +95,8 @@ static void registerOptions (de::cmdline::Parser& parser)
 
 	parser << Option<OutFormat>		("f",	"format",		"Output format",	s_outputFormats,	"csv")
 		   << Option<OutMode>		("m",	"mode",			"Output mode",		s_outputModes,		"all")
-		   << Option<OutValue>		("v",	"value",		"Value to extract",	s_outputValues,		"code");
+		   << Option<OutValue>		("v",	"value",		"Value to extract",	s_outputValues,		"code")
+		   << Option<CacheIndex>	("i",	"cache-index",	"Read and write test log index to <filename>.idx");
 }
 
 } // opt
@@ -107,12 +107,14 @@ struct CommandLine
 		: outMode	(OUTPUTMODE_ALL)
 		, outFormat	(OUTPUTFORMAT_CSV)
 		, outValue	(OUTPUTVALUE_STATUS_CODE)
+		, cacheIndex	(false)
 	{
 	}
 
 	OutputMode			outMode;
 	OutputFormat		outFormat;
 	OutputValue			outValue;
+	bool				cacheIndex;
 	vector<string>		filenames;
 };
 
@@ -122,7 +124,7 @@ struct ShortBatchResult
 	map<string, int>					resultMap;
 };
 
-class ShortResultHandler : public xe::TestLogHandler
+class ShortResultHandler : public xe::IndexedTestLogHandler
 {
 public:
 	ShortResultHandler (ShortBatchResult& result)
@@ -130,91 +132,28 @@ public:
 	{
 	}
 
-	void setSessionInfo (const xe::SessionInfo&)
+	void testCaseResultComplete (const xe::TestCaseResult& result)
 	{
-		// Ignored.
-	}
-
-	xe::TestCaseResultPtr startTestCaseResult (const char* casePath)
-	{
-		return xe::TestCaseResultPtr(new xe::TestCaseResultData(casePath));
-	}
-
-	void testCaseResultUpdated (const xe::TestCaseResultPtr&)
-	{
-		// Ignored.
-	}
-
-	void testCaseResultComplete (const xe::TestCaseResultPtr& caseData)
-	{
-		xe::TestCaseResultHeader	header;
-		int							caseNdx	= (int)m_result.resultHeaders.size();
-
-		header.casePath			= caseData->getTestCasePath();
-		header.caseType			= xe::TESTCASETYPE_SELF_VALIDATE;
-		header.statusCode		= caseData->getStatusCode();
-		header.statusDetails	= caseData->getStatusDetails();
-
-		if (header.statusCode == xe::TESTSTATUSCODE_LAST)
-		{
-			xe::TestCaseResult fullResult;
-
-			xe::parseTestCaseResultFromData(&m_testResultParser, &fullResult, *caseData.get());
-
-			header = xe::TestCaseResultHeader(fullResult);
-		}
+		const int caseNdx = (int)m_result.resultHeaders.size();
 
 		// Insert into result list & map.
-		m_result.resultHeaders.push_back(header);
-		m_result.resultMap[header.casePath] = caseNdx;
+		m_result.resultHeaders.push_back(xe::TestCaseResultHeader(result));
+		m_result.resultMap[result.casePath] = caseNdx;
 	}
 
 private:
 	ShortBatchResult&		m_result;
-	xe::TestResultParser	m_testResultParser;
 };
 
-static void readLogFile (ShortBatchResult& batchResult, const char* filename)
+static void readLogFile (ShortBatchResult& batchResult, const char* filename, bool cacheIndex)
 {
-	std::ifstream		in				(filename, std::ifstream::binary|std::ifstream::in);
 	ShortResultHandler	resultHandler	(batchResult);
-	xe::TestLogParser	parser			(&resultHandler);
-	deUint8				buf				[1024];
-	int					numRead			= 0;
-
-	for (;;)
-	{
-		in.read((char*)&buf[0], DE_LENGTH_OF_ARRAY(buf));
-		numRead = (int)in.gcount();
-
-		if (numRead <= 0)
-			break;
-
-		parser.parse(&buf[0], numRead);
-	}
+	xe::TestLogIndex	index;
 
-	in.close();
+	xe::loadTestLogIndex(index, filename, cacheIndex);
+	xe::parseIndexedTestLog(filename, index, resultHandler, false);
 }
 
-class LogFileReader : public de::Thread
-{
-public:
-	LogFileReader (ShortBatchResult& batchResult, const char* filename)
-		: m_batchResult	(batchResult)
-		, m_filename	(filename)
-	{
-	}
-
-	void run (void)
-	{
-		readLogFile(m_batchResult, m_filename.c_str());
-	}
-
-private:
-	ShortBatchResult&	m_batchResult;
-	std::string			m_filename;
-};
-
 static void computeCaseList (vector<string>& cases, const vector<ShortBatchResult>& batchResults)
 {
 	// \todo [2012-07-10 pyry] Do proper case ordering (eg. handle missing cases nicely).
@@ -272,23 +211,15 @@ static bool runCompare (const CommandLine& cmdLine, std::ostream& dst)
 	try
 	{
 		// Read in batch results
+		// \note Cases of each file are parsed in parallel
 		results.resize(cmdLine.filenames.size());
-		{
-			std::vector<de::SharedPtr<LogFileReader> > readers;
 
-			for (int ndx = 0; ndx < (int)cmdLine.filenames.size(); ndx++)
-			{
-				readers.push_back(de::SharedPtr<LogFileReader>(new LogFileReader(results[ndx], cmdLine.filenames[ndx].c_str())));
-				readers.back()->start();
-			}
-
-			for (int ndx = 0; ndx < (int)cmdLine.filenames.size(); ndx++)
-			{
-				readers[ndx]->join();
+		for (int ndx = 0; ndx < (int)cmdLine.filenames.size(); ndx++)
+		{
+			readLogFile(results[ndx], cmdLine.filenames[ndx].c_str(), cmdLine.cacheIndex);
 
-				// Use file name as batch name.
-				batchNames.push_back(de::FilePath(cmdLine.filenames[ndx].c_str()).getBaseName());
-			}
+			// Use file name as batch name.
+			batchNames.push_back(de::FilePath(cmdLine.filenames[ndx].c_str()).getBaseName());
 		}
 
 		// Compute unified case list.
@@ -384,6 +315,7 @@ static bool parseCommandLine (CommandLine& cmdLine, int argc, const char* const*
 	cmdLine.outFormat	= opts.getOption<opt::OutFormat>();
 	cmdLine.outMode		= opts.getOption<opt::OutMode>();
 	cmdLine.outValue	= opts.getOption<opt::OutValue>();
+	cmdLine.cacheIndex	= opts.getOption<opt::CacheIndex>();
 	cmdLine.filenames	= opts.getArgs();
 
 	return true;
@@ -0,0 +1,464 @@
+/*-------------------------------------------------------------------------
+ * drawElements Quality Program Test Executor
+ * ------------------------------------------
+ *
+ * Copyright 2019 The Android Open Source Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ *//*!
+ * \file
+ * \brief Columnar test result database.
+ *//*--------------------------------------------------------------------*/
+
+#include "xeResultDatabase.hpp"
+#include "deMemory.h"
+
+#include <fstream>
+
+using std::string;
+using std::vector;
+using std::map;
+
+namespace xe
+{
+
+namespace
+{
+
+/*--------------------------------------------------------------------*//*!
+ * File layout, all values little-endian:
+ *
+ *  u32 magic, u32 version, u32 numCases, u32 numValues, u32 numStrings
+ *  numStrings x (u32 length, bytes)
+ *  numCases x u32 case group string
+ *  numCases x u32 case name string
+ *  numCases x u8 status code
+ *  numCases x u32 status details string
+ *  numCases x i64 duration
+ *  numCases x u32 first value index
+ *  numValues x u32 value name string
+ *  numValues x f64 value
+ *//*--------------------------------------------------------------------*/
+
+static const deUint32	DATABASE_FILE_MAGIC		= 0x42445258;	//!< "XRDB"
+static const deUint32	DATABASE_FILE_VERSION	= 1;
+static const char		DURATION_VALUE_NAME[]	= "TestDuration";
+
+class ColumnWriter
+{
+public:
+	void write (deUint8 value)
+	{
+		m_data.push_back(value);
+	}
+
+	void write (deUint32 value)
+	{
+		for (int ndx = 0; ndx < 4; ndx++)
+			m_data.push_back((deUint8)(value >> (8*ndx)));
+	}
+
+	void write (deUint64 value)
+	{
+		write((deUint32)(value & 0xffffffffu));
+		write((deUint32)(value >> 32));
+	}
+
+	void write (deInt64 value)
+	{
+		write((deUint64)value);
+	}
+
+	void write (double value)
+	{
+		deUint64 bits = 0;
+
+		DE_STATIC_ASSERT(sizeof(bits) == sizeof(value));
+		deMemcpy(&bits, &value, sizeof(bits));
+
+		write(bits);
+	}
+
+	void write (const string& str)
+	{
+		write((deUint32)str.size());
+		m_data.insert(m_data.end(), str.begin(), str.end());
+	}
+
+	template<typename T>
+	void writeColumn (const vector<T>& column)
+	{
+		for (typename vector<T>::const_iterator value = column.begin(); value != column.end(); ++value)
+			write(*value);
+	}
+
+	const vector<deUint8>& getData (void) const { return m_data; }
+
+private:
+	vector<deUint8> m_data;
+};
+
+class ColumnReader
+{
+public:
+	ColumnReader (const vector<deUint8>& data)
+		: m_data	(data)
+		, m_pos		(0)
+	{
+	}
+
+	void read (deUint8& dst)
+	{
+		checkSize(1);
+		dst = m_data[m_pos++];
+	}
+
+	void read (deUint32& dst)
+	{
+		checkSize(4);
+
+		dst = 0;
+		for (int ndx = 0; ndx < 4; ndx++)
+			dst |= (deUint32)m_data[m_pos+ndx] << (8*ndx);
+
+		m_pos += 4;
+	}
+
+	void read (deUint64& dst)
+	{
+		deUint32 low	= 0;
+		deUint32 high	= 0;
+
+		read(low);
+		read(high);
+
+		dst = ((deUint64)high << 32) | low;
+	}
+
+	void read (deInt64& dst)
+	{
+		deUint64 bits = 0;
+		read(bits);
+		dst = (deInt64)bits;
+	}
+
+	void read (double& dst)
+	{
+		deUint64 bits = 0;
+		read(bits);
+		deMemcpy(&dst, &bits, sizeof(dst));
+	}
+
+	void read (string& dst)
+	{
+		deUint32 size = 0;
+
+		read(size);
+		checkSize(size);
+
+		dst.assign((const char*)&m_data[0] + m_pos, size);
+		m_pos += size;
+	}
+
+	template<typename T>
+	void readColumn (vector<T>& dst, deUint32 size)
+	{
+		checkSize(size);	// Each element takes at least one byte
+		dst.resize(size);
+
+		for (deUint32 ndx = 0; ndx < size; ndx++)
+			read(dst[ndx]);
+	}
+
+	bool isAtEnd (void) const { return m_pos == m_data.size(); }
+
+private:
+	void checkSize (size_t size) const
+	{
+		if (m_data.size() - m_pos < size)
+			throw Error("Result database is truncated");
+	}
+
+	const vector<deUint8>&	m_data;
+	size_t					m_pos;
+};
+
+static void checkStringIds (const vector<deUint32>& ids, size_t numStrings)
+{
+	for (vector<deUint32>::const_iterator id = ids.begin(); id != ids.end(); ++id)
+	{
+		if (*id >= numStrings)
+			throw Error("Invalid string in result database");
+	}
+}
+
+} // anonymous
+
+ResultDatabase::ResultDatabase (void)
+{
+}
+
+ResultDatabase::~ResultDatabase (void)
+{
+}
+
+void ResultDatabase::clear (void)
+{
+	m_strings.clear();
+	m_stringIds.clear();
+	m_caseGroups.clear();
+	m_caseNames.clear();
+	m_statusCodes.clear();
+	m_statusDetails.clear();
+	m_durations.clear();
+	m_valueStarts.clear();
+	m_valueNames.clear();
+	m_values.clear();
+	m_caseNdxMap.clear();
+}
+
+deUint32 ResultDatabase::getStringId (const string& str)
+{
+	const map<string, deUint32>::const_iterator pos = m_stringIds.find(str);
+
+	if (pos != m_stringIds.end())
+		return pos->second;
+
+	m_strings.push_back(str);
+	m_stringIds[str] = (deUint32)(m_strings.size()-1);
+
+	return (deUint32)(m_strings.size()-1);
+}
+
+void ResultDatabase::addValue (const string& name, const ri::NumericValue& value)
+{
+	if (value.getType() == ri::NumericValue::TYPE_EMPTY)
+		return;
+
+	m_valueNames.push_back(getStringId(name));
+	m_values.push_back(value.getType() == ri::NumericValue::TYPE_INT64 ? (double)value.getInt64() : value.getFloat64());
+}
+
+void ResultDatabase::addValues (const ri::List& items, deInt64& duration)
+{
+	for (int itemNdx = 0; itemNdx < items.getNumItems(); itemNdx++)
+	{
+		const ri::Item& item = items.getItem(itemNdx);
+
+		if (item.getType() == ri::TYPE_SECTION)
+			addValues(static_cast<const ri::Section&>(item).items, duration);
+		else if (item.getType() == ri::TYPE_NUMBER)
+		{
+			const ri::Number& number = static_cast<const ri::Number&>(item);
+
+			if (number.name == DURATION_VALUE_NAME && number.value.getType() == ri::NumericValue::TYPE_INT64)
+				duration = number.value.getInt64();
+			else
+				addValue(number.name, number.value);
+		}
+		else if (item.getType() == ri::TYPE_SAMPLELIST)
+		{
+			// Values of each sample are stored as "<sample list>.<value>"
+			const ri::SampleList&	sampleList	= static_cast<const ri::SampleList&>(item);
+			const ri::List&			valueInfos	= sampleList.sampleInfo.valueInfos;
+
+			for (int sampleNdx = 0; sampleNdx < sampleList.samples.getNumItems(); sampleNdx++)
+			{
+				const ri::List& values = static_cast<const ri::Sample&>(sampleList.samples.getItem(sampleNdx)).values;
+
+				for (int valueNdx = 0; valueNdx < values.getNumItems() && valueNdx < valueInfos.getNumItems(); valueNdx++)
+				{
+					const ri::ValueInfo&	valueInfo	= static_cast<const ri::ValueInfo&>(valueInfos.getItem(valueNdx));
+					const ri::SampleValue&	value		= static_cast<const ri::SampleValue&>(values.getItem(valueNdx));
+
+					addValue(sampleList.name + "." + valueInfo.name, value.value);
+				}
+			}
+		}
+	}
+}
+
+void ResultDatabase::addCase (const TestCaseResult& result)
+{
+	const size_t	groupEnd	= result.casePath.rfind('.');
+	deInt64			duration	= -1;
+
+	m_caseNdxMap.clear();
+
+	if (groupEnd != string::npos)
+	{
+		m_caseGroups.push_back(getStringId(result.casePath.substr(0, groupEnd)));
+		m_caseNames.push_back(getStringId(result.casePath.substr(groupEnd+1)));
+	}
+	else
+	{
+		m_caseGroups.push_back(getStringId(""));
+		m_caseNames.push_back(getStringId(result.casePath));
+	}
+
+	m_statusCodes.push_back((deUint8)result.statusCode);
+	m_statusDetails.push_back(getStringId(result.statusDetails));
+	m_valueStarts.push_back((deUint32)m_values.size());
+
+	addValues(result.resultItems, duration);
+
+	m_durations.push_back(duration);
+}
+
+string ResultDatabase::getCasePath (int caseNdx) const
+{
+	const string& group = m_strings[m_caseGroups[caseNdx]];
+
+	if (group.empty())
+		return m_strings[m_caseNames[caseNdx]];
+	else
+		return group + "." + m_strings[m_caseNames[caseNdx]];
+}
+
+int ResultDatabase::getNumValues (int caseNdx) const
+{
+	const deUint32 valueEnd = caseNdx+1 < getNumCases() ? m_valueStarts[caseNdx+1] : (deUint32)m_values.size();
+	return (int)(valueEnd - m_valueStarts[caseNdx]);
+}
+
+int ResultDatabase::findCase (const string& casePath) const
+{
+	if (m_caseNdxMap.empty())
+	{
+		for (int caseNdx = 0; caseNdx < getNumCases(); caseNdx++)
+			m_caseNdxMap.insert(std::make_pair(getCasePath(caseNdx), caseNdx));
+	}
+
+	{
+		const map<string, int>::const_iterator pos = m_caseNdxMap.find(casePath);
+		return pos != m_caseNdxMap.end() ? pos->second : -1;
+	}
+}
+
+void ResultDatabase::write (const char* filename) const
+{
+	ColumnWriter writer;
+
+	writer.write(DATABASE_FILE_MAGIC);
+	writer.write(DATABASE_FILE_VERSION);
+	writer.write((deUint32)getNumCases());
+	writer.write((deUint32)m_values.size());
+	writer.write((deUint32)m_strings.size());
+
+	writer.writeColumn(m_strings);
+	writer.writeColumn(m_caseGroups);
+	writer.writeColumn(m_caseNames);
+	writer.writeColumn(m_statusCodes);
+	writer.writeColumn(m_statusDetails);
+	writer.writeColumn(m_durations);
+	writer.writeColumn(m_valueStarts);
+	writer.writeColumn(m_valueNames);
+	writer.writeColumn(m_values);
+
+	{
+		std::ofstream out (filename, std::ios_base::binary|std::ios_base::trunc);
+
+		out.write((const char*)&writer.getData()[0], (std::streamsize)writer.getData().size());
+		out.close();
+
+		if (!out.good())
+			throw Error(string("Failed to write '") + filename + "'");
+	}
+}
+
+void ResultDatabase::read (const char* filename)
+{
+	vector<deUint8> data;
+
+	clear();
+
+	{
+		std::ifstream in (filename, std::ios_base::binary);
+
+		if (!in.good())
+			throw Error(string("Failed to open '") + filename + "'");
+
+		in.seekg(0, std::ios_base::end);
+
+		const std::streamoff size = in.tellg();
+
+		if (size <= 0)
+			throw Error(string("Failed to read '") + filename + "'");
+
+		data.resize((size_t)size);
+		in.seekg(0, std::ios_base::beg);
+
+		if (!in.read((char*)&data[0], (std::streamsize)data.size()))
+			throw Error(string("Failed to read '") + filename + "'");
+	}
+
+	try
+	{
+		ColumnReader	reader		(data);
+		deUint32		magic		= 0;
+		deUint32		version		= 0;
+		deUint32		numCases	= 0;
+		deUint32		numValues	= 0;
+		deUint32		numStrings	= 0;
+
+		reader.read(magic);
+		reader.read(version);
+
+		if (magic != DATABASE_FILE_MAGIC)
+			throw Error("Not a result database");
+
+		if (version != DATABASE_FILE_VERSION)
+			throw Error("Unsupported result database version");
+
+		reader.read(numCases);
+		reader.read(numValues);
+		reader.read(numStrings);
+
+		reader.readColumn(m_strings,		numStrings);
+		reader.readColumn(m_caseGroups,		numCases);
+		reader.readColumn(m_caseNames,		numCases);
+		reader.readColumn(m_statusCodes,	numCases);
+		reader.readColumn(m_statusDetails,	numCases);
+		reader.readColumn(m_durations,		numCases);
+		reader.readColumn(m_valueStarts,	numCases);
+		reader.readColumn(m_valueNames,		numValues);
+		reader.readColumn(m_values,			numValues);
+
+		if (!reader.isAtEnd())
+			throw Error("Unexpected data at end of result database");
+
+		checkStringIds(m_caseGroups,	m_strings.size());
+		checkStringIds(m_caseNames,		m_strings.size());
+		checkStringIds(m_statusDetails,	m_strings.size());
+		checkStringIds(m_valueNames,	m_strings.size());
+
+		for (deUint32 caseNdx = 0; caseNdx < numCases; caseNdx++)
+		{
+			if (m_statusCodes[caseNdx] > TESTSTATUSCODE_LAST ||
+				m_valueStarts[caseNdx] > numValues ||
+				(caseNdx > 0 && m_valueStarts[caseNdx] < m_valueStarts[caseNdx-1]))
+				throw Error("Invalid case in result database");
+		}
+
+		for (deUint32 strNdx = 0; strNdx < numStrings; strNdx++)
+			m_stringIds[m_strings[strNdx]] = strNdx;
+	}
+	catch (const Error& e)
+	{
+		clear();
+		throw Error(string("Failed to read '") + filename + "': " + e.what());
+	}
+}
+
+} // xe
@@ -0,0 +1,99 @@
+#ifndef _XERESULTDATABASE_HPP
+#define _XERESULTDATABASE_HPP
+/*-------------------------------------------------------------------------
+ * drawElements Quality Program Test Executor
+ * ------------------------------------------
+ *
+ * Copyright 2019 The Android Open Source Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ *//*!
+ * \file
+ * \brief Columnar test result database.
+ *
+ * Result database stores status, duration and numeric values of each test
+ * case of a batch result in a compact binary file, so that results of
+ * many runs can be queried and compared without parsing test logs again.
+ *
+ * Data is stored column by column. Strings (case path components, status
+ * details and value names) are stored once in a dictionary and referred
+ * to by index.
+ *//*--------------------------------------------------------------------*/
+
+#include "xeDefs.hpp"
+#include "xeTestCaseResult.hpp"
+
+#include <string>
+#include <vector>
+#include <map>
+
+namespace xe
+{
+
+class ResultDatabase
+{
+public:
+							ResultDatabase		(void);
+							~ResultDatabase		(void);
+
+	//! Add case. Numbers and sample list values anywhere in the result are stored as values, TestDuration as duration.
+	void					addCase				(const TestCaseResult& result);
+	void					clear				(void);
+
+	int						getNumCases			(void) const { return (int)m_caseNames.size(); }
+	std::string				getCasePath			(int caseNdx) const;
+	TestStatusCode			getStatusCode		(int caseNdx) const { return (TestStatusCode)m_statusCodes[caseNdx];	}
+	const std::string&		getStatusDetails	(int caseNdx) const { return m_strings[m_statusDetails[caseNdx]];		}
+	deInt64					getDuration			(int caseNdx) const { return m_durations[caseNdx];						} //!< Microseconds, -1 if not logged.
+
+	int						getNumValues		(int caseNdx) const;
+	const std::string&		getValueName		(int caseNdx, int valueNdx) const { return m_strings[m_valueNames[m_valueStarts[caseNdx]+valueNdx]];	}
+	double					getValue			(int caseNdx, int valueNdx) const { return m_values[m_valueStarts[caseNdx]+valueNdx];					}
+
+	//! Find case by path, returns -1 if not found.
+	int						findCase			(const std::string& casePath) const;
+
+	void					write				(const char* filename) const;
+	void					read				(const char* filename);
+
+private:
+							ResultDatabase		(const ResultDatabase&);
+	ResultDatabase&			operator=			(const ResultDatabase&);
+
+	deUint32				getStringId			(const std::string& str);
+	void					addValues			(const ri::List& items, deInt64& duration);
+	void					addValue			(const std::string& name, const ri::NumericValue& value);
+
+	// String dictionary
+	std::vector<std::string>				m_strings;
+	std::map<std::string, deUint32>			m_stringIds;
+
+	// Case columns
+	std::vector<deUint32>					m_caseGroups;		//!< Case path up to last '.'.
+	std::vector<deUint32>					m_caseNames;		//!< Case path after last '.'.
+	std::vector<deUint8>					m_statusCodes;
+	std::vector<deUint32>					m_statusDetails;
+	std::vector<deInt64>					m_durations;
+	std::vector<deUint32>					m_valueStarts;		//!< Index of first value of case.
+
+	// Value columns
+	std::vector<deUint32>					m_valueNames;
+	std::vector<double>						m_values;
+
+	mutable std::map<std::string, int>		m_caseNdxMap;		//!< Built on first findCase().
+};
+
+} // xe
+
+#endif // _XERESULTDATABASE_HPP
@@ -61,6 +61,11 @@ List::List (void)
 }
 
 List::~List (void)
+{
+	clear();
+}
+
+void List::clear (void)
 {
 	for (std::vector<Item*>::iterator i = m_items.begin(); i != m_items.end(); i++)
 		delete *i;
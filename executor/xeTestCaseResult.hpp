@@ -94,6 +94,7 @@ public:
 
 	template <typename T>
 	T*						allocItem		(void);
+	void					clear			(void);
 
 private:
 	std::vector<Item*>		m_items;
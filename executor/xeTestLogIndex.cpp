@@ -0,0 +1,661 @@
+/*-------------------------------------------------------------------------
+ * drawElements Quality Program Test Executor
+ * ------------------------------------------
+ *
+ * Copyright 2019 The Android Open Source Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ *//*!
+ * \file
+ * \brief Test log index and parallel test case result parsing.
+ *//*--------------------------------------------------------------------*/
+
+#include "xeTestLogIndex.hpp"
+#include "xeContainerFormatParser.hpp"
+#include "xeTestResultParser.hpp"
+#include "xeBatchResult.hpp"
+#include "deFile.h"
+#include "deMemory.h"
+#include "deParallelFor.hpp"
+#include "deSharedPtr.hpp"
+
+#include <fstream>
+
+#include <sys/types.h>
+#include <sys/stat.h>
+
+using std::string;
+using std::vector;
+
+namespace xe
+{
+
+namespace
+{
+
+enum
+{
+	SCAN_BLOCK_SIZE			= 1024*1024,
+
+	// Batch limits for parseIndexedTestLog(), parsed results of batch are kept in memory.
+	PARSE_BATCH_MAX_CASES	= 1024,
+	PARSE_BATCH_MAX_SIZE	= 64*1024*1024,
+	PARSE_CHUNKS_PER_THREAD	= 4,
+
+	// Begin lines longer than this are not validated but treated as index mismatch
+	MAX_BEGIN_LINE_LENGTH	= 64*1024
+};
+
+static const deUint32	INDEX_FILE_MAGIC	= 0x58444958;	//!< "XIDX"
+static const deUint32	INDEX_FILE_VERSION	= 2;
+static const char		BEGIN_CASE_LINE[]	= "#beginTestCaseResult ";
+
+class LogFile
+{
+public:
+	LogFile (const char* filename)
+		: m_file(deFile_create(filename, DE_FILEMODE_OPEN|DE_FILEMODE_READ))
+	{
+		if (!m_file)
+			throw Error(string("Failed to open '") + filename + "'");
+	}
+
+	~LogFile (void)
+	{
+		deFile_destroy(m_file);
+	}
+
+	deInt64 getSize (void) const
+	{
+		return deFile_getSize(m_file);
+	}
+
+	//! Read up to size bytes, returns number of bytes read
+	deInt64 read (void* dst, deInt64 size)
+	{
+		deInt64 numRead = 0;
+
+		if (deFile_read(m_file, dst, size, &numRead) == DE_FILERESULT_ERROR)
+			throw Error("Failed to read test log");
+
+		return numRead;
+	}
+
+	void read (deInt64 offset, void* dst, deInt64 size)
+	{
+		if (!deFile_seek(m_file, DE_FILEPOSITION_BEGIN, offset) || read(dst, size) != size)
+			throw Error("Failed to read test log");
+	}
+
+private:
+					LogFile		(const LogFile&);
+	LogFile&		operator=	(const LogFile&);
+
+	deFile*			m_file;
+};
+
+/*--------------------------------------------------------------------*//*!
+ * \brief Finds test case results from test log
+ *
+ * Splits log into lines as ContainerFormatParser does. Only lines
+ * starting with # are given to ContainerFormatParser; other lines are
+ * test case data and only their offsets are recorded.
+ *//*--------------------------------------------------------------------*/
+class TestLogScanner
+{
+public:
+							TestLogScanner		(TestLogIndex& dst);
+
+	void					scan				(const deUint8* bytes, int numBytes);
+
+private:
+	void					endLine				(deInt64 lineEnd);
+	void					handleContainerLine	(deInt64 lineEnd);
+
+	TestLogIndex&			m_dst;
+	ContainerFormatParser	m_containerParser;
+
+	deInt64					m_offset;
+	deInt64					m_lineStart;
+	bool					m_atLineStart;
+	bool					m_prevCR;
+	bool					m_isContainerLine;
+	string					m_containerLine;
+
+	bool					m_inSession;
+	bool					m_inCase;
+	bool					m_caseDataEnded;
+	TestLogIndexEntry		m_curCase;
+};
+
+TestLogScanner::TestLogScanner (TestLogIndex& dst)
+	: m_dst				(dst)
+	, m_offset			(0)
+	, m_lineStart		(0)
+	, m_atLineStart		(true)
+	, m_prevCR			(false)
+	, m_isContainerLine	(false)
+	, m_inSession		(false)
+	, m_inCase			(false)
+	, m_caseDataEnded	(false)
+{
+}
+
+void TestLogScanner::scan (const deUint8* bytes, int numBytes)
+{
+	for (int ndx = 0; ndx < numBytes; ndx++, m_offset++)
+	{
+		const deUint8 curChar = bytes[ndx];
+
+		if (m_prevCR)
+		{
+			m_prevCR = false;
+
+			if (curChar == '\n')
+			{
+				if (m_isContainerLine)
+					m_containerLine.push_back('\n');
+
+				endLine(m_offset+1);
+				continue;
+			}
+			else
+			{
+				// Lone \r ends line, ContainerFormatParser would need to see next char to know that
+				if (m_isContainerLine)
+					m_containerLine[m_containerLine.size()-1] = '\n';
+
+				endLine(m_offset);
+			}
+		}
+
+		if (m_atLineStart)
+		{
+			m_atLineStart		= false;
+			m_lineStart			= m_offset;
+			m_isContainerLine	= curChar == '#';
+		}
+
+		if (m_isContainerLine)
+			m_containerLine.push_back((char)curChar);
+
+		if (curChar == '\n')
+			endLine(m_offset+1);
+		else if (curChar == '\r')
+			m_prevCR = true;
+	}
+}
+
+void TestLogScanner::endLine (deInt64 lineEnd)
+{
+	if (m_isContainerLine)
+	{
+		handleContainerLine(lineEnd);
+		m_containerLine.clear();
+	}
+	else if (m_inCase && !m_caseDataEnded)
+		m_curCase.dataSize = lineEnd - m_curCase.dataOffset;
+
+	m_atLineStart = true;
+}
+
+void TestLogScanner::handleContainerLine (deInt64 lineEnd)
+{
+	m_containerParser.feed((const deUint8*)m_containerLine.c_str(), m_containerLine.size());
+
+	switch (m_containerParser.getElement())
+	{
+		case CONTAINERELEMENT_BEGIN_SESSION:
+			if (m_inSession)
+				throw Error("Unexpected #beginSession");
+			m_inSession = true;
+			break;
+
+		case CONTAINERELEMENT_END_SESSION:
+			if (!m_inSession)
+				throw Error("Unexpected #endSession");
+			m_inSession = false;
+			break;
+
+		case CONTAINERELEMENT_SESSION_INFO:
+			if (m_inSession)
+				throw Error("Unexpected #sessionInfo");
+			break;
+
+		case CONTAINERELEMENT_BEGIN_TEST_CASE_RESULT:
+			if (!m_inSession)
+				throw Error("Unexpected #beginTestCaseResult");
+
+			// \note Previous case, if not ended, is dropped as by TestLogParser.
+			m_curCase				= TestLogIndexEntry();
+			m_curCase.casePath		= m_containerParser.getTestCasePath();
+			m_curCase.beginOffset	= m_lineStart;
+			m_curCase.dataOffset	= lineEnd;
+			m_inCase				= true;
+			m_caseDataEnded			= false;
+			break;
+
+		case CONTAINERELEMENT_END_TEST_CASE_RESULT:
+		case CONTAINERELEMENT_TERMINATE_TEST_CASE_RESULT:
+			if (m_inCase)
+			{
+				if (m_containerParser.getElement() == CONTAINERELEMENT_TERMINATE_TEST_CASE_RESULT)
+				{
+					const char* reason = m_containerParser.getTerminateReason();
+
+					m_curCase.statusCode	= TESTSTATUSCODE_CRASH;
+					m_curCase.statusDetails	= reason;
+
+					try
+					{
+						m_curCase.statusCode = getTestStatusCode(reason);
+					}
+					catch (const ParseError&)
+					{
+						// Could not map status code.
+					}
+				}
+
+				m_dst.cases.push_back(m_curCase);
+				m_inCase = false;
+			}
+			break;
+
+		case CONTAINERELEMENT_TEST_LOG_DATA:
+			// Not a known container line
+			if (m_inCase && !m_caseDataEnded)
+				m_curCase.dataSize = lineEnd - m_curCase.dataOffset;
+			break;
+
+		default:
+			DE_ASSERT(false);
+	}
+
+	// \note Log data would continue after other container lines only in malformed logs, it is ignored.
+	if (m_inCase && m_containerParser.getElement() != CONTAINERELEMENT_TEST_LOG_DATA && m_containerParser.getElement() != CONTAINERELEMENT_BEGIN_TEST_CASE_RESULT)
+		m_caseDataEnded = true;
+
+	m_containerParser.advance();
+}
+
+// Index file I/O
+
+class IndexWriter
+{
+public:
+	void write (deUint32 value)
+	{
+		for (int ndx = 0; ndx < 4; ndx++)
+			m_data.push_back((deUint8)(value >> (8*ndx)));
+	}
+
+	void write (deInt64 value)
+	{
+		write((deUint32)((deUint64)value & 0xffffffffu));
+		write((deUint32)((deUint64)value >> 32));
+	}
+
+	void write (const string& str)
+	{
+		write((deUint32)str.size());
+		m_data.insert(m_data.end(), str.begin(), str.end());
+	}
+
+	const vector<deUint8>& getData (void) const { return m_data; }
+
+private:
+	vector<deUint8> m_data;
+};
+
+class IndexReader
+{
+public:
+	IndexReader (const vector<deUint8>& data)
+		: m_data	(data)
+		, m_pos		(0)
+	{
+	}
+
+	bool read (deUint32& dst)
+	{
+		if (m_data.size() - m_pos < 4)
+			return false;
+
+		dst = 0;
+		for (int ndx = 0; ndx < 4; ndx++)
+			dst |= (deUint32)m_data[m_pos+ndx] << (8*ndx);
+
+		m_pos += 4;
+		return true;
+	}
+
+	bool read (deInt64& dst)
+	{
+		deUint32 low	= 0;
+		deUint32 high	= 0;
+
+		if (!read(low) || !read(high))
+			return false;
+
+		dst = (deInt64)(((deUint64)high << 32) | low);
+		return true;
+	}
+
+	bool read (string& dst)
+	{
+		deUint32 size = 0;
+
+		if (!read(size) || m_data.size() - m_pos < size)
+			return false;
+
+		dst.assign((const char*)&m_data[0] + m_pos, size);
+		m_pos += size;
+		return true;
+	}
+
+	bool isAtEnd (void) const { return m_pos == m_data.size(); }
+
+private:
+	const vector<deUint8>&	m_data;
+	size_t					m_pos;
+};
+
+deInt64 getFileModificationTime (const char* filename)
+{
+	struct stat st;
+
+	if (stat(filename, &st) == 0)
+		return (deInt64)st.st_mtime;
+	else
+		return -1;
+}
+
+//! Check that entry begins with "#beginTestCaseResult <case path>" line and that data starts right after it.
+bool isCaseBeginLine (LogFile& file, const TestLogIndexEntry& entry, string& buf)
+{
+	const size_t	prefixLen	= DE_LENGTH_OF_ARRAY(BEGIN_CASE_LINE)-1;
+	const deInt64	lineLen		= entry.dataOffset - entry.beginOffset;
+	size_t			pos			= prefixLen;
+	char			quoteChar	= 0;
+
+	if (entry.beginOffset < 0 || lineLen <= (deInt64)(prefixLen + entry.casePath.size()) || lineLen > MAX_BEGIN_LINE_LENGTH)
+		return false;
+
+	buf.resize((size_t)lineLen);
+	file.read(entry.beginOffset, &buf[0], lineLen);
+
+	if (buf.compare(0, prefixLen, BEGIN_CASE_LINE) != 0)
+		return false;
+
+	// Path may be quoted, see ContainerFormatParser::parseContainerValue()
+	if (buf[pos] == '"' || buf[pos] == '\'')
+		quoteChar = buf[pos++];
+
+	if (buf.compare(pos, entry.casePath.size(), entry.casePath) != 0)
+		return false;
+
+	pos += entry.casePath.size();
+
+	if (pos >= buf.size() || (quoteChar ? buf[pos] != quoteChar : (buf[pos] != ' ' && buf[pos] != '\r' && buf[pos] != '\n')))
+		return false;
+
+	// Data must start right after end of the line
+	return buf.find_first_of("\r\n", pos) == buf.size() - 1 ||
+		   (buf.find_first_of("\r\n", pos) == buf.size() - 2 && buf.compare(buf.size() - 2, 2, "\r\n") == 0);
+}
+
+// Parallel parsing
+
+class ParseTestCaseResultsTask : public de::RangeTask
+{
+public:
+	ParseTestCaseResultsTask (const char* logFilename, const TestLogIndex& index, bool decodeImages, int firstCaseNdx, vector<de::SharedPtr<TestCaseResult> >& results)
+		: m_logFilename		(logFilename)
+		, m_index			(index)
+		, m_decodeImages	(decodeImages)
+		, m_firstCaseNdx	(firstCaseNdx)
+		, m_results			(results)
+	{
+	}
+
+	void run (int begin, int end)
+	{
+		LogFile				file	(m_logFilename);
+		TestResultParser	parser;
+
+		parser.setSkipImageData(!m_decodeImages);
+
+		for (int ndx = begin; ndx < end; ndx++)
+		{
+			const TestLogIndexEntry&	entry	= m_index.cases[m_firstCaseNdx+ndx];
+			TestCaseResultData			data	(entry.casePath.c_str());
+
+			data.setTestResult(entry.statusCode, entry.statusDetails.c_str());
+			data.setDataSize((int)entry.dataSize);
+
+			if (entry.dataSize > 0)
+				file.read(entry.dataOffset, data.getData(), entry.dataSize);
+
+			parseTestCaseResultFromData(&parser, m_results[ndx].get(), data);
+		}
+	}
+
+private:
+	const char* const						m_logFilename;
+	const TestLogIndex&						m_index;
+	const bool								m_decodeImages;
+	const int								m_firstCaseNdx;
+	vector<de::SharedPtr<TestCaseResult> >&	m_results;
+};
+
+} // anonymous
+
+void buildTestLogIndex (TestLogIndex& dst, const char* logFilename)
+{
+	LogFile			file	(logFilename);
+	TestLogScanner	scanner	(dst);
+	vector<deUint8>	buf		(SCAN_BLOCK_SIZE);
+
+	dst.logSize				= file.getSize();
+	dst.logModificationTime	= getFileModificationTime(logFilename);
+	dst.cases.clear();
+
+	for (;;)
+	{
+		const int numRead = (int)file.read(&buf[0], (deInt64)buf.size());
+
+		if (numRead <= 0)
+			break;
+
+		scanner.scan(&buf[0], numRead);
+	}
+}
+
+std::string getTestLogIndexFilename (const char* logFilename)
+{
+	return string(logFilename) + ".idx";
+}
+
+void writeTestLogIndex (const TestLogIndex& index, const char* indexFilename)
+{
+	IndexWriter writer;
+
+	writer.write(INDEX_FILE_MAGIC);
+	writer.write(INDEX_FILE_VERSION);
+	writer.write(index.logSize);
+	writer.write(index.logModificationTime);
+	writer.write((deUint32)index.cases.size());
+
+	for (vector<TestLogIndexEntry>::const_iterator entry = index.cases.begin(); entry != index.cases.end(); ++entry)
+	{
+		writer.write(entry->casePath);
+		writer.write(entry->beginOffset);
+		writer.write(entry->dataOffset);
+		writer.write(entry->dataSize);
+		writer.write((deUint32)entry->statusCode);
+		writer.write(entry->statusDetails);
+	}
+
+	{
+		std::ofstream out (indexFilename, std::ios_base::binary|std::ios_base::trunc);
+
+		out.write((const char*)&writer.getData()[0], (std::streamsize)writer.getData().size());
+		out.close();
+
+		if (!out.good())
+			throw Error(string("Failed to write '") + indexFilename + "'");
+	}
+}
+
+bool readTestLogIndex (TestLogIndex& dst, const char* indexFilename, const char* logFilename)
+{
+	vector<deUint8>	data;
+	TestLogIndex	index;
+
+	{
+		std::ifstream in (indexFilename, std::ios_base::binary);
+
+		if (!in.good())
+			return false;
+
+		in.seekg(0, std::ios_base::end);
+
+		const std::streamoff size = in.tellg();
+
+		if (size <= 0)
+			return false;
+
+		data.resize((size_t)size);
+		in.seekg(0, std::ios_base::beg);
+
+		if (!in.read((char*)&data[0], (std::streamsize)data.size()))
+			return false;
+	}
+
+	{
+		IndexReader	reader		(data);
+		deUint32	magic		= 0;
+		deUint32	version		= 0;
+		deUint32	numCases	= 0;
+
+		if (!reader.read(magic) || magic != INDEX_FILE_MAGIC	||
+			!reader.read(version) || version != INDEX_FILE_VERSION	||
+			!reader.read(index.logSize)								||
+			!reader.read(index.logModificationTime)					||
+			!reader.read(numCases))
+			return false;
+
+		for (deUint32 caseNdx = 0; caseNdx < numCases; caseNdx++)
+		{
+			TestLogIndexEntry	entry;
+			deUint32			statusCode	= 0;
+
+			if (!reader.read(entry.casePath)	||
+				!reader.read(entry.beginOffset)	||
+				!reader.read(entry.dataOffset)	||
+				!reader.read(entry.dataSize)	||
+				!reader.read(statusCode)		||
+				!reader.read(entry.statusDetails))
+				return false;
+
+			if (statusCode > TESTSTATUSCODE_LAST || entry.dataSize < 0 || entry.dataOffset < 0 || entry.dataOffset + entry.dataSize > index.logSize)
+				return false;
+
+			entry.statusCode = (TestStatusCode)statusCode;
+			index.cases.push_back(entry);
+		}
+
+		if (!reader.isAtEnd())
+			return false;
+	}
+
+	// Check that index still matches log. Size and modification time can match even if log was
+	// rewritten, so begin line of every case is checked as well; that costs one seek per case.
+	{
+		LogFile	file	(logFilename);
+		string	buf;
+
+		if (file.getSize() != index.logSize || index.logModificationTime < 0 || getFileModificationTime(logFilename) != index.logModificationTime)
+			return false;
+
+		for (vector<TestLogIndexEntry>::const_iterator entry = index.cases.begin(); entry != index.cases.end(); ++entry)
+		{
+			if (!isCaseBeginLine(file, *entry, buf))
+				return false;
+		}
+	}
+
+	dst.logSize				= index.logSize;
+	dst.logModificationTime	= index.logModificationTime;
+	dst.cases.swap(index.cases);
+
+	return true;
+}
+
+void loadTestLogIndex (TestLogIndex& dst, const char* logFilename, bool useIndexFile)
+{
+	const string indexFilename = getTestLogIndexFilename(logFilename);
+
+	if (!useIndexFile)
+	{
+		buildTestLogIndex(dst, logFilename);
+		return;
+	}
+
+	if (readTestLogIndex(dst, indexFilename.c_str(), logFilename))
+		return;
+
+	buildTestLogIndex(dst, logFilename);
+
+	try
+	{
+		writeTestLogIndex(dst, indexFilename.c_str());
+	}
+	catch (const Error&)
+	{
+		// Index is only a cache, log directory may not be writable.
+	}
+}
+
+void parseIndexedTestLog (const char* logFilename, const TestLogIndex& index, IndexedTestLogHandler& handler, bool decodeImages)
+{
+	const int numCases = (int)index.cases.size();
+
+	for (int batchStart = 0; batchStart < numCases;)
+	{
+		vector<de::SharedPtr<TestCaseResult> >	results;
+		deInt64									batchSize	= 0;
+
+		while (batchStart + (int)results.size() < numCases && (int)results.size() < PARSE_BATCH_MAX_CASES && (results.empty() || batchSize < PARSE_BATCH_MAX_SIZE))
+		{
+			batchSize += index.cases[batchStart + (int)results.size()].dataSize;
+			results.push_back(de::SharedPtr<TestCaseResult>(new TestCaseResult()));
+		}
+
+		{
+			// Each task invocation opens the log file, so give each thread a few chunks of cases
+			const int					grainSize	= de::max(1, (int)results.size() / (de::getParallelForNumThreads() * PARSE_CHUNKS_PER_THREAD));
+			ParseTestCaseResultsTask	task		(logFilename, index, decodeImages, batchStart, results);
+
+			de::parallelFor(0, (int)results.size(), grainSize, task);
+		}
+
+		for (vector<de::SharedPtr<TestCaseResult> >::const_iterator result = results.begin(); result != results.end(); ++result)
+			handler.testCaseResultComplete(**result);
+
+		batchStart += (int)results.size();
+	}
+}
+
+} // xe
@@ -0,0 +1,88 @@
+#ifndef _XETESTLOGINDEX_HPP
+#define _XETESTLOGINDEX_HPP
+/*-------------------------------------------------------------------------
+ * drawElements Quality Program Test Executor
+ * ------------------------------------------
+ *
+ * Copyright 2019 The Android Open Source Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ *//*!
+ * \file
+ * \brief Test log index and parallel test case result parsing.
+ *
+ * Index records location of each complete test case result in a test
+ * log file. It is built with a quick scan that only looks at container
+ * lines and can be cached into a sidecar file next to the log. Test case
+ * results can then be parsed independently of each other.
+ *//*--------------------------------------------------------------------*/
+
+#include "xeDefs.hpp"
+#include "xeTestCaseResult.hpp"
+
+#include <string>
+#include <vector>
+
+namespace xe
+{
+
+class TestLogIndexEntry
+{
+public:
+						TestLogIndexEntry	(void) : beginOffset(0), dataOffset(0), dataSize(0), statusCode(TESTSTATUSCODE_LAST) {}
+
+	std::string			casePath;
+	deInt64				beginOffset;		//!< Offset of #beginTestCaseResult line.
+	deInt64				dataOffset;			//!< Offset of test case log data.
+	deInt64				dataSize;			//!< Size of test case log data.
+	TestStatusCode		statusCode;			//!< TESTSTATUSCODE_LAST if case ended with #endTestCaseResult, otherwise termination status.
+	std::string			statusDetails;
+};
+
+class TestLogIndex
+{
+public:
+									TestLogIndex	(void) : logSize(0), logModificationTime(-1) {}
+
+	deInt64							logSize;
+	deInt64							logModificationTime;	//!< Seconds since epoch, -1 if not known.
+	std::vector<TestLogIndexEntry>	cases;			//!< Complete test case results in log order.
+};
+
+//! Scan test log file.
+void			buildTestLogIndex			(TestLogIndex& dst, const char* logFilename);
+
+std::string		getTestLogIndexFilename		(const char* logFilename);
+void			writeTestLogIndex			(const TestLogIndex& index, const char* indexFilename);
+//! Read index, returns false if index file is missing, invalid or does not match log file size, modification time and case begin lines.
+bool			readTestLogIndex			(TestLogIndex& dst, const char* indexFilename, const char* logFilename);
+
+//! Build index of log file. If useIndexFile is set, cached index is read from getTestLogIndexFilename(), or written there if not up to date.
+void			loadTestLogIndex			(TestLogIndex& dst, const char* logFilename, bool useIndexFile);
+
+class IndexedTestLogHandler
+{
+public:
+	virtual			~IndexedTestLogHandler	(void) {}
+
+	//! Called from parseIndexedTestLog() caller's thread, in log order.
+	virtual void	testCaseResultComplete	(const TestCaseResult& result) = DE_NULL;
+};
+
+//! Parse test case results listed in index in parallel. Final status of each case matches parseTestCaseResultFromData().
+void			parseIndexedTestLog			(const char* logFilename, const TestLogIndex& index, IndexedTestLogHandler& handler, bool decodeImages);
+
+} // xe
+
+#endif // _XETESTLOGINDEX_HPP
@@ -31,6 +31,39 @@ using std::map;
 namespace xe
 {
 
+static void setSessionInfoAttribute (SessionInfo& sessionInfo, const char* attribute, const char* value)
+{
+	if (deStringEqual(attribute, "releaseName"))
+		sessionInfo.releaseName = value;
+	else if (deStringEqual(attribute, "releaseId"))
+		sessionInfo.releaseId = value;
+	else if (deStringEqual(attribute, "targetName"))
+		sessionInfo.targetName = value;
+	else if (deStringEqual(attribute, "candyTargetName"))
+		sessionInfo.candyTargetName = value;
+	else if (deStringEqual(attribute, "configName"))
+		sessionInfo.configName = value;
+	else if (deStringEqual(attribute, "resultName"))
+		sessionInfo.resultName = value;
+	else if (deStringEqual(attribute, "timestamp"))
+		sessionInfo.timestamp = value;
+
+	// \todo [2012-06-09 pyry] What to do with unknown/duplicate attributes? Currently just ignored.
+}
+
+static TestStatusCode getTerminateStatusCode (const char* reason)
+{
+	try
+	{
+		return getTestStatusCode(reason);
+	}
+	catch (const xe::ParseError&)
+	{
+		// Could not map status code.
+		return TESTSTATUSCODE_CRASH;
+	}
+}
+
 TestLogParser::TestLogParser (TestLogHandler* handler)
 	: m_handler		(handler)
 	, m_inSession	(false)
@@ -86,25 +119,7 @@ void TestLogParser::parse (const deUint8* bytes, size_t numBytes)
 				if (m_inSession)
 					throw Error("Unexpected #sessionInfo");
 
-				const char*		attribute	= m_containerParser.getSessionInfoAttribute();
-				const char*		value		= m_containerParser.getSessionInfoValue();
-
-				if (deStringEqual(attribute, "releaseName"))
-					m_sessionInfo.releaseName = value;
-				else if (deStringEqual(attribute, "releaseId"))
-					m_sessionInfo.releaseId = value;
-				else if (deStringEqual(attribute, "targetName"))
-					m_sessionInfo.targetName = value;
-				else if (deStringEqual(attribute, "candyTargetName"))
-					m_sessionInfo.candyTargetName = value;
-				else if (deStringEqual(attribute, "configName"))
-					m_sessionInfo.configName = value;
-				else if (deStringEqual(attribute, "resultName"))
-					m_sessionInfo.resultName = value;
-				else if (deStringEqual(attribute, "timestamp"))
-					m_sessionInfo.timestamp = value;
-
-				// \todo [2012-06-09 pyry] What to do with unknown/duplicate attributes? Currently just ignored.
+				setSessionInfoAttribute(m_sessionInfo, m_containerParser.getSessionInfoAttribute(), m_containerParser.getSessionInfoValue());
 				break;
 			}
 
@@ -137,17 +152,8 @@ void TestLogParser::parse (const deUint8* bytes, size_t numBytes)
 			case CONTAINERELEMENT_TERMINATE_TEST_CASE_RESULT:
 				if (m_currentCaseData)
 				{
-					TestStatusCode	statusCode	= TESTSTATUSCODE_CRASH;
-					const char*		reason		= m_containerParser.getTerminateReason();
-					try
-					{
-						statusCode = getTestStatusCode(reason);
-					}
-					catch (const xe::ParseError&)
-					{
-						// Could not map status code.
-					}
-					m_currentCaseData->setTestResult(statusCode, reason);
+					const char* reason = m_containerParser.getTerminateReason();
+					m_currentCaseData->setTestResult(getTerminateStatusCode(reason), reason);
 					m_handler->testCaseResultComplete(m_currentCaseData);
 				}
 				m_currentCaseData.clear();
@@ -184,4 +190,190 @@ void TestLogParser::parse (const deUint8* bytes, size_t numBytes)
 	}
 }
 
+// TestLogStreamParser
+
+TestLogStreamParser::TestLogStreamParser (TestLogStreamHandler* handler, bool decodeImages)
+	: m_handler			(handler)
+	, m_inSession		(false)
+	, m_inCase			(false)
+	, m_caseHasData		(false)
+	, m_caseParseResult	(TestResultParser::PARSERESULT_NOT_CHANGED)
+{
+	m_resultParser.setItemHandler(handler);
+	m_resultParser.setSkipImageData(!decodeImages);
+}
+
+TestLogStreamParser::~TestLogStreamParser (void)
+{
+}
+
+void TestLogStreamParser::reset (void)
+{
+	m_containerParser.clear();
+	m_sessionInfo		= SessionInfo();
+	m_inSession			= false;
+	m_inCase			= false;
+	m_caseHasData		= false;
+	m_caseParseResult	= TestResultParser::PARSERESULT_NOT_CHANGED;
+	m_currentCase.resultItems.clear();
+}
+
+void TestLogStreamParser::completeTestCaseResult (TestStatusCode statusCode, const char* statusDetails)
+{
+	TestCaseResult& result = m_currentCase;
+
+	DE_ASSERT(m_inCase);
+	m_inCase = false;
+
+	// Status from <Result> or parse error overrides container status
+	if (result.statusCode == TESTSTATUSCODE_LAST)
+	{
+		result.statusCode		= statusCode;
+		result.statusDetails	= statusDetails;
+	}
+
+	if (m_caseHasData)
+	{
+		if (result.statusCode == TESTSTATUSCODE_LAST)
+		{
+			result.statusCode = TESTSTATUSCODE_INTERNAL_ERROR;
+
+			if (m_caseParseResult == TestResultParser::PARSERESULT_ERROR)
+				result.statusDetails = "Test case result parsing failed";
+			else if (m_caseParseResult != TestResultParser::PARSERESULT_COMPLETE)
+				result.statusDetails = "Incomplete test case result";
+			else
+				result.statusDetails = "Test case result is missing <Result> item";
+		}
+	}
+	else if (result.statusCode == TESTSTATUSCODE_LAST)
+	{
+		result.statusCode		= TESTSTATUSCODE_TERMINATED;
+		result.statusDetails	= "Empty test case result";
+	}
+
+	// Release partially parsed items
+	result.resultItems.clear();
+
+	if (result.casePath.empty())
+		throw Error("Empty test case path in result");
+
+	if (result.caseType == TESTCASETYPE_LAST)
+		throw Error("Invalid test case type in result");
+
+	m_handler->testCaseResultComplete(result);
+}
+
+void TestLogStreamParser::parse (const deUint8* bytes, size_t numBytes)
+{
+	m_containerParser.feed(bytes, numBytes);
+
+	for (;;)
+	{
+		ContainerElement element = m_containerParser.getElement();
+
+		if (element == CONTAINERELEMENT_INCOMPLETE)
+			break;
+
+		switch (element)
+		{
+			case CONTAINERELEMENT_BEGIN_SESSION:
+			{
+				if (m_inSession)
+					throw Error("Unexpected #beginSession");
+
+				m_handler->setSessionInfo(m_sessionInfo);
+				m_inSession = true;
+				break;
+			}
+
+			case CONTAINERELEMENT_END_SESSION:
+			{
+				if (!m_inSession)
+					throw Error("Unexpected #endSession");
+
+				m_inSession = false;
+				break;
+			}
+
+			case CONTAINERELEMENT_SESSION_INFO:
+			{
+				if (m_inSession)
+					throw Error("Unexpected #sessionInfo");
+
+				setSessionInfoAttribute(m_sessionInfo, m_containerParser.getSessionInfoAttribute(), m_containerParser.getSessionInfoValue());
+				break;
+			}
+
+			case CONTAINERELEMENT_BEGIN_TEST_CASE_RESULT:
+			{
+				if (!m_inSession)
+					throw Error("Unexpected #beginTestCaseResult");
+
+				const char* casePath = m_containerParser.getTestCasePath();
+
+				m_currentCase.resultItems.clear();
+				m_currentCase.casePath		= casePath;
+				m_currentCase.caseType		= TESTCASETYPE_SELF_VALIDATE;
+				m_currentCase.statusCode	= TESTSTATUSCODE_LAST;
+				m_currentCase.statusDetails.clear();
+
+				m_inCase			= true;
+				m_caseHasData		= false;
+				m_caseParseResult	= TestResultParser::PARSERESULT_NOT_CHANGED;
+
+				m_resultParser.init(&m_currentCase);
+				m_handler->startTestCaseResult(casePath);
+				break;
+			}
+
+			case CONTAINERELEMENT_END_TEST_CASE_RESULT:
+				if (m_inCase)
+					completeTestCaseResult(TESTSTATUSCODE_LAST, "");
+				break;
+
+			case CONTAINERELEMENT_TERMINATE_TEST_CASE_RESULT:
+				if (m_inCase)
+				{
+					const char* reason = m_containerParser.getTerminateReason();
+					completeTestCaseResult(getTerminateStatusCode(reason), reason);
+				}
+				break;
+
+			case CONTAINERELEMENT_END_OF_STRING:
+				if (m_inCase)
+					completeTestCaseResult(TESTSTATUSCODE_TERMINATED, "Unexpected end of string");
+				break;
+
+			case CONTAINERELEMENT_TEST_LOG_DATA:
+				if (m_inCase)
+				{
+					const int numDataBytes = m_containerParser.getDataSize();
+
+					m_caseHasData = true;
+
+					// \note Rest of the data is ignored after parse error, as with parseTestCaseResultFromData()
+					if (m_caseParseResult != TestResultParser::PARSERESULT_ERROR)
+					{
+						deUint8 buf[256];
+
+						for (int offset = 0; offset < numDataBytes && m_caseParseResult != TestResultParser::PARSERESULT_ERROR; offset += DE_LENGTH_OF_ARRAY(buf))
+						{
+							const int chunkSize = de::min(numDataBytes - offset, DE_LENGTH_OF_ARRAY(buf));
+
+							m_containerParser.getData(&buf[0], chunkSize, offset);
+							m_caseParseResult = m_resultParser.parse(&buf[0], chunkSize);
+						}
+					}
+				}
+				break;
+
+			default:
+				throw ContainerParseError("Unknown container element");
+		}
+
+		m_containerParser.advance();
+	}
+}
+
 } // xe
@@ -70,6 +70,57 @@ private:
 	bool					m_inSession;
 };
 
+//! Receives test case results from TestLogStreamParser one result item at a time.
+class TestLogStreamHandler : public TestResultItemHandler
+{
+public:
+	virtual void			setSessionInfo			(const SessionInfo& sessionInfo)		= DE_NULL;
+
+	virtual void			startTestCaseResult		(const char* casePath)					= DE_NULL;
+	//! Called with final status once case is complete. Result items have already been passed to resultItemParsed().
+	virtual void			testCaseResultComplete	(const TestCaseResult& result)			= DE_NULL;
+};
+
+/*--------------------------------------------------------------------*//*!
+ * \brief Streaming test log parser
+ *
+ * Unlike TestLogParser, which accumulates whole log data of a case before
+ * it can be parsed, log data is fed to TestResultParser as it arrives and
+ * each top-level result item is released once handler has seen it. Memory
+ * use is thus bounded by the largest single item instead of the largest
+ * case. Image data is not decoded unless requested.
+ *
+ * Final status of each case matches parseTestCaseResultFromData().
+ *//*--------------------------------------------------------------------*/
+class TestLogStreamParser
+{
+public:
+							TestLogStreamParser		(TestLogStreamHandler* handler, bool decodeImages = false);
+							~TestLogStreamParser	(void);
+
+	void					reset					(void);
+
+	void					parse					(const deUint8* bytes, size_t numBytes);
+
+private:
+							TestLogStreamParser		(const TestLogStreamParser& other);
+	TestLogStreamParser&	operator=				(const TestLogStreamParser& other);
+
+	void					completeTestCaseResult	(TestStatusCode statusCode, const char* statusDetails);
+
+	ContainerFormatParser	m_containerParser;
+	TestResultParser		m_resultParser;
+	TestLogStreamHandler*	m_handler;
+
+	SessionInfo				m_sessionInfo;
+	bool					m_inSession;
+
+	TestCaseResult			m_currentCase;
+	bool					m_inCase;
+	bool					m_caseHasData;
+	TestResultParser::ParseResult	m_caseParseResult;
+};
+
 } // xe
 
 #endif // _XETESTLOGPARSER_HPP
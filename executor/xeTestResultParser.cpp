@@ -292,6 +292,8 @@ TestResultParser::TestResultParser (void)
 	, m_logVersion			(TESTLOGVERSION_LAST)
 	, m_curItemList			(DE_NULL)
 	, m_base64DecodeOffset	(0)
+	, m_itemHandler			(DE_NULL)
+	, m_skipImageData		(false)
 {
 }
 
@@ -764,6 +766,12 @@ void TestResultParser::handleElementEnd (void)
 		}
 
 		popItem();
+
+		if (m_itemHandler && m_itemStack.empty())
+		{
+			m_itemHandler->resultItemParsed(*m_result, *curItem);
+			m_result->resultItems.clear();
+		}
 	}
 }
 
@@ -807,12 +815,17 @@ void TestResultParser::handleData (void)
 		{
 			ri::Image* image = static_cast<ri::Image*>(curItem);
 
+			if (m_skipImageData)
+				break;
+
 			// Base64 decode.
-			int numBytesIn = m_xmlParser.getDataSize();
+			m_xmlParser.getDataStr(m_dataBuf);
+
+			const int numBytesIn = (int)m_dataBuf.size();
 
 			for (int inNdx = 0; inNdx < numBytesIn; inNdx++)
 			{
-				deUint8		byte		= m_xmlParser.getDataByte(inNdx);
+				deUint8		byte		= (deUint8)m_dataBuf[inNdx];
 				deUint8		decodedBits	= 0;
 
 				if (de::inRange<deInt8>(byte, 'A', 'Z'))
@@ -50,6 +50,16 @@ public:
 	TestResultParseError (const std::string& message) : ParseError(message) {}
 };
 
+//! Receives result items from TestResultParser as soon as they have been parsed.
+class TestResultItemHandler
+{
+public:
+	virtual			~TestResultItemHandler	(void) {}
+
+	//! Called once top-level item and all of its children have been parsed. Item is released after the call.
+	virtual void	resultItemParsed		(const TestCaseResult& result, const ri::Item& item) = DE_NULL;
+};
+
 class TestResultParser
 {
 public:
@@ -69,6 +79,11 @@ public:
 	void					init						(TestCaseResult* dstResult);
 	ParseResult				parse						(const deUint8* bytes, int numBytes);
 
+	//! Hand top-level items over to handler instead of accumulating them into result. Kept over init().
+	void					setItemHandler				(TestResultItemHandler* handler)	{ m_itemHandler = handler;	}
+	//! Skip decoding of image data, images will have empty data. Kept over init().
+	void					setSkipImageData			(bool skip)							{ m_skipImageData = skip;	}
+
 private:
 							TestResultParser			(const TestResultParser& other);
 	TestResultParser&		operator=					(const TestResultParser& other);
@@ -109,6 +124,10 @@ private:
 	int						m_base64DecodeOffset;
 
 	std::string				m_curNumValue;
+	std::string				m_dataBuf;			//!< Data of current element for image decoding.
+
+	TestResultItemHandler*	m_itemHandler;
+	bool					m_skipImageData;
 };
 
 // Helpers exposed to other parsers.
@@ -24,6 +24,11 @@
 #include "xeXMLParser.hpp"
 #include "deInt32.h"
 
+#if (DE_CPU == DE_CPU_X86_64) || defined(__SSE2__)
+#	define XE_XML_PARSER_USE_SSE2
+#	include <emmintrin.h>
+#endif
+
 namespace xe
 {
 namespace xml
@@ -49,6 +54,40 @@ static inline bool isWhitespaceChar (int ch)
 	return ch == ' ' || ch == '\t' || ch == '\r' || ch == '\n';
 }
 
+//! Find first '<', '&' or 0 in data, returns size if none found
+static int findDataDelimiter (const deUint8* data, int size)
+{
+	int ndx = 0;
+
+#if defined(XE_XML_PARSER_USE_SSE2)
+	{
+		const __m128i	tagStart	= _mm_set1_epi8('<');
+		const __m128i	entityStart	= _mm_set1_epi8('&');
+		const __m128i	zero		= _mm_setzero_si128();
+
+		for (; ndx + 16 <= size; ndx += 16)
+		{
+			const __m128i	chars	= _mm_loadu_si128((const __m128i*)(data + ndx));
+			const __m128i	matches	= _mm_or_si128(_mm_or_si128(_mm_cmpeq_epi8(chars, tagStart), _mm_cmpeq_epi8(chars, entityStart)), _mm_cmpeq_epi8(chars, zero));
+			const int		mask	= _mm_movemask_epi8(matches);
+
+			if (mask != 0)
+				return ndx + deCtz32((deUint32)mask);
+		}
+	}
+#endif
+
+	for (; ndx < size; ndx++)
+	{
+		const deUint8 ch = data[ndx];
+
+		if (ch == '<' || ch == '&' || ch == 0)
+			break;
+	}
+
+	return ndx;
+}
+
 static int getNextBufferSize (int curSize, int minNewSize)
 {
 	return de::max(curSize*2, 1<<deLog2Ceil32(minNewSize));
@@ -105,6 +144,24 @@ int Tokenizer::getChar (int offset) const
 		return END_OF_BUFFER;
 }
 
+//! Find offset of first character at or after offset that ends data token, or number of buffered characters
+int Tokenizer::findDataEnd (int offset) const
+{
+	while (offset < m_buf.getNumElements())
+	{
+		const deUint8*	span		= DE_NULL;
+		const int		spanSize	= m_buf.peekBackSpan(offset, &span);
+		const int		dataSize	= findDataDelimiter(span, spanSize);
+
+		offset += dataSize;
+
+		if (dataSize < spanSize)
+			break;
+	}
+
+	return offset;
+}
+
 void Tokenizer::advance (void)
 {
 	if (m_curToken != TOKEN_INCOMPLETE)
@@ -142,6 +199,10 @@ void Tokenizer::advance (void)
 	{
 		if (m_state == STATE_DATA)
 		{
+			// Skip over data in contiguous blocks.
+			m_curTokenLen	= findDataEnd(m_curTokenLen);
+			curChar			= getChar(m_curTokenLen);
+
 			// Advance until we hit end of buffer or tag start and treat that as data token.
 			if (curChar == END_OF_STRING || curChar == (int)END_OF_BUFFER || curChar == '<' || curChar == '&')
 			{
@@ -104,6 +104,7 @@ private:
 	Tokenizer&			operator=			(const Tokenizer& other);
 
 	int					getChar				(int offset) const;
+	int					findDataEnd			(int offset) const;
 
 	void				error				(const std::string& what);
 
@@ -202,21 +203,22 @@ private:
 
 inline void Tokenizer::getTokenStr (std::string& dst) const
 {
-	DE_ASSERT(m_curToken != TOKEN_INCOMPLETE && m_curToken != TOKEN_END_OF_STRING);
-	dst.resize(m_curTokenLen);
-	for (int ndx = 0; ndx < m_curTokenLen; ndx++)
-		dst[ndx] = m_buf.peekBack(ndx);
+	dst.clear();
+	appendTokenStr(dst);
 }
 
 inline void Tokenizer::appendTokenStr (std::string& dst) const
 {
 	DE_ASSERT(m_curToken != TOKEN_INCOMPLETE && m_curToken != TOKEN_END_OF_STRING);
 
-	size_t oldLen = dst.size();
-	dst.resize(oldLen+m_curTokenLen);
+	for (int offset = 0; offset < m_curTokenLen;)
+	{
+		const deUint8*	span		= DE_NULL;
+		const int		spanSize	= de::min(m_buf.peekBackSpan(offset, &span), m_curTokenLen-offset);
 
-	for (int ndx = 0; ndx < m_curTokenLen; ndx++)
-		dst[oldLen+ndx] = m_buf.peekBack(ndx);
+		dst.append((const char*)span, (size_t)spanSize);
+		offset += spanSize;
+	}
 }
 
 inline int Parser::getDataSize (void) const
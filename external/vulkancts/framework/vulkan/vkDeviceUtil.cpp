@@ -28,8 +28,13 @@
 
 #include "tcuCommandLine.hpp"
 
+#include "deString.h"
+#include "deMemory.h"
+
 #include "qpInfo.h"
 
+#include <algorithm>
+
 namespace vk
 {
 
@@ -148,4 +153,167 @@ VkPhysicalDevice chooseDevice (const InstanceInterface& vkInstance, const VkInst
 	return devices[deviceId];
 }
 
+namespace
+{
+
+struct StructHeader
+{
+	VkStructureType			sType;
+	const StructHeader*		pNext;
+};
+
+#define PLAIN_STRUCT_SIZE(STRUCT, LAST_MEMBER) (DE_OFFSET_OF(STRUCT, LAST_MEMBER) + sizeof(VkBool32))
+
+// Returns the size of the data in a pNext structure that only contains VkBool32 members,
+// excluding any tail padding. Zero is returned for structures that are not known to be plain.
+size_t getPlainStructSize (VkStructureType sType)
+{
+	switch (sType)
+	{
+		case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FEATURES_2:						return PLAIN_STRUCT_SIZE(VkPhysicalDeviceFeatures2,						features.inheritedQueries);
+		case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PROTECTED_MEMORY_FEATURES:		return PLAIN_STRUCT_SIZE(VkPhysicalDeviceProtectedMemoryFeatures,			protectedMemory);
+		case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SAMPLER_YCBCR_CONVERSION_FEATURES:	return PLAIN_STRUCT_SIZE(VkPhysicalDeviceSamplerYcbcrConversionFeatures,	samplerYcbcrConversion);
+		case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_16BIT_STORAGE_FEATURES:			return PLAIN_STRUCT_SIZE(VkPhysicalDevice16BitStorageFeatures,				storageInputOutput16);
+		case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_8BIT_STORAGE_FEATURES_KHR:		return PLAIN_STRUCT_SIZE(VkPhysicalDevice8BitStorageFeaturesKHR,			storagePushConstant8);
+		case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_VARIABLE_POINTERS_FEATURES:		return PLAIN_STRUCT_SIZE(VkPhysicalDeviceVariablePointersFeatures,			variablePointers);
+		case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MULTIVIEW_FEATURES:				return PLAIN_STRUCT_SIZE(VkPhysicalDeviceMultiviewFeatures,				multiviewTessellationShader);
+		case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADER_DRAW_PARAMETERS_FEATURES:	return PLAIN_STRUCT_SIZE(VkPhysicalDeviceShaderDrawParametersFeatures,		shaderDrawParameters);
+		case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DESCRIPTOR_INDEXING_FEATURES_EXT:	return PLAIN_STRUCT_SIZE(VkPhysicalDeviceDescriptorIndexingFeaturesEXT,	runtimeDescriptorArray);
+		case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SCALAR_BLOCK_LAYOUT_FEATURES_EXT:	return PLAIN_STRUCT_SIZE(VkPhysicalDeviceScalarBlockLayoutFeaturesEXT,		scalarBlockLayout);
+		case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FLOAT16_INT8_FEATURES_KHR:		return PLAIN_STRUCT_SIZE(VkPhysicalDeviceFloat16Int8FeaturesKHR,			shaderInt8);
+		case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_VULKAN_MEMORY_MODEL_FEATURES_KHR:	return PLAIN_STRUCT_SIZE(VkPhysicalDeviceVulkanMemoryModelFeaturesKHR,		vulkanMemoryModelAvailabilityVisibilityChains);
+		case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADER_ATOMIC_INT64_FEATURES_KHR:	return PLAIN_STRUCT_SIZE(VkPhysicalDeviceShaderAtomicInt64FeaturesKHR,		shaderSharedInt64Atomics);
+		case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_HOST_QUERY_RESET_FEATURES_EXT:	return PLAIN_STRUCT_SIZE(VkPhysicalDeviceHostQueryResetFeaturesEXT,			hostQueryReset);
+		default:
+			return 0;
+	}
+}
+
+#undef PLAIN_STRUCT_SIZE
+
+void appendBytes (vector<deUint8>& dst, const void* src, size_t size)
+{
+	const deUint8* const	srcBytes	= (const deUint8*)src;
+
+	dst.insert(dst.end(), srcBytes, srcBytes + size);
+}
+
+template<typename T>
+void appendValue (vector<deUint8>& dst, const T& value)
+{
+	appendBytes(dst, &value, sizeof(T));
+}
+
+bool compareStructType (const StructHeader* a, const StructHeader* b)
+{
+	return a->sType < b->sType;
+}
+
+bool appendStructChain (vector<deUint8>& dst, const void* pNext)
+{
+	vector<const StructHeader*>	structs;
+
+	for (const StructHeader* cur = (const StructHeader*)pNext; cur; cur = cur->pNext)
+		structs.push_back(cur);
+
+	// Chain order does not affect device creation
+	std::sort(structs.begin(), structs.end(), compareStructType);
+
+	appendValue(dst, (deUint32)structs.size());
+
+	for (vector<const StructHeader*>::const_iterator structIter = structs.begin(); structIter != structs.end(); ++structIter)
+	{
+		const StructHeader* const	header	= *structIter;
+
+		appendValue(dst, header->sType);
+
+		if (header->sType == VK_STRUCTURE_TYPE_DEVICE_GROUP_DEVICE_CREATE_INFO)
+		{
+			const VkDeviceGroupDeviceCreateInfo* const	groupInfo	= (const VkDeviceGroupDeviceCreateInfo*)header;
+
+			appendValue(dst, groupInfo->physicalDeviceCount);
+
+			for (deUint32 deviceNdx = 0; deviceNdx < groupInfo->physicalDeviceCount; ++deviceNdx)
+				appendValue(dst, groupInfo->pPhysicalDevices[deviceNdx]);
+		}
+		else
+		{
+			const size_t	dataSize	= getPlainStructSize(header->sType);
+
+			if (dataSize == 0)
+				return false;
+
+			appendBytes(dst, (const deUint8*)header + sizeof(StructHeader), dataSize - sizeof(StructHeader));
+		}
+	}
+
+	return true;
+}
+
+void appendSortedStrings (vector<deUint8>& dst, deUint32 count, const char* const* strings)
+{
+	vector<string>	sorted	(strings, strings + count);
+
+	std::sort(sorted.begin(), sorted.end());
+
+	appendValue(dst, count);
+
+	for (vector<string>::const_iterator strIter = sorted.begin(); strIter != sorted.end(); ++strIter)
+		appendBytes(dst, strIter->c_str(), strIter->size() + 1);
+}
+
+bool compareQueueFamily (const VkDeviceQueueCreateInfo* a, const VkDeviceQueueCreateInfo* b)
+{
+	return a->queueFamilyIndex < b->queueFamilyIndex;
+}
+
+} // anonymous
+
+DeviceCreateInfoKey::DeviceCreateInfoKey (const VkDeviceCreateInfo& createInfo)
+	: m_isValid	(true)
+	, m_hash	(0)
+{
+	vector<const VkDeviceQueueCreateInfo*>	queueInfos;
+
+	for (deUint32 queueInfoNdx = 0; queueInfoNdx < createInfo.queueCreateInfoCount; ++queueInfoNdx)
+		queueInfos.push_back(&createInfo.pQueueCreateInfos[queueInfoNdx]);
+
+	// Each queue family can only appear once, so ordering by family gives a canonical order
+	std::sort(queueInfos.begin(), queueInfos.end(), compareQueueFamily);
+
+	appendValue(m_data, createInfo.flags);
+	appendValue(m_data, (deUint32)queueInfos.size());
+
+	for (vector<const VkDeviceQueueCreateInfo*>::const_iterator queueIter = queueInfos.begin(); queueIter != queueInfos.end(); ++queueIter)
+	{
+		const VkDeviceQueueCreateInfo&	queueInfo	= **queueIter;
+
+		appendValue(m_data, queueInfo.flags);
+		appendValue(m_data, queueInfo.queueFamilyIndex);
+		appendValue(m_data, queueInfo.queueCount);
+		appendBytes(m_data, queueInfo.pQueuePriorities, queueInfo.queueCount * sizeof(float));
+
+		m_isValid = m_isValid && appendStructChain(m_data, queueInfo.pNext);
+	}
+
+	appendSortedStrings(m_data, createInfo.enabledLayerCount, createInfo.ppEnabledLayerNames);
+	appendSortedStrings(m_data, createInfo.enabledExtensionCount, createInfo.ppEnabledExtensionNames);
+
+	appendValue(m_data, (deUint8)(createInfo.pEnabledFeatures ? 1u : 0u));
+
+	if (createInfo.pEnabledFeatures)
+		appendValue(m_data, *createInfo.pEnabledFeatures);
+
+	m_isValid	= m_isValid && appendStructChain(m_data, createInfo.pNext);
+	m_hash		= deMemoryHash(&m_data[0], m_data.size());
+}
+
+bool DeviceCreateInfoKey::operator== (const DeviceCreateInfoKey& other) const
+{
+	return m_isValid && other.m_isValid
+		&& m_hash == other.m_hash
+		&& m_data.size() == other.m_data.size()
+		&& deMemCmp(&m_data[0], &other.m_data[0], m_data.size()) == 0;
+}
+
 } // vk
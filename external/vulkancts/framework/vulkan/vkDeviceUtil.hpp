@@ -62,6 +62,29 @@ VkPhysicalDevice	chooseDevice			(const InstanceInterface&			vkInstance,
 											 const VkInstance					instance,
 											 const tcu::CommandLine&			cmdLine);
 
+//! Canonical description of a VkDeviceCreateInfo for identifying equivalent devices.
+//!
+//! Queue create infos are ordered by queue family and layer and extension names are
+//! sorted, so create infos that only differ in ordering produce equal keys. Only feature
+//! structures and VkDeviceGroupDeviceCreateInfo are understood in pNext chains; any other
+//! structure makes the key invalid, and an invalid key never compares equal.
+class DeviceCreateInfoKey
+{
+public:
+	explicit				DeviceCreateInfoKey	(const VkDeviceCreateInfo& createInfo);
+
+	bool					isValid				(void) const { return m_isValid;	}
+	deUint32				getHash				(void) const { return m_hash;		}
+
+	bool					operator==			(const DeviceCreateInfoKey& other) const;
+	bool					operator!=			(const DeviceCreateInfoKey& other) const { return !(*this == other); }
+
+private:
+	bool					m_isValid;
+	std::vector<deUint8>	m_data;
+	deUint32				m_hash;
+};
+
 } // vk
 
 #endif // _VKDEVICEUTIL_HPP
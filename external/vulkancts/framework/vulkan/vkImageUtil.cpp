@@ -2908,7 +2908,9 @@ void copyImageToBuffer (const DeviceInterface&	vk,
 						tcu::IVec2				size,
 						VkAccessFlags			srcAccessMask,
 						VkImageLayout			oldLayout,
-						deUint32				numLayers)
+						deUint32				numLayers,
+						VkImageAspectFlags		aspect,
+						VkDeviceSize			bufferOffset)
 {
 	const VkImageMemoryBarrier	imageBarrier	=
 	{
@@ -2921,7 +2923,7 @@ void copyImageToBuffer (const DeviceInterface&	vk,
 		VK_QUEUE_FAMILY_IGNORED,													// deUint32					srcQueueFamilyIndex;
 		VK_QUEUE_FAMILY_IGNORED,													// deUint32					destQueueFamilyIndex;
 		image,																		// VkImage					image;
-		makeImageSubresourceRange(VK_IMAGE_ASPECT_COLOR_BIT, 0u, 1u, 0, numLayers)	// VkImageSubresourceRange	subresourceRange;
+		makeImageSubresourceRange(aspect, 0u, 1u, 0, numLayers)						// VkImageSubresourceRange	subresourceRange;
 	};
 
 	vk.cmdPipelineBarrier(cmdBuffer, VK_PIPELINE_STAGE_ALL_COMMANDS_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT, 0u,
@@ -2929,7 +2931,7 @@ void copyImageToBuffer (const DeviceInterface&	vk,
 
 	const VkImageSubresourceLayers	subresource	=
 	{
-		VK_IMAGE_ASPECT_COLOR_BIT,					// VkImageAspectFlags	aspectMask;
+		aspect,										// VkImageAspectFlags	aspectMask;
 		0u,											// deUint32				mipLevel;
 		0u,											// deUint32				baseArrayLayer;
 		numLayers									// deUint32				layerCount;
@@ -2937,7 +2939,7 @@ void copyImageToBuffer (const DeviceInterface&	vk,
 
 	const VkBufferImageCopy			region		=
 	{
-		0ull,										// VkDeviceSize					bufferOffset;
+		bufferOffset,								// VkDeviceSize					bufferOffset;
 		0u,											// deUint32						bufferRowLength;
 		0u,											// deUint32						bufferImageHeight;
 		subresource,								// VkImageSubresourceLayers		imageSubresource;
@@ -2956,7 +2958,7 @@ void copyImageToBuffer (const DeviceInterface&	vk,
 		VK_QUEUE_FAMILY_IGNORED,					// deUint32			srcQueueFamilyIndex;
 		VK_QUEUE_FAMILY_IGNORED,					// deUint32			dstQueueFamilyIndex;
 		buffer,										// VkBuffer			buffer;
-		0ull,										// VkDeviceSize		offset;
+		bufferOffset,								// VkDeviceSize		offset;
 		VK_WHOLE_SIZE								// VkDeviceSize		size;
 	};
 
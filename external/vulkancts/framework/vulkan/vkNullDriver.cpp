@@ -27,6 +27,10 @@
 #include "vkQueryUtil.hpp"
 #include "tcuFunctionLibrary.hpp"
 #include "deMemory.h"
+#include "deString.h"
+#include "deInt32.h"
+#include "deMutex.hpp"
+#include "deUniquePtr.hpp"
 
 #if (DE_OS == DE_OS_ANDROID) && defined(__ANDROID_API_O__) && (DE_ANDROID_API >= __ANDROID_API_O__ /* __ANDROID_API_O__ */)
 #	define USE_ANDROID_O_HARDWARE_BUFFER
@@ -35,8 +39,16 @@
 #	include <android/hardware_buffer.h>
 #endif
 
+#if defined(DEQP_VK_NULL_DRIVER_PROFILE)
+#	include "deAtomic.h"
+#	include "deClock.h"
+#	include "tcuDefs.hpp"
+#endif
+
 #include <stdexcept>
 #include <algorithm>
+#include <set>
+#include <map>
 
 namespace vk
 {
@@ -48,10 +60,9 @@ using std::vector;
 
 // Memory management
 
-template<typename T>
-void* allocateSystemMem (const VkAllocationCallbacks* pAllocator, VkSystemAllocationScope scope)
+void* allocateSystemMem (const VkAllocationCallbacks* pAllocator, size_t size, VkSystemAllocationScope scope)
 {
-	void* ptr = pAllocator->pfnAllocation(pAllocator->pUserData, sizeof(T), sizeof(void*), scope);
+	void* ptr = pAllocator->pfnAllocation(pAllocator->pUserData, size, sizeof(void*), scope);
 	if (!ptr)
 		throw std::bad_alloc();
 	return ptr;
@@ -62,27 +73,234 @@ void freeSystemMem (const VkAllocationCallbacks* pAllocator, void* mem)
 	pAllocator->pfnFree(pAllocator->pUserData, mem);
 }
 
-template<typename Object, typename Handle, typename Parent, typename CreateInfo>
-Handle allocateHandle (Parent parent, const CreateInfo* pCreateInfo, const VkAllocationCallbacks* pAllocator)
+//! Fixed size block allocator. Blocks are carved out of larger chunks and recycled through a free list.
+class SlabAllocator
 {
-	Object* obj = DE_NULL;
+public:
+						SlabAllocator	(void);
+						~SlabAllocator	(void);
 
-	if (pAllocator)
+	void				init			(size_t blockSize);
+
+	void*				allocate		(void);
+	void				free			(void* block);
+
+private:
+	enum
 	{
-		void* mem = allocateSystemMem<Object>(pAllocator, VK_SYSTEM_ALLOCATION_SCOPE_OBJECT);
+		BLOCKS_PER_CHUNK	= 128
+	};
+
+	size_t				m_blockSize;
+	de::Mutex			m_lock;
+	vector<deUint8*>	m_chunks;
+	void*				m_freeList;
+};
+
+SlabAllocator::SlabAllocator (void)
+	: m_blockSize	(0)
+	, m_freeList	(DE_NULL)
+{
+}
+
+SlabAllocator::~SlabAllocator (void)
+{
+	for (size_t ndx = 0; ndx < m_chunks.size(); ++ndx)
+		delete[] m_chunks[ndx];
+}
+
+void SlabAllocator::init (size_t blockSize)
+{
+	DE_ASSERT(m_chunks.empty() && blockSize >= sizeof(void*));
+	m_blockSize = blockSize;
+}
+
+void* SlabAllocator::allocate (void)
+{
+	const de::ScopedLock	lock	(m_lock);
+
+	if (!m_freeList)
+	{
+		deUint8* const	chunk	= new deUint8[m_blockSize * BLOCKS_PER_CHUNK];
+
 		try
 		{
-			obj = new (mem) Object(parent, pCreateInfo);
-			DE_ASSERT(obj == mem);
+			m_chunks.push_back(chunk);
 		}
 		catch (...)
 		{
-			pAllocator->pfnFree(pAllocator->pUserData, mem);
+			delete[] chunk;
 			throw;
 		}
+
+		for (size_t blockNdx = BLOCKS_PER_CHUNK; blockNdx > 0; --blockNdx)
+		{
+			void* const block = chunk + (blockNdx - 1) * m_blockSize;
+
+			*reinterpret_cast<void**>(block)	= m_freeList;
+			m_freeList							= block;
+		}
+	}
+
+	{
+		void* const block = m_freeList;
+
+		m_freeList = *reinterpret_cast<void**>(block);
+
+		return block;
+	}
+}
+
+void SlabAllocator::free (void* block)
+{
+	const de::ScopedLock	lock	(m_lock);
+
+	*reinterpret_cast<void**>(block)	= m_freeList;
+	m_freeList							= block;
+}
+
+/*--------------------------------------------------------------------*//*!
+ * \brief Storage for objects created without allocation callbacks
+ *
+ * Objects are allocated from size class slabs. Each block starts with a
+ * header pointing to the owning slab, so that objects can be freed through
+ * a base class pointer. Objects larger than the largest size class are
+ * allocated from the heap.
+ *
+ * The heap is shared by all null driver libraries. It is created by the
+ * first acquire() and destroyed, together with its slabs, by the last
+ * release(). Each library holds a reference for its lifetime, so objects
+ * must be destroyed before the library that created them.
+ *//*--------------------------------------------------------------------*/
+class ObjectHeap
+{
+public:
+	static void			acquire			(void);
+	static void			release			(void);
+	static ObjectHeap&	getInstance		(void);
+
+	void*				allocate		(size_t size);
+	void				free			(void* ptr);
+
+private:
+						ObjectHeap		(void);
+
+	static de::Mutex	s_lock;
+	static ObjectHeap*	s_instance;
+	static int			s_refCount;
+
+	enum
+	{
+		SIZE_GRANULARITY	= 16,
+		NUM_SIZE_CLASSES	= 32
+	};
+
+	struct BlockHeader
+	{
+		SlabAllocator*	slab;
+		deUint64		padding;	//!< Keeps objects 16-byte aligned
+	};
+
+	SlabAllocator		m_slabs[NUM_SIZE_CLASSES];
+};
+
+ObjectHeap::ObjectHeap (void)
+{
+	for (size_t classNdx = 0; classNdx < NUM_SIZE_CLASSES; ++classNdx)
+		m_slabs[classNdx].init((classNdx + 1) * SIZE_GRANULARITY);
+}
+
+de::Mutex	ObjectHeap::s_lock;
+ObjectHeap*	ObjectHeap::s_instance	= DE_NULL;
+int			ObjectHeap::s_refCount	= 0;
+
+void ObjectHeap::acquire (void)
+{
+	const de::ScopedLock	lock	(s_lock);
+
+	if (s_refCount == 0)
+	{
+		DE_ASSERT(!s_instance);
+		s_instance = new ObjectHeap();
+	}
+
+	s_refCount += 1;
+}
+
+void ObjectHeap::release (void)
+{
+	const de::ScopedLock	lock	(s_lock);
+
+	DE_ASSERT(s_refCount > 0);
+
+	if (--s_refCount == 0)
+	{
+		delete s_instance;
+		s_instance = DE_NULL;
 	}
+}
+
+ObjectHeap& ObjectHeap::getInstance (void)
+{
+	DE_ASSERT(s_instance);
+	return *s_instance;
+}
+
+void* ObjectHeap::allocate (size_t size)
+{
+	const size_t	blockSize	= deAlignSize(size + sizeof(BlockHeader), SIZE_GRANULARITY);
+	const size_t	classNdx	= blockSize / SIZE_GRANULARITY - 1;
+	SlabAllocator*	slab		= classNdx < NUM_SIZE_CLASSES ? &m_slabs[classNdx] : DE_NULL;
+	BlockHeader*	header		= reinterpret_cast<BlockHeader*>(slab ? slab->allocate() : new deUint8[blockSize]);
+
+	header->slab = slab;
+
+	return header + 1;
+}
+
+void ObjectHeap::free (void* ptr)
+{
+	BlockHeader* const	header	= reinterpret_cast<BlockHeader*>(ptr) - 1;
+
+	if (header->slab)
+		header->slab->free(header);
+	else
+		delete[] reinterpret_cast<deUint8*>(header);
+}
+
+template<typename Object>
+void* allocateObjectMem (const VkAllocationCallbacks* pAllocator)
+{
+	if (pAllocator)
+		return allocateSystemMem(pAllocator, sizeof(Object), VK_SYSTEM_ALLOCATION_SCOPE_OBJECT);
 	else
-		obj = new Object(parent, pCreateInfo);
+		return ObjectHeap::getInstance().allocate(sizeof(Object));
+}
+
+void freeObjectMem (const VkAllocationCallbacks* pAllocator, void* mem)
+{
+	if (pAllocator)
+		freeSystemMem(pAllocator, mem);
+	else
+		ObjectHeap::getInstance().free(mem);
+}
+
+template<typename Object, typename Handle, typename Parent, typename CreateInfo>
+Handle allocateHandle (Parent parent, const CreateInfo* pCreateInfo, const VkAllocationCallbacks* pAllocator)
+{
+	void* const	mem	= allocateObjectMem<Object>(pAllocator);
+	Object*		obj	= DE_NULL;
+
+	try
+	{
+		obj = new (mem) Object(parent, pCreateInfo);
+		DE_ASSERT(obj == mem);
+	}
+	catch (...)
+	{
+		freeObjectMem(pAllocator, mem);
+		throw;
+	}
 
 	return reinterpret_cast<Handle>(obj);
 }
@@ -90,24 +308,19 @@ Handle allocateHandle (Parent parent, const CreateInfo* pCreateInfo, const VkAll
 template<typename Object, typename Handle, typename CreateInfo>
 Handle allocateHandle (const CreateInfo* pCreateInfo, const VkAllocationCallbacks* pAllocator)
 {
-	Object* obj = DE_NULL;
+	void* const	mem	= allocateObjectMem<Object>(pAllocator);
+	Object*		obj	= DE_NULL;
 
-	if (pAllocator)
+	try
 	{
-		void* mem = allocateSystemMem<Object>(pAllocator, VK_SYSTEM_ALLOCATION_SCOPE_OBJECT);
-		try
-		{
-			obj = new (mem) Object(pCreateInfo);
-			DE_ASSERT(obj == mem);
-		}
-		catch (...)
-		{
-			pAllocator->pfnFree(pAllocator->pUserData, mem);
-			throw;
-		}
+		obj = new (mem) Object(pCreateInfo);
+		DE_ASSERT(obj == mem);
+	}
+	catch (...)
+	{
+		freeObjectMem(pAllocator, mem);
+		throw;
 	}
-	else
-		obj = new Object(pCreateInfo);
 
 	return reinterpret_cast<Handle>(obj);
 }
@@ -117,13 +330,8 @@ void freeHandle (Handle handle, const VkAllocationCallbacks* pAllocator)
 {
 	Object* obj = reinterpret_cast<Object*>(handle);
 
-	if (pAllocator)
-	{
-		obj->~Object();
-		freeSystemMem(pAllocator, reinterpret_cast<void*>(obj));
-	}
-	else
-		delete obj;
+	obj->~Object();
+	freeObjectMem(pAllocator, reinterpret_cast<void*>(obj));
 }
 
 template<typename Object, typename BaseObject, typename Handle, typename Parent, typename CreateInfo>
@@ -162,6 +370,129 @@ void freeNonDispHandle (Handle handle, const VkAllocationCallbacks* pAllocator)
 // \todo [2015-07-14 pyry] Check FUNC type by checkedCastToPtr<T>() or similar
 #define VK_NULL_FUNC_ENTRY(NAME, FUNC)	{ #NAME, (deFunctionPtr)FUNC }  // NOLINT(FUNC)
 
+// Entry point profiling
+
+#if defined(DEQP_VK_NULL_DRIVER_PROFILE)
+
+#if (DE_PTR_SIZE != 8)
+#	error "Null driver profiling requires 64-bit atomics"
+#endif
+
+struct EntryPointStats
+{
+	const char*			name;
+	volatile deUint64	numCalls;
+	volatile deUint64	totalTimeUs;
+	EntryPointStats*	next;
+
+						EntryPointStats		(const char* name_);
+};
+
+de::Mutex& getEntryPointStatsLock (void)
+{
+	static de::Mutex	s_lock;
+	return s_lock;
+}
+
+EntryPointStats*& getEntryPointStatsHead (void)
+{
+	static EntryPointStats*	s_head	= DE_NULL;
+	return s_head;
+}
+
+EntryPointStats::EntryPointStats (const char* name_)
+	: name			(name_)
+	, numCalls		(0)
+	, totalTimeUs	(0)
+	, next			(DE_NULL)
+{
+	const de::ScopedLock	lock	(getEntryPointStatsLock());
+
+	next						= getEntryPointStatsHead();
+	getEntryPointStatsHead()	= this;
+}
+
+class EntryPointTimer
+{
+public:
+	EntryPointTimer (EntryPointStats& stats)
+		: m_stats		(stats)
+		, m_startTime	(deGetMicroseconds())
+	{
+		deAtomicIncrementUint64(&m_stats.numCalls);
+	}
+
+	~EntryPointTimer (void)
+	{
+		const deUint64	duration	= deGetMicroseconds() - m_startTime;
+		deUint64		oldTime		= m_stats.totalTimeUs;
+
+		for (;;)
+		{
+			const deUint64 prevTime = deAtomicCompareExchangeUint64(&m_stats.totalTimeUs, oldTime, oldTime + duration);
+
+			if (prevTime == oldTime)
+				break;
+
+			oldTime = prevTime;
+		}
+	}
+
+private:
+	EntryPointStats&	m_stats;
+	const deUint64		m_startTime;
+};
+
+bool compareTotalTime (const EntryPointStats* a, const EntryPointStats* b)
+{
+	return a->totalTimeUs > b->totalTimeUs;
+}
+
+//! Print statistics of all called entry points, most expensive first, and reset them
+void dumpEntryPointStats (void)
+{
+	const de::ScopedLock		lock	(getEntryPointStatsLock());
+	vector<EntryPointStats*>	stats;
+
+	for (EntryPointStats* cur = getEntryPointStatsHead(); cur; cur = cur->next)
+	{
+		if (cur->numCalls > 0)
+			stats.push_back(cur);
+	}
+
+	if (stats.empty())
+		return;
+
+	std::sort(stats.begin(), stats.end(), compareTotalTime);
+
+	tcu::print("Vulkan null driver entry point statistics:\n");
+	tcu::print("  %-48s %12s %14s %10s\n", "Entry point", "Calls", "Total (us)", "Avg (us)");
+
+	for (vector<EntryPointStats*>::const_iterator iter = stats.begin(); iter != stats.end(); ++iter)
+	{
+		const EntryPointStats&	cur	= **iter;
+
+		tcu::print("  %-48s %12llu %14llu %10.2f\n",
+				   cur.name,
+				   (unsigned long long)cur.numCalls,
+				   (unsigned long long)cur.totalTimeUs,
+				   double(cur.totalTimeUs) / double(cur.numCalls));
+
+		(*iter)->numCalls		= 0;
+		(*iter)->totalTimeUs	= 0;
+	}
+}
+
+#	define VK_NULL_PROFILE_ENTRY_POINT(NAME)								\
+		static EntryPointStats	s_entryPointStats	(#NAME);			\
+		const EntryPointTimer	entryPointTimer		(s_entryPointStats)
+
+#else
+
+#	define VK_NULL_PROFILE_ENTRY_POINT(NAME) do {} while (deGetFalse())
+
+#endif // DEQP_VK_NULL_DRIVER_PROFILE
+
 #define VK_NULL_DEFINE_DEVICE_OBJ(NAME)				\
 struct NAME											\
 {													\
@@ -174,8 +505,6 @@ VK_NULL_DEFINE_DEVICE_OBJ(Event);
 VK_NULL_DEFINE_DEVICE_OBJ(QueryPool);
 VK_NULL_DEFINE_DEVICE_OBJ(BufferView);
 VK_NULL_DEFINE_DEVICE_OBJ(ImageView);
-VK_NULL_DEFINE_DEVICE_OBJ(ShaderModule);
-VK_NULL_DEFINE_DEVICE_OBJ(PipelineCache);
 VK_NULL_DEFINE_DEVICE_OBJ(PipelineLayout);
 VK_NULL_DEFINE_DEVICE_OBJ(DescriptorSetLayout);
 VK_NULL_DEFINE_DEVICE_OBJ(Sampler);
@@ -235,6 +564,20 @@ private:
 	const tcu::StaticFunctionLibrary	m_functions;
 };
 
+class ShaderModule
+{
+public:
+						ShaderModule	(VkDevice, const VkShaderModuleCreateInfo* pCreateInfo)
+		: m_codeHash (deMemoryHash(pCreateInfo->pCode, (size_t)pCreateInfo->codeSize))
+	{
+	}
+
+	deUint32			getCodeHash		(void) const { return m_codeHash; }
+
+private:
+	const deUint32		m_codeHash;
+};
+
 class Pipeline
 {
 public:
@@ -242,6 +585,154 @@ public:
 	Pipeline (VkDevice, const VkComputePipelineCreateInfo*) {}
 };
 
+deUint32 combineHash (deUint32 hash, deUint32 value)
+{
+	return hash ^ (deUint32Hash(value) + 0x9e3779b9u + (hash << 6) + (hash >> 2));
+}
+
+deUint32 getShaderStageHash (const VkPipelineShaderStageCreateInfo& stageInfo)
+{
+	const ShaderModule* const	module	= reinterpret_cast<const ShaderModule*>((deUintptr)stageInfo.module.getInternal());
+	deUint32					hash	= (deUint32)stageInfo.stage;
+
+	hash = combineHash(hash, module->getCodeHash());
+	hash = combineHash(hash, deStringHash(stageInfo.pName));
+
+	if (stageInfo.pSpecializationInfo && stageInfo.pSpecializationInfo->dataSize > 0)
+		hash = combineHash(hash, deMemoryHash(stageInfo.pSpecializationInfo->pData, (size_t)stageInfo.pSpecializationInfo->dataSize));
+
+	return hash;
+}
+
+// \note Pipeline key covers only shader stages, which is what a real driver would spend time compiling.
+deUint32 getPipelineKey (const VkGraphicsPipelineCreateInfo& createInfo)
+{
+	deUint32 hash = 1u;
+
+	for (deUint32 stageNdx = 0; stageNdx < createInfo.stageCount; ++stageNdx)
+		hash = combineHash(hash, getShaderStageHash(createInfo.pStages[stageNdx]));
+
+	return hash;
+}
+
+deUint32 getPipelineKey (const VkComputePipelineCreateInfo& createInfo)
+{
+	return combineHash(2u, getShaderStageHash(createInfo.stage));
+}
+
+class PipelineCache
+{
+public:
+										PipelineCache	(VkDevice, const VkPipelineCacheCreateInfo* pCreateInfo);
+
+	//! Insert pipeline into the cache. Returns true if the pipeline was already cached.
+	bool								insert			(deUint32 pipelineKey);
+	void								merge			(const PipelineCache& other);
+
+	VkResult							getData			(deUintptr* pDataSize, void* pData) const;
+
+private:
+	enum
+	{
+		HEADER_SIZE	= 4 * sizeof(deUint32) + VK_UUID_SIZE,
+		ENTRY_SIZE	= sizeof(deUint32)
+	};
+
+	static void							writeHeader		(deUint8* dst);
+	static bool							isHeaderValid	(const deUint8* src, size_t size);
+
+	std::set<deUint32>					m_entries;
+};
+
+PipelineCache::PipelineCache (VkDevice, const VkPipelineCacheCreateInfo* pCreateInfo)
+{
+	const deUint8* const	src		= (const deUint8*)pCreateInfo->pInitialData;
+	const size_t			size	= (size_t)pCreateInfo->initialDataSize;
+
+	// Incompatible or corrupt initial data is silently ignored, as on real implementations.
+	if (src && isHeaderValid(src, size))
+	{
+		for (size_t offset = HEADER_SIZE; offset + ENTRY_SIZE <= size; offset += ENTRY_SIZE)
+		{
+			deUint32 key;
+			deMemcpy(&key, src + offset, sizeof(key));
+			m_entries.insert(key);
+		}
+	}
+}
+
+bool PipelineCache::insert (deUint32 pipelineKey)
+{
+	return !m_entries.insert(pipelineKey).second;
+}
+
+void PipelineCache::merge (const PipelineCache& other)
+{
+	m_entries.insert(other.m_entries.begin(), other.m_entries.end());
+}
+
+VkResult PipelineCache::getData (deUintptr* pDataSize, void* pData) const
+{
+	const size_t	fullSize	= HEADER_SIZE + m_entries.size() * ENTRY_SIZE;
+
+	if (!pData)
+	{
+		*pDataSize = (deUintptr)fullSize;
+		return VK_SUCCESS;
+	}
+
+	if (*pDataSize < (deUintptr)HEADER_SIZE)
+	{
+		*pDataSize = 0;
+		return VK_INCOMPLETE;
+	}
+
+	{
+		deUint8* const	dst			= (deUint8*)pData;
+		size_t			offset		= HEADER_SIZE;
+
+		writeHeader(dst);
+
+		// Write only complete entries so that truncated data remains valid initial data
+		for (std::set<deUint32>::const_iterator entry = m_entries.begin(); entry != m_entries.end() && offset + ENTRY_SIZE <= (size_t)*pDataSize; ++entry)
+		{
+			const deUint32 key = *entry;
+			deMemcpy(dst + offset, &key, sizeof(key));
+			offset += ENTRY_SIZE;
+		}
+
+		*pDataSize = (deUintptr)offset;
+
+		return offset == fullSize ? VK_SUCCESS : VK_INCOMPLETE;
+	}
+}
+
+void PipelineCache::writeHeader (deUint8* dst)
+{
+	const deUint32	header[]	=
+	{
+		(deUint32)HEADER_SIZE,					// headerSize
+		VK_PIPELINE_CACHE_HEADER_VERSION_ONE,	// headerVersion
+		0u,										// vendorID
+		0u,										// deviceID
+	};
+
+	deMemcpy(dst, header, sizeof(header));
+	deMemset(dst + sizeof(header), 0, VK_UUID_SIZE);	// pipelineCacheUUID, matches getPhysicalDeviceProperties()
+}
+
+bool PipelineCache::isHeaderValid (const deUint8* src, size_t size)
+{
+	deUint8 expected[HEADER_SIZE];
+
+	if (size < (size_t)HEADER_SIZE)
+		return false;
+
+	writeHeader(expected);
+
+	return deMemCmp(src, expected, HEADER_SIZE) == 0;
+}
+
 class RenderPass
 {
 public:
@@ -509,62 +1000,202 @@ public:
 };
 
 
-class CommandPool
+/*--------------------------------------------------------------------*//*!
+ * \brief Storage for objects allocated from pool objects
+ *
+ * Slots are allocated in chunks and recycled through a free list. reset()
+ * destroys all live objects at once and keeps the chunks for reuse.
+ *//*--------------------------------------------------------------------*/
+template<typename T>
+class ObjectArena
 {
 public:
-										CommandPool		(VkDevice device, const VkCommandPoolCreateInfo*)
-											: m_device(device)
-										{}
-										~CommandPool	(void);
+						ObjectArena		(void);
+						~ObjectArena	(void);
 
-	VkCommandBuffer						allocate		(VkCommandBufferLevel level);
-	void								free			(VkCommandBuffer buffer);
+	void*				allocate		(void);
+	bool				free			(T* obj);
+	void				reset			(void);
 
 private:
-	const VkDevice						m_device;
+	enum
+	{
+		SLOTS_PER_CHUNK	= 64
+	};
+
+	union Slot
+	{
+		Slot*			nextFree;
+		deUint64		align;
+		deUint8			storage[sizeof(T)];
+	};
+
+	struct Chunk
+	{
+		Slot			slots[SLOTS_PER_CHUNK];
+		bool			isLive[SLOTS_PER_CHUNK];
+		size_t			numUsed;
+	};
+
+	typedef std::map<const Slot*, Chunk*>	ChunkMap;
 
-	vector<CommandBuffer*>				m_buffers;
+	Chunk*				findChunk		(const T* obj) const;
+
+	vector<Chunk*>		m_chunks;			//!< In allocation order
+	ChunkMap			m_chunksByBase;		//!< By address of first slot
+	size_t				m_curChunkNdx;
+	Slot*				m_freeList;
 };
 
-CommandPool::~CommandPool (void)
+template<typename T>
+ObjectArena<T>::ObjectArena (void)
+	: m_curChunkNdx	(0)
+	, m_freeList	(DE_NULL)
 {
-	for (size_t ndx = 0; ndx < m_buffers.size(); ++ndx)
-		delete m_buffers[ndx];
 }
 
-VkCommandBuffer CommandPool::allocate (VkCommandBufferLevel level)
+template<typename T>
+ObjectArena<T>::~ObjectArena (void)
 {
-	CommandBuffer* const	impl	= new CommandBuffer(m_device, VkCommandPool(reinterpret_cast<deUintptr>(this)), level);
+	reset();
 
-	try
+	for (size_t ndx = 0; ndx < m_chunks.size(); ++ndx)
+		delete m_chunks[ndx];
+}
+
+template<typename T>
+void* ObjectArena<T>::allocate (void)
+{
+	Slot*	slot	= m_freeList;
+	Chunk*	chunk	= DE_NULL;
+
+	if (slot)
 	{
-		m_buffers.push_back(impl);
+		m_freeList	= slot->nextFree;
+		chunk		= findChunk(reinterpret_cast<const T*>(slot));
 	}
-	catch (...)
+	else
 	{
-		delete impl;
-		throw;
+		while (m_curChunkNdx < m_chunks.size() && m_chunks[m_curChunkNdx]->numUsed == SLOTS_PER_CHUNK)
+			m_curChunkNdx += 1;
+
+		if (m_curChunkNdx == m_chunks.size())
+		{
+			de::MovePtr<Chunk>	newChunk	(new Chunk());
+
+			newChunk->numUsed = 0;
+			m_chunks.push_back(newChunk.get());
+
+			try
+			{
+				m_chunksByBase[&newChunk->slots[0]] = newChunk.get();
+			}
+			catch (...)
+			{
+				m_chunks.pop_back();
+				throw;
+			}
+
+			newChunk.release();
+		}
+
+		chunk	= m_chunks[m_curChunkNdx];
+		slot	= &chunk->slots[chunk->numUsed++];
 	}
 
-	return reinterpret_cast<VkCommandBuffer>(impl);
+	chunk->isLive[slot - &chunk->slots[0]] = true;
+
+	return slot;
 }
 
-void CommandPool::free (VkCommandBuffer buffer)
+template<typename T>
+typename ObjectArena<T>::Chunk* ObjectArena<T>::findChunk (const T* obj) const
 {
-	CommandBuffer* const	impl	= reinterpret_cast<CommandBuffer*>(buffer);
+	const Slot* const				slot	= reinterpret_cast<const Slot*>(obj);
+	typename ChunkMap::const_iterator	next	= m_chunksByBase.upper_bound(slot);
+
+	// Only the last chunk starting at or before slot can contain it
+	if (next == m_chunksByBase.begin())
+		return DE_NULL;
 
-	for (size_t ndx = 0; ndx < m_buffers.size(); ++ndx)
 	{
-		if (m_buffers[ndx] == impl)
+		Chunk* const chunk = (--next)->second;
+
+		if (slot < &chunk->slots[0] + chunk->numUsed)
+			return chunk;
+	}
+
+	return DE_NULL;
+}
+
+//! Returns false if obj is not a live object of this arena
+template<typename T>
+bool ObjectArena<T>::free (T* obj)
+{
+	Chunk* const	chunk	= findChunk(obj);
+	Slot* const		slot	= reinterpret_cast<Slot*>(obj);
+
+	if (!chunk || !chunk->isLive[slot - &chunk->slots[0]])
+		return false;
+
+	obj->~T();
+
+	chunk->isLive[slot - &chunk->slots[0]]	= false;
+	slot->nextFree							= m_freeList;
+	m_freeList								= slot;
+
+	return true;
+}
+
+template<typename T>
+void ObjectArena<T>::reset (void)
+{
+	for (size_t chunkNdx = 0; chunkNdx < m_chunks.size(); ++chunkNdx)
+	{
+		Chunk* const chunk = m_chunks[chunkNdx];
+
+		for (size_t slotNdx = 0; slotNdx < chunk->numUsed; ++slotNdx)
 		{
-			std::swap(m_buffers[ndx], m_buffers.back());
-			m_buffers.pop_back();
-			delete impl;
-			return;
+			if (chunk->isLive[slotNdx])
+				reinterpret_cast<T*>(&chunk->slots[slotNdx])->~T();
 		}
+
+		chunk->numUsed = 0;
 	}
 
-	DE_FATAL("VkCommandBuffer not owned by VkCommandPool");
+	m_curChunkNdx	= 0;
+	m_freeList		= DE_NULL;
+}
+
+class CommandPool
+{
+public:
+										CommandPool		(VkDevice device, const VkCommandPoolCreateInfo*)
+											: m_device(device)
+										{}
+
+	VkCommandBuffer						allocate		(VkCommandBufferLevel level);
+	void								free			(VkCommandBuffer buffer);
+
+private:
+	const VkDevice						m_device;
+
+	ObjectArena<CommandBuffer>			m_buffers;
+};
+
+VkCommandBuffer CommandPool::allocate (VkCommandBufferLevel level)
+{
+	CommandBuffer* const	impl	= new (m_buffers.allocate()) CommandBuffer(m_device, VkCommandPool(reinterpret_cast<deUintptr>(this)), level);
+
+	return reinterpret_cast<VkCommandBuffer>(impl);
+}
+
+void CommandPool::free (VkCommandBuffer buffer)
+{
+	CommandBuffer* const	impl	= reinterpret_cast<CommandBuffer*>(buffer);
+
+	if (!m_buffers.free(impl))
+		DE_FATAL("VkCommandBuffer not owned by VkCommandPool");
 }
 
 class DescriptorSet
@@ -580,13 +1211,10 @@ public:
 											: m_device	(device)
 											, m_flags	(pCreateInfo->flags)
 										{}
-										~DescriptorPool	(void)
-										{
-											reset();
-										}
 
 	VkDescriptorSet						allocate		(VkDescriptorSetLayout setLayout);
 	void								free			(VkDescriptorSet set);
+	void								release			(VkDescriptorSet set);
 
 	void								reset			(void);
 
@@ -594,52 +1222,37 @@ private:
 	const VkDevice						m_device;
 	const VkDescriptorPoolCreateFlags	m_flags;
 
-	vector<DescriptorSet*>				m_managedSets;
+	ObjectArena<DescriptorSet>			m_managedSets;
 };
 
 VkDescriptorSet DescriptorPool::allocate (VkDescriptorSetLayout setLayout)
 {
-	DescriptorSet* const	impl	= new DescriptorSet(m_device, VkDescriptorPool(reinterpret_cast<deUintptr>(this)), setLayout);
-
-	try
-	{
-		m_managedSets.push_back(impl);
-	}
-	catch (...)
-	{
-		delete impl;
-		throw;
-	}
+	DescriptorSet* const	impl	= new (m_managedSets.allocate()) DescriptorSet(m_device, VkDescriptorPool(reinterpret_cast<deUintptr>(this)), setLayout);
 
 	return VkDescriptorSet(reinterpret_cast<deUintptr>(impl));
 }
 
 void DescriptorPool::free (VkDescriptorSet set)
 {
-	DescriptorSet* const	impl	= reinterpret_cast<DescriptorSet*>((deUintptr)set.getInternal());
-
 	DE_ASSERT(m_flags & VK_DESCRIPTOR_POOL_CREATE_FREE_DESCRIPTOR_SET_BIT);
 	DE_UNREF(m_flags);
 
-	for (size_t ndx = 0; ndx < m_managedSets.size(); ++ndx)
-	{
-		if (m_managedSets[ndx] == impl)
-		{
-			std::swap(m_managedSets[ndx], m_managedSets.back());
-			m_managedSets.pop_back();
-			delete impl;
-			return;
-		}
-	}
+	release(set);
+}
 
-	DE_FATAL("VkDescriptorSet not owned by VkDescriptorPool");
+// Frees a set regardless of pool flags, used for rolling back failed allocations
+void DescriptorPool::release (VkDescriptorSet set)
+{
+	DescriptorSet* const	impl	= reinterpret_cast<DescriptorSet*>((deUintptr)set.getInternal());
+
+	if (!m_managedSets.free(impl))
+		DE_FATAL("VkDescriptorSet not owned by VkDescriptorPool");
 }
 
 void DescriptorPool::reset (void)
 {
-	for (size_t ndx = 0; ndx < m_managedSets.size(); ++ndx)
-		delete m_managedSets[ndx];
-	m_managedSets.clear();
+	// All sets are released at once without freeing their storage
+	m_managedSets.reset();
 }
 
 // API implementation
@@ -649,17 +1262,27 @@ extern "C"
 
 VKAPI_ATTR PFN_vkVoidFunction VKAPI_CALL getDeviceProcAddr (VkDevice device, const char* pName)
 {
+	VK_NULL_PROFILE_ENTRY_POINT(getDeviceProcAddr);
+
 	return reinterpret_cast<Device*>(device)->getProcAddr(pName);
 }
 
-VKAPI_ATTR VkResult VKAPI_CALL createGraphicsPipelines (VkDevice device, VkPipelineCache, deUint32 count, const VkGraphicsPipelineCreateInfo* pCreateInfos, const VkAllocationCallbacks* pAllocator, VkPipeline* pPipelines)
+VKAPI_ATTR VkResult VKAPI_CALL createGraphicsPipelines (VkDevice device, VkPipelineCache pipelineCache, deUint32 count, const VkGraphicsPipelineCreateInfo* pCreateInfos, const VkAllocationCallbacks* pAllocator, VkPipeline* pPipelines)
 {
-	deUint32 allocNdx;
+	VK_NULL_PROFILE_ENTRY_POINT(createGraphicsPipelines);
+
+	PipelineCache* const	cacheImpl	= reinterpret_cast<PipelineCache*>((deUintptr)pipelineCache.getInternal());
+	deUint32				allocNdx;
 	try
 	{
 		for (allocNdx = 0; allocNdx < count; allocNdx++)
+		{
 			pPipelines[allocNdx] = allocateNonDispHandle<Pipeline, VkPipeline>(device, pCreateInfos+allocNdx, pAllocator);
 
+			if (cacheImpl)
+				cacheImpl->insert(getPipelineKey(pCreateInfos[allocNdx]));
+		}
+
 		return VK_SUCCESS;
 	}
 	catch (const std::bad_alloc&)
@@ -678,14 +1301,22 @@ VKAPI_ATTR VkResult VKAPI_CALL createGraphicsPipelines (VkDevice device, VkPipel
 	}
 }
 
-VKAPI_ATTR VkResult VKAPI_CALL createComputePipelines (VkDevice device, VkPipelineCache, deUint32 count, const VkComputePipelineCreateInfo* pCreateInfos, const VkAllocationCallbacks* pAllocator, VkPipeline* pPipelines)
+VKAPI_ATTR VkResult VKAPI_CALL createComputePipelines (VkDevice device, VkPipelineCache pipelineCache, deUint32 count, const VkComputePipelineCreateInfo* pCreateInfos, const VkAllocationCallbacks* pAllocator, VkPipeline* pPipelines)
 {
-	deUint32 allocNdx;
+	VK_NULL_PROFILE_ENTRY_POINT(createComputePipelines);
+
+	PipelineCache* const	cacheImpl	= reinterpret_cast<PipelineCache*>((deUintptr)pipelineCache.getInternal());
+	deUint32				allocNdx;
 	try
 	{
 		for (allocNdx = 0; allocNdx < count; allocNdx++)
+		{
 			pPipelines[allocNdx] = allocateNonDispHandle<Pipeline, VkPipeline>(device, pCreateInfos+allocNdx, pAllocator);
 
+			if (cacheImpl)
+				cacheImpl->insert(getPipelineKey(pCreateInfos[allocNdx]));
+		}
+
 		return VK_SUCCESS;
 	}
 	catch (const std::bad_alloc&)
@@ -704,8 +1335,38 @@ VKAPI_ATTR VkResult VKAPI_CALL createComputePipelines (VkDevice device, VkPipeli
 	}
 }
 
+VKAPI_ATTR VkResult VKAPI_CALL getPipelineCacheData (VkDevice, VkPipelineCache pipelineCache, deUintptr* pDataSize, void* pData)
+{
+	VK_NULL_PROFILE_ENTRY_POINT(getPipelineCacheData);
+
+	const PipelineCache* const	cacheImpl	= reinterpret_cast<const PipelineCache*>((deUintptr)pipelineCache.getInternal());
+
+	return cacheImpl->getData(pDataSize, pData);
+}
+
+VKAPI_ATTR VkResult VKAPI_CALL mergePipelineCaches (VkDevice, VkPipelineCache dstCache, deUint32 srcCacheCount, const VkPipelineCache* pSrcCaches)
+{
+	VK_NULL_PROFILE_ENTRY_POINT(mergePipelineCaches);
+
+	PipelineCache* const	dstImpl	= reinterpret_cast<PipelineCache*>((deUintptr)dstCache.getInternal());
+
+	try
+	{
+		for (deUint32 srcNdx = 0; srcNdx < srcCacheCount; ++srcNdx)
+			dstImpl->merge(*reinterpret_cast<const PipelineCache*>((deUintptr)pSrcCaches[srcNdx].getInternal()));
+	}
+	catch (const std::bad_alloc&)
+	{
+		return VK_ERROR_OUT_OF_HOST_MEMORY;
+	}
+
+	return VK_SUCCESS;
+}
+
 VKAPI_ATTR VkResult VKAPI_CALL enumeratePhysicalDevices (VkInstance, deUint32* pPhysicalDeviceCount, VkPhysicalDevice* pDevices)
 {
+	VK_NULL_PROFILE_ENTRY_POINT(enumeratePhysicalDevices);
+
 	if (pDevices && *pPhysicalDeviceCount >= 1u)
 		*pDevices = reinterpret_cast<VkPhysicalDevice>((void*)(deUintptr)1u);
 
@@ -735,6 +1396,8 @@ VkResult enumerateExtensions (deUint32 numExtensions, const VkExtensionPropertie
 
 VKAPI_ATTR VkResult VKAPI_CALL enumerateInstanceExtensionProperties (const char* pLayerName, deUint32* pPropertyCount, VkExtensionProperties* pProperties)
 {
+	VK_NULL_PROFILE_ENTRY_POINT(enumerateInstanceExtensionProperties);
+
 	static const VkExtensionProperties	s_extensions[]	=
 	{
 		{ "VK_KHR_get_physical_device_properties2", 1u },
@@ -749,6 +1412,8 @@ VKAPI_ATTR VkResult VKAPI_CALL enumerateInstanceExtensionProperties (const char*
 
 VKAPI_ATTR VkResult VKAPI_CALL enumerateDeviceExtensionProperties (VkPhysicalDevice physicalDevice, const char* pLayerName, deUint32* pPropertyCount, VkExtensionProperties* pProperties)
 {
+	VK_NULL_PROFILE_ENTRY_POINT(enumerateDeviceExtensionProperties);
+
 	DE_UNREF(physicalDevice);
 
 	static const VkExtensionProperties	s_extensions[]	=
@@ -771,6 +1436,8 @@ VKAPI_ATTR VkResult VKAPI_CALL enumerateDeviceExtensionProperties (VkPhysicalDev
 
 VKAPI_ATTR void VKAPI_CALL getPhysicalDeviceFeatures (VkPhysicalDevice physicalDevice, VkPhysicalDeviceFeatures* pFeatures)
 {
+	VK_NULL_PROFILE_ENTRY_POINT(getPhysicalDeviceFeatures);
+
 	DE_UNREF(physicalDevice);
 
 	// Enable all features allow as many tests to run as possible
@@ -833,6 +1500,8 @@ VKAPI_ATTR void VKAPI_CALL getPhysicalDeviceFeatures (VkPhysicalDevice physicalD
 
 VKAPI_ATTR void VKAPI_CALL getPhysicalDeviceProperties (VkPhysicalDevice, VkPhysicalDeviceProperties* props)
 {
+	VK_NULL_PROFILE_ENTRY_POINT(getPhysicalDeviceProperties);
+
 	deMemset(props, 0, sizeof(VkPhysicalDeviceProperties));
 
 	props->apiVersion		= VK_API_VERSION_1_1;
@@ -960,6 +1629,8 @@ VKAPI_ATTR void VKAPI_CALL getPhysicalDeviceProperties (VkPhysicalDevice, VkPhys
 
 VKAPI_ATTR void VKAPI_CALL getPhysicalDeviceQueueFamilyProperties (VkPhysicalDevice, deUint32* count, VkQueueFamilyProperties* props)
 {
+	VK_NULL_PROFILE_ENTRY_POINT(getPhysicalDeviceQueueFamilyProperties);
+
 	if (props && *count >= 1u)
 	{
 		deMemset(props, 0, sizeof(VkQueueFamilyProperties));
@@ -974,6 +1645,8 @@ VKAPI_ATTR void VKAPI_CALL getPhysicalDeviceQueueFamilyProperties (VkPhysicalDev
 
 VKAPI_ATTR void VKAPI_CALL getPhysicalDeviceMemoryProperties (VkPhysicalDevice, VkPhysicalDeviceMemoryProperties* props)
 {
+	VK_NULL_PROFILE_ENTRY_POINT(getPhysicalDeviceMemoryProperties);
+
 	deMemset(props, 0, sizeof(VkPhysicalDeviceMemoryProperties));
 
 	props->memoryTypeCount				= 1u;
@@ -989,6 +1662,8 @@ VKAPI_ATTR void VKAPI_CALL getPhysicalDeviceMemoryProperties (VkPhysicalDevice,
 
 VKAPI_ATTR void VKAPI_CALL getPhysicalDeviceFormatProperties (VkPhysicalDevice, VkFormat format, VkFormatProperties* pFormatProperties)
 {
+	VK_NULL_PROFILE_ENTRY_POINT(getPhysicalDeviceFormatProperties);
+
 	const VkFormatFeatureFlags	allFeatures	= VK_FORMAT_FEATURE_SAMPLED_IMAGE_BIT
 											| VK_FORMAT_FEATURE_STORAGE_IMAGE_BIT
 											| VK_FORMAT_FEATURE_STORAGE_IMAGE_ATOMIC_BIT
@@ -1019,6 +1694,8 @@ VKAPI_ATTR void VKAPI_CALL getPhysicalDeviceFormatProperties (VkPhysicalDevice,
 
 VKAPI_ATTR VkResult VKAPI_CALL getPhysicalDeviceImageFormatProperties (VkPhysicalDevice physicalDevice, VkFormat format, VkImageType type, VkImageTiling tiling, VkImageUsageFlags usage, VkImageCreateFlags flags, VkImageFormatProperties* pImageFormatProperties)
 {
+	VK_NULL_PROFILE_ENTRY_POINT(getPhysicalDeviceImageFormatProperties);
+
 	DE_UNREF(physicalDevice);
 	DE_UNREF(format);
 	DE_UNREF(type);
@@ -1039,6 +1716,8 @@ VKAPI_ATTR VkResult VKAPI_CALL getPhysicalDeviceImageFormatProperties (VkPhysica
 
 VKAPI_ATTR void VKAPI_CALL getDeviceQueue (VkDevice device, deUint32 queueFamilyIndex, deUint32 queueIndex, VkQueue* pQueue)
 {
+	VK_NULL_PROFILE_ENTRY_POINT(getDeviceQueue);
+
 	DE_UNREF(device);
 	DE_UNREF(queueFamilyIndex);
 
@@ -1048,6 +1727,8 @@ VKAPI_ATTR void VKAPI_CALL getDeviceQueue (VkDevice device, deUint32 queueFamily
 
 VKAPI_ATTR void VKAPI_CALL getBufferMemoryRequirements (VkDevice, VkBuffer bufferHandle, VkMemoryRequirements* requirements)
 {
+	VK_NULL_PROFILE_ENTRY_POINT(getBufferMemoryRequirements);
+
 	const Buffer*	buffer	= reinterpret_cast<const Buffer*>(bufferHandle.getInternal());
 
 	requirements->memoryTypeBits	= 1u;
@@ -1105,6 +1786,8 @@ VkDeviceSize getYCbCrImageDataSize (VkFormat format, VkExtent3D extent)
 
 VKAPI_ATTR void VKAPI_CALL getImageMemoryRequirements (VkDevice, VkImage imageHandle, VkMemoryRequirements* requirements)
 {
+	VK_NULL_PROFILE_ENTRY_POINT(getImageMemoryRequirements);
+
 	const Image*	image	= reinterpret_cast<const Image*>(imageHandle.getInternal());
 
 	requirements->memoryTypeBits	= 1u;
@@ -1120,6 +1803,8 @@ VKAPI_ATTR void VKAPI_CALL getImageMemoryRequirements (VkDevice, VkImage imageHa
 
 VKAPI_ATTR VkResult VKAPI_CALL allocateMemory (VkDevice device, const VkMemoryAllocateInfo* pAllocateInfo, const VkAllocationCallbacks* pAllocator, VkDeviceMemory* pMemory)
 {
+	VK_NULL_PROFILE_ENTRY_POINT(allocateMemory);
+
 	const VkExportMemoryAllocateInfo* const					exportInfo	= findStructure<VkExportMemoryAllocateInfo>(pAllocateInfo->pNext);
 	const VkImportAndroidHardwareBufferInfoANDROID* const	importInfo	= findStructure<VkImportAndroidHardwareBufferInfoANDROID>(pAllocateInfo->pNext);
 
@@ -1140,6 +1825,8 @@ VKAPI_ATTR VkResult VKAPI_CALL allocateMemory (VkDevice device, const VkMemoryAl
 
 VKAPI_ATTR VkResult VKAPI_CALL mapMemory (VkDevice, VkDeviceMemory memHandle, VkDeviceSize offset, VkDeviceSize size, VkMemoryMapFlags flags, void** ppData)
 {
+	VK_NULL_PROFILE_ENTRY_POINT(mapMemory);
+
 	DeviceMemory* const	memory	= reinterpret_cast<DeviceMemory*>(memHandle.getInternal());
 
 	DE_UNREF(size);
@@ -1152,6 +1839,8 @@ VKAPI_ATTR VkResult VKAPI_CALL mapMemory (VkDevice, VkDeviceMemory memHandle, Vk
 
 VKAPI_ATTR void VKAPI_CALL unmapMemory (VkDevice device, VkDeviceMemory memHandle)
 {
+	VK_NULL_PROFILE_ENTRY_POINT(unmapMemory);
+
 	DeviceMemory* const	memory	= reinterpret_cast<DeviceMemory*>(memHandle.getInternal());
 
 	DE_UNREF(device);
@@ -1161,6 +1850,8 @@ VKAPI_ATTR void VKAPI_CALL unmapMemory (VkDevice device, VkDeviceMemory memHandl
 
 VKAPI_ATTR VkResult VKAPI_CALL getMemoryAndroidHardwareBufferANDROID (VkDevice device, const VkMemoryGetAndroidHardwareBufferInfoANDROID* pInfo, pt::AndroidHardwareBufferPtr* pBuffer)
 {
+	VK_NULL_PROFILE_ENTRY_POINT(getMemoryAndroidHardwareBufferANDROID);
+
 	DE_UNREF(device);
 
 #if defined(USE_ANDROID_O_HARDWARE_BUFFER)
@@ -1180,6 +1871,8 @@ VKAPI_ATTR VkResult VKAPI_CALL getMemoryAndroidHardwareBufferANDROID (VkDevice d
 
 VKAPI_ATTR VkResult VKAPI_CALL allocateDescriptorSets (VkDevice, const VkDescriptorSetAllocateInfo* pAllocateInfo, VkDescriptorSet* pDescriptorSets)
 {
+	VK_NULL_PROFILE_ENTRY_POINT(allocateDescriptorSets);
+
 	DescriptorPool* const	poolImpl	= reinterpret_cast<DescriptorPool*>((deUintptr)pAllocateInfo->descriptorPool.getInternal());
 
 	for (deUint32 ndx = 0; ndx < pAllocateInfo->descriptorSetCount; ++ndx)
@@ -1191,14 +1884,14 @@ VKAPI_ATTR VkResult VKAPI_CALL allocateDescriptorSets (VkDevice, const VkDescrip
 		catch (const std::bad_alloc&)
 		{
 			for (deUint32 freeNdx = 0; freeNdx < ndx; freeNdx++)
-				delete reinterpret_cast<DescriptorSet*>((deUintptr)pDescriptorSets[freeNdx].getInternal());
+				poolImpl->release(pDescriptorSets[freeNdx]);
 
 			return VK_ERROR_OUT_OF_HOST_MEMORY;
 		}
 		catch (VkResult res)
 		{
 			for (deUint32 freeNdx = 0; freeNdx < ndx; freeNdx++)
-				delete reinterpret_cast<DescriptorSet*>((deUintptr)pDescriptorSets[freeNdx].getInternal());
+				poolImpl->release(pDescriptorSets[freeNdx]);
 
 			return res;
 		}
@@ -1209,6 +1902,8 @@ VKAPI_ATTR VkResult VKAPI_CALL allocateDescriptorSets (VkDevice, const VkDescrip
 
 VKAPI_ATTR void VKAPI_CALL freeDescriptorSets (VkDevice, VkDescriptorPool descriptorPool, deUint32 count, const VkDescriptorSet* pDescriptorSets)
 {
+	VK_NULL_PROFILE_ENTRY_POINT(freeDescriptorSets);
+
 	DescriptorPool* const	poolImpl	= reinterpret_cast<DescriptorPool*>((deUintptr)descriptorPool.getInternal());
 
 	for (deUint32 ndx = 0; ndx < count; ++ndx)
@@ -1217,6 +1912,8 @@ VKAPI_ATTR void VKAPI_CALL freeDescriptorSets (VkDevice, VkDescriptorPool descri
 
 VKAPI_ATTR VkResult VKAPI_CALL resetDescriptorPool (VkDevice, VkDescriptorPool descriptorPool, VkDescriptorPoolResetFlags)
 {
+	VK_NULL_PROFILE_ENTRY_POINT(resetDescriptorPool);
+
 	DescriptorPool* const	poolImpl	= reinterpret_cast<DescriptorPool*>((deUintptr)descriptorPool.getInternal());
 
 	poolImpl->reset();
@@ -1226,6 +1923,8 @@ VKAPI_ATTR VkResult VKAPI_CALL resetDescriptorPool (VkDevice, VkDescriptorPool d
 
 VKAPI_ATTR VkResult VKAPI_CALL allocateCommandBuffers (VkDevice device, const VkCommandBufferAllocateInfo* pAllocateInfo, VkCommandBuffer* pCommandBuffers)
 {
+	VK_NULL_PROFILE_ENTRY_POINT(allocateCommandBuffers);
+
 	DE_UNREF(device);
 
 	if (pAllocateInfo && pCommandBuffers)
@@ -1241,6 +1940,8 @@ VKAPI_ATTR VkResult VKAPI_CALL allocateCommandBuffers (VkDevice device, const Vk
 
 VKAPI_ATTR void VKAPI_CALL freeCommandBuffers (VkDevice device, VkCommandPool commandPool, deUint32 commandBufferCount, const VkCommandBuffer* pCommandBuffers)
 {
+	VK_NULL_PROFILE_ENTRY_POINT(freeCommandBuffers);
+
 	CommandPool* const	poolImpl	= reinterpret_cast<CommandPool*>((deUintptr)commandPool.getInternal());
 
 	DE_UNREF(device);
@@ -1252,12 +1953,16 @@ VKAPI_ATTR void VKAPI_CALL freeCommandBuffers (VkDevice device, VkCommandPool co
 
 VKAPI_ATTR VkResult VKAPI_CALL createDisplayModeKHR (VkPhysicalDevice, VkDisplayKHR display, const VkDisplayModeCreateInfoKHR* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkDisplayModeKHR* pMode)
 {
+	VK_NULL_PROFILE_ENTRY_POINT(createDisplayModeKHR);
+
 	DE_UNREF(pAllocator);
 	VK_NULL_RETURN((*pMode = allocateNonDispHandle<DisplayModeKHR, VkDisplayModeKHR>(display, pCreateInfo, pAllocator)));
 }
 
 VKAPI_ATTR VkResult VKAPI_CALL createSharedSwapchainsKHR (VkDevice device, deUint32 swapchainCount, const VkSwapchainCreateInfoKHR* pCreateInfos, const VkAllocationCallbacks* pAllocator, VkSwapchainKHR* pSwapchains)
 {
+	VK_NULL_PROFILE_ENTRY_POINT(createSharedSwapchainsKHR);
+
 	for (deUint32 ndx = 0; ndx < swapchainCount; ++ndx)
 	{
 		pSwapchains[ndx] = allocateNonDispHandle<SwapchainKHR, VkSwapchainKHR>(device, pCreateInfos+ndx, pAllocator);
@@ -1268,6 +1973,8 @@ VKAPI_ATTR VkResult VKAPI_CALL createSharedSwapchainsKHR (VkDevice device, deUin
 
 VKAPI_ATTR void VKAPI_CALL getPhysicalDeviceExternalBufferPropertiesKHR (VkPhysicalDevice physicalDevice, const VkPhysicalDeviceExternalBufferInfo* pExternalBufferInfo, VkExternalBufferProperties* pExternalBufferProperties)
 {
+	VK_NULL_PROFILE_ENTRY_POINT(getPhysicalDeviceExternalBufferPropertiesKHR);
+
 	DE_UNREF(physicalDevice);
 	DE_UNREF(pExternalBufferInfo);
 
@@ -1285,6 +1992,8 @@ VKAPI_ATTR void VKAPI_CALL getPhysicalDeviceExternalBufferPropertiesKHR (VkPhysi
 
 VKAPI_ATTR VkResult VKAPI_CALL getPhysicalDeviceImageFormatProperties2KHR (VkPhysicalDevice physicalDevice, const VkPhysicalDeviceImageFormatInfo2* pImageFormatInfo, VkImageFormatProperties2* pImageFormatProperties)
 {
+	VK_NULL_PROFILE_ENTRY_POINT(getPhysicalDeviceImageFormatProperties2KHR);
+
 	const VkPhysicalDeviceExternalImageFormatInfo* const	externalInfo		= findStructure<VkPhysicalDeviceExternalImageFormatInfo>(pImageFormatInfo->pNext);
 	VkExternalImageFormatProperties*	const				externalProperties	= findStructure<VkExternalImageFormatProperties>(pImageFormatProperties->pNext);
 	VkResult												result;
@@ -1350,6 +2059,8 @@ VKAPI_ATTR PFN_vkVoidFunction VKAPI_CALL getInstanceProcAddr (VkInstance instanc
 
 VKAPI_ATTR PFN_vkVoidFunction VKAPI_CALL getInstanceProcAddr (VkInstance instance, const char* pName)
 {
+	VK_NULL_PROFILE_ENTRY_POINT(getInstanceProcAddr);
+
 	if (instance)
 	{
 		return reinterpret_cast<Instance*>(instance)->getProcAddr(pName);
@@ -1387,7 +2098,17 @@ public:
 										NullDriverLibrary (void)
 											: m_library	(s_platformFunctions, DE_LENGTH_OF_ARRAY(s_platformFunctions))
 											, m_driver	(m_library)
-										{}
+										{
+											ObjectHeap::acquire();
+										}
+
+										~NullDriverLibrary	(void)
+										{
+#if defined(DEQP_VK_NULL_DRIVER_PROFILE)
+											dumpEntryPointStats();
+#endif
+											ObjectHeap::release();
+										}
 
 	const PlatformInterface&			getPlatformInterface	(void) const	{ return m_driver;	}
 	const tcu::FunctionLibrary&			getFunctionLibrary		(void) const	{ return m_library;	}
@@ -1396,6 +2117,108 @@ private:
 	const PlatformDriver				m_driver;
 };
 
+struct ArenaTestObject
+{
+	int*	destroyCount;
+
+			ArenaTestObject		(int* destroyCount_) : destroyCount(destroyCount_) {}
+			~ArenaTestObject	(void) { *destroyCount += 1; }
+};
+
+void objectArenaSelfTest (void)
+{
+	const int					numObjects	= 3*64 + 5;	// Spans several chunks
+	int							destroyed	= 0;
+	vector<ArenaTestObject*>	objects		(numObjects);
+
+	{
+		ObjectArena<ArenaTestObject> arena;
+
+		for (int ndx = 0; ndx < numObjects; ++ndx)
+			objects[ndx] = new (arena.allocate()) ArenaTestObject(&destroyed);
+
+		// Free every other object, in every chunk
+		for (int ndx = 0; ndx < numObjects; ndx += 2)
+			DE_TEST_ASSERT(arena.free(objects[ndx]));
+
+		DE_TEST_ASSERT(destroyed == (numObjects + 1) / 2);
+
+		// Double free and foreign objects are rejected without destroying them
+		{
+			int				foreignDestroyed	= 0;
+			ArenaTestObject	foreign				(&foreignDestroyed);
+
+			DE_TEST_ASSERT(!arena.free(objects[0]));
+			DE_TEST_ASSERT(!arena.free(objects[numObjects - 1]));
+			DE_TEST_ASSERT(!arena.free(&foreign));
+			DE_TEST_ASSERT(destroyed == (numObjects + 1) / 2 && foreignDestroyed == 0);
+		}
+
+		// Freed slots are reused, most recent first
+		{
+			ArenaTestObject* const obj = new (arena.allocate()) ArenaTestObject(&destroyed);
+
+			DE_TEST_ASSERT(obj == objects[numObjects - 1]);
+			DE_TEST_ASSERT(arena.free(obj));
+		}
+
+		// Reset destroys live objects and keeps chunks
+		destroyed = 0;
+		arena.reset();
+		DE_TEST_ASSERT(destroyed == numObjects / 2);
+		DE_TEST_ASSERT(!arena.free(objects[1]));
+
+		objects[0] = new (arena.allocate()) ArenaTestObject(&destroyed);
+		objects[1] = new (arena.allocate()) ArenaTestObject(&destroyed);
+		DE_TEST_ASSERT(arena.free(objects[1]));
+
+		destroyed = 0;
+	}
+
+	// Arena destructor destroys remaining objects
+	DE_TEST_ASSERT(destroyed == 1);
+}
+
+void objectHeapSelfTest (void)
+{
+	static const size_t		sizes[]		= { 1, 16, 100, 496, 497, 4096 };
+
+	ObjectHeap::acquire();
+
+	for (int sizeNdx = 0; sizeNdx < DE_LENGTH_OF_ARRAY(sizes); ++sizeNdx)
+	{
+		const size_t	size	= sizes[sizeNdx];
+		void* const		first	= ObjectHeap::getInstance().allocate(size);
+		void* const		second	= ObjectHeap::getInstance().allocate(size);
+
+		DE_TEST_ASSERT(first != second);
+		DE_TEST_ASSERT(deIsAlignedPtr(first, 16) && deIsAlignedPtr(second, 16));
+
+		deMemset(first, 0xcd, size);
+		deMemset(second, 0xcd, size);
+
+		ObjectHeap::getInstance().free(second);
+
+		// Blocks of slab size classes are recycled
+		if (size <= 496)
+		{
+			void* const again = ObjectHeap::getInstance().allocate(size);
+
+			DE_TEST_ASSERT(again == second);
+			ObjectHeap::getInstance().free(again);
+		}
+
+		ObjectHeap::getInstance().free(first);
+	}
+
+	// Heap stays alive until the last reference is released
+	ObjectHeap::acquire();
+	ObjectHeap::release();
+	ObjectHeap::getInstance().free(ObjectHeap::getInstance().allocate(64));
+
+	ObjectHeap::release();
+}
+
 } // anonymous
 
 Library* createNullDriver (void)
@@ -1403,4 +2226,34 @@ Library* createNullDriver (void)
 	return new NullDriverLibrary();
 }
 
+void nullDriverSelfTest (void)
+{
+	objectArenaSelfTest();
+	objectHeapSelfTest();
+
+	// Libraries share the heap, it must outlive the first library destroyed
+	{
+		de::MovePtr<Library>		first			(createNullDriver());
+		const de::UniquePtr<Library>	second			(createNullDriver());
+		const VkBufferCreateInfo		bufferParams	=
+		{
+			VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO,
+			DE_NULL,
+			0u,
+			64u,
+			VK_BUFFER_USAGE_TRANSFER_DST_BIT,
+			VK_SHARING_MODE_EXCLUSIVE,
+			0u,
+			DE_NULL
+		};
+
+		first.clear();
+
+		{
+			const VkBuffer buffer = allocateNonDispHandle<Buffer, VkBuffer>((VkDevice)DE_NULL, &bufferParams, DE_NULL);
+			freeNonDispHandle<Buffer, VkBuffer>(buffer, DE_NULL);
+		}
+	}
+}
+
 } // vk
@@ -32,6 +32,8 @@ class Library;
 
 Library*	createNullDriver	(void);
 
+void		nullDriverSelfTest	(void);
+
 } // vk
 
 #endif // _VKNULLDRIVER_HPP
@@ -3,400 +3,467 @@
  */
 VKAPI_ATTR VkResult VKAPI_CALL createInstance (const VkInstanceCreateInfo* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkInstance* pInstance)
 {
+	VK_NULL_PROFILE_ENTRY_POINT(createInstance);
 	DE_UNREF(pAllocator);
 	VK_NULL_RETURN((*pInstance = allocateHandle<Instance, VkInstance>(pCreateInfo, pAllocator)));
 }
 
 VKAPI_ATTR VkResult VKAPI_CALL createDevice (VkPhysicalDevice physicalDevice, const VkDeviceCreateInfo* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkDevice* pDevice)
 {
+	VK_NULL_PROFILE_ENTRY_POINT(createDevice);
 	DE_UNREF(pAllocator);
 	VK_NULL_RETURN((*pDevice = allocateHandle<Device, VkDevice>(physicalDevice, pCreateInfo, pAllocator)));
 }
 
 VKAPI_ATTR VkResult VKAPI_CALL createFence (VkDevice device, const VkFenceCreateInfo* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkFence* pFence)
 {
+	VK_NULL_PROFILE_ENTRY_POINT(createFence);
 	DE_UNREF(pAllocator);
 	VK_NULL_RETURN((*pFence = allocateNonDispHandle<Fence, VkFence>(device, pCreateInfo, pAllocator)));
 }
 
 VKAPI_ATTR VkResult VKAPI_CALL createSemaphore (VkDevice device, const VkSemaphoreCreateInfo* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkSemaphore* pSemaphore)
 {
+	VK_NULL_PROFILE_ENTRY_POINT(createSemaphore);
 	DE_UNREF(pAllocator);
 	VK_NULL_RETURN((*pSemaphore = allocateNonDispHandle<Semaphore, VkSemaphore>(device, pCreateInfo, pAllocator)));
 }
 
 VKAPI_ATTR VkResult VKAPI_CALL createEvent (VkDevice device, const VkEventCreateInfo* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkEvent* pEvent)
 {
+	VK_NULL_PROFILE_ENTRY_POINT(createEvent);
 	DE_UNREF(pAllocator);
 	VK_NULL_RETURN((*pEvent = allocateNonDispHandle<Event, VkEvent>(device, pCreateInfo, pAllocator)));
 }
 
 VKAPI_ATTR VkResult VKAPI_CALL createQueryPool (VkDevice device, const VkQueryPoolCreateInfo* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkQueryPool* pQueryPool)
 {
+	VK_NULL_PROFILE_ENTRY_POINT(createQueryPool);
 	DE_UNREF(pAllocator);
 	VK_NULL_RETURN((*pQueryPool = allocateNonDispHandle<QueryPool, VkQueryPool>(device, pCreateInfo, pAllocator)));
 }
 
 VKAPI_ATTR VkResult VKAPI_CALL createBuffer (VkDevice device, const VkBufferCreateInfo* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkBuffer* pBuffer)
 {
+	VK_NULL_PROFILE_ENTRY_POINT(createBuffer);
 	DE_UNREF(pAllocator);
 	VK_NULL_RETURN((*pBuffer = allocateNonDispHandle<Buffer, VkBuffer>(device, pCreateInfo, pAllocator)));
 }
 
 VKAPI_ATTR VkResult VKAPI_CALL createBufferView (VkDevice device, const VkBufferViewCreateInfo* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkBufferView* pView)
 {
+	VK_NULL_PROFILE_ENTRY_POINT(createBufferView);
 	DE_UNREF(pAllocator);
 	VK_NULL_RETURN((*pView = allocateNonDispHandle<BufferView, VkBufferView>(device, pCreateInfo, pAllocator)));
 }
 
 VKAPI_ATTR VkResult VKAPI_CALL createImage (VkDevice device, const VkImageCreateInfo* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkImage* pImage)
 {
+	VK_NULL_PROFILE_ENTRY_POINT(createImage);
 	DE_UNREF(pAllocator);
 	VK_NULL_RETURN((*pImage = allocateNonDispHandle<Image, VkImage>(device, pCreateInfo, pAllocator)));
 }
 
 VKAPI_ATTR VkResult VKAPI_CALL createImageView (VkDevice device, const VkImageViewCreateInfo* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkImageView* pView)
 {
+	VK_NULL_PROFILE_ENTRY_POINT(createImageView);
 	DE_UNREF(pAllocator);
 	VK_NULL_RETURN((*pView = allocateNonDispHandle<ImageView, VkImageView>(device, pCreateInfo, pAllocator)));
 }
 
 VKAPI_ATTR VkResult VKAPI_CALL createShaderModule (VkDevice device, const VkShaderModuleCreateInfo* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkShaderModule* pShaderModule)
 {
+	VK_NULL_PROFILE_ENTRY_POINT(createShaderModule);
 	DE_UNREF(pAllocator);
 	VK_NULL_RETURN((*pShaderModule = allocateNonDispHandle<ShaderModule, VkShaderModule>(device, pCreateInfo, pAllocator)));
 }
 
 VKAPI_ATTR VkResult VKAPI_CALL createPipelineCache (VkDevice device, const VkPipelineCacheCreateInfo* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkPipelineCache* pPipelineCache)
 {
+	VK_NULL_PROFILE_ENTRY_POINT(createPipelineCache);
 	DE_UNREF(pAllocator);
 	VK_NULL_RETURN((*pPipelineCache = allocateNonDispHandle<PipelineCache, VkPipelineCache>(device, pCreateInfo, pAllocator)));
 }
 
 VKAPI_ATTR VkResult VKAPI_CALL createPipelineLayout (VkDevice device, const VkPipelineLayoutCreateInfo* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkPipelineLayout* pPipelineLayout)
 {
+	VK_NULL_PROFILE_ENTRY_POINT(createPipelineLayout);
 	DE_UNREF(pAllocator);
 	VK_NULL_RETURN((*pPipelineLayout = allocateNonDispHandle<PipelineLayout, VkPipelineLayout>(device, pCreateInfo, pAllocator)));
 }
 
 VKAPI_ATTR VkResult VKAPI_CALL createSampler (VkDevice device, const VkSamplerCreateInfo* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkSampler* pSampler)
 {
+	VK_NULL_PROFILE_ENTRY_POINT(createSampler);
 	DE_UNREF(pAllocator);
 	VK_NULL_RETURN((*pSampler = allocateNonDispHandle<Sampler, VkSampler>(device, pCreateInfo, pAllocator)));
 }
 
 VKAPI_ATTR VkResult VKAPI_CALL createDescriptorSetLayout (VkDevice device, const VkDescriptorSetLayoutCreateInfo* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkDescriptorSetLayout* pSetLayout)
 {
+	VK_NULL_PROFILE_ENTRY_POINT(createDescriptorSetLayout);
 	DE_UNREF(pAllocator);
 	VK_NULL_RETURN((*pSetLayout = allocateNonDispHandle<DescriptorSetLayout, VkDescriptorSetLayout>(device, pCreateInfo, pAllocator)));
 }
 
 VKAPI_ATTR VkResult VKAPI_CALL createDescriptorPool (VkDevice device, const VkDescriptorPoolCreateInfo* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkDescriptorPool* pDescriptorPool)
 {
+	VK_NULL_PROFILE_ENTRY_POINT(createDescriptorPool);
 	DE_UNREF(pAllocator);
 	VK_NULL_RETURN((*pDescriptorPool = allocateNonDispHandle<DescriptorPool, VkDescriptorPool>(device, pCreateInfo, pAllocator)));
 }
 
 VKAPI_ATTR VkResult VKAPI_CALL createFramebuffer (VkDevice device, const VkFramebufferCreateInfo* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkFramebuffer* pFramebuffer)
 {
+	VK_NULL_PROFILE_ENTRY_POINT(createFramebuffer);
 	DE_UNREF(pAllocator);
 	VK_NULL_RETURN((*pFramebuffer = allocateNonDispHandle<Framebuffer, VkFramebuffer>(device, pCreateInfo, pAllocator)));
 }
 
 VKAPI_ATTR VkResult VKAPI_CALL createRenderPass (VkDevice device, const VkRenderPassCreateInfo* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkRenderPass* pRenderPass)
 {
+	VK_NULL_PROFILE_ENTRY_POINT(createRenderPass);
 	DE_UNREF(pAllocator);
 	VK_NULL_RETURN((*pRenderPass = allocateNonDispHandle<RenderPass, VkRenderPass>(device, pCreateInfo, pAllocator)));
 }
 
 VKAPI_ATTR VkResult VKAPI_CALL createCommandPool (VkDevice device, const VkCommandPoolCreateInfo* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkCommandPool* pCommandPool)
 {
+	VK_NULL_PROFILE_ENTRY_POINT(createCommandPool);
 	DE_UNREF(pAllocator);
 	VK_NULL_RETURN((*pCommandPool = allocateNonDispHandle<CommandPool, VkCommandPool>(device, pCreateInfo, pAllocator)));
 }
 
 VKAPI_ATTR VkResult VKAPI_CALL createSamplerYcbcrConversion (VkDevice device, const VkSamplerYcbcrConversionCreateInfo* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkSamplerYcbcrConversion* pYcbcrConversion)
 {
+	VK_NULL_PROFILE_ENTRY_POINT(createSamplerYcbcrConversion);
 	DE_UNREF(pAllocator);
 	VK_NULL_RETURN((*pYcbcrConversion = allocateNonDispHandle<SamplerYcbcrConversion, VkSamplerYcbcrConversion>(device, pCreateInfo, pAllocator)));
 }
 
 VKAPI_ATTR VkResult VKAPI_CALL createDescriptorUpdateTemplate (VkDevice device, const VkDescriptorUpdateTemplateCreateInfo* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkDescriptorUpdateTemplate* pDescriptorUpdateTemplate)
 {
+	VK_NULL_PROFILE_ENTRY_POINT(createDescriptorUpdateTemplate);
 	DE_UNREF(pAllocator);
 	VK_NULL_RETURN((*pDescriptorUpdateTemplate = allocateNonDispHandle<DescriptorUpdateTemplate, VkDescriptorUpdateTemplate>(device, pCreateInfo, pAllocator)));
 }
 
 VKAPI_ATTR VkResult VKAPI_CALL createSwapchainKHR (VkDevice device, const VkSwapchainCreateInfoKHR* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkSwapchainKHR* pSwapchain)
 {
+	VK_NULL_PROFILE_ENTRY_POINT(createSwapchainKHR);
 	DE_UNREF(pAllocator);
 	VK_NULL_RETURN((*pSwapchain = allocateNonDispHandle<SwapchainKHR, VkSwapchainKHR>(device, pCreateInfo, pAllocator)));
 }
 
 VKAPI_ATTR VkResult VKAPI_CALL createDisplayPlaneSurfaceKHR (VkInstance instance, const VkDisplaySurfaceCreateInfoKHR* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkSurfaceKHR* pSurface)
 {
+	VK_NULL_PROFILE_ENTRY_POINT(createDisplayPlaneSurfaceKHR);
 	DE_UNREF(pAllocator);
 	VK_NULL_RETURN((*pSurface = allocateNonDispHandle<SurfaceKHR, VkSurfaceKHR>(instance, pCreateInfo, pAllocator)));
 }
 
 VKAPI_ATTR VkResult VKAPI_CALL createXlibSurfaceKHR (VkInstance instance, const VkXlibSurfaceCreateInfoKHR* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkSurfaceKHR* pSurface)
 {
+	VK_NULL_PROFILE_ENTRY_POINT(createXlibSurfaceKHR);
 	DE_UNREF(pAllocator);
 	VK_NULL_RETURN((*pSurface = allocateNonDispHandle<SurfaceKHR, VkSurfaceKHR>(instance, pCreateInfo, pAllocator)));
 }
 
 VKAPI_ATTR VkResult VKAPI_CALL createXcbSurfaceKHR (VkInstance instance, const VkXcbSurfaceCreateInfoKHR* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkSurfaceKHR* pSurface)
 {
+	VK_NULL_PROFILE_ENTRY_POINT(createXcbSurfaceKHR);
 	DE_UNREF(pAllocator);
 	VK_NULL_RETURN((*pSurface = allocateNonDispHandle<SurfaceKHR, VkSurfaceKHR>(instance, pCreateInfo, pAllocator)));
 }
 
 VKAPI_ATTR VkResult VKAPI_CALL createWaylandSurfaceKHR (VkInstance instance, const VkWaylandSurfaceCreateInfoKHR* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkSurfaceKHR* pSurface)
 {
+	VK_NULL_PROFILE_ENTRY_POINT(createWaylandSurfaceKHR);
 	DE_UNREF(pAllocator);
 	VK_NULL_RETURN((*pSurface = allocateNonDispHandle<SurfaceKHR, VkSurfaceKHR>(instance, pCreateInfo, pAllocator)));
 }
 
 VKAPI_ATTR VkResult VKAPI_CALL createMirSurfaceKHR (VkInstance instance, const VkMirSurfaceCreateInfoKHR* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkSurfaceKHR* pSurface)
 {
+	VK_NULL_PROFILE_ENTRY_POINT(createMirSurfaceKHR);
 	DE_UNREF(pAllocator);
 	VK_NULL_RETURN((*pSurface = allocateNonDispHandle<SurfaceKHR, VkSurfaceKHR>(instance, pCreateInfo, pAllocator)));
 }
 
 VKAPI_ATTR VkResult VKAPI_CALL createAndroidSurfaceKHR (VkInstance instance, const VkAndroidSurfaceCreateInfoKHR* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkSurfaceKHR* pSurface)
 {
+	VK_NULL_PROFILE_ENTRY_POINT(createAndroidSurfaceKHR);
 	DE_UNREF(pAllocator);
 	VK_NULL_RETURN((*pSurface = allocateNonDispHandle<SurfaceKHR, VkSurfaceKHR>(instance, pCreateInfo, pAllocator)));
 }
 
 VKAPI_ATTR VkResult VKAPI_CALL createWin32SurfaceKHR (VkInstance instance, const VkWin32SurfaceCreateInfoKHR* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkSurfaceKHR* pSurface)
 {
+	VK_NULL_PROFILE_ENTRY_POINT(createWin32SurfaceKHR);
 	DE_UNREF(pAllocator);
 	VK_NULL_RETURN((*pSurface = allocateNonDispHandle<SurfaceKHR, VkSurfaceKHR>(instance, pCreateInfo, pAllocator)));
 }
 
 VKAPI_ATTR VkResult VKAPI_CALL createRenderPass2KHR (VkDevice device, const VkRenderPassCreateInfo2KHR* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkRenderPass* pRenderPass)
 {
+	VK_NULL_PROFILE_ENTRY_POINT(createRenderPass2KHR);
 	DE_UNREF(pAllocator);
 	VK_NULL_RETURN((*pRenderPass = allocateNonDispHandle<RenderPass, VkRenderPass>(device, pCreateInfo, pAllocator)));
 }
 
 VKAPI_ATTR VkResult VKAPI_CALL createDebugReportCallbackEXT (VkInstance instance, const VkDebugReportCallbackCreateInfoEXT* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkDebugReportCallbackEXT* pCallback)
 {
+	VK_NULL_PROFILE_ENTRY_POINT(createDebugReportCallbackEXT);
 	DE_UNREF(pAllocator);
 	VK_NULL_RETURN((*pCallback = allocateNonDispHandle<DebugReportCallbackEXT, VkDebugReportCallbackEXT>(instance, pCreateInfo, pAllocator)));
 }
 
 VKAPI_ATTR VkResult VKAPI_CALL createViSurfaceNN (VkInstance instance, const VkViSurfaceCreateInfoNN* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkSurfaceKHR* pSurface)
 {
+	VK_NULL_PROFILE_ENTRY_POINT(createViSurfaceNN);
 	DE_UNREF(pAllocator);
 	VK_NULL_RETURN((*pSurface = allocateNonDispHandle<SurfaceKHR, VkSurfaceKHR>(instance, pCreateInfo, pAllocator)));
 }
 
 VKAPI_ATTR VkResult VKAPI_CALL createIndirectCommandsLayoutNVX (VkDevice device, const VkIndirectCommandsLayoutCreateInfoNVX* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkIndirectCommandsLayoutNVX* pIndirectCommandsLayout)
 {
+	VK_NULL_PROFILE_ENTRY_POINT(createIndirectCommandsLayoutNVX);
 	DE_UNREF(pAllocator);
 	VK_NULL_RETURN((*pIndirectCommandsLayout = allocateNonDispHandle<IndirectCommandsLayoutNVX, VkIndirectCommandsLayoutNVX>(device, pCreateInfo, pAllocator)));
 }
 
 VKAPI_ATTR VkResult VKAPI_CALL createObjectTableNVX (VkDevice device, const VkObjectTableCreateInfoNVX* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkObjectTableNVX* pObjectTable)
 {
+	VK_NULL_PROFILE_ENTRY_POINT(createObjectTableNVX);
 	DE_UNREF(pAllocator);
 	VK_NULL_RETURN((*pObjectTable = allocateNonDispHandle<ObjectTableNVX, VkObjectTableNVX>(device, pCreateInfo, pAllocator)));
 }
 
 VKAPI_ATTR VkResult VKAPI_CALL createIOSSurfaceMVK (VkInstance instance, const VkIOSSurfaceCreateInfoMVK* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkSurfaceKHR* pSurface)
 {
+	VK_NULL_PROFILE_ENTRY_POINT(createIOSSurfaceMVK);
 	DE_UNREF(pAllocator);
 	VK_NULL_RETURN((*pSurface = allocateNonDispHandle<SurfaceKHR, VkSurfaceKHR>(instance, pCreateInfo, pAllocator)));
 }
 
 VKAPI_ATTR VkResult VKAPI_CALL createMacOSSurfaceMVK (VkInstance instance, const VkMacOSSurfaceCreateInfoMVK* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkSurfaceKHR* pSurface)
 {
+	VK_NULL_PROFILE_ENTRY_POINT(createMacOSSurfaceMVK);
 	DE_UNREF(pAllocator);
 	VK_NULL_RETURN((*pSurface = allocateNonDispHandle<SurfaceKHR, VkSurfaceKHR>(instance, pCreateInfo, pAllocator)));
 }
 
 VKAPI_ATTR VkResult VKAPI_CALL createValidationCacheEXT (VkDevice device, const VkValidationCacheCreateInfoEXT* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkValidationCacheEXT* pValidationCache)
 {
+	VK_NULL_PROFILE_ENTRY_POINT(createValidationCacheEXT);
 	DE_UNREF(pAllocator);
 	VK_NULL_RETURN((*pValidationCache = allocateNonDispHandle<ValidationCacheEXT, VkValidationCacheEXT>(device, pCreateInfo, pAllocator)));
 }
 
 VKAPI_ATTR void VKAPI_CALL destroyInstance (VkInstance instance, const VkAllocationCallbacks* pAllocator)
 {
+	VK_NULL_PROFILE_ENTRY_POINT(destroyInstance);
 	freeHandle<Instance, VkInstance>(instance, pAllocator);
 }
 
 VKAPI_ATTR void VKAPI_CALL destroyDevice (VkDevice device, const VkAllocationCallbacks* pAllocator)
 {
+	VK_NULL_PROFILE_ENTRY_POINT(destroyDevice);
 	freeHandle<Device, VkDevice>(device, pAllocator);
 }
 
 VKAPI_ATTR void VKAPI_CALL freeMemory (VkDevice device, VkDeviceMemory memory, const VkAllocationCallbacks* pAllocator)
 {
+	VK_NULL_PROFILE_ENTRY_POINT(freeMemory);
 	DE_UNREF(device);
 	freeNonDispHandle<DeviceMemory, VkDeviceMemory>(memory, pAllocator);
 }
 
 VKAPI_ATTR void VKAPI_CALL destroyFence (VkDevice device, VkFence fence, const VkAllocationCallbacks* pAllocator)
 {
+	VK_NULL_PROFILE_ENTRY_POINT(destroyFence);
 	DE_UNREF(device);
 	freeNonDispHandle<Fence, VkFence>(fence, pAllocator);
 }
 
 VKAPI_ATTR void VKAPI_CALL destroySemaphore (VkDevice device, VkSemaphore semaphore, const VkAllocationCallbacks* pAllocator)
 {
+	VK_NULL_PROFILE_ENTRY_POINT(destroySemaphore);
 	DE_UNREF(device);
 	freeNonDispHandle<Semaphore, VkSemaphore>(semaphore, pAllocator);
 }
 
 VKAPI_ATTR void VKAPI_CALL destroyEvent (VkDevice device, VkEvent event, const VkAllocationCallbacks* pAllocator)
 {
+	VK_NULL_PROFILE_ENTRY_POINT(destroyEvent);
 	DE_UNREF(device);
 	freeNonDispHandle<Event, VkEvent>(event, pAllocator);
 }
 
 VKAPI_ATTR void VKAPI_CALL destroyQueryPool (VkDevice device, VkQueryPool queryPool, const VkAllocationCallbacks* pAllocator)
 {
+	VK_NULL_PROFILE_ENTRY_POINT(destroyQueryPool);
 	DE_UNREF(device);
 	freeNonDispHandle<QueryPool, VkQueryPool>(queryPool, pAllocator);
 }
 
 VKAPI_ATTR void VKAPI_CALL destroyBuffer (VkDevice device, VkBuffer buffer, const VkAllocationCallbacks* pAllocator)
 {
+	VK_NULL_PROFILE_ENTRY_POINT(destroyBuffer);
 	DE_UNREF(device);
 	freeNonDispHandle<Buffer, VkBuffer>(buffer, pAllocator);
 }
 
 VKAPI_ATTR void VKAPI_CALL destroyBufferView (VkDevice device, VkBufferView bufferView, const VkAllocationCallbacks* pAllocator)
 {
+	VK_NULL_PROFILE_ENTRY_POINT(destroyBufferView);
 	DE_UNREF(device);
 	freeNonDispHandle<BufferView, VkBufferView>(bufferView, pAllocator);
 }
 
 VKAPI_ATTR void VKAPI_CALL destroyImage (VkDevice device, VkImage image, const VkAllocationCallbacks* pAllocator)
 {
+	VK_NULL_PROFILE_ENTRY_POINT(destroyImage);
 	DE_UNREF(device);
 	freeNonDispHandle<Image, VkImage>(image, pAllocator);
 }
 
 VKAPI_ATTR void VKAPI_CALL destroyImageView (VkDevice device, VkImageView imageView, const VkAllocationCallbacks* pAllocator)
 {
+	VK_NULL_PROFILE_ENTRY_POINT(destroyImageView);
 	DE_UNREF(device);
 	freeNonDispHandle<ImageView, VkImageView>(imageView, pAllocator);
 }
 
 VKAPI_ATTR void VKAPI_CALL destroyShaderModule (VkDevice device, VkShaderModule shaderModule, const VkAllocationCallbacks* pAllocator)
 {
+	VK_NULL_PROFILE_ENTRY_POINT(destroyShaderModule);
 	DE_UNREF(device);
 	freeNonDispHandle<ShaderModule, VkShaderModule>(shaderModule, pAllocator);
 }
 
 VKAPI_ATTR void VKAPI_CALL destroyPipelineCache (VkDevice device, VkPipelineCache pipelineCache, const VkAllocationCallbacks* pAllocator)
 {
+	VK_NULL_PROFILE_ENTRY_POINT(destroyPipelineCache);
 	DE_UNREF(device);
 	freeNonDispHandle<PipelineCache, VkPipelineCache>(pipelineCache, pAllocator);
 }
 
 VKAPI_ATTR void VKAPI_CALL destroyPipeline (VkDevice device, VkPipeline pipeline, const VkAllocationCallbacks* pAllocator)
 {
+	VK_NULL_PROFILE_ENTRY_POINT(destroyPipeline);
 	DE_UNREF(device);
 	freeNonDispHandle<Pipeline, VkPipeline>(pipeline, pAllocator);
 }
 
 VKAPI_ATTR void VKAPI_CALL destroyPipelineLayout (VkDevice device, VkPipelineLayout pipelineLayout, const VkAllocationCallbacks* pAllocator)
 {
+	VK_NULL_PROFILE_ENTRY_POINT(destroyPipelineLayout);
 	DE_UNREF(device);
 	freeNonDispHandle<PipelineLayout, VkPipelineLayout>(pipelineLayout, pAllocator);
 }
 
 VKAPI_ATTR void VKAPI_CALL destroySampler (VkDevice device, VkSampler sampler, const VkAllocationCallbacks* pAllocator)
 {
+	VK_NULL_PROFILE_ENTRY_POINT(destroySampler);
 	DE_UNREF(device);
 	freeNonDispHandle<Sampler, VkSampler>(sampler, pAllocator);
 }
 
 VKAPI_ATTR void VKAPI_CALL destroyDescriptorSetLayout (VkDevice device, VkDescriptorSetLayout descriptorSetLayout, const VkAllocationCallbacks* pAllocator)
 {
+	VK_NULL_PROFILE_ENTRY_POINT(destroyDescriptorSetLayout);
 	DE_UNREF(device);
 	freeNonDispHandle<DescriptorSetLayout, VkDescriptorSetLayout>(descriptorSetLayout, pAllocator);
 }
 
 VKAPI_ATTR void VKAPI_CALL destroyDescriptorPool (VkDevice device, VkDescriptorPool descriptorPool, const VkAllocationCallbacks* pAllocator)
 {
+	VK_NULL_PROFILE_ENTRY_POINT(destroyDescriptorPool);
 	DE_UNREF(device);
 	freeNonDispHandle<DescriptorPool, VkDescriptorPool>(descriptorPool, pAllocator);
 }
 
 VKAPI_ATTR void VKAPI_CALL destroyFramebuffer (VkDevice device, VkFramebuffer framebuffer, const VkAllocationCallbacks* pAllocator)
 {
+	VK_NULL_PROFILE_ENTRY_POINT(destroyFramebuffer);
 	DE_UNREF(device);
 	freeNonDispHandle<Framebuffer, VkFramebuffer>(framebuffer, pAllocator);
 }
 
 VKAPI_ATTR void VKAPI_CALL destroyRenderPass (VkDevice device, VkRenderPass renderPass, const VkAllocationCallbacks* pAllocator)
 {
+	VK_NULL_PROFILE_ENTRY_POINT(destroyRenderPass);
 	DE_UNREF(device);
 	freeNonDispHandle<RenderPass, VkRenderPass>(renderPass, pAllocator);
 }
 
 VKAPI_ATTR void VKAPI_CALL destroyCommandPool (VkDevice device, VkCommandPool commandPool, const VkAllocationCallbacks* pAllocator)
 {
+	VK_NULL_PROFILE_ENTRY_POINT(destroyCommandPool);
 	DE_UNREF(device);
 	freeNonDispHandle<CommandPool, VkCommandPool>(commandPool, pAllocator);
 }
 
 VKAPI_ATTR void VKAPI_CALL destroySamplerYcbcrConversion (VkDevice device, VkSamplerYcbcrConversion ycbcrConversion, const VkAllocationCallbacks* pAllocator)
 {
+	VK_NULL_PROFILE_ENTRY_POINT(destroySamplerYcbcrConversion);
 	DE_UNREF(device);
 	freeNonDispHandle<SamplerYcbcrConversion, VkSamplerYcbcrConversion>(ycbcrConversion, pAllocator);
 }
 
 VKAPI_ATTR void VKAPI_CALL destroyDescriptorUpdateTemplate (VkDevice device, VkDescriptorUpdateTemplate descriptorUpdateTemplate, const VkAllocationCallbacks* pAllocator)
 {
+	VK_NULL_PROFILE_ENTRY_POINT(destroyDescriptorUpdateTemplate);
 	DE_UNREF(device);
 	freeNonDispHandle<DescriptorUpdateTemplate, VkDescriptorUpdateTemplate>(descriptorUpdateTemplate, pAllocator);
 }
 
 VKAPI_ATTR void VKAPI_CALL destroySurfaceKHR (VkInstance instance, VkSurfaceKHR surface, const VkAllocationCallbacks* pAllocator)
 {
+	VK_NULL_PROFILE_ENTRY_POINT(destroySurfaceKHR);
 	DE_UNREF(instance);
 	freeNonDispHandle<SurfaceKHR, VkSurfaceKHR>(surface, pAllocator);
 }
 
 VKAPI_ATTR void VKAPI_CALL destroySwapchainKHR (VkDevice device, VkSwapchainKHR swapchain, const VkAllocationCallbacks* pAllocator)
 {
+	VK_NULL_PROFILE_ENTRY_POINT(destroySwapchainKHR);
 	DE_UNREF(device);
 	freeNonDispHandle<SwapchainKHR, VkSwapchainKHR>(swapchain, pAllocator);
 }
 
 VKAPI_ATTR void VKAPI_CALL destroyDebugReportCallbackEXT (VkInstance instance, VkDebugReportCallbackEXT callback, const VkAllocationCallbacks* pAllocator)
 {
+	VK_NULL_PROFILE_ENTRY_POINT(destroyDebugReportCallbackEXT);
 	DE_UNREF(instance);
 	freeNonDispHandle<DebugReportCallbackEXT, VkDebugReportCallbackEXT>(callback, pAllocator);
 }
 
 VKAPI_ATTR void VKAPI_CALL destroyIndirectCommandsLayoutNVX (VkDevice device, VkIndirectCommandsLayoutNVX indirectCommandsLayout, const VkAllocationCallbacks* pAllocator)
 {
+	VK_NULL_PROFILE_ENTRY_POINT(destroyIndirectCommandsLayoutNVX);
 	DE_UNREF(device);
 	freeNonDispHandle<IndirectCommandsLayoutNVX, VkIndirectCommandsLayoutNVX>(indirectCommandsLayout, pAllocator);
 }
 
 VKAPI_ATTR void VKAPI_CALL destroyObjectTableNVX (VkDevice device, VkObjectTableNVX objectTable, const VkAllocationCallbacks* pAllocator)
 {
+	VK_NULL_PROFILE_ENTRY_POINT(destroyObjectTableNVX);
 	DE_UNREF(device);
 	freeNonDispHandle<ObjectTableNVX, VkObjectTableNVX>(objectTable, pAllocator);
 }
 
 VKAPI_ATTR void VKAPI_CALL destroyValidationCacheEXT (VkDevice device, VkValidationCacheEXT validationCache, const VkAllocationCallbacks* pAllocator)
 {
+	VK_NULL_PROFILE_ENTRY_POINT(destroyValidationCacheEXT);
 	DE_UNREF(device);
 	freeNonDispHandle<ValidationCacheEXT, VkValidationCacheEXT>(validationCache, pAllocator);
 }
 
 VKAPI_ATTR VkResult VKAPI_CALL enumerateInstanceLayerProperties (deUint32* pPropertyCount, VkLayerProperties* pProperties)
 {
+	VK_NULL_PROFILE_ENTRY_POINT(enumerateInstanceLayerProperties);
 	DE_UNREF(pPropertyCount);
 	DE_UNREF(pProperties);
 	return VK_SUCCESS;
@@ -404,6 +471,7 @@ VKAPI_ATTR VkResult VKAPI_CALL enumerateInstanceLayerProperties (deUint32* pProp
 
 VKAPI_ATTR VkResult VKAPI_CALL enumerateDeviceLayerProperties (VkPhysicalDevice physicalDevice, deUint32* pPropertyCount, VkLayerProperties* pProperties)
 {
+	VK_NULL_PROFILE_ENTRY_POINT(enumerateDeviceLayerProperties);
 	DE_UNREF(physicalDevice);
 	DE_UNREF(pPropertyCount);
 	DE_UNREF(pProperties);
@@ -412,6 +480,7 @@ VKAPI_ATTR VkResult VKAPI_CALL enumerateDeviceLayerProperties (VkPhysicalDevice
 
 VKAPI_ATTR VkResult VKAPI_CALL queueSubmit (VkQueue queue, deUint32 submitCount, const VkSubmitInfo* pSubmits, VkFence fence)
 {
+	VK_NULL_PROFILE_ENTRY_POINT(queueSubmit);
 	DE_UNREF(queue);
 	DE_UNREF(submitCount);
 	DE_UNREF(pSubmits);
@@ -421,18 +490,21 @@ VKAPI_ATTR VkResult VKAPI_CALL queueSubmit (VkQueue queue, deUint32 submitCount,
 
 VKAPI_ATTR VkResult VKAPI_CALL queueWaitIdle (VkQueue queue)
 {
+	VK_NULL_PROFILE_ENTRY_POINT(queueWaitIdle);
 	DE_UNREF(queue);
 	return VK_SUCCESS;
 }
 
 VKAPI_ATTR VkResult VKAPI_CALL deviceWaitIdle (VkDevice device)
 {
+	VK_NULL_PROFILE_ENTRY_POINT(deviceWaitIdle);
 	DE_UNREF(device);
 	return VK_SUCCESS;
 }
 
 VKAPI_ATTR VkResult VKAPI_CALL flushMappedMemoryRanges (VkDevice device, deUint32 memoryRangeCount, const VkMappedMemoryRange* pMemoryRanges)
 {
+	VK_NULL_PROFILE_ENTRY_POINT(flushMappedMemoryRanges);
 	DE_UNREF(device);
 	DE_UNREF(memoryRangeCount);
 	DE_UNREF(pMemoryRanges);
@@ -441,6 +513,7 @@ VKAPI_ATTR VkResult VKAPI_CALL flushMappedMemoryRanges (VkDevice device, deUint3
 
 VKAPI_ATTR VkResult VKAPI_CALL invalidateMappedMemoryRanges (VkDevice device, deUint32 memoryRangeCount, const VkMappedMemoryRange* pMemoryRanges)
 {
+	VK_NULL_PROFILE_ENTRY_POINT(invalidateMappedMemoryRanges);
 	DE_UNREF(device);
 	DE_UNREF(memoryRangeCount);
 	DE_UNREF(pMemoryRanges);
@@ -449,6 +522,7 @@ VKAPI_ATTR VkResult VKAPI_CALL invalidateMappedMemoryRanges (VkDevice device, de
 
 VKAPI_ATTR void VKAPI_CALL getDeviceMemoryCommitment (VkDevice device, VkDeviceMemory memory, VkDeviceSize* pCommittedMemoryInBytes)
 {
+	VK_NULL_PROFILE_ENTRY_POINT(getDeviceMemoryCommitment);
 	DE_UNREF(device);
 	DE_UNREF(memory);
 	DE_UNREF(pCommittedMemoryInBytes);
@@ -456,6 +530,7 @@ VKAPI_ATTR void VKAPI_CALL getDeviceMemoryCommitment (VkDevice device, VkDeviceM
 
 VKAPI_ATTR VkResult VKAPI_CALL bindBufferMemory (VkDevice device, VkBuffer buffer, VkDeviceMemory memory, VkDeviceSize memoryOffset)
 {
+	VK_NULL_PROFILE_ENTRY_POINT(bindBufferMemory);
 	DE_UNREF(device);
 	DE_UNREF(buffer);
 	DE_UNREF(memory);
@@ -465,6 +540,7 @@ VKAPI_ATTR VkResult VKAPI_CALL bindBufferMemory (VkDevice device, VkBuffer buffe
 
 VKAPI_ATTR VkResult VKAPI_CALL bindImageMemory (VkDevice device, VkImage image, VkDeviceMemory memory, VkDeviceSize memoryOffset)
 {
+	VK_NULL_PROFILE_ENTRY_POINT(bindImageMemory);
 	DE_UNREF(device);
 	DE_UNREF(image);
 	DE_UNREF(memory);
@@ -474,6 +550,7 @@ VKAPI_ATTR VkResult VKAPI_CALL bindImageMemory (VkDevice device, VkImage image,
 
 VKAPI_ATTR void VKAPI_CALL getImageSparseMemoryRequirements (VkDevice device, VkImage image, deUint32* pSparseMemoryRequirementCount, VkSparseImageMemoryRequirements* pSparseMemoryRequirements)
 {
+	VK_NULL_PROFILE_ENTRY_POINT(getImageSparseMemoryRequirements);
 	DE_UNREF(device);
 	DE_UNREF(image);
 	DE_UNREF(pSparseMemoryRequirementCount);
@@ -482,6 +559,7 @@ VKAPI_ATTR void VKAPI_CALL getImageSparseMemoryRequirements (VkDevice device, Vk
 
 VKAPI_ATTR void VKAPI_CALL getPhysicalDeviceSparseImageFormatProperties (VkPhysicalDevice physicalDevice, VkFormat format, VkImageType type, VkSampleCountFlagBits samples, VkImageUsageFlags usage, VkImageTiling tiling, deUint32* pPropertyCount, VkSparseImageFormatProperties* pProperties)
 {
+	VK_NULL_PROFILE_ENTRY_POINT(getPhysicalDeviceSparseImageFormatProperties);
 	DE_UNREF(physicalDevice);
 	DE_UNREF(format);
 	DE_UNREF(type);
@@ -494,6 +572,7 @@ VKAPI_ATTR void VKAPI_CALL getPhysicalDeviceSparseImageFormatProperties (VkPhysi
 
 VKAPI_ATTR VkResult VKAPI_CALL queueBindSparse (VkQueue queue, deUint32 bindInfoCount, const VkBindSparseInfo* pBindInfo, VkFence fence)
 {
+	VK_NULL_PROFILE_ENTRY_POINT(queueBindSparse);
 	DE_UNREF(queue);
 	DE_UNREF(bindInfoCount);
 	DE_UNREF(pBindInfo);
@@ -503,6 +582,7 @@ VKAPI_ATTR VkResult VKAPI_CALL queueBindSparse (VkQueue queue, deUint32 bindInfo
 
 VKAPI_ATTR VkResult VKAPI_CALL resetFences (VkDevice device, deUint32 fenceCount, const VkFence* pFences)
 {
+	VK_NULL_PROFILE_ENTRY_POINT(resetFences);
 	DE_UNREF(device);
 	DE_UNREF(fenceCount);
 	DE_UNREF(pFences);
@@ -511,6 +591,7 @@ VKAPI_ATTR VkResult VKAPI_CALL resetFences (VkDevice device, deUint32 fenceCount
 
 VKAPI_ATTR VkResult VKAPI_CALL getFenceStatus (VkDevice device, VkFence fence)
 {
+	VK_NULL_PROFILE_ENTRY_POINT(getFenceStatus);
 	DE_UNREF(device);
 	DE_UNREF(fence);
 	return VK_SUCCESS;
@@ -518,6 +599,7 @@ VKAPI_ATTR VkResult VKAPI_CALL getFenceStatus (VkDevice device, VkFence fence)
 
 VKAPI_ATTR VkResult VKAPI_CALL waitForFences (VkDevice device, deUint32 fenceCount, const VkFence* pFences, VkBool32 waitAll, deUint64 timeout)
 {
+	VK_NULL_PROFILE_ENTRY_POINT(waitForFences);
 	DE_UNREF(device);
 	DE_UNREF(fenceCount);
 	DE_UNREF(pFences);
@@ -528,6 +610,7 @@ VKAPI_ATTR VkResult VKAPI_CALL waitForFences (VkDevice device, deUint32 fenceCou
 
 VKAPI_ATTR VkResult VKAPI_CALL getEventStatus (VkDevice device, VkEvent event)
 {
+	VK_NULL_PROFILE_ENTRY_POINT(getEventStatus);
 	DE_UNREF(device);
 	DE_UNREF(event);
 	return VK_SUCCESS;
@@ -535,6 +618,7 @@ VKAPI_ATTR VkResult VKAPI_CALL getEventStatus (VkDevice device, VkEvent event)
 
 VKAPI_ATTR VkResult VKAPI_CALL setEvent (VkDevice device, VkEvent event)
 {
+	VK_NULL_PROFILE_ENTRY_POINT(setEvent);
 	DE_UNREF(device);
 	DE_UNREF(event);
 	return VK_SUCCESS;
@@ -542,6 +626,7 @@ VKAPI_ATTR VkResult VKAPI_CALL setEvent (VkDevice device, VkEvent event)
 
 VKAPI_ATTR VkResult VKAPI_CALL resetEvent (VkDevice device, VkEvent event)
 {
+	VK_NULL_PROFILE_ENTRY_POINT(resetEvent);
 	DE_UNREF(device);
 	DE_UNREF(event);
 	return VK_SUCCESS;
@@ -549,6 +634,7 @@ VKAPI_ATTR VkResult VKAPI_CALL resetEvent (VkDevice device, VkEvent event)
 
 VKAPI_ATTR VkResult VKAPI_CALL getQueryPoolResults (VkDevice device, VkQueryPool queryPool, deUint32 firstQuery, deUint32 queryCount, deUintptr dataSize, void* pData, VkDeviceSize stride, VkQueryResultFlags flags)
 {
+	VK_NULL_PROFILE_ENTRY_POINT(getQueryPoolResults);
 	DE_UNREF(device);
 	DE_UNREF(queryPool);
 	DE_UNREF(firstQuery);
@@ -562,32 +648,16 @@ VKAPI_ATTR VkResult VKAPI_CALL getQueryPoolResults (VkDevice device, VkQueryPool
 
 VKAPI_ATTR void VKAPI_CALL getImageSubresourceLayout (VkDevice device, VkImage image, const VkImageSubresource* pSubresource, VkSubresourceLayout* pLayout)
 {
+	VK_NULL_PROFILE_ENTRY_POINT(getImageSubresourceLayout);
 	DE_UNREF(device);
 	DE_UNREF(image);
 	DE_UNREF(pSubresource);
 	DE_UNREF(pLayout);
 }
 
-VKAPI_ATTR VkResult VKAPI_CALL getPipelineCacheData (VkDevice device, VkPipelineCache pipelineCache, deUintptr* pDataSize, void* pData)
-{
-	DE_UNREF(device);
-	DE_UNREF(pipelineCache);
-	DE_UNREF(pDataSize);
-	DE_UNREF(pData);
-	return VK_SUCCESS;
-}
-
-VKAPI_ATTR VkResult VKAPI_CALL mergePipelineCaches (VkDevice device, VkPipelineCache dstCache, deUint32 srcCacheCount, const VkPipelineCache* pSrcCaches)
-{
-	DE_UNREF(device);
-	DE_UNREF(dstCache);
-	DE_UNREF(srcCacheCount);
-	DE_UNREF(pSrcCaches);
-	return VK_SUCCESS;
-}
-
 VKAPI_ATTR void VKAPI_CALL updateDescriptorSets (VkDevice device, deUint32 descriptorWriteCount, const VkWriteDescriptorSet* pDescriptorWrites, deUint32 descriptorCopyCount, const VkCopyDescriptorSet* pDescriptorCopies)
 {
+	VK_NULL_PROFILE_ENTRY_POINT(updateDescriptorSets);
 	DE_UNREF(device);
 	DE_UNREF(descriptorWriteCount);
 	DE_UNREF(pDescriptorWrites);
@@ -597,6 +667,7 @@ VKAPI_ATTR void VKAPI_CALL updateDescriptorSets (VkDevice device, deUint32 descr
 
 VKAPI_ATTR void VKAPI_CALL getRenderAreaGranularity (VkDevice device, VkRenderPass renderPass, VkExtent2D* pGranularity)
 {
+	VK_NULL_PROFILE_ENTRY_POINT(getRenderAreaGranularity);
 	DE_UNREF(device);
 	DE_UNREF(renderPass);
 	DE_UNREF(pGranularity);
@@ -604,6 +675,7 @@ VKAPI_ATTR void VKAPI_CALL getRenderAreaGranularity (VkDevice device, VkRenderPa
 
 VKAPI_ATTR VkResult VKAPI_CALL resetCommandPool (VkDevice device, VkCommandPool commandPool, VkCommandPoolResetFlags flags)
 {
+	VK_NULL_PROFILE_ENTRY_POINT(resetCommandPool);
 	DE_UNREF(device);
 	DE_UNREF(commandPool);
 	DE_UNREF(flags);
@@ -612,6 +684,7 @@ VKAPI_ATTR VkResult VKAPI_CALL resetCommandPool (VkDevice device, VkCommandPool
 
 VKAPI_ATTR VkResult VKAPI_CALL beginCommandBuffer (VkCommandBuffer commandBuffer, const VkCommandBufferBeginInfo* pBeginInfo)
 {
+	VK_NULL_PROFILE_ENTRY_POINT(beginCommandBuffer);
 	DE_UNREF(commandBuffer);
 	DE_UNREF(pBeginInfo);
 	return VK_SUCCESS;
@@ -619,12 +692,14 @@ VKAPI_ATTR VkResult VKAPI_CALL beginCommandBuffer (VkCommandBuffer commandBuffer
 
 VKAPI_ATTR VkResult VKAPI_CALL endCommandBuffer (VkCommandBuffer commandBuffer)
 {
+	VK_NULL_PROFILE_ENTRY_POINT(endCommandBuffer);
 	DE_UNREF(commandBuffer);
 	return VK_SUCCESS;
 }
 
 VKAPI_ATTR VkResult VKAPI_CALL resetCommandBuffer (VkCommandBuffer commandBuffer, VkCommandBufferResetFlags flags)
 {
+	VK_NULL_PROFILE_ENTRY_POINT(resetCommandBuffer);
 	DE_UNREF(commandBuffer);
 	DE_UNREF(flags);
 	return VK_SUCCESS;
@@ -632,6 +707,7 @@ VKAPI_ATTR VkResult VKAPI_CALL resetCommandBuffer (VkCommandBuffer commandBuffer
 
 VKAPI_ATTR void VKAPI_CALL cmdBindPipeline (VkCommandBuffer commandBuffer, VkPipelineBindPoint pipelineBindPoint, VkPipeline pipeline)
 {
+	VK_NULL_PROFILE_ENTRY_POINT(cmdBindPipeline);
 	DE_UNREF(commandBuffer);
 	DE_UNREF(pipelineBindPoint);
 	DE_UNREF(pipeline);
@@ -639,6 +715,7 @@ VKAPI_ATTR void VKAPI_CALL cmdBindPipeline (VkCommandBuffer commandBuffer, VkPip
 
 VKAPI_ATTR void VKAPI_CALL cmdSetViewport (VkCommandBuffer commandBuffer, deUint32 firstViewport, deUint32 viewportCount, const VkViewport* pViewports)
 {
+	VK_NULL_PROFILE_ENTRY_POINT(cmdSetViewport);
 	DE_UNREF(commandBuffer);
 	DE_UNREF(firstViewport);
 	DE_UNREF(viewportCount);
@@ -647,6 +724,7 @@ VKAPI_ATTR void VKAPI_CALL cmdSetViewport (VkCommandBuffer commandBuffer, deUint
 
 VKAPI_ATTR void VKAPI_CALL cmdSetScissor (VkCommandBuffer commandBuffer, deUint32 firstScissor, deUint32 scissorCount, const VkRect2D* pScissors)
 {
+	VK_NULL_PROFILE_ENTRY_POINT(cmdSetScissor);
 	DE_UNREF(commandBuffer);
 	DE_UNREF(firstScissor);
 	DE_UNREF(scissorCount);
@@ -655,12 +733,14 @@ VKAPI_ATTR void VKAPI_CALL cmdSetScissor (VkCommandBuffer commandBuffer, deUint3
 
 VKAPI_ATTR void VKAPI_CALL cmdSetLineWidth (VkCommandBuffer commandBuffer, float lineWidth)
 {
+	VK_NULL_PROFILE_ENTRY_POINT(cmdSetLineWidth);
 	DE_UNREF(commandBuffer);
 	DE_UNREF(lineWidth);
 }
 
 VKAPI_ATTR void VKAPI_CALL cmdSetDepthBias (VkCommandBuffer commandBuffer, float depthBiasConstantFactor, float depthBiasClamp, float depthBiasSlopeFactor)
 {
+	VK_NULL_PROFILE_ENTRY_POINT(cmdSetDepthBias);
 	DE_UNREF(commandBuffer);
 	DE_UNREF(depthBiasConstantFactor);
 	DE_UNREF(depthBiasClamp);
@@ -669,12 +749,14 @@ VKAPI_ATTR void VKAPI_CALL cmdSetDepthBias (VkCommandBuffer commandBuffer, float
 
 VKAPI_ATTR void VKAPI_CALL cmdSetBlendConstants (VkCommandBuffer commandBuffer, const float blendConstants[4])
 {
+	VK_NULL_PROFILE_ENTRY_POINT(cmdSetBlendConstants);
 	DE_UNREF(commandBuffer);
 	DE_UNREF(blendConstants);
 }
 
 VKAPI_ATTR void VKAPI_CALL cmdSetDepthBounds (VkCommandBuffer commandBuffer, float minDepthBounds, float maxDepthBounds)
 {
+	VK_NULL_PROFILE_ENTRY_POINT(cmdSetDepthBounds);
 	DE_UNREF(commandBuffer);
 	DE_UNREF(minDepthBounds);
 	DE_UNREF(maxDepthBounds);
@@ -682,6 +764,7 @@ VKAPI_ATTR void VKAPI_CALL cmdSetDepthBounds (VkCommandBuffer commandBuffer, flo
 
 VKAPI_ATTR void VKAPI_CALL cmdSetStencilCompareMask (VkCommandBuffer commandBuffer, VkStencilFaceFlags faceMask, deUint32 compareMask)
 {
+	VK_NULL_PROFILE_ENTRY_POINT(cmdSetStencilCompareMask);
 	DE_UNREF(commandBuffer);
 	DE_UNREF(faceMask);
 	DE_UNREF(compareMask);
@@ -689,6 +772,7 @@ VKAPI_ATTR void VKAPI_CALL cmdSetStencilCompareMask (VkCommandBuffer commandBuff
 
 VKAPI_ATTR void VKAPI_CALL cmdSetStencilWriteMask (VkCommandBuffer commandBuffer, VkStencilFaceFlags faceMask, deUint32 writeMask)
 {
+	VK_NULL_PROFILE_ENTRY_POINT(cmdSetStencilWriteMask);
 	DE_UNREF(commandBuffer);
 	DE_UNREF(faceMask);
 	DE_UNREF(writeMask);
@@ -696,6 +780,7 @@ VKAPI_ATTR void VKAPI_CALL cmdSetStencilWriteMask (VkCommandBuffer commandBuffer
 
 VKAPI_ATTR void VKAPI_CALL cmdSetStencilReference (VkCommandBuffer commandBuffer, VkStencilFaceFlags faceMask, deUint32 reference)
 {
+	VK_NULL_PROFILE_ENTRY_POINT(cmdSetStencilReference);
 	DE_UNREF(commandBuffer);
 	DE_UNREF(faceMask);
 	DE_UNREF(reference);
@@ -703,6 +788,7 @@ VKAPI_ATTR void VKAPI_CALL cmdSetStencilReference (VkCommandBuffer commandBuffer
 
 VKAPI_ATTR void VKAPI_CALL cmdBindDescriptorSets (VkCommandBuffer commandBuffer, VkPipelineBindPoint pipelineBindPoint, VkPipelineLayout layout, deUint32 firstSet, deUint32 descriptorSetCount, const VkDescriptorSet* pDescriptorSets, deUint32 dynamicOffsetCount, const deUint32* pDynamicOffsets)
 {
+	VK_NULL_PROFILE_ENTRY_POINT(cmdBindDescriptorSets);
 	DE_UNREF(commandBuffer);
 	DE_UNREF(pipelineBindPoint);
 	DE_UNREF(layout);
@@ -715,6 +801,7 @@ VKAPI_ATTR void VKAPI_CALL cmdBindDescriptorSets (VkCommandBuffer commandBuffer,
 
 VKAPI_ATTR void VKAPI_CALL cmdBindIndexBuffer (VkCommandBuffer commandBuffer, VkBuffer buffer, VkDeviceSize offset, VkIndexType indexType)
 {
+	VK_NULL_PROFILE_ENTRY_POINT(cmdBindIndexBuffer);
 	DE_UNREF(commandBuffer);
 	DE_UNREF(buffer);
 	DE_UNREF(offset);
@@ -723,6 +810,7 @@ VKAPI_ATTR void VKAPI_CALL cmdBindIndexBuffer (VkCommandBuffer commandBuffer, Vk
 
 VKAPI_ATTR void VKAPI_CALL cmdBindVertexBuffers (VkCommandBuffer commandBuffer, deUint32 firstBinding, deUint32 bindingCount, const VkBuffer* pBuffers, const VkDeviceSize* pOffsets)
 {
+	VK_NULL_PROFILE_ENTRY_POINT(cmdBindVertexBuffers);
 	DE_UNREF(commandBuffer);
 	DE_UNREF(firstBinding);
 	DE_UNREF(bindingCount);
@@ -732,6 +820,7 @@ VKAPI_ATTR void VKAPI_CALL cmdBindVertexBuffers (VkCommandBuffer commandBuffer,
 
 VKAPI_ATTR void VKAPI_CALL cmdDraw (VkCommandBuffer commandBuffer, deUint32 vertexCount, deUint32 instanceCount, deUint32 firstVertex, deUint32 firstInstance)
 {
+	VK_NULL_PROFILE_ENTRY_POINT(cmdDraw);
 	DE_UNREF(commandBuffer);
 	DE_UNREF(vertexCount);
 	DE_UNREF(instanceCount);
@@ -741,6 +830,7 @@ VKAPI_ATTR void VKAPI_CALL cmdDraw (VkCommandBuffer commandBuffer, deUint32 vert
 
 VKAPI_ATTR void VKAPI_CALL cmdDrawIndexed (VkCommandBuffer commandBuffer, deUint32 indexCount, deUint32 instanceCount, deUint32 firstIndex, deInt32 vertexOffset, deUint32 firstInstance)
 {
+	VK_NULL_PROFILE_ENTRY_POINT(cmdDrawIndexed);
 	DE_UNREF(commandBuffer);
 	DE_UNREF(indexCount);
 	DE_UNREF(instanceCount);
@@ -751,6 +841,7 @@ VKAPI_ATTR void VKAPI_CALL cmdDrawIndexed (VkCommandBuffer commandBuffer, deUint
 
 VKAPI_ATTR void VKAPI_CALL cmdDrawIndirect (VkCommandBuffer commandBuffer, VkBuffer buffer, VkDeviceSize offset, deUint32 drawCount, deUint32 stride)
 {
+	VK_NULL_PROFILE_ENTRY_POINT(cmdDrawIndirect);
 	DE_UNREF(commandBuffer);
 	DE_UNREF(buffer);
 	DE_UNREF(offset);
@@ -760,6 +851,7 @@ VKAPI_ATTR void VKAPI_CALL cmdDrawIndirect (VkCommandBuffer commandBuffer, VkBuf
 
 VKAPI_ATTR void VKAPI_CALL cmdDrawIndexedIndirect (VkCommandBuffer commandBuffer, VkBuffer buffer, VkDeviceSize offset, deUint32 drawCount, deUint32 stride)
 {
+	VK_NULL_PROFILE_ENTRY_POINT(cmdDrawIndexedIndirect);
 	DE_UNREF(commandBuffer);
 	DE_UNREF(buffer);
 	DE_UNREF(offset);
@@ -769,6 +861,7 @@ VKAPI_ATTR void VKAPI_CALL cmdDrawIndexedIndirect (VkCommandBuffer commandBuffer
 
 VKAPI_ATTR void VKAPI_CALL cmdDispatch (VkCommandBuffer commandBuffer, deUint32 groupCountX, deUint32 groupCountY, deUint32 groupCountZ)
 {
+	VK_NULL_PROFILE_ENTRY_POINT(cmdDispatch);
 	DE_UNREF(commandBuffer);
 	DE_UNREF(groupCountX);
 	DE_UNREF(groupCountY);
@@ -777,6 +870,7 @@ VKAPI_ATTR void VKAPI_CALL cmdDispatch (VkCommandBuffer commandBuffer, deUint32
 
 VKAPI_ATTR void VKAPI_CALL cmdDispatchIndirect (VkCommandBuffer commandBuffer, VkBuffer buffer, VkDeviceSize offset)
 {
+	VK_NULL_PROFILE_ENTRY_POINT(cmdDispatchIndirect);
 	DE_UNREF(commandBuffer);
 	DE_UNREF(buffer);
 	DE_UNREF(offset);
@@ -784,6 +878,7 @@ VKAPI_ATTR void VKAPI_CALL cmdDispatchIndirect (VkCommandBuffer commandBuffer, V
 
 VKAPI_ATTR void VKAPI_CALL cmdCopyBuffer (VkCommandBuffer commandBuffer, VkBuffer srcBuffer, VkBuffer dstBuffer, deUint32 regionCount, const VkBufferCopy* pRegions)
 {
+	VK_NULL_PROFILE_ENTRY_POINT(cmdCopyBuffer);
 	DE_UNREF(commandBuffer);
 	DE_UNREF(srcBuffer);
 	DE_UNREF(dstBuffer);
@@ -793,6 +888,7 @@ VKAPI_ATTR void VKAPI_CALL cmdCopyBuffer (VkCommandBuffer commandBuffer, VkBuffe
 
 VKAPI_ATTR void VKAPI_CALL cmdCopyImage (VkCommandBuffer commandBuffer, VkImage srcImage, VkImageLayout srcImageLayout, VkImage dstImage, VkImageLayout dstImageLayout, deUint32 regionCount, const VkImageCopy* pRegions)
 {
+	VK_NULL_PROFILE_ENTRY_POINT(cmdCopyImage);
 	DE_UNREF(commandBuffer);
 	DE_UNREF(srcImage);
 	DE_UNREF(srcImageLayout);
@@ -804,6 +900,7 @@ VKAPI_ATTR void VKAPI_CALL cmdCopyImage (VkCommandBuffer commandBuffer, VkImage
 
 VKAPI_ATTR void VKAPI_CALL cmdBlitImage (VkCommandBuffer commandBuffer, VkImage srcImage, VkImageLayout srcImageLayout, VkImage dstImage, VkImageLayout dstImageLayout, deUint32 regionCount, const VkImageBlit* pRegions, VkFilter filter)
 {
+	VK_NULL_PROFILE_ENTRY_POINT(cmdBlitImage);
 	DE_UNREF(commandBuffer);
 	DE_UNREF(srcImage);
 	DE_UNREF(srcImageLayout);
@@ -816,6 +913,7 @@ VKAPI_ATTR void VKAPI_CALL cmdBlitImage (VkCommandBuffer commandBuffer, VkImage
 
 VKAPI_ATTR void VKAPI_CALL cmdCopyBufferToImage (VkCommandBuffer commandBuffer, VkBuffer srcBuffer, VkImage dstImage, VkImageLayout dstImageLayout, deUint32 regionCount, const VkBufferImageCopy* pRegions)
 {
+	VK_NULL_PROFILE_ENTRY_POINT(cmdCopyBufferToImage);
 	DE_UNREF(commandBuffer);
 	DE_UNREF(srcBuffer);
 	DE_UNREF(dstImage);
@@ -826,6 +924,7 @@ VKAPI_ATTR void VKAPI_CALL cmdCopyBufferToImage (VkCommandBuffer commandBuffer,
 
 VKAPI_ATTR void VKAPI_CALL cmdCopyImageToBuffer (VkCommandBuffer commandBuffer, VkImage srcImage, VkImageLayout srcImageLayout, VkBuffer dstBuffer, deUint32 regionCount, const VkBufferImageCopy* pRegions)
 {
+	VK_NULL_PROFILE_ENTRY_POINT(cmdCopyImageToBuffer);
 	DE_UNREF(commandBuffer);
 	DE_UNREF(srcImage);
 	DE_UNREF(srcImageLayout);
@@ -836,6 +935,7 @@ VKAPI_ATTR void VKAPI_CALL cmdCopyImageToBuffer (VkCommandBuffer commandBuffer,
 
 VKAPI_ATTR void VKAPI_CALL cmdUpdateBuffer (VkCommandBuffer commandBuffer, VkBuffer dstBuffer, VkDeviceSize dstOffset, VkDeviceSize dataSize, const void* pData)
 {
+	VK_NULL_PROFILE_ENTRY_POINT(cmdUpdateBuffer);
 	DE_UNREF(commandBuffer);
 	DE_UNREF(dstBuffer);
 	DE_UNREF(dstOffset);
@@ -845,6 +945,7 @@ VKAPI_ATTR void VKAPI_CALL cmdUpdateBuffer (VkCommandBuffer commandBuffer, VkBuf
 
 VKAPI_ATTR void VKAPI_CALL cmdFillBuffer (VkCommandBuffer commandBuffer, VkBuffer dstBuffer, VkDeviceSize dstOffset, VkDeviceSize size, deUint32 data)
 {
+	VK_NULL_PROFILE_ENTRY_POINT(cmdFillBuffer);
 	DE_UNREF(commandBuffer);
 	DE_UNREF(dstBuffer);
 	DE_UNREF(dstOffset);
@@ -854,6 +955,7 @@ VKAPI_ATTR void VKAPI_CALL cmdFillBuffer (VkCommandBuffer commandBuffer, VkBuffe
 
 VKAPI_ATTR void VKAPI_CALL cmdClearColorImage (VkCommandBuffer commandBuffer, VkImage image, VkImageLayout imageLayout, const VkClearColorValue* pColor, deUint32 rangeCount, const VkImageSubresourceRange* pRanges)
 {
+	VK_NULL_PROFILE_ENTRY_POINT(cmdClearColorImage);
 	DE_UNREF(commandBuffer);
 	DE_UNREF(image);
 	DE_UNREF(imageLayout);
@@ -864,6 +966,7 @@ VKAPI_ATTR void VKAPI_CALL cmdClearColorImage (VkCommandBuffer commandBuffer, Vk
 
 VKAPI_ATTR void VKAPI_CALL cmdClearDepthStencilImage (VkCommandBuffer commandBuffer, VkImage image, VkImageLayout imageLayout, const VkClearDepthStencilValue* pDepthStencil, deUint32 rangeCount, const VkImageSubresourceRange* pRanges)
 {
+	VK_NULL_PROFILE_ENTRY_POINT(cmdClearDepthStencilImage);
 	DE_UNREF(commandBuffer);
 	DE_UNREF(image);
 	DE_UNREF(imageLayout);
@@ -874,6 +977,7 @@ VKAPI_ATTR void VKAPI_CALL cmdClearDepthStencilImage (VkCommandBuffer commandBuf
 
 VKAPI_ATTR void VKAPI_CALL cmdClearAttachments (VkCommandBuffer commandBuffer, deUint32 attachmentCount, const VkClearAttachment* pAttachments, deUint32 rectCount, const VkClearRect* pRects)
 {
+	VK_NULL_PROFILE_ENTRY_POINT(cmdClearAttachments);
 	DE_UNREF(commandBuffer);
 	DE_UNREF(attachmentCount);
 	DE_UNREF(pAttachments);
@@ -883,6 +987,7 @@ VKAPI_ATTR void VKAPI_CALL cmdClearAttachments (VkCommandBuffer commandBuffer, d
 
 VKAPI_ATTR void VKAPI_CALL cmdResolveImage (VkCommandBuffer commandBuffer, VkImage srcImage, VkImageLayout srcImageLayout, VkImage dstImage, VkImageLayout dstImageLayout, deUint32 regionCount, const VkImageResolve* pRegions)
 {
+	VK_NULL_PROFILE_ENTRY_POINT(cmdResolveImage);
 	DE_UNREF(commandBuffer);
 	DE_UNREF(srcImage);
 	DE_UNREF(srcImageLayout);
@@ -894,6 +999,7 @@ VKAPI_ATTR void VKAPI_CALL cmdResolveImage (VkCommandBuffer commandBuffer, VkIma
 
 VKAPI_ATTR void VKAPI_CALL cmdSetEvent (VkCommandBuffer commandBuffer, VkEvent event, VkPipelineStageFlags stageMask)
 {
+	VK_NULL_PROFILE_ENTRY_POINT(cmdSetEvent);
 	DE_UNREF(commandBuffer);
 	DE_UNREF(event);
 	DE_UNREF(stageMask);
@@ -901,6 +1007,7 @@ VKAPI_ATTR void VKAPI_CALL cmdSetEvent (VkCommandBuffer commandBuffer, VkEvent e
 
 VKAPI_ATTR void VKAPI_CALL cmdResetEvent (VkCommandBuffer commandBuffer, VkEvent event, VkPipelineStageFlags stageMask)
 {
+	VK_NULL_PROFILE_ENTRY_POINT(cmdResetEvent);
 	DE_UNREF(commandBuffer);
 	DE_UNREF(event);
 	DE_UNREF(stageMask);
@@ -908,6 +1015,7 @@ VKAPI_ATTR void VKAPI_CALL cmdResetEvent (VkCommandBuffer commandBuffer, VkEvent
 
 VKAPI_ATTR void VKAPI_CALL cmdWaitEvents (VkCommandBuffer commandBuffer, deUint32 eventCount, const VkEvent* pEvents, VkPipelineStageFlags srcStageMask, VkPipelineStageFlags dstStageMask, deUint32 memoryBarrierCount, const VkMemoryBarrier* pMemoryBarriers, deUint32 bufferMemoryBarrierCount, const VkBufferMemoryBarrier* pBufferMemoryBarriers, deUint32 imageMemoryBarrierCount, const VkImageMemoryBarrier* pImageMemoryBarriers)
 {
+	VK_NULL_PROFILE_ENTRY_POINT(cmdWaitEvents);
 	DE_UNREF(commandBuffer);
 	DE_UNREF(eventCount);
 	DE_UNREF(pEvents);
@@ -923,6 +1031,7 @@ VKAPI_ATTR void VKAPI_CALL cmdWaitEvents (VkCommandBuffer commandBuffer, deUint3
 
 VKAPI_ATTR void VKAPI_CALL cmdPipelineBarrier (VkCommandBuffer commandBuffer, VkPipelineStageFlags srcStageMask, VkPipelineStageFlags dstStageMask, VkDependencyFlags dependencyFlags, deUint32 memoryBarrierCount, const VkMemoryBarrier* pMemoryBarriers, deUint32 bufferMemoryBarrierCount, const VkBufferMemoryBarrier* pBufferMemoryBarriers, deUint32 imageMemoryBarrierCount, const VkImageMemoryBarrier* pImageMemoryBarriers)
 {
+	VK_NULL_PROFILE_ENTRY_POINT(cmdPipelineBarrier);
 	DE_UNREF(commandBuffer);
 	DE_UNREF(srcStageMask);
 	DE_UNREF(dstStageMask);
@@ -937,6 +1046,7 @@ VKAPI_ATTR void VKAPI_CALL cmdPipelineBarrier (VkCommandBuffer commandBuffer, Vk
 
 VKAPI_ATTR void VKAPI_CALL cmdBeginQuery (VkCommandBuffer commandBuffer, VkQueryPool queryPool, deUint32 query, VkQueryControlFlags flags)
 {
+	VK_NULL_PROFILE_ENTRY_POINT(cmdBeginQuery);
 	DE_UNREF(commandBuffer);
 	DE_UNREF(queryPool);
 	DE_UNREF(query);
@@ -945,6 +1055,7 @@ VKAPI_ATTR void VKAPI_CALL cmdBeginQuery (VkCommandBuffer commandBuffer, VkQuery
 
 VKAPI_ATTR void VKAPI_CALL cmdEndQuery (VkCommandBuffer commandBuffer, VkQueryPool queryPool, deUint32 query)
 {
+	VK_NULL_PROFILE_ENTRY_POINT(cmdEndQuery);
 	DE_UNREF(commandBuffer);
 	DE_UNREF(queryPool);
 	DE_UNREF(query);
@@ -952,6 +1063,7 @@ VKAPI_ATTR void VKAPI_CALL cmdEndQuery (VkCommandBuffer commandBuffer, VkQueryPo
 
 VKAPI_ATTR void VKAPI_CALL cmdResetQueryPool (VkCommandBuffer commandBuffer, VkQueryPool queryPool, deUint32 firstQuery, deUint32 queryCount)
 {
+	VK_NULL_PROFILE_ENTRY_POINT(cmdResetQueryPool);
 	DE_UNREF(commandBuffer);
 	DE_UNREF(queryPool);
 	DE_UNREF(firstQuery);
@@ -960,6 +1072,7 @@ VKAPI_ATTR void VKAPI_CALL cmdResetQueryPool (VkCommandBuffer commandBuffer, VkQ
 
 VKAPI_ATTR void VKAPI_CALL cmdWriteTimestamp (VkCommandBuffer commandBuffer, VkPipelineStageFlagBits pipelineStage, VkQueryPool queryPool, deUint32 query)
 {
+	VK_NULL_PROFILE_ENTRY_POINT(cmdWriteTimestamp);
 	DE_UNREF(commandBuffer);
 	DE_UNREF(pipelineStage);
 	DE_UNREF(queryPool);
@@ -968,6 +1081,7 @@ VKAPI_ATTR void VKAPI_CALL cmdWriteTimestamp (VkCommandBuffer commandBuffer, VkP
 
 VKAPI_ATTR void VKAPI_CALL cmdCopyQueryPoolResults (VkCommandBuffer commandBuffer, VkQueryPool queryPool, deUint32 firstQuery, deUint32 queryCount, VkBuffer dstBuffer, VkDeviceSize dstOffset, VkDeviceSize stride, VkQueryResultFlags flags)
 {
+	VK_NULL_PROFILE_ENTRY_POINT(cmdCopyQueryPoolResults);
 	DE_UNREF(commandBuffer);
 	DE_UNREF(queryPool);
 	DE_UNREF(firstQuery);
@@ -980,6 +1094,7 @@ VKAPI_ATTR void VKAPI_CALL cmdCopyQueryPoolResults (VkCommandBuffer commandBuffe
 
 VKAPI_ATTR void VKAPI_CALL cmdPushConstants (VkCommandBuffer commandBuffer, VkPipelineLayout layout, VkShaderStageFlags stageFlags, deUint32 offset, deUint32 size, const void* pValues)
 {
+	VK_NULL_PROFILE_ENTRY_POINT(cmdPushConstants);
 	DE_UNREF(commandBuffer);
 	DE_UNREF(layout);
 	DE_UNREF(stageFlags);
@@ -990,6 +1105,7 @@ VKAPI_ATTR void VKAPI_CALL cmdPushConstants (VkCommandBuffer commandBuffer, VkPi
 
 VKAPI_ATTR void VKAPI_CALL cmdBeginRenderPass (VkCommandBuffer commandBuffer, const VkRenderPassBeginInfo* pRenderPassBegin, VkSubpassContents contents)
 {
+	VK_NULL_PROFILE_ENTRY_POINT(cmdBeginRenderPass);
 	DE_UNREF(commandBuffer);
 	DE_UNREF(pRenderPassBegin);
 	DE_UNREF(contents);
@@ -997,17 +1113,20 @@ VKAPI_ATTR void VKAPI_CALL cmdBeginRenderPass (VkCommandBuffer commandBuffer, co
 
 VKAPI_ATTR void VKAPI_CALL cmdNextSubpass (VkCommandBuffer commandBuffer, VkSubpassContents contents)
 {
+	VK_NULL_PROFILE_ENTRY_POINT(cmdNextSubpass);
 	DE_UNREF(commandBuffer);
 	DE_UNREF(contents);
 }
 
 VKAPI_ATTR void VKAPI_CALL cmdEndRenderPass (VkCommandBuffer commandBuffer)
 {
+	VK_NULL_PROFILE_ENTRY_POINT(cmdEndRenderPass);
 	DE_UNREF(commandBuffer);
 }
 
 VKAPI_ATTR void VKAPI_CALL cmdExecuteCommands (VkCommandBuffer commandBuffer, deUint32 commandBufferCount, const VkCommandBuffer* pCommandBuffers)
 {
+	VK_NULL_PROFILE_ENTRY_POINT(cmdExecuteCommands);
 	DE_UNREF(commandBuffer);
 	DE_UNREF(commandBufferCount);
 	DE_UNREF(pCommandBuffers);
@@ -1015,12 +1134,14 @@ VKAPI_ATTR void VKAPI_CALL cmdExecuteCommands (VkCommandBuffer commandBuffer, de
 
 VKAPI_ATTR VkResult VKAPI_CALL enumerateInstanceVersion (deUint32* pApiVersion)
 {
+	VK_NULL_PROFILE_ENTRY_POINT(enumerateInstanceVersion);
 	DE_UNREF(pApiVersion);
 	return VK_SUCCESS;
 }
 
 VKAPI_ATTR VkResult VKAPI_CALL bindBufferMemory2 (VkDevice device, deUint32 bindInfoCount, const VkBindBufferMemoryInfo* pBindInfos)
 {
+	VK_NULL_PROFILE_ENTRY_POINT(bindBufferMemory2);
 	DE_UNREF(device);
 	DE_UNREF(bindInfoCount);
 	DE_UNREF(pBindInfos);
@@ -1029,6 +1150,7 @@ VKAPI_ATTR VkResult VKAPI_CALL bindBufferMemory2 (VkDevice device, deUint32 bind
 
 VKAPI_ATTR VkResult VKAPI_CALL bindImageMemory2 (VkDevice device, deUint32 bindInfoCount, const VkBindImageMemoryInfo* pBindInfos)
 {
+	VK_NULL_PROFILE_ENTRY_POINT(bindImageMemory2);
 	DE_UNREF(device);
 	DE_UNREF(bindInfoCount);
 	DE_UNREF(pBindInfos);
@@ -1037,6 +1159,7 @@ VKAPI_ATTR VkResult VKAPI_CALL bindImageMemory2 (VkDevice device, deUint32 bindI
 
 VKAPI_ATTR void VKAPI_CALL getDeviceGroupPeerMemoryFeatures (VkDevice device, deUint32 heapIndex, deUint32 localDeviceIndex, deUint32 remoteDeviceIndex, VkPeerMemoryFeatureFlags* pPeerMemoryFeatures)
 {
+	VK_NULL_PROFILE_ENTRY_POINT(getDeviceGroupPeerMemoryFeatures);
 	DE_UNREF(device);
 	DE_UNREF(heapIndex);
 	DE_UNREF(localDeviceIndex);
@@ -1046,12 +1169,14 @@ VKAPI_ATTR void VKAPI_CALL getDeviceGroupPeerMemoryFeatures (VkDevice device, de
 
 VKAPI_ATTR void VKAPI_CALL cmdSetDeviceMask (VkCommandBuffer commandBuffer, deUint32 deviceMask)
 {
+	VK_NULL_PROFILE_ENTRY_POINT(cmdSetDeviceMask);
 	DE_UNREF(commandBuffer);
 	DE_UNREF(deviceMask);
 }
 
 VKAPI_ATTR void VKAPI_CALL cmdDispatchBase (VkCommandBuffer commandBuffer, deUint32 baseGroupX, deUint32 baseGroupY, deUint32 baseGroupZ, deUint32 groupCountX, deUint32 groupCountY, deUint32 groupCountZ)
 {
+	VK_NULL_PROFILE_ENTRY_POINT(cmdDispatchBase);
 	DE_UNREF(commandBuffer);
 	DE_UNREF(baseGroupX);
 	DE_UNREF(baseGroupY);
@@ -1063,6 +1188,7 @@ VKAPI_ATTR void VKAPI_CALL cmdDispatchBase (VkCommandBuffer commandBuffer, deUin
 
 VKAPI_ATTR VkResult VKAPI_CALL enumeratePhysicalDeviceGroups (VkInstance instance, deUint32* pPhysicalDeviceGroupCount, VkPhysicalDeviceGroupProperties* pPhysicalDeviceGroupProperties)
 {
+	VK_NULL_PROFILE_ENTRY_POINT(enumeratePhysicalDeviceGroups);
 	DE_UNREF(instance);
 	DE_UNREF(pPhysicalDeviceGroupCount);
 	DE_UNREF(pPhysicalDeviceGroupProperties);
@@ -1071,6 +1197,7 @@ VKAPI_ATTR VkResult VKAPI_CALL enumeratePhysicalDeviceGroups (VkInstance instanc
 
 VKAPI_ATTR void VKAPI_CALL getImageMemoryRequirements2 (VkDevice device, const VkImageMemoryRequirementsInfo2* pInfo, VkMemoryRequirements2* pMemoryRequirements)
 {
+	VK_NULL_PROFILE_ENTRY_POINT(getImageMemoryRequirements2);
 	DE_UNREF(device);
 	DE_UNREF(pInfo);
 	DE_UNREF(pMemoryRequirements);
@@ -1078,6 +1205,7 @@ VKAPI_ATTR void VKAPI_CALL getImageMemoryRequirements2 (VkDevice device, const V
 
 VKAPI_ATTR void VKAPI_CALL getBufferMemoryRequirements2 (VkDevice device, const VkBufferMemoryRequirementsInfo2* pInfo, VkMemoryRequirements2* pMemoryRequirements)
 {
+	VK_NULL_PROFILE_ENTRY_POINT(getBufferMemoryRequirements2);
 	DE_UNREF(device);
 	DE_UNREF(pInfo);
 	DE_UNREF(pMemoryRequirements);
@@ -1085,6 +1213,7 @@ VKAPI_ATTR void VKAPI_CALL getBufferMemoryRequirements2 (VkDevice device, const
 
 VKAPI_ATTR void VKAPI_CALL getImageSparseMemoryRequirements2 (VkDevice device, const VkImageSparseMemoryRequirementsInfo2* pInfo, deUint32* pSparseMemoryRequirementCount, VkSparseImageMemoryRequirements2* pSparseMemoryRequirements)
 {
+	VK_NULL_PROFILE_ENTRY_POINT(getImageSparseMemoryRequirements2);
 	DE_UNREF(device);
 	DE_UNREF(pInfo);
 	DE_UNREF(pSparseMemoryRequirementCount);
@@ -1093,18 +1222,21 @@ VKAPI_ATTR void VKAPI_CALL getImageSparseMemoryRequirements2 (VkDevice device, c
 
 VKAPI_ATTR void VKAPI_CALL getPhysicalDeviceFeatures2 (VkPhysicalDevice physicalDevice, VkPhysicalDeviceFeatures2* pFeatures)
 {
+	VK_NULL_PROFILE_ENTRY_POINT(getPhysicalDeviceFeatures2);
 	DE_UNREF(physicalDevice);
 	DE_UNREF(pFeatures);
 }
 
 VKAPI_ATTR void VKAPI_CALL getPhysicalDeviceProperties2 (VkPhysicalDevice physicalDevice, VkPhysicalDeviceProperties2* pProperties)
 {
+	VK_NULL_PROFILE_ENTRY_POINT(getPhysicalDeviceProperties2);
 	DE_UNREF(physicalDevice);
 	DE_UNREF(pProperties);
 }
 
 VKAPI_ATTR void VKAPI_CALL getPhysicalDeviceFormatProperties2 (VkPhysicalDevice physicalDevice, VkFormat format, VkFormatProperties2* pFormatProperties)
 {
+	VK_NULL_PROFILE_ENTRY_POINT(getPhysicalDeviceFormatProperties2);
 	DE_UNREF(physicalDevice);
 	DE_UNREF(format);
 	DE_UNREF(pFormatProperties);
@@ -1112,6 +1244,7 @@ VKAPI_ATTR void VKAPI_CALL getPhysicalDeviceFormatProperties2 (VkPhysicalDevice
 
 VKAPI_ATTR VkResult VKAPI_CALL getPhysicalDeviceImageFormatProperties2 (VkPhysicalDevice physicalDevice, const VkPhysicalDeviceImageFormatInfo2* pImageFormatInfo, VkImageFormatProperties2* pImageFormatProperties)
 {
+	VK_NULL_PROFILE_ENTRY_POINT(getPhysicalDeviceImageFormatProperties2);
 	DE_UNREF(physicalDevice);
 	DE_UNREF(pImageFormatInfo);
 	DE_UNREF(pImageFormatProperties);
@@ -1120,6 +1253,7 @@ VKAPI_ATTR VkResult VKAPI_CALL getPhysicalDeviceImageFormatProperties2 (VkPhysic
 
 VKAPI_ATTR void VKAPI_CALL getPhysicalDeviceQueueFamilyProperties2 (VkPhysicalDevice physicalDevice, deUint32* pQueueFamilyPropertyCount, VkQueueFamilyProperties2* pQueueFamilyProperties)
 {
+	VK_NULL_PROFILE_ENTRY_POINT(getPhysicalDeviceQueueFamilyProperties2);
 	DE_UNREF(physicalDevice);
 	DE_UNREF(pQueueFamilyPropertyCount);
 	DE_UNREF(pQueueFamilyProperties);
@@ -1127,12 +1261,14 @@ VKAPI_ATTR void VKAPI_CALL getPhysicalDeviceQueueFamilyProperties2 (VkPhysicalDe
 
 VKAPI_ATTR void VKAPI_CALL getPhysicalDeviceMemoryProperties2 (VkPhysicalDevice physicalDevice, VkPhysicalDeviceMemoryProperties2* pMemoryProperties)
 {
+	VK_NULL_PROFILE_ENTRY_POINT(getPhysicalDeviceMemoryProperties2);
 	DE_UNREF(physicalDevice);
 	DE_UNREF(pMemoryProperties);
 }
 
 VKAPI_ATTR void VKAPI_CALL getPhysicalDeviceSparseImageFormatProperties2 (VkPhysicalDevice physicalDevice, const VkPhysicalDeviceSparseImageFormatInfo2* pFormatInfo, deUint32* pPropertyCount, VkSparseImageFormatProperties2* pProperties)
 {
+	VK_NULL_PROFILE_ENTRY_POINT(getPhysicalDeviceSparseImageFormatProperties2);
 	DE_UNREF(physicalDevice);
 	DE_UNREF(pFormatInfo);
 	DE_UNREF(pPropertyCount);
@@ -1141,6 +1277,7 @@ VKAPI_ATTR void VKAPI_CALL getPhysicalDeviceSparseImageFormatProperties2 (VkPhys
 
 VKAPI_ATTR void VKAPI_CALL trimCommandPool (VkDevice device, VkCommandPool commandPool, VkCommandPoolTrimFlags flags)
 {
+	VK_NULL_PROFILE_ENTRY_POINT(trimCommandPool);
 	DE_UNREF(device);
 	DE_UNREF(commandPool);
 	DE_UNREF(flags);
@@ -1148,6 +1285,7 @@ VKAPI_ATTR void VKAPI_CALL trimCommandPool (VkDevice device, VkCommandPool comma
 
 VKAPI_ATTR void VKAPI_CALL getDeviceQueue2 (VkDevice device, const VkDeviceQueueInfo2* pQueueInfo, VkQueue* pQueue)
 {
+	VK_NULL_PROFILE_ENTRY_POINT(getDeviceQueue2);
 	DE_UNREF(device);
 	DE_UNREF(pQueueInfo);
 	DE_UNREF(pQueue);
@@ -1155,6 +1293,7 @@ VKAPI_ATTR void VKAPI_CALL getDeviceQueue2 (VkDevice device, const VkDeviceQueue
 
 VKAPI_ATTR void VKAPI_CALL updateDescriptorSetWithTemplate (VkDevice device, VkDescriptorSet descriptorSet, VkDescriptorUpdateTemplate descriptorUpdateTemplate, const void* pData)
 {
+	VK_NULL_PROFILE_ENTRY_POINT(updateDescriptorSetWithTemplate);
 	DE_UNREF(device);
 	DE_UNREF(descriptorSet);
 	DE_UNREF(descriptorUpdateTemplate);
@@ -1163,6 +1302,7 @@ VKAPI_ATTR void VKAPI_CALL updateDescriptorSetWithTemplate (VkDevice device, VkD
 
 VKAPI_ATTR void VKAPI_CALL getPhysicalDeviceExternalBufferProperties (VkPhysicalDevice physicalDevice, const VkPhysicalDeviceExternalBufferInfo* pExternalBufferInfo, VkExternalBufferProperties* pExternalBufferProperties)
 {
+	VK_NULL_PROFILE_ENTRY_POINT(getPhysicalDeviceExternalBufferProperties);
 	DE_UNREF(physicalDevice);
 	DE_UNREF(pExternalBufferInfo);
 	DE_UNREF(pExternalBufferProperties);
@@ -1170,6 +1310,7 @@ VKAPI_ATTR void VKAPI_CALL getPhysicalDeviceExternalBufferProperties (VkPhysical
 
 VKAPI_ATTR void VKAPI_CALL getPhysicalDeviceExternalFenceProperties (VkPhysicalDevice physicalDevice, const VkPhysicalDeviceExternalFenceInfo* pExternalFenceInfo, VkExternalFenceProperties* pExternalFenceProperties)
 {
+	VK_NULL_PROFILE_ENTRY_POINT(getPhysicalDeviceExternalFenceProperties);
 	DE_UNREF(physicalDevice);
 	DE_UNREF(pExternalFenceInfo);
 	DE_UNREF(pExternalFenceProperties);
@@ -1177,6 +1318,7 @@ VKAPI_ATTR void VKAPI_CALL getPhysicalDeviceExternalFenceProperties (VkPhysicalD
 
 VKAPI_ATTR void VKAPI_CALL getPhysicalDeviceExternalSemaphoreProperties (VkPhysicalDevice physicalDevice, const VkPhysicalDeviceExternalSemaphoreInfo* pExternalSemaphoreInfo, VkExternalSemaphoreProperties* pExternalSemaphoreProperties)
 {
+	VK_NULL_PROFILE_ENTRY_POINT(getPhysicalDeviceExternalSemaphoreProperties);
 	DE_UNREF(physicalDevice);
 	DE_UNREF(pExternalSemaphoreInfo);
 	DE_UNREF(pExternalSemaphoreProperties);
@@ -1184,6 +1326,7 @@ VKAPI_ATTR void VKAPI_CALL getPhysicalDeviceExternalSemaphoreProperties (VkPhysi
 
 VKAPI_ATTR void VKAPI_CALL getDescriptorSetLayoutSupport (VkDevice device, const VkDescriptorSetLayoutCreateInfo* pCreateInfo, VkDescriptorSetLayoutSupport* pSupport)
 {
+	VK_NULL_PROFILE_ENTRY_POINT(getDescriptorSetLayoutSupport);
 	DE_UNREF(device);
 	DE_UNREF(pCreateInfo);
 	DE_UNREF(pSupport);
@@ -1191,6 +1334,7 @@ VKAPI_ATTR void VKAPI_CALL getDescriptorSetLayoutSupport (VkDevice device, const
 
 VKAPI_ATTR VkResult VKAPI_CALL getPhysicalDeviceSurfaceSupportKHR (VkPhysicalDevice physicalDevice, deUint32 queueFamilyIndex, VkSurfaceKHR surface, VkBool32* pSupported)
 {
+	VK_NULL_PROFILE_ENTRY_POINT(getPhysicalDeviceSurfaceSupportKHR);
 	DE_UNREF(physicalDevice);
 	DE_UNREF(queueFamilyIndex);
 	DE_UNREF(surface);
@@ -1200,6 +1344,7 @@ VKAPI_ATTR VkResult VKAPI_CALL getPhysicalDeviceSurfaceSupportKHR (VkPhysicalDev
 
 VKAPI_ATTR VkResult VKAPI_CALL getPhysicalDeviceSurfaceCapabilitiesKHR (VkPhysicalDevice physicalDevice, VkSurfaceKHR surface, VkSurfaceCapabilitiesKHR* pSurfaceCapabilities)
 {
+	VK_NULL_PROFILE_ENTRY_POINT(getPhysicalDeviceSurfaceCapabilitiesKHR);
 	DE_UNREF(physicalDevice);
 	DE_UNREF(surface);
 	DE_UNREF(pSurfaceCapabilities);
@@ -1208,6 +1353,7 @@ VKAPI_ATTR VkResult VKAPI_CALL getPhysicalDeviceSurfaceCapabilitiesKHR (VkPhysic
 
 VKAPI_ATTR VkResult VKAPI_CALL getPhysicalDeviceSurfaceFormatsKHR (VkPhysicalDevice physicalDevice, VkSurfaceKHR surface, deUint32* pSurfaceFormatCount, VkSurfaceFormatKHR* pSurfaceFormats)
 {
+	VK_NULL_PROFILE_ENTRY_POINT(getPhysicalDeviceSurfaceFormatsKHR);
 	DE_UNREF(physicalDevice);
 	DE_UNREF(surface);
 	DE_UNREF(pSurfaceFormatCount);
@@ -1217,6 +1363,7 @@ VKAPI_ATTR VkResult VKAPI_CALL getPhysicalDeviceSurfaceFormatsKHR (VkPhysicalDev
 
 VKAPI_ATTR VkResult VKAPI_CALL getPhysicalDeviceSurfacePresentModesKHR (VkPhysicalDevice physicalDevice, VkSurfaceKHR surface, deUint32* pPresentModeCount, VkPresentModeKHR* pPresentModes)
 {
+	VK_NULL_PROFILE_ENTRY_POINT(getPhysicalDeviceSurfacePresentModesKHR);
 	DE_UNREF(physicalDevice);
 	DE_UNREF(surface);
 	DE_UNREF(pPresentModeCount);
@@ -1226,6 +1373,7 @@ VKAPI_ATTR VkResult VKAPI_CALL getPhysicalDeviceSurfacePresentModesKHR (VkPhysic
 
 VKAPI_ATTR VkResult VKAPI_CALL getSwapchainImagesKHR (VkDevice device, VkSwapchainKHR swapchain, deUint32* pSwapchainImageCount, VkImage* pSwapchainImages)
 {
+	VK_NULL_PROFILE_ENTRY_POINT(getSwapchainImagesKHR);
 	DE_UNREF(device);
 	DE_UNREF(swapchain);
 	DE_UNREF(pSwapchainImageCount);
@@ -1235,6 +1383,7 @@ VKAPI_ATTR VkResult VKAPI_CALL getSwapchainImagesKHR (VkDevice device, VkSwapcha
 
 VKAPI_ATTR VkResult VKAPI_CALL acquireNextImageKHR (VkDevice device, VkSwapchainKHR swapchain, deUint64 timeout, VkSemaphore semaphore, VkFence fence, deUint32* pImageIndex)
 {
+	VK_NULL_PROFILE_ENTRY_POINT(acquireNextImageKHR);
 	DE_UNREF(device);
 	DE_UNREF(swapchain);
 	DE_UNREF(timeout);
@@ -1246,6 +1395,7 @@ VKAPI_ATTR VkResult VKAPI_CALL acquireNextImageKHR (VkDevice device, VkSwapchain
 
 VKAPI_ATTR VkResult VKAPI_CALL queuePresentKHR (VkQueue queue, const VkPresentInfoKHR* pPresentInfo)
 {
+	VK_NULL_PROFILE_ENTRY_POINT(queuePresentKHR);
 	DE_UNREF(queue);
 	DE_UNREF(pPresentInfo);
 	return VK_SUCCESS;
@@ -1253,6 +1403,7 @@ VKAPI_ATTR VkResult VKAPI_CALL queuePresentKHR (VkQueue queue, const VkPresentIn
 
 VKAPI_ATTR VkResult VKAPI_CALL getDeviceGroupPresentCapabilitiesKHR (VkDevice device, VkDeviceGroupPresentCapabilitiesKHR* pDeviceGroupPresentCapabilities)
 {
+	VK_NULL_PROFILE_ENTRY_POINT(getDeviceGroupPresentCapabilitiesKHR);
 	DE_UNREF(device);
 	DE_UNREF(pDeviceGroupPresentCapabilities);
 	return VK_SUCCESS;
@@ -1260,6 +1411,7 @@ VKAPI_ATTR VkResult VKAPI_CALL getDeviceGroupPresentCapabilitiesKHR (VkDevice de
 
 VKAPI_ATTR VkResult VKAPI_CALL getDeviceGroupSurfacePresentModesKHR (VkDevice device, VkSurfaceKHR surface, VkDeviceGroupPresentModeFlagsKHR* pModes)
 {
+	VK_NULL_PROFILE_ENTRY_POINT(getDeviceGroupSurfacePresentModesKHR);
 	DE_UNREF(device);
 	DE_UNREF(surface);
 	DE_UNREF(pModes);
@@ -1268,6 +1420,7 @@ VKAPI_ATTR VkResult VKAPI_CALL getDeviceGroupSurfacePresentModesKHR (VkDevice de
 
 VKAPI_ATTR VkResult VKAPI_CALL getPhysicalDevicePresentRectanglesKHR (VkPhysicalDevice physicalDevice, VkSurfaceKHR surface, deUint32* pRectCount, VkRect2D* pRects)
 {
+	VK_NULL_PROFILE_ENTRY_POINT(getPhysicalDevicePresentRectanglesKHR);
 	DE_UNREF(physicalDevice);
 	DE_UNREF(surface);
 	DE_UNREF(pRectCount);
@@ -1277,6 +1430,7 @@ VKAPI_ATTR VkResult VKAPI_CALL getPhysicalDevicePresentRectanglesKHR (VkPhysical
 
 VKAPI_ATTR VkResult VKAPI_CALL acquireNextImage2KHR (VkDevice device, const VkAcquireNextImageInfoKHR* pAcquireInfo, deUint32* pImageIndex)
 {
+	VK_NULL_PROFILE_ENTRY_POINT(acquireNextImage2KHR);
 	DE_UNREF(device);
 	DE_UNREF(pAcquireInfo);
 	DE_UNREF(pImageIndex);
@@ -1285,6 +1439,7 @@ VKAPI_ATTR VkResult VKAPI_CALL acquireNextImage2KHR (VkDevice device, const VkAc
 
 VKAPI_ATTR VkResult VKAPI_CALL getPhysicalDeviceDisplayPropertiesKHR (VkPhysicalDevice physicalDevice, deUint32* pPropertyCount, VkDisplayPropertiesKHR* pProperties)
 {
+	VK_NULL_PROFILE_ENTRY_POINT(getPhysicalDeviceDisplayPropertiesKHR);
 	DE_UNREF(physicalDevice);
 	DE_UNREF(pPropertyCount);
 	DE_UNREF(pProperties);
@@ -1293,6 +1448,7 @@ VKAPI_ATTR VkResult VKAPI_CALL getPhysicalDeviceDisplayPropertiesKHR (VkPhysical
 
 VKAPI_ATTR VkResult VKAPI_CALL getPhysicalDeviceDisplayPlanePropertiesKHR (VkPhysicalDevice physicalDevice, deUint32* pPropertyCount, VkDisplayPlanePropertiesKHR* pProperties)
 {
+	VK_NULL_PROFILE_ENTRY_POINT(getPhysicalDeviceDisplayPlanePropertiesKHR);
 	DE_UNREF(physicalDevice);
 	DE_UNREF(pPropertyCount);
 	DE_UNREF(pProperties);
@@ -1301,6 +1457,7 @@ VKAPI_ATTR VkResult VKAPI_CALL getPhysicalDeviceDisplayPlanePropertiesKHR (VkPhy
 
 VKAPI_ATTR VkResult VKAPI_CALL getDisplayPlaneSupportedDisplaysKHR (VkPhysicalDevice physicalDevice, deUint32 planeIndex, deUint32* pDisplayCount, VkDisplayKHR* pDisplays)
 {
+	VK_NULL_PROFILE_ENTRY_POINT(getDisplayPlaneSupportedDisplaysKHR);
 	DE_UNREF(physicalDevice);
 	DE_UNREF(planeIndex);
 	DE_UNREF(pDisplayCount);
@@ -1310,6 +1467,7 @@ VKAPI_ATTR VkResult VKAPI_CALL getDisplayPlaneSupportedDisplaysKHR (VkPhysicalDe
 
 VKAPI_ATTR VkResult VKAPI_CALL getDisplayModePropertiesKHR (VkPhysicalDevice physicalDevice, VkDisplayKHR display, deUint32* pPropertyCount, VkDisplayModePropertiesKHR* pProperties)
 {
+	VK_NULL_PROFILE_ENTRY_POINT(getDisplayModePropertiesKHR);
 	DE_UNREF(physicalDevice);
 	DE_UNREF(display);
 	DE_UNREF(pPropertyCount);
@@ -1319,6 +1477,7 @@ VKAPI_ATTR VkResult VKAPI_CALL getDisplayModePropertiesKHR (VkPhysicalDevice phy
 
 VKAPI_ATTR VkResult VKAPI_CALL getDisplayPlaneCapabilitiesKHR (VkPhysicalDevice physicalDevice, VkDisplayModeKHR mode, deUint32 planeIndex, VkDisplayPlaneCapabilitiesKHR* pCapabilities)
 {
+	VK_NULL_PROFILE_ENTRY_POINT(getDisplayPlaneCapabilitiesKHR);
 	DE_UNREF(physicalDevice);
 	DE_UNREF(mode);
 	DE_UNREF(planeIndex);
@@ -1328,6 +1487,7 @@ VKAPI_ATTR VkResult VKAPI_CALL getDisplayPlaneCapabilitiesKHR (VkPhysicalDevice
 
 VKAPI_ATTR VkBool32 VKAPI_CALL getPhysicalDeviceXlibPresentationSupportKHR (VkPhysicalDevice physicalDevice, deUint32 queueFamilyIndex, pt::XlibDisplayPtr dpy, pt::XlibVisualID visualID)
 {
+	VK_NULL_PROFILE_ENTRY_POINT(getPhysicalDeviceXlibPresentationSupportKHR);
 	DE_UNREF(physicalDevice);
 	DE_UNREF(queueFamilyIndex);
 	DE_UNREF(dpy);
@@ -1337,6 +1497,7 @@ VKAPI_ATTR VkBool32 VKAPI_CALL getPhysicalDeviceXlibPresentationSupportKHR (VkPh
 
 VKAPI_ATTR VkBool32 VKAPI_CALL getPhysicalDeviceXcbPresentationSupportKHR (VkPhysicalDevice physicalDevice, deUint32 queueFamilyIndex, pt::XcbConnectionPtr connection, pt::XcbVisualid visual_id)
 {
+	VK_NULL_PROFILE_ENTRY_POINT(getPhysicalDeviceXcbPresentationSupportKHR);
 	DE_UNREF(physicalDevice);
 	DE_UNREF(queueFamilyIndex);
 	DE_UNREF(connection);
@@ -1346,6 +1507,7 @@ VKAPI_ATTR VkBool32 VKAPI_CALL getPhysicalDeviceXcbPresentationSupportKHR (VkPhy
 
 VKAPI_ATTR VkBool32 VKAPI_CALL getPhysicalDeviceWaylandPresentationSupportKHR (VkPhysicalDevice physicalDevice, deUint32 queueFamilyIndex, pt::WaylandDisplayPtr display)
 {
+	VK_NULL_PROFILE_ENTRY_POINT(getPhysicalDeviceWaylandPresentationSupportKHR);
 	DE_UNREF(physicalDevice);
 	DE_UNREF(queueFamilyIndex);
 	DE_UNREF(display);
@@ -1354,6 +1516,7 @@ VKAPI_ATTR VkBool32 VKAPI_CALL getPhysicalDeviceWaylandPresentationSupportKHR (V
 
 VKAPI_ATTR VkBool32 VKAPI_CALL getPhysicalDeviceMirPresentationSupportKHR (VkPhysicalDevice physicalDevice, deUint32 queueFamilyIndex, pt::MirConnectionPtr connection)
 {
+	VK_NULL_PROFILE_ENTRY_POINT(getPhysicalDeviceMirPresentationSupportKHR);
 	DE_UNREF(physicalDevice);
 	DE_UNREF(queueFamilyIndex);
 	DE_UNREF(connection);
@@ -1362,6 +1525,7 @@ VKAPI_ATTR VkBool32 VKAPI_CALL getPhysicalDeviceMirPresentationSupportKHR (VkPhy
 
 VKAPI_ATTR VkBool32 VKAPI_CALL getPhysicalDeviceWin32PresentationSupportKHR (VkPhysicalDevice physicalDevice, deUint32 queueFamilyIndex)
 {
+	VK_NULL_PROFILE_ENTRY_POINT(getPhysicalDeviceWin32PresentationSupportKHR);
 	DE_UNREF(physicalDevice);
 	DE_UNREF(queueFamilyIndex);
 	return VK_SUCCESS;
@@ -1369,6 +1533,7 @@ VKAPI_ATTR VkBool32 VKAPI_CALL getPhysicalDeviceWin32PresentationSupportKHR (VkP
 
 VKAPI_ATTR VkResult VKAPI_CALL getMemoryWin32HandleKHR (VkDevice device, const VkMemoryGetWin32HandleInfoKHR* pGetWin32HandleInfo, pt::Win32Handle* pHandle)
 {
+	VK_NULL_PROFILE_ENTRY_POINT(getMemoryWin32HandleKHR);
 	DE_UNREF(device);
 	DE_UNREF(pGetWin32HandleInfo);
 	DE_UNREF(pHandle);
@@ -1377,6 +1542,7 @@ VKAPI_ATTR VkResult VKAPI_CALL getMemoryWin32HandleKHR (VkDevice device, const V
 
 VKAPI_ATTR VkResult VKAPI_CALL getMemoryWin32HandlePropertiesKHR (VkDevice device, VkExternalMemoryHandleTypeFlagBits handleType, pt::Win32Handle handle, VkMemoryWin32HandlePropertiesKHR* pMemoryWin32HandleProperties)
 {
+	VK_NULL_PROFILE_ENTRY_POINT(getMemoryWin32HandlePropertiesKHR);
 	DE_UNREF(device);
 	DE_UNREF(handleType);
 	DE_UNREF(handle);
@@ -1386,6 +1552,7 @@ VKAPI_ATTR VkResult VKAPI_CALL getMemoryWin32HandlePropertiesKHR (VkDevice devic
 
 VKAPI_ATTR VkResult VKAPI_CALL getMemoryFdKHR (VkDevice device, const VkMemoryGetFdInfoKHR* pGetFdInfo, int* pFd)
 {
+	VK_NULL_PROFILE_ENTRY_POINT(getMemoryFdKHR);
 	DE_UNREF(device);
 	DE_UNREF(pGetFdInfo);
 	DE_UNREF(pFd);
@@ -1394,6 +1561,7 @@ VKAPI_ATTR VkResult VKAPI_CALL getMemoryFdKHR (VkDevice device, const VkMemoryGe
 
 VKAPI_ATTR VkResult VKAPI_CALL getMemoryFdPropertiesKHR (VkDevice device, VkExternalMemoryHandleTypeFlagBits handleType, int fd, VkMemoryFdPropertiesKHR* pMemoryFdProperties)
 {
+	VK_NULL_PROFILE_ENTRY_POINT(getMemoryFdPropertiesKHR);
 	DE_UNREF(device);
 	DE_UNREF(handleType);
 	DE_UNREF(fd);
@@ -1403,6 +1571,7 @@ VKAPI_ATTR VkResult VKAPI_CALL getMemoryFdPropertiesKHR (VkDevice device, VkExte
 
 VKAPI_ATTR VkResult VKAPI_CALL importSemaphoreWin32HandleKHR (VkDevice device, const VkImportSemaphoreWin32HandleInfoKHR* pImportSemaphoreWin32HandleInfo)
 {
+	VK_NULL_PROFILE_ENTRY_POINT(importSemaphoreWin32HandleKHR);
 	DE_UNREF(device);
 	DE_UNREF(pImportSemaphoreWin32HandleInfo);
 	return VK_SUCCESS;
@@ -1410,6 +1579,7 @@ VKAPI_ATTR VkResult VKAPI_CALL importSemaphoreWin32HandleKHR (VkDevice device, c
 
 VKAPI_ATTR VkResult VKAPI_CALL getSemaphoreWin32HandleKHR (VkDevice device, const VkSemaphoreGetWin32HandleInfoKHR* pGetWin32HandleInfo, pt::Win32Handle* pHandle)
 {
+	VK_NULL_PROFILE_ENTRY_POINT(getSemaphoreWin32HandleKHR);
 	DE_UNREF(device);
 	DE_UNREF(pGetWin32HandleInfo);
 	DE_UNREF(pHandle);
@@ -1418,6 +1588,7 @@ VKAPI_ATTR VkResult VKAPI_CALL getSemaphoreWin32HandleKHR (VkDevice device, cons
 
 VKAPI_ATTR VkResult VKAPI_CALL importSemaphoreFdKHR (VkDevice device, const VkImportSemaphoreFdInfoKHR* pImportSemaphoreFdInfo)
 {
+	VK_NULL_PROFILE_ENTRY_POINT(importSemaphoreFdKHR);
 	DE_UNREF(device);
 	DE_UNREF(pImportSemaphoreFdInfo);
 	return VK_SUCCESS;
@@ -1425,6 +1596,7 @@ VKAPI_ATTR VkResult VKAPI_CALL importSemaphoreFdKHR (VkDevice device, const VkIm
 
 VKAPI_ATTR VkResult VKAPI_CALL getSemaphoreFdKHR (VkDevice device, const VkSemaphoreGetFdInfoKHR* pGetFdInfo, int* pFd)
 {
+	VK_NULL_PROFILE_ENTRY_POINT(getSemaphoreFdKHR);
 	DE_UNREF(device);
 	DE_UNREF(pGetFdInfo);
 	DE_UNREF(pFd);
@@ -1433,6 +1605,7 @@ VKAPI_ATTR VkResult VKAPI_CALL getSemaphoreFdKHR (VkDevice device, const VkSemap
 
 VKAPI_ATTR void VKAPI_CALL cmdPushDescriptorSetKHR (VkCommandBuffer commandBuffer, VkPipelineBindPoint pipelineBindPoint, VkPipelineLayout layout, deUint32 set, deUint32 descriptorWriteCount, const VkWriteDescriptorSet* pDescriptorWrites)
 {
+	VK_NULL_PROFILE_ENTRY_POINT(cmdPushDescriptorSetKHR);
 	DE_UNREF(commandBuffer);
 	DE_UNREF(pipelineBindPoint);
 	DE_UNREF(layout);
@@ -1443,6 +1616,7 @@ VKAPI_ATTR void VKAPI_CALL cmdPushDescriptorSetKHR (VkCommandBuffer commandBuffe
 
 VKAPI_ATTR void VKAPI_CALL cmdPushDescriptorSetWithTemplateKHR (VkCommandBuffer commandBuffer, VkDescriptorUpdateTemplate descriptorUpdateTemplate, VkPipelineLayout layout, deUint32 set, const void* pData)
 {
+	VK_NULL_PROFILE_ENTRY_POINT(cmdPushDescriptorSetWithTemplateKHR);
 	DE_UNREF(commandBuffer);
 	DE_UNREF(descriptorUpdateTemplate);
 	DE_UNREF(layout);
@@ -1452,6 +1626,7 @@ VKAPI_ATTR void VKAPI_CALL cmdPushDescriptorSetWithTemplateKHR (VkCommandBuffer
 
 VKAPI_ATTR void VKAPI_CALL cmdBeginRenderPass2KHR (VkCommandBuffer commandBuffer, const VkRenderPassBeginInfo* pRenderPassBegin, const VkSubpassBeginInfoKHR* pSubpassBeginInfo)
 {
+	VK_NULL_PROFILE_ENTRY_POINT(cmdBeginRenderPass2KHR);
 	DE_UNREF(commandBuffer);
 	DE_UNREF(pRenderPassBegin);
 	DE_UNREF(pSubpassBeginInfo);
@@ -1459,6 +1634,7 @@ VKAPI_ATTR void VKAPI_CALL cmdBeginRenderPass2KHR (VkCommandBuffer commandBuffer
 
 VKAPI_ATTR void VKAPI_CALL cmdNextSubpass2KHR (VkCommandBuffer commandBuffer, const VkSubpassBeginInfoKHR* pSubpassBeginInfo, const VkSubpassEndInfoKHR* pSubpassEndInfo)
 {
+	VK_NULL_PROFILE_ENTRY_POINT(cmdNextSubpass2KHR);
 	DE_UNREF(commandBuffer);
 	DE_UNREF(pSubpassBeginInfo);
 	DE_UNREF(pSubpassEndInfo);
@@ -1466,12 +1642,14 @@ VKAPI_ATTR void VKAPI_CALL cmdNextSubpass2KHR (VkCommandBuffer commandBuffer, co
 
 VKAPI_ATTR void VKAPI_CALL cmdEndRenderPass2KHR (VkCommandBuffer commandBuffer, const VkSubpassEndInfoKHR* pSubpassEndInfo)
 {
+	VK_NULL_PROFILE_ENTRY_POINT(cmdEndRenderPass2KHR);
 	DE_UNREF(commandBuffer);
 	DE_UNREF(pSubpassEndInfo);
 }
 
 VKAPI_ATTR VkResult VKAPI_CALL getSwapchainStatusKHR (VkDevice device, VkSwapchainKHR swapchain)
 {
+	VK_NULL_PROFILE_ENTRY_POINT(getSwapchainStatusKHR);
 	DE_UNREF(device);
 	DE_UNREF(swapchain);
 	return VK_SUCCESS;
@@ -1479,6 +1657,7 @@ VKAPI_ATTR VkResult VKAPI_CALL getSwapchainStatusKHR (VkDevice device, VkSwapcha
 
 VKAPI_ATTR VkResult VKAPI_CALL importFenceWin32HandleKHR (VkDevice device, const VkImportFenceWin32HandleInfoKHR* pImportFenceWin32HandleInfo)
 {
+	VK_NULL_PROFILE_ENTRY_POINT(importFenceWin32HandleKHR);
 	DE_UNREF(device);
 	DE_UNREF(pImportFenceWin32HandleInfo);
 	return VK_SUCCESS;
@@ -1486,6 +1665,7 @@ VKAPI_ATTR VkResult VKAPI_CALL importFenceWin32HandleKHR (VkDevice device, const
 
 VKAPI_ATTR VkResult VKAPI_CALL getFenceWin32HandleKHR (VkDevice device, const VkFenceGetWin32HandleInfoKHR* pGetWin32HandleInfo, pt::Win32Handle* pHandle)
 {
+	VK_NULL_PROFILE_ENTRY_POINT(getFenceWin32HandleKHR);
 	DE_UNREF(device);
 	DE_UNREF(pGetWin32HandleInfo);
 	DE_UNREF(pHandle);
@@ -1494,6 +1674,7 @@ VKAPI_ATTR VkResult VKAPI_CALL getFenceWin32HandleKHR (VkDevice device, const Vk
 
 VKAPI_ATTR VkResult VKAPI_CALL importFenceFdKHR (VkDevice device, const VkImportFenceFdInfoKHR* pImportFenceFdInfo)
 {
+	VK_NULL_PROFILE_ENTRY_POINT(importFenceFdKHR);
 	DE_UNREF(device);
 	DE_UNREF(pImportFenceFdInfo);
 	return VK_SUCCESS;
@@ -1501,6 +1682,7 @@ VKAPI_ATTR VkResult VKAPI_CALL importFenceFdKHR (VkDevice device, const VkImport
 
 VKAPI_ATTR VkResult VKAPI_CALL getFenceFdKHR (VkDevice device, const VkFenceGetFdInfoKHR* pGetFdInfo, int* pFd)
 {
+	VK_NULL_PROFILE_ENTRY_POINT(getFenceFdKHR);
 	DE_UNREF(device);
 	DE_UNREF(pGetFdInfo);
 	DE_UNREF(pFd);
@@ -1509,6 +1691,7 @@ VKAPI_ATTR VkResult VKAPI_CALL getFenceFdKHR (VkDevice device, const VkFenceGetF
 
 VKAPI_ATTR VkResult VKAPI_CALL getPhysicalDeviceSurfaceCapabilities2KHR (VkPhysicalDevice physicalDevice, const VkPhysicalDeviceSurfaceInfo2KHR* pSurfaceInfo, VkSurfaceCapabilities2KHR* pSurfaceCapabilities)
 {
+	VK_NULL_PROFILE_ENTRY_POINT(getPhysicalDeviceSurfaceCapabilities2KHR);
 	DE_UNREF(physicalDevice);
 	DE_UNREF(pSurfaceInfo);
 	DE_UNREF(pSurfaceCapabilities);
@@ -1517,6 +1700,7 @@ VKAPI_ATTR VkResult VKAPI_CALL getPhysicalDeviceSurfaceCapabilities2KHR (VkPhysi
 
 VKAPI_ATTR VkResult VKAPI_CALL getPhysicalDeviceSurfaceFormats2KHR (VkPhysicalDevice physicalDevice, const VkPhysicalDeviceSurfaceInfo2KHR* pSurfaceInfo, deUint32* pSurfaceFormatCount, VkSurfaceFormat2KHR* pSurfaceFormats)
 {
+	VK_NULL_PROFILE_ENTRY_POINT(getPhysicalDeviceSurfaceFormats2KHR);
 	DE_UNREF(physicalDevice);
 	DE_UNREF(pSurfaceInfo);
 	DE_UNREF(pSurfaceFormatCount);
@@ -1526,6 +1710,7 @@ VKAPI_ATTR VkResult VKAPI_CALL getPhysicalDeviceSurfaceFormats2KHR (VkPhysicalDe
 
 VKAPI_ATTR VkResult VKAPI_CALL getPhysicalDeviceDisplayProperties2KHR (VkPhysicalDevice physicalDevice, deUint32* pPropertyCount, VkDisplayProperties2KHR* pProperties)
 {
+	VK_NULL_PROFILE_ENTRY_POINT(getPhysicalDeviceDisplayProperties2KHR);
 	DE_UNREF(physicalDevice);
 	DE_UNREF(pPropertyCount);
 	DE_UNREF(pProperties);
@@ -1534,6 +1719,7 @@ VKAPI_ATTR VkResult VKAPI_CALL getPhysicalDeviceDisplayProperties2KHR (VkPhysica
 
 VKAPI_ATTR VkResult VKAPI_CALL getPhysicalDeviceDisplayPlaneProperties2KHR (VkPhysicalDevice physicalDevice, deUint32* pPropertyCount, VkDisplayPlaneProperties2KHR* pProperties)
 {
+	VK_NULL_PROFILE_ENTRY_POINT(getPhysicalDeviceDisplayPlaneProperties2KHR);
 	DE_UNREF(physicalDevice);
 	DE_UNREF(pPropertyCount);
 	DE_UNREF(pProperties);
@@ -1542,6 +1728,7 @@ VKAPI_ATTR VkResult VKAPI_CALL getPhysicalDeviceDisplayPlaneProperties2KHR (VkPh
 
 VKAPI_ATTR VkResult VKAPI_CALL getDisplayModeProperties2KHR (VkPhysicalDevice physicalDevice, VkDisplayKHR display, deUint32* pPropertyCount, VkDisplayModeProperties2KHR* pProperties)
 {
+	VK_NULL_PROFILE_ENTRY_POINT(getDisplayModeProperties2KHR);
 	DE_UNREF(physicalDevice);
 	DE_UNREF(display);
 	DE_UNREF(pPropertyCount);
@@ -1551,6 +1738,7 @@ VKAPI_ATTR VkResult VKAPI_CALL getDisplayModeProperties2KHR (VkPhysicalDevice ph
 
 VKAPI_ATTR VkResult VKAPI_CALL getDisplayPlaneCapabilities2KHR (VkPhysicalDevice physicalDevice, const VkDisplayPlaneInfo2KHR* pDisplayPlaneInfo, VkDisplayPlaneCapabilities2KHR* pCapabilities)
 {
+	VK_NULL_PROFILE_ENTRY_POINT(getDisplayPlaneCapabilities2KHR);
 	DE_UNREF(physicalDevice);
 	DE_UNREF(pDisplayPlaneInfo);
 	DE_UNREF(pCapabilities);
@@ -1559,6 +1747,7 @@ VKAPI_ATTR VkResult VKAPI_CALL getDisplayPlaneCapabilities2KHR (VkPhysicalDevice
 
 VKAPI_ATTR void VKAPI_CALL debugReportMessageEXT (VkInstance instance, VkDebugReportFlagsEXT flags, VkDebugReportObjectTypeEXT objectType, deUint64 object, deUintptr location, deInt32 messageCode, const char* pLayerPrefix, const char* pMessage)
 {
+	VK_NULL_PROFILE_ENTRY_POINT(debugReportMessageEXT);
 	DE_UNREF(instance);
 	DE_UNREF(flags);
 	DE_UNREF(objectType);
@@ -1571,6 +1760,7 @@ VKAPI_ATTR void VKAPI_CALL debugReportMessageEXT (VkInstance instance, VkDebugRe
 
 VKAPI_ATTR VkResult VKAPI_CALL debugMarkerSetObjectTagEXT (VkDevice device, const VkDebugMarkerObjectTagInfoEXT* pTagInfo)
 {
+	VK_NULL_PROFILE_ENTRY_POINT(debugMarkerSetObjectTagEXT);
 	DE_UNREF(device);
 	DE_UNREF(pTagInfo);
 	return VK_SUCCESS;
@@ -1578,6 +1768,7 @@ VKAPI_ATTR VkResult VKAPI_CALL debugMarkerSetObjectTagEXT (VkDevice device, cons
 
 VKAPI_ATTR VkResult VKAPI_CALL debugMarkerSetObjectNameEXT (VkDevice device, const VkDebugMarkerObjectNameInfoEXT* pNameInfo)
 {
+	VK_NULL_PROFILE_ENTRY_POINT(debugMarkerSetObjectNameEXT);
 	DE_UNREF(device);
 	DE_UNREF(pNameInfo);
 	return VK_SUCCESS;
@@ -1585,23 +1776,27 @@ VKAPI_ATTR VkResult VKAPI_CALL debugMarkerSetObjectNameEXT (VkDevice device, con
 
 VKAPI_ATTR void VKAPI_CALL cmdDebugMarkerBeginEXT (VkCommandBuffer commandBuffer, const VkDebugMarkerMarkerInfoEXT* pMarkerInfo)
 {
+	VK_NULL_PROFILE_ENTRY_POINT(cmdDebugMarkerBeginEXT);
 	DE_UNREF(commandBuffer);
 	DE_UNREF(pMarkerInfo);
 }
 
 VKAPI_ATTR void VKAPI_CALL cmdDebugMarkerEndEXT (VkCommandBuffer commandBuffer)
 {
+	VK_NULL_PROFILE_ENTRY_POINT(cmdDebugMarkerEndEXT);
 	DE_UNREF(commandBuffer);
 }
 
 VKAPI_ATTR void VKAPI_CALL cmdDebugMarkerInsertEXT (VkCommandBuffer commandBuffer, const VkDebugMarkerMarkerInfoEXT* pMarkerInfo)
 {
+	VK_NULL_PROFILE_ENTRY_POINT(cmdDebugMarkerInsertEXT);
 	DE_UNREF(commandBuffer);
 	DE_UNREF(pMarkerInfo);
 }
 
 VKAPI_ATTR void VKAPI_CALL cmdBindTransformFeedbackBuffersEXT (VkCommandBuffer commandBuffer, deUint32 firstBinding, deUint32 bindingCount, const VkBuffer* pBuffers, const VkDeviceSize* pOffsets, const VkDeviceSize* pSizes)
 {
+	VK_NULL_PROFILE_ENTRY_POINT(cmdBindTransformFeedbackBuffersEXT);
 	DE_UNREF(commandBuffer);
 	DE_UNREF(firstBinding);
 	DE_UNREF(bindingCount);
@@ -1612,6 +1807,7 @@ VKAPI_ATTR void VKAPI_CALL cmdBindTransformFeedbackBuffersEXT (VkCommandBuffer c
 
 VKAPI_ATTR void VKAPI_CALL cmdBeginTransformFeedbackEXT (VkCommandBuffer commandBuffer, deUint32 firstCounterBuffer, deUint32 counterBufferCount, const VkBuffer* pCounterBuffers, const VkDeviceSize* pCounterBufferOffsets)
 {
+	VK_NULL_PROFILE_ENTRY_POINT(cmdBeginTransformFeedbackEXT);
 	DE_UNREF(commandBuffer);
 	DE_UNREF(firstCounterBuffer);
 	DE_UNREF(counterBufferCount);
@@ -1621,6 +1817,7 @@ VKAPI_ATTR void VKAPI_CALL cmdBeginTransformFeedbackEXT (VkCommandBuffer command
 
 VKAPI_ATTR void VKAPI_CALL cmdEndTransformFeedbackEXT (VkCommandBuffer commandBuffer, deUint32 firstCounterBuffer, deUint32 counterBufferCount, const VkBuffer* pCounterBuffers, const VkDeviceSize* pCounterBufferOffsets)
 {
+	VK_NULL_PROFILE_ENTRY_POINT(cmdEndTransformFeedbackEXT);
 	DE_UNREF(commandBuffer);
 	DE_UNREF(firstCounterBuffer);
 	DE_UNREF(counterBufferCount);
@@ -1630,6 +1827,7 @@ VKAPI_ATTR void VKAPI_CALL cmdEndTransformFeedbackEXT (VkCommandBuffer commandBu
 
 VKAPI_ATTR void VKAPI_CALL cmdBeginQueryIndexedEXT (VkCommandBuffer commandBuffer, VkQueryPool queryPool, deUint32 query, VkQueryControlFlags flags, deUint32 index)
 {
+	VK_NULL_PROFILE_ENTRY_POINT(cmdBeginQueryIndexedEXT);
 	DE_UNREF(commandBuffer);
 	DE_UNREF(queryPool);
 	DE_UNREF(query);
@@ -1639,6 +1837,7 @@ VKAPI_ATTR void VKAPI_CALL cmdBeginQueryIndexedEXT (VkCommandBuffer commandBuffe
 
 VKAPI_ATTR void VKAPI_CALL cmdEndQueryIndexedEXT (VkCommandBuffer commandBuffer, VkQueryPool queryPool, deUint32 query, deUint32 index)
 {
+	VK_NULL_PROFILE_ENTRY_POINT(cmdEndQueryIndexedEXT);
 	DE_UNREF(commandBuffer);
 	DE_UNREF(queryPool);
 	DE_UNREF(query);
@@ -1647,6 +1846,7 @@ VKAPI_ATTR void VKAPI_CALL cmdEndQueryIndexedEXT (VkCommandBuffer commandBuffer,
 
 VKAPI_ATTR void VKAPI_CALL cmdDrawIndirectByteCountEXT (VkCommandBuffer commandBuffer, deUint32 instanceCount, deUint32 firstInstance, VkBuffer counterBuffer, VkDeviceSize counterBufferOffset, deUint32 counterOffset, deUint32 vertexStride)
 {
+	VK_NULL_PROFILE_ENTRY_POINT(cmdDrawIndirectByteCountEXT);
 	DE_UNREF(commandBuffer);
 	DE_UNREF(instanceCount);
 	DE_UNREF(firstInstance);
@@ -1658,6 +1858,7 @@ VKAPI_ATTR void VKAPI_CALL cmdDrawIndirectByteCountEXT (VkCommandBuffer commandB
 
 VKAPI_ATTR void VKAPI_CALL cmdDrawIndirectCountAMD (VkCommandBuffer commandBuffer, VkBuffer buffer, VkDeviceSize offset, VkBuffer countBuffer, VkDeviceSize countBufferOffset, deUint32 maxDrawCount, deUint32 stride)
 {
+	VK_NULL_PROFILE_ENTRY_POINT(cmdDrawIndirectCountAMD);
 	DE_UNREF(commandBuffer);
 	DE_UNREF(buffer);
 	DE_UNREF(offset);
@@ -1669,6 +1870,7 @@ VKAPI_ATTR void VKAPI_CALL cmdDrawIndirectCountAMD (VkCommandBuffer commandBuffe
 
 VKAPI_ATTR void VKAPI_CALL cmdDrawIndexedIndirectCountAMD (VkCommandBuffer commandBuffer, VkBuffer buffer, VkDeviceSize offset, VkBuffer countBuffer, VkDeviceSize countBufferOffset, deUint32 maxDrawCount, deUint32 stride)
 {
+	VK_NULL_PROFILE_ENTRY_POINT(cmdDrawIndexedIndirectCountAMD);
 	DE_UNREF(commandBuffer);
 	DE_UNREF(buffer);
 	DE_UNREF(offset);
@@ -1680,6 +1882,7 @@ VKAPI_ATTR void VKAPI_CALL cmdDrawIndexedIndirectCountAMD (VkCommandBuffer comma
 
 VKAPI_ATTR void VKAPI_CALL cmdDrawIndirectCountKHR (VkCommandBuffer commandBuffer, VkBuffer buffer, VkDeviceSize offset, VkBuffer countBuffer, VkDeviceSize countBufferOffset, deUint32 maxDrawCount, deUint32 stride)
 {
+	VK_NULL_PROFILE_ENTRY_POINT(cmdDrawIndirectCountKHR);
 	DE_UNREF(commandBuffer);
 	DE_UNREF(buffer);
 	DE_UNREF(offset);
@@ -1691,6 +1894,7 @@ VKAPI_ATTR void VKAPI_CALL cmdDrawIndirectCountKHR (VkCommandBuffer commandBuffe
 
 VKAPI_ATTR void VKAPI_CALL cmdDrawIndexedIndirectCountKHR (VkCommandBuffer commandBuffer, VkBuffer buffer, VkDeviceSize offset, VkBuffer countBuffer, VkDeviceSize countBufferOffset, deUint32 maxDrawCount, deUint32 stride)
 {
+	VK_NULL_PROFILE_ENTRY_POINT(cmdDrawIndexedIndirectCountKHR);
 	DE_UNREF(commandBuffer);
 	DE_UNREF(buffer);
 	DE_UNREF(offset);
@@ -1702,6 +1906,7 @@ VKAPI_ATTR void VKAPI_CALL cmdDrawIndexedIndirectCountKHR (VkCommandBuffer comma
 
 VKAPI_ATTR VkResult VKAPI_CALL getPhysicalDeviceExternalImageFormatPropertiesNV (VkPhysicalDevice physicalDevice, VkFormat format, VkImageType type, VkImageTiling tiling, VkImageUsageFlags usage, VkImageCreateFlags flags, VkExternalMemoryHandleTypeFlagsNV externalHandleType, VkExternalImageFormatPropertiesNV* pExternalImageFormatProperties)
 {
+	VK_NULL_PROFILE_ENTRY_POINT(getPhysicalDeviceExternalImageFormatPropertiesNV);
 	DE_UNREF(physicalDevice);
 	DE_UNREF(format);
 	DE_UNREF(type);
@@ -1715,6 +1920,7 @@ VKAPI_ATTR VkResult VKAPI_CALL getPhysicalDeviceExternalImageFormatPropertiesNV
 
 VKAPI_ATTR VkResult VKAPI_CALL getMemoryWin32HandleNV (VkDevice device, VkDeviceMemory memory, VkExternalMemoryHandleTypeFlagsNV handleType, pt::Win32Handle* pHandle)
 {
+	VK_NULL_PROFILE_ENTRY_POINT(getMemoryWin32HandleNV);
 	DE_UNREF(device);
 	DE_UNREF(memory);
 	DE_UNREF(handleType);
@@ -1724,29 +1930,34 @@ VKAPI_ATTR VkResult VKAPI_CALL getMemoryWin32HandleNV (VkDevice device, VkDevice
 
 VKAPI_ATTR void VKAPI_CALL cmdBeginConditionalRenderingEXT (VkCommandBuffer commandBuffer, const VkConditionalRenderingBeginInfoEXT* pConditionalRenderingBegin)
 {
+	VK_NULL_PROFILE_ENTRY_POINT(cmdBeginConditionalRenderingEXT);
 	DE_UNREF(commandBuffer);
 	DE_UNREF(pConditionalRenderingBegin);
 }
 
 VKAPI_ATTR void VKAPI_CALL cmdEndConditionalRenderingEXT (VkCommandBuffer commandBuffer)
 {
+	VK_NULL_PROFILE_ENTRY_POINT(cmdEndConditionalRenderingEXT);
 	DE_UNREF(commandBuffer);
 }
 
 VKAPI_ATTR void VKAPI_CALL cmdProcessCommandsNVX (VkCommandBuffer commandBuffer, const VkCmdProcessCommandsInfoNVX* pProcessCommandsInfo)
 {
+	VK_NULL_PROFILE_ENTRY_POINT(cmdProcessCommandsNVX);
 	DE_UNREF(commandBuffer);
 	DE_UNREF(pProcessCommandsInfo);
 }
 
 VKAPI_ATTR void VKAPI_CALL cmdReserveSpaceForCommandsNVX (VkCommandBuffer commandBuffer, const VkCmdReserveSpaceForCommandsInfoNVX* pReserveSpaceInfo)
 {
+	VK_NULL_PROFILE_ENTRY_POINT(cmdReserveSpaceForCommandsNVX);
 	DE_UNREF(commandBuffer);
 	DE_UNREF(pReserveSpaceInfo);
 }
 
 VKAPI_ATTR VkResult VKAPI_CALL registerObjectsNVX (VkDevice device, VkObjectTableNVX objectTable, deUint32 objectCount, const VkObjectTableEntryNVX* const* ppObjectTableEntries, const deUint32* pObjectIndices)
 {
+	VK_NULL_PROFILE_ENTRY_POINT(registerObjectsNVX);
 	DE_UNREF(device);
 	DE_UNREF(objectTable);
 	DE_UNREF(objectCount);
@@ -1757,6 +1968,7 @@ VKAPI_ATTR VkResult VKAPI_CALL registerObjectsNVX (VkDevice device, VkObjectTabl
 
 VKAPI_ATTR VkResult VKAPI_CALL unregisterObjectsNVX (VkDevice device, VkObjectTableNVX objectTable, deUint32 objectCount, const VkObjectEntryTypeNVX* pObjectEntryTypes, const deUint32* pObjectIndices)
 {
+	VK_NULL_PROFILE_ENTRY_POINT(unregisterObjectsNVX);
 	DE_UNREF(device);
 	DE_UNREF(objectTable);
 	DE_UNREF(objectCount);
@@ -1767,6 +1979,7 @@ VKAPI_ATTR VkResult VKAPI_CALL unregisterObjectsNVX (VkDevice device, VkObjectTa
 
 VKAPI_ATTR void VKAPI_CALL getPhysicalDeviceGeneratedCommandsPropertiesNVX (VkPhysicalDevice physicalDevice, VkDeviceGeneratedCommandsFeaturesNVX* pFeatures, VkDeviceGeneratedCommandsLimitsNVX* pLimits)
 {
+	VK_NULL_PROFILE_ENTRY_POINT(getPhysicalDeviceGeneratedCommandsPropertiesNVX);
 	DE_UNREF(physicalDevice);
 	DE_UNREF(pFeatures);
 	DE_UNREF(pLimits);
@@ -1774,6 +1987,7 @@ VKAPI_ATTR void VKAPI_CALL getPhysicalDeviceGeneratedCommandsPropertiesNVX (VkPh
 
 VKAPI_ATTR void VKAPI_CALL cmdSetViewportWScalingNV (VkCommandBuffer commandBuffer, deUint32 firstViewport, deUint32 viewportCount, const VkViewportWScalingNV* pViewportWScalings)
 {
+	VK_NULL_PROFILE_ENTRY_POINT(cmdSetViewportWScalingNV);
 	DE_UNREF(commandBuffer);
 	DE_UNREF(firstViewport);
 	DE_UNREF(viewportCount);
@@ -1782,6 +1996,7 @@ VKAPI_ATTR void VKAPI_CALL cmdSetViewportWScalingNV (VkCommandBuffer commandBuff
 
 VKAPI_ATTR VkResult VKAPI_CALL releaseDisplayEXT (VkPhysicalDevice physicalDevice, VkDisplayKHR display)
 {
+	VK_NULL_PROFILE_ENTRY_POINT(releaseDisplayEXT);
 	DE_UNREF(physicalDevice);
 	DE_UNREF(display);
 	return VK_SUCCESS;
@@ -1789,6 +2004,7 @@ VKAPI_ATTR VkResult VKAPI_CALL releaseDisplayEXT (VkPhysicalDevice physicalDevic
 
 VKAPI_ATTR VkResult VKAPI_CALL acquireXlibDisplayEXT (VkPhysicalDevice physicalDevice, pt::XlibDisplayPtr dpy, VkDisplayKHR display)
 {
+	VK_NULL_PROFILE_ENTRY_POINT(acquireXlibDisplayEXT);
 	DE_UNREF(physicalDevice);
 	DE_UNREF(dpy);
 	DE_UNREF(display);
@@ -1797,6 +2013,7 @@ VKAPI_ATTR VkResult VKAPI_CALL acquireXlibDisplayEXT (VkPhysicalDevice physicalD
 
 VKAPI_ATTR VkResult VKAPI_CALL getRandROutputDisplayEXT (VkPhysicalDevice physicalDevice, pt::XlibDisplayPtr dpy, pt::RROutput rrOutput, VkDisplayKHR* pDisplay)
 {
+	VK_NULL_PROFILE_ENTRY_POINT(getRandROutputDisplayEXT);
 	DE_UNREF(physicalDevice);
 	DE_UNREF(dpy);
 	DE_UNREF(rrOutput);
@@ -1806,6 +2023,7 @@ VKAPI_ATTR VkResult VKAPI_CALL getRandROutputDisplayEXT (VkPhysicalDevice physic
 
 VKAPI_ATTR VkResult VKAPI_CALL getPhysicalDeviceSurfaceCapabilities2EXT (VkPhysicalDevice physicalDevice, VkSurfaceKHR surface, VkSurfaceCapabilities2EXT* pSurfaceCapabilities)
 {
+	VK_NULL_PROFILE_ENTRY_POINT(getPhysicalDeviceSurfaceCapabilities2EXT);
 	DE_UNREF(physicalDevice);
 	DE_UNREF(surface);
 	DE_UNREF(pSurfaceCapabilities);
@@ -1814,6 +2032,7 @@ VKAPI_ATTR VkResult VKAPI_CALL getPhysicalDeviceSurfaceCapabilities2EXT (VkPhysi
 
 VKAPI_ATTR VkResult VKAPI_CALL displayPowerControlEXT (VkDevice device, VkDisplayKHR display, const VkDisplayPowerInfoEXT* pDisplayPowerInfo)
 {
+	VK_NULL_PROFILE_ENTRY_POINT(displayPowerControlEXT);
 	DE_UNREF(device);
 	DE_UNREF(display);
 	DE_UNREF(pDisplayPowerInfo);
@@ -1822,6 +2041,7 @@ VKAPI_ATTR VkResult VKAPI_CALL displayPowerControlEXT (VkDevice device, VkDispla
 
 VKAPI_ATTR VkResult VKAPI_CALL registerDeviceEventEXT (VkDevice device, const VkDeviceEventInfoEXT* pDeviceEventInfo, const VkAllocationCallbacks* pAllocator, VkFence* pFence)
 {
+	VK_NULL_PROFILE_ENTRY_POINT(registerDeviceEventEXT);
 	DE_UNREF(device);
 	DE_UNREF(pDeviceEventInfo);
 	DE_UNREF(pAllocator);
@@ -1831,6 +2051,7 @@ VKAPI_ATTR VkResult VKAPI_CALL registerDeviceEventEXT (VkDevice device, const Vk
 
 VKAPI_ATTR VkResult VKAPI_CALL registerDisplayEventEXT (VkDevice device, VkDisplayKHR display, const VkDisplayEventInfoEXT* pDisplayEventInfo, const VkAllocationCallbacks* pAllocator, VkFence* pFence)
 {
+	VK_NULL_PROFILE_ENTRY_POINT(registerDisplayEventEXT);
 	DE_UNREF(device);
 	DE_UNREF(display);
 	DE_UNREF(pDisplayEventInfo);
@@ -1841,6 +2062,7 @@ VKAPI_ATTR VkResult VKAPI_CALL registerDisplayEventEXT (VkDevice device, VkDispl
 
 VKAPI_ATTR VkResult VKAPI_CALL getSwapchainCounterEXT (VkDevice device, VkSwapchainKHR swapchain, VkSurfaceCounterFlagBitsEXT counter, deUint64* pCounterValue)
 {
+	VK_NULL_PROFILE_ENTRY_POINT(getSwapchainCounterEXT);
 	DE_UNREF(device);
 	DE_UNREF(swapchain);
 	DE_UNREF(counter);
@@ -1850,6 +2072,7 @@ VKAPI_ATTR VkResult VKAPI_CALL getSwapchainCounterEXT (VkDevice device, VkSwapch
 
 VKAPI_ATTR VkResult VKAPI_CALL getRefreshCycleDurationGOOGLE (VkDevice device, VkSwapchainKHR swapchain, VkRefreshCycleDurationGOOGLE* pDisplayTimingProperties)
 {
+	VK_NULL_PROFILE_ENTRY_POINT(getRefreshCycleDurationGOOGLE);
 	DE_UNREF(device);
 	DE_UNREF(swapchain);
 	DE_UNREF(pDisplayTimingProperties);
@@ -1858,6 +2081,7 @@ VKAPI_ATTR VkResult VKAPI_CALL getRefreshCycleDurationGOOGLE (VkDevice device, V
 
 VKAPI_ATTR VkResult VKAPI_CALL getPastPresentationTimingGOOGLE (VkDevice device, VkSwapchainKHR swapchain, deUint32* pPresentationTimingCount, VkPastPresentationTimingGOOGLE* pPresentationTimings)
 {
+	VK_NULL_PROFILE_ENTRY_POINT(getPastPresentationTimingGOOGLE);
 	DE_UNREF(device);
 	DE_UNREF(swapchain);
 	DE_UNREF(pPresentationTimingCount);
@@ -1867,6 +2091,7 @@ VKAPI_ATTR VkResult VKAPI_CALL getPastPresentationTimingGOOGLE (VkDevice device,
 
 VKAPI_ATTR void VKAPI_CALL cmdSetDiscardRectangleEXT (VkCommandBuffer commandBuffer, deUint32 firstDiscardRectangle, deUint32 discardRectangleCount, const VkRect2D* pDiscardRectangles)
 {
+	VK_NULL_PROFILE_ENTRY_POINT(cmdSetDiscardRectangleEXT);
 	DE_UNREF(commandBuffer);
 	DE_UNREF(firstDiscardRectangle);
 	DE_UNREF(discardRectangleCount);
@@ -1875,6 +2100,7 @@ VKAPI_ATTR void VKAPI_CALL cmdSetDiscardRectangleEXT (VkCommandBuffer commandBuf
 
 VKAPI_ATTR void VKAPI_CALL setHdrMetadataEXT (VkDevice device, deUint32 swapchainCount, const VkSwapchainKHR* pSwapchains, const VkHdrMetadataEXT* pMetadata)
 {
+	VK_NULL_PROFILE_ENTRY_POINT(setHdrMetadataEXT);
 	DE_UNREF(device);
 	DE_UNREF(swapchainCount);
 	DE_UNREF(pSwapchains);
@@ -1883,12 +2109,14 @@ VKAPI_ATTR void VKAPI_CALL setHdrMetadataEXT (VkDevice device, deUint32 swapchai
 
 VKAPI_ATTR void VKAPI_CALL cmdSetSampleLocationsEXT (VkCommandBuffer commandBuffer, const VkSampleLocationsInfoEXT* pSampleLocationsInfo)
 {
+	VK_NULL_PROFILE_ENTRY_POINT(cmdSetSampleLocationsEXT);
 	DE_UNREF(commandBuffer);
 	DE_UNREF(pSampleLocationsInfo);
 }
 
 VKAPI_ATTR void VKAPI_CALL getPhysicalDeviceMultisamplePropertiesEXT (VkPhysicalDevice physicalDevice, VkSampleCountFlagBits samples, VkMultisamplePropertiesEXT* pMultisampleProperties)
 {
+	VK_NULL_PROFILE_ENTRY_POINT(getPhysicalDeviceMultisamplePropertiesEXT);
 	DE_UNREF(physicalDevice);
 	DE_UNREF(samples);
 	DE_UNREF(pMultisampleProperties);
@@ -1896,6 +2124,7 @@ VKAPI_ATTR void VKAPI_CALL getPhysicalDeviceMultisamplePropertiesEXT (VkPhysical
 
 VKAPI_ATTR VkResult VKAPI_CALL mergeValidationCachesEXT (VkDevice device, VkValidationCacheEXT dstCache, deUint32 srcCacheCount, const VkValidationCacheEXT* pSrcCaches)
 {
+	VK_NULL_PROFILE_ENTRY_POINT(mergeValidationCachesEXT);
 	DE_UNREF(device);
 	DE_UNREF(dstCache);
 	DE_UNREF(srcCacheCount);
@@ -1905,6 +2134,7 @@ VKAPI_ATTR VkResult VKAPI_CALL mergeValidationCachesEXT (VkDevice device, VkVali
 
 VKAPI_ATTR VkResult VKAPI_CALL getValidationCacheDataEXT (VkDevice device, VkValidationCacheEXT validationCache, deUintptr* pDataSize, void* pData)
 {
+	VK_NULL_PROFILE_ENTRY_POINT(getValidationCacheDataEXT);
 	DE_UNREF(device);
 	DE_UNREF(validationCache);
 	DE_UNREF(pDataSize);
@@ -1914,6 +2144,7 @@ VKAPI_ATTR VkResult VKAPI_CALL getValidationCacheDataEXT (VkDevice device, VkVal
 
 VKAPI_ATTR VkResult VKAPI_CALL getMemoryHostPointerPropertiesEXT (VkDevice device, VkExternalMemoryHandleTypeFlagBits handleType, const void* pHostPointer, VkMemoryHostPointerPropertiesEXT* pMemoryHostPointerProperties)
 {
+	VK_NULL_PROFILE_ENTRY_POINT(getMemoryHostPointerPropertiesEXT);
 	DE_UNREF(device);
 	DE_UNREF(handleType);
 	DE_UNREF(pHostPointer);
@@ -1923,6 +2154,7 @@ VKAPI_ATTR VkResult VKAPI_CALL getMemoryHostPointerPropertiesEXT (VkDevice devic
 
 VKAPI_ATTR VkResult VKAPI_CALL getAndroidHardwareBufferPropertiesANDROID (VkDevice device, const struct pt::AndroidHardwareBufferPtr buffer, VkAndroidHardwareBufferPropertiesANDROID* pProperties)
 {
+	VK_NULL_PROFILE_ENTRY_POINT(getAndroidHardwareBufferPropertiesANDROID);
 	DE_UNREF(device);
 	DE_UNREF(buffer);
 	DE_UNREF(pProperties);
@@ -1931,6 +2163,7 @@ VKAPI_ATTR VkResult VKAPI_CALL getAndroidHardwareBufferPropertiesANDROID (VkDevi
 
 VKAPI_ATTR VkDeviceAddress VKAPI_CALL getBufferDeviceAddressEXT (VkDevice device, const VkBufferDeviceAddressInfoEXT* pInfo)
 {
+	VK_NULL_PROFILE_ENTRY_POINT(getBufferDeviceAddressEXT);
 	DE_UNREF(device);
 	DE_UNREF(pInfo);
 	return VK_SUCCESS;
@@ -1938,6 +2171,7 @@ VKAPI_ATTR VkDeviceAddress VKAPI_CALL getBufferDeviceAddressEXT (VkDevice device
 
 VKAPI_ATTR VkResult VKAPI_CALL getPhysicalDeviceCooperativeMatrixPropertiesNV (VkPhysicalDevice physicalDevice, deUint32* pPropertyCount, VkCooperativeMatrixPropertiesNV* pProperties)
 {
+	VK_NULL_PROFILE_ENTRY_POINT(getPhysicalDeviceCooperativeMatrixPropertiesNV);
 	DE_UNREF(physicalDevice);
 	DE_UNREF(pPropertyCount);
 	DE_UNREF(pProperties);
@@ -1946,6 +2180,7 @@ VKAPI_ATTR VkResult VKAPI_CALL getPhysicalDeviceCooperativeMatrixPropertiesNV (V
 
 VKAPI_ATTR void VKAPI_CALL resetQueryPoolEXT (VkDevice device, VkQueryPool queryPool, deUint32 firstQuery, deUint32 queryCount)
 {
+	VK_NULL_PROFILE_ENTRY_POINT(resetQueryPoolEXT);
 	DE_UNREF(device);
 	DE_UNREF(queryPool);
 	DE_UNREF(firstQuery);
@@ -49,7 +49,8 @@ Move<VkPipeline> makeGraphicsPipeline(const DeviceInterface&						vk,
 									  const VkPipelineMultisampleStateCreateInfo*	multisampleStateCreateInfo,
 									  const VkPipelineDepthStencilStateCreateInfo*	depthStencilStateCreateInfo,
 									  const VkPipelineColorBlendStateCreateInfo*	colorBlendStateCreateInfo,
-									  const VkPipelineDynamicStateCreateInfo*		dynamicStateCreateInfo)
+									  const VkPipelineDynamicStateCreateInfo*		dynamicStateCreateInfo,
+									  const VkPipelineCache							pipelineCache)
 {
 	const VkBool32									disableRasterization				= (fragmentShaderModule == DE_NULL);
 	const bool										hasTessellation						= (tessellationControlShaderModule != DE_NULL || tessellationEvalShaderModule != DE_NULL);
@@ -280,7 +281,7 @@ Move<VkPipeline> makeGraphicsPipeline(const DeviceInterface&						vk,
 		0																										// deInt32                                          basePipelineIndex;
 	};
 
-	return createGraphicsPipeline(vk, device, DE_NULL, &pipelineCreateInfo);
+	return createGraphicsPipeline(vk, device, pipelineCache, &pipelineCreateInfo);
 }
 
 Move<VkPipeline> makeGraphicsPipeline (const DeviceInterface&							vk,
@@ -301,7 +302,8 @@ Move<VkPipeline> makeGraphicsPipeline (const DeviceInterface&							vk,
 									   const VkPipelineMultisampleStateCreateInfo*		multisampleStateCreateInfo,
 									   const VkPipelineDepthStencilStateCreateInfo*		depthStencilStateCreateInfo,
 									   const VkPipelineColorBlendStateCreateInfo*		colorBlendStateCreateInfo,
-									   const VkPipelineDynamicStateCreateInfo*			dynamicStateCreateInfo)
+									   const VkPipelineDynamicStateCreateInfo*			dynamicStateCreateInfo,
+									   const VkPipelineCache							pipelineCache)
 {
 	VkPipelineShaderStageCreateInfo					stageCreateInfo		=
 	{
@@ -373,7 +375,7 @@ Move<VkPipeline> makeGraphicsPipeline (const DeviceInterface&							vk,
 		0													// deInt32                                          basePipelineIndex;
 	};
 
-	return createGraphicsPipeline(vk, device, DE_NULL, &pipelineCreateInfo);
+	return createGraphicsPipeline(vk, device, pipelineCache, &pipelineCreateInfo);
 }
 
 Move<VkRenderPass> makeRenderPass (const DeviceInterface&				vk,
@@ -48,7 +48,8 @@ Move<VkPipeline> makeGraphicsPipeline (const DeviceInterface&							vk,
 									   const VkPipelineMultisampleStateCreateInfo*		multisampleStateCreateInfo = DE_NULL,
 									   const VkPipelineDepthStencilStateCreateInfo*		depthStencilStateCreateInfo = DE_NULL,
 									   const VkPipelineColorBlendStateCreateInfo*		colorBlendStateCreateInfo = DE_NULL,
-									   const VkPipelineDynamicStateCreateInfo*			dynamicStateCreateInfo = DE_NULL);
+									   const VkPipelineDynamicStateCreateInfo*			dynamicStateCreateInfo = DE_NULL,
+									   const VkPipelineCache							pipelineCache = DE_NULL);
 
 Move<VkPipeline> makeGraphicsPipeline (const DeviceInterface&							vk,
 									   const VkDevice									device,
@@ -68,7 +69,8 @@ Move<VkPipeline> makeGraphicsPipeline (const DeviceInterface&							vk,
 									   const VkPipelineMultisampleStateCreateInfo*		multisampleStateCreateInfo = DE_NULL,
 									   const VkPipelineDepthStencilStateCreateInfo*		depthStencilStateCreateInfo = DE_NULL,
 									   const VkPipelineColorBlendStateCreateInfo*		colorBlendStateCreateInfo = DE_NULL,
-									   const VkPipelineDynamicStateCreateInfo*			dynamicStateCreateInfo = DE_NULL);
+									   const VkPipelineDynamicStateCreateInfo*			dynamicStateCreateInfo = DE_NULL,
+									   const VkPipelineCache							pipelineCache = DE_NULL);
 
 Move<VkRenderPass> makeRenderPass (const DeviceInterface&				vk,
 								   const VkDevice						device,
@@ -0,0 +1,257 @@
+/*-------------------------------------------------------------------------
+ * Vulkan CTS Framework
+ * --------------------
+ *
+ * Copyright (c) 2019 Google Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ *//*!
+ * \file
+ * \brief Pipeline cache persisted to a file and shared by all pipelines of a device
+ *//*--------------------------------------------------------------------*/
+
+#include "vkSharedPipelineCache.hpp"
+#include "vkRefUtil.hpp"
+#include "deMemory.h"
+#include "deFilePath.hpp"
+
+#include <cstdio>
+
+namespace vk
+{
+
+using std::vector;
+using std::string;
+
+namespace
+{
+
+vector<deUint8> readPipelineCacheFile (const char* filename)
+{
+	vector<deUint8>	data;
+	FILE* const		file	= fopen(filename, "rb");
+
+	if (!file)
+		return data;
+
+	if (fseek(file, 0, SEEK_END) == 0)
+	{
+		const long size = ftell(file);
+
+		if (size > 0 && fseek(file, 0, SEEK_SET) == 0)
+		{
+			data.resize((size_t)size);
+
+			if (fread(&data[0], 1, data.size(), file) != data.size())
+				data.clear();
+		}
+	}
+
+	fclose(file);
+
+	return data;
+}
+
+bool writePipelineCacheFile (const char* filename, const vector<deUint8>& data)
+{
+	const de::FilePath	filePath	(filename);
+
+	if (!filePath.getDirName().empty() && !de::FilePath(filePath.getDirName()).exists())
+		de::createDirectoryAndParents(filePath.getDirName().c_str());
+
+	FILE* const			file		= fopen(filename, "wb");
+	bool				ok			= (file != DE_NULL);
+
+	if (ok && !data.empty())
+		ok = fwrite(&data[0], 1, data.size(), file) == data.size();
+
+	if (file)
+		ok = (fclose(file) == 0) && ok;
+
+	return ok;
+}
+
+Move<VkPipelineCache> createSharedPipelineCache (const DeviceInterface& vkd, VkDevice device, const vector<deUint8>& initialData)
+{
+	const VkPipelineCacheCreateInfo	createInfo	=
+	{
+		VK_STRUCTURE_TYPE_PIPELINE_CACHE_CREATE_INFO,		// VkStructureType				sType;
+		DE_NULL,											// const void*					pNext;
+		0u,													// VkPipelineCacheCreateFlags	flags;
+		(deUintptr)initialData.size(),						// deUintptr					initialDataSize;
+		initialData.empty() ? DE_NULL : &initialData[0],	// const void*					pInitialData;
+	};
+
+	return createPipelineCache(vkd, device, &createInfo);
+}
+
+} // anonymous
+
+bool isPipelineCacheDataCompatible (const vector<deUint8>& data, const VkPhysicalDeviceProperties& properties)
+{
+	deUint32 header[4];
+
+	if (data.size() < sizeof(header) + VK_UUID_SIZE)
+		return false;
+
+	deMemcpy(header, &data[0], sizeof(header));
+
+	return header[0] >= sizeof(header) + VK_UUID_SIZE
+		&& header[1] == VK_PIPELINE_CACHE_HEADER_VERSION_ONE
+		&& header[2] == properties.vendorID
+		&& header[3] == properties.deviceID
+		&& deMemCmp(&data[sizeof(header)], properties.pipelineCacheUUID, VK_UUID_SIZE) == 0;
+}
+
+vector<deUint8> getPipelineCacheData (const DeviceInterface& vkd, VkDevice device, VkPipelineCache cache)
+{
+	deUintptr		dataSize	= 0;
+	vector<deUint8>	data;
+
+	VK_CHECK(vkd.getPipelineCacheData(device, cache, &dataSize, DE_NULL));
+
+	if (dataSize > 0)
+	{
+		data.resize((size_t)dataSize);
+		VK_CHECK(vkd.getPipelineCacheData(device, cache, &dataSize, &data[0]));
+		data.resize((size_t)dataSize);
+	}
+
+	return data;
+}
+
+// SharedPipelineCache::Driver
+
+SharedPipelineCache::Driver::Driver (const PlatformInterface& vkp, VkInstance instance, VkDevice device, SharedPipelineCache& cache)
+	: DeviceDriver	(vkp, instance, device)
+	, m_cache		(cache)
+{
+}
+
+bool SharedPipelineCache::Driver::isShared (VkDevice device, VkPipelineCache pipelineCache) const
+{
+	// The interface may also be used with other devices
+	return device == m_cache.m_device && (pipelineCache == DE_NULL || pipelineCache == *m_cache.m_cache);
+}
+
+VkResult SharedPipelineCache::Driver::createGraphicsPipelines (VkDevice device, VkPipelineCache pipelineCache, deUint32 createInfoCount, const VkGraphicsPipelineCreateInfo* pCreateInfos, const VkAllocationCallbacks* pAllocator, VkPipeline* pPipelines) const
+{
+	VkResult result = VK_SUCCESS;
+
+	if (!isShared(device, pipelineCache))
+		return DeviceDriver::createGraphicsPipelines(device, pipelineCache, createInfoCount, pCreateInfos, pAllocator, pPipelines);
+
+	// Failed creations leave a null handle and the first error is returned, as for a single call
+	for (deUint32 ndx = 0; ndx < createInfoCount; ndx++)
+	{
+		const VkResult pipelineResult = DeviceDriver::createGraphicsPipelines(device, *m_cache.m_cache, 1u, &pCreateInfos[ndx], pAllocator, &pPipelines[ndx]);
+
+		if (pipelineResult == VK_SUCCESS)
+			m_cache.countPipeline();
+		else if (result == VK_SUCCESS)
+			result = pipelineResult;
+	}
+
+	return result;
+}
+
+VkResult SharedPipelineCache::Driver::createComputePipelines (VkDevice device, VkPipelineCache pipelineCache, deUint32 createInfoCount, const VkComputePipelineCreateInfo* pCreateInfos, const VkAllocationCallbacks* pAllocator, VkPipeline* pPipelines) const
+{
+	VkResult result = VK_SUCCESS;
+
+	if (!isShared(device, pipelineCache))
+		return DeviceDriver::createComputePipelines(device, pipelineCache, createInfoCount, pCreateInfos, pAllocator, pPipelines);
+
+	for (deUint32 ndx = 0; ndx < createInfoCount; ndx++)
+	{
+		const VkResult pipelineResult = DeviceDriver::createComputePipelines(device, *m_cache.m_cache, 1u, &pCreateInfos[ndx], pAllocator, &pPipelines[ndx]);
+
+		if (pipelineResult == VK_SUCCESS)
+			m_cache.countPipeline();
+		else if (result == VK_SUCCESS)
+			result = pipelineResult;
+	}
+
+	return result;
+}
+
+// SharedPipelineCache
+
+SharedPipelineCache::SharedPipelineCache (const PlatformInterface&			vkp,
+										  VkInstance						instance,
+										  const DeviceInterface&			vkd,
+										  VkDevice							device,
+										  const VkPhysicalDeviceProperties&	properties,
+										  const string&						filename)
+	: m_vkd			(vkd)
+	, m_device		(device)
+	, m_filename	(filename)
+	, m_driver		(vkp, instance, device, *this)
+{
+	vector<deUint8> initialData = readPipelineCacheFile(m_filename.c_str());
+
+	if (!initialData.empty() && !isPipelineCacheDataCompatible(initialData, properties))
+	{
+		m_stats.rejectedDataSize = initialData.size();
+		initialData.clear();
+	}
+
+	m_stats.loadedDataSize	= initialData.size();
+	m_cache					= createSharedPipelineCache(m_vkd, m_device, initialData);
+	m_lastData				= getPipelineCacheData(m_vkd, m_device, *m_cache);
+	m_stats.dataSize		= m_lastData.size();
+}
+
+SharedPipelineCache::~SharedPipelineCache (void)
+{
+	try
+	{
+		store();
+	}
+	catch (const std::exception& e)
+	{
+		tcu::print("Failed to store pipeline cache: %s\n", e.what());
+	}
+}
+
+PipelineCacheStats SharedPipelineCache::getStats (void) const
+{
+	const de::ScopedLock lock (m_lock);
+
+	return m_stats;
+}
+
+void SharedPipelineCache::store (void) const
+{
+	if (!writePipelineCacheFile(m_filename.c_str(), getPipelineCacheData(m_vkd, m_device, *m_cache)))
+		throw tcu::ResourceError("Failed to write pipeline cache to " + m_filename);
+}
+
+void SharedPipelineCache::countPipeline (void)
+{
+	vector<deUint8>			data	= getPipelineCacheData(m_vkd, m_device, *m_cache);
+	const de::ScopedLock	lock	(m_lock);
+
+	if (data == m_lastData)
+		m_stats.numHits += 1;
+	else
+		m_stats.numMisses += 1;
+
+	m_stats.numPipelines	+= 1;
+	m_stats.dataSize		= data.size();
+
+	m_lastData.swap(data);
+}
+
+} // vk
@@ -0,0 +1,128 @@
+#ifndef _VKSHAREDPIPELINECACHE_HPP
+#define _VKSHAREDPIPELINECACHE_HPP
+/*-------------------------------------------------------------------------
+ * Vulkan CTS Framework
+ * --------------------
+ *
+ * Copyright (c) 2019 Google Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ *//*!
+ * \file
+ * \brief Pipeline cache persisted to a file and shared by all pipelines of a device
+ *//*--------------------------------------------------------------------*/
+
+#include "vkDefs.hpp"
+#include "vkRef.hpp"
+#include "vkPlatform.hpp"
+#include "deMutex.hpp"
+
+#include <string>
+#include <vector>
+
+namespace vk
+{
+
+struct PipelineCacheStats
+{
+	size_t		loadedDataSize;		//!< Size of the cache data loaded from file
+	size_t		rejectedDataSize;	//!< Size of incompatible cache data found in the file and discarded
+	size_t		dataSize;			//!< Current size of the cache data
+	deUint32	numPipelines;		//!< Number of pipelines created with the shared cache
+	deUint32	numHits;			//!< Pipelines whose creation left the cache data unchanged
+	deUint32	numMisses;			//!< Pipelines whose creation changed the cache data
+
+	PipelineCacheStats (void)
+		: loadedDataSize	(0)
+		, rejectedDataSize	(0)
+		, dataSize			(0)
+		, numPipelines		(0)
+		, numHits			(0)
+		, numMisses			(0)
+	{
+	}
+};
+
+//! Check that cache data was produced by a device with matching properties (VkPipelineCacheHeaderVersionOne)
+bool					isPipelineCacheDataCompatible	(const std::vector<deUint8>& data, const VkPhysicalDeviceProperties& properties);
+std::vector<deUint8>	getPipelineCacheData			(const DeviceInterface& vkd, VkDevice device, VkPipelineCache cache);
+
+/*--------------------------------------------------------------------*//*!
+ * \brief Pipeline cache shared by all pipelines created on a device
+ *
+ * Cache contents are loaded from file when the cache is created; data
+ * written by an incompatible device or driver version is discarded.
+ * store() writes the contents back, the destructor stores them as well.
+ *
+ * getDeviceInterface() returns a driver for the device that creates
+ * graphics and compute pipelines with the shared cache whenever the
+ * caller passes no cache or the shared one. Such pipelines are created
+ * one at a time and the cache data is compared before and after each
+ * creation: unchanged data counts as a hit, changed data as a miss.
+ * Pipelines created concurrently from several threads may be
+ * misclassified, since their changes can not be told apart.
+ *//*--------------------------------------------------------------------*/
+class SharedPipelineCache
+{
+public:
+									SharedPipelineCache		(const PlatformInterface&			vkp,
+															 VkInstance							instance,
+															 const DeviceInterface&				vkd,
+															 VkDevice							device,
+															 const VkPhysicalDeviceProperties&	properties,
+															 const std::string&					filename);
+									~SharedPipelineCache	(void);
+
+	VkPipelineCache					get						(void) const	{ return *m_cache;	}
+	const DeviceInterface&			getDeviceInterface		(void) const	{ return m_driver;	}
+	PipelineCacheStats				getStats				(void) const;
+
+	//! Write the cache data to the file, throws ResourceError on failure
+	void							store					(void) const;
+
+private:
+	class Driver : public DeviceDriver
+	{
+	public:
+									Driver					(const PlatformInterface& vkp, VkInstance instance, VkDevice device, SharedPipelineCache& cache);
+
+		virtual VkResult			createGraphicsPipelines	(VkDevice device, VkPipelineCache pipelineCache, deUint32 createInfoCount, const VkGraphicsPipelineCreateInfo* pCreateInfos, const VkAllocationCallbacks* pAllocator, VkPipeline* pPipelines) const;
+		virtual VkResult			createComputePipelines	(VkDevice device, VkPipelineCache pipelineCache, deUint32 createInfoCount, const VkComputePipelineCreateInfo* pCreateInfos, const VkAllocationCallbacks* pAllocator, VkPipeline* pPipelines) const;
+
+	private:
+		bool						isShared				(VkDevice device, VkPipelineCache pipelineCache) const;
+
+		SharedPipelineCache&		m_cache;
+	};
+
+	void							countPipeline			(void);
+
+	const DeviceInterface&			m_vkd;
+	const VkDevice					m_device;
+	const std::string				m_filename;
+	Move<VkPipelineCache>			m_cache;
+	const Driver					m_driver;
+
+	mutable de::Mutex				m_lock;				//!< Protects m_stats and m_lastData
+	PipelineCacheStats				m_stats;
+	std::vector<deUint8>			m_lastData;			//!< Cache data after the previous pipeline creation
+
+	// "deleted"
+									SharedPipelineCache		(const SharedPipelineCache&);
+	SharedPipelineCache&			operator=				(const SharedPipelineCache&);
+};
+
+} // vk
+
+#endif // _VKSHAREDPIPELINECACHE_HPP
@@ -0,0 +1,300 @@
+/*-------------------------------------------------------------------------
+ * Vulkan CTS Framework
+ * --------------------
+ *
+ * Copyright (c) 2019 Google Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ *//*!
+ * \file
+ * \brief Persistently mapped staging buffer ring
+ *//*--------------------------------------------------------------------*/
+
+#include "vkStagingRing.hpp"
+#include "vkRefUtil.hpp"
+#include "vkQueryUtil.hpp"
+#include "vkCmdUtil.hpp"
+#include "vkBarrierUtil.hpp"
+#include "vkTypeUtil.hpp"
+#include "vkImageUtil.hpp"
+#include "deMemory.h"
+
+#include <algorithm>
+
+namespace vk
+{
+
+namespace
+{
+
+Move<VkBuffer> createStagingBuffer (const DeviceInterface& vk, const VkDevice device, const VkDeviceSize size)
+{
+	const VkBufferCreateInfo bufferParams =
+	{
+		VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO,									// VkStructureType		sType;
+		DE_NULL,																// const void*			pNext;
+		0u,																		// VkBufferCreateFlags	flags;
+		size,																	// VkDeviceSize			size;
+		VK_BUFFER_USAGE_TRANSFER_SRC_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT,	// VkBufferUsageFlags	usage;
+		VK_SHARING_MODE_EXCLUSIVE,												// VkSharingMode		sharingMode;
+		0u,																		// deUint32				queueFamilyIndexCount;
+		DE_NULL																	// const deUint32*		pQueueFamilyIndices;
+	};
+
+	return createBuffer(vk, device, &bufferParams);
+}
+
+de::MovePtr<Allocation> allocateAndBind (const DeviceInterface& vk, const VkDevice device, Allocator& allocator, const VkBuffer buffer)
+{
+	de::MovePtr<Allocation> allocation = allocator.allocate(getBufferMemoryRequirements(vk, device, buffer), MemoryRequirement::HostVisible);
+
+	VK_CHECK(vk.bindBufferMemory(device, buffer, allocation->getMemory(), allocation->getOffset()));
+
+	return allocation;
+}
+
+} // anonymous
+
+StagingRing::StagingRing (const DeviceInterface&	vk,
+						  const VkDevice			device,
+						  Allocator&				allocator,
+						  const VkQueue				queue,
+						  const deUint32			queueFamilyIndex,
+						  const VkDeviceSize		size)
+	: m_vk				(vk)
+	, m_device			(device)
+	, m_allocator		(allocator)
+	, m_size			(size)
+	, m_buffer			(createStagingBuffer(vk, device, size))
+	, m_allocation		(allocateAndBind(vk, device, allocator, *m_buffer))
+	, m_head			(0)
+	, m_usedSize		(0)
+	, m_commandBuffer	(DE_NULL)
+	, m_queue			(vk, device, queue, queueFamilyIndex)
+{
+	m_pending.token		= 0;
+	m_pending.usedSize	= 0;
+}
+
+StagingRing::~StagingRing (void)
+{
+	// m_queue waits for batches still in flight before the buffers are destroyed
+	discardPending();
+}
+
+StagingRing::Range StagingRing::allocate (const VkDeviceSize size, const VkDeviceSize alignment)
+{
+	DE_ASSERT(alignment > 0);
+
+	if (size > m_size)
+	{
+		// Too large for the ring, the batch owns a buffer of its own
+		const TemporaryBufferSp	temporary	(new TemporaryBuffer());
+
+		temporary->buffer		= createStagingBuffer(m_vk, m_device, size);
+		temporary->allocation	= allocateAndBind(m_vk, m_device, m_allocator, *temporary->buffer);
+
+		m_pending.temporaries.push_back(temporary);
+
+		{
+			const Range range =
+			{
+				*temporary->buffer,
+				0,
+				size,
+				temporary->allocation->getHostPtr()
+			};
+
+			return range;
+		}
+	}
+
+	for (;;)
+	{
+		const VkDeviceSize	alignedHead	= (m_head + alignment - 1) / alignment * alignment;
+		const bool			wrap		= alignedHead + size > m_size;
+		const VkDeviceSize	offset		= wrap ? 0 : alignedHead;
+		const VkDeviceSize	neededSize	= wrap ? (m_size - m_head) + size : (alignedHead - m_head) + size;
+
+		if (m_usedSize + neededSize <= m_size)
+		{
+			const Range range =
+			{
+				*m_buffer,
+				offset,
+				size,
+				(deUint8*)m_allocation->getHostPtr() + offset
+			};
+
+			m_head				= offset + size;
+			m_usedSize			+= neededSize;
+			m_pending.usedSize	+= neededSize;
+
+			return range;
+		}
+
+		// Current batch holds the rest of the ring
+		if (m_batches.empty())
+			submit();
+
+		wait(m_batches.front().token);
+	}
+}
+
+VkCommandBuffer StagingRing::getCommandBuffer (void)
+{
+	if (m_commandBuffer == DE_NULL)
+	{
+		m_commandBuffer = m_queue.getCommandBuffer();
+		beginCommandBuffer(m_vk, m_commandBuffer);
+	}
+
+	return m_commandBuffer;
+}
+
+StagingRing::Token StagingRing::submit (void)
+{
+	const VkCommandBuffer commandBuffer = getCommandBuffer();
+
+	endCommandBuffer(m_vk, commandBuffer);
+	flushAlloc(m_vk, m_device, *m_allocation);
+
+	for (size_t ndx = 0; ndx < m_pending.temporaries.size(); ndx++)
+		flushAlloc(m_vk, m_device, *m_pending.temporaries[ndx]->allocation);
+
+	m_commandBuffer	= DE_NULL;
+	m_pending.token	= m_queue.submit(commandBuffer);
+
+	m_batches.push_back(Batch());
+	std::swap(m_batches.back(), m_pending);
+
+	m_pending.usedSize = 0;
+
+	return m_batches.back().token;
+}
+
+void StagingRing::retireBatches (const Token lastToken)
+{
+	while (!m_batches.empty() && m_batches.front().token <= lastToken)
+	{
+		const Batch& batch = m_batches.front();
+
+		for (size_t ndx = 0; ndx < batch.temporaries.size(); ndx++)
+			invalidateAlloc(m_vk, m_device, *batch.temporaries[ndx]->allocation);
+
+		// Readback ranges are tightly packed like TextureLevel storage
+		for (size_t ndx = 0; ndx < batch.readbacks.size(); ndx++)
+			deMemcpy(batch.readbacks[ndx].dst->getAccess().getDataPtr(), batch.readbacks[ndx].hostPtr, batch.readbacks[ndx].size);
+
+		m_usedSize -= batch.usedSize;
+		m_batches.pop_front();
+	}
+
+	if (m_usedSize == 0)
+		m_head = 0;
+}
+
+void StagingRing::wait (const Token token)
+{
+	m_queue.wait(token);
+	invalidateAlloc(m_vk, m_device, *m_allocation);
+	retireBatches(token);
+}
+
+void StagingRing::finish (void)
+{
+	if (m_commandBuffer != DE_NULL || m_pending.usedSize > 0 || !m_pending.temporaries.empty())
+		submit();
+
+	if (!m_batches.empty())
+		wait(m_batches.back().token);
+}
+
+void StagingRing::discardPending (void)
+{
+	if (m_commandBuffer != DE_NULL)
+	{
+		m_queue.release(m_commandBuffer);
+		m_commandBuffer = DE_NULL;
+	}
+
+	// Space can only be reclaimed from the oldest batch, so discarded space is retired with the newest one
+	if (m_batches.empty())
+	{
+		m_head		= 0;
+		m_usedSize	= 0;
+	}
+	else
+		m_batches.back().usedSize += m_pending.usedSize;
+
+	// Nothing recorded against the pending temporaries was submitted
+	m_pending.usedSize = 0;
+	m_pending.temporaries.clear();
+
+	// Destinations of readbacks may not outlive the case
+	m_pending.readbacks.clear();
+
+	for (std::deque<Batch>::iterator batch = m_batches.begin(); batch != m_batches.end(); ++batch)
+		batch->readbacks.clear();
+}
+
+void StagingRing::copyToImage (const Range&								range,
+							   const std::vector<VkBufferImageCopy>&	regions,
+							   const VkImageAspectFlags					aspect,
+							   const deUint32							mipLevels,
+							   const deUint32							arrayLayers,
+							   const VkImage							image,
+							   const VkImageLayout						newLayout,
+							   const VkPipelineStageFlags				dstStageMask)
+{
+	std::vector<VkBufferImageCopy> ringRegions (regions);
+
+	for (size_t ndx = 0; ndx < ringRegions.size(); ndx++)
+	{
+		DE_ASSERT(ringRegions[ndx].bufferOffset < range.size);
+		ringRegions[ndx].bufferOffset += range.offset;
+	}
+
+	// Host write barrier of the helper covers the start of the ring up to the end of the range
+	copyBufferToImage(m_vk, getCommandBuffer(), range.buffer, range.offset + range.size, ringRegions, aspect, mipLevels, arrayLayers, image, newLayout, dstStageMask);
+}
+
+VkDeviceSize StagingRing::getCopyAlignment (const tcu::TextureFormat& format)
+{
+	return (VkDeviceSize)(4 * format.getPixelSize());
+}
+
+void StagingRing::readImage (tcu::TextureLevel&			dst,
+							 const VkImage				image,
+							 const VkImageAspectFlags	aspect,
+							 const VkAccessFlags		srcAccessMask,
+							 const VkImageLayout		oldLayout)
+{
+	const tcu::TextureFormat&	format		= dst.getFormat();
+	const VkDeviceSize			dataSize	= (VkDeviceSize)(dst.getWidth() * dst.getHeight() * format.getPixelSize());
+	const Range					range		= allocate(dataSize, getCopyAlignment(format));
+	Readback					readback;
+
+	DE_ASSERT(dst.getDepth() == 1);
+
+	copyImageToBuffer(m_vk, getCommandBuffer(), image, range.buffer, tcu::IVec2(dst.getWidth(), dst.getHeight()), srcAccessMask, oldLayout, 1u, aspect, range.offset);
+
+	readback.dst		= &dst;
+	readback.hostPtr	= range.hostPtr;
+	readback.size		= (size_t)dataSize;
+
+	m_pending.readbacks.push_back(readback);
+}
+
+} // vk
@@ -0,0 +1,175 @@
+#ifndef _VKSTAGINGRING_HPP
+#define _VKSTAGINGRING_HPP
+/*-------------------------------------------------------------------------
+ * Vulkan CTS Framework
+ * --------------------
+ *
+ * Copyright (c) 2019 Google Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ *//*!
+ * \file
+ * \brief Persistently mapped staging buffer ring
+ *//*--------------------------------------------------------------------*/
+
+#include "vkDefs.hpp"
+#include "vkRef.hpp"
+#include "vkMemUtil.hpp"
+#include "vkSubmissionQueue.hpp"
+#include "tcuTexture.hpp"
+#include "deUniquePtr.hpp"
+#include "deSharedPtr.hpp"
+
+#include <deque>
+#include <vector>
+
+namespace vk
+{
+
+/*--------------------------------------------------------------------*//*!
+ * \brief Host-visible staging buffer shared by uploads and readbacks
+ *
+ * The ring owns one persistently mapped buffer. Transfers sub-allocate
+ * ranges from it and record their copies into the command buffer of the
+ * current batch. submit() sends the batch; space used by a batch is
+ * reclaimed once the batch has completed.
+ *
+ * Uploads only need submit(): later submissions to the same queue are
+ * ordered after the copy by its barriers. Readbacks are written into
+ * their destination levels when their batch is retired by wait() or
+ * finish(), so any number of uploads and readbacks share one submission
+ * and one wait.
+ *
+ * allocate() may have to submit the current batch to make room, so
+ * getCommandBuffer() must be called again after each allocate(). Host
+ * pointers of a range stay valid until the first allocate() after its
+ * batch has been waited on.
+ *//*--------------------------------------------------------------------*/
+class StagingRing
+{
+public:
+	typedef SubmissionQueue::Token					Token;
+
+	struct Range
+	{
+		VkBuffer		buffer;
+		VkDeviceSize	offset;
+		VkDeviceSize	size;
+		void*			hostPtr;
+	};
+
+	enum
+	{
+		DEFAULT_SIZE	= 16u * 1024u * 1024u
+	};
+
+												StagingRing			(const DeviceInterface&	vk,
+																	 const VkDevice			device,
+																	 Allocator&				allocator,
+																	 const VkQueue			queue,
+																	 const deUint32			queueFamilyIndex,
+																	 const VkDeviceSize		size = (VkDeviceSize)DEFAULT_SIZE);
+												~StagingRing		(void);
+
+	VkDeviceSize								getSize				(void) const { return m_size; }
+
+	//! Sub-allocate a range, waiting for earlier batches if the ring is full.
+	//! Ranges larger than the ring get a temporary buffer that is released with the batch.
+	Range										allocate			(const VkDeviceSize size, const VkDeviceSize alignment);
+
+	//! Command buffer of the current batch, begun on first use
+	VkCommandBuffer								getCommandBuffer	(void);
+
+	//! Flush host writes and submit the current batch
+	Token										submit				(void);
+
+	//! Wait for a batch and make its device writes visible to the host
+	void										wait				(const Token token);
+
+	//! Submit the current batch and wait for all batches
+	void										finish				(void);
+
+	//! Drop the current batch without submitting it and forget readbacks not yet retired, e.g. after a failed case
+	void										discardPending		(void);
+
+	//! Record a copy from range to all levels and layers of image. Buffer offsets of regions are relative to the range.
+	void										copyToImage			(const Range&							range,
+																	 const std::vector<VkBufferImageCopy>&	regions,
+																	 const VkImageAspectFlags				aspect,
+																	 const deUint32							mipLevels,
+																	 const deUint32							arrayLayers,
+																	 const VkImage							image,
+																	 const VkImageLayout					newLayout		= VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL,
+																	 const VkPipelineStageFlags				dstStageMask	= VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT);
+
+	//! Record a readback of the first layer and level of a 2D image into dst, which must match the image in size
+	//! and texel layout. dst is written when the batch is retired. Leaves the image in transfer source layout.
+	void										readImage			(tcu::TextureLevel&						dst,
+																	 const VkImage							image,
+																	 const VkImageAspectFlags				aspect,
+																	 const VkAccessFlags					srcAccessMask,
+																	 const VkImageLayout					oldLayout);
+
+	//! Alignment of buffer-image copy offsets for format: a multiple of both 4 and the texel size
+	static VkDeviceSize							getCopyAlignment	(const tcu::TextureFormat& format);
+
+private:
+	struct Readback
+	{
+		tcu::TextureLevel*		dst;
+		const void*				hostPtr;
+		size_t					size;
+	};
+
+	struct TemporaryBuffer
+	{
+		Move<VkBuffer>			buffer;
+		de::MovePtr<Allocation>	allocation;
+	};
+
+	typedef de::SharedPtr<TemporaryBuffer>		TemporaryBufferSp;
+
+	struct Batch
+	{
+		Token							token;
+		VkDeviceSize					usedSize;		//!< Bytes of the ring used by the batch, including alignment and wrap padding
+		std::vector<TemporaryBufferSp>	temporaries;	//!< Buffers of ranges larger than the ring
+		std::vector<Readback>			readbacks;		//!< Written into their destinations when the batch is retired
+	};
+
+	void										retireBatches		(const Token lastToken);
+
+	const DeviceInterface&						m_vk;
+	const VkDevice								m_device;
+	Allocator&									m_allocator;
+	const VkDeviceSize							m_size;
+	const Unique<VkBuffer>						m_buffer;
+	const de::UniquePtr<Allocation>				m_allocation;
+
+	VkDeviceSize								m_head;			//!< Offset of the next allocation
+	VkDeviceSize								m_usedSize;		//!< Bytes used by submitted and pending batches
+	VkCommandBuffer								m_commandBuffer;
+	Batch										m_pending;		//!< Current batch, token is assigned on submit
+	std::deque<Batch>							m_batches;		//!< Submitted batches, oldest first
+
+	SubmissionQueue								m_queue;		//!< Destroyed first, waits for batches using the buffers
+
+	// "deleted"
+												StagingRing			(const StagingRing&);
+	StagingRing&								operator=			(const StagingRing&);
+};
+
+} // vk
+
+#endif // _VKSTAGINGRING_HPP
@@ -0,0 +1,226 @@
+/*-------------------------------------------------------------------------
+ * Vulkan CTS Framework
+ * --------------------
+ *
+ * Copyright (c) 2019 Google Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ *//*!
+ * \file
+ * \brief Queue submission helper with fence and command buffer reuse
+ *//*--------------------------------------------------------------------*/
+
+#include "vkSubmissionQueue.hpp"
+#include "vkRefUtil.hpp"
+
+namespace vk
+{
+
+using std::vector;
+
+SubmissionQueue::SubmissionQueue (const DeviceInterface&	vk,
+								  const VkDevice			device,
+								  const VkQueue				queue,
+								  const deUint32			queueFamilyIndex)
+	: m_vk			(vk)
+	, m_device		(device)
+	, m_queue		(queue)
+	, m_commandPool	(createCommandPool(vk, device, VK_COMMAND_POOL_CREATE_RESET_COMMAND_BUFFER_BIT, queueFamilyIndex))
+	, m_lastToken	(0)
+{
+}
+
+SubmissionQueue::~SubmissionQueue (void)
+{
+	// Objects in flight must not be destroyed; errors can't be reported from a destructor
+	if (!m_batches.empty())
+	{
+		vector<VkFence> fences;
+
+		for (std::deque<Batch>::const_iterator batchIter = m_batches.begin(); batchIter != m_batches.end(); ++batchIter)
+			fences.push_back(batchIter->fence);
+
+		m_vk.waitForFences(m_device, (deUint32)fences.size(), &fences[0], DE_TRUE, ~0ull);
+	}
+}
+
+VkCommandBuffer SubmissionQueue::getCommandBuffer (void)
+{
+	if (m_freeCommandBuffers.empty())
+	{
+		m_commandBuffers.push_back(CommandBufferSp(new Unique<VkCommandBuffer>(allocateCommandBuffer(m_vk, m_device, *m_commandPool, VK_COMMAND_BUFFER_LEVEL_PRIMARY))));
+		return **m_commandBuffers.back();
+	}
+	else
+	{
+		const VkCommandBuffer commandBuffer = m_freeCommandBuffers.back();
+
+		VK_CHECK(m_vk.resetCommandBuffer(commandBuffer, 0u));
+		m_freeCommandBuffers.pop_back();
+
+		return commandBuffer;
+	}
+}
+
+VkFence SubmissionQueue::getFence (void)
+{
+	if (m_freeFences.empty())
+	{
+		m_fences.push_back(FenceSp(new Unique<VkFence>(createFence(m_vk, m_device))));
+		return **m_fences.back();
+	}
+	else
+	{
+		const VkFence fence = m_freeFences.back();
+
+		m_freeFences.pop_back();
+
+		return fence;
+	}
+}
+
+void SubmissionQueue::release (const VkCommandBuffer commandBuffer)
+{
+	// Reset when handed out again by getCommandBuffer()
+	m_freeCommandBuffers.push_back(commandBuffer);
+}
+
+void SubmissionQueue::add (const VkCommandBuffer commandBuffer)
+{
+	m_pending.push_back(commandBuffer);
+}
+
+SubmissionQueue::Token SubmissionQueue::submit (void)
+{
+	DE_ASSERT(!m_pending.empty());
+
+	retireCompletedBatches();
+
+	{
+		Batch				batch;
+		const VkSubmitInfo	submitInfo	=
+		{
+			VK_STRUCTURE_TYPE_SUBMIT_INFO,			// VkStructureType				sType;
+			DE_NULL,								// const void*					pNext;
+			0u,										// deUint32						waitSemaphoreCount;
+			DE_NULL,								// const VkSemaphore*			pWaitSemaphores;
+			(const VkPipelineStageFlags*)DE_NULL,	// const VkPipelineStageFlags*	pWaitDstStageMask;
+			(deUint32)m_pending.size(),				// deUint32						commandBufferCount;
+			&m_pending[0],							// const VkCommandBuffer*		pCommandBuffers;
+			0u,										// deUint32						signalSemaphoreCount;
+			DE_NULL,								// const VkSemaphore*			pSignalSemaphores;
+		};
+
+		batch.fence	= getFence();
+
+		{
+			const VkResult result = m_vk.queueSubmit(m_queue, 1u, &submitInfo, batch.fence);
+
+			if (result != VK_SUCCESS)
+			{
+				// Fence was not submitted and is still unsignaled
+				m_freeFences.push_back(batch.fence);
+				VK_CHECK(result);
+			}
+		}
+
+		batch.token	= ++m_lastToken;
+		batch.commandBuffers.swap(m_pending);
+
+		m_batches.push_back(batch);
+	}
+
+	return m_lastToken;
+}
+
+SubmissionQueue::Token SubmissionQueue::submit (const VkCommandBuffer commandBuffer)
+{
+	add(commandBuffer);
+	return submit();
+}
+
+void SubmissionQueue::retireBatches (const Token lastToken)
+{
+	vector<VkFence> fences;
+
+	while (!m_batches.empty() && m_batches.front().token <= lastToken)
+	{
+		const Batch& batch = m_batches.front();
+
+		fences.push_back(batch.fence);
+		m_freeCommandBuffers.insert(m_freeCommandBuffers.end(), batch.commandBuffers.begin(), batch.commandBuffers.end());
+
+		m_batches.pop_front();
+	}
+
+	if (!fences.empty())
+	{
+		VK_CHECK(m_vk.resetFences(m_device, (deUint32)fences.size(), &fences[0]));
+		m_freeFences.insert(m_freeFences.end(), fences.begin(), fences.end());
+	}
+}
+
+void SubmissionQueue::retireCompletedBatches (void)
+{
+	Token lastCompleted = 0;
+
+	for (std::deque<Batch>::const_iterator batchIter = m_batches.begin(); batchIter != m_batches.end(); ++batchIter)
+	{
+		const VkResult result = m_vk.getFenceStatus(m_device, batchIter->fence);
+
+		if (result == VK_NOT_READY)
+			break;
+
+		VK_CHECK(result);
+		lastCompleted = batchIter->token;
+	}
+
+	retireBatches(lastCompleted);
+}
+
+void SubmissionQueue::wait (const Token token)
+{
+	DE_ASSERT(token <= m_lastToken);
+
+	vector<VkFence> fences;
+
+	for (std::deque<Batch>::const_iterator batchIter = m_batches.begin(); batchIter != m_batches.end() && batchIter->token <= token; ++batchIter)
+		fences.push_back(batchIter->fence);
+
+	if (fences.empty())
+		return;
+
+	VK_CHECK(m_vk.waitForFences(m_device, (deUint32)fences.size(), &fences[0], DE_TRUE, ~0ull));
+
+	retireBatches(token);
+}
+
+void SubmissionQueue::waitIdle (void)
+{
+	wait(m_lastToken);
+}
+
+bool SubmissionQueue::isComplete (const Token token)
+{
+	retireCompletedBatches();
+
+	return m_batches.empty() || m_batches.front().token > token;
+}
+
+void SubmissionQueue::submitAndWait (const VkCommandBuffer commandBuffer)
+{
+	wait(submit(commandBuffer));
+}
+
+} // vk
@@ -0,0 +1,117 @@
+#ifndef _VKSUBMISSIONQUEUE_HPP
+#define _VKSUBMISSIONQUEUE_HPP
+/*-------------------------------------------------------------------------
+ * Vulkan CTS Framework
+ * --------------------
+ *
+ * Copyright (c) 2019 Google Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ *//*!
+ * \file
+ * \brief Queue submission helper with fence and command buffer reuse
+ *//*--------------------------------------------------------------------*/
+
+#include "vkDefs.hpp"
+#include "vkRef.hpp"
+#include "deSharedPtr.hpp"
+
+#include <vector>
+#include <deque>
+
+namespace vk
+{
+
+/*--------------------------------------------------------------------*//*!
+ * \brief Batched queue submission with recycled fences and command buffers
+ *
+ * Command buffers are allocated from a pool owned by the queue and added
+ * to a pending batch. submit() sends all pending command buffers in a
+ * single vkQueueSubmit and returns a token identifying the batch. The
+ * caller can do host-side work and later wait() for the token. Tokens
+ * increase monotonically, so waiting on a token also waits for all
+ * batches submitted before it.
+ *
+ * Fences and command buffers of completed batches are reset and reused
+ * for later submissions instead of being destroyed.
+ *//*--------------------------------------------------------------------*/
+class SubmissionQueue
+{
+public:
+	typedef deUint64							Token;
+
+												SubmissionQueue			(const DeviceInterface&	vk,
+																		 const VkDevice			device,
+																		 const VkQueue			queue,
+																		 const deUint32			queueFamilyIndex);
+												~SubmissionQueue		(void);
+
+	//! Get a command buffer in initial state. It is recycled once the batch it is submitted in has completed.
+	VkCommandBuffer								getCommandBuffer		(void);
+
+	//! Return a command buffer from getCommandBuffer() that will not be submitted
+	void										release					(const VkCommandBuffer commandBuffer);
+
+	//! Add a recorded command buffer to the pending batch
+	void										add						(const VkCommandBuffer commandBuffer);
+
+	//! Submit all pending command buffers in one batch
+	Token										submit					(void);
+	Token										submit					(const VkCommandBuffer commandBuffer);
+
+	//! Wait until the batch identified by token and all batches before it have completed
+	void										wait					(const Token token);
+	void										waitIdle				(void);
+	bool										isComplete				(const Token token);
+
+	//! Submit a single command buffer and wait for it, reusing pooled objects
+	void										submitAndWait			(const VkCommandBuffer commandBuffer);
+
+private:
+	typedef de::SharedPtr<Unique<VkFence> >			FenceSp;
+	typedef de::SharedPtr<Unique<VkCommandBuffer> >	CommandBufferSp;
+
+	struct Batch
+	{
+		Token							token;
+		VkFence							fence;
+		std::vector<VkCommandBuffer>	commandBuffers;
+	};
+
+	VkFence										getFence				(void);
+	void										retireBatches			(const Token lastToken);
+	void										retireCompletedBatches	(void);
+
+	const DeviceInterface&						m_vk;
+	const VkDevice								m_device;
+	const VkQueue								m_queue;
+	const Unique<VkCommandPool>					m_commandPool;
+
+	std::vector<FenceSp>						m_fences;
+	std::vector<CommandBufferSp>				m_commandBuffers;
+	std::vector<VkFence>						m_freeFences;
+	std::vector<VkCommandBuffer>				m_freeCommandBuffers;
+
+	std::vector<VkCommandBuffer>				m_pending;
+	std::deque<Batch>							m_batches;				//!< Submitted batches, oldest first
+	Token										m_lastToken;
+
+	// "deleted"
+												SubmissionQueue			(const SubmissionQueue&);
+	SubmissionQueue&							operator=				(const SubmissionQueue&);
+};
+
+} // vk
+
+#endif // _VKSUBMISSIONQUEUE_HPP
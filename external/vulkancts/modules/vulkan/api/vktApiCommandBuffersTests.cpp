@@ -36,11 +36,14 @@
 #include "vkTypeUtil.hpp"
 #include "vkAllocationCallbackUtil.hpp"
 #include "vkCmdUtil.hpp"
+#include "vkBarrierUtil.hpp"
+#include "vkSubmissionQueue.hpp"
 #include "vktApiCommandBuffersTests.hpp"
 #include "vktApiBufferComputeInstance.hpp"
 #include "vktApiComputeInstanceResultBuffer.hpp"
 #include "deSharedPtr.hpp"
 #include <sstream>
+#include <set>
 
 namespace vkt
 {
@@ -3796,6 +3799,119 @@ void genComputeIncrementSource (SourceCollections& programCollection)
 	programCollection.glslSources.add("compute_increment") << glu::ComputeSource(bufIncrement.str());
 }
 
+tcu::TestStatus submissionQueueTest (Context& context)
+{
+	const VkDevice							vkDevice				= context.getDevice();
+	const DeviceInterface&					vk						= context.getDeviceInterface();
+	Allocator&								allocator				= context.getDefaultAllocator();
+	tcu::TestLog&							log						= context.getTestContext().getLog();
+	const deUint32							numBatches				= 8u;
+	const VkDeviceSize						bufferSize				= (numBatches + 1u) * sizeof(deUint32);
+
+	const VkBufferCreateInfo				bufferParams			=
+	{
+		VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO,						// sType
+		DE_NULL,													// pNext
+		0u,															// flags
+		bufferSize,													// size
+		VK_BUFFER_USAGE_TRANSFER_DST_BIT,							// usage
+		VK_SHARING_MODE_EXCLUSIVE,									// sharingMode
+		0u,															// queueFamilyIndexCount
+		DE_NULL,													// pQueueFamilyIndices
+	};
+	const Unique<VkBuffer>					buffer					(createBuffer(vk, vkDevice, &bufferParams));
+	const de::UniquePtr<Allocation>			bufferAlloc				(allocator.allocate(getBufferMemoryRequirements(vk, vkDevice, *buffer), MemoryRequirement::HostVisible));
+	const deUint32*							bufferPtr				= (const deUint32*)bufferAlloc->getHostPtr();
+
+	SubmissionQueue							queue					(vk, vkDevice, context.getUniversalQueue(), context.getUniversalQueueFamilyIndex());
+	std::vector<SubmissionQueue::Token>		tokens;
+	std::set<VkCommandBuffer>				usedCommandBuffers;
+
+	VK_CHECK(vk.bindBufferMemory(vkDevice, *buffer, bufferAlloc->getMemory(), bufferAlloc->getOffset()));
+
+	// Each command buffer writes its own value to its own slot
+	for (deUint32 ndx = 0; ndx < numBatches + 1u; ++ndx)
+	{
+		const VkCommandBuffer		cmdBuffer	= queue.getCommandBuffer();
+		const VkBufferMemoryBarrier	barrier		= makeBufferMemoryBarrier(VK_ACCESS_TRANSFER_WRITE_BIT, VK_ACCESS_HOST_READ_BIT, *buffer, ndx * sizeof(deUint32), sizeof(deUint32));
+
+		beginCommandBuffer(vk, cmdBuffer);
+		vk.cmdFillBuffer(cmdBuffer, *buffer, ndx * sizeof(deUint32), sizeof(deUint32), ndx + 1u);
+		vk.cmdPipelineBarrier(cmdBuffer, VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_HOST_BIT, 0u, 0u, DE_NULL, 1u, &barrier, 0u, DE_NULL);
+		endCommandBuffer(vk, cmdBuffer);
+
+		usedCommandBuffers.insert(cmdBuffer);
+
+		// Last batch holds two command buffers
+		if (ndx + 1u == numBatches)
+		{
+			queue.add(cmdBuffer);
+			continue;
+		}
+
+		tokens.push_back(queue.submit(cmdBuffer));
+
+		if (tokens.size() > 1 && tokens[tokens.size() - 1] <= tokens[tokens.size() - 2])
+			return tcu::TestStatus::fail("Tokens are not increasing");
+	}
+
+	if (tokens.size() != numBatches || usedCommandBuffers.size() != numBatches + 1u)
+		return tcu::TestStatus::fail("Unexpected number of batches or command buffers");
+
+	// Waiting for a token waits for all batches before it
+	queue.wait(tokens[numBatches / 2u]);
+
+	if (!queue.isComplete(tokens[0]) || !queue.isComplete(tokens[numBatches / 2u]))
+		return tcu::TestStatus::fail("Batch not complete after waiting for it");
+
+	invalidateAlloc(vk, vkDevice, *bufferAlloc);
+
+	for (deUint32 ndx = 0; ndx <= numBatches / 2u; ++ndx)
+	{
+		if (bufferPtr[ndx] != ndx + 1u)
+		{
+			log << tcu::TestLog::Message << "Slot " << ndx << ": expected " << ndx + 1u << ", got " << bufferPtr[ndx] << tcu::TestLog::EndMessage;
+			return tcu::TestStatus::fail("Batch before waited token was not executed");
+		}
+	}
+
+	queue.waitIdle();
+
+	if (!queue.isComplete(tokens.back()))
+		return tcu::TestStatus::fail("Batch not complete after waitIdle()");
+
+	invalidateAlloc(vk, vkDevice, *bufferAlloc);
+
+	for (deUint32 ndx = 0; ndx < numBatches + 1u; ++ndx)
+	{
+		if (bufferPtr[ndx] != ndx + 1u)
+		{
+			log << tcu::TestLog::Message << "Slot " << ndx << ": expected " << ndx + 1u << ", got " << bufferPtr[ndx] << tcu::TestLog::EndMessage;
+			return tcu::TestStatus::fail("Submitted command buffer was not executed");
+		}
+	}
+
+	// Command buffers of completed batches are recycled
+	{
+		const VkCommandBuffer recycled = queue.getCommandBuffer();
+
+		if (usedCommandBuffers.find(recycled) == usedCommandBuffers.end())
+			return tcu::TestStatus::fail("Command buffer of a completed batch was not reused");
+
+		// A released command buffer is handed out again
+		queue.release(recycled);
+
+		if (queue.getCommandBuffer() != recycled)
+			return tcu::TestStatus::fail("Released command buffer was not reused");
+
+		beginCommandBuffer(vk, recycled);
+		endCommandBuffer(vk, recycled);
+		queue.submitAndWait(recycled);
+	}
+
+	return tcu::TestStatus::pass("Batches were executed in order and objects were reused");
+}
+
 } // anonymous
 
 tcu::TestCaseGroup* createCommandBuffersTests (tcu::TestContext& testCtx)
@@ -3844,6 +3960,7 @@ tcu::TestCaseGroup* createCommandBuffersTests (tcu::TestContext& testCtx)
 	addFunctionCase				(commandBuffersTests.get(), "submit_wait_many_semaphores",		"", submitBufferWaitManySemaphores);
 	addFunctionCase				(commandBuffersTests.get(), "submit_null_fence",				"", submitBufferNullFence);
 	addFunctionCase				(commandBuffersTests.get(), "submit_two_buffers_one_buffer_null_with_fence", "", submitTwoBuffersOneBufferNullWithFence);
+	addFunctionCase				(commandBuffersTests.get(), "submission_queue",					"",	submissionQueueTest);
 	/* 19.5. Secondary Command Buffer Execution (5.6 in VK 1.0 Spec) */
 	addFunctionCase				(commandBuffersTests.get(), "secondary_execute",				"",	executeSecondaryBufferTest);
 	addFunctionCase				(commandBuffersTests.get(), "secondary_execute_twice",			"",	executeSecondaryBufferTwiceTest);
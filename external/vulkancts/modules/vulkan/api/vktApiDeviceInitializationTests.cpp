@@ -1567,6 +1567,206 @@ tcu::TestStatus createInstanceDeviceIntentionalAllocFail (Context& context)
 	return tcu::TestStatus::pass("Pass");
 }
 
+VkDeviceQueueCreateInfo makeQueueCreateInfo (deUint32 queueFamilyIndex, deUint32 queueCount, const float* pQueuePriorities)
+{
+	const VkDeviceQueueCreateInfo	queueCreateInfo	=
+	{
+		VK_STRUCTURE_TYPE_DEVICE_QUEUE_CREATE_INFO,		// VkStructureType				sType;
+		DE_NULL,										// const void*					pNext;
+		(VkDeviceQueueCreateFlags)0u,					// VkDeviceQueueCreateFlags		flags;
+		queueFamilyIndex,								// deUint32						queueFamilyIndex;
+		queueCount,										// deUint32						queueCount;
+		pQueuePriorities,								// const float*					pQueuePriorities;
+	};
+
+	return queueCreateInfo;
+}
+
+VkDeviceCreateInfo makeDeviceCreateInfo (const void*						pNext,
+										 deUint32							queueCreateInfoCount,
+										 const VkDeviceQueueCreateInfo*		pQueueCreateInfos,
+										 deUint32							enabledExtensionCount,
+										 const char* const*					ppEnabledExtensionNames,
+										 const VkPhysicalDeviceFeatures*	pEnabledFeatures)
+{
+	const VkDeviceCreateInfo	deviceCreateInfo	=
+	{
+		VK_STRUCTURE_TYPE_DEVICE_CREATE_INFO,			// VkStructureType					sType;
+		pNext,											// const void*						pNext;
+		(VkDeviceCreateFlags)0u,						// VkDeviceCreateFlags				flags;
+		queueCreateInfoCount,							// deUint32							queueCreateInfoCount;
+		pQueueCreateInfos,								// const VkDeviceQueueCreateInfo*	pQueueCreateInfos;
+		0u,												// deUint32							enabledLayerCount;
+		DE_NULL,										// const char* const*				ppEnabledLayerNames;
+		enabledExtensionCount,							// deUint32							enabledExtensionCount;
+		ppEnabledExtensionNames,						// const char* const*				ppEnabledExtensionNames;
+		pEnabledFeatures,								// const VkPhysicalDeviceFeatures*	pEnabledFeatures;
+	};
+
+	return deviceCreateInfo;
+}
+
+tcu::TestStatus deviceCreateInfoKeyTest (Context& context)
+{
+	tcu::TestLog&									log								= context.getTestContext().getLog();
+	tcu::ResultCollector							resultCollector					(log);
+	const float										priorities[]					= { 1.0f, 0.5f };
+	const float										otherPriorities[]				= { 0.5f, 0.5f };
+	const VkDeviceQueueCreateInfo					queueInfos[]					= { makeQueueCreateInfo(0u, 1u, priorities), makeQueueCreateInfo(1u, 2u, priorities) };
+	const VkDeviceQueueCreateInfo					reorderedQueueInfos[]			= { queueInfos[1], queueInfos[0] };
+	const VkDeviceQueueCreateInfo					otherQueueInfos[]				= { makeQueueCreateInfo(0u, 1u, otherPriorities), queueInfos[1] };
+	const char* const								extensions[]					= { "VK_KHR_maintenance1", "VK_KHR_maintenance2" };
+	const char* const								reorderedExtensions[]			= { extensions[1], extensions[0] };
+	VkPhysicalDeviceFeatures						features;
+	VkPhysicalDeviceFeatures						otherFeatures;
+	VkPhysicalDeviceScalarBlockLayoutFeaturesEXT	scalarBlockLayoutFeatures[2];
+	VkPhysicalDeviceHostQueryResetFeaturesEXT		hostQueryResetFeatures[2];
+	VkMemoryAllocateFlagsInfo						unknownStruct;
+
+	deMemset(&features, 0, sizeof(features));
+	deMemset(&unknownStruct, 0, sizeof(unknownStruct));
+
+	features.robustBufferAccess	= VK_TRUE;
+	otherFeatures				= features;
+	otherFeatures.shaderInt64	= VK_TRUE;
+
+	for (int chainNdx = 0; chainNdx < 2; chainNdx++)
+	{
+		deMemset(&scalarBlockLayoutFeatures[chainNdx], 0, sizeof(scalarBlockLayoutFeatures[chainNdx]));
+		deMemset(&hostQueryResetFeatures[chainNdx], 0, sizeof(hostQueryResetFeatures[chainNdx]));
+
+		scalarBlockLayoutFeatures[chainNdx].sType				= VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SCALAR_BLOCK_LAYOUT_FEATURES_EXT;
+		scalarBlockLayoutFeatures[chainNdx].scalarBlockLayout	= VK_TRUE;
+		hostQueryResetFeatures[chainNdx].sType					= VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_HOST_QUERY_RESET_FEATURES_EXT;
+		hostQueryResetFeatures[chainNdx].hostQueryReset			= VK_TRUE;
+	}
+
+	// Same structures chained in opposite orders
+	scalarBlockLayoutFeatures[0].pNext	= &hostQueryResetFeatures[0];
+	hostQueryResetFeatures[1].pNext		= &scalarBlockLayoutFeatures[1];
+	unknownStruct.sType					= VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_FLAGS_INFO;
+
+	{
+		const DeviceCreateInfoKey	key					(makeDeviceCreateInfo(&scalarBlockLayoutFeatures[0], DE_LENGTH_OF_ARRAY(queueInfos), queueInfos, DE_LENGTH_OF_ARRAY(extensions), extensions, &features));
+		const DeviceCreateInfoKey	reorderedKey		(makeDeviceCreateInfo(&hostQueryResetFeatures[1], DE_LENGTH_OF_ARRAY(reorderedQueueInfos), reorderedQueueInfos, DE_LENGTH_OF_ARRAY(reorderedExtensions), reorderedExtensions, &features));
+		const DeviceCreateInfoKey	otherPriorityKey	(makeDeviceCreateInfo(&scalarBlockLayoutFeatures[0], DE_LENGTH_OF_ARRAY(otherQueueInfos), otherQueueInfos, DE_LENGTH_OF_ARRAY(extensions), extensions, &features));
+		const DeviceCreateInfoKey	otherExtensionsKey	(makeDeviceCreateInfo(&scalarBlockLayoutFeatures[0], DE_LENGTH_OF_ARRAY(queueInfos), queueInfos, 1u, extensions, &features));
+		const DeviceCreateInfoKey	otherFeaturesKey	(makeDeviceCreateInfo(&scalarBlockLayoutFeatures[0], DE_LENGTH_OF_ARRAY(queueInfos), queueInfos, DE_LENGTH_OF_ARRAY(extensions), extensions, &otherFeatures));
+		const DeviceCreateInfoKey	otherChainKey		(makeDeviceCreateInfo(&hostQueryResetFeatures[0], DE_LENGTH_OF_ARRAY(queueInfos), queueInfos, DE_LENGTH_OF_ARRAY(extensions), extensions, &features));
+		const DeviceCreateInfoKey	unknownStructKey	(makeDeviceCreateInfo(&unknownStruct, DE_LENGTH_OF_ARRAY(queueInfos), queueInfos, DE_LENGTH_OF_ARRAY(extensions), extensions, &features));
+
+		resultCollector.check(key.isValid() && reorderedKey.isValid(), "Key with known pNext structures is not valid");
+		resultCollector.check(key == reorderedKey && key.getHash() == reorderedKey.getHash(), "Queue, extension or pNext ordering changed the key");
+		resultCollector.check(key != otherPriorityKey, "Queue priorities are ignored by the key");
+		resultCollector.check(key != otherExtensionsKey, "Enabled extensions are ignored by the key");
+		resultCollector.check(key != otherFeaturesKey, "Enabled features are ignored by the key");
+		resultCollector.check(key != otherChainKey, "pNext structures are ignored by the key");
+		resultCollector.check(!unknownStructKey.isValid() && unknownStructKey != unknownStructKey, "Key with unknown pNext structure must be invalid and never equal");
+	}
+
+	return tcu::TestStatus(resultCollector.getResult(), resultCollector.getMessage());
+}
+
+tcu::TestStatus devicePoolReuseTest (Context& context)
+{
+	tcu::TestLog&					log					= context.getTestContext().getLog();
+	tcu::ResultCollector			resultCollector		(log);
+	const deUint32					queueFamilyIndex	= context.getUniversalQueueFamilyIndex();
+	const float						queuePriority		= 1.0f;
+	const float						samePriority		= 1.0f;
+	const VkDeviceQueueCreateInfo	queueInfo			= makeQueueCreateInfo(queueFamilyIndex, 1u, &queuePriority);
+	const VkDeviceQueueCreateInfo	sameQueueInfo		= makeQueueCreateInfo(queueFamilyIndex, 1u, &samePriority);
+	const VkDeviceCreateInfo		createInfo			= makeDeviceCreateInfo(DE_NULL, 1u, &queueInfo, 0u, DE_NULL, DE_NULL);
+	const VkDeviceCreateInfo		sameCreateInfo		= makeDeviceCreateInfo(DE_NULL, 1u, &sameQueueInfo, 0u, DE_NULL, DE_NULL);
+	DevicePool						pool				(context.getPlatformInterface(), context.getInstance(), context.getInstanceInterface(), context.getPhysicalDevice(), 2u);
+	VkDevice						firstDevice			= DE_NULL;
+
+	{
+		const de::UniquePtr<PooledDevice>	device	(pool.getDevice(createInfo));
+
+		firstDevice = device->get();
+
+		resultCollector.check(!pool.hasIdleDevice(createInfo), "Device in use is reported idle");
+	}
+
+	resultCollector.check(pool.getNumDevices() == 1 && pool.hasIdleDevice(createInfo), "Released device was not kept in the pool");
+
+	{
+		// Identical contents in different memory must get the same device
+		const de::UniquePtr<PooledDevice>	device	(pool.getDevice(sameCreateInfo));
+
+		resultCollector.check(device->get() == firstDevice && pool.getNumDevices() == 1, "Device was not reused for an identical create info");
+
+		{
+			const VkQueue	queue	= getDeviceQueue(device->getDeviceInterface(), device->get(), queueFamilyIndex, 0u);
+
+			VK_CHECK(device->getDeviceInterface().queueWaitIdle(queue));
+		}
+
+		{
+			// A device in use is never handed out twice
+			const de::UniquePtr<PooledDevice>	otherDevice	(pool.getDevice(createInfo));
+
+			resultCollector.check(otherDevice->get() != device->get() && pool.getNumDevices() == 2, "Device in use was handed out again");
+		}
+	}
+
+	resultCollector.check(pool.getNumDevices() == 2 && pool.hasIdleDevice(createInfo), "Released devices were not kept in the pool");
+
+	return tcu::TestStatus(resultCollector.getResult(), resultCollector.getMessage());
+}
+
+tcu::TestStatus devicePoolEvictionTest (Context& context)
+{
+	tcu::TestLog&					log					= context.getTestContext().getLog();
+	tcu::ResultCollector			resultCollector		(log);
+	const deUint32					queueFamilyIndex	= context.getUniversalQueueFamilyIndex();
+	const size_t					maxDevices			= 2;
+	const float						priorities[]		= { 1.0f, 0.5f, 0.25f };
+	const VkDeviceQueueCreateInfo	queueInfos[]		=
+	{
+		makeQueueCreateInfo(queueFamilyIndex, 1u, &priorities[0]),
+		makeQueueCreateInfo(queueFamilyIndex, 1u, &priorities[1]),
+		makeQueueCreateInfo(queueFamilyIndex, 1u, &priorities[2]),
+	};
+	const VkDeviceCreateInfo		createInfoA			= makeDeviceCreateInfo(DE_NULL, 1u, &queueInfos[0], 0u, DE_NULL, DE_NULL);
+	const VkDeviceCreateInfo		createInfoB			= makeDeviceCreateInfo(DE_NULL, 1u, &queueInfos[1], 0u, DE_NULL, DE_NULL);
+	const VkDeviceCreateInfo		createInfoC			= makeDeviceCreateInfo(DE_NULL, 1u, &queueInfos[2], 0u, DE_NULL, DE_NULL);
+	DevicePool						pool				(context.getPlatformInterface(), context.getInstance(), context.getInstanceInterface(), context.getPhysicalDevice(), maxDevices);
+
+	// Each lease is released right away
+	pool.getDevice(createInfoA);
+	pool.getDevice(createInfoB);
+
+	resultCollector.check(pool.getNumDevices() == maxDevices && pool.hasIdleDevice(createInfoA) && pool.hasIdleDevice(createInfoB), "Devices below the limit were not kept");
+
+	// Reusing A makes B the least recently used device
+	pool.getDevice(createInfoA);
+	pool.getDevice(createInfoC);
+
+	resultCollector.check(pool.getNumDevices() == maxDevices, "Pool exceeds the device limit");
+	resultCollector.check(pool.hasIdleDevice(createInfoA) && pool.hasIdleDevice(createInfoC), "Recently used device was evicted");
+	resultCollector.check(!pool.hasIdleDevice(createInfoB), "Least recently used device was not evicted");
+
+	{
+		// Devices in use are never evicted, the pool shrinks back to the limit once they are released
+		de::MovePtr<PooledDevice>	deviceA	= pool.getDevice(createInfoA);
+		de::MovePtr<PooledDevice>	deviceC	= pool.getDevice(createInfoC);
+		de::MovePtr<PooledDevice>	deviceB	= pool.getDevice(createInfoB);
+
+		resultCollector.check(pool.getNumDevices() == 3, "Device in use was evicted");
+
+		deviceA.clear();
+		deviceC.clear();
+		deviceB.clear();
+	}
+
+	resultCollector.check(pool.getNumDevices() == maxDevices, "Pool was not shrunk back to the limit");
+	resultCollector.check(!pool.hasIdleDevice(createInfoA) && pool.hasIdleDevice(createInfoB) && pool.hasIdleDevice(createInfoC), "Wrong device was evicted after release");
+
+	return tcu::TestStatus(resultCollector.getResult(), resultCollector.getMessage());
+}
+
 } // anonymous
 
 tcu::TestCaseGroup* createDeviceInitializationTests (tcu::TestContext& testCtx)
@@ -1588,6 +1788,9 @@ tcu::TestCaseGroup* createDeviceInitializationTests (tcu::TestContext& testCtx)
 	addFunctionCase(deviceInitializationTests.get(), "create_device_queue2",							"", createDeviceQueue2Test);
 	addFunctionCase(deviceInitializationTests.get(), "create_device_queue2_unmatched_flags",			"", createDeviceQueue2UnmatchedFlagsTest);
 	addFunctionCase(deviceInitializationTests.get(), "create_instance_device_intentional_alloc_fail",	"", createInstanceDeviceIntentionalAllocFail);
+	addFunctionCase(deviceInitializationTests.get(), "device_create_info_key",							"", deviceCreateInfoKeyTest);
+	addFunctionCase(deviceInitializationTests.get(), "device_pool_reuse",								"", devicePoolReuseTest);
+	addFunctionCase(deviceInitializationTests.get(), "device_pool_eviction",							"", devicePoolEvictionTest);
 
 	return deviceInitializationTests.release();
 }
@@ -477,7 +477,9 @@ BlendTestInstance::BlendTestInstance (Context&									context,
 																		   DE_NULL,								// const VkPipelineRasterizationStateCreateInfo* rasterizationStateCreateInfo
 																		   DE_NULL,								// const VkPipelineMultisampleStateCreateInfo*   multisampleStateCreateInfo
 																		   DE_NULL,								// const VkPipelineDepthStencilStateCreateInfo*  depthStencilStateCreateInfo
-																		   &colorBlendStateParams);				// const VkPipelineColorBlendStateCreateInfo*    colorBlendStateCreateInfo
+																		   &colorBlendStateParams,				// const VkPipelineColorBlendStateCreateInfo*    colorBlendStateCreateInfo
+																		   DE_NULL,								// const VkPipelineDynamicStateCreateInfo*       dynamicStateCreateInfo
+																		   m_context.getPipelineCache());		// const VkPipelineCache                         pipelineCache
 		}
 	}
 
@@ -818,12 +820,7 @@ tcu::TestStatus BlendTestInstance::verifyImage (void)
 
 	// Compare result with reference image
 	{
-		const DeviceInterface&				vk							= m_context.getDeviceInterface();
-		const VkDevice						vkDevice					= m_context.getDevice();
-		const VkQueue						queue						= m_context.getUniversalQueue();
-		const deUint32						queueFamilyIndex			= m_context.getUniversalQueueFamilyIndex();
-		SimpleAllocator						allocator					(vk, vkDevice, getPhysicalDeviceMemoryProperties(m_context.getInstanceInterface(), m_context.getPhysicalDevice()));
-		de::UniquePtr<tcu::TextureLevel>	result						(readColorAttachment(vk, vkDevice, queue, queueFamilyIndex, allocator, *m_colorImage, m_colorFormat, m_renderSize).release());
+		de::UniquePtr<tcu::TextureLevel>	result						(readColorAttachment(m_context.getStagingRing(), *m_colorImage, m_colorFormat, m_renderSize).release());
 		const tcu::Vec4						threshold					(getFormatThreshold(tcuColorFormat));
 		tcu::TextureLevel					refLevel;
 
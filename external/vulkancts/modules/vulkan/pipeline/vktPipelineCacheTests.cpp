@@ -26,6 +26,7 @@
 #include "vktPipelineClearUtil.hpp"
 #include "vktPipelineImageUtil.hpp"
 #include "vktPipelineVertexUtil.hpp"
+#include "vktPipelineMakeUtil.hpp"
 #include "vktTestCase.hpp"
 #include "vktTestCaseUtil.hpp"
 #include "vkImageUtil.hpp"
@@ -38,13 +39,16 @@
 #include "vkTypeUtil.hpp"
 #include "vkCmdUtil.hpp"
 #include "vkObjUtil.hpp"
+#include "vkSharedPipelineCache.hpp"
 #include "tcuImageCompare.hpp"
 #include "deUniquePtr.hpp"
 #include "deMemory.h"
+#include "deFile.h"
 #include "tcuTestLog.hpp"
 
 #include <sstream>
 #include <vector>
+#include <cstdio>
 
 namespace vkt
 {
@@ -2029,6 +2033,162 @@ InvalidBlobTestInstance::~InvalidBlobTestInstance (void)
 	delete[] m_data;
 	delete[] m_zeroBlock;
 }
+// Shared pipeline cache file tests
+
+const char* const	s_sharedCacheFilename	= "shared-pipeline-cache-test.bin";
+
+void initSharedCachePrograms (SourceCollections& programCollection)
+{
+	programCollection.glslSources.add("comp") << glu::ComputeSource(
+		"#version 310 es\n"
+		"layout(local_size_x = 1) in;\n"
+		"void main (void)\n"
+		"{\n"
+		"}\n");
+}
+
+de::MovePtr<SharedPipelineCache> createSharedCache (Context& context)
+{
+	return de::MovePtr<SharedPipelineCache>(new SharedPipelineCache(context.getPlatformInterface(), context.getInstance(), context.getDeviceInterface(),
+																	context.getDevice(), context.getDeviceProperties(), s_sharedCacheFilename));
+}
+
+//! Create a compute pipeline through the interface of the shared cache and get the statistics after creation
+PipelineCacheStats createSharedCachePipeline (Context& context, const SharedPipelineCache& cache)
+{
+	const DeviceInterface&			vk				= cache.getDeviceInterface();
+	const VkDevice					device			= context.getDevice();
+	const Unique<VkShaderModule>	shaderModule	(createShaderModule(vk, device, context.getBinaryCollection().get("comp"), 0u));
+	const Unique<VkPipelineLayout>	pipelineLayout	(makePipelineLayout(vk, device));
+	const Unique<VkPipeline>		pipeline		(makeComputePipeline(vk, device, *pipelineLayout, *shaderModule, DE_NULL));
+
+	return cache.getStats();
+}
+
+void writeSharedCacheFile (const std::vector<deUint8>& data)
+{
+	FILE* const	file	= fopen(s_sharedCacheFilename, "wb");
+	bool		ok		= (file != DE_NULL);
+
+	if (ok && !data.empty())
+		ok = fwrite(&data[0], 1, data.size(), file) == data.size();
+
+	if (file)
+		ok = (fclose(file) == 0) && ok;
+
+	if (!ok)
+		TCU_THROW(ResourceError, "Failed to write pipeline cache file");
+}
+
+void logCacheStats (tcu::TestLog& log, const char* name, const PipelineCacheStats& stats)
+{
+	log << tcu::TestLog::Message << name << ": loaded " << stats.loadedDataSize << " bytes, rejected " << stats.rejectedDataSize
+		<< " bytes, " << stats.numPipelines << " pipelines, " << stats.numHits << " hits, " << stats.numMisses << " misses"
+		<< tcu::TestLog::EndMessage;
+}
+
+tcu::TestStatus sharedCacheStoreLoadTest (Context& context)
+{
+	tcu::TestLog&			log				= context.getTestContext().getLog();
+	std::vector<deUint8>	storedData;
+	PipelineCacheStats		createStats;
+	PipelineCacheStats		loadStats;
+
+	deDeleteFile(s_sharedCacheFilename);
+
+	// Without a file the cache starts empty, its data is written to the file when it is destroyed
+	{
+		const de::MovePtr<SharedPipelineCache> cache (createSharedCache(context));
+
+		createStats	= createSharedCachePipeline(context, *cache);
+		storedData	= getPipelineCacheData(context.getDeviceInterface(), context.getDevice(), cache->get());
+	}
+
+	{
+		const de::MovePtr<SharedPipelineCache> cache (createSharedCache(context));
+
+		loadStats = createSharedCachePipeline(context, *cache);
+	}
+
+	deDeleteFile(s_sharedCacheFilename);
+
+	logCacheStats(log, "Created", createStats);
+	logCacheStats(log, "Loaded", loadStats);
+
+	if (createStats.loadedDataSize != 0 || createStats.rejectedDataSize != 0)
+		return tcu::TestStatus::fail("Cache data was loaded without a file");
+
+	if (createStats.numPipelines != 1 || createStats.numHits + createStats.numMisses != 1 || loadStats.numPipelines != 1 || loadStats.numHits + loadStats.numMisses != 1)
+		return tcu::TestStatus::fail("Pipeline was not counted");
+
+	if (!isPipelineCacheDataCompatible(storedData, context.getDeviceProperties()))
+		return tcu::TestStatus::fail("Cache data header does not match the device");
+
+	if (loadStats.rejectedDataSize != 0 || loadStats.loadedDataSize != storedData.size())
+		return tcu::TestStatus::fail("Stored cache data was not loaded");
+
+	if (loadStats.numHits != 1)
+		return tcu::TestStatus(QP_TEST_RESULT_QUALITY_WARNING, "Pipeline in the loaded cache was not a cache hit");
+
+	return tcu::TestStatus::pass("Pass");
+}
+
+tcu::TestStatus sharedCacheRejectTest (Context& context)
+{
+	tcu::TestLog&			log			= context.getTestContext().getLog();
+	std::vector<deUint8>	validData;
+
+	deDeleteFile(s_sharedCacheFilename);
+
+	{
+		const de::MovePtr<SharedPipelineCache> cache (createSharedCache(context));
+
+		createSharedCachePipeline(context, *cache);
+		validData = getPipelineCacheData(context.getDeviceInterface(), context.getDevice(), cache->get());
+	}
+
+	if (validData.size() < 4 * sizeof(deUint32))
+		return tcu::TestStatus::fail("Cache data is smaller than the header");
+
+	for (int caseNdx = 0; caseNdx < 3; caseNdx++)
+	{
+		static const char* const	s_caseNames[]	= { "Other device ID", "Other header version", "Truncated header" };
+		std::vector<deUint8>		data			= validData;
+		deUint32					header[4];
+
+		deMemcpy(header, &data[0], sizeof(header));
+
+		if (caseNdx == 0)
+			header[3] += 1u;
+		else if (caseNdx == 1)
+			header[1] = VK_PIPELINE_CACHE_HEADER_VERSION_ONE + 1u;
+
+		deMemcpy(&data[0], header, sizeof(header));
+
+		if (caseNdx == 2)
+			data.resize(sizeof(header));
+
+		writeSharedCacheFile(data);
+
+		{
+			const de::MovePtr<SharedPipelineCache>	cache	(createSharedCache(context));
+			const PipelineCacheStats				stats	(createSharedCachePipeline(context, *cache));
+
+			logCacheStats(log, s_caseNames[caseNdx], stats);
+
+			if (stats.rejectedDataSize != data.size() || stats.loadedDataSize != 0)
+			{
+				deDeleteFile(s_sharedCacheFilename);
+				return tcu::TestStatus::fail(std::string(s_caseNames[caseNdx]) + ": incompatible cache data was not rejected");
+			}
+		}
+	}
+
+	deDeleteFile(s_sharedCacheFilename);
+
+	return tcu::TestStatus::pass("Pass");
+}
+
 } // anonymous
 
 tcu::TestCaseGroup* createCacheTests (tcu::TestContext& testCtx)
@@ -2268,6 +2428,16 @@ tcu::TestCaseGroup* createCacheTests (tcu::TestContext& testCtx)
 		cacheTests->addChild(miscTests.release());
 	}
 
+	// Pipeline cache shared through a file
+	{
+		de::MovePtr<tcu::TestCaseGroup> sharedFileTests (new tcu::TestCaseGroup(testCtx, "shared_file", "Pipeline cache loaded from and stored to a file."));
+
+		addFunctionCaseWithPrograms(sharedFileTests.get(), "store_load", "Store the cache to a file and load it again.", initSharedCachePrograms, sharedCacheStoreLoadTest);
+		addFunctionCaseWithPrograms(sharedFileTests.get(), "reject_incompatible", "Reject cache data of an incompatible device.", initSharedCachePrograms, sharedCacheRejectTest);
+
+		cacheTests->addChild(sharedFileTests.release());
+	}
+
 	return cacheTests.release();
 }
 
@@ -221,7 +221,6 @@ ImageSamplingInstance::ImageSamplingInstance (Context&							context,
 	const DeviceInterface&		vk						= context.getDeviceInterface();
 	const VkPhysicalDevice		physDevice				= context.getPhysicalDevice();
 	const VkDevice				vkDevice				= context.getDevice();
-	const VkQueue				queue					= context.getUniversalQueue();
 	const deUint32				queueFamilyIndex		= context.getUniversalQueueFamilyIndex();
 	SimpleAllocator				memAlloc				(vk, vkDevice, getPhysicalDeviceMemoryProperties(context.getInstanceInterface(), context.getPhysicalDevice()));
 	const VkComponentMapping	componentMappingRGBA	= { VK_COMPONENT_SWIZZLE_R, VK_COMPONENT_SWIZZLE_G, VK_COMPONENT_SWIZZLE_B, VK_COMPONENT_SWIZZLE_A };
@@ -371,8 +370,8 @@ ImageSamplingInstance::ImageSamplingInstance (Context&							context,
 			m_imageAllocs[imgNdx] = SharedAllocPtr(new UniqueAlloc(allocateImage(vki, vk, physDevice, vkDevice, **m_images[imgNdx], MemoryRequirement::Any, memAlloc, m_allocationKind)));
 			VK_CHECK(vk.bindImageMemory(vkDevice, **m_images[imgNdx], (*m_imageAllocs[imgNdx])->getMemory(), (*m_imageAllocs[imgNdx])->getOffset()));
 
-			// Upload texture data
-			uploadTestTexture(vk, vkDevice, queue, queueFamilyIndex, memAlloc, *m_texture, **m_images[imgNdx]);
+			// Upload texture data, submitted with the other images below
+			uploadTestTexture(context.getStagingRing(), *m_texture, **m_images[imgNdx]);
 
 			// Create image view and sampler
 			const VkImageViewCreateInfo imageViewParams =
@@ -390,6 +389,9 @@ ImageSamplingInstance::ImageSamplingInstance (Context&							context,
 			m_imageViews[imgNdx] = SharedImageViewPtr(new UniqueImageView(createImageView(vk, vkDevice, &imageViewParams)));
 		}
 
+		// Rendering is submitted to the same queue after the uploads
+		context.getStagingRing().submit();
+
 		m_sampler	= createSampler(vk, vkDevice, &m_samplerParams);
 	}
 
@@ -1413,18 +1415,20 @@ tcu::TestStatus ImageSamplingInstance::verifyImage (void)
 			texture		= m_texture.get();
 		}
 
+		// Read back all result images with one submission
+		std::vector<tcu::TextureLevel> results (m_imageCount);
+
+		for (int imgNdx = 0; imgNdx < m_imageCount; ++imgNdx)
+		{
+			results[imgNdx].setStorage(mapVkFormat(m_colorFormat), (int)m_renderSize.x(), (int)m_renderSize.y());
+			readColorAttachment(m_context.getStagingRing(), **m_colorImages[imgNdx], results[imgNdx]);
+		}
+
+		m_context.getStagingRing().finish();
+
 		for (int imgNdx = 0; imgNdx < m_imageCount; ++imgNdx)
 		{
-			// Read back result image
-			UniquePtr<tcu::TextureLevel>		result			(readColorAttachment(m_context.getDeviceInterface(),
-																					 m_context.getDevice(),
-																					 m_context.getUniversalQueue(),
-																					 m_context.getUniversalQueueFamilyIndex(),
-																					 m_context.getDefaultAllocator(),
-																					 **m_colorImages[imgNdx],
-																					 m_colorFormat,
-																					 m_renderSize));
-			const tcu::ConstPixelBufferAccess	resultAccess	= result->getAccess();
+			const tcu::ConstPixelBufferAccess	resultAccess	= results[imgNdx].getAccess();
 			bool								compareOk		= validateResultImage(*texture,
 																					  m_imageViewType,
 																					  subresource,
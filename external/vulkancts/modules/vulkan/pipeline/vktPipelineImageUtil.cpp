@@ -276,6 +276,26 @@ de::MovePtr<tcu::TextureLevel> readColorAttachment (const vk::DeviceInterface&	v
 	return resultLevel;
 }
 
+de::MovePtr<tcu::TextureLevel> readColorAttachment (vk::StagingRing&	stagingRing,
+													vk::VkImage			image,
+													vk::VkFormat		format,
+													const tcu::UVec2&	renderSize)
+{
+	de::MovePtr<tcu::TextureLevel> resultLevel (new tcu::TextureLevel(mapVkFormat(format), renderSize.x(), renderSize.y()));
+
+	readColorAttachment(stagingRing, image, *resultLevel);
+	stagingRing.finish();
+
+	return resultLevel;
+}
+
+void readColorAttachment (vk::StagingRing&		stagingRing,
+						  vk::VkImage			image,
+						  tcu::TextureLevel&	resultLevel)
+{
+	stagingRing.readImage(resultLevel, image, VK_IMAGE_ASPECT_COLOR_BIT, VK_ACCESS_COLOR_ATTACHMENT_WRITE_BIT, VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL);
+}
+
 de::MovePtr<tcu::TextureLevel> readDepthAttachment (const vk::DeviceInterface&	vk,
 													vk::VkDevice				device,
 													vk::VkQueue					queue,
@@ -391,6 +411,35 @@ de::MovePtr<tcu::TextureLevel> readDepthAttachment (const vk::DeviceInterface&	v
 	return resultLevel;
 }
 
+void splitDepthStencilTexture (const TestTexture&			srcTexture,
+							   de::MovePtr<TestTexture>&	srcDepthTexture,
+							   de::MovePtr<TestTexture>&	srcStencilTexture)
+{
+	if (tcu::hasDepthComponent(srcTexture.getTextureFormat().order))
+	{
+		tcu::TextureFormat format;
+		switch (srcTexture.getTextureFormat().type)
+		{
+			case tcu::TextureFormat::UNSIGNED_INT_16_8_8:
+				format = tcu::TextureFormat(tcu::TextureFormat::D, tcu::TextureFormat::UNORM_INT16);
+				break;
+			case tcu::TextureFormat::UNSIGNED_INT_24_8_REV:
+				format = tcu::TextureFormat(tcu::TextureFormat::D, tcu::TextureFormat::UNSIGNED_INT_24_8_REV);
+				break;
+			case tcu::TextureFormat::FLOAT_UNSIGNED_INT_24_8_REV:
+				format = tcu::TextureFormat(tcu::TextureFormat::D, tcu::TextureFormat::FLOAT);
+				break;
+			default:
+				DE_FATAL("Unexpected source texture format.");
+				break;
+		}
+		srcDepthTexture = srcTexture.copy(format);
+	}
+
+	if (tcu::hasStencilComponent(srcTexture.getTextureFormat().order))
+		srcStencilTexture = srcTexture.copy(tcu::getEffectiveDepthStencilTextureFormat(srcTexture.getTextureFormat(), tcu::Sampler::MODE_STENCIL));
+}
+
 void uploadTestTextureInternal (const DeviceInterface&	vk,
 								VkDevice				device,
 								VkQueue					queue,
@@ -464,6 +513,54 @@ void uploadTestTextureInternal (const DeviceInterface&	vk,
 	copyBufferToImage(vk, device, queue, queueFamilyIndex, *buffer, bufferSize, copyRegions, DE_NULL, imageAspectFlags, srcTexture.getNumLevels(), srcTexture.getArraySize(), destImage);
 }
 
+void uploadTestTextureInternal (vk::StagingRing&		stagingRing,
+								const TestTexture&		srcTexture,
+								const TestTexture*		srcStencilTexture,
+								tcu::TextureFormat		format,
+								VkImage					destImage)
+{
+	const VkImageAspectFlags		imageAspectFlags	= getImageAspectFlags(format);
+	deUint32						stencilOffset		= 0u;
+	std::vector<VkBufferImageCopy>	copyRegions			= srcTexture.getBufferCopyRegions();
+	deUint32						bufferSize			= (srcTexture.isCompressed())? srcTexture.getCompressedSize(): srcTexture.getSize();
+
+	// Stencil-only texture should be provided if (and only if) the image has a combined DS format
+	DE_ASSERT((tcu::hasDepthComponent(format.order) && tcu::hasStencilComponent(format.order)) == (srcStencilTexture != DE_NULL));
+
+	if (srcStencilTexture != DE_NULL)
+	{
+		stencilOffset	= static_cast<deUint32>(deAlign32(static_cast<deInt32>(bufferSize), 4));
+		bufferSize		= stencilOffset + srcStencilTexture->getSize();
+	}
+
+	{
+		// Region offsets are multiples of 4 and the texel or block size relative to the start of the range
+		const VkDeviceSize			alignment	= srcTexture.isCompressed() ? (VkDeviceSize)(4 * tcu::getBlockSize(srcTexture.getCompressedLevel(0, 0).getFormat()))
+																			: StagingRing::getCopyAlignment(srcTexture.getTextureFormat());
+		const StagingRing::Range	range		= stagingRing.allocate(bufferSize, alignment);
+
+		srcTexture.write(reinterpret_cast<deUint8*>(range.hostPtr));
+
+		if (srcStencilTexture != DE_NULL)
+		{
+			DE_ASSERT(stencilOffset != 0u);
+
+			srcStencilTexture->write(reinterpret_cast<deUint8*>(range.hostPtr) + stencilOffset);
+
+			std::vector<VkBufferImageCopy>	stencilCopyRegions = srcStencilTexture->getBufferCopyRegions();
+			for (size_t regionIdx = 0; regionIdx < stencilCopyRegions.size(); regionIdx++)
+			{
+				VkBufferImageCopy region = stencilCopyRegions[regionIdx];
+				region.bufferOffset += stencilOffset;
+
+				copyRegions.push_back(region);
+			}
+		}
+
+		stagingRing.copyToImage(range, copyRegions, imageAspectFlags, srcTexture.getNumLevels(), srcTexture.getArraySize(), destImage);
+	}
+}
+
 bool checkSparseImageFormatSupport (const VkPhysicalDevice		physicalDevice,
 									const InstanceInterface&	instance,
 									const VkImageCreateInfo&	imageCreateInfo)
@@ -570,29 +667,7 @@ void uploadTestTexture (const DeviceInterface&			vk,
 		de::MovePtr<TestTexture> srcDepthTexture;
 		de::MovePtr<TestTexture> srcStencilTexture;
 
-		if (tcu::hasDepthComponent(srcTexture.getTextureFormat().order))
-		{
-			tcu::TextureFormat format;
-			switch (srcTexture.getTextureFormat().type)
-			{
-				case tcu::TextureFormat::UNSIGNED_INT_16_8_8:
-					format = tcu::TextureFormat(tcu::TextureFormat::D, tcu::TextureFormat::UNORM_INT16);
-					break;
-				case tcu::TextureFormat::UNSIGNED_INT_24_8_REV:
-					format = tcu::TextureFormat(tcu::TextureFormat::D, tcu::TextureFormat::UNSIGNED_INT_24_8_REV);
-					break;
-				case tcu::TextureFormat::FLOAT_UNSIGNED_INT_24_8_REV:
-					format = tcu::TextureFormat(tcu::TextureFormat::D, tcu::TextureFormat::FLOAT);
-					break;
-				default:
-					DE_FATAL("Unexpected source texture format.");
-					break;
-			}
-			srcDepthTexture = srcTexture.copy(format);
-		}
-
-		if (tcu::hasStencilComponent(srcTexture.getTextureFormat().order))
-			srcStencilTexture = srcTexture.copy(tcu::getEffectiveDepthStencilTextureFormat(srcTexture.getTextureFormat(), tcu::Sampler::MODE_STENCIL));
+		splitDepthStencilTexture(srcTexture, srcDepthTexture, srcStencilTexture);
 
 		uploadTestTextureInternal(vk, device, queue, queueFamilyIndex, allocator, *srcDepthTexture, srcStencilTexture.get(), srcTexture.getTextureFormat(), destImage);
 	}
@@ -600,6 +675,23 @@ void uploadTestTexture (const DeviceInterface&			vk,
 		uploadTestTextureInternal(vk, device, queue, queueFamilyIndex, allocator, srcTexture, DE_NULL, srcTexture.getTextureFormat(), destImage);
 }
 
+void uploadTestTexture (vk::StagingRing&				stagingRing,
+						const TestTexture&				srcTexture,
+						VkImage							destImage)
+{
+	if (tcu::isCombinedDepthStencilType(srcTexture.getTextureFormat().type))
+	{
+		de::MovePtr<TestTexture> srcDepthTexture;
+		de::MovePtr<TestTexture> srcStencilTexture;
+
+		splitDepthStencilTexture(srcTexture, srcDepthTexture, srcStencilTexture);
+
+		uploadTestTextureInternal(stagingRing, *srcDepthTexture, srcStencilTexture.get(), srcTexture.getTextureFormat(), destImage);
+	}
+	else
+		uploadTestTextureInternal(stagingRing, srcTexture, DE_NULL, srcTexture.getTextureFormat(), destImage);
+}
+
 void uploadTestTextureSparse (const DeviceInterface&					vk,
 							  VkDevice									device,
 							  const VkPhysicalDevice					physicalDevice,
@@ -618,29 +710,7 @@ void uploadTestTextureSparse (const DeviceInterface&					vk,
 		de::MovePtr<TestTexture> srcDepthTexture;
 		de::MovePtr<TestTexture> srcStencilTexture;
 
-		if (tcu::hasDepthComponent(srcTexture.getTextureFormat().order))
-		{
-			tcu::TextureFormat format;
-			switch (srcTexture.getTextureFormat().type)
-			{
-				case tcu::TextureFormat::UNSIGNED_INT_16_8_8:
-					format = tcu::TextureFormat(tcu::TextureFormat::D, tcu::TextureFormat::UNORM_INT16);
-					break;
-				case tcu::TextureFormat::UNSIGNED_INT_24_8_REV:
-					format = tcu::TextureFormat(tcu::TextureFormat::D, tcu::TextureFormat::UNSIGNED_INT_24_8_REV);
-					break;
-				case tcu::TextureFormat::FLOAT_UNSIGNED_INT_24_8_REV:
-					format = tcu::TextureFormat(tcu::TextureFormat::D, tcu::TextureFormat::FLOAT);
-					break;
-				default:
-					DE_FATAL("Unexpected source texture format.");
-					break;
-			}
-			srcDepthTexture = srcTexture.copy(format);
-		}
-
-		if (tcu::hasStencilComponent(srcTexture.getTextureFormat().order))
-			srcStencilTexture = srcTexture.copy(tcu::getEffectiveDepthStencilTextureFormat(srcTexture.getTextureFormat(), tcu::Sampler::MODE_STENCIL));
+		splitDepthStencilTexture(srcTexture, srcDepthTexture, srcStencilTexture);
 
 		uploadTestTextureInternalSparse	(vk,
 										 device,
@@ -30,6 +30,7 @@
 #include "vkPlatform.hpp"
 #include "vkMemUtil.hpp"
 #include "vkRef.hpp"
+#include "vkStagingRing.hpp"
 #include "tcuTexture.hpp"
 #include "tcuCompressedTexture.hpp"
 #include "deSharedPtr.hpp"
@@ -85,6 +86,30 @@ de::MovePtr<tcu::TextureLevel>	readColorAttachment			 (const vk::DeviceInterface
 															  vk::VkFormat					format,
 															  const tcu::UVec2&				renderSize);
 
+/*--------------------------------------------------------------------*//*!
+ * Gets a tcu::TextureLevel initialized with data from a VK color
+ * attachment, using the staging ring instead of a temporary buffer.
+ *
+ * The image must have been created on the device of the ring. Attachments
+ * larger than the ring are read through a temporary buffer. Waits for the
+ * ring to finish.
+ *//*--------------------------------------------------------------------*/
+de::MovePtr<tcu::TextureLevel>	readColorAttachment			 (vk::StagingRing&				stagingRing,
+															  vk::VkImage					image,
+															  vk::VkFormat					format,
+															  const tcu::UVec2&				renderSize);
+
+/*--------------------------------------------------------------------*//*!
+ * Records a readback of a VK color attachment into resultLevel, which
+ * must match the attachment in size and format.
+ *
+ * resultLevel is written when the batch of the readback is retired by
+ * StagingRing::finish() or StagingRing::wait(), so several attachments
+ * can be read back with one submission.
+ *//*--------------------------------------------------------------------*/
+void							readColorAttachment			 (vk::StagingRing&				stagingRing,
+															  vk::VkImage					image,
+															  tcu::TextureLevel&			resultLevel);
 
 /*--------------------------------------------------------------------*//*!
  * Gets a tcu::TextureLevel initialized with data from a VK depth
@@ -117,6 +142,18 @@ void							uploadTestTexture			(const vk::DeviceInterface&		vk,
 															 const TestTexture&				testTexture,
 															 vk::VkImage					destImage);
 
+/*--------------------------------------------------------------------*//*!
+ * Records an upload of a test texture to a destination VK image in the
+ * staging ring.
+ *
+ * The upload is ordered before later submissions to the queue of the ring
+ * once the ring has been submitted, so uploads of several images can share
+ * one submission. The image is left in shader read-only layout.
+ *//*--------------------------------------------------------------------*/
+void							uploadTestTexture			(vk::StagingRing&				stagingRing,
+															 const TestTexture&				testTexture,
+															 vk::VkImage					destImage);
+
 /*--------------------------------------------------------------------*//*!
  * Uploads data from a test texture to a destination VK image using sparse
  * binding.
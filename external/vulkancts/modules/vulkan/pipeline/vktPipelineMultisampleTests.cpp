@@ -344,7 +344,7 @@ public:
 	virtual										~MultisampleRenderer		(void);
 
 	de::MovePtr<tcu::TextureLevel>				render						(void);
-	de::MovePtr<tcu::TextureLevel>				getSingleSampledImage		(deUint32 sampleId);
+	void										getSingleSampledImages		(std::vector<tcu::TextureLevel>& images);
 
 protected:
 	void										initialize					(Context&										context,
@@ -1459,10 +1459,7 @@ tcu::TestStatus MinSampleShadingInstance::iterate (void)
 		renderer.render();
 
 		sampleShadedImages.resize(m_multisampleStateParams.rasterizationSamples);
-		for (deUint32 sampleId = 0; sampleId < sampleShadedImages.size(); sampleId++)
-		{
-			sampleShadedImages[sampleId] = *renderer.getSingleSampledImage(sampleId);
-		}
+		renderer.getSingleSampledImages(sampleShadedImages);
 	}
 
 	// Log images
@@ -3150,13 +3147,12 @@ de::MovePtr<tcu::TextureLevel> MultisampleRenderer::render (void)
 	const DeviceInterface&		vk					= m_context.getDeviceInterface();
 	const VkDevice				vkDevice			= m_context.getDevice();
 	const VkQueue				queue				= m_context.getUniversalQueue();
-	const deUint32				queueFamilyIndex	= m_context.getUniversalQueueFamilyIndex();
 
 	submitCommandsAndWait(vk, vkDevice, queue, m_cmdBuffer.get());
 
 	if (m_renderType == RENDER_TYPE_RESOLVE || m_renderType == RENDER_TYPE_DEPTHSTENCIL_ONLY)
 	{
-		return readColorAttachment(vk, vkDevice, queue, queueFamilyIndex, m_context.getDefaultAllocator(), *m_resolveImage, m_colorFormat, m_renderSize.cast<deUint32>());
+		return readColorAttachment(m_context.getStagingRing(), *m_resolveImage, m_colorFormat, m_renderSize.cast<deUint32>());
 	}
 	else
 	{
@@ -3164,9 +3160,16 @@ de::MovePtr<tcu::TextureLevel> MultisampleRenderer::render (void)
 	}
 }
 
-de::MovePtr<tcu::TextureLevel> MultisampleRenderer::getSingleSampledImage (deUint32 sampleId)
+void MultisampleRenderer::getSingleSampledImages (std::vector<tcu::TextureLevel>& images)
 {
-	return readColorAttachment(m_context.getDeviceInterface(), m_context.getDevice(), m_context.getUniversalQueue(), m_context.getUniversalQueueFamilyIndex(), m_context.getDefaultAllocator(), *m_perSampleImages[sampleId]->m_image, m_colorFormat, m_renderSize.cast<deUint32>());
+	// Per-sample images are read back with one submission
+	for (size_t sampleId = 0; sampleId < images.size(); sampleId++)
+	{
+		images[sampleId].setStorage(mapVkFormat(m_colorFormat), m_renderSize.x(), m_renderSize.y());
+		readColorAttachment(m_context.getStagingRing(), *m_perSampleImages[sampleId]->m_image, images[sampleId]);
+	}
+
+	m_context.getStagingRing().finish();
 }
 
 } // anonymous
@@ -726,12 +726,7 @@ tcu::TestStatus StencilTestInstance::verifyImage (void)
 
 	// Compare result with reference image
 	{
-		const DeviceInterface&				vk					= m_context.getDeviceInterface();
-		const VkDevice						vkDevice			= m_context.getDevice();
-		const VkQueue						queue				= m_context.getUniversalQueue();
-		const deUint32						queueFamilyIndex	= m_context.getUniversalQueueFamilyIndex();
-		SimpleAllocator						allocator			(vk, vkDevice, getPhysicalDeviceMemoryProperties(m_context.getInstanceInterface(), m_context.getPhysicalDevice()));
-		de::UniquePtr<tcu::TextureLevel>	result				(readColorAttachment(vk, vkDevice, queue, queueFamilyIndex, allocator, *m_colorImage, m_colorFormat, m_renderSize).release());
+		de::UniquePtr<tcu::TextureLevel>	result				(readColorAttachment(m_context.getStagingRing(), *m_colorImage, m_colorFormat, m_renderSize).release());
 
 		compareOk = tcu::intThresholdPositionDeviationCompare(m_context.getTestContext().getLog(),
 															  "IntImageCompare",
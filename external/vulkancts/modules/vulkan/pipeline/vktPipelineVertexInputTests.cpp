@@ -1632,12 +1632,7 @@ tcu::TestStatus VertexInputInstance::verifyImage (void)
 
 	// Compare result with reference image
 	{
-		const DeviceInterface&			vk					= m_context.getDeviceInterface();
-		const VkDevice					vkDevice			= m_context.getDevice();
-		const VkQueue					queue				= m_context.getUniversalQueue();
-		const deUint32					queueFamilyIndex	= m_context.getUniversalQueueFamilyIndex();
-		SimpleAllocator					allocator			(vk, vkDevice, getPhysicalDeviceMemoryProperties(m_context.getInstanceInterface(), m_context.getPhysicalDevice()));
-		de::MovePtr<tcu::TextureLevel>	result				= readColorAttachment(vk, vkDevice, queue, queueFamilyIndex, allocator, *m_colorImage, m_colorFormat, m_renderSize);
+		de::MovePtr<tcu::TextureLevel>	result				= readColorAttachment(m_context.getStagingRing(), *m_colorImage, m_colorFormat, m_renderSize);
 
 		compareOk = tcu::intThresholdPositionDeviationCompare(m_context.getTestContext().getLog(),
 															  "IntImageCompare",
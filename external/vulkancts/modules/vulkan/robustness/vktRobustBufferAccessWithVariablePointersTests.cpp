@@ -299,7 +299,7 @@ class AccessInstance : public vkt::TestInstance
 {
 public:
 								AccessInstance				(Context&			context,
-															 Move<VkDevice>		device,
+															 de::MovePtr<PooledDevice>	device,
 															 ShaderType			shaderType,
 															 VkShaderStageFlags	shaderStage,
 															 VkFormat			bufferFormat,
@@ -322,7 +322,7 @@ private:
 															 VkDeviceSize		valueSize);
 
 protected:
-	Move<VkDevice>				m_device;
+	de::MovePtr<PooledDevice>	m_device;
 	de::MovePtr<TestEnvironment>m_testEnvironment;
 
 	const ShaderType			m_shaderType;
@@ -361,7 +361,7 @@ class ReadInstance: public AccessInstance
 {
 public:
 								ReadInstance			(Context&				context,
-														 Move<VkDevice>			device,
+														 de::MovePtr<PooledDevice>	device,
 														 ShaderType				shaderType,
 														 VkShaderStageFlags		shaderStage,
 														 VkFormat				bufferFormat,
@@ -376,7 +376,7 @@ class WriteInstance: public AccessInstance
 {
 public:
 								WriteInstance			(Context&				context,
-														 Move<VkDevice>			device,
+														 de::MovePtr<PooledDevice>	device,
 														 ShaderType				shaderType,
 														 VkShaderStageFlags		shaderStage,
 														 VkFormat				bufferFormat,
@@ -1237,7 +1237,7 @@ TestInstance* RobustReadTest::createInstance (Context& context) const
 		return new NotSupportedInstance(context, std::string("VariablePointersStorageBuffer support is required for this test."));
 
 	// We need a device with enabled robust buffer access feature (it is disabled in default device)
-	Move<VkDevice>	device = createRobustBufferAccessDevice(context);
+	de::MovePtr<PooledDevice>	device = createRobustBufferAccessDevice(context);
 	return new ReadInstance(context, device, m_shaderType, m_shaderStage, m_bufferFormat, m_readAccessRange, m_accessOutOfBackingMemory);
 }
 
@@ -1276,7 +1276,7 @@ TestInstance* RobustWriteTest::createInstance (Context& context) const
 		return new NotSupportedInstance(context, std::string("VariablePointersStorageBuffer support is required for this test."));
 
 	// We need a device with enabled robust buffer access feature (it is disabled in default device)
-	Move<VkDevice>	device = createRobustBufferAccessDevice(context);
+	de::MovePtr<PooledDevice>	device = createRobustBufferAccessDevice(context);
 	return new WriteInstance(context, device, m_shaderType, m_shaderStage, m_bufferFormat, m_writeAccessRange, m_accessOutOfBackingMemory);
 }
 
@@ -1294,7 +1294,7 @@ void RobustWriteTest::initPrograms(SourceCollections&	programCollection) const
 }
 
 AccessInstance::AccessInstance (Context&			context,
-								Move<VkDevice>		device,
+								de::MovePtr<PooledDevice>	device,
 								ShaderType			shaderType,
 								VkShaderStageFlags	shaderStage,
 								VkFormat			bufferFormat,
@@ -1313,7 +1313,7 @@ AccessInstance::AccessInstance (Context&			context,
 	tcu::TestLog&									log						= context.getTestContext().getLog();
 	const DeviceInterface&							vk						= context.getDeviceInterface();
 	const deUint32									queueFamilyIndex		= context.getUniversalQueueFamilyIndex();
-	SimpleAllocator									memAlloc				(vk, *m_device, getPhysicalDeviceMemoryProperties(m_context.getInstanceInterface(), m_context.getPhysicalDevice()));
+	SimpleAllocator									memAlloc				(vk, m_device->get(), getPhysicalDeviceMemoryProperties(m_context.getInstanceInterface(), m_context.getPhysicalDevice()));
 
 	DE_ASSERT(RobustAccessWithPointersTest::s_numberOfBytesAccessed % sizeof(deUint32) == 0);
 	DE_ASSERT(inBufferAccessRange <= RobustAccessWithPointersTest::s_numberOfBytesAccessed);
@@ -1335,8 +1335,8 @@ AccessInstance::AccessInstance (Context&			context,
 		}
 	}
 
-	createTestBuffer(vk, *m_device, inBufferAccessRange, VK_BUFFER_USAGE_STORAGE_BUFFER_BIT, memAlloc, m_inBuffer, m_inBufferAlloc, m_inBufferAccess, &populateBufferWithValues, &m_bufferFormat);
-	createTestBuffer(vk, *m_device, outBufferAccessRange, VK_BUFFER_USAGE_STORAGE_BUFFER_BIT, memAlloc, m_outBuffer, m_outBufferAlloc, m_outBufferAccess, &populateBufferWithDummy, DE_NULL);
+	createTestBuffer(vk, m_device->get(), inBufferAccessRange, VK_BUFFER_USAGE_STORAGE_BUFFER_BIT, memAlloc, m_inBuffer, m_inBufferAlloc, m_inBufferAccess, &populateBufferWithValues, &m_bufferFormat);
+	createTestBuffer(vk, m_device->get(), outBufferAccessRange, VK_BUFFER_USAGE_STORAGE_BUFFER_BIT, memAlloc, m_outBuffer, m_outBufferAlloc, m_outBufferAccess, &populateBufferWithDummy, DE_NULL);
 
 	deInt32 indices[] = {
 		(m_accessOutOfBackingMemory && (m_bufferAccessType == BUFFER_ACCESS_TYPE_READ_FROM_STORAGE)) ? static_cast<deInt32>(RobustAccessWithPointersTest::s_testArraySize) - 1 : 0,
@@ -1344,7 +1344,7 @@ AccessInstance::AccessInstance (Context&			context,
 		0
 	};
 	AccessRangesData indicesAccess;
-	createTestBuffer(vk, *m_device, 3 * sizeof(deInt32), VK_BUFFER_USAGE_UNIFORM_BUFFER_BIT, memAlloc, m_indicesBuffer, m_indicesBufferAlloc, indicesAccess, &populateBufferWithCopy, &indices);
+	createTestBuffer(vk, m_device->get(), 3 * sizeof(deInt32), VK_BUFFER_USAGE_UNIFORM_BUFFER_BIT, memAlloc, m_indicesBuffer, m_indicesBufferAlloc, indicesAccess, &populateBufferWithCopy, &indices);
 
 	log << tcu::TestLog::Message << "input  buffer - alloc size: " << m_inBufferAccess.allocSize << tcu::TestLog::EndMessage;
 	log << tcu::TestLog::Message << "input  buffer - max access range: " << m_inBufferAccess.maxAccessRange << tcu::TestLog::EndMessage;
@@ -1360,13 +1360,13 @@ AccessInstance::AccessInstance (Context&			context,
 		descriptorPoolBuilder.addType(VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, 1u);
 		descriptorPoolBuilder.addType(VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, 1u);
 		descriptorPoolBuilder.addType(VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER, 1u);
-		m_descriptorPool = descriptorPoolBuilder.build(vk, *m_device, VK_DESCRIPTOR_POOL_CREATE_FREE_DESCRIPTOR_SET_BIT, 1u);
+		m_descriptorPool = descriptorPoolBuilder.build(vk, m_device->get(), VK_DESCRIPTOR_POOL_CREATE_FREE_DESCRIPTOR_SET_BIT, 1u);
 
 		DescriptorSetLayoutBuilder					setLayoutBuilder;
 		setLayoutBuilder.addSingleBinding(VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, VK_SHADER_STAGE_ALL);
 		setLayoutBuilder.addSingleBinding(VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, VK_SHADER_STAGE_ALL);
 		setLayoutBuilder.addSingleBinding(VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER, VK_SHADER_STAGE_ALL);
-		m_descriptorSetLayout = setLayoutBuilder.build(vk, *m_device);
+		m_descriptorSetLayout = setLayoutBuilder.build(vk, m_device->get());
 
 		const VkDescriptorSetAllocateInfo			descriptorSetAllocateInfo =
 		{
@@ -1377,7 +1377,7 @@ AccessInstance::AccessInstance (Context&			context,
 			&m_descriptorSetLayout.get()			// const VkDescriptorSetLayout*	pSetLayouts;
 		};
 
-		m_descriptorSet = allocateDescriptorSet(vk, *m_device, &descriptorSetAllocateInfo);
+		m_descriptorSet = allocateDescriptorSet(vk, m_device->get(), &descriptorSetAllocateInfo);
 
 		const VkDescriptorBufferInfo				inBufferDescriptorInfo			= makeDescriptorBufferInfo(*m_inBuffer, 0ull, m_inBufferAccess.accessRange);
 		const VkDescriptorBufferInfo				outBufferDescriptorInfo			= makeDescriptorBufferInfo(*m_outBuffer, 0ull, m_outBufferAccess.accessRange);
@@ -1387,7 +1387,7 @@ AccessInstance::AccessInstance (Context&			context,
 		setUpdateBuilder.writeSingle(*m_descriptorSet, DescriptorSetUpdateBuilder::Location::binding(0), VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, &inBufferDescriptorInfo);
 		setUpdateBuilder.writeSingle(*m_descriptorSet, DescriptorSetUpdateBuilder::Location::binding(1), VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, &outBufferDescriptorInfo);
 		setUpdateBuilder.writeSingle(*m_descriptorSet, DescriptorSetUpdateBuilder::Location::binding(2), VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER, &indicesBufferDescriptorInfo);
-		setUpdateBuilder.update(vk, *m_device);
+		setUpdateBuilder.update(vk, m_device->get());
 	}
 
 	// Create fence
@@ -1399,15 +1399,15 @@ AccessInstance::AccessInstance (Context&			context,
 			0u										// VkFenceCreateFlags		flags;
 		};
 
-		m_fence = createFence(vk, *m_device, &fenceParams);
+		m_fence = createFence(vk, m_device->get(), &fenceParams);
 	}
 
 	// Get queue
-	vk.getDeviceQueue(*m_device, queueFamilyIndex, 0, &m_queue);
+	vk.getDeviceQueue(m_device->get(), queueFamilyIndex, 0, &m_queue);
 
 	if (m_shaderStage == VK_SHADER_STAGE_COMPUTE_BIT)
 	{
-		m_testEnvironment = de::MovePtr<TestEnvironment>(new ComputeEnvironment(m_context, *m_device, *m_descriptorSetLayout, *m_descriptorSet));
+		m_testEnvironment = de::MovePtr<TestEnvironment>(new ComputeEnvironment(m_context, m_device->get(), *m_descriptorSetLayout, *m_descriptorSet));
 	}
 	else
 	{
@@ -1436,7 +1436,7 @@ AccessInstance::AccessInstance (Context&			context,
 			Vec4( 1.0f, -1.0f, 0.0f, 1.0f),
 		};
 		const VkDeviceSize							vertexBufferSize = static_cast<VkDeviceSize>(sizeof(vertices));
-		createTestBuffer(vk, *m_device, vertexBufferSize, VK_BUFFER_USAGE_VERTEX_BUFFER_BIT, memAlloc, m_vertexBuffer, m_vertexBufferAlloc, vertexAccess, &populateBufferWithCopy, &vertices);
+		createTestBuffer(vk, m_device->get(), vertexBufferSize, VK_BUFFER_USAGE_VERTEX_BUFFER_BIT, memAlloc, m_vertexBuffer, m_vertexBufferAlloc, vertexAccess, &populateBufferWithCopy, &vertices);
 
 		const GraphicsEnvironment::DrawConfig		drawWithOneVertexBuffer =
 		{
@@ -1448,7 +1448,7 @@ AccessInstance::AccessInstance (Context&			context,
 		};
 
 		m_testEnvironment = de::MovePtr<TestEnvironment>(new GraphicsEnvironment(m_context,
-																				 *m_device,
+																				 m_device->get(),
 																				 *m_descriptorSetLayout,
 																				 *m_descriptorSet,
 																				 GraphicsEnvironment::VertexBindings(1, vertexInputBindingDescription),
@@ -1517,9 +1517,9 @@ tcu::TestStatus AccessInstance::iterate (void)
 			DE_NULL							// const VkSemaphore*			pSignalSemaphores;
 		};
 
-		VK_CHECK(vk.resetFences(*m_device, 1, &m_fence.get()));
+		VK_CHECK(vk.resetFences(m_device->get(), 1, &m_fence.get()));
 		VK_CHECK(vk.queueSubmit(m_queue, 1, &submitInfo, *m_fence));
-		VK_CHECK(vk.waitForFences(*m_device, 1, &m_fence.get(), true, ~(0ull) /* infinity */));
+		VK_CHECK(vk.waitForFences(m_device->get(), 1, &m_fence.get(), true, ~(0ull) /* infinity */));
 	}
 
 	// Prepare result buffer for read
@@ -1533,7 +1533,7 @@ tcu::TestStatus AccessInstance::iterate (void)
 			m_outBufferAccess.allocSize,			//  VkDeviceSize	size;
 		};
 
-		VK_CHECK(vk.invalidateMappedMemoryRanges(*m_device, 1u, &outBufferRange));
+		VK_CHECK(vk.invalidateMappedMemoryRanges(m_device->get(), 1u, &outBufferRange));
 	}
 
 	if (verifyResult())
@@ -1729,7 +1729,7 @@ bool AccessInstance::verifyResult (void)
 // BufferReadInstance
 
 ReadInstance::ReadInstance (Context&				context,
-							Move<VkDevice>			device,
+							de::MovePtr<PooledDevice>	device,
 							ShaderType				shaderType,
 							VkShaderStageFlags		shaderStage,
 							VkFormat				bufferFormat,
@@ -1747,7 +1747,7 @@ ReadInstance::ReadInstance (Context&				context,
 // BufferWriteInstance
 
 WriteInstance::WriteInstance (Context&				context,
-							  Move<VkDevice>		device,
+							  de::MovePtr<PooledDevice>	device,
 							  ShaderType			shaderType,
 							  VkShaderStageFlags	shaderStage,
 							  VkFormat				bufferFormat,
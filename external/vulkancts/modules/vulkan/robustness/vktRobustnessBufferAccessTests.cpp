@@ -156,7 +156,7 @@ class BufferAccessInstance : public vkt::TestInstance
 {
 public:
 									BufferAccessInstance			(Context&			context,
-																	 Move<VkDevice>		device,
+																	 de::MovePtr<PooledDevice>	device,
 																	 ShaderType			shaderType,
 																	 VkShaderStageFlags	shaderStage,
 																	 VkFormat			bufferFormat,
@@ -176,7 +176,7 @@ private:
 	bool							isOutBufferValueUnchanged		(VkDeviceSize offsetInBytes, VkDeviceSize valueSize);
 
 protected:
-	Move<VkDevice>					m_device;
+	de::MovePtr<PooledDevice>		m_device;
 	de::MovePtr<TestEnvironment>	m_testEnvironment;
 
 	const ShaderType				m_shaderType;
@@ -222,7 +222,7 @@ class BufferReadInstance: public BufferAccessInstance
 {
 public:
 									BufferReadInstance			(Context&				context,
-																 Move<VkDevice>			device,
+																 de::MovePtr<PooledDevice>	device,
 																 ShaderType				shaderType,
 																 VkShaderStageFlags		shaderStage,
 																 VkFormat				bufferFormat,
@@ -239,7 +239,7 @@ class BufferWriteInstance: public BufferAccessInstance
 {
 public:
 									BufferWriteInstance			(Context&				context,
-																 Move<VkDevice>			device,
+																 de::MovePtr<PooledDevice>	device,
 																 ShaderType				shaderType,
 																 VkShaderStageFlags		shaderStage,
 																 VkFormat				bufferFormat,
@@ -608,7 +608,7 @@ void RobustBufferReadTest::initPrograms (SourceCollections& programCollection) c
 
 TestInstance* RobustBufferReadTest::createInstance (Context& context) const
 {
-	Move<VkDevice>	device			= createRobustBufferAccessDevice(context);
+	de::MovePtr<PooledDevice>	device			= createRobustBufferAccessDevice(context);
 
 	return new BufferReadInstance(context, device, m_shaderType, m_shaderStage, m_bufferFormat, m_readFromStorage, m_readAccessRange, m_accessOutOfBackingMemory);
 }
@@ -637,7 +637,7 @@ void RobustBufferWriteTest::initPrograms (SourceCollections& programCollection)
 
 TestInstance* RobustBufferWriteTest::createInstance (Context& context) const
 {
-	Move<VkDevice>	device			= createRobustBufferAccessDevice(context);
+	de::MovePtr<PooledDevice>	device			= createRobustBufferAccessDevice(context);
 
 	return new BufferWriteInstance(context, device, m_shaderType, m_shaderStage, m_bufferFormat, m_writeAccessRange, m_accessOutOfBackingMemory);
 }
@@ -645,7 +645,7 @@ TestInstance* RobustBufferWriteTest::createInstance (Context& context) const
 // BufferAccessInstance
 
 BufferAccessInstance::BufferAccessInstance (Context&			context,
-											Move<VkDevice>		device,
+											de::MovePtr<PooledDevice>	device,
 											ShaderType			shaderType,
 											VkShaderStageFlags	shaderStage,
 											VkFormat			bufferFormat,
@@ -667,7 +667,7 @@ BufferAccessInstance::BufferAccessInstance (Context&			context,
 	const deUint32				queueFamilyIndex		= context.getUniversalQueueFamilyIndex();
 	const bool					isTexelAccess			= !!(m_shaderType == SHADER_TYPE_TEXEL_COPY);
 	const bool					readFromStorage			= !!(m_bufferAccessType == BUFFER_ACCESS_TYPE_READ_FROM_STORAGE);
-	SimpleAllocator				memAlloc				(vk, *m_device, getPhysicalDeviceMemoryProperties(m_context.getInstanceInterface(), m_context.getPhysicalDevice()));
+	SimpleAllocator				memAlloc				(vk, m_device->get(), getPhysicalDeviceMemoryProperties(m_context.getInstanceInterface(), m_context.getPhysicalDevice()));
 	tcu::TestLog&				log						= m_context.getTestContext().getLog();
 
 	DE_ASSERT(RobustBufferAccessTest::s_numberOfBytesAccessed % sizeof(deUint32) == 0);
@@ -733,18 +733,18 @@ BufferAccessInstance::BufferAccessInstance (Context&			context,
 			DE_NULL										// const deUint32*		pQueueFamilyIndices;
 		};
 
-		m_inBuffer				= createBuffer(vk, *m_device, &inBufferParams);
+		m_inBuffer				= createBuffer(vk, m_device->get(), &inBufferParams);
 
-		inBufferMemoryReqs		= getBufferMemoryRequirements(vk, *m_device, *m_inBuffer);
+		inBufferMemoryReqs		= getBufferMemoryRequirements(vk, m_device->get(), *m_inBuffer);
 		m_inBufferAllocSize		= inBufferMemoryReqs.size;
 		m_inBufferAlloc			= memAlloc.allocate(inBufferMemoryReqs, MemoryRequirement::HostVisible);
 
 		// Size of the most restrictive bound
 		m_inBufferMaxAccessRange = min(m_inBufferAllocSize, min(inBufferParams.size, m_inBufferAccessRange));
 
-		VK_CHECK(vk.bindBufferMemory(*m_device, *m_inBuffer, m_inBufferAlloc->getMemory(), m_inBufferAlloc->getOffset()));
+		VK_CHECK(vk.bindBufferMemory(m_device->get(), *m_inBuffer, m_inBufferAlloc->getMemory(), m_inBufferAlloc->getOffset()));
 		populateBufferWithTestValues(m_inBufferAlloc->getHostPtr(), m_inBufferAllocSize, m_bufferFormat);
-		flushMappedMemoryRange(vk, *m_device, m_inBufferAlloc->getMemory(), m_inBufferAlloc->getOffset(), VK_WHOLE_SIZE);
+		flushMappedMemoryRange(vk, m_device->get(), m_inBufferAlloc->getMemory(), m_inBufferAlloc->getOffset(), VK_WHOLE_SIZE);
 
 		log << tcu::TestLog::Message << "inBufferAllocSize = " << m_inBufferAllocSize << tcu::TestLog::EndMessage;
 		log << tcu::TestLog::Message << "inBufferMaxAccessRange = " << m_inBufferMaxAccessRange << tcu::TestLog::EndMessage;
@@ -768,9 +768,9 @@ BufferAccessInstance::BufferAccessInstance (Context&			context,
 			DE_NULL										// const deUint32*		pQueueFamilyIndices;
 		};
 
-		m_outBuffer					= createBuffer(vk, *m_device, &outBufferParams);
+		m_outBuffer					= createBuffer(vk, m_device->get(), &outBufferParams);
 
-		outBufferMemoryReqs			= getBufferMemoryRequirements(vk, *m_device, *m_outBuffer);
+		outBufferMemoryReqs			= getBufferMemoryRequirements(vk, m_device->get(), *m_outBuffer);
 		m_outBufferAllocSize		= outBufferMemoryReqs.size;
 		m_outBufferAlloc			= memAlloc.allocate(outBufferMemoryReqs, MemoryRequirement::HostVisible);
 
@@ -786,9 +786,9 @@ BufferAccessInstance::BufferAccessInstance (Context&			context,
 		// Size of the most restrictive bound
 		m_outBufferMaxAccessRange = min(m_outBufferAllocSize, min(outBufferParams.size, m_outBufferAccessRange));
 
-		VK_CHECK(vk.bindBufferMemory(*m_device, *m_outBuffer, m_outBufferAlloc->getMemory(), m_outBufferAlloc->getOffset()));
+		VK_CHECK(vk.bindBufferMemory(m_device->get(), *m_outBuffer, m_outBufferAlloc->getMemory(), m_outBufferAlloc->getOffset()));
 		deMemset(m_outBufferAlloc->getHostPtr(), 0xFF, (size_t)m_outBufferAllocSize);
-		flushMappedMemoryRange(vk, *m_device, m_outBufferAlloc->getMemory(), m_outBufferAlloc->getOffset(), VK_WHOLE_SIZE);
+		flushMappedMemoryRange(vk, m_device->get(), m_outBufferAlloc->getMemory(), m_outBufferAlloc->getOffset(), VK_WHOLE_SIZE);
 
 		log << tcu::TestLog::Message << "outBufferAllocSize = " << m_outBufferAllocSize << tcu::TestLog::EndMessage;
 		log << tcu::TestLog::Message << "outBufferMaxAccessRange = " << m_outBufferMaxAccessRange << tcu::TestLog::EndMessage;
@@ -816,10 +816,10 @@ BufferAccessInstance::BufferAccessInstance (Context&			context,
 			DE_NULL,									// const deUint32*		pQueueFamilyIndices;
 		};
 
-		m_indicesBuffer				= createBuffer(vk, *m_device, &indicesBufferParams);
-		m_indicesBufferAlloc		= memAlloc.allocate(getBufferMemoryRequirements(vk, *m_device, *m_indicesBuffer), MemoryRequirement::HostVisible);
+		m_indicesBuffer				= createBuffer(vk, m_device->get(), &indicesBufferParams);
+		m_indicesBufferAlloc		= memAlloc.allocate(getBufferMemoryRequirements(vk, m_device->get(), *m_indicesBuffer), MemoryRequirement::HostVisible);
 
-		VK_CHECK(vk.bindBufferMemory(*m_device, *m_indicesBuffer, m_indicesBufferAlloc->getMemory(), m_indicesBufferAlloc->getOffset()));
+		VK_CHECK(vk.bindBufferMemory(m_device->get(), *m_indicesBuffer, m_indicesBufferAlloc->getMemory(), m_indicesBufferAlloc->getOffset()));
 
 		if (m_accessOutOfBackingMemory)
 		{
@@ -835,7 +835,7 @@ BufferAccessInstance::BufferAccessInstance (Context&			context,
 
 		deMemcpy(m_indicesBufferAlloc->getHostPtr(), &indices, sizeof(IndicesBuffer));
 
-		flushMappedMemoryRange(vk, *m_device, m_indicesBufferAlloc->getMemory(), m_indicesBufferAlloc->getOffset(), VK_WHOLE_SIZE);
+		flushMappedMemoryRange(vk, m_device->get(), m_indicesBufferAlloc->getMemory(), m_indicesBufferAlloc->getOffset(), VK_WHOLE_SIZE);
 
 		log << tcu::TestLog::Message << "inIndex = " << indices.inIndex << tcu::TestLog::EndMessage;
 		log << tcu::TestLog::Message << "outIndex = " << indices.outIndex << tcu::TestLog::EndMessage;
@@ -861,13 +861,13 @@ BufferAccessInstance::BufferAccessInstance (Context&			context,
 		descriptorPoolBuilder.addType(inBufferDescriptorType, 1u);
 		descriptorPoolBuilder.addType(outBufferDescriptorType, 1u);
 		descriptorPoolBuilder.addType(VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER, 1u);
-		m_descriptorPool = descriptorPoolBuilder.build(vk, *m_device, VK_DESCRIPTOR_POOL_CREATE_FREE_DESCRIPTOR_SET_BIT, 1u);
+		m_descriptorPool = descriptorPoolBuilder.build(vk, m_device->get(), VK_DESCRIPTOR_POOL_CREATE_FREE_DESCRIPTOR_SET_BIT, 1u);
 
 		DescriptorSetLayoutBuilder setLayoutBuilder;
 		setLayoutBuilder.addSingleBinding(inBufferDescriptorType, VK_SHADER_STAGE_ALL);
 		setLayoutBuilder.addSingleBinding(outBufferDescriptorType, VK_SHADER_STAGE_ALL);
 		setLayoutBuilder.addSingleBinding(VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER, VK_SHADER_STAGE_ALL);
-		m_descriptorSetLayout = setLayoutBuilder.build(vk, *m_device);
+		m_descriptorSetLayout = setLayoutBuilder.build(vk, m_device->get());
 
 		const VkDescriptorSetAllocateInfo descriptorSetAllocateInfo =
 		{
@@ -878,7 +878,7 @@ BufferAccessInstance::BufferAccessInstance (Context&			context,
 			&m_descriptorSetLayout.get()						// const VkDescriptorSetLayout*	pSetLayouts;
 		};
 
-		m_descriptorSet = allocateDescriptorSet(vk, *m_device, &descriptorSetAllocateInfo);
+		m_descriptorSet = allocateDescriptorSet(vk, m_device->get(), &descriptorSetAllocateInfo);
 
 		DescriptorSetUpdateBuilder setUpdateBuilder;
 
@@ -894,7 +894,7 @@ BufferAccessInstance::BufferAccessInstance (Context&			context,
 				0ull,											// VkDeviceSize				offset;
 				m_inBufferAccessRange							// VkDeviceSize				range;
 			};
-			m_inTexelBufferView	= createBufferView(vk, *m_device, &inBufferViewCreateInfo, DE_NULL);
+			m_inTexelBufferView	= createBufferView(vk, m_device->get(), &inBufferViewCreateInfo, DE_NULL);
 
 			const VkBufferViewCreateInfo outBufferViewCreateInfo =
 			{
@@ -906,7 +906,7 @@ BufferAccessInstance::BufferAccessInstance (Context&			context,
 				0ull,											// VkDeviceSize				offset;
 				m_outBufferAccessRange,							// VkDeviceSize				range;
 			};
-			m_outTexelBufferView	= createBufferView(vk, *m_device, &outBufferViewCreateInfo, DE_NULL);
+			m_outTexelBufferView	= createBufferView(vk, m_device->get(), &outBufferViewCreateInfo, DE_NULL);
 
 			setUpdateBuilder.writeSingle(*m_descriptorSet, DescriptorSetUpdateBuilder::Location::binding(0), inBufferDescriptorType, &m_inTexelBufferView.get());
 			setUpdateBuilder.writeSingle(*m_descriptorSet, DescriptorSetUpdateBuilder::Location::binding(1), outBufferDescriptorType, &m_outTexelBufferView.get());
@@ -923,7 +923,7 @@ BufferAccessInstance::BufferAccessInstance (Context&			context,
 		const VkDescriptorBufferInfo indicesBufferDescriptorInfo	= makeDescriptorBufferInfo(*m_indicesBuffer, 0ull, 8ull);
 		setUpdateBuilder.writeSingle(*m_descriptorSet, DescriptorSetUpdateBuilder::Location::binding(2), VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER, &indicesBufferDescriptorInfo);
 
-		setUpdateBuilder.update(vk, *m_device);
+		setUpdateBuilder.update(vk, m_device->get());
 	}
 
 	// Create fence
@@ -935,15 +935,15 @@ BufferAccessInstance::BufferAccessInstance (Context&			context,
 			0u										// VkFenceCreateFlags	flags;
 		};
 
-		m_fence = createFence(vk, *m_device, &fenceParams);
+		m_fence = createFence(vk, m_device->get(), &fenceParams);
 	}
 
 	// Get queue
-	vk.getDeviceQueue(*m_device, queueFamilyIndex, 0, &m_queue);
+	vk.getDeviceQueue(m_device->get(), queueFamilyIndex, 0, &m_queue);
 
 	if (m_shaderStage == VK_SHADER_STAGE_COMPUTE_BIT)
 	{
-		m_testEnvironment = de::MovePtr<TestEnvironment>(new ComputeEnvironment(m_context, *m_device, *m_descriptorSetLayout, *m_descriptorSet));
+		m_testEnvironment = de::MovePtr<TestEnvironment>(new ComputeEnvironment(m_context, m_device->get(), *m_descriptorSetLayout, *m_descriptorSet));
 	}
 	else
 	{
@@ -988,14 +988,14 @@ BufferAccessInstance::BufferAccessInstance (Context&			context,
 
 			DE_ASSERT(vertexBufferSize > 0);
 
-			m_vertexBuffer		= createBuffer(vk, *m_device, &vertexBufferParams);
-			m_vertexBufferAlloc	= memAlloc.allocate(getBufferMemoryRequirements(vk, *m_device, *m_vertexBuffer), MemoryRequirement::HostVisible);
+			m_vertexBuffer		= createBuffer(vk, m_device->get(), &vertexBufferParams);
+			m_vertexBufferAlloc	= memAlloc.allocate(getBufferMemoryRequirements(vk, m_device->get(), *m_vertexBuffer), MemoryRequirement::HostVisible);
 
-			VK_CHECK(vk.bindBufferMemory(*m_device, *m_vertexBuffer, m_vertexBufferAlloc->getMemory(), m_vertexBufferAlloc->getOffset()));
+			VK_CHECK(vk.bindBufferMemory(m_device->get(), *m_vertexBuffer, m_vertexBufferAlloc->getMemory(), m_vertexBufferAlloc->getOffset()));
 
 			// Load vertices into vertex buffer
 			deMemcpy(m_vertexBufferAlloc->getHostPtr(), vertices, sizeof(tcu::Vec4) * DE_LENGTH_OF_ARRAY(vertices));
-			flushMappedMemoryRange(vk, *m_device, m_vertexBufferAlloc->getMemory(), m_vertexBufferAlloc->getOffset(), VK_WHOLE_SIZE);
+			flushMappedMemoryRange(vk, m_device->get(), m_vertexBufferAlloc->getMemory(), m_vertexBufferAlloc->getOffset(), VK_WHOLE_SIZE);
 		}
 
 		const GraphicsEnvironment::DrawConfig drawWithOneVertexBuffer =
@@ -1008,7 +1008,7 @@ BufferAccessInstance::BufferAccessInstance (Context&			context,
 		};
 
 		m_testEnvironment = de::MovePtr<TestEnvironment>(new GraphicsEnvironment(m_context,
-																				 *m_device,
+																				 m_device->get(),
 																				 *m_descriptorSetLayout,
 																				 *m_descriptorSet,
 																				 GraphicsEnvironment::VertexBindings(1, vertexInputBindingDescription),
@@ -1084,9 +1084,9 @@ tcu::TestStatus BufferAccessInstance::iterate (void)
 			DE_NULL							// const VkSemaphore*			pSignalSemaphores;
 		};
 
-		VK_CHECK(vk.resetFences(*m_device, 1, &m_fence.get()));
+		VK_CHECK(vk.resetFences(m_device->get(), 1, &m_fence.get()));
 		VK_CHECK(vk.queueSubmit(m_queue, 1, &submitInfo, *m_fence));
-		VK_CHECK(vk.waitForFences(*m_device, 1, &m_fence.get(), true, ~(0ull) /* infinity */));
+		VK_CHECK(vk.waitForFences(m_device->get(), 1, &m_fence.get(), true, ~(0ull) /* infinity */));
 	}
 
 	// Prepare result buffer for read
@@ -1100,7 +1100,7 @@ tcu::TestStatus BufferAccessInstance::iterate (void)
 			m_outBufferAllocSize,					//  VkDeviceSize	size;
 		};
 
-		VK_CHECK(vk.invalidateMappedMemoryRanges(*m_device, 1u, &outBufferRange));
+		VK_CHECK(vk.invalidateMappedMemoryRanges(m_device->get(), 1u, &outBufferRange));
 	}
 
 	if (verifyResult())
@@ -1306,7 +1306,7 @@ bool BufferAccessInstance::verifyResult (void)
 // BufferReadInstance
 
 BufferReadInstance::BufferReadInstance (Context&			context,
-										Move<VkDevice>		device,
+										de::MovePtr<PooledDevice>	device,
 										ShaderType			shaderType,
 										VkShaderStageFlags	shaderStage,
 										VkFormat			bufferFormat,
@@ -1325,7 +1325,7 @@ BufferReadInstance::BufferReadInstance (Context&			context,
 // BufferWriteInstance
 
 BufferWriteInstance::BufferWriteInstance (Context&				context,
-										  Move<VkDevice>		device,
+										  de::MovePtr<PooledDevice>	device,
 										  ShaderType			shaderType,
 										  VkShaderStageFlags	shaderStage,
 										  VkFormat				bufferFormat,
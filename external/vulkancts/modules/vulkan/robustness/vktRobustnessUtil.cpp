@@ -43,7 +43,7 @@ namespace robustness
 
 using namespace vk;
 
-Move<VkDevice> createRobustBufferAccessDevice (Context& context)
+de::MovePtr<PooledDevice> createRobustBufferAccessDevice (Context& context)
 {
 	const float queuePriority = 1.0f;
 
@@ -75,8 +75,8 @@ Move<VkDevice> createRobustBufferAccessDevice (Context& context)
 		&enabledFeatures						// const VkPhysicalDeviceFeatures*	pEnabledFeatures;
 	};
 
-	return createDevice(context.getPlatformInterface(), context.getInstance(),
-						context.getInstanceInterface(), context.getPhysicalDevice(), &deviceParams);
+	// All robustness cases request an identical device, so it is shared through the context device pool
+	return context.getPooledDevice(deviceParams);
 }
 
 bool areEqual (float a, float b)
@@ -123,7 +123,7 @@ class VertexAccessInstance : public vkt::TestInstance
 {
 public:
 										VertexAccessInstance					(Context&						context,
-																				 Move<VkDevice>					device,
+																				 de::MovePtr<PooledDevice>		device,
 																				 VkFormat						inputFormat,
 																				 deUint32						numVertexValues,
 																				 deUint32						numInstanceValues,
@@ -145,7 +145,7 @@ protected:
 	virtual void						initVertexIds							(deUint32 *indicesPtr, size_t indexCount) = 0;
 	virtual deUint32					getIndex								(deUint32 vertexNum) const = 0;
 
-	Move<VkDevice>						m_device;
+	de::MovePtr<PooledDevice>			m_device;
 
 	const VkFormat						m_inputFormat;
 	const deUint32						m_numVertexValues;
@@ -191,7 +191,7 @@ class DrawAccessInstance : public VertexAccessInstance
 {
 public:
 						DrawAccessInstance	(Context&				context,
-											 Move<VkDevice>			device,
+											 de::MovePtr<PooledDevice>	device,
 											 VkFormat				inputFormat,
 											 deUint32				numVertexValues,
 											 deUint32				numInstanceValues,
@@ -209,7 +209,7 @@ class DrawIndexedAccessInstance : public VertexAccessInstance
 {
 public:
 										DrawIndexedAccessInstance	(Context&						context,
-																	 Move<VkDevice>					device,
+																	 de::MovePtr<PooledDevice>		device,
 																	 VkFormat						inputFormat,
 																	 deUint32						numVertexValues,
 																	 deUint32						numInstanceValues,
@@ -353,7 +353,7 @@ DrawAccessTest::DrawAccessTest (tcu::TestContext&		testContext,
 
 TestInstance* DrawAccessTest::createInstance (Context& context) const
 {
-	Move<VkDevice> device = createRobustBufferAccessDevice(context);
+	de::MovePtr<PooledDevice> device = createRobustBufferAccessDevice(context);
 
 	return new DrawAccessInstance(context,
 								  device,
@@ -406,7 +406,7 @@ DrawIndexedAccessTest::DrawIndexedAccessTest (tcu::TestContext&		testContext,
 
 TestInstance* DrawIndexedAccessTest::createInstance (Context& context) const
 {
-	Move<VkDevice> device = createRobustBufferAccessDevice(context);
+	de::MovePtr<PooledDevice> device = createRobustBufferAccessDevice(context);
 
 	return new DrawIndexedAccessInstance(context,
 										 device,
@@ -421,7 +421,7 @@ TestInstance* DrawIndexedAccessTest::createInstance (Context& context) const
 // VertexAccessInstance
 
 VertexAccessInstance::VertexAccessInstance (Context&						context,
-											Move<VkDevice>					device,
+											de::MovePtr<PooledDevice>		device,
 											VkFormat						inputFormat,
 											deUint32						numVertexValues,
 											deUint32						numInstanceValues,
@@ -439,7 +439,7 @@ VertexAccessInstance::VertexAccessInstance (Context&						context,
 {
 	const DeviceInterface&		vk						= context.getDeviceInterface();
 	const deUint32				queueFamilyIndex		= context.getUniversalQueueFamilyIndex();
-	SimpleAllocator				memAlloc				(vk, *m_device, getPhysicalDeviceMemoryProperties(m_context.getInstanceInterface(), m_context.getPhysicalDevice()));
+	SimpleAllocator				memAlloc				(vk, m_device->get(), getPhysicalDeviceMemoryProperties(m_context.getInstanceInterface(), m_context.getPhysicalDevice()));
 	const deUint32				formatSizeInBytes		= tcu::getPixelSize(mapVkFormat(m_inputFormat));
 
 	// Check storage support
@@ -521,14 +521,14 @@ VertexAccessInstance::VertexAccessInstance (Context&						context,
 			&queueFamilyIndex							// const deUint32*		pQueueFamilyIndices;
 		};
 
-		m_vertexRateBuffer			= createBuffer(vk, *m_device, &vertexRateBufferParams);
-		bufferMemoryReqs			= getBufferMemoryRequirements(vk, *m_device, *m_vertexRateBuffer);
+		m_vertexRateBuffer			= createBuffer(vk, m_device->get(), &vertexRateBufferParams);
+		bufferMemoryReqs			= getBufferMemoryRequirements(vk, m_device->get(), *m_vertexRateBuffer);
 		m_vertexRateBufferAllocSize	= bufferMemoryReqs.size;
 		m_vertexRateBufferAlloc		= memAlloc.allocate(bufferMemoryReqs, MemoryRequirement::HostVisible);
 
-		VK_CHECK(vk.bindBufferMemory(*m_device, *m_vertexRateBuffer, m_vertexRateBufferAlloc->getMemory(), m_vertexRateBufferAlloc->getOffset()));
+		VK_CHECK(vk.bindBufferMemory(m_device->get(), *m_vertexRateBuffer, m_vertexRateBufferAlloc->getMemory(), m_vertexRateBufferAlloc->getOffset()));
 		populateBufferWithTestValues(m_vertexRateBufferAlloc->getHostPtr(), (deUint32)m_vertexRateBufferAllocSize, m_inputFormat);
-		flushMappedMemoryRange(vk, *m_device, m_vertexRateBufferAlloc->getMemory(), m_vertexRateBufferAlloc->getOffset(), VK_WHOLE_SIZE);
+		flushMappedMemoryRange(vk, m_device->get(), m_vertexRateBufferAlloc->getMemory(), m_vertexRateBufferAlloc->getOffset(), VK_WHOLE_SIZE);
 	}
 
 	// Create vertex buffer for instance input rate
@@ -549,14 +549,14 @@ VertexAccessInstance::VertexAccessInstance (Context&						context,
 			&queueFamilyIndex							// const deUint32*		pQueueFamilyIndices;
 		};
 
-		m_instanceRateBuffer			= createBuffer(vk, *m_device, &instanceRateBufferParams);
-		bufferMemoryReqs				= getBufferMemoryRequirements(vk, *m_device, *m_instanceRateBuffer);
+		m_instanceRateBuffer			= createBuffer(vk, m_device->get(), &instanceRateBufferParams);
+		bufferMemoryReqs				= getBufferMemoryRequirements(vk, m_device->get(), *m_instanceRateBuffer);
 		m_instanceRateBufferAllocSize	= bufferMemoryReqs.size;
 		m_instanceRateBufferAlloc		= memAlloc.allocate(bufferMemoryReqs, MemoryRequirement::HostVisible);
 
-		VK_CHECK(vk.bindBufferMemory(*m_device, *m_instanceRateBuffer, m_instanceRateBufferAlloc->getMemory(), m_instanceRateBufferAlloc->getOffset()));
+		VK_CHECK(vk.bindBufferMemory(m_device->get(), *m_instanceRateBuffer, m_instanceRateBufferAlloc->getMemory(), m_instanceRateBufferAlloc->getOffset()));
 		populateBufferWithTestValues(m_instanceRateBufferAlloc->getHostPtr(), (deUint32)m_instanceRateBufferAllocSize, m_inputFormat);
-		flushMappedMemoryRange(vk, *m_device, m_instanceRateBufferAlloc->getMemory(), m_instanceRateBufferAlloc->getOffset(), VK_WHOLE_SIZE);
+		flushMappedMemoryRange(vk, m_device->get(), m_instanceRateBufferAlloc->getMemory(), m_instanceRateBufferAlloc->getOffset(), VK_WHOLE_SIZE);
 	}
 
 	// Create vertex buffer that stores the vertex number (from 0 to m_numVertices - 1)
@@ -575,10 +575,10 @@ VertexAccessInstance::VertexAccessInstance (Context&						context,
 			&queueFamilyIndex							// const deUint32*		pQueueFamilyIndices;
 		};
 
-		m_vertexNumBuffer		= createBuffer(vk, *m_device, &vertexNumBufferParams);
-		m_vertexNumBufferAlloc	= memAlloc.allocate(getBufferMemoryRequirements(vk, *m_device, *m_vertexNumBuffer), MemoryRequirement::HostVisible);
+		m_vertexNumBuffer		= createBuffer(vk, m_device->get(), &vertexNumBufferParams);
+		m_vertexNumBufferAlloc	= memAlloc.allocate(getBufferMemoryRequirements(vk, m_device->get(), *m_vertexNumBuffer), MemoryRequirement::HostVisible);
 
-		VK_CHECK(vk.bindBufferMemory(*m_device, *m_vertexNumBuffer, m_vertexNumBufferAlloc->getMemory(), m_vertexNumBufferAlloc->getOffset()));
+		VK_CHECK(vk.bindBufferMemory(m_device->get(), *m_vertexNumBuffer, m_vertexNumBufferAlloc->getMemory(), m_vertexNumBufferAlloc->getOffset()));
 	}
 
 	// Create index buffer if required
@@ -598,12 +598,12 @@ VertexAccessInstance::VertexAccessInstance (Context&						context,
 			&queueFamilyIndex							// const deUint32*		pQueueFamilyIndices;
 		};
 
-		m_indexBuffer		= createBuffer(vk, *m_device, &indexBufferParams);
-		m_indexBufferAlloc	= memAlloc.allocate(getBufferMemoryRequirements(vk, *m_device, *m_indexBuffer), MemoryRequirement::HostVisible);
+		m_indexBuffer		= createBuffer(vk, m_device->get(), &indexBufferParams);
+		m_indexBufferAlloc	= memAlloc.allocate(getBufferMemoryRequirements(vk, m_device->get(), *m_indexBuffer), MemoryRequirement::HostVisible);
 
-		VK_CHECK(vk.bindBufferMemory(*m_device, *m_indexBuffer, m_indexBufferAlloc->getMemory(), m_indexBufferAlloc->getOffset()));
+		VK_CHECK(vk.bindBufferMemory(m_device->get(), *m_indexBuffer, m_indexBufferAlloc->getMemory(), m_indexBufferAlloc->getOffset()));
 		deMemcpy(m_indexBufferAlloc->getHostPtr(), indices.data(), (size_t)m_indexBufferSize);
-		flushMappedMemoryRange(vk, *m_device, m_indexBufferAlloc->getMemory(), m_indexBufferAlloc->getOffset(), VK_WHOLE_SIZE);
+		flushMappedMemoryRange(vk, m_device->get(), m_indexBufferAlloc->getMemory(), m_indexBufferAlloc->getOffset(), VK_WHOLE_SIZE);
 	}
 
 	// Create result ssbo
@@ -624,23 +624,23 @@ VertexAccessInstance::VertexAccessInstance (Context&						context,
 			&queueFamilyIndex							// const deUint32*		pQueueFamilyIndices;
 		};
 
-		m_outBuffer			= createBuffer(vk, *m_device, &outBufferParams);
-		m_outBufferAlloc	= memAlloc.allocate(getBufferMemoryRequirements(vk, *m_device, *m_outBuffer), MemoryRequirement::HostVisible);
+		m_outBuffer			= createBuffer(vk, m_device->get(), &outBufferParams);
+		m_outBufferAlloc	= memAlloc.allocate(getBufferMemoryRequirements(vk, m_device->get(), *m_outBuffer), MemoryRequirement::HostVisible);
 
-		VK_CHECK(vk.bindBufferMemory(*m_device, *m_outBuffer, m_outBufferAlloc->getMemory(), m_outBufferAlloc->getOffset()));
+		VK_CHECK(vk.bindBufferMemory(m_device->get(), *m_outBuffer, m_outBufferAlloc->getMemory(), m_outBufferAlloc->getOffset()));
 		deMemset(m_outBufferAlloc->getHostPtr(), 0xFF, (size_t)m_outBufferSize);
-		flushMappedMemoryRange(vk, *m_device, m_outBufferAlloc->getMemory(), m_outBufferAlloc->getOffset(), VK_WHOLE_SIZE);
+		flushMappedMemoryRange(vk, m_device->get(), m_outBufferAlloc->getMemory(), m_outBufferAlloc->getOffset(), VK_WHOLE_SIZE);
 	}
 
 	// Create descriptor set data
 	{
 		DescriptorPoolBuilder descriptorPoolBuilder;
 		descriptorPoolBuilder.addType(VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, 1u);
-		m_descriptorPool = descriptorPoolBuilder.build(vk, *m_device, VK_DESCRIPTOR_POOL_CREATE_FREE_DESCRIPTOR_SET_BIT, 1u);
+		m_descriptorPool = descriptorPoolBuilder.build(vk, m_device->get(), VK_DESCRIPTOR_POOL_CREATE_FREE_DESCRIPTOR_SET_BIT, 1u);
 
 		DescriptorSetLayoutBuilder setLayoutBuilder;
 		setLayoutBuilder.addSingleBinding(VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, VK_SHADER_STAGE_VERTEX_BIT);
-		m_descriptorSetLayout = setLayoutBuilder.build(vk, *m_device);
+		m_descriptorSetLayout = setLayoutBuilder.build(vk, m_device->get());
 
 		const VkDescriptorSetAllocateInfo descriptorSetAllocateInfo =
 		{
@@ -651,13 +651,13 @@ VertexAccessInstance::VertexAccessInstance (Context&						context,
 			&m_descriptorSetLayout.get()						// const VkDescriptorSetLayout*	pSetLayouts;
 		};
 
-		m_descriptorSet = allocateDescriptorSet(vk, *m_device, &descriptorSetAllocateInfo);
+		m_descriptorSet = allocateDescriptorSet(vk, m_device->get(), &descriptorSetAllocateInfo);
 
 		const VkDescriptorBufferInfo outBufferDescriptorInfo	= makeDescriptorBufferInfo(*m_outBuffer, 0ull, VK_WHOLE_SIZE);
 
 		DescriptorSetUpdateBuilder setUpdateBuilder;
 		setUpdateBuilder.writeSingle(*m_descriptorSet, DescriptorSetUpdateBuilder::Location::binding(0), VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, &outBufferDescriptorInfo);
-		setUpdateBuilder.update(vk, *m_device);
+		setUpdateBuilder.update(vk, m_device->get());
 	}
 
 	// Create fence
@@ -669,11 +669,11 @@ VertexAccessInstance::VertexAccessInstance (Context&						context,
 			0u										// VkFenceCreateFlags	flags;
 		};
 
-		m_fence = createFence(vk, *m_device, &fenceParams);
+		m_fence = createFence(vk, m_device->get(), &fenceParams);
 	}
 
 	// Get queue
-	vk.getDeviceQueue(*m_device, queueFamilyIndex, 0, &m_queue);
+	vk.getDeviceQueue(m_device->get(), queueFamilyIndex, 0, &m_queue);
 
 	// Setup graphics test environment
 	{
@@ -689,7 +689,7 @@ VertexAccessInstance::VertexAccessInstance (Context&						context,
 		drawConfig.indexCount		= (deUint32)(m_indexBufferSize / sizeof(deUint32));
 
 		m_graphicsTestEnvironment	= de::MovePtr<GraphicsEnvironment>(new GraphicsEnvironment(m_context,
-																							   *m_device,
+																							   m_device->get(),
 																							   *m_descriptorSetLayout,
 																							   *m_descriptorSet,
 																							   GraphicsEnvironment::VertexBindings(bindings, bindings + DE_LENGTH_OF_ARRAY(bindings)),
@@ -710,7 +710,7 @@ tcu::TestStatus VertexAccessInstance::iterate (void)
 
 		initVertexIds(bufferPtr, (size_t)(m_vertexNumBufferSize / sizeof(deUint32)));
 
-		flushMappedMemoryRange(vk, *m_device, m_vertexNumBufferAlloc->getMemory(), m_vertexNumBufferAlloc->getOffset(), VK_WHOLE_SIZE);
+		flushMappedMemoryRange(vk, m_device->get(), m_vertexNumBufferAlloc->getMemory(), m_vertexNumBufferAlloc->getOffset(), VK_WHOLE_SIZE);
 	}
 
 	// Submit command buffer
@@ -728,9 +728,9 @@ tcu::TestStatus VertexAccessInstance::iterate (void)
 			DE_NULL							// const VkSemaphore*			pSignalSemaphores;
 		};
 
-		VK_CHECK(vk.resetFences(*m_device, 1, &m_fence.get()));
+		VK_CHECK(vk.resetFences(m_device->get(), 1, &m_fence.get()));
 		VK_CHECK(vk.queueSubmit(m_queue, 1, &submitInfo, *m_fence));
-		VK_CHECK(vk.waitForFences(*m_device, 1, &m_fence.get(), true, ~(0ull) /* infinity */));
+		VK_CHECK(vk.waitForFences(m_device->get(), 1, &m_fence.get(), true, ~(0ull) /* infinity */));
 	}
 
 	// Prepare result buffer for read
@@ -744,7 +744,7 @@ tcu::TestStatus VertexAccessInstance::iterate (void)
 			m_outBufferSize,						//  VkDeviceSize	size;
 		};
 
-		VK_CHECK(vk.invalidateMappedMemoryRanges(*m_device, 1u, &outBufferRange));
+		VK_CHECK(vk.invalidateMappedMemoryRanges(m_device->get(), 1u, &outBufferRange));
 	}
 
 	if (verifyResult())
@@ -773,7 +773,7 @@ bool VertexAccessInstance::verifyResult (void)
 		m_outBufferSize,						// VkDeviceSize		size;
 	};
 
-	VK_CHECK(vk.invalidateMappedMemoryRanges(*m_device, 1u, &outBufferRange));
+	VK_CHECK(vk.invalidateMappedMemoryRanges(m_device->get(), 1u, &outBufferRange));
 
 	for (deUint32 valueNdx = 0; valueNdx < m_outBufferSize / outValueSize; valueNdx++)
 	{
@@ -986,7 +986,7 @@ VkDeviceSize VertexAccessInstance::getBufferSizeInBytes (deUint32 numScalars, Vk
 // DrawAccessInstance
 
 DrawAccessInstance::DrawAccessInstance (Context&				context,
-										Move<VkDevice>			device,
+										de::MovePtr<PooledDevice>	device,
 										VkFormat				inputFormat,
 										deUint32				numVertexValues,
 										deUint32				numInstanceValues,
@@ -1017,7 +1017,7 @@ deUint32 DrawAccessInstance::getIndex (deUint32 vertexNum) const
 // DrawIndexedAccessInstance
 
 DrawIndexedAccessInstance::DrawIndexedAccessInstance (Context&						context,
-													  Move<VkDevice>				device,
+													  de::MovePtr<PooledDevice>		device,
 													  VkFormat						inputFormat,
 													  deUint32						numVertexValues,
 													  deUint32						numInstanceValues,
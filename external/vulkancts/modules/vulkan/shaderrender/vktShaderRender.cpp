@@ -32,8 +32,10 @@
 #include "tcuSurface.hpp"
 #include "tcuVector.hpp"
 
+#include "deArrayBuffer.hpp"
 #include "deFilePath.hpp"
 #include "deMath.h"
+#include "deParallelFor.hpp"
 #include "deUniquePtr.hpp"
 
 #include "vkDeviceUtil.hpp"
@@ -63,6 +65,7 @@ namespace
 static const deUint32	MAX_RENDER_WIDTH	= 128;
 static const deUint32	MAX_RENDER_HEIGHT	= 128;
 static const tcu::Vec4	DEFAULT_CLEAR_COLOR	= tcu::Vec4(0.125f, 0.25f, 0.5f, 1.0f);
+static const int		REFERENCE_CHUNK_ROWS	= 4;	//!< Rows per work item when computing reference images
 
 static VkImageViewType textureTypeToImageViewType (TextureBinding::Type type)
 {
@@ -2310,122 +2313,211 @@ void ShaderRenderCaseInstance::render (deUint32				numVertices,
 	}
 }
 
-void ShaderRenderCaseInstance::computeVertexReference (tcu::Surface& result, const QuadGrid& quadGrid)
+namespace
 {
-	DE_ASSERT(m_evaluator);
 
-	// Buffer info.
-	const int				width		= result.getWidth();
-	const int				height		= result.getHeight();
-	const int				gridSize	= quadGrid.getGridSize();
-	const int				stride		= gridSize + 1;
-	const bool				hasAlpha	= true; // \todo [2015-09-07 elecro] add correct alpha check
-	ShaderEvalContext		evalCtx		(quadGrid);
+// Evaluates colors of grid vertices, each work item handling a range of grid rows.
+class VertexEvalTask : public de::RangeTask
+{
+public:
+	VertexEvalTask (const ShaderEvaluator& evaluator, const QuadGrid& quadGrid, bool hasAlpha, std::vector<tcu::Vec4>& colors)
+		: m_evaluator	(evaluator)
+		, m_quadGrid	(quadGrid)
+		, m_hasAlpha	(hasAlpha)
+		, m_colors		(colors)
+	{
+	}
 
-	// Evaluate color for each vertex.
-	std::vector<tcu::Vec4>	colors		((gridSize + 1) * (gridSize + 1));
-	for (int y = 0; y < gridSize+1; y++)
-	for (int x = 0; x < gridSize+1; x++)
+	void run (int begin, int end)
 	{
-		const float	sx			= (float)x / (float)gridSize;
-		const float	sy			= (float)y / (float)gridSize;
-		const int	vtxNdx		= ((y * (gridSize+1)) + x);
+		const int			gridSize	= m_quadGrid.getGridSize();
+		const int			stride		= gridSize + 1;
+		ShaderEvalContext	evalCtx		(m_quadGrid);
+
+		for (int y = begin; y < end; y++)
+		for (int x = 0; x < stride; x++)
+		{
+			const float	sx	= (float)x / (float)gridSize;
+			const float	sy	= (float)y / (float)gridSize;
 
-		evalCtx.reset(sx, sy);
-		m_evaluator->evaluate(evalCtx);
-		DE_ASSERT(!evalCtx.isDiscarded); // Discard is not available in vertex shader.
-		tcu::Vec4 color = evalCtx.color;
+			evalCtx.reset(sx, sy);
+			m_evaluator.evaluate(evalCtx);
+			DE_ASSERT(!evalCtx.isDiscarded); // Discard is not available in vertex shader.
 
-		if (!hasAlpha)
-			color.w() = 1.0f;
+			{
+				tcu::Vec4 color = evalCtx.color;
+
+				if (!m_hasAlpha)
+					color.w() = 1.0f;
 
-		colors[vtxNdx] = color;
+				m_colors[y * stride + x] = color;
+			}
+		}
 	}
 
-	// Render quads.
-	for (int y = 0; y < gridSize; y++)
-	for (int x = 0; x < gridSize; x++)
+private:
+	const ShaderEvaluator&		m_evaluator;
+	const QuadGrid&				m_quadGrid;
+	const bool					m_hasAlpha;
+	std::vector<tcu::Vec4>&		m_colors;
+};
+
+// Rasterizes grid quads with interpolated vertex colors. Quad rows cover disjoint pixel rows.
+class VertexInterpolateTask : public de::RangeTask
+{
+public:
+	VertexInterpolateTask (tcu::Surface& result, int gridSize, const std::vector<tcu::Vec4>& colors)
+		: m_result		(result)
+		, m_gridSize	(gridSize)
+		, m_colors		(colors)
+	{
+	}
+
+	void run (int begin, int end)
 	{
-		const float		x0		= (float)x       / (float)gridSize;
-		const float		x1		= (float)(x + 1) / (float)gridSize;
-		const float		y0		= (float)y       / (float)gridSize;
-		const float		y1		= (float)(y + 1) / (float)gridSize;
-
-		const float		sx0		= x0 * (float)width;
-		const float		sx1		= x1 * (float)width;
-		const float		sy0		= y0 * (float)height;
-		const float		sy1		= y1 * (float)height;
-		const float		oosx	= 1.0f / (sx1 - sx0);
-		const float		oosy	= 1.0f / (sy1 - sy0);
-
-		const int		ix0		= deCeilFloatToInt32(sx0 - 0.5f);
-		const int		ix1		= deCeilFloatToInt32(sx1 - 0.5f);
-		const int		iy0		= deCeilFloatToInt32(sy0 - 0.5f);
-		const int		iy1		= deCeilFloatToInt32(sy1 - 0.5f);
-
-		const int		v00		= (y * stride) + x;
-		const int		v01		= (y * stride) + x + 1;
-		const int		v10		= ((y + 1) * stride) + x;
-		const int		v11		= ((y + 1) * stride) + x + 1;
-		const tcu::Vec4	c00		= colors[v00];
-		const tcu::Vec4	c01		= colors[v01];
-		const tcu::Vec4	c10		= colors[v10];
-		const tcu::Vec4	c11		= colors[v11];
-
-		//printf("(%d,%d) -> (%f..%f, %f..%f) (%d..%d, %d..%d)\n", x, y, sx0, sx1, sy0, sy1, ix0, ix1, iy0, iy1);
-
-		for (int iy = iy0; iy < iy1; iy++)
-		for (int ix = ix0; ix < ix1; ix++)
+		const int width		= m_result.getWidth();
+		const int height	= m_result.getHeight();
+		const int stride	= m_gridSize + 1;
+
+		for (int y = begin; y < end; y++)
+		for (int x = 0; x < m_gridSize; x++)
 		{
-			DE_ASSERT(deInBounds32(ix, 0, width));
-			DE_ASSERT(deInBounds32(iy, 0, height));
-
-			const float			sfx		= (float)ix + 0.5f;
-			const float			sfy		= (float)iy + 0.5f;
-			const float			fx1		= deFloatClamp((sfx - sx0) * oosx, 0.0f, 1.0f);
-			const float			fy1		= deFloatClamp((sfy - sy0) * oosy, 0.0f, 1.0f);
-
-			// Triangle quad interpolation.
-			const bool			tri		= fx1 + fy1 <= 1.0f;
-			const float			tx		= tri ? fx1 : (1.0f-fx1);
-			const float			ty		= tri ? fy1 : (1.0f-fy1);
-			const tcu::Vec4&	t0		= tri ? c00 : c11;
-			const tcu::Vec4&	t1		= tri ? c01 : c10;
-			const tcu::Vec4&	t2		= tri ? c10 : c01;
-			const tcu::Vec4		color	= t0 + (t1-t0)*tx + (t2-t0)*ty;
-
-			result.setPixel(ix, iy, tcu::RGBA(color));
+			const float		x0		= (float)x       / (float)m_gridSize;
+			const float		x1		= (float)(x + 1) / (float)m_gridSize;
+			const float		y0		= (float)y       / (float)m_gridSize;
+			const float		y1		= (float)(y + 1) / (float)m_gridSize;
+
+			const float		sx0		= x0 * (float)width;
+			const float		sx1		= x1 * (float)width;
+			const float		sy0		= y0 * (float)height;
+			const float		sy1		= y1 * (float)height;
+			const float		oosx	= 1.0f / (sx1 - sx0);
+			const float		oosy	= 1.0f / (sy1 - sy0);
+
+			const int		ix0		= deCeilFloatToInt32(sx0 - 0.5f);
+			const int		ix1		= deCeilFloatToInt32(sx1 - 0.5f);
+			const int		iy0		= deCeilFloatToInt32(sy0 - 0.5f);
+			const int		iy1		= deCeilFloatToInt32(sy1 - 0.5f);
+
+			const int		v00		= (y * stride) + x;
+			const int		v01		= (y * stride) + x + 1;
+			const int		v10		= ((y + 1) * stride) + x;
+			const int		v11		= ((y + 1) * stride) + x + 1;
+			const tcu::Vec4	c00		= m_colors[v00];
+			const tcu::Vec4	c01		= m_colors[v01];
+			const tcu::Vec4	c10		= m_colors[v10];
+			const tcu::Vec4	c11		= m_colors[v11];
+
+			for (int iy = iy0; iy < iy1; iy++)
+			for (int ix = ix0; ix < ix1; ix++)
+			{
+				DE_ASSERT(deInBounds32(ix, 0, width));
+				DE_ASSERT(deInBounds32(iy, 0, height));
+
+				const float			sfx		= (float)ix + 0.5f;
+				const float			sfy		= (float)iy + 0.5f;
+				const float			fx1		= deFloatClamp((sfx - sx0) * oosx, 0.0f, 1.0f);
+				const float			fy1		= deFloatClamp((sfy - sy0) * oosy, 0.0f, 1.0f);
+
+				// Triangle quad interpolation.
+				const bool			tri		= fx1 + fy1 <= 1.0f;
+				const float			tx		= tri ? fx1 : (1.0f-fx1);
+				const float			ty		= tri ? fy1 : (1.0f-fy1);
+				const tcu::Vec4&	t0		= tri ? c00 : c11;
+				const tcu::Vec4&	t1		= tri ? c01 : c10;
+				const tcu::Vec4&	t2		= tri ? c10 : c01;
+				const tcu::Vec4		color	= t0 + (t1-t0)*tx + (t2-t0)*ty;
+
+				m_result.setPixel(ix, iy, tcu::RGBA(color));
+			}
 		}
 	}
-}
 
-void ShaderRenderCaseInstance::computeFragmentReference (tcu::Surface& result, const QuadGrid& quadGrid)
+private:
+	tcu::Surface&					m_result;
+	const int						m_gridSize;
+	const std::vector<tcu::Vec4>&	m_colors;
+};
+
+// Evaluates the shader for each pixel, each work item handling a range of rows.
+class FragmentEvalTask : public de::RangeTask
+{
+public:
+	FragmentEvalTask (const ShaderEvaluator& evaluator, const QuadGrid& quadGrid, bool hasAlpha, const tcu::Vec4& clearColor, tcu::Surface& result)
+		: m_evaluator	(evaluator)
+		, m_quadGrid	(quadGrid)
+		, m_hasAlpha	(hasAlpha)
+		, m_clearColor	(clearColor)
+		, m_result		(result)
+	{
+	}
+
+	void run (int begin, int end)
+	{
+		const int			width		= m_result.getWidth();
+		const int			height		= m_result.getHeight();
+		ShaderEvalContext	evalCtx		(m_quadGrid);
+
+		for (int y = begin; y < end; y++)
+		for (int x = 0; x < width; x++)
+		{
+			const float sx = ((float)x + 0.5f) / (float)width;
+			const float sy = ((float)y + 0.5f) / (float)height;
+
+			evalCtx.reset(sx, sy);
+			m_evaluator.evaluate(evalCtx);
+
+			{
+				// Select either clear color or computed color based on discarded bit.
+				tcu::Vec4 color = evalCtx.isDiscarded ? m_clearColor : evalCtx.color;
+
+				if (!m_hasAlpha)
+					color.w() = 1.0f;
+
+				m_result.setPixel(x, y, tcu::RGBA(color));
+			}
+		}
+	}
+
+private:
+	const ShaderEvaluator&	m_evaluator;
+	const QuadGrid&			m_quadGrid;
+	const bool				m_hasAlpha;
+	const tcu::Vec4			m_clearColor;
+	tcu::Surface&			m_result;
+};
+
+} // anonymous
+
+void ShaderRenderCaseInstance::computeVertexReference (tcu::Surface& result, const QuadGrid& quadGrid)
 {
 	DE_ASSERT(m_evaluator);
 
-	// Buffer info.
-	const int			width		= result.getWidth();
-	const int			height		= result.getHeight();
-	const bool			hasAlpha	= true;  // \todo [2015-09-07 elecro] add correct alpha check
-	ShaderEvalContext	evalCtx		(quadGrid);
+	const int				gridSize	= quadGrid.getGridSize();
+	const bool				hasAlpha	= true; // \todo [2015-09-07 elecro] add correct alpha check
+	std::vector<tcu::Vec4>	colors		((gridSize + 1) * (gridSize + 1));
 
-	// Render.
-	for (int y = 0; y < height; y++)
-	for (int x = 0; x < width; x++)
+	// Evaluate color for each vertex.
 	{
-		const float sx = ((float)x + 0.5f) / (float)width;
-		const float sy = ((float)y + 0.5f) / (float)height;
+		VertexEvalTask task (*m_evaluator, quadGrid, hasAlpha, colors);
+		de::parallelFor(0, gridSize + 1, REFERENCE_CHUNK_ROWS, task);
+	}
 
-		evalCtx.reset(sx, sy);
-		m_evaluator->evaluate(evalCtx);
-		// Select either clear color or computed color based on discarded bit.
-		tcu::Vec4 color = evalCtx.isDiscarded ? m_clearColor : evalCtx.color;
+	// Render quads.
+	{
+		VertexInterpolateTask task (result, gridSize, colors);
+		de::parallelFor(0, gridSize, REFERENCE_CHUNK_ROWS, task);
+	}
+}
 
-		if (!hasAlpha)
-			color.w() = 1.0f;
+void ShaderRenderCaseInstance::computeFragmentReference (tcu::Surface& result, const QuadGrid& quadGrid)
+{
+	DE_ASSERT(m_evaluator);
 
-		result.setPixel(x, y, tcu::RGBA(color));
-	}
+	const bool			hasAlpha	= true;  // \todo [2015-09-07 elecro] add correct alpha check
+	FragmentEvalTask	task		(*m_evaluator, quadGrid, hasAlpha, m_clearColor, result);
+
+	de::parallelFor(0, result.getHeight(), REFERENCE_CHUNK_ROWS, task);
 }
 
 bool ShaderRenderCaseInstance::compareImages (const tcu::Surface& resImage, const tcu::Surface& refImage, float errorThreshold)
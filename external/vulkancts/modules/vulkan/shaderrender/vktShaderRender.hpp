@@ -232,6 +232,7 @@ inline void evalCoordsSwizzleWZYX		(ShaderEvalContext& c) { c.color = c.coords.s
 
 // ShaderEvaluator
 // Either inherit a class with overridden evaluate() or just pass in an evalFunc.
+// Reference images are computed from several threads at once, so evaluation must not modify shared state.
 
 class ShaderEvaluator
 {
@@ -416,13 +416,9 @@ void TextureBinding::updateTextureData (const TestTextureSp& textureData, const
 		m_textureImageMemory = allocator.allocate(getImageMemoryRequirements(vkd, vkDevice, *m_textureImage), MemoryRequirement::Any);
 		VK_CHECK(vkd.bindImageMemory(vkDevice, *m_textureImage, m_textureImageMemory->getMemory(), m_textureImageMemory->getOffset()));
 
-		pipeline::uploadTestTexture	(vkd,
-									 vkDevice,
-									 m_context.getUniversalQueue(),
-									 m_context.getUniversalQueueFamilyIndex(),
-									 allocator,
-									 *m_textureData,
-									 *m_textureImage);
+		// Rendering is submitted to the universal queue after the upload
+		pipeline::uploadTestTexture(m_context.getStagingRing(), *m_textureData, *m_textureImage);
+		m_context.getStagingRing().submit();
 	}
 
 	updateTextureViewMipLevels(0, mipLevels - 1);
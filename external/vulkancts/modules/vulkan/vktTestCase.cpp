@@ -28,6 +28,8 @@
 #include "vkQueryUtil.hpp"
 #include "vkDeviceUtil.hpp"
 #include "vkMemUtil.hpp"
+#include "vkStagingRing.hpp"
+#include "vkSharedPipelineCache.hpp"
 #include "vkPlatform.hpp"
 #include "vkDebugReportUtil.hpp"
 
@@ -38,6 +40,8 @@
 #include "deMemory.h"
 
 #include <set>
+#include <list>
+#include <algorithm>
 
 namespace vkt
 {
@@ -626,8 +630,166 @@ vk::Allocator* createAllocator (DefaultDevice* device)
 	return new SimpleAllocator(device->getDeviceInterface(), device->getDevice(), memoryProperties);
 }
 
+// Pipeline cache utilities
+
+vk::SharedPipelineCache* createSharedPipelineCache (const PlatformInterface& vkp, DefaultDevice* device, const tcu::CommandLine& cmdLine)
+{
+	if (!cmdLine.isPipelineCacheEnabled())
+		return DE_NULL;
+
+	return new vk::SharedPipelineCache(vkp, device->getInstance(), device->getDeviceInterface(), device->getDevice(), device->getDeviceProperties(), cmdLine.getPipelineCacheFilename());
+}
+
 } // anonymous
 
+// DevicePool
+
+struct PooledDeviceEntry
+{
+								PooledDeviceEntry	(const DeviceCreateInfoKey& key_, Move<VkDevice> device_, const PlatformInterface& vkp, VkInstance instance)
+									: key		(key_)
+									, device	(device_)
+									, driver	(vkp, instance, *device)
+									, inUse		(false)
+								{
+								}
+
+	const DeviceCreateInfoKey	key;
+	const Unique<VkDevice>		device;
+	const DeviceDriver			driver;
+	bool						inUse;
+};
+
+DevicePool::DevicePool (const PlatformInterface& vkp, VkInstance instance, const InstanceInterface& vki, VkPhysicalDevice physicalDevice, size_t maxDevices)
+	: m_vkp				(vkp)
+	, m_instance		(instance)
+	, m_vki				(vki)
+	, m_physicalDevice	(physicalDevice)
+	, m_maxDevices		(maxDevices)
+{
+}
+
+DevicePool::~DevicePool (void)
+{
+	for (EntryList::iterator entryIter = m_entries.begin(); entryIter != m_entries.end(); ++entryIter)
+	{
+		DE_ASSERT(!(*entryIter)->inUse);
+		delete *entryIter;
+	}
+}
+
+void DevicePool::removeEntry (EntryList::iterator entryIter)
+{
+	PooledDeviceEntry* const entry = *entryIter;
+
+	m_entries.erase(entryIter);
+	delete entry;
+}
+
+void DevicePool::evictIdleDevices (size_t maxDevices)
+{
+	EntryList::iterator entryIter = m_entries.end();
+
+	while (m_entries.size() > maxDevices && entryIter != m_entries.begin())
+	{
+		--entryIter;
+
+		if (!(*entryIter)->inUse)
+			removeEntry(entryIter++);
+	}
+}
+
+de::MovePtr<PooledDevice> DevicePool::getDevice (const VkDeviceCreateInfo& createInfo)
+{
+	const DeviceCreateInfoKey	key	(createInfo);
+
+	if (key.isValid())
+	{
+		for (EntryList::iterator entryIter = m_entries.begin(); entryIter != m_entries.end(); ++entryIter)
+		{
+			PooledDeviceEntry* const entry = *entryIter;
+
+			if (entry->inUse || entry->key != key)
+				continue;
+
+			// Only catches lost devices, see DevicePool
+			if (entry->driver.deviceWaitIdle(*entry->device) != VK_SUCCESS)
+			{
+				removeEntry(entryIter);
+				break;
+			}
+
+			m_entries.erase(entryIter);
+			m_entries.push_front(entry);
+			entry->inUse = true;
+
+			return de::MovePtr<PooledDevice>(new PooledDevice(*this, entry));
+		}
+	}
+
+	evictIdleDevices(m_maxDevices > 0 ? m_maxDevices - 1 : 0);
+
+	{
+		de::MovePtr<PooledDeviceEntry>	entry	(new PooledDeviceEntry(key, createDevice(m_vkp, m_instance, m_vki, m_physicalDevice, &createInfo), m_vkp, m_instance));
+		de::MovePtr<PooledDevice>		device	(new PooledDevice(*this, entry.get()));
+
+		m_entries.push_front(entry.get());
+		entry->inUse = true;
+		entry.release();
+
+		return device;
+	}
+}
+
+bool DevicePool::hasIdleDevice (const VkDeviceCreateInfo& createInfo) const
+{
+	const DeviceCreateInfoKey	key	(createInfo);
+
+	for (EntryList::const_iterator entryIter = m_entries.begin(); entryIter != m_entries.end(); ++entryIter)
+	{
+		if (!(*entryIter)->inUse && (*entryIter)->key == key)
+			return true;
+	}
+
+	return false;
+}
+
+void DevicePool::releaseDevice (PooledDeviceEntry* entry)
+{
+	const EntryList::iterator	entryIter	= std::find(m_entries.begin(), m_entries.end(), entry);
+
+	DE_ASSERT(entryIter != m_entries.end() && entry->inUse);
+
+	entry->inUse = false;
+
+	// Devices that cannot be shared or fail to wait idle are destroyed right away
+	if (!entry->key.isValid() || entry->driver.deviceWaitIdle(*entry->device) != VK_SUCCESS)
+		removeEntry(entryIter);
+
+	evictIdleDevices(m_maxDevices);
+}
+
+PooledDevice::PooledDevice (DevicePool& pool, PooledDeviceEntry* entry)
+	: m_pool	(pool)
+	, m_entry	(entry)
+{
+}
+
+PooledDevice::~PooledDevice (void)
+{
+	m_pool.releaseDevice(m_entry);
+}
+
+VkDevice PooledDevice::get (void) const
+{
+	return *m_entry->device;
+}
+
+const DeviceInterface& PooledDevice::getDeviceInterface (void) const
+{
+	return m_entry->driver;
+}
+
 // Context
 
 Context::Context (tcu::TestContext&				testCtx,
@@ -638,6 +800,8 @@ Context::Context (tcu::TestContext&				testCtx,
 	, m_progCollection		(progCollection)
 	, m_device				(new DefaultDevice(m_platformInterface, testCtx.getCommandLine()))
 	, m_allocator			(createAllocator(m_device.get()))
+	, m_pipelineCache		(createSharedPipelineCache(m_platformInterface, m_device.get(), testCtx.getCommandLine()))
+	, m_devicePool			(new DevicePool(m_platformInterface, m_device->getInstance(), m_device->getInstanceInterface(), m_device->getPhysicalDevice(), MAX_POOLED_DEVICES))
 {
 }
 
@@ -689,7 +853,7 @@ const vk::VkPhysicalDeviceMemoryPriorityFeaturesEXT&
 const vk::VkPhysicalDeviceProperties&	Context::getDeviceProperties			(void) const { return m_device->getDeviceProperties();			}
 const vector<string>&					Context::getDeviceExtensions			(void) const { return m_device->getDeviceExtensions();			}
 vk::VkDevice							Context::getDevice						(void) const { return m_device->getDevice();					}
-const vk::DeviceInterface&				Context::getDeviceInterface				(void) const { return m_device->getDeviceInterface();			}
+const vk::DeviceInterface&				Context::getDeviceInterface				(void) const { return m_pipelineCache ? m_pipelineCache->getDeviceInterface() : m_device->getDeviceInterface();	}
 deUint32								Context::getUniversalQueueFamilyIndex	(void) const { return m_device->getUniversalQueueFamilyIndex();	}
 vk::VkQueue								Context::getUniversalQueue				(void) const { return m_device->getUniversalQueue();			}
 deUint32								Context::getSparseQueueFamilyIndex		(void) const { return m_device->getSparseQueueFamilyIndex();	}
@@ -703,6 +867,43 @@ bool									Context::contextSupports				(const ApiVersion version) const
 bool									Context::contextSupports				(const deUint32 requiredApiVersionBits) const
 																							{ return m_device->getUsedApiVersion() >= requiredApiVersionBits; }
 
+vk::VkPipelineCache Context::getPipelineCache (void) const
+{
+	return m_pipelineCache ? m_pipelineCache->get() : vk::VkPipelineCache(DE_NULL);
+}
+
+bool Context::isPipelineCacheEnabled (void) const
+{
+	return m_pipelineCache != DE_NULL;
+}
+
+vk::PipelineCacheStats Context::getPipelineCacheStats (void) const
+{
+	DE_ASSERT(m_pipelineCache);
+	return m_pipelineCache->getStats();
+}
+
+vk::StagingRing& Context::getStagingRing (void) const
+{
+	// Created on first use, most cases never touch the ring
+	if (!m_stagingRing)
+		m_stagingRing = de::MovePtr<vk::StagingRing>(new vk::StagingRing(m_device->getDeviceInterface(), m_device->getDevice(), *m_allocator,
+																		 m_device->getUniversalQueue(), m_device->getUniversalQueueFamilyIndex()));
+
+	return *m_stagingRing;
+}
+
+void Context::discardStagingRing (void)
+{
+	if (m_stagingRing)
+		m_stagingRing->discardPending();
+}
+
+de::MovePtr<PooledDevice> Context::getPooledDevice (const vk::VkDeviceCreateInfo& createInfo)
+{
+	return m_devicePool->getDevice(createInfo);
+}
+
 bool Context::requireDeviceExtension (const std::string& required)
 {
 	if (!isDeviceExtensionSupported(getUsedApiVersion(), getDeviceExtensions(), required))
@@ -31,6 +31,8 @@
 #include "vkApiVersion.hpp"
 #include "vktTestCaseDefs.hpp"
 
+#include <list>
+
 namespace glu
 {
 struct ProgramSources;
@@ -39,7 +41,12 @@ struct ProgramSources;
 namespace vk
 {
 class PlatformInterface;
+class InstanceInterface;
+class DeviceInterface;
 class Allocator;
+class StagingRing;
+class SharedPipelineCache;
+struct PipelineCacheStats;
 struct SourceCollections;
 }
 
@@ -47,6 +54,74 @@ namespace vkt
 {
 
 class DefaultDevice;
+class DevicePool;
+struct PooledDeviceEntry;
+
+//! Device borrowed from a DevicePool, returned to the pool on destruction
+class PooledDevice
+{
+public:
+								PooledDevice		(DevicePool& pool, PooledDeviceEntry* entry);
+								~PooledDevice		(void);
+
+	vk::VkDevice				get					(void) const;
+	const vk::DeviceInterface&	getDeviceInterface	(void) const;
+
+private:
+								PooledDevice		(const PooledDevice&); // Not allowed
+	PooledDevice&				operator=			(const PooledDevice&); // Not allowed
+
+	DevicePool&					m_pool;
+	PooledDeviceEntry* const	m_entry;
+};
+
+/*--------------------------------------------------------------------*//*!
+ * \brief Pool of devices created with custom create infos
+ *
+ * Released devices are kept alive and handed out again to the next
+ * request with an identical VkDeviceCreateInfo (see
+ * vk::DeviceCreateInfoKey). Only a limited number of devices is kept
+ * alive; least recently used idle devices are destroyed first.
+ *
+ * A released device is only checked with vkDeviceWaitIdle: a device
+ * that reports an error (e.g. VK_ERROR_DEVICE_LOST) is destroyed instead
+ * of being kept. Nothing else is verified or reset. Objects and memory
+ * allocations that were not destroyed, queries, fence and event states
+ * and pending semaphore signals are all carried over to the next user,
+ * so cases must destroy everything they created on a pooled device and
+ * leave no semaphore signaled before releasing it.
+ *//*--------------------------------------------------------------------*/
+class DevicePool
+{
+public:
+								DevicePool			(const vk::PlatformInterface& vkp, vk::VkInstance instance, const vk::InstanceInterface& vki, vk::VkPhysicalDevice physicalDevice, size_t maxDevices);
+								~DevicePool			(void);
+
+	de::MovePtr<PooledDevice>	getDevice			(const vk::VkDeviceCreateInfo& createInfo);
+	void						releaseDevice		(PooledDeviceEntry* entry);
+
+	//! Number of live devices, including devices in use
+	size_t						getNumDevices		(void) const { return m_entries.size(); }
+	//! Is an idle device for the create info kept alive
+	bool						hasIdleDevice		(const vk::VkDeviceCreateInfo& createInfo) const;
+
+private:
+	typedef std::list<PooledDeviceEntry*>	EntryList;
+
+								DevicePool			(const DevicePool&); // Not allowed
+	DevicePool&					operator=			(const DevicePool&); // Not allowed
+
+	void						removeEntry			(EntryList::iterator entryIter);
+	void						evictIdleDevices	(size_t maxDevices);
+
+	const vk::PlatformInterface&	m_vkp;
+	const vk::VkInstance			m_instance;
+	const vk::InstanceInterface&	m_vki;
+	const vk::VkPhysicalDevice		m_physicalDevice;
+	const size_t					m_maxDevices;
+
+	EntryList						m_entries;			//!< Most recently used first
+};
 
 class Context
 {
@@ -112,6 +187,24 @@ public:
 	deUint32									getSparseQueueFamilyIndex		(void) const;
 	vk::VkQueue									getSparseQueue					(void) const;
 	vk::Allocator&								getDefaultAllocator				(void) const;
+
+	// Pipeline cache shared by all cases, enabled with --deqp-pipeline-cache=enable
+	// \note getDeviceInterface() creates pipelines with the shared cache when no cache is given,
+	//		  so getPipelineCache() is only needed to pass the cache explicitly. Returns DE_NULL if
+	//		  the shared cache is not enabled.
+	vk::VkPipelineCache							getPipelineCache				(void) const;
+	bool										isPipelineCacheEnabled			(void) const;
+	vk::PipelineCacheStats						getPipelineCacheStats			(void) const;
+
+	// Staging buffer ring on the default device for image uploads and readbacks
+	vk::StagingRing&							getStagingRing					(void) const;
+	//! Drop work recorded into the staging ring but not submitted. Does nothing if the ring was never used.
+	void										discardStagingRing				(void);
+
+	// Device created on the default physical device with a custom create info. Devices are kept
+	// alive after release and handed out again for identical create infos, see DevicePool.
+	de::MovePtr<PooledDevice>					getPooledDevice					(const vk::VkDeviceCreateInfo& createInfo);
+
 	bool										contextSupports					(const deUint32 majorNum, const deUint32 minorNum, const deUint32 patchNum) const;
 	bool										contextSupports					(const vk::ApiVersion version) const;
 	bool										contextSupports					(const deUint32 requiredApiVersionBits) const;
@@ -128,8 +221,16 @@ protected:
 
 	const de::UniquePtr<DefaultDevice>			m_device;
 	const de::UniquePtr<vk::Allocator>			m_allocator;
+	const de::UniquePtr<vk::SharedPipelineCache>	m_pipelineCache;
+	const de::UniquePtr<DevicePool>				m_devicePool;
+	mutable de::MovePtr<vk::StagingRing>		m_stagingRing;
 
 private:
+	enum
+	{
+		MAX_POOLED_DEVICES	= 4		//!< Number of live devices kept in the device pool
+	};
+
 												Context							(const Context&); // Not allowed
 	Context&									operator=						(const Context&); // Not allowed
 };
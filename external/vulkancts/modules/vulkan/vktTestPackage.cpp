@@ -29,6 +29,7 @@
 #include "tcuCommandLine.hpp"
 
 #include "vkPlatform.hpp"
+#include "vkStagingRing.hpp"
 #include "vkPrograms.hpp"
 #include "vkBinaryRegistry.hpp"
 #include "vkShaderToSpirV.hpp"
@@ -36,6 +37,7 @@
 #include "vkQueryUtil.hpp"
 #include "vkApiVersion.hpp"
 #include "vkRenderDocUtil.hpp"
+#include "vkSharedPipelineCache.hpp"
 
 #include "deUniquePtr.hpp"
 
@@ -194,6 +196,8 @@ public:
 
 	virtual tcu::TestNode::IterateResult		iterate				(tcu::TestCase* testCase);
 
+	virtual void								addSessionCounters	(tcu::SessionCounters& counters) const;
+
 private:
 	vk::BinaryCollection						m_progCollection;
 	vk::BinaryRegistryReader					m_prebuiltBinRegistry;
@@ -325,6 +329,8 @@ void TestCaseExecutor::deinit (tcu::TestCase*)
 
 	if (m_renderDoc) m_renderDoc->endFrame(m_context.getInstance());
 
+	m_context.discardStagingRing();
+
 	// Collect and report any debug messages
 	if (m_debugReportRecorder)
 	{
@@ -378,6 +384,21 @@ tcu::TestNode::IterateResult TestCaseExecutor::iterate (tcu::TestCase*)
 		return tcu::TestNode::CONTINUE;
 }
 
+void TestCaseExecutor::addSessionCounters (tcu::SessionCounters& counters) const
+{
+	if (m_context.isPipelineCacheEnabled())
+	{
+		const vk::PipelineCacheStats stats = m_context.getPipelineCacheStats();
+
+		counters["Pipeline cache loaded bytes"]		+= (deInt64)stats.loadedDataSize;
+		counters["Pipeline cache rejected bytes"]	+= (deInt64)stats.rejectedDataSize;
+		counters["Pipeline cache stored bytes"]		+= (deInt64)stats.dataSize;
+		counters["Pipeline cache pipelines"]		+= (deInt64)stats.numPipelines;
+		counters["Pipeline cache hits"]				+= (deInt64)stats.numHits;
+		counters["Pipeline cache misses"]			+= (deInt64)stats.numMisses;
+	}
+}
+
 // GLSL shader tests
 
 void createGlslTests (tcu::TestCaseGroup* glslTests)
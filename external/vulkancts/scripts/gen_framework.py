@@ -1152,6 +1152,8 @@ def writeNullDriverImpl (api, filename):
 		specialFuncNames	= [
 				"vkCreateGraphicsPipelines",
 				"vkCreateComputePipelines",
+				"vkGetPipelineCacheData",
+				"vkMergePipelineCaches",
 				"vkGetInstanceProcAddr",
 				"vkGetDeviceProcAddr",
 				"vkEnumeratePhysicalDevices",
@@ -1203,6 +1205,7 @@ def writeNullDriverImpl (api, filename):
 
 			yield "VKAPI_ATTR %s VKAPI_CALL %s (%s)" % (function.returnType, getInterfaceName(function), argListToStr(function.arguments))
 			yield "{"
+			yield "\tVK_NULL_PROFILE_ENTRY_POINT(%s);" % getInterfaceName(function)
 			yield "\tDE_UNREF(%s);" % function.arguments[-2].name
 
 			if getHandle(objectType).type == Handle.TYPE_NONDISP:
@@ -1217,6 +1220,7 @@ def writeNullDriverImpl (api, filename):
 
 			yield "VKAPI_ATTR %s VKAPI_CALL %s (%s)" % (function.returnType, getInterfaceName(function), argListToStr(function.arguments))
 			yield "{"
+			yield "\tVK_NULL_PROFILE_ENTRY_POINT(%s);" % getInterfaceName(function)
 			for arg in function.arguments[:-2]:
 				yield "\tDE_UNREF(%s);" % arg.name
 
@@ -1231,6 +1235,7 @@ def writeNullDriverImpl (api, filename):
 		for function in dummyFuncs:
 			yield "VKAPI_ATTR %s VKAPI_CALL %s (%s)" % (function.returnType, getInterfaceName(function), argListToStr(function.arguments))
 			yield "{"
+			yield "\tVK_NULL_PROFILE_ENTRY_POINT(%s);" % getInterfaceName(function)
 			for arg in function.arguments:
 				yield "\tDE_UNREF(%s);" % arg.name
 			if function.returnType != "void":
@@ -28,11 +28,14 @@
 #include "tcuTestHierarchyUtil.hpp"
 #include "tcuCommandLine.hpp"
 #include "tcuTestLog.hpp"
+#include "tcuCaseIndex.hpp"
+#include "tcuForkSessionExecutor.hpp"
 
 #include "qpInfo.h"
 #include "qpDebugOut.h"
 
 #include "deMath.h"
+#include "deStringUtil.hpp"
 
 #include <iostream>
 
@@ -51,6 +54,20 @@ static void writeCaselistsToStdout (TestPackageRoot& root, TestContext& testCtx)
 {
 	DefaultHierarchyInflater			inflater		(testCtx);
 	de::MovePtr<const CaseListFilter>	caseListFilter	(testCtx.getCommandLine().createCaseListFilter(testCtx.getArchive()));
+	const CaseIndex* const				caseIndex		= caseListFilter->getCaseIndex();
+
+	if (caseIndex && isCaseIndexComplete(root, *caseIndex))
+	{
+		std::vector<TestNode*> packages;
+
+		root.getChildren(packages);
+
+		for (size_t ndx = 0; ndx < packages.size(); ndx++)
+			caseIndex->writeCaseList(std::cout, packages[ndx]->getName(), *caseListFilter);
+
+		return;
+	}
+
 	TestHierarchyIterator				iter			(root, inflater, *caseListFilter);
 
 	while (iter.getState() != TestHierarchyIterator::STATE_FINISHED)
@@ -86,6 +103,7 @@ App::App (Platform& platform, Archive& archive, TestLog& log, const CommandLine&
 	, m_testCtx			(DE_NULL)
 	, m_testRoot		(DE_NULL)
 	, m_testExecutor	(DE_NULL)
+	, m_forkExecutor	(DE_NULL)
 {
 	print("dEQP Core %s (0x%08x) starting..\n", qpGetReleaseName(), qpGetReleaseId());
 	print("  target implementation = '%s'\n", qpGetTargetName());
@@ -112,7 +130,9 @@ App::App (Platform& platform, Archive& archive, TestLog& log, const CommandLine&
 		m_testRoot = new TestPackageRoot(*m_testCtx, TestPackageRegistry::getSingleton());
 
 		// \note No executor is created if runmode is not EXECUTE
-		if (runMode == RUNMODE_EXECUTE)
+		if (runMode == RUNMODE_EXECUTE && cmdLine.getForkWorkerCount() > 0)
+			m_forkExecutor = new ForkSessionExecutor(*m_testRoot, *m_testCtx, cmdLine.getForkWorkerCount());
+		else if (runMode == RUNMODE_EXECUTE)
 			m_testExecutor = new TestSessionExecutor(*m_testRoot, *m_testCtx);
 		else if (runMode == RUNMODE_DUMP_STDOUT_CASELIST)
 			writeCaselistsToStdout(*m_testRoot, *m_testCtx);
@@ -137,6 +157,7 @@ App::~App (void)
 
 void App::cleanup (void)
 {
+	delete m_forkExecutor;
 	delete m_testExecutor;
 	delete m_testRoot;
 	delete m_testCtx;
@@ -155,7 +176,7 @@ void App::cleanup (void)
  *//*--------------------------------------------------------------------*/
 bool App::iterate (void)
 {
-	if (!m_testExecutor)
+	if (!m_testExecutor && !m_forkExecutor)
 	{
 		DE_ASSERT(m_testCtx->getCommandLine().getRunMode() != RUNMODE_EXECUTE);
 		return false;
@@ -170,7 +191,7 @@ bool App::iterate (void)
 	{
 		try
 		{
-			testExecOk = m_testExecutor->iterate();
+			testExecOk = m_forkExecutor ? m_forkExecutor->iterate() : m_testExecutor->iterate();
 		}
 		catch (const std::exception& e)
 		{
@@ -188,7 +209,7 @@ bool App::iterate (void)
 		const RunMode runMode = m_testCtx->getCommandLine().getRunMode();
 		if (runMode == RUNMODE_EXECUTE)
 		{
-			const TestRunStatus& result = m_testExecutor->getStatus();
+			const TestRunStatus& result = getResult();
 
 			// Report statistics.
 			print("\nTest run totals:\n");
@@ -196,6 +217,14 @@ bool App::iterate (void)
 			print("  Failed:        %d/%d (%.1f%%)\n", result.numFailed,		result.numExecuted, (result.numExecuted > 0 ? (100.0f * (float)result.numFailed			/ (float)result.numExecuted) : 0.0f));
 			print("  Not supported: %d/%d (%.1f%%)\n", result.numNotSupported,	result.numExecuted, (result.numExecuted > 0 ? (100.0f * (float)result.numNotSupported	/ (float)result.numExecuted) : 0.0f));
 			print("  Warnings:      %d/%d (%.1f%%)\n", result.numWarnings,		result.numExecuted, (result.numExecuted > 0 ? (100.0f * (float)result.numWarnings		/ (float)result.numExecuted) : 0.0f));
+
+			{
+				const SessionCounters& counters = m_forkExecutor ? m_forkExecutor->getSessionCounters() : m_testExecutor->getSessionCounters();
+
+				for (SessionCounters::const_iterator counter = counters.begin(); counter != counters.end(); ++counter)
+					print("  %s: %s\n", counter->first.c_str(), de::toString(counter->second).c_str());
+			}
+
 			if (!result.isComplete)
 				print("Test run was ABORTED!\n");
 		}
@@ -206,7 +235,7 @@ bool App::iterate (void)
 
 const TestRunStatus& App::getResult (void) const
 {
-	return m_testExecutor->getStatus();
+	return m_forkExecutor ? m_forkExecutor->getStatus() : m_testExecutor->getStatus();
 }
 
 void App::onWatchdogTimeout (qpWatchDog* watchDog, void* userPtr, qpTimeoutReason reason)
@@ -38,6 +38,7 @@ class Archive;
 class Platform;
 class TestContext;
 class TestSessionExecutor;
+class ForkSessionExecutor;
 class CommandLine;
 class TestLog;
 class TestPackageRoot;
@@ -92,6 +93,7 @@ protected:
 	TestContext*			m_testCtx;
 	TestPackageRoot*		m_testRoot;
 	TestSessionExecutor*	m_testExecutor;
+	ForkSessionExecutor*	m_forkExecutor;
 };
 
 } // tcu
@@ -22,6 +22,7 @@
  *//*--------------------------------------------------------------------*/
 
 #include "tcuAstcUtil.hpp"
+#include "tcuTextureDataCache.hpp"
 #include "deFloat16.h"
 #include "deRandom.hpp"
 #include "deMeta.hpp"
@@ -1341,76 +1342,99 @@ inline deUint32 hash52 (deUint32 v)
 	return p;
 }
 
-int computeTexelPartition (deUint32 seedIn, deUint32 xIn, deUint32 yIn, deUint32 zIn, int numPartitions, bool smallBlock)
-{
-	DE_ASSERT(zIn == 0);
-	const deUint32	x		= smallBlock ? xIn << 1 : xIn;
-	const deUint32	y		= smallBlock ? yIn << 1 : yIn;
-	const deUint32	z		= smallBlock ? zIn << 1 : zIn;
-	const deUint32	seed	= seedIn + 1024*(numPartitions-1);
-	const deUint32	rnum	= hash52(seed);
-	deUint8			seed1	= (deUint8)( rnum							& 0xf);
-	deUint8			seed2	= (deUint8)((rnum >>  4)					& 0xf);
-	deUint8			seed3	= (deUint8)((rnum >>  8)					& 0xf);
-	deUint8			seed4	= (deUint8)((rnum >> 12)					& 0xf);
-	deUint8			seed5	= (deUint8)((rnum >> 16)					& 0xf);
-	deUint8			seed6	= (deUint8)((rnum >> 20)					& 0xf);
-	deUint8			seed7	= (deUint8)((rnum >> 24)					& 0xf);
-	deUint8			seed8	= (deUint8)((rnum >> 28)					& 0xf);
-	deUint8			seed9	= (deUint8)((rnum >> 18)					& 0xf);
-	deUint8			seed10	= (deUint8)((rnum >> 22)					& 0xf);
-	deUint8			seed11	= (deUint8)((rnum >> 26)					& 0xf);
-	deUint8			seed12	= (deUint8)(((rnum >> 30) | (rnum << 2))	& 0xf);
-
-	seed1  = (deUint8)(seed1  * seed1 );
-	seed2  = (deUint8)(seed2  * seed2 );
-	seed3  = (deUint8)(seed3  * seed3 );
-	seed4  = (deUint8)(seed4  * seed4 );
-	seed5  = (deUint8)(seed5  * seed5 );
-	seed6  = (deUint8)(seed6  * seed6 );
-	seed7  = (deUint8)(seed7  * seed7 );
-	seed8  = (deUint8)(seed8  * seed8 );
-	seed9  = (deUint8)(seed9  * seed9 );
-	seed10 = (deUint8)(seed10 * seed10);
-	seed11 = (deUint8)(seed11 * seed11);
-	seed12 = (deUint8)(seed12 * seed12);
-
-	const int shA = (seed & 2) != 0		? 4		: 5;
-	const int shB = numPartitions == 3	? 6		: 5;
-	const int sh1 = (seed & 1) != 0		? shA	: shB;
-	const int sh2 = (seed & 1) != 0		? shB	: shA;
-	const int sh3 = (seed & 0x10) != 0	? sh1	: sh2;
-
-	seed1  = (deUint8)(seed1  >> sh1);
-	seed2  = (deUint8)(seed2  >> sh2);
-	seed3  = (deUint8)(seed3  >> sh1);
-	seed4  = (deUint8)(seed4  >> sh2);
-	seed5  = (deUint8)(seed5  >> sh1);
-	seed6  = (deUint8)(seed6  >> sh2);
-	seed7  = (deUint8)(seed7  >> sh1);
-	seed8  = (deUint8)(seed8  >> sh2);
-	seed9  = (deUint8)(seed9  >> sh3);
-	seed10 = (deUint8)(seed10 >> sh3);
-	seed11 = (deUint8)(seed11 >> sh3);
-	seed12 = (deUint8)(seed12 >> sh3);
-
-	const int a =						0x3f & (seed1*x + seed2*y + seed11*z + (rnum >> 14));
-	const int b =						0x3f & (seed3*x + seed4*y + seed12*z + (rnum >> 10));
-	const int c = numPartitions >= 3 ?	0x3f & (seed5*x + seed6*y + seed9*z  + (rnum >>  6))	: 0;
-	const int d = numPartitions >= 4 ?	0x3f & (seed7*x + seed8*y + seed10*z + (rnum >>  2))	: 0;
-
-	return a >= b && a >= c && a >= d	? 0
-		 : b >= c && b >= d				? 1
-		 : c >= d						? 2
-		 :								  3;
-}
+//! Texel partition selection for a block, derived once from partition seed and count
+class TexelPartitionSelector
+{
+public:
+	TexelPartitionSelector (deUint32 seedIn, int numPartitions, bool smallBlock)
+		: m_numPartitions	(numPartitions)
+		, m_smallBlock		(smallBlock)
+	{
+		const deUint32	seed	= seedIn + 1024*(numPartitions-1);
+		const deUint32	rnum	= hash52(seed);
+		deUint8			seed1	= (deUint8)( rnum							& 0xf);
+		deUint8			seed2	= (deUint8)((rnum >>  4)					& 0xf);
+		deUint8			seed3	= (deUint8)((rnum >>  8)					& 0xf);
+		deUint8			seed4	= (deUint8)((rnum >> 12)					& 0xf);
+		deUint8			seed5	= (deUint8)((rnum >> 16)					& 0xf);
+		deUint8			seed6	= (deUint8)((rnum >> 20)					& 0xf);
+		deUint8			seed7	= (deUint8)((rnum >> 24)					& 0xf);
+		deUint8			seed8	= (deUint8)((rnum >> 28)					& 0xf);
+		deUint8			seed9	= (deUint8)((rnum >> 18)					& 0xf);
+		deUint8			seed10	= (deUint8)((rnum >> 22)					& 0xf);
+		deUint8			seed11	= (deUint8)((rnum >> 26)					& 0xf);
+		deUint8			seed12	= (deUint8)(((rnum >> 30) | (rnum << 2))	& 0xf);
+
+		seed1  = (deUint8)(seed1  * seed1 );
+		seed2  = (deUint8)(seed2  * seed2 );
+		seed3  = (deUint8)(seed3  * seed3 );
+		seed4  = (deUint8)(seed4  * seed4 );
+		seed5  = (deUint8)(seed5  * seed5 );
+		seed6  = (deUint8)(seed6  * seed6 );
+		seed7  = (deUint8)(seed7  * seed7 );
+		seed8  = (deUint8)(seed8  * seed8 );
+		seed9  = (deUint8)(seed9  * seed9 );
+		seed10 = (deUint8)(seed10 * seed10);
+		seed11 = (deUint8)(seed11 * seed11);
+		seed12 = (deUint8)(seed12 * seed12);
+
+		const int shA = (seed & 2) != 0		? 4		: 5;
+		const int shB = numPartitions == 3	? 6		: 5;
+		const int sh1 = (seed & 1) != 0		? shA	: shB;
+		const int sh2 = (seed & 1) != 0		? shB	: shA;
+		const int sh3 = (seed & 0x10) != 0	? sh1	: sh2;
+
+		m_seeds[0]	= (deUint8)(seed1  >> sh1);
+		m_seeds[1]	= (deUint8)(seed2  >> sh2);
+		m_seeds[2]	= (deUint8)(seed3  >> sh1);
+		m_seeds[3]	= (deUint8)(seed4  >> sh2);
+		m_seeds[4]	= (deUint8)(seed5  >> sh1);
+		m_seeds[5]	= (deUint8)(seed6  >> sh2);
+		m_seeds[6]	= (deUint8)(seed7  >> sh1);
+		m_seeds[7]	= (deUint8)(seed8  >> sh2);
+		m_seeds[8]	= (deUint8)(seed9  >> sh3);
+		m_seeds[9]	= (deUint8)(seed10 >> sh3);
+		m_seeds[10]	= (deUint8)(seed11 >> sh3);
+		m_seeds[11]	= (deUint8)(seed12 >> sh3);
+
+		m_offsets[0]	= rnum >> 14;
+		m_offsets[1]	= rnum >> 10;
+		m_offsets[2]	= rnum >>  6;
+		m_offsets[3]	= rnum >>  2;
+	}
+
+	int getPartition (deUint32 xIn, deUint32 yIn, deUint32 zIn) const
+	{
+		DE_ASSERT(zIn == 0);
+		const deUint32	x		= m_smallBlock ? xIn << 1 : xIn;
+		const deUint32	y		= m_smallBlock ? yIn << 1 : yIn;
+		const deUint32	z		= m_smallBlock ? zIn << 1 : zIn;
+
+		const int a =						0x3f & (m_seeds[0]*x + m_seeds[1]*y + m_seeds[10]*z + m_offsets[0]);
+		const int b =						0x3f & (m_seeds[2]*x + m_seeds[3]*y + m_seeds[11]*z + m_offsets[1]);
+		const int c = m_numPartitions >= 3 ?	0x3f & (m_seeds[4]*x + m_seeds[5]*y + m_seeds[8]*z  + m_offsets[2])	: 0;
+		const int d = m_numPartitions >= 4 ?	0x3f & (m_seeds[6]*x + m_seeds[7]*y + m_seeds[9]*z  + m_offsets[3])	: 0;
+
+		return a >= b && a >= c && a >= d	? 0
+			 : b >= c && b >= d				? 1
+			 : c >= d						? 2
+			 :								  3;
+	}
+
+private:
+	const int		m_numPartitions;
+	const bool		m_smallBlock;
+	deUint8			m_seeds[12];
+	deUint32		m_offsets[4];
+};
 
 DecompressResult setTexelColors (void* dst, ColorEndpointPair* colorEndpoints, TexelWeightPair* texelWeights, int ccs, deUint32 partitionIndexSeed,
 								 int numPartitions, int blockWidth, int blockHeight, bool isSRGB, bool isLDRMode, const deUint32* colorEndpointModes)
 {
-	const bool			smallBlock	= blockWidth*blockHeight < 31;
-	DecompressResult	result		= DECOMPRESS_RESULT_VALID_BLOCK;
-	bool				isHDREndpoint[4];
+	const bool						smallBlock	= blockWidth*blockHeight < 31;
+	const TexelPartitionSelector	partitions	(partitionIndexSeed, numPartitions, smallBlock);
+	DecompressResult				result		= DECOMPRESS_RESULT_VALID_BLOCK;
+	bool							isHDREndpoint[4];
 
 	for (int i = 0; i < numPartitions; i++)
 		isHDREndpoint[i] = isColorEndpointModeHDR(colorEndpointModes[i]);
@@ -1419,7 +1443,7 @@ DecompressResult setTexelColors (void* dst, ColorEndpointPair* colorEndpoints, T
 	for (int texelX = 0; texelX < blockWidth; texelX++)
 	{
 		const int				texelNdx			= texelY*blockWidth + texelX;
-		const int				colorEndpointNdx	= numPartitions == 1 ? 0 : computeTexelPartition(partitionIndexSeed, texelX, texelY, 0, numPartitions, smallBlock);
+		const int				colorEndpointNdx	= numPartitions == 1 ? 0 : partitions.getPartition(texelX, texelY, 0);
 		DE_ASSERT(colorEndpointNdx < numPartitions);
 		const UVec4&			e0					= colorEndpoints[colorEndpointNdx].e0;
 		const UVec4&			e1					= colorEndpoints[colorEndpointNdx].e1;
@@ -2421,7 +2445,7 @@ void generateRandomBlock (deUint8* dst, const IVec3& blockSize, de::Random& rnd)
 } // anonymous
 
 // Generate block data for a given BlockTestType and format.
-void generateBlockCaseTestData (vector<deUint8>& dst, CompressedTexFormat format, BlockTestType testType)
+static void generateBlockCaseTestDataUncached (vector<deUint8>& dst, CompressedTexFormat format, BlockTestType testType)
 {
 	DE_ASSERT(isAstcFormat(format));
 	DE_ASSERT(!(isAstcSRGBFormat(format) && isBlockTestTypeHDROnly(testType)));
@@ -2859,6 +2883,28 @@ void generateBlockCaseTestData (vector<deUint8>& dst, CompressedTexFormat format
 	}
 }
 
+void generateBlockCaseTestData (vector<deUint8>& dst, CompressedTexFormat format, BlockTestType testType)
+{
+	// Same data is generated for each case variant, so it is cached
+	TextureDataCache&	cache	= TextureDataCache::getInstance();
+	de::Sha1Stream		keyStream;
+	vector<deUint8>		data;
+
+	keyStream << std::string("astc::generateBlockCaseTestData") << (deUint32)format << (deUint32)testType;
+
+	{
+		const de::Sha1 key = keyStream.finalize();
+
+		if (!cache.get(key, data))
+		{
+			generateBlockCaseTestDataUncached(data, format, testType);
+			cache.put(key, data.empty() ? DE_NULL : &data[0], data.size());
+		}
+	}
+
+	dst.insert(dst.end(), data.begin(), data.end());
+}
+
 void generateRandomBlocks (deUint8* dst, size_t numBlocks, CompressedTexFormat format, deUint32 seed)
 {
 	const IVec3		blockSize			= getBlockPixelSize(format);
@@ -2878,13 +2924,23 @@ void generateRandomBlocks (deUint8* dst, size_t numBlocks, CompressedTexFormat f
 
 void generateRandomValidBlocks (deUint8* dst, size_t numBlocks, CompressedTexFormat format, TexDecompressionParams::AstcMode mode, deUint32 seed)
 {
-	const IVec3		blockSize			= getBlockPixelSize(format);
-	de::Random		rnd					(seed);
-	size_t			numBlocksGenerated	= 0;
+	const IVec3			blockSize			= getBlockPixelSize(format);
+	de::Random			rnd					(seed);
+	size_t				numBlocksGenerated	= 0;
+	TextureDataCache&	cache				= TextureDataCache::getInstance();
+	de::Sha1Stream		keyStream;
 
 	DE_ASSERT(isAstcFormat(format));
 	DE_ASSERT(blockSize.z() == 1);
 
+	keyStream << std::string("astc::generateRandomValidBlocks") << (deUint64)numBlocks << (deUint32)format << (deUint32)mode << seed;
+
+	const de::Sha1		key					= keyStream.finalize();
+
+	// Validating generated blocks requires decoding them, so generated data is cached
+	if (cache.get(key, dst, numBlocks*BLOCK_SIZE_BYTES))
+		return;
+
 	for (numBlocksGenerated = 0; numBlocksGenerated < numBlocks; numBlocksGenerated++)
 	{
 		deUint8* const	curBlockPtr		= dst + numBlocksGenerated*BLOCK_SIZE_BYTES;
@@ -2894,6 +2950,8 @@ void generateRandomValidBlocks (deUint8* dst, size_t numBlocks, CompressedTexFor
 			generateRandomBlock(curBlockPtr, blockSize, rnd);
 		} while (!isValidBlock(curBlockPtr, format, mode));
 	}
+
+	cache.put(key, dst, numBlocks*BLOCK_SIZE_BYTES);
 }
 
 // Generate a number of trivial dummy blocks to fill unneeded space in a texture.
@@ -0,0 +1,335 @@
+/*-------------------------------------------------------------------------
+ * drawElements Quality Program Tester Core
+ * ----------------------------------------
+ *
+ * Copyright 2019 The Android Open Source Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ *//*!
+ * \file
+ * \brief Persisted index of test case paths.
+ *//*--------------------------------------------------------------------*/
+
+#include "tcuCaseIndex.hpp"
+#include "tcuCommandLine.hpp"
+#include "tcuResource.hpp"
+#include "deUniquePtr.hpp"
+#include "deStringUtil.hpp"
+#include "deFile.h"
+
+#include <istream>
+#include <sstream>
+#include <fstream>
+
+namespace tcu
+{
+
+using std::string;
+
+namespace
+{
+
+const char* const	s_casePrefix	= "TEST: ";
+const char* const	s_groupPrefix	= "GROUP: ";
+
+inline bool isPathPrefix (const string& prefix, const string& path)
+{
+	return path.size() > prefix.size() && path[prefix.size()] == '.' && de::beginsWith(path, prefix);
+}
+
+} // anonymous
+
+CaseIndex::CaseIndex (void)
+{
+}
+
+CaseIndex::~CaseIndex (void)
+{
+}
+
+void CaseIndex::addEntry (const string& path, bool isCase)
+{
+	if (path.empty() || path.find('.') == string::npos)
+		throw Exception("Invalid case index path '" + path + "'");
+
+	m_entries.push_back(Entry(path, isCase));
+	m_packages.insert(getPackageName(path));
+
+	if (!isCase)
+		m_groups.insert(path);
+}
+
+void CaseIndex::read (std::istream& src)
+{
+	const size_t	casePrefixLen	= string(s_casePrefix).size();
+	const size_t	groupPrefixLen	= string(s_groupPrefix).size();
+	string			line;
+	int				lineNdx			= 0;
+
+	while (std::getline(src, line))
+	{
+		lineNdx += 1;
+
+		if (!line.empty() && line[line.size()-1] == '\r')
+			line.erase(line.size()-1);
+
+		if (line.empty())
+			continue;
+
+		if (de::beginsWith(line, s_casePrefix))
+			addEntry(line.substr(casePrefixLen), true);
+		else if (de::beginsWith(line, s_groupPrefix))
+			addEntry(line.substr(groupPrefixLen), false);
+		else
+			throw Exception("Malformed case index line " + de::toString(lineNdx) + ": '" + line + "'");
+	}
+}
+
+void CaseIndex::write (std::ostream& dst) const
+{
+	for (std::vector<Entry>::const_iterator entry = m_entries.begin(); entry != m_entries.end(); ++entry)
+		dst << (entry->isCase ? s_casePrefix : s_groupPrefix) << entry->path << "\n";
+}
+
+bool CaseIndex::hasPackage (const string& packageName) const
+{
+	return m_packages.find(packageName) != m_packages.end();
+}
+
+bool CaseIndex::hasGroup (const string& groupPath) const
+{
+	return m_groups.find(groupPath) != m_groups.end();
+}
+
+void CaseIndex::writeCaseList (std::ostream& dst, const string& packageName, const CaseListFilter& filter) const
+{
+	string	skippedGroup;
+
+	if (!filter.checkTestGroupName(packageName.c_str()))
+		return;
+
+	// Entries are in hierarchy order, so a rejected group is followed by its whole subtree.
+	for (std::vector<Entry>::const_iterator entry = m_entries.begin(); entry != m_entries.end(); ++entry)
+	{
+		if (!isPathPrefix(packageName, entry->path))
+			continue;
+
+		if (!skippedGroup.empty())
+		{
+			if (isPathPrefix(skippedGroup, entry->path))
+				continue;
+
+			skippedGroup.clear();
+		}
+
+		if (entry->isCase)
+		{
+			if (filter.checkTestCaseName(entry->path.c_str()))
+				dst << s_casePrefix << entry->path << "\n";
+		}
+		else
+		{
+			if (filter.checkTestGroupName(entry->path.c_str()))
+				dst << s_groupPrefix << entry->path << "\n";
+			else
+				skippedGroup = entry->path;
+		}
+	}
+}
+
+string CaseIndex::getPackageName (const string& path)
+{
+	return path.substr(0, path.find('.'));
+}
+
+// Self-test
+
+namespace
+{
+
+de::MovePtr<CaseListFilter> createFilter (const char* casePattern, const char* indexFilename)
+{
+	const string		indexArg	= string("--deqp-case-index=") + (indexFilename ? indexFilename : "");
+	const char*			argv[]		=
+	{
+		"deqp",
+		"--deqp-case",
+		casePattern,
+		indexArg.c_str()
+	};
+	CommandLine			cmdLine;
+	const DirArchive	archive		(".");
+
+	DE_TEST_ASSERT(cmdLine.parse(indexFilename ? DE_LENGTH_OF_ARRAY(argv) : DE_LENGTH_OF_ARRAY(argv)-1, argv));
+
+	return cmdLine.createCaseListFilter(archive);
+}
+
+string filterCaseListWith (const CaseIndex& index, const char* packageName, const CaseListFilter& filter)
+{
+	std::ostringstream str;
+
+	index.writeCaseList(str, packageName, filter);
+
+	return str.str();
+}
+
+string filterCaseList (const CaseIndex& index, const char* packageName, const char* casePattern)
+{
+	const de::UniquePtr<CaseListFilter> filter (createFilter(casePattern, DE_NULL));
+
+	return filterCaseListWith(index, packageName, *filter);
+}
+
+void testIndexedFilter (const CaseIndex& index)
+{
+	const char* const indexFilename = "case-index-selftest.txt";
+
+	{
+		std::ofstream out (indexFilename, std::ios_base::binary);
+		index.write(out);
+		DE_TEST_ASSERT(out.good());
+	}
+
+	try
+	{
+		// Without the index every group that is a prefix of the pattern is accepted
+		{
+			const de::UniquePtr<CaseListFilter> filter (createFilter("pkg.ab.*", DE_NULL));
+
+			DE_TEST_ASSERT(filter->checkTestGroupName("pkg.a"));
+			DE_TEST_ASSERT(filter->checkTestGroupName("pkg.ab"));
+		}
+
+		// Index prunes groups with no matching cases
+		{
+			const de::UniquePtr<CaseListFilter> filter (createFilter("pkg.ab.*", indexFilename));
+
+			DE_TEST_ASSERT(filter->getCaseIndex() && filter->getCaseIndex()->getEntries().size() == index.getEntries().size());
+			DE_TEST_ASSERT(filter->checkTestGroupName("pkg"));
+			DE_TEST_ASSERT(!filter->checkTestGroupName("pkg.a"));
+			DE_TEST_ASSERT(filter->checkTestGroupName("pkg.ab"));
+			DE_TEST_ASSERT(filter->checkTestGroupName("pkg.ab.c"));
+			DE_TEST_ASSERT(filter->checkTestCaseName("pkg.ab.c.z"));
+
+			// Groups missing from the index fall back to pattern matching
+			DE_TEST_ASSERT(filter->checkTestGroupName("pkg.ab.new"));
+			DE_TEST_ASSERT(!filter->checkTestGroupName("pkg.new"));
+
+			DE_TEST_ASSERT(filterCaseListWith(index, "pkg", *filter) == "GROUP: pkg.ab\nGROUP: pkg.ab.c\nTEST: pkg.ab.c.z\n");
+		}
+
+		{
+			const de::UniquePtr<CaseListFilter> filter (createFilter("*.b.*", indexFilename));
+
+			DE_TEST_ASSERT(!filter->checkTestGroupName("pkg"));
+			DE_TEST_ASSERT(filter->checkTestGroupName("other"));
+			DE_TEST_ASSERT(filter->checkTestGroupName("other.b"));
+		}
+	}
+	catch (...)
+	{
+		deDeleteFile(indexFilename);
+		throw;
+	}
+
+	deDeleteFile(indexFilename);
+}
+
+} // anonymous
+
+void CaseIndex_selfTest (void)
+{
+	const string indexSrc =
+		"GROUP: pkg.a\r\n"
+		"TEST: pkg.a.x\r\n"
+		"TEST: pkg.a.y\r\n"
+		"GROUP: pkg.ab\n"
+		"GROUP: pkg.ab.c\n"
+		"TEST: pkg.ab.c.z\n"
+		"\n"
+		"GROUP: other.b\n"
+		"TEST: other.b.w\n";
+
+	CaseIndex index;
+
+	{
+		std::istringstream str (indexSrc);
+		index.read(str);
+	}
+
+	DE_TEST_ASSERT(index.getEntries().size() == 8);
+	DE_TEST_ASSERT(index.getEntries()[1].path == "pkg.a.x" && index.getEntries()[1].isCase);
+	DE_TEST_ASSERT(index.getEntries()[3].path == "pkg.ab" && !index.getEntries()[3].isCase);
+	DE_TEST_ASSERT(index.hasPackage("pkg") && index.hasPackage("other") && !index.hasPackage("pk"));
+	DE_TEST_ASSERT(CaseIndex::getPackageName("pkg.a.x") == "pkg");
+
+	// Round trip
+	{
+		std::ostringstream	str;
+		CaseIndex			copy;
+
+		index.write(str);
+
+		{
+			std::istringstream src (str.str());
+			copy.read(src);
+		}
+
+		DE_TEST_ASSERT(copy.getEntries().size() == index.getEntries().size());
+
+		for (size_t ndx = 0; ndx < copy.getEntries().size(); ndx++)
+			DE_TEST_ASSERT(copy.getEntries()[ndx].path == index.getEntries()[ndx].path &&
+						   copy.getEntries()[ndx].isCase == index.getEntries()[ndx].isCase);
+	}
+
+	// Filtering
+	testIndexedFilter(index);
+
+	DE_TEST_ASSERT(filterCaseList(index, "pkg", "*") ==
+				   "GROUP: pkg.a\nTEST: pkg.a.x\nTEST: pkg.a.y\nGROUP: pkg.ab\nGROUP: pkg.ab.c\nTEST: pkg.ab.c.z\n");
+	DE_TEST_ASSERT(filterCaseList(index, "pkg", "pkg.a.y") == "GROUP: pkg.a\nTEST: pkg.a.y\n");
+	DE_TEST_ASSERT(filterCaseList(index, "pkg", "pkg.ab.*") == "GROUP: pkg.a\nGROUP: pkg.ab\nGROUP: pkg.ab.c\nTEST: pkg.ab.c.z\n");
+	DE_TEST_ASSERT(filterCaseList(index, "other", "pkg.*") == "");
+
+	// Malformed input
+	{
+		static const char* const invalidSources[] =
+		{
+			"CASE: pkg.a\n",
+			"TEST: pkg\n",
+			"GROUP: \n",
+		};
+
+		for (int ndx = 0; ndx < DE_LENGTH_OF_ARRAY(invalidSources); ndx++)
+		{
+			std::istringstream	str			(invalidSources[ndx]);
+			CaseIndex			invalid;
+			bool				didThrow	= false;
+
+			try
+			{
+				invalid.read(str);
+			}
+			catch (const Exception&)
+			{
+				didThrow = true;
+			}
+
+			DE_TEST_ASSERT(didThrow);
+		}
+	}
+}
+
+} // tcu
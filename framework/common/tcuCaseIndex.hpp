@@ -0,0 +1,91 @@
+#ifndef _TCUCASEINDEX_HPP
+#define _TCUCASEINDEX_HPP
+/*-------------------------------------------------------------------------
+ * drawElements Quality Program Tester Core
+ * ----------------------------------------
+ *
+ * Copyright 2019 The Android Open Source Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ *//*!
+ * \file
+ * \brief Persisted index of test case paths.
+ *//*--------------------------------------------------------------------*/
+
+#include "tcuDefs.hpp"
+
+#include <string>
+#include <vector>
+#include <set>
+#include <iosfwd>
+
+namespace tcu
+{
+
+class CaseListFilter;
+
+/*--------------------------------------------------------------------*//*!
+ * \brief Index of all groups and cases in one or more test packages
+ *
+ * The index uses the text case list format written by
+ * --deqp-runmode=txt-caselist ("GROUP: path" and "TEST: path" lines in
+ * hierarchy order), so it can be generated at build time by exporting the
+ * full case list of each package and concatenating the files.
+ *
+ * With an index, case list filters can reject groups that do not contain
+ * any requested case before the group is initialized, and case lists can
+ * be exported without building the test hierarchy. The index should be
+ * generated from the same binary. Groups missing from an out of date index
+ * are matched against the case patterns as if there was no index.
+ *//*--------------------------------------------------------------------*/
+class CaseIndex
+{
+public:
+	struct Entry
+	{
+		std::string		path;
+		bool			isCase;
+
+		Entry (const std::string& path_, bool isCase_) : path(path_), isCase(isCase_) {}
+	};
+
+								CaseIndex			(void);
+								~CaseIndex			(void);
+
+	//! Parse index and append its entries. Throws tcu::Exception on malformed input.
+	void						read				(std::istream& src);
+	void						write				(std::ostream& dst) const;
+
+	void						addEntry			(const std::string& path, bool isCase);
+
+	const std::vector<Entry>&	getEntries			(void) const { return m_entries;	}
+	bool						hasPackage			(const std::string& packageName) const;
+	bool						hasGroup			(const std::string& groupPath) const;
+
+	//! Write entries of a package accepted by filter in txt-caselist format
+	void						writeCaseList		(std::ostream& dst, const std::string& packageName, const CaseListFilter& filter) const;
+
+	static std::string			getPackageName		(const std::string& path);
+
+private:
+	std::vector<Entry>			m_entries;
+	std::set<std::string>		m_packages;
+	std::set<std::string>		m_groups;
+};
+
+void CaseIndex_selfTest (void);
+
+} // tcu
+
+#endif // _TCUCASEINDEX_HPP
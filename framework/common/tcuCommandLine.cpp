@@ -25,6 +25,7 @@
 #include "tcuPlatform.hpp"
 #include "tcuTestCase.hpp"
 #include "tcuResource.hpp"
+#include "tcuCaseIndex.hpp"
 #include "deFilePath.hpp"
 #include "deStringUtil.hpp"
 #include "deString.h"
@@ -60,11 +61,14 @@ DE_DECLARE_COMMAND_LINE_OPT(CaseList,					std::string);
 DE_DECLARE_COMMAND_LINE_OPT(CaseListFile,				std::string);
 DE_DECLARE_COMMAND_LINE_OPT(CaseListResource,			std::string);
 DE_DECLARE_COMMAND_LINE_OPT(StdinCaseList,				bool);
+DE_DECLARE_COMMAND_LINE_OPT(CaseIndexFile,				std::string);
 DE_DECLARE_COMMAND_LINE_OPT(LogFilename,				std::string);
 DE_DECLARE_COMMAND_LINE_OPT(RunMode,					tcu::RunMode);
 DE_DECLARE_COMMAND_LINE_OPT(ExportFilenamePattern,		std::string);
 DE_DECLARE_COMMAND_LINE_OPT(WatchDog,					bool);
 DE_DECLARE_COMMAND_LINE_OPT(CrashHandler,				bool);
+DE_DECLARE_COMMAND_LINE_OPT(ParallelExecution,			bool);
+DE_DECLARE_COMMAND_LINE_OPT(ForkWorkers,				int);
 DE_DECLARE_COMMAND_LINE_OPT(BaseSeed,					int);
 DE_DECLARE_COMMAND_LINE_OPT(TestIterationCount,			int);
 DE_DECLARE_COMMAND_LINE_OPT(Visibility,					WindowVisibility);
@@ -76,6 +80,8 @@ DE_DECLARE_COMMAND_LINE_OPT(GLContextType,				std::string);
 DE_DECLARE_COMMAND_LINE_OPT(GLConfigID,					int);
 DE_DECLARE_COMMAND_LINE_OPT(GLConfigName,				std::string);
 DE_DECLARE_COMMAND_LINE_OPT(GLContextFlags,				std::string);
+DE_DECLARE_COMMAND_LINE_OPT(GLStateReset,				tcu::GLStateResetMode);
+DE_DECLARE_COMMAND_LINE_OPT(GLCallTrace,				int);
 DE_DECLARE_COMMAND_LINE_OPT(CLPlatformID,				int);
 DE_DECLARE_COMMAND_LINE_OPT(CLDeviceIDs,				std::vector<int>);
 DE_DECLARE_COMMAND_LINE_OPT(CLBuildOptions,				std::string);
@@ -95,6 +101,8 @@ DE_DECLARE_COMMAND_LINE_OPT(Optimization,				int);
 DE_DECLARE_COMMAND_LINE_OPT(OptimizeSpirv,				bool);
 DE_DECLARE_COMMAND_LINE_OPT(ShaderCacheTruncate,		bool);
 DE_DECLARE_COMMAND_LINE_OPT(RenderDoc,					bool);
+DE_DECLARE_COMMAND_LINE_OPT(PipelineCache,				bool);
+DE_DECLARE_COMMAND_LINE_OPT(PipelineCacheFilename,		std::string);
 
 static void parseIntList (const char* src, std::vector<int>* dst)
 {
@@ -147,6 +155,12 @@ void registerOptions (de::cmdline::Parser& parser)
 		{ "180",			SCREENROTATION_180			},
 		{ "270",			SCREENROTATION_270			}
 	};
+	static const NamedValue<tcu::GLStateResetMode> s_glStateResetModes[] =
+	{
+		{ "full",			GLSTATERESET_FULL			},
+		{ "tracked",		GLSTATERESET_TRACKED		},
+		{ "verify",			GLSTATERESET_VERIFY			}
+	};
 
 	parser
 		<< Option<CasePath>				("n",		"deqp-case",					"Test case(s) to run, supports wildcards (e.g. dEQP-GLES2.info.*)")
@@ -154,12 +168,15 @@ void registerOptions (de::cmdline::Parser& parser)
 		<< Option<CaseListFile>			(DE_NULL,	"deqp-caselist-file",			"Read case list (in trie format) from given file")
 		<< Option<CaseListResource>		(DE_NULL,	"deqp-caselist-resource",		"Read case list (in trie format) from given file located application's assets")
 		<< Option<StdinCaseList>		(DE_NULL,	"deqp-stdin-caselist",			"Read case list (in trie format) from stdin")
+		<< Option<CaseIndexFile>		(DE_NULL,	"deqp-case-index",				"Read index of all test cases (in txt-caselist format) from given file")
 		<< Option<LogFilename>			(DE_NULL,	"deqp-log-filename",			"Write test results to given file",					"TestResults.qpa")
 		<< Option<RunMode>				(DE_NULL,	"deqp-runmode",					"Execute tests, or write list of test cases into a file",
 																																		s_runModes,			"execute")
 		<< Option<ExportFilenamePattern>(DE_NULL,	"deqp-caselist-export-file",	"Set the target file name pattern for caselist export",					"${packageName}-cases.${typeExtension}")
 		<< Option<WatchDog>				(DE_NULL,	"deqp-watchdog",				"Enable test watchdog",								s_enableNames,		"disable")
 		<< Option<CrashHandler>			(DE_NULL,	"deqp-crashhandler",			"Enable crash handling",							s_enableNames,		"disable")
+		<< Option<ParallelExecution>	(DE_NULL,	"deqp-parallel-execution",		"Execute thread-safe test cases in parallel on worker threads",	s_enableNames,	"disable")
+		<< Option<ForkWorkers>			(DE_NULL,	"deqp-fork-workers",			"Execute test cases in given number of forked worker processes",		"0")
 		<< Option<BaseSeed>				(DE_NULL,	"deqp-base-seed",				"Base seed for test cases that use randomization",						"0")
 		<< Option<TestIterationCount>	(DE_NULL,	"deqp-test-iteration-count",	"Iteration count for cases that support variable number of iterations",	"0")
 		<< Option<Visibility>			(DE_NULL,	"deqp-visibility",				"Default test window visibility",					s_visibilites,		"windowed")
@@ -171,6 +188,8 @@ void registerOptions (de::cmdline::Parser& parser)
 		<< Option<GLConfigID>			(DE_NULL,	"deqp-gl-config-id",			"OpenGL (ES) render config ID (EGL config id on EGL platforms)",		"-1")
 		<< Option<GLConfigName>			(DE_NULL,	"deqp-gl-config-name",			"Symbolic OpenGL (ES) render config name")
 		<< Option<GLContextFlags>		(DE_NULL,	"deqp-gl-context-flags",		"OpenGL context flags (comma-separated, supports debug and robust)")
+		<< Option<GLStateReset>			(DE_NULL,	"deqp-gl-state-reset",			"Reset all GL state between cases, or only state modified by the case",	s_glStateResetModes,	"full")
+		<< Option<GLCallTrace>			(DE_NULL,	"deqp-gl-call-trace",			"Number of last GL calls written into log when a case fails (0 = disabled)",	"0")
 		<< Option<CLPlatformID>			(DE_NULL,	"deqp-cl-platform-id",			"Execute tests on given OpenCL platform (IDs start from 1)",			"1")
 		<< Option<CLDeviceIDs>			(DE_NULL,	"deqp-cl-device-ids",			"Execute tests on given CL devices (comma-separated, IDs start from 1)",	parseIntList,	"")
 		<< Option<CLBuildOptions>		(DE_NULL,	"deqp-cl-build-options",		"Extra build options for OpenCL compiler")
@@ -189,7 +208,9 @@ void registerOptions (de::cmdline::Parser& parser)
 		<< Option<ShaderCache>			(DE_NULL,	"deqp-shadercache",				"Enable or disable shader cache",					s_enableNames,		"enable")
 		<< Option<ShaderCacheFilename>	(DE_NULL,	"deqp-shadercache-filename",	"Write shader cache to given file",										"shadercache.bin")
 		<< Option<ShaderCacheTruncate>	(DE_NULL,	"deqp-shadercache-truncate",	"Truncate shader cache before running tests",		s_enableNames,		"enable")
-		<< Option<RenderDoc>			(DE_NULL,	"deqp-renderdoc",				"Enable RenderDoc frame markers",					s_enableNames,		"disable");
+		<< Option<RenderDoc>			(DE_NULL,	"deqp-renderdoc",				"Enable RenderDoc frame markers",					s_enableNames,		"disable")
+		<< Option<PipelineCache>		(DE_NULL,	"deqp-pipeline-cache",			"Share a persistent Vulkan pipeline cache between test cases",	s_enableNames,	"disable")
+		<< Option<PipelineCacheFilename>(DE_NULL,	"deqp-pipeline-cache-filename",	"Load and store the shared pipeline cache in given file",				"pipelinecache.bin");
 }
 
 void registerLegacyOptions (de::cmdline::Parser& parser)
@@ -790,6 +811,8 @@ const char*				CommandLine::getCaseListExportFile			(void) const	{ return m_cmdL
 WindowVisibility		CommandLine::getVisibility					(void) const	{ return m_cmdLine.getOption<opt::Visibility>();					}
 bool					CommandLine::isWatchDogEnabled				(void) const	{ return m_cmdLine.getOption<opt::WatchDog>();						}
 bool					CommandLine::isCrashHandlingEnabled			(void) const	{ return m_cmdLine.getOption<opt::CrashHandler>();					}
+bool					CommandLine::isParallelExecutionEnabled		(void) const	{ return m_cmdLine.getOption<opt::ParallelExecution>();				}
+int						CommandLine::getForkWorkerCount				(void) const	{ return m_cmdLine.getOption<opt::ForkWorkers>();					}
 int						CommandLine::getBaseSeed					(void) const	{ return m_cmdLine.getOption<opt::BaseSeed>();						}
 int						CommandLine::getTestIterationCount			(void) const	{ return m_cmdLine.getOption<opt::TestIterationCount>();			}
 int						CommandLine::getSurfaceWidth				(void) const	{ return m_cmdLine.getOption<opt::SurfaceWidth>();					}
@@ -797,6 +820,8 @@ int						CommandLine::getSurfaceHeight				(void) const	{ return m_cmdLine.getOpt
 SurfaceType				CommandLine::getSurfaceType					(void) const	{ return m_cmdLine.getOption<opt::SurfaceType>();					}
 ScreenRotation			CommandLine::getScreenRotation				(void) const	{ return m_cmdLine.getOption<opt::ScreenRotation>();				}
 int						CommandLine::getGLConfigId					(void) const	{ return m_cmdLine.getOption<opt::GLConfigID>();					}
+GLStateResetMode		CommandLine::getGLStateResetMode			(void) const	{ return m_cmdLine.getOption<opt::GLStateReset>();					}
+int						CommandLine::getGLCallTraceSize				(void) const	{ return m_cmdLine.getOption<opt::GLCallTrace>();					}
 int						CommandLine::getCLPlatformId				(void) const	{ return m_cmdLine.getOption<opt::CLPlatformID>();					}
 const std::vector<int>&	CommandLine::getCLDeviceIds					(void) const	{ return m_cmdLine.getOption<opt::CLDeviceIDs>();					}
 int						CommandLine::getVKDeviceId					(void) const	{ return m_cmdLine.getOption<opt::VKDeviceID>();					}
@@ -809,6 +834,8 @@ bool					CommandLine::isShaderCacheTruncateEnabled	(void) const	{ return m_cmdLi
 int						CommandLine::getOptimizationRecipe			(void) const	{ return m_cmdLine.getOption<opt::Optimization>();					}
 bool					CommandLine::isSpirvOptimizationEnabled		(void) const	{ return m_cmdLine.getOption<opt::OptimizeSpirv>();					}
 bool					CommandLine::isRenderDocEnabled				(void) const	{ return m_cmdLine.getOption<opt::RenderDoc>();						}
+bool					CommandLine::isPipelineCacheEnabled			(void) const	{ return m_cmdLine.getOption<opt::PipelineCache>();					}
+const char*				CommandLine::getPipelineCacheFilename		(void) const	{ return m_cmdLine.getOption<opt::PipelineCacheFilename>().c_str();	}
 
 const char* CommandLine::getGLContextType (void) const
 {
@@ -882,10 +909,31 @@ de::MovePtr<CaseListFilter> CommandLine::createCaseListFilter (const tcu::Archiv
 	return de::MovePtr<CaseListFilter>(new CaseListFilter(m_cmdLine, archive));
 }
 
+bool CaseListFilter::checkIndexedGroupName (const char* groupName) const
+{
+	const string	name		= groupName;
+	const string	packageName	= CaseIndex::getPackageName(name);
+
+	if (!m_caseIndex->hasPackage(packageName))
+		return true;
+
+	if (m_indexedGroups.find(name) != m_indexedGroups.end())
+		return true;
+
+	// Group was added after the index was generated, only the patterns can reject it
+	if (name != packageName && !m_caseIndex->hasGroup(name))
+	{
+		print("WARNING: Test group '%s' is not in the case index, the index may be out of date\n", groupName);
+		return true;
+	}
+
+	return false;
+}
+
 bool CaseListFilter::checkTestGroupName (const char* groupName) const
 {
 	if (m_casePaths)
-		return m_casePaths->matches(groupName, true);
+		return m_casePaths->matches(groupName, true) && (!m_caseIndex || checkIndexedGroupName(groupName));
 	else if (m_caseTree)
 		return groupName[0] == 0 || tcu::checkTestGroupName(m_caseTree, groupName);
 	else
@@ -907,6 +955,11 @@ CaseListFilter::CaseListFilter (void)
 {
 }
 
+CaseListFilter::CaseListFilter (std::istream& caseList)
+	: m_caseTree(parseCaseList(caseList))
+{
+}
+
 CaseListFilter::CaseListFilter (const de::cmdline::CommandLine& cmdLine, const tcu::Archive& archive)
 	: m_caseTree(DE_NULL)
 {
@@ -950,6 +1003,34 @@ CaseListFilter::CaseListFilter (const de::cmdline::CommandLine& cmdLine, const t
 	}
 	else if (cmdLine.hasOption<opt::CasePath>())
 		m_casePaths = de::MovePtr<const CasePaths>(new CasePaths(cmdLine.getOption<opt::CasePath>()));
+
+	if (cmdLine.hasOption<opt::CaseIndexFile>())
+	{
+		std::ifstream			in		(cmdLine.getOption<opt::CaseIndexFile>().c_str(), std::ios_base::binary);
+		de::MovePtr<CaseIndex>	index	(new CaseIndex());
+
+		if (!in.is_open() || !in.good())
+			throw Exception("Failed to open case index file '" + cmdLine.getOption<opt::CaseIndexFile>() + "'");
+
+		index->read(in);
+		m_caseIndex = de::MovePtr<const CaseIndex>(index);
+	}
+
+	// Wildcard patterns accept any group that is a prefix of a pattern. With an index
+	// only groups that contain a matching case are accepted, so other groups are never inflated.
+	if (m_casePaths && m_caseIndex)
+	{
+		const vector<CaseIndex::Entry>& entries = m_caseIndex->getEntries();
+
+		for (vector<CaseIndex::Entry>::const_iterator entry = entries.begin(); entry != entries.end(); ++entry)
+		{
+			if (!entry->isCase || !m_casePaths->matches(entry->path, false))
+				continue;
+
+			for (size_t sepPos = entry->path.find('.'); sepPos != string::npos; sepPos = entry->path.find('.', sepPos + 1))
+				m_indexedGroups.insert(entry->path.substr(0, sepPos));
+		}
+	}
 }
 
 CaseListFilter::~CaseListFilter (void)
@@ -29,6 +29,7 @@
 
 #include <string>
 #include <vector>
+#include <set>
 #include <istream>
 
 namespace tcu
@@ -87,8 +88,21 @@ enum ScreenRotation
 	SCREENROTATION_LAST
 };
 
+/*--------------------------------------------------------------------*//*!
+ * \brief How GL state is reset between test cases.
+ *//*--------------------------------------------------------------------*/
+enum GLStateResetMode
+{
+	GLSTATERESET_FULL = 0,			//!< Reset all state.
+	GLSTATERESET_TRACKED,			//!< Reset only state modified by the test case.
+	GLSTATERESET_VERIFY,			//!< Reset modified state and check that no other state was modified.
+
+	GLSTATERESET_LAST
+};
+
 class CaseTreeNode;
 class CasePaths;
+class CaseIndex;
 class Archive;
 
 class CaseListFilter
@@ -96,6 +110,8 @@ class CaseListFilter
 public:
 									CaseListFilter				(const de::cmdline::CommandLine& cmdLine, const tcu::Archive& archive);
 									CaseListFilter				(void);
+	//! Accept cases in a newline-separated case path list
+	explicit						CaseListFilter				(std::istream& caseList);
 									~CaseListFilter				(void);
 
 	//! Check if test group is in supplied test case list.
@@ -104,12 +120,19 @@ public:
 	//! Check if test case is in supplied test case list.
 	bool							checkTestCaseName			(const char* caseName) const;
 
+	//! Get case index (--deqp-case-index), or null if not given.
+	const CaseIndex*				getCaseIndex				(void) const { return m_caseIndex.get(); }
+
 private:
 	CaseListFilter												(const CaseListFilter&);	// not allowed!
 	CaseListFilter&					operator=					(const CaseListFilter&);	// not allowed!
 
+	bool							checkIndexedGroupName		(const char* groupName) const;
+
 	CaseTreeNode*					m_caseTree;
 	de::MovePtr<const CasePaths>	m_casePaths;
+	de::MovePtr<const CaseIndex>	m_caseIndex;
+	std::set<std::string>			m_indexedGroups;			//!< Groups with cases matching m_casePaths in indexed packages
 };
 
 /*--------------------------------------------------------------------*//*!
@@ -180,6 +203,18 @@ public:
 	//! Get GL context flags (--deqp-gl-context-flags)
 	const char*						getGLContextFlags				(void) const;
 
+	//! Should thread-safe test cases be executed in parallel (--deqp-parallel-execution)
+	bool							isParallelExecutionEnabled		(void) const;
+
+	//! Get number of forked worker processes, 0 if disabled (--deqp-fork-workers)
+	int								getForkWorkerCount				(void) const;
+
+	//! Get GL state reset mode (--deqp-gl-state-reset)
+	GLStateResetMode				getGLStateResetMode				(void) const;
+
+	//! Get number of GL calls retained for the failure call trace, 0 if disabled (--deqp-gl-call-trace)
+	int								getGLCallTraceSize				(void) const;
+
 	//! Get OpenCL platform ID (--deqp-cl-platform-id)
 	int								getCLPlatformId					(void) const;
 
@@ -229,6 +264,12 @@ public:
 	//! Enable RenderDoc frame markers (--deqp-renderdoc)
 	bool							isRenderDocEnabled			(void) const;
 
+	//! Should the shared Vulkan pipeline cache be enabled (--deqp-pipeline-cache)
+	bool							isPipelineCacheEnabled		(void) const;
+
+	//! Get the filename for the shared Vulkan pipeline cache (--deqp-pipeline-cache-filename)
+	const char*						getPipelineCacheFilename	(void) const;
+
 	/*--------------------------------------------------------------------*//*!
 	 * \brief Creates case list filter
 	 * \param archive Resources
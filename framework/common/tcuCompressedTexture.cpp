@@ -24,9 +24,11 @@
 #include "tcuCompressedTexture.hpp"
 #include "tcuTextureUtil.hpp"
 #include "tcuAstcUtil.hpp"
+#include "tcuTextureDataCache.hpp"
 
 #include "deStringUtil.hpp"
 #include "deFloat16.h"
+#include "deParallelFor.hpp"
 
 #include <algorithm>
 
@@ -2493,36 +2495,131 @@ int componentSum (const IVec3& vec)
 	return vec.x() + vec.y() + vec.z();
 }
 
+enum
+{
+	DECOMPRESS_CHUNK_BLOCK_ROWS			= 4,		//!< Block rows decompressed per parallelFor() chunk
+	DECOMPRESS_MIN_CACHED_DATA_SIZE		= 4096		//!< Smaller compressed data is cheaper to decompress than to look up from cache
+};
+
+//! Decompresses range of block rows, each row being addressed by blockY + blockZ*blockCount.y()
+class DecompressBlockRowsTask : public de::RangeTask
+{
+public:
+	DecompressBlockRowsTask (const PixelBufferAccess& dst, CompressedTexFormat format, const deUint8* src, const TexDecompressionParams& params)
+		: m_dst				(dst)
+		, m_format			(format)
+		, m_src				(src)
+		, m_params			(params)
+		, m_blockSize		(getBlockSize(format))
+		, m_blockPixelSize	(getBlockPixelSize(format))
+		, m_blockCount		(deDivRoundUp32(dst.getWidth(),		m_blockPixelSize.x()),
+							 deDivRoundUp32(dst.getHeight(),	m_blockPixelSize.y()),
+							 deDivRoundUp32(dst.getDepth(),		m_blockPixelSize.z()))
+		, m_blockPitches	(m_blockSize, m_blockSize * m_blockCount.x(), m_blockSize * m_blockCount.x() * m_blockCount.y())
+	{
+	}
+
+	int getNumBlockRows (void) const
+	{
+		return m_blockCount.y() * m_blockCount.z();
+	}
+
+	void run (int begin, int end)
+	{
+		// Each chunk decompresses into its own block buffer and writes to disjoint regions of dst
+		std::vector<deUint8>	uncompressedBlock	(m_dst.getFormat().getPixelSize() * m_blockPixelSize.x() * m_blockPixelSize.y() * m_blockPixelSize.z());
+		const PixelBufferAccess	blockAccess			(getUncompressedFormat(m_format), m_blockPixelSize.x(), m_blockPixelSize.y(), m_blockPixelSize.z(), &uncompressedBlock[0]);
+
+		for (int rowNdx = begin; rowNdx < end; rowNdx++)
+		for (int blockX = 0; blockX < m_blockCount.x(); blockX++)
+		{
+			const IVec3				blockPos	(blockX, rowNdx % m_blockCount.y(), rowNdx / m_blockCount.y());
+			const deUint8* const	blockPtr	= m_src + componentSum(blockPos * m_blockPitches);
+			const IVec3				copySize	(de::min(m_blockPixelSize.x(), m_dst.getWidth()		- blockPos.x() * m_blockPixelSize.x()),
+												 de::min(m_blockPixelSize.y(), m_dst.getHeight()	- blockPos.y() * m_blockPixelSize.y()),
+												 de::min(m_blockPixelSize.z(), m_dst.getDepth()		- blockPos.z() * m_blockPixelSize.z()));
+			const IVec3				dstPixelPos	= blockPos * m_blockPixelSize;
+
+			decompressBlock(m_format, blockAccess, blockPtr, m_params);
+
+			copy(getSubregion(m_dst, dstPixelPos.x(), dstPixelPos.y(), dstPixelPos.z(), copySize.x(), copySize.y(), copySize.z()), getSubregion(blockAccess, 0, 0, 0, copySize.x(), copySize.y(), copySize.z()));
+		}
+	}
+
+private:
+	const PixelBufferAccess			m_dst;
+	const CompressedTexFormat		m_format;
+	const deUint8* const			m_src;
+	const TexDecompressionParams	m_params;
+	const int						m_blockSize;
+	const IVec3						m_blockPixelSize;
+	const IVec3						m_blockCount;
+	const IVec3						m_blockPitches;
+};
+
+void decompressBlockRows (const PixelBufferAccess& dst, CompressedTexFormat fmt, const deUint8* src, const TexDecompressionParams& params)
+{
+	DecompressBlockRowsTask	task	(dst, fmt, src, params);
+
+	// Blocks are independent, so rows of blocks can be decompressed in parallel
+	de::parallelFor(0, task.getNumBlockRows(), DECOMPRESS_CHUNK_BLOCK_ROWS, task);
+}
+
 } // anonymous
 
 void decompress (const PixelBufferAccess& dst, CompressedTexFormat fmt, const deUint8* src, const TexDecompressionParams& params)
 {
-	const int				blockSize			= getBlockSize(fmt);
-	const IVec3				blockPixelSize		(getBlockPixelSize(fmt));
-	const IVec3				blockCount			(deDivRoundUp32(dst.getWidth(),		blockPixelSize.x()),
-												 deDivRoundUp32(dst.getHeight(),	blockPixelSize.y()),
-												 deDivRoundUp32(dst.getDepth(),		blockPixelSize.z()));
-	const IVec3				blockPitches		(blockSize, blockSize * blockCount.x(), blockSize * blockCount.x() * blockCount.y());
-
-	std::vector<deUint8>	uncompressedBlock	(dst.getFormat().getPixelSize() * blockPixelSize.x() * blockPixelSize.y() * blockPixelSize.z());
-	const PixelBufferAccess	blockAccess			(getUncompressedFormat(fmt), blockPixelSize.x(), blockPixelSize.y(), blockPixelSize.z(), &uncompressedBlock[0]);
+	const IVec3		blockPixelSize	(getBlockPixelSize(fmt));
+	const IVec3		blockCount		(deDivRoundUp32(dst.getWidth(),		blockPixelSize.x()),
+									 deDivRoundUp32(dst.getHeight(),	blockPixelSize.y()),
+									 deDivRoundUp32(dst.getDepth(),		blockPixelSize.z()));
+	const size_t	srcSize			= (size_t)getBlockSize(fmt) * blockCount.x() * blockCount.y() * blockCount.z();
 
 	DE_ASSERT(dst.getFormat() == getUncompressedFormat(fmt));
 
-	for (int blockZ = 0; blockZ < blockCount.z(); blockZ++)
-	for (int blockY = 0; blockY < blockCount.y(); blockY++)
-	for (int blockX = 0; blockX < blockCount.x(); blockX++)
+	if (srcSize < DECOMPRESS_MIN_CACHED_DATA_SIZE)
 	{
-		const IVec3				blockPos	(blockX, blockY, blockZ);
-		const deUint8* const	blockPtr	= src + componentSum(blockPos * blockPitches);
-		const IVec3				copySize	(de::min(blockPixelSize.x(), dst.getWidth()		- blockPos.x() * blockPixelSize.x()),
-											 de::min(blockPixelSize.y(), dst.getHeight()	- blockPos.y() * blockPixelSize.y()),
-											 de::min(blockPixelSize.z(), dst.getDepth()		- blockPos.z() * blockPixelSize.z()));
-		const IVec3				dstPixelPos	= blockPos * blockPixelSize;
+		decompressBlockRows(dst, fmt, src, params);
+		return;
+	}
 
-		decompressBlock(fmt, blockAccess, blockPtr, params);
+	// Same reference data is often decompressed by many cases, so decompressed data is cached
+	{
+		TextureDataCache&	cache				= TextureDataCache::getInstance();
+		const int			pixelSize			= dst.getFormat().getPixelSize();
+		const size_t		decompressedSize	= (size_t)pixelSize * dst.getWidth() * dst.getHeight() * dst.getDepth();
+		const bool			isPacked			= dst.getPitch() == IVec3(pixelSize, pixelSize * dst.getWidth(), pixelSize * dst.getWidth() * dst.getHeight());
+		de::Sha1Stream		keyStream;
 
-		copy(getSubregion(dst, dstPixelPos.x(), dstPixelPos.y(), dstPixelPos.z(), copySize.x(), copySize.y(), copySize.z()), getSubregion(blockAccess, 0, 0, 0, copySize.x(), copySize.y(), copySize.z()));
+		keyStream << std::string("tcu::decompress") << (deUint32)fmt << (deUint32)params.astcMode << dst.getWidth() << dst.getHeight() << dst.getDepth();
+		keyStream.process(srcSize, src);
+
+		{
+			const de::Sha1 key = keyStream.finalize();
+
+			if (isPacked)
+			{
+				if (!cache.get(key, dst.getDataPtr(), decompressedSize))
+				{
+					decompressBlockRows(dst, fmt, src, params);
+					cache.put(key, dst.getDataPtr(), decompressedSize);
+				}
+			}
+			else
+			{
+				// Cache entries are tightly packed, so a padded dst needs a packed copy in either direction
+				TextureLevel packed (dst.getFormat(), dst.getWidth(), dst.getHeight(), dst.getDepth());
+
+				if (cache.get(key, packed.getAccess().getDataPtr(), decompressedSize))
+					copy(dst, packed.getAccess());
+				else
+				{
+					decompressBlockRows(dst, fmt, src, params);
+					copy(packed.getAccess(), dst);
+					cache.put(key, packed.getAccess().getDataPtr(), decompressedSize);
+				}
+			}
+		}
 	}
 }
 
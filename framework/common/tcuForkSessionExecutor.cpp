@@ -0,0 +1,727 @@
+/*-------------------------------------------------------------------------
+ * drawElements Quality Program Tester Core
+ * ----------------------------------------
+ *
+ * Copyright 2019 The Android Open Source Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ *//*!
+ * \file
+ * \brief Test executor running case batches in forked worker processes.
+ *//*--------------------------------------------------------------------*/
+
+#include "tcuForkSessionExecutor.hpp"
+#include "tcuCommandLine.hpp"
+#include "tcuTestLog.hpp"
+#include "tcuApp.hpp"
+
+#include "qpDebugOut.h"
+#include "deMath.h"
+#include "deMemory.h"
+
+#include <sstream>
+#include <cstdio>
+
+#if (DE_OS == DE_OS_UNIX) || (DE_OS == DE_OS_OSX) || (DE_OS == DE_OS_ANDROID) || (DE_OS == DE_OS_QNX)
+#	define TCU_FORK_SUPPORTED 1
+#	include <unistd.h>
+#	include <errno.h>
+#	include <poll.h>
+#	include <signal.h>
+#	include <sys/types.h>
+#	include <sys/wait.h>
+#endif
+
+namespace tcu
+{
+
+using std::string;
+using std::vector;
+
+namespace
+{
+
+enum
+{
+	MAX_BATCH_SIZE			= 256,
+	BATCHES_PER_WORKER		= 8,		//!< Keeps workers busy near the end of the run
+	POLL_INTERVAL_MS		= 100
+};
+
+//! Messages sent from workers to the parent, each prefixed with MessageHeader
+enum MessageType
+{
+	MESSAGE_STATUS = 0,			//!< TestRunStatus after each completed case
+	MESSAGE_CASES_TIME,			//!< Package and group durations at the end of the batch
+	MESSAGE_SESSION_COUNTERS,	//!< Session counters at the end of the batch
+
+	MESSAGE_LAST
+};
+
+struct MessageHeader
+{
+	deUint32	type;
+	deUint32	size;
+};
+
+qpTestCaseType getTestCaseType (TestNodeType nodeType)
+{
+	switch (nodeType)
+	{
+		case NODETYPE_SELF_VALIDATE:	return QP_TEST_CASE_TYPE_SELF_VALIDATE;
+		case NODETYPE_PERFORMANCE:		return QP_TEST_CASE_TYPE_PERFORMANCE;
+		case NODETYPE_CAPABILITY:		return QP_TEST_CASE_TYPE_CAPABILITY;
+		case NODETYPE_ACCURACY:			return QP_TEST_CASE_TYPE_ACCURACY;
+		default:
+			DE_ASSERT(false);
+			return QP_TEST_CASE_TYPE_LAST;
+	}
+}
+
+// Process utilities. Exit codes are -1 for processes terminated by a signal.
+
+#if defined(TCU_FORK_SUPPORTED)
+
+//! Fork a process with a pipe from child to parent. Returns 0 in the child.
+int forkProcess (int* readFd, int* writeFd)
+{
+	int fds[2];
+
+	if (pipe(fds) != 0)
+		throw ResourceError("Failed to create pipe for worker process");
+
+	// Unflushed output would otherwise be written by both processes
+	fflush(DE_NULL);
+
+	{
+		const pid_t pid = fork();
+
+		if (pid < 0)
+		{
+			close(fds[0]);
+			close(fds[1]);
+			throw ResourceError("Failed to fork worker process");
+		}
+
+		close(pid == 0 ? fds[0] : fds[1]);
+
+		*readFd		= pid == 0 ? -1 : fds[0];
+		*writeFd	= pid == 0 ? fds[1] : -1;
+
+		return (int)pid;
+	}
+}
+
+int waitForProcess (int pid)
+{
+	int status = 0;
+
+	while (waitpid((pid_t)pid, &status, 0) < 0)
+	{
+		if (errno != EINTR)
+			throw InternalError("Failed to wait for worker process");
+	}
+
+	return WIFEXITED(status) ? WEXITSTATUS(status) : -1;
+}
+
+void killProcess (int pid)
+{
+	kill((pid_t)pid, SIGKILL);
+}
+
+void exitProcess (int exitCode)
+{
+	// Skip static destructors and atexit() handlers of the parent
+	fflush(DE_NULL);
+	_exit(exitCode);
+}
+
+void closeFd (int fd)
+{
+	close(fd);
+}
+
+void writeAll (int fd, const void* data, size_t size)
+{
+	const deUint8*	ptr		= static_cast<const deUint8*>(data);
+	size_t			offset	= 0;
+
+	while (offset < size)
+	{
+		const ssize_t numWritten = write(fd, ptr + offset, size - offset);
+
+		if (numWritten < 0)
+		{
+			if (errno == EINTR)
+				continue;
+
+			throw InternalError("Failed to write to worker pipe");
+		}
+
+		offset += (size_t)numWritten;
+	}
+}
+
+//! Read up to size bytes, returns 0 at end of file
+size_t readSome (int fd, void* data, size_t size)
+{
+	for (;;)
+	{
+		const ssize_t numRead = read(fd, data, size);
+
+		if (numRead >= 0)
+			return (size_t)numRead;
+
+		if (errno != EINTR)
+			throw InternalError("Failed to read from worker pipe");
+	}
+}
+
+//! Wait until one of fds is readable or closed, or timeout expires
+void pollReadable (const vector<int>& fds, int timeoutMs, vector<bool>& isReadable)
+{
+	vector<struct pollfd> pollFds (fds.size());
+
+	for (size_t ndx = 0; ndx < fds.size(); ndx++)
+	{
+		pollFds[ndx].fd			= fds[ndx];
+		pollFds[ndx].events		= POLLIN;
+		pollFds[ndx].revents	= 0;
+	}
+
+	isReadable.assign(fds.size(), false);
+
+	if (poll(pollFds.empty() ? DE_NULL : &pollFds[0], (nfds_t)pollFds.size(), timeoutMs) < 0)
+	{
+		if (errno == EINTR)
+			return;
+
+		throw InternalError("Failed to poll worker pipes");
+	}
+
+	for (size_t ndx = 0; ndx < fds.size(); ndx++)
+		isReadable[ndx] = pollFds[ndx].revents != 0;
+}
+
+//! Write a message in one write() call
+void writeMessage (int fd, MessageType type, const void* data, size_t size)
+{
+	vector<deUint8>	buffer	(sizeof(MessageHeader) + size);
+	MessageHeader	header;
+
+	header.type	= (deUint32)type;
+	header.size	= (deUint32)size;
+
+	deMemcpy(&buffer[0], &header, sizeof(header));
+	if (size > 0)
+		deMemcpy(&buffer[sizeof(header)], data, size);
+
+	writeAll(fd, &buffer[0], buffer.size());
+}
+
+//! Read exactly size bytes, returns false if the writer exited before that
+bool readAll (int fd, void* data, size_t size)
+{
+	size_t offset = 0;
+
+	while (offset < size)
+	{
+		const size_t numRead = readSome(fd, static_cast<deUint8*>(data) + offset, size - offset);
+
+		if (numRead == 0)
+			return false;
+
+		offset += numRead;
+	}
+
+	return true;
+}
+
+#else
+
+int forkProcess (int*, int*)							{ TCU_THROW(NotSupportedError, "Forked worker processes are not supported on this platform");	}
+int waitForProcess (int)								{ DE_FATAL("Not supported"); return -1;	}
+void killProcess (int)									{ DE_FATAL("Not supported");				}
+void exitProcess (int)									{ DE_FATAL("Not supported");				}
+void closeFd (int)										{ DE_FATAL("Not supported");				}
+void writeAll (int, const void*, size_t)				{ DE_FATAL("Not supported");				}
+size_t readSome (int, void*, size_t)					{ DE_FATAL("Not supported"); return 0;	}
+void writeMessage (int, MessageType, const void*, size_t)	{ DE_FATAL("Not supported");				}
+bool readAll (int, void*, size_t)						{ DE_FATAL("Not supported"); return false;	}
+void pollReadable (const vector<int>&, int, vector<bool>&)	{ DE_FATAL("Not supported");				}
+
+#endif // TCU_FORK_SUPPORTED
+
+string serializeCasesTime (const TestSessionExecutor::CasesTime& casesTime)
+{
+	std::ostringstream str;
+
+	for (std::map<string, deUint64>::const_iterator it = casesTime.packages.begin(); it != casesTime.packages.end(); ++it)
+		str << "P " << it->second << " " << it->first << "\n";
+
+	for (std::map<string, deUint64>::const_iterator it = casesTime.groups.begin(); it != casesTime.groups.end(); ++it)
+		str << "G " << it->second << " " << it->first << "\n";
+
+	return str.str();
+}
+
+//! Add durations serialized with serializeCasesTime() to casesTime
+void addCasesTime (TestSessionExecutor::CasesTime& casesTime, const string& serialized)
+{
+	std::istringstream	str			(serialized);
+	char				kind;
+	deUint64			duration;
+	string				name;
+
+	while (str >> kind >> duration >> name)
+		(kind == 'P' ? casesTime.packages : casesTime.groups)[name] += duration;
+}
+
+string serializeSessionCounters (const SessionCounters& counters)
+{
+	std::ostringstream str;
+
+	for (SessionCounters::const_iterator it = counters.begin(); it != counters.end(); ++it)
+		str << it->second << " " << it->first << "\n";
+
+	return str.str();
+}
+
+//! Add counters serialized with serializeSessionCounters() to counters
+void addSessionCounters (SessionCounters& counters, const string& serialized)
+{
+	std::istringstream	str		(serialized);
+	deInt64				value;
+	string				name;
+
+	// Names may contain spaces and run to the end of the line
+	while (str >> value && str.get() == ' ' && std::getline(str, name))
+		counters[name] += value;
+}
+
+void onWorkerTimeout (qpWatchDog* watchDog, void* userPtr, qpTimeoutReason reason)
+{
+	DE_UNREF(watchDog);
+	DE_UNREF(userPtr);
+
+	// The case is recorded by the parent, which can not be interrupted mid-write by this thread
+	qpPrintf("Watchdog timer timeout for %s\n", (reason == QP_TIMEOUT_REASON_INTERVAL_LIMIT ? "touch interval" : "total time"));
+	exitProcess(ForkSessionExecutor::WORKER_EXIT_TIMEOUT);
+}
+
+} // anonymous
+
+ForkSessionExecutor::ForkSessionExecutor (TestPackageRoot& root, TestContext& testCtx, int numWorkers)
+	: m_root			(root)
+	, m_testCtx			(testCtx)
+	, m_numWorkers		(numWorkers)
+	, m_isEnumerated	(false)
+	, m_abortSession	(false)
+{
+	DE_ASSERT(numWorkers > 0);
+
+	if (!isSupported())
+		TCU_THROW(NotSupportedError, "Forked worker processes are not supported on this platform");
+}
+
+ForkSessionExecutor::~ForkSessionExecutor (void)
+{
+	for (size_t ndx = 0; ndx < m_workers.size(); ndx++)
+	{
+		killProcess(m_workers[ndx].pid);
+		closeFd(m_workers[ndx].readFd);
+
+		try
+		{
+			waitForProcess(m_workers[ndx].pid);
+		}
+		catch (const std::exception&)
+		{
+			// Process is reaped at exit
+		}
+	}
+}
+
+bool ForkSessionExecutor::isSupported (void)
+{
+#if defined(TCU_FORK_SUPPORTED)
+	return true;
+#else
+	return false;
+#endif
+}
+
+bool ForkSessionExecutor::iterate (void)
+{
+	if (!m_isEnumerated)
+	{
+		enumerateCases();
+		createBatches();
+		m_isEnumerated = true;
+		return true;
+	}
+
+	while ((int)m_workers.size() < m_numWorkers && !m_abortSession)
+	{
+		std::list<Batch>::iterator batch = m_batches.begin();
+
+		while (batch != m_batches.end() && batch->log)
+			++batch;
+
+		if (batch == m_batches.end())
+			break;
+
+		startWorker(batch);
+	}
+
+	if (m_workers.empty())
+	{
+		// Batches that were never started after the session was aborted
+		for (std::list<Batch>::iterator batch = m_batches.begin(); batch != m_batches.end();)
+		{
+			if (batch->isDone)
+				++batch;
+			else
+				batch = m_batches.erase(batch);
+		}
+
+		writeCompletedBatches();
+
+		if (!m_casesTime.packages.empty())
+			TestSessionExecutor::writeCasesTime(m_testCtx.getLog(), m_casesTime);
+
+		m_status.isComplete = !m_abortSession;
+		return false;
+	}
+
+	pollWorkers(POLL_INTERVAL_MS);
+	writeCompletedBatches();
+
+	// Workers have watchdogs of their own, the parent only needs to stay responsive
+	if (m_testCtx.getWatchDog())
+		qpWatchDog_reset(m_testCtx.getWatchDog());
+
+	return true;
+}
+
+void ForkSessionExecutor::enumerateCases (void)
+{
+	int			readFd		= -1;
+	int			writeFd		= -1;
+	const int	pid			= forkProcess(&readFd, &writeFd);
+
+	if (pid == 0)
+	{
+		// Packages are initialized while traversing the hierarchy, which must not happen in the parent
+		int exitCode = 0;
+
+		try
+		{
+			DefaultHierarchyInflater			inflater	(m_testCtx);
+			de::MovePtr<CaseListFilter>			filter		(m_testCtx.getCommandLine().createCaseListFilter(m_testCtx.getArchive()));
+			TestHierarchyIterator				iter		(m_root, inflater, *filter);
+			std::ostringstream					caseList;
+
+			while (iter.getState() != TestHierarchyIterator::STATE_FINISHED)
+			{
+				if (iter.getState() == TestHierarchyIterator::STATE_ENTER_NODE &&
+					isTestNodeTypeExecutable(iter.getNode()->getNodeType()))
+					caseList << (int)getTestCaseType(iter.getNode()->getNodeType()) << " " << iter.getNodePath() << "\n";
+
+				iter.next();
+			}
+
+			{
+				const string str = caseList.str();
+				writeAll(writeFd, str.c_str(), str.size());
+			}
+		}
+		catch (const std::exception& e)
+		{
+			print("Failed to enumerate test cases: %s\n", e.what());
+			exitCode = 1;
+		}
+
+		exitProcess(exitCode);
+	}
+
+	{
+		string	caseList;
+		char	buffer[4096];
+		size_t	numRead;
+
+		while ((numRead = readSome(readFd, &buffer[0], sizeof(buffer))) > 0)
+			caseList.append(&buffer[0], numRead);
+
+		closeFd(readFd);
+
+		if (waitForProcess(pid) != 0)
+			throw TestError("Failed to enumerate test cases");
+
+		{
+			std::istringstream	str		(caseList);
+			int					type;
+			string				path;
+
+			while (str >> type >> path)
+				m_cases.push_back(CaseEntry(path, (qpTestCaseType)type));
+		}
+	}
+}
+
+void ForkSessionExecutor::createBatches (void)
+{
+	const int numCases	= (int)m_cases.size();
+	const int batchSize	= de::clamp(numCases / (m_numWorkers * BATCHES_PER_WORKER), 1, (int)MAX_BATCH_SIZE);
+
+	for (int begin = 0; begin < numCases; begin += batchSize)
+		m_batches.push_back(Batch(begin, de::min(begin + batchSize, numCases)));
+}
+
+void ForkSessionExecutor::startWorker (std::list<Batch>::iterator batch)
+{
+	// The parent reads buffer logs after the worker exits, so they must be flushed after every write
+	const deUint32 flags = m_testCtx.getLog().getLogFlags() & ~QP_TEST_LOG_NO_FLUSH;
+
+	batch->log		= de::SharedPtr<TestLog>(TestLog::createBufferLog(flags));
+	batch->caseLog	= de::SharedPtr<TestLog>(TestLog::createBufferLog(flags));
+
+	{
+		int			readFd		= -1;
+		int			writeFd		= -1;
+		const int	pid			= forkProcess(&readFd, &writeFd);
+
+		if (pid == 0)
+		{
+			for (size_t ndx = 0; ndx < m_workers.size(); ndx++)
+				closeFd(m_workers[ndx].readFd);
+
+			runWorker(*batch, writeFd);
+		}
+
+		{
+			Worker worker;
+
+			worker.pid		= pid;
+			worker.readFd	= readFd;
+			worker.batch	= batch;
+
+			m_workers.push_back(worker);
+		}
+	}
+}
+
+void ForkSessionExecutor::runWorker (const Batch& batch, int writeFd)
+{
+	int exitCode = 0;
+
+	try
+	{
+		std::ostringstream caseList;
+
+		for (int ndx = batch.begin; ndx < batch.end; ndx++)
+			caseList << m_cases[ndx].path << "\n";
+
+		// Watchdog thread of the parent does not exist in this process
+		if (m_testCtx.getWatchDog())
+		{
+			qpWatchDog* const watchDog = qpWatchDog_create(onWorkerTimeout, DE_NULL, WATCHDOG_TOTAL_TIME_LIMIT_SECS, WATCHDOG_INTERVAL_TIME_LIMIT_SECS);
+
+			TCU_CHECK_INTERNAL(watchDog);
+			m_testCtx.setWatchDog(watchDog);
+		}
+
+		{
+			std::istringstream				caseListStr	(caseList.str());
+			de::MovePtr<CaseListFilter>		filter		(new CaseListFilter(caseListStr));
+			TestContext::ThreadCaseState	caseState	(*batch.caseLog);
+			TestSessionExecutor				executor	(m_root, m_testCtx, filter, false);
+			int								numReported	= 0;
+			bool							isRunning	= true;
+
+			m_testCtx.setThreadCaseState(&caseState);
+
+			while (isRunning)
+			{
+				isRunning = executor.iterate();
+
+				// Executor returns after each completed case, so no case is open in caseLog
+				if (executor.getStatus().numExecuted != numReported || !isRunning)
+				{
+					batch.log->appendBufferLog(*batch.caseLog);
+					batch.caseLog->clearBufferLog();
+
+					numReported = executor.getStatus().numExecuted;
+					writeMessage(writeFd, MESSAGE_STATUS, &executor.getStatus(), sizeof(TestRunStatus));
+				}
+			}
+
+			m_testCtx.setThreadCaseState(DE_NULL);
+
+			{
+				const string casesTime = serializeCasesTime(executor.getCasesTime());
+				writeMessage(writeFd, MESSAGE_CASES_TIME, casesTime.c_str(), casesTime.size());
+			}
+
+			{
+				const string counters = serializeSessionCounters(executor.getSessionCounters());
+				writeMessage(writeFd, MESSAGE_SESSION_COUNTERS, counters.c_str(), counters.size());
+			}
+		}
+	}
+	catch (const std::exception& e)
+	{
+		print("Worker process failed: %s\n", e.what());
+		exitCode = 1;
+	}
+
+	exitProcess(exitCode);
+}
+
+void ForkSessionExecutor::pollWorkers (int timeoutMs)
+{
+	vector<int>		fds				(m_workers.size());
+	vector<bool>	isReadable;
+
+	for (size_t ndx = 0; ndx < m_workers.size(); ndx++)
+		fds[ndx] = m_workers[ndx].readFd;
+
+	pollReadable(fds, timeoutMs, isReadable);
+
+	// Backwards, so that finished workers can be removed
+	for (int ndx = (int)m_workers.size() - 1; ndx >= 0; ndx--)
+	{
+		if (!isReadable[ndx] || readWorkerMessage(m_workers[ndx]))
+			continue;
+
+		{
+			const Worker worker = m_workers[ndx];
+
+			m_workers.erase(m_workers.begin() + ndx);
+			closeFd(worker.readFd);
+
+			finishWorker(worker, waitForProcess(worker.pid));
+		}
+	}
+}
+
+bool ForkSessionExecutor::readWorkerMessage (Worker& worker)
+{
+	MessageHeader	header;
+	vector<deUint8>	data;
+
+	// Partial message means that the worker was terminated while writing it
+	if (!readAll(worker.readFd, &header, sizeof(header)))
+		return false;
+
+	data.resize(header.size);
+
+	if (header.size > 0 && !readAll(worker.readFd, &data[0], data.size()))
+		return false;
+
+	if (header.type == MESSAGE_STATUS)
+	{
+		TestRunStatus status;
+
+		TCU_CHECK_INTERNAL(data.size() == sizeof(status));
+		deMemcpy(&status, &data[0], sizeof(status));
+
+		m_status.numExecuted		+= status.numExecuted		- worker.status.numExecuted;
+		m_status.numPassed			+= status.numPassed			- worker.status.numPassed;
+		m_status.numFailed			+= status.numFailed			- worker.status.numFailed;
+		m_status.numNotSupported	+= status.numNotSupported	- worker.status.numNotSupported;
+		m_status.numWarnings		+= status.numWarnings		- worker.status.numWarnings;
+
+		worker.status = status;
+	}
+	else if (header.type == MESSAGE_CASES_TIME)
+		addCasesTime(m_casesTime, data.empty() ? string() : string((const char*)&data[0], data.size()));
+	else if (header.type == MESSAGE_SESSION_COUNTERS)
+		addSessionCounters(m_sessionCounters, data.empty() ? string() : string((const char*)&data[0], data.size()));
+	else
+		throw InternalError("Unknown message from worker process");
+
+	return true;
+}
+
+void ForkSessionExecutor::finishWorker (const Worker& worker, int exitCode)
+{
+	Batch&		batch		= *worker.batch;
+	const int	failedNdx	= batch.begin + worker.status.numExecuted;
+
+	batch.isDone = true;
+
+	if (exitCode == 0)
+	{
+		// Worker stops early only if a case requested the session to be terminated
+		if (!worker.status.isComplete)
+			m_abortSession = true;
+
+		return;
+	}
+
+	if (failedNdx >= batch.end)
+	{
+		print("Worker process terminated after completing all cases (exit code %d)\n", exitCode);
+		return;
+	}
+
+	batch.failResult = exitCode == WORKER_EXIT_TIMEOUT ? QP_TEST_RESULT_TIMEOUT : QP_TEST_RESULT_CRASH;
+
+	print("\nTest case '%s'..\n", m_cases[failedNdx].path.c_str());
+	print("  %s (Worker process terminated)\n", qpGetTestResultName(batch.failResult));
+
+	m_status.numExecuted	+= 1;
+	m_status.numFailed		+= 1;
+
+	// Rest of the batch is executed by a new worker
+	if (failedNdx + 1 < batch.end)
+	{
+		std::list<Batch>::iterator nextBatch = worker.batch;
+		m_batches.insert(++nextBatch, Batch(failedNdx + 1, batch.end));
+	}
+
+	batch.end = failedNdx + 1;
+}
+
+void ForkSessionExecutor::writeCompletedBatches (void)
+{
+	TestLog& log = m_testCtx.getLog();
+
+	while (!m_batches.empty() && m_batches.front().isDone)
+	{
+		const Batch& batch = m_batches.front();
+
+		log.appendBufferLog(*batch.log);
+
+		if (batch.failResult != QP_TEST_RESULT_LAST)
+		{
+			const CaseEntry& failedCase = m_cases[batch.end - 1];
+
+			// Case log is empty if the worker was terminated before the case was started
+			if (!batch.caseLog->isBufferLogEmpty())
+				log.appendTerminatedCase(*batch.caseLog, batch.failResult);
+			else
+			{
+				log.startCase(failedCase.path.c_str(), failedCase.type);
+				log.terminateCase(batch.failResult);
+			}
+		}
+
+		m_batches.pop_front();
+	}
+}
+
+} // tcu
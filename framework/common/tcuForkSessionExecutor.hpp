@@ -0,0 +1,140 @@
+#ifndef _TCUFORKSESSIONEXECUTOR_HPP
+#define _TCUFORKSESSIONEXECUTOR_HPP
+/*-------------------------------------------------------------------------
+ * drawElements Quality Program Tester Core
+ * ----------------------------------------
+ *
+ * Copyright 2019 The Android Open Source Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ *//*!
+ * \file
+ * \brief Test executor running case batches in forked worker processes.
+ *//*--------------------------------------------------------------------*/
+
+#include "tcuDefs.hpp"
+#include "tcuTestSessionExecutor.hpp"
+#include "deSharedPtr.hpp"
+
+#include <string>
+#include <vector>
+#include <list>
+
+namespace tcu
+{
+
+/*--------------------------------------------------------------------*//*!
+ * \brief Test executor that isolates crashes in worker processes
+ *
+ * The case list is enumerated once in a forked process. Cases are then
+ * split into batches that are executed by up to numWorkers forked worker
+ * processes at a time. Platform, archive and command line are inherited
+ * from the parent, but each worker initializes test packages itself, as
+ * graphics drivers can not be used across fork().
+ *
+ * Workers log cases into buffer logs shared with the parent and report
+ * each completed case over a pipe. Logs of batches are appended to the
+ * main log in case list order. If a worker crashes or hits its watchdog
+ * timeout, the partial log of the running case is recorded as crashed or
+ * timed out and the rest of the batch is executed in a new worker.
+ * Package and group durations reported by workers are summed and written
+ * in a single block at the end of the session.
+ *
+ * Only supported on platforms with fork().
+ *//*--------------------------------------------------------------------*/
+class ForkSessionExecutor
+{
+public:
+	enum
+	{
+		WORKER_EXIT_TIMEOUT		= 3		//!< Exit code of a worker that hit its watchdog timeout
+	};
+
+									ForkSessionExecutor		(TestPackageRoot& root, TestContext& testCtx, int numWorkers);
+									~ForkSessionExecutor	(void);
+
+	bool							iterate					(void);
+
+	const TestRunStatus&			getStatus				(void) const { return m_status;				}
+	const SessionCounters&			getSessionCounters		(void) const { return m_sessionCounters;	}
+
+	static bool						isSupported				(void);
+
+private:
+									ForkSessionExecutor		(const ForkSessionExecutor&);
+	ForkSessionExecutor&			operator=				(const ForkSessionExecutor&);
+
+	struct CaseEntry
+	{
+		std::string				path;
+		qpTestCaseType			type;
+
+		CaseEntry (const std::string& path_, qpTestCaseType type_) : path(path_), type(type_) {}
+	};
+
+	//! Range of m_cases executed by one worker process
+	struct Batch
+	{
+		int						begin;
+		int						end;
+		de::SharedPtr<TestLog>	log;			//!< Buffer log of completed cases written by the worker
+		de::SharedPtr<TestLog>	caseLog;		//!< Buffer log of the case currently running in the worker
+		bool					isDone;
+		qpTestResult			failResult;		//!< Crash or timeout of the last case, QP_TEST_RESULT_LAST if none
+
+		Batch (int begin_, int end_)
+			: begin			(begin_)
+			, end			(end_)
+			, isDone		(false)
+			, failResult	(QP_TEST_RESULT_LAST)
+		{
+		}
+	};
+
+	struct Worker
+	{
+		int							pid;
+		int							readFd;
+		std::list<Batch>::iterator	batch;
+		TestRunStatus				status;		//!< Last status reported by the worker
+	};
+
+	void							enumerateCases			(void);
+	void							createBatches			(void);
+
+	void							startWorker				(std::list<Batch>::iterator batch);
+	void							runWorker				(const Batch& batch, int writeFd);
+	void							pollWorkers				(int timeoutMs);
+	bool							readWorkerMessage		(Worker& worker);
+	void							finishWorker			(const Worker& worker, int exitCode);
+	void							writeCompletedBatches	(void);
+
+	TestPackageRoot&				m_root;
+	TestContext&					m_testCtx;
+	const int						m_numWorkers;
+
+	std::vector<CaseEntry>			m_cases;
+	std::list<Batch>				m_batches;			//!< Batches not yet written to the log, in case list order
+	std::vector<Worker>				m_workers;
+
+	TestRunStatus					m_status;
+	TestSessionExecutor::CasesTime	m_casesTime;		//!< Sum of durations reported by workers
+	SessionCounters					m_sessionCounters;	//!< Sum of counters reported by workers, counters of terminated workers are lost
+	bool							m_isEnumerated;
+	bool							m_abortSession;
+};
+
+} // tcu
+
+#endif // _TCUFORKSESSIONEXECUTOR_HPP
@@ -25,8 +25,11 @@
 #include "tcuResource.hpp"
 #include "tcuSurface.hpp"
 #include "tcuCompressedTexture.hpp"
+#include "tcuTextureDataCache.hpp"
 #include "deFilePath.hpp"
 #include "deUniquePtr.hpp"
+#include "deRandom.hpp"
+#include "deFile.h"
 
 #include <string>
 #include <vector>
@@ -70,10 +73,63 @@ static void pngReadResource (png_structp png_ptr, png_bytep data, png_size_t len
 }
 DE_END_EXTERN_C
 
+// Decoded images are cached, as many cases load the same reference images.
+// Image format and size, and pixel data are stored as separate cache entries.
+
+struct CachedImageHeader
+{
+	deUint32	order;
+	deUint32	type;
+	deInt32		width;
+	deInt32		height;
+};
+
+static de::Sha1 getCachedImageKey (const Resource& resource, const char* entryName)
+{
+	de::Sha1Stream keyStream;
+	keyStream << std::string("tcu::ImageIO::") << std::string(entryName) << resource.getName() << (deInt32)resource.getSize() << resource.getModificationTime();
+	return keyStream.finalize();
+}
+
+static size_t getImageDataSize (const ConstPixelBufferAccess& access)
+{
+	return (size_t)access.getRowPitch() * (size_t)access.getHeight();
+}
+
+static bool loadCachedImage (TextureLevel& dst, const Resource& resource)
+{
+	TextureDataCache&	cache	= TextureDataCache::getInstance();
+	CachedImageHeader	header;
+
+	if (!cache.get(getCachedImageKey(resource, "header"), &header, sizeof(header)))
+		return false;
+
+	dst.setStorage(TextureFormat((TextureFormat::ChannelOrder)header.order, (TextureFormat::ChannelType)header.type), header.width, header.height);
+
+	// \note Pixel data may have been evicted
+	return cache.get(getCachedImageKey(resource, "data"), dst.getAccess().getDataPtr(), getImageDataSize(dst.getAccess()));
+}
+
+static void storeCachedImage (const TextureLevel& src, const Resource& resource)
+{
+	TextureDataCache&				cache	= TextureDataCache::getInstance();
+	const ConstPixelBufferAccess	access	= src.getAccess();
+	CachedImageHeader				header;
+
+	header.order	= (deUint32)access.getFormat().order;
+	header.type		= (deUint32)access.getFormat().type;
+	header.width	= access.getWidth();
+	header.height	= access.getHeight();
+
+	cache.put(getCachedImageKey(resource, "data"), access.getDataPtr(), getImageDataSize(access));
+	cache.put(getCachedImageKey(resource, "header"), &header, sizeof(header));
+}
+
 /*--------------------------------------------------------------------*//*!
  * \brief Load PNG image from resource
  *
- * TextureLevel storage is set to match image data.
+ * TextureLevel storage is set to match image data. Decoded images are
+ * cached, keyed by resource name, size and modification time.
  *
  * \param dst		Destination pixel container
  * \param archive	Resource archive
@@ -83,6 +139,9 @@ void loadPNG (TextureLevel& dst, const tcu::Archive& archive, const char* fileNa
 {
 	de::UniquePtr<Resource> resource(archive.getResource(fileName));
 
+	if (loadCachedImage(dst, *resource))
+		return;
+
 	// Verify header.
 	deUint8 header[8];
 	resource->read(header, sizeof(header));
@@ -130,6 +189,8 @@ void loadPNG (TextureLevel& dst, const tcu::Archive& archive, const char* fileNa
 
 	png_destroy_info_struct(png_ptr, &info_ptr);
 	png_destroy_read_struct(&png_ptr, DE_NULL, DE_NULL);
+
+	storeCachedImage(dst, *resource);
 }
 
 static int textureFormatToPNGFormat (const TextureFormat& format)
@@ -253,4 +314,63 @@ void loadPKM (CompressedTexture& dst, const tcu::Archive& archive, const char* f
 }
 
 } // ImageIO
+
+static bool imagesEqual (const ConstPixelBufferAccess& a, const ConstPixelBufferAccess& b)
+{
+	if (a.getFormat() != b.getFormat() || a.getWidth() != b.getWidth() || a.getHeight() != b.getHeight())
+		return false;
+
+	for (int y = 0; y < a.getHeight(); y++)
+	for (int x = 0; x < a.getWidth(); x++)
+	{
+		if (a.getPixelUint(x, y) != b.getPixelUint(x, y))
+			return false;
+	}
+
+	return true;
+}
+
+void ImageIO_selfTest (void)
+{
+	const char* const	filename	= "imageio-selftest.png";
+	TextureLevel		src			(TextureFormat(TextureFormat::RGBA, TextureFormat::UNORM_INT8), 37, 23);
+	de::Random			rnd			(0x1a3f);
+
+	for (int y = 0; y < src.getHeight(); y++)
+	for (int x = 0; x < src.getWidth(); x++)
+		src.getAccess().setPixel(UVec4(rnd.getUint8(), rnd.getUint8(), rnd.getUint8(), rnd.getUint8()), x, y);
+
+	ImageIO::savePNG(src.getAccess(), filename);
+
+	try
+	{
+		const DirArchive		archive		(".");
+		TextureLevel			decoded;
+		TextureLevel			cached;
+
+		// First load decodes the file and adds it to cache, second load is served from cache
+		ImageIO::loadPNG(decoded, archive, filename);
+
+		{
+			const de::UniquePtr<Resource>	resource	(archive.getResource(filename));
+			ImageIO::CachedImageHeader		header;
+
+			DE_TEST_ASSERT(TextureDataCache::getInstance().get(ImageIO::getCachedImageKey(*resource, "header"), &header, sizeof(header)));
+			DE_TEST_ASSERT(header.width == src.getWidth() && header.height == src.getHeight());
+		}
+
+		ImageIO::loadPNG(cached, archive, filename);
+
+		DE_TEST_ASSERT(imagesEqual(decoded.getAccess(), src.getAccess()));
+		DE_TEST_ASSERT(imagesEqual(cached.getAccess(), decoded.getAccess()));
+	}
+	catch (...)
+	{
+		deDeleteFile(filename);
+		throw;
+	}
+
+	deDeleteFile(filename);
+}
+
 } // tcu
@@ -44,6 +44,9 @@ void				savePNG					(const ConstPixelBufferAccess& src, const char* fileName);
 void				loadPKM					(CompressedTexture& dst, const tcu::Archive& archive, const char* fileName);
 
 } // ImageIO
+
+void				ImageIO_selfTest		(void);
+
 } // tcu
 
 #endif // _TCUIMAGEIO_HPP
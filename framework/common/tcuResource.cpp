@@ -22,8 +22,22 @@
  *//*--------------------------------------------------------------------*/
 
 #include "tcuResource.hpp"
+#include "deMemory.h"
+#include "deFile.h"
+#include "deUniquePtr.hpp"
+
+#include <vector>
 
 #include <stdio.h>
+#include <sys/types.h>
+#include <sys/stat.h>
+
+#if (DE_OS == DE_OS_UNIX) || (DE_OS == DE_OS_ANDROID) || (DE_OS == DE_OS_OSX) || (DE_OS == DE_OS_IOS) || (DE_OS == DE_OS_QNX)
+#	define TCU_RESOURCE_USE_MMAP
+#	include <sys/mman.h>
+#	include <fcntl.h>
+#	include <unistd.h>
+#endif
 
 namespace tcu
 {
@@ -46,26 +60,92 @@ Resource* DirArchive::getResource (const char* name) const
 }
 
 FileResource::FileResource (const char* filename)
-	: Resource(std::string(filename))
+	: Resource				(std::string(filename))
+	, m_file				(DE_NULL)
+	, m_mappedData			(DE_NULL)
+	, m_mappedSize			(0)
+	, m_mappedPosition		(0)
+	, m_modificationTime	(-1)
 {
+#if defined(TCU_RESOURCE_USE_MMAP)
+	const int	fd	= open(filename, O_RDONLY);
+	struct stat	st;
+
+	if (fd < 0)
+		throw ResourceError("Failed to open file", filename, __FILE__, __LINE__);
+
+	if (fstat(fd, &st) == 0)
+	{
+		m_modificationTime = (deInt64)st.st_mtime;
+
+		// \note Empty files and non-regular files can't be mapped
+		if (S_ISREG(st.st_mode) && st.st_size > 0 && st.st_size <= 0x7fffffff)
+		{
+			void* const data = mmap(DE_NULL, (size_t)st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+
+			if (data != MAP_FAILED)
+			{
+				m_mappedData	= (const deUint8*)data;
+				m_mappedSize	= (int)st.st_size;
+			}
+		}
+	}
+
+	if (m_mappedData)
+		close(fd);
+	else
+	{
+		m_file = fdopen(fd, "rb");
+
+		if (!m_file)
+		{
+			close(fd);
+			throw ResourceError("Failed to open file", filename, __FILE__, __LINE__);
+		}
+	}
+#else
+	struct stat st;
+
 	m_file = fopen(filename, "rb");
 	if (!m_file)
 		throw ResourceError("Failed to open file", filename, __FILE__, __LINE__);
+
+	if (stat(filename, &st) == 0)
+		m_modificationTime = (deInt64)st.st_mtime;
+#endif
 }
 
 FileResource::~FileResource ()
 {
-	fclose(m_file);
+#if defined(TCU_RESOURCE_USE_MMAP)
+	if (m_mappedData)
+		munmap((void*)m_mappedData, (size_t)m_mappedSize);
+#endif
+
+	if (m_file)
+		fclose(m_file);
 }
 
 void FileResource::read (deUint8* dst, int numBytes)
 {
-	int numRead = (int)fread(dst, 1, numBytes, m_file);
-	TCU_CHECK(numRead == numBytes);
+	if (m_mappedData)
+	{
+		TCU_CHECK(de::inRange(m_mappedPosition, 0, m_mappedSize) && numBytes >= 0 && numBytes <= m_mappedSize - m_mappedPosition);
+		deMemcpy(dst, m_mappedData + m_mappedPosition, (size_t)numBytes);
+		m_mappedPosition += numBytes;
+	}
+	else
+	{
+		int numRead = (int)fread(dst, 1, numBytes, m_file);
+		TCU_CHECK(numRead == numBytes);
+	}
 }
 
 int FileResource::getSize (void) const
 {
+	if (m_mappedData)
+		return m_mappedSize;
+
 	long curPos = ftell(m_file);
 	fseek(m_file, 0, SEEK_END);
 	int size = (int)ftell(m_file);
@@ -75,12 +155,18 @@ int FileResource::getSize (void) const
 
 int FileResource::getPosition (void) const
 {
+	if (m_mappedData)
+		return m_mappedPosition;
+
 	return (int)ftell(m_file);
 }
 
 void FileResource::setPosition (int position)
 {
-	fseek(m_file, (size_t)position, SEEK_SET);
+	if (m_mappedData)
+		m_mappedPosition = position;
+	else
+		fseek(m_file, (size_t)position, SEEK_SET);
 }
 
 ResourcePrefix::ResourcePrefix (const Archive& archive, const char* prefix)
@@ -94,4 +180,120 @@ Resource* ResourcePrefix::getResource (const char* name) const
 	return m_archive.getResource((m_prefix + name).c_str());
 }
 
+static void writeTestFile (const char* filename, const std::vector<deUint8>& data)
+{
+	FILE* const file = fopen(filename, "wb");
+
+	TCU_CHECK(file);
+
+	if (!data.empty() && fwrite(&data[0], 1, data.size(), file) != data.size())
+	{
+		fclose(file);
+		TCU_FAIL("Failed to write file");
+	}
+
+	fclose(file);
+}
+
+static void testFileResource (const char* filename, const std::vector<deUint8>& data)
+{
+	const int		size		= (int)data.size();
+	FileResource	resource	(filename);
+
+#if defined(TCU_RESOURCE_USE_MMAP)
+	// Empty files can't be mapped
+	DE_TEST_ASSERT(resource.isMapped() == (size > 0));
+#endif
+
+	DE_TEST_ASSERT(resource.getSize() == size);
+	DE_TEST_ASSERT(resource.getPosition() == 0);
+	DE_TEST_ASSERT(resource.getModificationTime() != -1);
+
+	if (size > 0)
+	{
+		const int				first	= size / 3;
+		std::vector<deUint8>	buf		(size);
+
+		// Read from start, then seek forward and back
+		resource.read(&buf[0], first);
+		DE_TEST_ASSERT(resource.getPosition() == first);
+		DE_TEST_ASSERT(deMemCmp(&buf[0], &data[0], first) == 0);
+
+		resource.setPosition(size - 7);
+		resource.read(&buf[0], 7);
+		DE_TEST_ASSERT(resource.getPosition() == size);
+		DE_TEST_ASSERT(deMemCmp(&buf[0], &data[size - 7], 7) == 0);
+
+		resource.setPosition(1);
+		resource.read(&buf[0], size - 1);
+		DE_TEST_ASSERT(deMemCmp(&buf[0], &data[1], size - 1) == 0);
+
+		// Size does not depend on position
+		DE_TEST_ASSERT(resource.getSize() == size);
+	}
+
+	// Reading past end fails
+	{
+		deUint8 byte = 0;
+
+		try
+		{
+			resource.read(&byte, 1);
+			DE_TEST_ASSERT(false);
+		}
+		catch (const TestError&)
+		{
+		}
+	}
+}
+
+void FileResource_selfTest (void)
+{
+	const char* const		filename	= "resource-selftest.bin";
+	std::vector<deUint8>	data		(4099);
+
+	for (size_t ndx = 0; ndx < data.size(); ndx++)
+		data[ndx] = (deUint8)(ndx * 7 + (ndx >> 8));
+
+	try
+	{
+		writeTestFile(filename, data);
+		testFileResource(filename, data);
+
+		writeTestFile(filename, std::vector<deUint8>());
+		testFileResource(filename, std::vector<deUint8>());
+
+		// Missing file
+		deDeleteFile(filename);
+
+		try
+		{
+			FileResource resource (filename);
+			DE_TEST_ASSERT(false);
+		}
+		catch (const ResourceError&)
+		{
+		}
+
+		// Through archive
+		writeTestFile(filename, data);
+
+		{
+			const de::UniquePtr<Resource>	resource	(DirArchive(".").getResource(filename));
+			std::vector<deUint8>			buf			(data.size());
+
+			DE_TEST_ASSERT(resource->getSize() == (int)data.size());
+			resource->read(&buf[0], (int)buf.size());
+			DE_TEST_ASSERT(buf == data);
+		}
+	}
+	catch (...)
+	{
+		deDeleteFile(filename);
+		throw;
+	}
+
+	deDeleteFile(filename);
+}
+
 } // tcu
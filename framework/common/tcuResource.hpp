@@ -52,6 +52,9 @@ public:
 	virtual int			getPosition		(void) const = 0;
 	virtual void		setPosition		(int position) = 0;
 
+	//! Modification time in seconds since epoch, or -1 if not known. Resources without modification time must not change during execution.
+	virtual deInt64		getModificationTime	(void) const { return -1; }
+
 	const std::string&	getName			(void) const { return m_name; }
 
 protected:
@@ -105,22 +108,36 @@ private:
 
 };
 
+/*--------------------------------------------------------------------*//*!
+ * \brief File resource
+ *
+ * File is memory-mapped when supported by the platform, in which case
+ * reads are copies from the mapping. Otherwise file is read with stdio.
+ *//*--------------------------------------------------------------------*/
 class FileResource : public Resource
 {
 public:
-						FileResource	(const char* filename);
-						~FileResource	(void);
+						FileResource		(const char* filename);
+						~FileResource		(void);
 
-	void				read			(deUint8* dst, int numBytes);
-	int					getSize			(void) const;
-	int					getPosition		(void) const;
-	void				setPosition		(int position);
+	void				read				(deUint8* dst, int numBytes);
+	int					getSize				(void) const;
+	int					getPosition			(void) const;
+	void				setPosition			(int position);
+	deInt64				getModificationTime	(void) const { return m_modificationTime; }
 
-private:
-						FileResource	(const FileResource& other);
-	FileResource&		operator=		(const FileResource& other);
+	//! True if file is memory-mapped
+	bool				isMapped			(void) const { return m_mappedData != DE_NULL; }
 
-	FILE*				m_file;
+private:
+						FileResource		(const FileResource& other);
+	FileResource&		operator=			(const FileResource& other);
+
+	FILE*				m_file;				//!< Null if file is mapped.
+	const deUint8*		m_mappedData;
+	int					m_mappedSize;
+	int					m_mappedPosition;
+	deInt64				m_modificationTime;
 };
 
 class ResourcePrefix : public Archive
@@ -136,6 +153,8 @@ private:
 	std::string					m_prefix;
 };
 
+void FileResource_selfTest (void);
+
 } // tcu
 
 #endif // _TCURESOURCE_HPP
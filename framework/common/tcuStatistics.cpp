@@ -0,0 +1,572 @@
+/*-------------------------------------------------------------------------
+ * drawElements Quality Program Tester Core
+ * ----------------------------------------
+ *
+ * Copyright 2019 The Android Open Source Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ *//*!
+ * \file
+ * \brief Robust statistics for performance measurements.
+ *//*--------------------------------------------------------------------*/
+
+#include "tcuStatistics.hpp"
+#include "deRandom.hpp"
+
+#include <cmath>
+
+namespace tcu
+{
+
+using std::vector;
+
+namespace
+{
+
+//! Inverse of the standard normal distribution function, absolute error below 4.5e-4 (Abramowitz & Stegun 26.2.23).
+double normalQuantile (double p)
+{
+	DE_ASSERT(p > 0.0 && p < 1.0);
+
+	const double	q	= (p < 0.5) ? p : 1.0 - p;
+	const double	t	= std::sqrt(-2.0 * std::log(q));
+	const double	x	= t - (2.515517 + t * (0.802853 + t * 0.010328)) / (1.0 + t * (1.432788 + t * (0.189269 + t * 0.001308)));
+
+	return (p < 0.5) ? -x : x;
+}
+
+//! Ranks [lower, upper] of order statistics covering given two-sided confidence, for n samples with standard deviation of rank stdDev.
+void getConfidenceRanks (deInt64 numValues, double stdDev, float confidence, deInt64& lowerRank, deInt64& upperRank)
+{
+	DE_ASSERT(numValues > 0);
+	DE_ASSERT(confidence > 0.0f && confidence < 1.0f);
+
+	const double halfWidth = normalQuantile(0.5 + 0.5 * (double)confidence) * stdDev;
+
+	lowerRank	= de::clamp((deInt64)std::floor(0.5 * (double)numValues - halfWidth) - 1, (deInt64)0, numValues - 1);
+	upperRank	= de::clamp((deInt64)std::ceil(0.5 * (double)numValues + halfWidth), (deInt64)0, numValues - 1);
+}
+
+struct SlopePoint
+{
+	double	x;
+	double	y;
+
+	SlopePoint (double x_, double y_) : x(x_), y(y_) {}
+};
+
+// Ascending x, points with equal x in descending y
+bool slopeOrderLess (const SlopePoint& a, const SlopePoint& b)
+{
+	return a.x < b.x || (a.x == b.x && a.y > b.y);
+}
+
+double getSlope (const SlopePoint& a, const SlopePoint& b)
+{
+	return (b.y - a.y) / (b.x - a.x);
+}
+
+struct SlopeKey
+{
+	double	lower;
+	double	upper;
+	int		pointNdx;
+};
+
+bool lowerKeyLess (const SlopeKey& a, const SlopeKey& b)
+{
+	return a.lower < b.lower;
+}
+
+class PairwiseSlopes
+{
+public:
+								PairwiseSlopes		(const vector<Vec2>& points);
+
+	deInt64						getNumSlopes		(void) const { return m_numSlopes; }
+	double						select				(deInt64 rank);
+
+private:
+	deInt64						countAtMost			(double slope);
+	void						listInRange			(double lower, double upper, vector<double>& dst);
+	void						listInversions		(int begin, int end, vector<double>& dst);
+
+	vector<SlopePoint>			m_points;			//!< In slopeOrderLess order
+	deInt64						m_numSlopes;
+	deInt64						m_numEqualXPairs;
+	double						m_minSlope;
+	double						m_maxSlope;
+
+	vector<double>				m_keys;
+	vector<double>				m_scratch;
+	vector<SlopeKey>			m_listKeys;
+	vector<SlopeKey>			m_listScratch;
+};
+
+PairwiseSlopes::PairwiseSlopes (const vector<Vec2>& points)
+	: m_numSlopes		(0)
+	, m_numEqualXPairs	(0)
+	, m_minSlope		(0.0)
+	, m_maxSlope		(0.0)
+{
+	m_points.reserve(points.size());
+	for (size_t ndx = 0; ndx < points.size(); ndx++)
+		m_points.push_back(SlopePoint(points[ndx].x(), points[ndx].y()));
+
+	std::sort(m_points.begin(), m_points.end(), slopeOrderLess);
+
+	// Count pairs and find slope range. Extreme slopes are always between points in adjacent x groups.
+	{
+		const int	numPoints		= (int)m_points.size();
+		int			prevGroupStart	= -1;
+		int			groupStart		= 0;
+		bool		haveSlopes		= false;
+
+		while (groupStart < numPoints)
+		{
+			int groupEnd = groupStart + 1;
+
+			while (groupEnd < numPoints && m_points[groupEnd].x == m_points[groupStart].x)
+				groupEnd++;
+
+			m_numEqualXPairs += (deInt64)(groupEnd - groupStart) * (deInt64)(groupEnd - groupStart - 1) / 2;
+
+			if (prevGroupStart >= 0)
+			{
+				// Groups are in descending y, first point has maximum and last point minimum y
+				const double	minSlope	= getSlope(m_points[prevGroupStart], m_points[groupEnd-1]);
+				const double	maxSlope	= getSlope(m_points[groupStart-1], m_points[groupStart]);
+
+				m_minSlope	= haveSlopes ? de::min(m_minSlope, minSlope) : minSlope;
+				m_maxSlope	= haveSlopes ? de::max(m_maxSlope, maxSlope) : maxSlope;
+				haveSlopes	= true;
+			}
+
+			prevGroupStart	= groupStart;
+			groupStart		= groupEnd;
+		}
+
+		m_numSlopes = (deInt64)numPoints * (deInt64)(numPoints - 1) / 2 - m_numEqualXPairs;
+	}
+}
+
+// Number of pairs i < j with key[j] <= key[i], where key = y - slope*x. Equal x pairs are always counted and subtracted.
+deInt64 PairwiseSlopes::countAtMost (double slope)
+{
+	const int	numPoints	= (int)m_points.size();
+	deInt64		numPairs	= 0;
+
+	m_keys.resize(numPoints);
+	m_scratch.resize(numPoints);
+
+	for (int ndx = 0; ndx < numPoints; ndx++)
+		m_keys[ndx] = m_points[ndx].y - slope * m_points[ndx].x;
+
+	// Bottom-up merge sort
+	for (int width = 1; width < numPoints; width *= 2)
+	{
+		for (int begin = 0; begin < numPoints; begin += 2*width)
+		{
+			const int	mid		= de::min(begin + width, numPoints);
+			const int	end		= de::min(begin + 2*width, numPoints);
+			int			left	= begin;
+			int			right	= mid;
+			int			dst		= begin;
+
+			while (left < mid && right < end)
+			{
+				if (m_keys[left] < m_keys[right])
+					m_scratch[dst++] = m_keys[left++];
+				else
+				{
+					numPairs += mid - left;
+					m_scratch[dst++] = m_keys[right++];
+				}
+			}
+
+			while (left < mid)
+				m_scratch[dst++] = m_keys[left++];
+			while (right < end)
+				m_scratch[dst++] = m_keys[right++];
+		}
+
+		m_keys.swap(m_scratch);
+	}
+
+	return numPairs - m_numEqualXPairs;
+}
+
+// List slopes counted by countAtMost(upper) but not by countAtMost(lower)
+void PairwiseSlopes::listInRange (double lower, double upper, vector<double>& dst)
+{
+	const int numPoints = (int)m_points.size();
+
+	m_listKeys.resize(numPoints);
+	m_listScratch.resize(numPoints);
+
+	for (int ndx = 0; ndx < numPoints; ndx++)
+	{
+		m_listKeys[ndx].lower		= m_points[ndx].y - lower * m_points[ndx].x;
+		m_listKeys[ndx].upper		= m_points[ndx].y - upper * m_points[ndx].x;
+		m_listKeys[ndx].pointNdx	= ndx;
+	}
+
+	// Pairs in range are ordered by lower key and inverted by upper key
+	std::stable_sort(m_listKeys.begin(), m_listKeys.end(), lowerKeyLess);
+	listInversions(0, numPoints, dst);
+}
+
+void PairwiseSlopes::listInversions (int begin, int end, vector<double>& dst)
+{
+	if (end - begin < 2)
+		return;
+
+	const int	mid		= (begin + end) / 2;
+	int			left	= begin;
+	int			right	= mid;
+	int			out		= begin;
+
+	listInversions(begin, mid, dst);
+	listInversions(mid, end, dst);
+
+	while (left < mid && right < end)
+	{
+		if (m_listKeys[left].upper < m_listKeys[right].upper)
+			m_listScratch[out++] = m_listKeys[left++];
+		else
+		{
+			const SlopeKey& b = m_listKeys[right];
+
+			// Candidates may include pairs with equal keys, filter them with exact conditions
+			for (int ndx = left; ndx < mid; ndx++)
+			{
+				const SlopeKey& a = m_listKeys[ndx];
+
+				if (a.pointNdx < b.pointNdx && a.lower < b.lower && m_points[a.pointNdx].x != m_points[b.pointNdx].x)
+					dst.push_back(getSlope(m_points[a.pointNdx], m_points[b.pointNdx]));
+			}
+
+			m_listScratch[out++] = m_listKeys[right++];
+		}
+	}
+
+	while (left < mid)
+		m_listScratch[out++] = m_listKeys[left++];
+	while (right < end)
+		m_listScratch[out++] = m_listKeys[right++];
+
+	std::copy(m_listScratch.begin() + begin, m_listScratch.begin() + end, m_listKeys.begin() + begin);
+}
+
+double PairwiseSlopes::select (deInt64 rank)
+{
+	DE_ASSERT(de::inBounds(rank, (deInt64)0, m_numSlopes));
+
+	const int		numPoints		= (int)m_points.size();
+	const deInt64	maxListed		= 4 * (deInt64)numPoints + 64;
+	const int		minSampleSize	= 16;
+	de::Random		rnd				(0x1f4a7c15u ^ (deUint32)numPoints);
+
+	// Search interval (lower, upper]. Counts are computed rather than assumed to be consistent with rounding.
+	double			lower			= m_minSlope - 1.0 - de::abs(m_minSlope);
+	double			upper			= m_maxSlope + 1.0 + de::abs(m_maxSlope);
+	deInt64			numAtMostLower	= 0;
+	deInt64			numAtMostUpper	= m_numSlopes;
+	vector<double>	samples;
+
+	if (m_numSlopes > maxListed)
+	{
+		numAtMostLower	= countAtMost(lower);
+		numAtMostUpper	= countAtMost(upper);
+	}
+
+	for (;;)
+	{
+		const deInt64 numInRange = numAtMostUpper - numAtMostLower;
+
+		if (numInRange <= maxListed)
+			break;
+
+		// Sample slopes in range. Sample size is chosen so that expected number of draws is about n.
+		{
+			const int	sampleSize	= de::clamp((int)((double)numPoints * (double)numInRange / (double)m_numSlopes), minSampleSize, numPoints);
+			const int	maxDraws	= 8 * numPoints + 16 * sampleSize;
+
+			samples.clear();
+
+			for (int drawNdx = 0; drawNdx < maxDraws && (int)samples.size() < sampleSize; drawNdx++)
+			{
+				const int	a	= rnd.getInt(0, numPoints-1);
+				const int	b	= rnd.getInt(0, numPoints-1);
+
+				if (m_points[a].x < m_points[b].x)
+				{
+					const double slope = getSlope(m_points[a], m_points[b]);
+
+					if (lower < slope && slope <= upper)
+						samples.push_back(slope);
+				}
+			}
+		}
+
+		if (samples.size() < 2)
+			break;
+
+		std::sort(samples.begin(), samples.end());
+
+		// Choose pivots around expected location of rank in the sample, with margin of two standard deviations
+		{
+			const int		sampleSize		= (int)samples.size();
+			const double	position		= ((double)(rank - numAtMostLower) + 0.5) / (double)numInRange * (double)sampleSize;
+			const double	margin			= 2.0 * std::sqrt((double)sampleSize) + 1.0;
+			const int		lowerPivotNdx	= (int)std::floor(position - margin);
+			const int		upperPivotNdx	= (int)std::ceil(position + margin);
+			const double	lowerPivot		= (lowerPivotNdx >= 0) ? samples[lowerPivotNdx] : lower;
+			const double	upperPivot		= (upperPivotNdx < sampleSize) ? samples[upperPivotNdx] : upper;
+			const deInt64	numAtMostLowerPivot	= (lowerPivotNdx >= 0) ? countAtMost(lowerPivot) : numAtMostLower;
+			const deInt64	numAtMostUpperPivot	= (upperPivotNdx < sampleSize) ? countAtMost(upperPivot) : numAtMostUpper;
+
+			if (rank < numAtMostLowerPivot)
+			{
+				upper			= lowerPivot;
+				numAtMostUpper	= numAtMostLowerPivot;
+			}
+			else if (rank < numAtMostUpperPivot)
+			{
+				lower			= lowerPivot;
+				numAtMostLower	= numAtMostLowerPivot;
+				upper			= upperPivot;
+				numAtMostUpper	= numAtMostUpperPivot;
+			}
+			else
+			{
+				lower			= upperPivot;
+				numAtMostLower	= numAtMostUpperPivot;
+			}
+		}
+
+		// Rounding may make counts slightly inconsistent, stop narrowing if there is no progress
+		if (numAtMostUpper - numAtMostLower >= numInRange)
+			break;
+	}
+
+	{
+		vector<double> slopes;
+
+		if (m_numSlopes <= maxListed)
+		{
+			// Few slopes, enumerate directly
+			for (int i = 0; i < numPoints; i++)
+			for (int j = i+1; j < numPoints; j++)
+			{
+				if (m_points[i].x != m_points[j].x)
+					slopes.push_back(getSlope(m_points[i], m_points[j]));
+			}
+		}
+		else
+			listInRange(lower, upper, slopes);
+
+		DE_ASSERT(!slopes.empty());
+
+		const deInt64							ndx	= de::clamp(rank - numAtMostLower, (deInt64)0, (deInt64)slopes.size() - 1);
+		const vector<double>::iterator			nth	= slopes.begin() + (size_t)ndx;
+
+		std::nth_element(slopes.begin(), nth, slopes.end());
+
+		return *nth;
+	}
+}
+
+} // anonymous
+
+ConfidenceInterval medianConfidenceInterval (const vector<float>& values, float confidence)
+{
+	DE_ASSERT(!values.empty());
+
+	vector<float>	sorted		= values;
+	deInt64			lowerRank;
+	deInt64			upperRank;
+
+	std::sort(sorted.begin(), sorted.end());
+
+	// Rank of the median among n samples is binomial with standard deviation sqrt(n)/2
+	getConfidenceRanks((deInt64)sorted.size(), 0.5 * std::sqrt((double)sorted.size()), confidence, lowerRank, upperRank);
+
+	return ConfidenceInterval(sorted[(size_t)lowerRank], sorted[(size_t)upperRank]);
+}
+
+ConfidenceInterval bootstrapMedianConfidenceInterval (const vector<float>& values, float confidence, int numResamples, deUint32 seed)
+{
+	DE_ASSERT(!values.empty());
+	DE_ASSERT(numResamples > 0);
+	DE_ASSERT(confidence >= 0.0f && confidence <= 1.0f);
+
+	const int		numValues	= (int)values.size();
+	de::Random		rnd			(seed);
+	vector<float>	resample	(numValues);
+	vector<float>	medians		(numResamples);
+
+	for (int resampleNdx = 0; resampleNdx < numResamples; resampleNdx++)
+	{
+		for (int ndx = 0; ndx < numValues; ndx++)
+			resample[ndx] = values[rnd.getInt(0, numValues-1)];
+
+		medians[resampleNdx] = destructiveMedian(resample);
+	}
+
+	std::sort(medians.begin(), medians.end());
+
+	return ConfidenceInterval(linearSample(medians, 0.5f - 0.5f*confidence), linearSample(medians, 0.5f + 0.5f*confidence));
+}
+
+deInt64 countPairwiseSlopes (const vector<Vec2>& points)
+{
+	return PairwiseSlopes(points).getNumSlopes();
+}
+
+float selectPairwiseSlope (const vector<Vec2>& points, deInt64 rank)
+{
+	PairwiseSlopes slopes (points);
+
+	DE_ASSERT(de::inBounds(rank, (deInt64)0, slopes.getNumSlopes()));
+
+	return (float)slopes.select(rank);
+}
+
+float medianPairwiseSlope (const vector<Vec2>& points)
+{
+	PairwiseSlopes	slopes		(points);
+	const deInt64	numSlopes	= slopes.getNumSlopes();
+
+	DE_ASSERT(numSlopes > 0);
+
+	if (numSlopes % 2 == 0)
+		return (float)((slopes.select(numSlopes/2 - 1) + slopes.select(numSlopes/2)) * 0.5);
+	else
+		return (float)slopes.select(numSlopes/2);
+}
+
+ConfidenceInterval medianPairwiseSlopeConfidenceInterval (const vector<Vec2>& points, float confidence)
+{
+	PairwiseSlopes	slopes		(points);
+	const deInt64	numSlopes	= slopes.getNumSlopes();
+	const double	numPoints	= (double)points.size();
+	deInt64			lowerRank;
+	deInt64			upperRank;
+
+	DE_ASSERT(numSlopes > 0);
+
+	// Variance of Kendall's S statistic without tie correction
+	getConfidenceRanks(numSlopes, 0.5 * std::sqrt(numPoints * (numPoints - 1.0) * (2.0 * numPoints + 5.0) / 18.0), confidence, lowerRank, upperRank);
+
+	return ConfidenceInterval((float)slopes.select(lowerRank), (float)slopes.select(upperRank));
+}
+
+// Reference implementation
+static float medianPairwiseSlopeBruteForce (const vector<Vec2>& points)
+{
+	vector<float> slopes;
+
+	for (size_t i = 0; i < points.size(); i++)
+	for (size_t j = 0; j < i; j++)
+	{
+		if (points[i].x() != points[j].x())
+			slopes.push_back((float)(((double)points[i].y() - (double)points[j].y()) / ((double)points[i].x() - (double)points[j].x())));
+	}
+
+	return destructiveMedian(slopes);
+}
+
+void Statistics_selfTest (void)
+{
+	// Order statistics
+	{
+		const float			valueData[]	= { 5.0f, 1.0f, 4.0f, 2.0f, 100.0f, 3.0f };
+		vector<float>		values		(DE_ARRAY_BEGIN(valueData), DE_ARRAY_END(valueData));
+		vector<float>		sorted		= values;
+
+		std::sort(sorted.begin(), sorted.end());
+
+		DE_TEST_ASSERT(median(values) == 3.5f);
+		DE_TEST_ASSERT(median(vector<float>(values.begin(), values.end()-1)) == 4.0f);
+		DE_TEST_ASSERT(medianAbsoluteDeviation(values) == 1.5f);
+		DE_TEST_ASSERT(linearSample(sorted, 0.0f) == 1.0f);
+		DE_TEST_ASSERT(linearSample(sorted, 1.0f) == 100.0f);
+		DE_TEST_ASSERT(linearSample(sorted, 0.5f) == 3.5f);
+	}
+
+	// Confidence intervals contain the median and widen with confidence
+	{
+		de::Random		rnd		(0x1234);
+		vector<float>	values	(201);
+
+		for (size_t ndx = 0; ndx < values.size(); ndx++)
+			values[ndx] = rnd.getFloat(0.0f, 10.0f) + rnd.getFloat(0.0f, 10.0f);
+
+		{
+			const float					center		= median(values);
+			const ConfidenceInterval	narrow		= medianConfidenceInterval(values, 0.5f);
+			const ConfidenceInterval	wide		= medianConfidenceInterval(values, 0.95f);
+			const ConfidenceInterval	bootstrap	= bootstrapMedianConfidenceInterval(values, 0.95f, 200, 1);
+
+			DE_TEST_ASSERT(narrow.lower < center && center < narrow.upper);
+			DE_TEST_ASSERT(wide.lower < narrow.lower && narrow.upper < wide.upper);
+			DE_TEST_ASSERT(bootstrap.lower < center && center < bootstrap.upper);
+			DE_TEST_ASSERT(wide.lower > 7.0f && wide.upper < 13.0f);
+		}
+	}
+
+	// Pairwise slopes
+	{
+		const Vec2		pointData[]	= { Vec2(0.0f, 1.0f), Vec2(1.0f, 3.0f), Vec2(1.0f, 2.0f), Vec2(2.0f, 5.0f), Vec2(4.0f, 1.0f) };
+		vector<Vec2>	points		(DE_ARRAY_BEGIN(pointData), DE_ARRAY_END(pointData));
+
+		// Slopes: 2 1 2 0 | 2 -0.667 | 3 -0.333 | -2
+		DE_TEST_ASSERT(countPairwiseSlopes(points) == 9);
+		DE_TEST_ASSERT(selectPairwiseSlope(points, 0) == -2.0f);
+		DE_TEST_ASSERT(selectPairwiseSlope(points, 3) == 0.0f);
+		DE_TEST_ASSERT(selectPairwiseSlope(points, 8) == 3.0f);
+		DE_TEST_ASSERT(medianPairwiseSlope(points) == 1.0f);
+
+		points.push_back(Vec2(3.0f, 3.0f));
+		DE_TEST_ASSERT(de::abs(medianPairwiseSlope(points) - medianPairwiseSlopeBruteForce(points)) < 1e-6f);
+
+		DE_TEST_ASSERT(countPairwiseSlopes(vector<Vec2>(3, Vec2(1.0f, 1.0f))) == 0);
+	}
+
+	// Large noisy data with outliers and duplicate x coordinates
+	{
+		de::Random		rnd		(0x5678);
+		vector<Vec2>	points;
+
+		for (int ndx = 0; ndx < 600; ndx++)
+		{
+			const float x = (float)rnd.getInt(0, 200);
+			const float y = (rnd.getInt(0, 9) == 0) ? rnd.getFloat(0.0f, 1000.0f) : 3.0f*x + 10.0f + rnd.getFloat(-5.0f, 5.0f);
+
+			points.push_back(Vec2(x, y));
+		}
+
+		{
+			const float					slope		= medianPairwiseSlope(points);
+			const ConfidenceInterval	interval	= medianPairwiseSlopeConfidenceInterval(points, 0.95f);
+
+			DE_TEST_ASSERT(de::abs(slope - medianPairwiseSlopeBruteForce(points)) < 1e-6f);
+			DE_TEST_ASSERT(interval.lower <= slope && slope <= interval.upper);
+			DE_TEST_ASSERT(interval.lower > 2.9f && interval.upper < 3.1f);
+		}
+	}
+}
+
+} // tcu
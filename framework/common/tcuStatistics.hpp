@@ -0,0 +1,135 @@
+#ifndef _TCUSTATISTICS_HPP
+#define _TCUSTATISTICS_HPP
+/*-------------------------------------------------------------------------
+ * drawElements Quality Program Tester Core
+ * ----------------------------------------
+ *
+ * Copyright 2019 The Android Open Source Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ *//*!
+ * \file
+ * \brief Robust statistics for performance measurements.
+ *//*--------------------------------------------------------------------*/
+
+#include "tcuDefs.hpp"
+#include "tcuVector.hpp"
+#include "deMath.h"
+
+#include <vector>
+#include <algorithm>
+
+namespace tcu
+{
+
+struct ConfidenceInterval
+{
+	float	lower;
+	float	upper;
+
+	ConfidenceInterval (float lower_, float upper_) : lower(lower_), upper(upper_) {}
+};
+
+/*--------------------------------------------------------------------*//*!
+ * \brief Sample sorted values at position in range [0, 1]
+ *
+ * Values are treated as if laid evenly to range [0, 1] and sample is
+ * linearly interpolated between the two nearest values.
+ *//*--------------------------------------------------------------------*/
+template <typename T>
+float linearSample (const std::vector<T>& sortedValues, float position)
+{
+	DE_ASSERT(!sortedValues.empty());
+	DE_ASSERT(position >= 0.0f);
+	DE_ASSERT(position <= 1.0f);
+
+	const int	maxNdx				= (int)sortedValues.size() - 1;
+	const float	floatNdx			= (float)maxNdx * position;
+	const int	lowerNdx			= de::min((int)deFloatFloor(floatNdx), maxNdx);
+	const int	higherNdx			= lowerNdx + (lowerNdx == maxNdx ? 0 : 1); // Use only last element if position is 1.0
+	const float	interpolationFactor = floatNdx - (float)lowerNdx;
+
+	return (1.0f - interpolationFactor) * (float)sortedValues[lowerNdx] + interpolationFactor * (float)sortedValues[higherNdx];
+}
+
+//! Median of values. Reorders values, linear complexity. Average of the two centermost values if there are even number of values.
+template <typename T>
+float destructiveMedian (std::vector<T>& values)
+{
+	DE_ASSERT(!values.empty());
+
+	const typename std::vector<T>::iterator mid = values.begin() + values.size()/2;
+
+	std::nth_element(values.begin(), mid, values.end());
+
+	if (values.size() % 2 == 0)
+		return ((float)*mid + (float)*std::max_element(values.begin(), mid)) * 0.5f; // Values are partially sorted around mid
+	else
+		return (float)*mid;
+}
+
+template <typename T>
+float median (const std::vector<T>& values)
+{
+	std::vector<T> copy = values;
+	return destructiveMedian(copy);
+}
+
+//! Median absolute deviation from the median. Unscaled; multiply by 1.4826 for a standard deviation estimate of normal data.
+template <typename T>
+float medianAbsoluteDeviation (const std::vector<T>& values)
+{
+	const float			center		= median(values);
+	std::vector<float>	deviations	(values.size());
+
+	for (size_t ndx = 0; ndx < values.size(); ndx++)
+		deviations[ndx] = de::abs((float)values[ndx] - center);
+
+	return destructiveMedian(deviations);
+}
+
+//! Distribution-free confidence interval of the median, given by order statistics of values.
+ConfidenceInterval	medianConfidenceInterval			(const std::vector<float>& values, float confidence);
+
+//! Percentile bootstrap confidence interval of the median. Deterministic for a given seed.
+ConfidenceInterval	bootstrapMedianConfidenceInterval	(const std::vector<float>& values, float confidence, int numResamples, deUint32 seed);
+
+/*--------------------------------------------------------------------*//*!
+ * \brief Slopes of lines through pairs of points
+ *
+ * Slopes are defined for all pairs of points with differing x
+ * coordinates. Slopes are selected by rank without enumerating all pairs:
+ * number of slopes below a given value is the number of inversions
+ * between x order and (y - value*x) order of the points, which is counted
+ * with a merge sort. The search interval is narrowed with pivots taken
+ * from a random sample of slopes inside it, and the few slopes left are
+ * enumerated. Expected complexity is O(n log n) per narrowing round and
+ * the number of rounds grows very slowly with n.
+ *//*--------------------------------------------------------------------*/
+deInt64				countPairwiseSlopes					(const std::vector<Vec2>& points);
+
+//! Slope with given rank (0-based) in the ascending order of all pairwise slopes.
+float				selectPairwiseSlope					(const std::vector<Vec2>& points, deInt64 rank);
+
+//! Median of pairwise slopes, i.e. Theil-Sen slope estimate. There must be at least one pair with differing x coordinates.
+float				medianPairwiseSlope					(const std::vector<Vec2>& points);
+
+//! Confidence interval of the Theil-Sen slope estimate, computed from ranks of pairwise slopes (Sen 1968).
+ConfidenceInterval	medianPairwiseSlopeConfidenceInterval	(const std::vector<Vec2>& points, float confidence);
+
+void				Statistics_selfTest					(void);
+
+} // tcu
+
+#endif // _TCUSTATISTICS_HPP
@@ -24,11 +24,9 @@
 #include "tcuStringTemplate.hpp"
 #include "tcuDefs.hpp"
 
-#include <sstream>
-
 using std::string;
 using std::map;
-using std::ostringstream;
+using std::vector;
 
 namespace tcu
 {
@@ -49,82 +47,314 @@ StringTemplate::~StringTemplate (void)
 void StringTemplate::setString (const std::string& str)
 {
 	m_template = str;
-}
-
-string StringTemplate::specialize (const map<string, string>& params) const
-{
-	ostringstream res;
+	m_segments.clear();
+	m_paramNames.clear();
+	m_paramOptional.clear();
+	m_error.clear();
 
 	size_t curNdx = 0;
 	for (;;)
 	{
-		size_t paramNdx = m_template.find("${", curNdx);
-		if (paramNdx != string::npos)
+		const size_t paramNdx = m_template.find("${", curNdx);
+
+		// Literal up to the parameter or end of string.
+		{
+			const size_t literalEnd = (paramNdx != string::npos) ? paramNdx : m_template.length();
+
+			if (literalEnd > curNdx)
+			{
+				const Segment segment = { SEGMENTTYPE_LITERAL, curNdx, literalEnd - curNdx, -1 };
+				m_segments.push_back(segment);
+			}
+		}
+
+		if (paramNdx == string::npos)
+			break;
+
+		// Find end-of-param.
+		const size_t paramEndNdx = m_template.find("}", paramNdx);
+		if (paramEndNdx == string::npos)
 		{
-			// Append in-between stuff.
-			res << m_template.substr(curNdx, paramNdx - curNdx);
-
-			// Find end-of-param.
-			size_t paramEndNdx = m_template.find("}", paramNdx);
-			if (paramEndNdx == string::npos)
-				TCU_THROW(InternalError, "No '}' found in template parameter");
-
-			// Parse parameter contents.
-			string	paramStr		= m_template.substr(paramNdx+2, paramEndNdx-2-paramNdx);
-			bool	paramSingleLine	= false;
-			bool	paramOptional	= false;
-			string	paramName;
-			size_t colonNdx = paramStr.find(":");
+			m_error = "No '}' found in template parameter";
+			break;
+		}
+
+		// Parse parameter contents.
+		{
+			const string	paramStr	= m_template.substr(paramNdx+2, paramEndNdx-2-paramNdx);
+			const size_t	colonNdx	= paramStr.find(":");
+			const string	paramName	= paramStr.substr(0, colonNdx);
+			SegmentType		type		= SEGMENTTYPE_PARAM;
+			bool			optional	= false;
+
 			if (colonNdx != string::npos)
 			{
-				paramName = paramStr.substr(0, colonNdx);
-				string flagsStr = paramStr.substr(colonNdx+1);
+				const string flagsStr = paramStr.substr(colonNdx+1);
+
 				if (flagsStr == "single-line")
-				{
-					paramSingleLine = true;
-				}
+					type = SEGMENTTYPE_PARAM_SINGLE_LINE;
 				else if (flagsStr == "opt")
-				{
-					paramOptional = true;
-				}
+					optional = true;
 				else
 				{
-					TCU_THROW(InternalError, (string("Unrecognized flag") + paramStr).c_str());
+					m_error = string("Unrecognized flag") + paramStr;
+					break;
 				}
 			}
-			else
-				paramName = paramStr;
 
-			// Fill in parameter value.
-			if (params.find(paramName) != params.end())
+			int slotNdx = getParamIndex(paramName);
+
+			if (slotNdx < 0)
 			{
-				const string& val = (*params.find(paramName)).second;
-				if (paramSingleLine)
-				{
-					string tmp = val;
-					for (size_t ndx = tmp.find("\n"); ndx != string::npos; ndx = tmp.find("\n"))
-						tmp = tmp.replace(ndx, 1, " ");
-					res << tmp;
-				}
-				else
-					res << val;
+				slotNdx = (int)m_paramNames.size();
+				m_paramNames.push_back(paramName);
+				m_paramOptional.push_back(optional);
 			}
-			else if (!paramOptional)
-				TCU_THROW(InternalError, (string("Value for parameter '") + paramName + "' not found in map").c_str());
+			else if (!optional)
+				m_paramOptional[slotNdx] = false;
 
-			// Skip over template.
-			curNdx = paramEndNdx + 1;
+			{
+				const Segment segment = { type, 0, 0, slotNdx };
+				m_segments.push_back(segment);
+			}
 		}
+
+		// Skip over template.
+		curNdx = paramEndNdx + 1;
+	}
+}
+
+int StringTemplate::getParamIndex (const std::string& name) const
+{
+	for (size_t ndx = 0; ndx < m_paramNames.size(); ndx++)
+	{
+		if (m_paramNames[ndx] == name)
+			return (int)ndx;
+	}
+
+	return -1;
+}
+
+void StringTemplate::checkValid (void) const
+{
+	if (!m_error.empty())
+		TCU_THROW(InternalError, m_error.c_str());
+}
+
+void StringTemplate::resolveParams (const ParamMap& params, vector<const string*>& values) const
+{
+	values.resize(m_paramNames.size());
+
+	for (size_t slotNdx = 0; slotNdx < m_paramNames.size(); slotNdx++)
+	{
+		const ParamMap::const_iterator iter = params.find(m_paramNames[slotNdx]);
+
+		if (iter != params.end())
+			values[slotNdx] = &iter->second;
+		else if (m_paramOptional[slotNdx])
+			values[slotNdx] = DE_NULL;
 		else
+			TCU_THROW(InternalError, (string("Value for parameter '") + m_paramNames[slotNdx] + "' not found in map").c_str());
+	}
+}
+
+string StringTemplate::specializeValues (const string* const* values) const
+{
+	size_t	resultLength	= 0;
+	string	result;
+
+	for (vector<Segment>::const_iterator segment = m_segments.begin(); segment != m_segments.end(); ++segment)
+	{
+		if (segment->type == SEGMENTTYPE_LITERAL)
+			resultLength += segment->length;
+		else if (values[segment->paramNdx])
+			resultLength += values[segment->paramNdx]->length();
+	}
+
+	result.reserve(resultLength);
+
+	for (vector<Segment>::const_iterator segment = m_segments.begin(); segment != m_segments.end(); ++segment)
+	{
+		if (segment->type == SEGMENTTYPE_LITERAL)
+			result.append(m_template, segment->offset, segment->length);
+		else if (values[segment->paramNdx])
 		{
-			if (curNdx < m_template.length())
-				res << &m_template[curNdx];
+			const size_t start = result.length();
 
-			break;
+			result.append(*values[segment->paramNdx]);
+
+			if (segment->type == SEGMENTTYPE_PARAM_SINGLE_LINE)
+			{
+				for (size_t ndx = result.find('\n', start); ndx != string::npos; ndx = result.find('\n', ndx + 1))
+					result[ndx] = ' ';
+			}
+		}
+	}
+
+	DE_ASSERT(result.length() == resultLength);
+
+	return result;
+}
+
+string StringTemplate::specialize (const ParamMap& params) const
+{
+	vector<const string*> values;
+
+	checkValid();
+	resolveParams(params, values);
+
+	return specializeValues(values.empty() ? DE_NULL : &values[0]);
+}
+
+string StringTemplate::specialize (const vector<string>& values) const
+{
+	vector<const string*> valuePtrs (m_paramNames.size());
+
+	checkValid();
+
+	if (values.size() != m_paramNames.size())
+		TCU_THROW(InternalError, "Wrong number of template parameter values");
+
+	for (size_t slotNdx = 0; slotNdx < values.size(); slotNdx++)
+		valuePtrs[slotNdx] = &values[slotNdx];
+
+	return specializeValues(valuePtrs.empty() ? DE_NULL : &valuePtrs[0]);
+}
+
+vector<string> StringTemplate::specializeAll (const vector<ParamMap>& paramSets) const
+{
+	vector<string>			results	(paramSets.size());
+	vector<const string*>	values;
+
+	checkValid();
+
+	for (size_t setNdx = 0; setNdx < paramSets.size(); setNdx++)
+	{
+		resolveParams(paramSets[setNdx], values);
+		results[setNdx] = specializeValues(values.empty() ? DE_NULL : &values[0]);
+	}
+
+	return results;
+}
+
+// Self-test
+
+namespace
+{
+
+bool throwsInternalError (const StringTemplate& tmpl, const StringTemplate::ParamMap& params)
+{
+	try
+	{
+		tmpl.specialize(params);
+	}
+	catch (const InternalError&)
+	{
+		return true;
+	}
+
+	return false;
+}
+
+} // anonymous
+
+void StringTemplate_selfTest (void)
+{
+	StringTemplate::ParamMap params;
+
+	params["A"]		= "a";
+	params["LONG"]	= "first\nsecond\nthird";
+	params["EMPTY"]	= "";
+
+	{
+		const StringTemplate tmpl ("");
+		DE_TEST_ASSERT(tmpl.specialize(params) == "");
+		DE_TEST_ASSERT(tmpl.getNumParams() == 0);
+	}
+
+	{
+		const StringTemplate tmpl ("no params $ { } $");
+		DE_TEST_ASSERT(tmpl.specialize(params) == "no params $ { } $");
+	}
+
+	{
+		const StringTemplate tmpl ("${A}${A}-${EMPTY}-${A}x");
+		DE_TEST_ASSERT(tmpl.specialize(params) == "aa--ax");
+		DE_TEST_ASSERT(tmpl.getNumParams() == 2);
+		DE_TEST_ASSERT(tmpl.getParamIndex("A") == 0);
+		DE_TEST_ASSERT(tmpl.getParamIndex("EMPTY") == 1);
+		DE_TEST_ASSERT(tmpl.getParamIndex("LONG") == -1);
+	}
+
+	{
+		const StringTemplate tmpl ("<${LONG:single-line}> <${LONG}>");
+		DE_TEST_ASSERT(tmpl.specialize(params) == "<first second third> <first\nsecond\nthird>");
+	}
+
+	{
+		const StringTemplate tmpl ("[${MISSING:opt}${A:opt}]");
+		DE_TEST_ASSERT(tmpl.specialize(params) == "[a]");
+	}
+
+	// Optional and required uses of the same parameter
+	{
+		const StringTemplate tmpl ("${B:opt}${B}");
+		DE_TEST_ASSERT(throwsInternalError(tmpl, params));
+	}
+
+	DE_TEST_ASSERT(throwsInternalError(StringTemplate("${MISSING}"), params));
+	DE_TEST_ASSERT(throwsInternalError(StringTemplate("abc ${A"), params));
+	DE_TEST_ASSERT(throwsInternalError(StringTemplate("${A:bad-flag}"), params));
+
+	// Indexed values
+	{
+		const StringTemplate	tmpl	("${X} + ${Y:single-line} = ${X}${Z:opt}");
+		vector<string>			values	(3);
+
+		values[tmpl.getParamIndex("X")]	= "1";
+		values[tmpl.getParamIndex("Y")]	= "2\n";
+
+		DE_TEST_ASSERT(tmpl.specialize(values) == "1 + 2  = 1");
+
+		values.pop_back();
+		DE_TEST_ASSERT(tmpl.getNumParams() == 3);
+
+		try
+		{
+			tmpl.specialize(values);
+			DE_TEST_ASSERT(false);
+		}
+		catch (const InternalError&)
+		{
 		}
 	}
 
-	return res.str();
+	// Batch
+	{
+		const StringTemplate				tmpl		("v${N};");
+		vector<StringTemplate::ParamMap>	paramSets	(3);
+
+		paramSets[0]["N"] = "0";
+		paramSets[1]["N"] = "11";
+		paramSets[2]["N"] = "222";
+
+		{
+			const vector<string> results = tmpl.specializeAll(paramSets);
+
+			DE_TEST_ASSERT(results.size() == 3);
+			DE_TEST_ASSERT(results[0] == "v0;");
+			DE_TEST_ASSERT(results[1] == "v11;");
+			DE_TEST_ASSERT(results[2] == "v222;");
+		}
+	}
+
+	// Template can be reused with a new string
+	{
+		StringTemplate tmpl ("${A}");
+		tmpl.setString("${EMPTY}!");
+		DE_TEST_ASSERT(tmpl.specialize(params) == "!");
+		DE_TEST_ASSERT(tmpl.getNumParams() == 1);
+	}
 }
 
 } // tcu
@@ -23,30 +23,86 @@
  * \brief String template class.
  *//*--------------------------------------------------------------------*/
 
+#include "tcuDefs.hpp"
+
 #include <map>
 #include <string>
+#include <vector>
 
 namespace tcu
 {
 
+/*--------------------------------------------------------------------*//*!
+ * \brief String with ${name} parameters
+ *
+ * The template is parsed once in setString() into literal and parameter
+ * segments. Each distinct parameter name is given a slot index that can
+ * be used to specialize the template from a vector of values instead of a
+ * map.
+ *
+ * Parameters may have a flag: ${name:single-line} replaces newlines in
+ * the value with spaces and ${name:opt} may be left unspecified. Syntax
+ * errors are reported when the template is specialized.
+ *//*--------------------------------------------------------------------*/
 class StringTemplate
 {
 public:
-						StringTemplate		(void);
-						StringTemplate		(const std::string& str);
-						~StringTemplate		(void);
+	typedef std::map<std::string, std::string>	ParamMap;
+
+									StringTemplate		(void);
+									StringTemplate		(const std::string& str);
+									~StringTemplate		(void);
+
+	void							setString			(const std::string& str);
+
+	std::string						specialize			(const ParamMap& params) const;
 
-	void				setString			(const std::string& str);
+	//! Specialize with values[ndx] as the value of parameter slot ndx. Optional parameters may be empty.
+	std::string						specialize			(const std::vector<std::string>& values) const;
 
-	std::string			specialize			(const std::map<std::string, std::string>& params) const;
+	//! Specialize the template once for each parameter set
+	std::vector<std::string>		specializeAll		(const std::vector<ParamMap>& paramSets) const;
+
+	int								getNumParams		(void) const { return (int)m_paramNames.size();	}
+	const std::string&				getParamName		(int ndx) const { return m_paramNames[ndx];		}
+
+	//! Slot index of a parameter, or -1 if the template does not use it
+	int								getParamIndex		(const std::string& name) const;
 
 private:
-						StringTemplate		(const StringTemplate&);		// not allowed!
-	StringTemplate&		operator=			(const StringTemplate&);		// not allowed!
+									StringTemplate		(const StringTemplate&);		// not allowed!
+	StringTemplate&					operator=			(const StringTemplate&);		// not allowed!
+
+	enum SegmentType
+	{
+		SEGMENTTYPE_LITERAL = 0,
+		SEGMENTTYPE_PARAM,
+		SEGMENTTYPE_PARAM_SINGLE_LINE,
+
+		SEGMENTTYPE_LAST
+	};
 
-	std::string			m_template;
+	struct Segment
+	{
+		SegmentType		type;
+		size_t			offset;		//!< Literal start in m_template
+		size_t			length;		//!< Literal length
+		int				paramNdx;	//!< Parameter slot
+	};
+
+	void							checkValid			(void) const;
+	void							resolveParams		(const ParamMap& params, std::vector<const std::string*>& values) const;
+	std::string						specializeValues	(const std::string* const* values) const;
+
+	std::string						m_template;
+	std::vector<Segment>			m_segments;
+	std::vector<std::string>		m_paramNames;		//!< Parameter name for each slot
+	std::vector<bool>				m_paramOptional;	//!< True if all uses of the slot are optional
+	std::string						m_error;			//!< Parse error, reported on specialize
 } DE_WARN_UNUSED_TYPE;
 
+void	StringTemplate_selfTest		(void);
+
 } // tcu
 
 #endif // _TCUSTRINGTEMPLATE_HPP
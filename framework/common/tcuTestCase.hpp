@@ -174,6 +174,14 @@ public:
 					TestCase			(TestContext& testCtx, const char* name, const char* description);
 					TestCase			(TestContext& testCtx, TestNodeType nodeType, const char* name, const char* description);
 	virtual			~TestCase			(void);
+
+	//! Can the case run on a worker thread concurrently with other thread-safe cases (--deqp-parallel-execution).
+	//! Such cases are executed without the package TestCaseExecutor and may only use the log and result of the test context.
+	virtual bool	isThreadSafe		(void) const { return false; }
+
+	//! Watchdog time limits in seconds, zero uses the default limit. Limits don't apply to cases executed in parallel.
+	virtual int		getTotalTimeLimit	(void) const { return 0; }
+	virtual int		getIntervalTimeLimit	(void) const { return 0; }
 };
 
 class TestStatus
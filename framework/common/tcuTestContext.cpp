@@ -42,10 +42,16 @@ TestContext::TestContext (
 	, m_curArchive		(DE_NULL)
 	, m_testResult		(QP_TEST_RESULT_LAST)
 	, m_terminateAfter	(false)
+	, m_threadCaseState	(deThreadLocal_create())
 {
 	setCurrentArchive(m_rootArchive);
 }
 
+TestContext::~TestContext (void)
+{
+	deThreadLocal_destroy(m_threadCaseState);
+}
+
 void TestContext::touchWatchdog (void)
 {
 	if (m_watchDog)
@@ -54,8 +60,51 @@ void TestContext::touchWatchdog (void)
 
 void TestContext::setTestResult (qpTestResult testResult, const char* description)
 {
-	m_testResult		= testResult;
-	m_testResultDesc	= description;
+	ThreadCaseState* const state = getThreadCaseState();
+
+	if (state)
+	{
+		state->testResult		= testResult;
+		state->testResultDesc	= description;
+	}
+	else
+	{
+		m_testResult		= testResult;
+		m_testResultDesc	= description;
+	}
+}
+
+qpTestResult TestContext::getTestResult (void) const
+{
+	const ThreadCaseState* const state = getThreadCaseState();
+	return state ? state->testResult : m_testResult;
+}
+
+const char* TestContext::getTestResultDesc (void) const
+{
+	const ThreadCaseState* const state = getThreadCaseState();
+	return state ? state->testResultDesc.c_str() : m_testResultDesc.c_str();
+}
+
+void TestContext::setTerminateAfter (bool terminate)
+{
+	ThreadCaseState* const state = getThreadCaseState();
+
+	if (state)
+		state->terminateAfter = terminate;
+	else
+		m_terminateAfter = terminate;
+}
+
+bool TestContext::getTerminateAfter (void) const
+{
+	const ThreadCaseState* const state = getThreadCaseState();
+	return state ? state->terminateAfter : m_terminateAfter;
+}
+
+void TestContext::setThreadCaseState (ThreadCaseState* state)
+{
+	deThreadLocal_set(m_threadCaseState, state);
 }
 
 } // tcu
@@ -26,6 +26,7 @@
 #include "tcuDefs.hpp"
 #include "qpWatchDog.h"
 #include "qpTestLog.h"
+#include "deThreadLocal.h"
 
 #include <string>
 
@@ -48,11 +49,32 @@ class TestLog;
 class TestContext
 {
 public:
+	/*--------------------------------------------------------------------*//*!
+	 * \brief Log and result of a case executed on a worker thread
+	 *
+	 * While bound to a thread with setThreadCaseState(), the log and test
+	 * result accessors of the context refer to this state on that thread.
+	 *//*--------------------------------------------------------------------*/
+	struct ThreadCaseState
+	{
+		TestLog*			log;
+		qpTestResult		testResult;
+		std::string			testResultDesc;
+		bool				terminateAfter;
+
+		explicit ThreadCaseState (TestLog& log_)
+			: log				(&log_)
+			, testResult		(QP_TEST_RESULT_LAST)
+			, terminateAfter	(false)
+		{
+		}
+	};
+
 							TestContext			(Platform& platform, Archive& rootArchive, TestLog& log, const CommandLine& cmdLine, qpWatchDog* watchDog);
-							~TestContext		(void) {}
+							~TestContext		(void);
 
 	// API for test cases
-	TestLog&				getLog				(void)			{ return m_log;			}
+	TestLog&				getLog				(void)			{ const ThreadCaseState* state = getThreadCaseState(); return state ? *state->log : m_log;	}
 	Archive&				getArchive			(void)			{ return *m_curArchive;	} //!< \note Do not access in TestNode constructors.
 	Platform&				getPlatform			(void)			{ return m_platform;	}
 	void					setTestResult		(qpTestResult result, const char* description);
@@ -60,20 +82,26 @@ public:
 	const CommandLine&		getCommandLine		(void) const	{ return m_cmdLine;		}
 
 	// API for test framework
-	qpTestResult			getTestResult		(void) const	{ return m_testResult;				}
-	const char*				getTestResultDesc	(void) const	{ return m_testResultDesc.c_str();	}
+	qpTestResult			getTestResult		(void) const;
+	const char*				getTestResultDesc	(void) const;
 	qpWatchDog*				getWatchDog			(void)			{ return m_watchDog;				}
 
 	Archive&				getRootArchive		(void) const		{ return m_rootArchive;		}
 	void					setCurrentArchive	(Archive& archive)	{ m_curArchive = &archive;	}
+	void					setWatchDog			(qpWatchDog* dog)	{ m_watchDog = dog;			}
 
-	void					setTerminateAfter	(bool terminate)	{ m_terminateAfter = terminate;	}
-	bool					getTerminateAfter	(void) const		{ return m_terminateAfter;		}
+	void					setTerminateAfter	(bool terminate);
+	bool					getTerminateAfter	(void) const;
+
+	//! Redirect log and result of the calling thread to state, or back to the shared log and result if null
+	void					setThreadCaseState	(ThreadCaseState* state);
 
 protected:
 							TestContext			(const TestContext&);
 	TestContext&			operator=			(const TestContext&);
 
+	ThreadCaseState*		getThreadCaseState	(void) const	{ return static_cast<ThreadCaseState*>(deThreadLocal_get(m_threadCaseState));	}
+
 	Platform&				m_platform;			//!< Platform port implementation.
 	Archive&				m_rootArchive;		//!< Root archive.
 	TestLog&				m_log;				//!< Test log.
@@ -84,6 +112,7 @@ protected:
 	qpTestResult			m_testResult;		//!< Latest test result.
 	std::string				m_testResultDesc;	//!< Latest test result description.
 	bool					m_terminateAfter;	//!< Should tester terminate after execution of the current test
+	deThreadLocal			m_threadCaseState;	//!< ThreadCaseState of cases executed on worker threads.
 };
 
 } // tcu
@@ -24,6 +24,7 @@
 #include "tcuTestHierarchyUtil.hpp"
 #include "tcuStringTemplate.hpp"
 #include "tcuCommandLine.hpp"
+#include "tcuCaseIndex.hpp"
 
 #include "qpXmlWriter.h"
 
@@ -51,6 +52,21 @@ static const char* getNodeTypeName (TestNodeType nodeType)
 
 // Utilities
 
+bool isCaseIndexComplete (TestPackageRoot& root, const CaseIndex& caseIndex)
+{
+	std::vector<TestNode*> packages;
+
+	root.getChildren(packages);
+
+	for (size_t ndx = 0; ndx < packages.size(); ndx++)
+	{
+		if (!caseIndex.hasPackage(packages[ndx]->getName()))
+			return false;
+	}
+
+	return true;
+}
+
 static std::string makePackageFilename (const std::string& pattern, const std::string& packageName, const std::string& typeExtension)
 {
 	std::map<string, string> args;
@@ -184,9 +200,37 @@ void writeTxtCaselistsToFiles (TestPackageRoot& root, TestContext& testCtx, cons
 {
 	DefaultHierarchyInflater			inflater		(testCtx);
 	de::MovePtr<const CaseListFilter>	caseListFilter	(testCtx.getCommandLine().createCaseListFilter(testCtx.getArchive()));
+	const CaseIndex* const				caseIndex		= caseListFilter->getCaseIndex();
+	const char* const					filenamePattern = cmdLine.getCaseListExportFile();
+
+	// Write case lists directly from the case index without initializing any packages
+	if (caseIndex && isCaseIndexComplete(root, *caseIndex))
+	{
+		std::vector<TestNode*> packages;
+
+		root.getChildren(packages);
+
+		for (size_t ndx = 0; ndx < packages.size(); ndx++)
+		{
+			const char*		pkgName		= packages[ndx]->getName();
+			const string	filename	= makePackageFilename(filenamePattern, pkgName, "txt");
+
+			if (!caseListFilter->checkTestGroupName(pkgName))
+				continue;
+
+			std::ofstream out(filename.c_str(), std::ios_base::binary);
+			if (!out.is_open() || !out.good())
+				throw Exception("Failed to open " + filename);
+
+			print("Writing test cases from '%s' to file '%s'..\n", pkgName, filename.c_str());
+
+			caseIndex->writeCaseList(out, pkgName, *caseListFilter);
+		}
+
+		return;
+	}
 
 	TestHierarchyIterator				iter			(root, inflater, *caseListFilter);
-	const char* const					filenamePattern = cmdLine.getCaseListExportFile();
 
 	while (iter.getState() != TestHierarchyIterator::STATE_FINISHED)
 	{
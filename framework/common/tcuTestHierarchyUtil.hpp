@@ -29,6 +29,11 @@
 namespace tcu
 {
 
+class CaseIndex;
+
+//! Check if case index has entries for all packages in root, so that case lists can be written without inflating them
+bool isCaseIndexComplete (TestPackageRoot& root, const CaseIndex& caseIndex);
+
 // \todo [2015-02-26 pyry] Remove TestContext requirement
 void writeXmlCaselistsToFiles (TestPackageRoot& root, TestContext& testCtx, const CommandLine& cmdLine);
 void writeTxtCaselistsToFiles (TestPackageRoot& root, TestContext& testCtx, const CommandLine& cmdLine);
@@ -187,11 +187,35 @@ TestLog::TestLog (const char* fileName, deUint32 flags)
 		throw ResourceError(std::string("Failed to open test log file '") + fileName + "'");
 }
 
+TestLog::TestLog (qpTestLog* log)
+	: m_log(log)
+{
+	DE_ASSERT(m_log);
+}
+
 TestLog::~TestLog (void)
 {
 	qpTestLog_destroy(m_log);
 }
 
+TestLog* TestLog::createBufferLog (deUint32 flags)
+{
+	qpTestLog* const log = qpTestLog_createBufferLog(flags);
+
+	if (!log)
+		throw ResourceError("Failed to create buffer log");
+
+	try
+	{
+		return new TestLog(log);
+	}
+	catch (...)
+	{
+		qpTestLog_destroy(log);
+		throw;
+	}
+}
+
 void TestLog::writeMessage (const char* msgStr)
 {
 	if (qpTestLog_writeText(m_log, DE_NULL, DE_NULL, QP_KEY_TAG_LAST, msgStr) == DE_FALSE)
@@ -471,6 +495,29 @@ void TestLog::endTestsCasesTime (void)
 		throw LogWriteFailedError();
 }
 
+void TestLog::appendBufferLog (TestLog& bufferLog)
+{
+	if (qpTestLog_appendBufferLog(m_log, bufferLog.m_log) == DE_FALSE)
+		throw LogWriteFailedError();
+}
+
+void TestLog::appendTerminatedCase (TestLog& bufferLog, qpTestResult result)
+{
+	if (qpTestLog_appendTerminatedCase(m_log, bufferLog.m_log, result) == DE_FALSE)
+		throw LogWriteFailedError();
+}
+
+void TestLog::clearBufferLog (void)
+{
+	if (qpTestLog_clearBufferLog(m_log) == DE_FALSE)
+		throw LogWriteFailedError();
+}
+
+bool TestLog::isBufferLogEmpty (void)
+{
+	return qpTestLog_isBufferLogEmpty(m_log) == DE_TRUE;
+}
+
 void TestLog::startSampleList (const std::string& name, const std::string& description)
 {
 	if (qpTestLog_startSampleList(m_log, name.c_str(), description.c_str()) == DE_FALSE)
@@ -530,6 +577,11 @@ bool TestLog::isShaderLoggingEnabled (void)
 	return (qpTestLog_getLogFlags(m_log) & QP_TEST_LOG_EXCLUDE_SHADER_SOURCES) == 0;
 }
 
+deUint32 TestLog::getLogFlags (void) const
+{
+	return qpTestLog_getLogFlags(m_log);
+}
+
 const TestLog::BeginMessageToken		TestLog::Message			= TestLog::BeginMessageToken();
 const TestLog::EndMessageToken			TestLog::EndMessage			= TestLog::EndMessageToken();
 const TestLog::EndImageSetToken			TestLog::EndImageSet		= TestLog::EndImageSetToken();
@@ -105,6 +105,9 @@ public:
 	explicit			TestLog					(const char* fileName, deUint32 flags = 0);
 						~TestLog				(void);
 
+	//! Create a log that buffers cases in a temporary file until appended to another log with appendBufferLog()
+	static TestLog*		createBufferLog			(deUint32 flags);
+
 	MessageBuilder		operator<<				(const BeginMessageToken&);
 	MessageBuilder		message					(void);
 
@@ -164,6 +167,11 @@ public:
 	void				startTestsCasesTime		(void);
 	void				endTestsCasesTime		(void);
 
+	void				appendBufferLog			(TestLog& bufferLog);
+	void				appendTerminatedCase	(TestLog& bufferLog, qpTestResult result);
+	void				clearBufferLog			(void);
+	bool				isBufferLogEmpty		(void);
+
 	void				startSampleList			(const std::string& name, const std::string& description);
 	void				startSampleInfo			(void);
 	void				writeValueInfo			(const std::string& name, const std::string& description, const std::string& unit, qpSampleValueTag tag);
@@ -175,7 +183,10 @@ public:
 	void				endSampleList			(void);
 
 	bool				isShaderLoggingEnabled	(void);
+	deUint32			getLogFlags				(void) const;
+
 private:
+	explicit			TestLog					(qpTestLog* log);
 						TestLog					(const TestLog& other); // Not allowed!
 	TestLog&			operator=				(const TestLog& other); // Not allowed!
 
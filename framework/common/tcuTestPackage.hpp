@@ -26,9 +26,14 @@
 #include "tcuDefs.hpp"
 #include "tcuTestCase.hpp"
 
+#include <map>
+
 namespace tcu
 {
 
+//! Named counters reported in the summary at the end of a test session, summed over packages and worker processes
+typedef std::map<std::string, deInt64> SessionCounters;
+
 /*--------------------------------------------------------------------*//*!
  * \brief Test case execution interface.
  *
@@ -58,6 +63,9 @@ public:
 	virtual void						init				(TestCase* testCase, const std::string& path) = 0;
 	virtual void						deinit				(TestCase* testCase) = 0;
 	virtual TestNode::IterateResult		iterate				(TestCase* testCase) = 0;
+
+	//! Add package-specific counters to the session summary, called when the package is left
+	virtual void						addSessionCounters	(SessionCounters& counters) const { DE_UNREF(counters); }
 };
 
 /*--------------------------------------------------------------------*//*!
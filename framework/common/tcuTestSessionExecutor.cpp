@@ -26,12 +26,20 @@
 #include "tcuTestLog.hpp"
 
 #include "deClock.h"
+#include "deParallelFor.hpp"
+#include "deStringUtil.hpp"
 
 namespace tcu
 {
 
 using std::vector;
 
+enum
+{
+	//! Touch intervals are logged for cases whose longest interval is at least 1/N of interval time limit.
+	WATCHDOG_LOG_TOUCH_INTERVALS_LIMIT_DIVISOR	= 10
+};
+
 static qpTestCaseType nodeTypeToTestCaseType (TestNodeType nodeType)
 {
 	switch (nodeType)
@@ -46,6 +54,35 @@ static qpTestCaseType nodeTypeToTestCaseType (TestNodeType nodeType)
 	}
 }
 
+static void logWatchDogTouchIntervals (TestLog& log, qpWatchDog* watchDog)
+{
+	const deInt64			intervalLimit	= (deInt64)qpWatchDog_getIntervalTimeLimit(watchDog) * 1000000;
+	qpWatchDogTouchStats	stats;
+
+	qpWatchDog_getTouchStats(watchDog, &stats);
+
+	// Only cases with iterations that come close to the limit are logged
+	if ((deInt64)stats.maxInterval * WATCHDOG_LOG_TOUCH_INTERVALS_LIMIT_DIVISOR < intervalLimit)
+		return;
+
+	log << TestLog::Section("WatchDogTouchIntervals", "Watchdog touch intervals")
+		<< TestLog::Integer("IntervalTimeLimit", "Watchdog touch interval limit", "us", QP_KEY_TAG_TIME, intervalLimit)
+		<< TestLog::Integer("MaxTouchInterval", "Longest touch interval", "us", QP_KEY_TAG_TIME, (deInt64)stats.maxInterval)
+		<< TestLog::Integer("LastTouchInterval", "Last touch interval", "us", QP_KEY_TAG_TIME, (deInt64)stats.lastInterval);
+
+	for (int bucketNdx = 0; bucketNdx < QP_WATCHDOG_NUM_TOUCH_INTERVAL_BUCKETS; bucketNdx++)
+	{
+		const int			count		= stats.intervalHistogram[bucketNdx];
+		const std::string	rangeStart	= bucketNdx > 0 ? de::toString(1 << (bucketNdx-1)) + "ms" : "0ms";
+		const std::string	rangeEnd	= bucketNdx+1 < QP_WATCHDOG_NUM_TOUCH_INTERVAL_BUCKETS ? de::toString(1 << bucketNdx) + "ms" : "";
+
+		if (count > 0)
+			log << TestLog::Integer("TouchIntervals" + rangeStart, "Number of touch intervals from " + rangeStart + (rangeEnd.empty() ? " up" : " to " + rangeEnd), "", QP_KEY_TAG_NONE, count);
+	}
+
+	log << TestLog::EndSection;
+}
+
 TestSessionExecutor::TestSessionExecutor (TestPackageRoot& root, TestContext& testCtx)
 	: m_testCtx				(testCtx)
 	, m_inflater			(testCtx)
@@ -56,6 +93,23 @@ TestSessionExecutor::TestSessionExecutor (TestPackageRoot& root, TestContext& te
 	, m_isInTestCase		(false)
 	, m_testStartTime		(0)
 	, m_packageStartTime	(0)
+	, m_logCasesTime		(true)
+	, m_maxParallelCases	(testCtx.getCommandLine().isParallelExecutionEnabled() ? 4 * de::getParallelForNumThreads() : 0)
+{
+}
+
+TestSessionExecutor::TestSessionExecutor (TestPackageRoot& root, TestContext& testCtx, de::MovePtr<CaseListFilter> caseListFilter, bool logCasesTime)
+	: m_testCtx				(testCtx)
+	, m_inflater			(testCtx)
+	, m_caseListFilter		(caseListFilter)
+	, m_iterator			(root, m_inflater, *m_caseListFilter)
+	, m_state				(STATE_TRAVERSE_HIERARCHY)
+	, m_abortSession		(false)
+	, m_isInTestCase		(false)
+	, m_testStartTime		(0)
+	, m_packageStartTime	(0)
+	, m_logCasesTime		(logCasesTime)
+	, m_maxParallelCases	(0)
 {
 }
 
@@ -73,6 +127,14 @@ bool TestSessionExecutor::iterate (void)
 			{
 				const TestHierarchyIterator::State	hierIterState	= m_iterator.getState();
 
+				// Queued cases must complete before any other node is entered or left
+				if (!m_parallelCases.empty() &&
+					(hierIterState == TestHierarchyIterator::STATE_FINISHED || !isParallelCase(m_iterator.getNode())))
+				{
+					executeParallelCases();
+					return true;
+				}
+
 				if (hierIterState == TestHierarchyIterator::STATE_ENTER_NODE ||
 					hierIterState == TestHierarchyIterator::STATE_LEAVE_NODE)
 				{
@@ -80,6 +142,23 @@ bool TestSessionExecutor::iterate (void)
 					const TestNodeType	nodeType	= curNode->getNodeType();
 					const bool			isEnter		= hierIterState == TestHierarchyIterator::STATE_ENTER_NODE;
 
+					if (isParallelCase(curNode))
+					{
+						// Leave events need no action, the whole case is executed by executeParallelCases()
+						if (isEnter)
+							m_parallelCases.push_back(ParallelCase(static_cast<TestCase*>(curNode), m_iterator.getNodePath()));
+
+						m_iterator.next();
+
+						if ((int)m_parallelCases.size() >= m_maxParallelCases)
+						{
+							executeParallelCases();
+							return true;
+						}
+
+						break;
+					}
+
 					switch (nodeType)
 					{
 						case NODETYPE_PACKAGE:
@@ -109,8 +188,14 @@ bool TestSessionExecutor::iterate (void)
 								// else remain in TRAVERSING_HIERARCHY => node will be exited from in the next iteration
 							}
 							else
+							{
 								leaveTestCase(testCase);
 
+								// Return after each completed case, so that the next case is not started yet
+								m_iterator.next();
+								return true;
+							}
+
 							break;
 						}
 
@@ -163,30 +248,45 @@ void TestSessionExecutor::enterTestPackage (TestPackage* testPackage)
 
 void TestSessionExecutor::leaveTestPackage (TestPackage* testPackage)
 {
-	DE_UNREF(testPackage);
+	const deUint64 duration = deGetMicroseconds() - m_packageStartTime;
+
+	m_caseExecutor->addSessionCounters(m_sessionCounters);
 	m_caseExecutor.clear();
-	m_testCtx.getLog().startTestsCasesTime();
+	m_packageStartTime = 0;
+	m_casesTime.packages[testPackage->getName()] += duration;
 
+	if (m_logCasesTime)
 	{
-		const deInt64 duration = deGetMicroseconds() - m_packageStartTime;
-		m_packageStartTime = 0;
-		m_testCtx.getLog() << TestLog::Integer(testPackage->getName(), "Total tests case duration in microseconds", "us", QP_KEY_TAG_TIME, duration);
-	}
+		CasesTime packageTime;
 
-	for(std::map<std::string, deUint64>::iterator it=m_groupsDurationTime.begin(); it != m_groupsDurationTime.end(); ++it)
-		m_testCtx.getLog() << TestLog::Integer(it->first, "The test group case duration in microseconds", "us", QP_KEY_TAG_TIME, it->second);
+		packageTime.packages[testPackage->getName()]	= duration;
+		packageTime.groups								= m_casesTime.groups;
 
-	m_testCtx.getLog().endTestsCasesTime();
+		writeCasesTime(m_testCtx.getLog(), packageTime);
+	}
 }
 
 void TestSessionExecutor::enterTestGroup (const std::string& casePath)
 {
-	m_groupsDurationTime[casePath] = deGetMicroseconds();
+	m_casesTime.groups[casePath] = deGetMicroseconds();
 }
 
 void TestSessionExecutor::leaveTestGroup (const std::string& casePath)
 {
-	m_groupsDurationTime[casePath] = deGetMicroseconds() - m_groupsDurationTime[casePath];
+	m_casesTime.groups[casePath] = deGetMicroseconds() - m_casesTime.groups[casePath];
+}
+
+void TestSessionExecutor::writeCasesTime (TestLog& log, const CasesTime& casesTime)
+{
+	log.startTestsCasesTime();
+
+	for (std::map<std::string, deUint64>::const_iterator it = casesTime.packages.begin(); it != casesTime.packages.end(); ++it)
+		log << TestLog::Integer(it->first, "Total tests case duration in microseconds", "us", QP_KEY_TAG_TIME, (deInt64)it->second);
+
+	for (std::map<std::string, deUint64>::const_iterator it = casesTime.groups.begin(); it != casesTime.groups.end(); ++it)
+		log << TestLog::Integer(it->first, "The test group case duration in microseconds", "us", QP_KEY_TAG_TIME, (deInt64)it->second);
+
+	log.endTestsCasesTime();
 }
 
 bool TestSessionExecutor::enterTestCase (TestCase* testCase, const std::string& casePath)
@@ -204,6 +304,9 @@ bool TestSessionExecutor::enterTestCase (TestCase* testCase, const std::string&
 	m_isInTestCase	= true;
 	m_testStartTime	= deGetMicroseconds();
 
+	if (m_testCtx.getWatchDog() && (testCase->getTotalTimeLimit() > 0 || testCase->getIntervalTimeLimit() > 0))
+		qpWatchDog_setTimeLimits(m_testCtx.getWatchDog(), testCase->getTotalTimeLimit(), testCase->getIntervalTimeLimit());
+
 	try
 	{
 		m_caseExecutor->init(testCase, casePath);
@@ -250,6 +353,9 @@ void TestSessionExecutor::leaveTestCase (TestCase* testCase)
 		m_testCtx.setTerminateAfter(true);
 	}
 
+	if (m_testCtx.getWatchDog())
+		logWatchDogTouchIntervals(m_testCtx.getLog(), m_testCtx.getWatchDog());
+
 	{
 		const deInt64 duration = deGetMicroseconds()-m_testStartTime;
 		m_testStartTime = 0;
@@ -265,28 +371,33 @@ void TestSessionExecutor::leaveTestCase (TestCase* testCase)
 		m_isInTestCase = false;
 		m_testCtx.getLog().endCase(testResult, testResultDesc);
 
-		// Update statistics.
-		print("  %s (%s)\n", qpGetTestResultName(testResult), testResultDesc);
-
-		m_status.numExecuted += 1;
-		switch (testResult)
-		{
-			case QP_TEST_RESULT_PASS:					m_status.numPassed			+= 1;	break;
-			case QP_TEST_RESULT_NOT_SUPPORTED:			m_status.numNotSupported	+= 1;	break;
-			case QP_TEST_RESULT_QUALITY_WARNING:		m_status.numWarnings		+= 1;	break;
-			case QP_TEST_RESULT_COMPATIBILITY_WARNING:	m_status.numWarnings		+= 1;	break;
-			default:									m_status.numFailed			+= 1;	break;
-		}
-
-		// terminateAfter, Resource error or any error in deinit means that execution should end
-		if (terminateAfter || testResult == QP_TEST_RESULT_RESOURCE_ERROR)
-			m_abortSession = true;
+		recordTestResult(testResult, testResultDesc, terminateAfter);
 	}
 
 	if (m_testCtx.getWatchDog())
 		qpWatchDog_reset(m_testCtx.getWatchDog());
 }
 
+void TestSessionExecutor::recordTestResult (qpTestResult testResult, const char* testResultDesc, bool terminateAfter)
+{
+	// Update statistics.
+	print("  %s (%s)\n", qpGetTestResultName(testResult), testResultDesc);
+
+	m_status.numExecuted += 1;
+	switch (testResult)
+	{
+		case QP_TEST_RESULT_PASS:					m_status.numPassed			+= 1;	break;
+		case QP_TEST_RESULT_NOT_SUPPORTED:			m_status.numNotSupported	+= 1;	break;
+		case QP_TEST_RESULT_QUALITY_WARNING:		m_status.numWarnings		+= 1;	break;
+		case QP_TEST_RESULT_COMPATIBILITY_WARNING:	m_status.numWarnings		+= 1;	break;
+		default:									m_status.numFailed			+= 1;	break;
+	}
+
+	// terminateAfter, Resource error or any error in deinit means that execution should end
+	if (terminateAfter || testResult == QP_TEST_RESULT_RESOURCE_ERROR)
+		m_abortSession = true;
+}
+
 TestCase::IterateResult TestSessionExecutor::iterateTestCase (TestCase* testCase)
 {
 	TestLog&				log				= m_testCtx.getLog();
@@ -318,4 +429,180 @@ TestCase::IterateResult TestSessionExecutor::iterateTestCase (TestCase* testCase
 	return iterateResult;
 }
 
+// Parallel execution
+
+namespace
+{
+
+class ScopedThreadCaseState
+{
+public:
+	ScopedThreadCaseState (TestContext& testCtx, TestContext::ThreadCaseState& state)
+		: m_testCtx(testCtx)
+	{
+		m_testCtx.setThreadCaseState(&state);
+	}
+
+	~ScopedThreadCaseState (void)
+	{
+		m_testCtx.setThreadCaseState(DE_NULL);
+	}
+
+private:
+	TestContext&	m_testCtx;
+};
+
+} // anonymous
+
+class TestSessionExecutor::ParallelCaseTask : public de::RangeTask
+{
+public:
+	ParallelCaseTask (TestContext& testCtx, std::vector<ParallelCase>& cases, deUint32 logFlags)
+		: m_testCtx		(testCtx)
+		, m_cases		(cases)
+		, m_logFlags	(logFlags)
+	{
+	}
+
+	void run (int begin, int end)
+	{
+		for (int ndx = begin; ndx < end; ndx++)
+			execute(m_cases[ndx]);
+	}
+
+private:
+	void execute (ParallelCase& parallelCase)
+	{
+		TestCase* const					testCase	= parallelCase.testCase;
+		const deUint64					startTime	= deGetMicroseconds();
+
+		parallelCase.log = de::SharedPtr<TestLog>(TestLog::createBufferLog(m_logFlags | QP_TEST_LOG_NO_FLUSH));
+
+		TestLog&						log			= *parallelCase.log;
+		TestContext::ThreadCaseState	state		(log);
+		bool							initOk		= false;
+
+		{
+			const ScopedThreadCaseState	scopedState	(m_testCtx, state);
+
+			log.startCase(parallelCase.casePath.c_str(), nodeTypeToTestCaseType(testCase->getNodeType()));
+
+			try
+			{
+				testCase->init();
+				initOk = true;
+			}
+			catch (const std::bad_alloc&)
+			{
+				m_testCtx.setTestResult(QP_TEST_RESULT_RESOURCE_ERROR, "Failed to allocate memory in test case init");
+				m_testCtx.setTerminateAfter(true);
+			}
+			catch (const tcu::TestException& e)
+			{
+				DE_ASSERT(e.getTestResult() != QP_TEST_RESULT_LAST);
+				m_testCtx.setTestResult(e.getTestResult(), e.getMessage());
+				m_testCtx.setTerminateAfter(e.isFatal());
+				log << e;
+			}
+			catch (const tcu::Exception& e)
+			{
+				m_testCtx.setTestResult(QP_TEST_RESULT_FAIL, e.getMessage());
+				log << e;
+			}
+
+			while (initOk)
+			{
+				TestCase::IterateResult iterateResult = TestCase::STOP;
+
+				m_testCtx.touchWatchdog();
+
+				try
+				{
+					iterateResult = testCase->iterate();
+				}
+				catch (const std::bad_alloc&)
+				{
+					m_testCtx.setTestResult(QP_TEST_RESULT_RESOURCE_ERROR, "Failed to allocate memory during test execution");
+					m_testCtx.setTerminateAfter(true);
+				}
+				catch (const tcu::TestException& e)
+				{
+					log << e;
+					m_testCtx.setTestResult(e.getTestResult(), e.getMessage());
+					m_testCtx.setTerminateAfter(e.isFatal());
+				}
+				catch (const tcu::Exception& e)
+				{
+					log << e;
+					m_testCtx.setTestResult(QP_TEST_RESULT_FAIL, e.getMessage());
+				}
+
+				if (iterateResult == TestCase::STOP)
+					break;
+			}
+
+			try
+			{
+				testCase->deinit();
+			}
+			catch (const tcu::Exception& e)
+			{
+				log << e << TestLog::Message << "Error in test case deinit, test program will terminate." << TestLog::EndMessage;
+				m_testCtx.setTerminateAfter(true);
+			}
+		}
+
+		DE_ASSERT(state.testResult != QP_TEST_RESULT_LAST);
+
+		log << TestLog::Integer("TestDuration", "Test case duration in microseconds", "us", QP_KEY_TAG_TIME, (deInt64)(deGetMicroseconds() - startTime));
+		log.endCase(state.testResult, state.testResultDesc.c_str());
+
+		parallelCase.testResult		= state.testResult;
+		parallelCase.testResultDesc	= state.testResultDesc;
+		parallelCase.terminateAfter	= state.terminateAfter;
+	}
+
+	TestContext&				m_testCtx;
+	std::vector<ParallelCase>&	m_cases;
+	const deUint32				m_logFlags;
+};
+
+bool TestSessionExecutor::isParallelCase (const TestNode* node) const
+{
+	return m_maxParallelCases > 0 &&
+		   isTestNodeTypeExecutable(node->getNodeType()) &&
+		   static_cast<const TestCase*>(node)->isThreadSafe();
+}
+
+void TestSessionExecutor::executeParallelCases (void)
+{
+	try
+	{
+		ParallelCaseTask task (m_testCtx, m_parallelCases, m_testCtx.getLog().getLogFlags());
+
+		de::parallelFor(0, (int)m_parallelCases.size(), 1, task);
+
+		// Write results in case list order. Cases after one that aborts the session are dropped.
+		for (size_t ndx = 0; ndx < m_parallelCases.size() && !m_abortSession; ndx++)
+		{
+			const ParallelCase& parallelCase = m_parallelCases[ndx];
+
+			print("\nTest case '%s'..\n", parallelCase.casePath.c_str());
+
+			m_testCtx.getLog().appendBufferLog(*parallelCase.log);
+			recordTestResult(parallelCase.testResult, parallelCase.testResultDesc.c_str(), parallelCase.terminateAfter);
+		}
+	}
+	catch (...)
+	{
+		m_parallelCases.clear();
+		throw;
+	}
+
+	m_parallelCases.clear();
+
+	if (m_testCtx.getWatchDog())
+		qpWatchDog_reset(m_testCtx.getWatchDog());
+}
+
 } // tcu
@@ -29,7 +29,9 @@
 #include "tcuTestPackage.hpp"
 #include "tcuTestHierarchyIterator.hpp"
 #include "deUniquePtr.hpp"
+#include "deSharedPtr.hpp"
 #include <map>
+#include <vector>
 
 namespace tcu
 {
@@ -61,13 +63,26 @@ public:
 class TestSessionExecutor
 {
 public:
+	//! Package and group durations in microseconds, keyed by package name and group path
+	struct CasesTime
+	{
+		std::map<std::string, deUint64>	packages;
+		std::map<std::string, deUint64>	groups;
+	};
+
 									TestSessionExecutor	(TestPackageRoot& root, TestContext& testCtx);
+	//! Execute cases accepted by caseListFilter one at a time. Durations are only collected into getCasesTime() unless logCasesTime is set.
+									TestSessionExecutor	(TestPackageRoot& root, TestContext& testCtx, de::MovePtr<CaseListFilter> caseListFilter, bool logCasesTime);
 									~TestSessionExecutor(void);
 
 	bool							iterate				(void);
 
 	bool							isInTestCase		(void) const { return m_isInTestCase;	}
 	const TestRunStatus&			getStatus			(void) const { return m_status;			}
+	const CasesTime&				getCasesTime		(void) const { return m_casesTime;		}
+	const SessionCounters&			getSessionCounters	(void) const { return m_sessionCounters;	}
+
+	static void						writeCasesTime		(TestLog& log, const CasesTime& casesTime);
 
 private:
 	void							enterTestPackage	(TestPackage* testPackage);
@@ -79,6 +94,31 @@ private:
 	bool							enterTestCase		(TestCase* testCase, const std::string& casePath);
 	TestCase::IterateResult			iterateTestCase		(TestCase* testCase);
 	void							leaveTestCase		(TestCase* testCase);
+	void							recordTestResult	(qpTestResult testResult, const char* testResultDesc, bool terminateAfter);
+
+	//! Thread-safe case queued for parallel execution
+	struct ParallelCase
+	{
+		TestCase*				testCase;
+		std::string				casePath;
+		de::SharedPtr<TestLog>	log;				//!< Buffered log of the case
+		qpTestResult			testResult;
+		std::string				testResultDesc;
+		bool					terminateAfter;
+
+		ParallelCase (TestCase* testCase_, const std::string& casePath_)
+			: testCase			(testCase_)
+			, casePath			(casePath_)
+			, testResult		(QP_TEST_RESULT_LAST)
+			, terminateAfter	(false)
+		{
+		}
+	};
+
+	class ParallelCaseTask;
+
+	bool							isParallelCase			(const TestNode* node) const;
+	void							executeParallelCases	(void);
 
 	enum State
 	{
@@ -101,7 +141,12 @@ private:
 	bool							m_isInTestCase;
 	deUint64						m_testStartTime;
 	deUint64						m_packageStartTime;
-	std::map<std::string, deUint64>	m_groupsDurationTime;
+	const bool						m_logCasesTime;
+	CasesTime						m_casesTime;		//!< Group entries hold the start time while the group is entered
+	SessionCounters					m_sessionCounters;
+
+	const int						m_maxParallelCases;	//!< Cases executed per batch, 0 if parallel execution is disabled
+	std::vector<ParallelCase>		m_parallelCases;	//!< Consecutive thread-safe cases in case list order
 };
 
 } // tcu
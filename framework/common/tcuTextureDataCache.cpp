@@ -0,0 +1,219 @@
+/*-------------------------------------------------------------------------
+ * drawElements Quality Program Tester Core
+ * ----------------------------------------
+ *
+ * Copyright 2019 The Android Open Source Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ *//*!
+ * \file
+ * \brief Process-wide cache for generated and decoded texture data.
+ *//*--------------------------------------------------------------------*/
+
+#include "tcuTextureDataCache.hpp"
+#include "deSingleton.h"
+#include "deMemory.h"
+
+namespace tcu
+{
+
+namespace
+{
+
+static volatile deSingletonState	s_instanceState	= DE_SINGLETON_STATE_NOT_INITIALIZED;
+static TextureDataCache*			s_instance		= DE_NULL;
+
+void createInstance (void*)
+{
+	// \note Instance lives until process exit
+	s_instance = new TextureDataCache();
+}
+
+de::Sha1 getTestKey (deUint32 value)
+{
+	de::Sha1Stream stream;
+	stream << value;
+	return stream.finalize();
+}
+
+} // anonymous
+
+TextureDataCache::TextureDataCache (size_t maxSize)
+	: m_maxSize	(maxSize)
+	, m_size	(0)
+{
+}
+
+TextureDataCache::~TextureDataCache (void)
+{
+}
+
+TextureDataCache& TextureDataCache::getInstance (void)
+{
+	deInitSingleton(&s_instanceState, createInstance, DE_NULL);
+	return *s_instance;
+}
+
+bool TextureDataCache::get (const de::Sha1& key, void* dst, size_t size)
+{
+	const de::ScopedLock		lock	(m_lock);
+	const EntryMap::iterator	pos		= m_entryMap.find(key);
+
+	if (pos == m_entryMap.end() || pos->second->data.size() != size)
+		return false;
+
+	// Move to front of LRU list
+	m_entries.splice(m_entries.begin(), m_entries, pos->second);
+
+	if (size > 0)
+		deMemcpy(dst, &pos->second->data[0], size);
+
+	return true;
+}
+
+bool TextureDataCache::get (const de::Sha1& key, std::vector<deUint8>& dst)
+{
+	const de::ScopedLock		lock	(m_lock);
+	const EntryMap::iterator	pos		= m_entryMap.find(key);
+
+	if (pos == m_entryMap.end())
+		return false;
+
+	m_entries.splice(m_entries.begin(), m_entries, pos->second);
+	dst = pos->second->data;
+
+	return true;
+}
+
+void TextureDataCache::put (const de::Sha1& key, const void* data, size_t size)
+{
+	const de::ScopedLock lock (m_lock);
+
+	if (size > m_maxSize)
+		return;
+
+	{
+		const EntryMap::iterator pos = m_entryMap.find(key);
+
+		if (pos != m_entryMap.end())
+		{
+			m_size -= pos->second->data.size();
+			m_entries.erase(pos->second);
+			m_entryMap.erase(pos);
+		}
+	}
+
+	evict(m_maxSize - size);
+
+	m_entries.push_front(Entry(key));
+	m_entries.front().data.assign((const deUint8*)data, (const deUint8*)data + size);
+	m_entryMap[key]	 = m_entries.begin();
+	m_size			+= size;
+}
+
+void TextureDataCache::clear (void)
+{
+	const de::ScopedLock lock (m_lock);
+
+	m_entries.clear();
+	m_entryMap.clear();
+	m_size = 0;
+}
+
+void TextureDataCache::setMaxSize (size_t maxSize)
+{
+	const de::ScopedLock lock (m_lock);
+
+	m_maxSize = maxSize;
+	evict(m_maxSize);
+}
+
+size_t TextureDataCache::getMaxSize (void) const
+{
+	const de::ScopedLock lock (m_lock);
+	return m_maxSize;
+}
+
+size_t TextureDataCache::getSize (void) const
+{
+	const de::ScopedLock lock (m_lock);
+	return m_size;
+}
+
+size_t TextureDataCache::getNumEntries (void) const
+{
+	const de::ScopedLock lock (m_lock);
+	return m_entries.size();
+}
+
+void TextureDataCache::evict (size_t maxSize)
+{
+	while (m_size > maxSize)
+	{
+		const Entry& entry = m_entries.back();
+
+		m_size -= entry.data.size();
+		m_entryMap.erase(entry.key);
+		m_entries.pop_back();
+	}
+}
+
+void TextureDataCache_selfTest (void)
+{
+	TextureDataCache	cache	(300);
+	deUint8				data	[100];
+	deUint8				result	[100];
+
+	for (int ndx = 0; ndx < DE_LENGTH_OF_ARRAY(data); ndx++)
+		data[ndx] = (deUint8)ndx;
+
+	cache.put(getTestKey(1), data, 100);
+	cache.put(getTestKey(2), data, 100);
+	cache.put(getTestKey(3), data, 100);
+
+	DE_TEST_ASSERT(cache.getSize() == 300 && cache.getNumEntries() == 3);
+	DE_TEST_ASSERT(cache.get(getTestKey(1), result, 100) && deMemCmp(data, result, 100) == 0);
+	DE_TEST_ASSERT(!cache.get(getTestKey(2), result, 99));
+	DE_TEST_ASSERT(!cache.get(getTestKey(4), result, 100));
+
+	// Entry 2 is least recently used
+	cache.put(getTestKey(4), data, 50);
+	DE_TEST_ASSERT(cache.getSize() == 250 && cache.getNumEntries() == 3);
+	DE_TEST_ASSERT(!cache.get(getTestKey(2), result, 100));
+	DE_TEST_ASSERT(cache.get(getTestKey(3), result, 100));
+
+	// Replacing entry updates size
+	cache.put(getTestKey(4), data + 1, 10);
+	DE_TEST_ASSERT(cache.getSize() == 210 && cache.getNumEntries() == 3);
+	DE_TEST_ASSERT(cache.get(getTestKey(4), result, 10) && result[0] == 1);
+
+	{
+		std::vector<deUint8> resultVec;
+		DE_TEST_ASSERT(cache.get(getTestKey(4), resultVec) && resultVec.size() == 10 && resultVec[9] == 10);
+		DE_TEST_ASSERT(!cache.get(getTestKey(2), resultVec));
+	}
+
+	// Entries larger than cache are not stored
+	cache.put(getTestKey(5), data, 301);
+	DE_TEST_ASSERT(!cache.get(getTestKey(5), result, 301));
+
+	// Shrinking evicts least recently used entries: 1, then 3
+	cache.setMaxSize(100);
+	DE_TEST_ASSERT(cache.getNumEntries() == 1 && cache.get(getTestKey(4), result, 10));
+
+	cache.clear();
+	DE_TEST_ASSERT(cache.getSize() == 0 && !cache.get(getTestKey(4), result, 10));
+}
+
+} // tcu
@@ -0,0 +1,103 @@
+#ifndef _TCUTEXTUREDATACACHE_HPP
+#define _TCUTEXTUREDATACACHE_HPP
+/*-------------------------------------------------------------------------
+ * drawElements Quality Program Tester Core
+ * ----------------------------------------
+ *
+ * Copyright 2019 The Android Open Source Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ *//*!
+ * \file
+ * \brief Process-wide cache for generated and decoded texture data.
+ *//*--------------------------------------------------------------------*/
+
+#include "tcuDefs.hpp"
+#include "deSha1.hpp"
+#include "deMutex.hpp"
+
+#include <vector>
+#include <list>
+#include <map>
+
+namespace tcu
+{
+
+/*--------------------------------------------------------------------*//*!
+ * \brief Memory-bounded LRU cache of texture data blobs
+ *
+ * Entries are keyed by hash of everything that determines their contents,
+ * for example compressed format, decompression parameters and compressed
+ * payload for decompressed data. Many cases only differ in sampling
+ * parameters and would otherwise regenerate and decode the same reference
+ * data.
+ *
+ * Cache is shared by all threads. Least recently used entries are evicted
+ * once total size of entries exceeds maximum size.
+ *//*--------------------------------------------------------------------*/
+class TextureDataCache
+{
+public:
+	enum
+	{
+		DEFAULT_MAX_SIZE	= 64*1024*1024	//!< Default maximum total size of entries in bytes
+	};
+
+							TextureDataCache	(size_t maxSize = DEFAULT_MAX_SIZE);
+							~TextureDataCache	(void);
+
+	static TextureDataCache&	getInstance		(void);
+
+	//! Copy data of entry into dst. Returns false if entry does not exist or its size is not size.
+	bool					get					(const de::Sha1& key, void* dst, size_t size);
+	//! Replace contents of dst with data of entry. Returns false if entry does not exist.
+	bool					get					(const de::Sha1& key, std::vector<deUint8>& dst);
+	void					put					(const de::Sha1& key, const void* data, size_t size);
+
+	void					clear				(void);
+	void					setMaxSize			(size_t maxSize);
+
+	size_t					getMaxSize			(void) const;
+	size_t					getSize				(void) const;
+	size_t					getNumEntries		(void) const;
+
+private:
+							TextureDataCache	(const TextureDataCache&);
+	TextureDataCache&		operator=			(const TextureDataCache&);
+
+	struct Entry
+	{
+		de::Sha1				key;
+		std::vector<deUint8>	data;
+
+		Entry (const de::Sha1& key_) : key(key_) {}
+	};
+
+	typedef std::list<Entry>								EntryList;
+	typedef std::map<de::Sha1, EntryList::iterator>			EntryMap;
+
+	void					evict				(size_t maxSize);
+
+	mutable de::Mutex		m_lock;
+	size_t					m_maxSize;
+	size_t					m_size;
+	EntryList				m_entries;			//!< Most recently used first
+	EntryMap				m_entryMap;
+};
+
+void TextureDataCache_selfTest (void);
+
+} // tcu
+
+#endif // _TCUTEXTUREDATACACHE_HPP
@@ -172,7 +172,7 @@ void deSha1Stream_finalize (deSha1Stream* stream, deSha1* hash)
 		if (spaceLeftInChunk >= 1 + sizeof(lengthData))
 			deSha1Stream_process(stream, (size_t)(spaceLeftInChunk - sizeof(lengthData)), padding);
 		else
-			deSha1Stream_process(stream, (size_t)(CHUNK_BYTE_SIZE - (sizeof(lengthData)) - spaceLeftInChunk), padding);
+			deSha1Stream_process(stream, (size_t)(spaceLeftInChunk + CHUNK_BYTE_SIZE - sizeof(lengthData)), padding);
 	}
 
 	deSha1Stream_process(stream, sizeof(lengthData), lengthData);
@@ -273,7 +273,9 @@ void deSha1_selfTest (void)
 		{ "aaf4c61ddcc5e8a2dabede0f3b482cd9aea9434d", "hello" },
 		{ "ec1919e856540f42bd0e6f6c1ffe2fbd73419975",
 			"Cherry is a browser-based GUI for controlling deqp test runs and analysing the test results."
-		}
+		},
+		/* Length in last chunk doesn't fit after padding. */
+		{ "13d956033d9af449bfe2c4ef78c17c20469c4bf1", "aaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaa" }
 	};
 
 	const int garbage = 0xde;
@@ -0,0 +1,473 @@
+/*-------------------------------------------------------------------------
+ * drawElements C++ Base Library
+ * -----------------------------
+ *
+ * Copyright 2019 The Android Open Source Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ *//*!
+ * \file
+ * \brief Parallel loop over an index range.
+ *//*--------------------------------------------------------------------*/
+
+#include "deParallelFor.hpp"
+#include "deThread.hpp"
+#include "deMutex.hpp"
+#include "deSemaphore.hpp"
+#include "deThreadLocal.hpp"
+#include "deAtomic.h"
+
+#include <vector>
+#include <exception>
+
+namespace de
+{
+
+namespace
+{
+
+class Job
+{
+public:
+						Job				(int begin, int end, int grainSize, RangeTask& task);
+
+	int					getNumChunks	(void) const { return m_numChunks;	}
+
+	//! Process chunks until all have been taken
+	void				process			(void);
+
+	//! Stop handing out chunks
+	void				cancel			(void);
+
+	//! Store exception thrown by a chunk. Only the first one is kept.
+	void				setError		(const std::exception_ptr& error);
+	bool				hasFailed		(void) const { return m_hasFailed;	}
+	std::exception_ptr	getError		(void) const { return m_error;		}
+
+private:
+	const int			m_begin;
+	const int			m_end;
+	const int			m_grainSize;
+	const int			m_numChunks;
+	RangeTask&			m_task;
+
+	volatile deUint32	m_nextChunk;
+
+	Mutex				m_errorLock;
+	bool				m_hasFailed;
+	std::exception_ptr	m_error;
+};
+
+Job::Job (int begin, int end, int grainSize, RangeTask& task)
+	: m_begin		(begin)
+	, m_end			(end)
+	, m_grainSize	(grainSize)
+	, m_numChunks	(end > begin ? (end - begin + grainSize - 1) / grainSize : 0)
+	, m_task		(task)
+	, m_nextChunk	(0)
+	, m_hasFailed	(false)
+{
+}
+
+void Job::process (void)
+{
+	for (;;)
+	{
+		const deUint32 chunkNdx = deAtomicIncrementUint32(&m_nextChunk) - 1u;
+
+		if (chunkNdx >= (deUint32)m_numChunks)
+			break;
+
+		{
+			const int chunkBegin	= m_begin + (int)chunkNdx * m_grainSize;
+			const int chunkEnd		= de::min(chunkBegin + m_grainSize, m_end);
+
+			m_task.run(chunkBegin, chunkEnd);
+		}
+	}
+}
+
+void Job::cancel (void)
+{
+	// Move the chunk counter past the last chunk
+	deUint32 curValue = 0;
+
+	while (curValue < (deUint32)m_numChunks)
+	{
+		const deUint32 prevValue = deAtomicCompareExchangeUint32(&m_nextChunk, curValue, (deUint32)m_numChunks);
+
+		if (prevValue == curValue)
+			break;
+
+		curValue = prevValue;
+	}
+}
+
+void Job::setError (const std::exception_ptr& error)
+{
+	const ScopedLock lock (m_errorLock);
+
+	if (!m_hasFailed)
+	{
+		m_hasFailed	= true;
+		m_error		= error;
+	}
+
+	cancel();
+}
+
+class WorkerPool;
+
+class WorkerThread : public Thread
+{
+public:
+					WorkerThread	(WorkerPool& pool) : m_pool(pool) {}
+	void			run				(void);
+
+private:
+	WorkerPool&		m_pool;
+};
+
+class WorkerPool
+{
+public:
+							WorkerPool		(int numWorkers);
+							~WorkerPool		(void);
+
+	int						getNumThreads	(void) const { return (int)m_threads.size() + 1; }
+	void					execute			(Job& job);
+
+	void					workerMain		(void);
+
+private:
+							WorkerPool		(const WorkerPool&);
+	WorkerPool&				operator=		(const WorkerPool&);
+
+	void					waitForWorkers	(int numWorkers);
+
+	Mutex					m_lock;			//!< Held while a job is being executed
+	Semaphore				m_startSem;
+	Semaphore				m_doneSem;
+	Job* volatile			m_job;
+	volatile bool			m_exit;
+	std::vector<Thread*>	m_threads;
+};
+
+void WorkerThread::run (void)
+{
+	m_pool.workerMain();
+}
+
+WorkerPool::WorkerPool (int numWorkers)
+	: m_startSem	(0)
+	, m_doneSem		(0)
+	, m_job			(DE_NULL)
+	, m_exit		(false)
+{
+	for (int ndx = 0; ndx < numWorkers; ndx++)
+	{
+		m_threads.push_back(new WorkerThread(*this));
+		m_threads.back()->start();
+	}
+}
+
+WorkerPool::~WorkerPool (void)
+{
+	m_exit = true;
+
+	for (size_t ndx = 0; ndx < m_threads.size(); ndx++)
+		m_startSem.increment();
+
+	for (size_t ndx = 0; ndx < m_threads.size(); ndx++)
+	{
+		m_threads[ndx]->join();
+		delete m_threads[ndx];
+	}
+}
+
+void WorkerPool::workerMain (void)
+{
+	for (;;)
+	{
+		m_startSem.decrement();
+
+		if (m_exit)
+			break;
+
+		{
+			Job* const job = m_job;
+
+			try
+			{
+				job->process();
+			}
+			catch (...)
+			{
+				// Rethrown as is on the calling thread
+				job->setError(std::current_exception());
+			}
+		}
+
+		m_doneSem.increment();
+	}
+}
+
+void WorkerPool::waitForWorkers (int numWorkers)
+{
+	for (int ndx = 0; ndx < numWorkers; ndx++)
+		m_doneSem.decrement();
+}
+
+void WorkerPool::execute (Job& job)
+{
+	// Run inline if there is nothing to share or the pool is in use, e.g. nested parallelFor()
+	if (m_threads.empty() || job.getNumChunks() <= 1 || !m_lock.tryLock())
+	{
+		job.process();
+		return;
+	}
+
+	{
+		const int numWorkers = de::min((int)m_threads.size(), job.getNumChunks() - 1);
+
+		m_job = &job;
+
+		for (int ndx = 0; ndx < numWorkers; ndx++)
+			m_startSem.increment();
+
+		try
+		{
+			job.process();
+		}
+		catch (...)
+		{
+			job.cancel();
+			waitForWorkers(numWorkers);
+			m_job = DE_NULL;
+			m_lock.unlock();
+			throw;
+		}
+
+		waitForWorkers(numWorkers);
+		m_job = DE_NULL;
+		m_lock.unlock();
+	}
+
+	if (job.hasFailed())
+		std::rethrow_exception(job.getError());
+}
+
+WorkerPool& getWorkerPool (void)
+{
+	static WorkerPool s_pool ((int)deGetNumAvailableLogicalCores() - 1);
+	return s_pool;
+}
+
+} // anonymous
+
+void parallelFor (int begin, int end, int grainSize, RangeTask& task)
+{
+	DE_ASSERT(grainSize > 0);
+
+	Job job (begin, end, grainSize, task);
+
+	getWorkerPool().execute(job);
+}
+
+int getParallelForNumThreads (void)
+{
+	return getWorkerPool().getNumThreads();
+}
+
+// Self-test
+
+namespace
+{
+
+class SumTask : public RangeTask
+{
+public:
+	SumTask (std::vector<int>& counts)
+		: m_counts(counts)
+	{
+	}
+
+	void run (int begin, int end)
+	{
+		for (int ndx = begin; ndx < end; ndx++)
+			m_counts[ndx] += 1;
+	}
+
+private:
+	std::vector<int>&	m_counts;
+};
+
+class NestedTask : public RangeTask
+{
+public:
+	NestedTask (std::vector<int>& counts, int innerSize)
+		: m_counts		(counts)
+		, m_innerSize	(innerSize)
+	{
+	}
+
+	void run (int begin, int end)
+	{
+		for (int ndx = begin; ndx < end; ndx++)
+		{
+			std::vector<int>	inner	(m_innerSize, 0);
+			SumTask				task	(inner);
+
+			parallelFor(0, m_innerSize, 3, task);
+
+			for (int innerNdx = 0; innerNdx < m_innerSize; innerNdx++)
+				DE_TEST_ASSERT(inner[innerNdx] == 1);
+
+			m_counts[ndx] += 1;
+		}
+	}
+
+private:
+	std::vector<int>&	m_counts;
+	const int			m_innerSize;
+};
+
+class TaskError : public std::exception
+{
+public:
+					TaskError	(int index) : m_index(index) {}
+	const char*		what		(void) const throw() { return "TaskError"; }
+	int				getIndex	(void) const { return m_index; }
+
+private:
+	int				m_index;
+};
+
+class ThrowingTask : public RangeTask
+{
+public:
+	ThrowingTask (int throwNdx)
+		: m_throwNdx(throwNdx)
+	{
+	}
+
+	void run (int begin, int end)
+	{
+		if (de::inBounds(m_throwNdx, begin, end))
+			throw TaskError(m_throwNdx);
+	}
+
+private:
+	const int	m_throwNdx;
+};
+
+//! Throws from every chunk that is not processed on the thread that created the task
+class WorkerThrowingTask : public RangeTask
+{
+public:
+	WorkerThrowingTask (void)
+	{
+		m_isCallerThread.set(this);
+	}
+
+	void run (int begin, int)
+	{
+		if (m_isCallerThread.get() != this)
+			throw TaskError(begin);
+
+		// Leave chunks for the workers
+		deSleep(1);
+	}
+
+private:
+	ThreadLocal		m_isCallerThread;
+};
+
+void checkAllVisitedOnce (int begin, int end, int grainSize)
+{
+	std::vector<int>	counts	(de::max(end, 0), 0);
+	SumTask				task	(counts);
+
+	parallelFor(begin, end, grainSize, task);
+
+	for (int ndx = 0; ndx < (int)counts.size(); ndx++)
+		DE_TEST_ASSERT(counts[ndx] == (ndx >= begin ? 1 : 0));
+}
+
+} // anonymous
+
+void ParallelFor_selfTest (void)
+{
+	DE_TEST_ASSERT(getParallelForNumThreads() >= 1);
+
+	checkAllVisitedOnce(0, 0, 1);
+	checkAllVisitedOnce(0, 1, 1);
+	checkAllVisitedOnce(0, 1, 16);
+	checkAllVisitedOnce(0, 1000, 1);
+	checkAllVisitedOnce(0, 1000, 7);
+	checkAllVisitedOnce(13, 1000, 64);
+	checkAllVisitedOnce(0, 1000, 1000);
+	checkAllVisitedOnce(5, 3, 1);
+
+	// Nested calls run inline
+	{
+		std::vector<int>	counts	(50, 0);
+		NestedTask			task	(counts, 20);
+
+		parallelFor(0, (int)counts.size(), 1, task);
+
+		for (int ndx = 0; ndx < (int)counts.size(); ndx++)
+			DE_TEST_ASSERT(counts[ndx] == 1);
+	}
+
+	// Exceptions are propagated to the caller with their original type and the pool stays usable
+	for (int throwNdx = 0; throwNdx < 200; throwNdx += 37)
+	{
+		ThrowingTask	task		(throwNdx);
+		bool			didThrow	= false;
+
+		try
+		{
+			parallelFor(0, 200, 4, task);
+		}
+		catch (const TaskError& e)
+		{
+			DE_TEST_ASSERT(e.getIndex() == throwNdx);
+			didThrow = true;
+		}
+
+		DE_TEST_ASSERT(didThrow);
+	}
+
+	if (getParallelForNumThreads() > 1)
+	{
+		WorkerThrowingTask	task;
+		bool				didThrow	= false;
+
+		try
+		{
+			parallelFor(0, 64, 1, task);
+		}
+		catch (const TaskError&)
+		{
+			didThrow = true;
+		}
+
+		DE_TEST_ASSERT(didThrow);
+	}
+
+	checkAllVisitedOnce(0, 1000, 3);
+}
+
+} // de
@@ -0,0 +1,65 @@
+#ifndef _DEPARALLELFOR_HPP
+#define _DEPARALLELFOR_HPP
+/*-------------------------------------------------------------------------
+ * drawElements C++ Base Library
+ * -----------------------------
+ *
+ * Copyright 2019 The Android Open Source Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ *//*!
+ * \file
+ * \brief Parallel loop over an index range.
+ *//*--------------------------------------------------------------------*/
+
+#include "deDefs.hpp"
+
+namespace de
+{
+
+/*--------------------------------------------------------------------*//*!
+ * \brief Loop body for parallelFor()
+ *
+ * run() is called concurrently from several threads with disjoint
+ * index ranges.
+ *//*--------------------------------------------------------------------*/
+class RangeTask
+{
+public:
+	virtual			~RangeTask		(void) {}
+	virtual void	run				(int begin, int end) = 0;
+};
+
+/*--------------------------------------------------------------------*//*!
+ * \brief Run task over [begin, end) in chunks of grainSize indices
+ *
+ * Chunks are processed by the calling thread and a process-wide pool of
+ * worker threads, one per available core. If the pool is already busy,
+ * for example when called from within a task or from several threads at
+ * once, all chunks are processed on the calling thread.
+ *
+ * Returns once all chunks have been processed. If a chunk throws, no
+ * new chunks are started and the exception is rethrown on the calling
+ * thread with its original type, also when it was thrown on a worker.
+ *//*--------------------------------------------------------------------*/
+void	parallelFor				(int begin, int end, int grainSize, RangeTask& task);
+
+//! Number of threads parallelFor() can use, including the calling thread
+int		getParallelForNumThreads	(void);
+
+void	ParallelFor_selfTest	(void);
+
+} // de
+
+#endif // _DEPARALLELFOR_HPP
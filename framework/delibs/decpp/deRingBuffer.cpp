@@ -63,6 +63,20 @@ void RingBuffer_selfTest (void)
 				int			numBytes	= rnd.getInt(1, buffer.getNumElements());
 				vector<int>	tmp			(numBytes);
 
+				// Spans must cover all elements in order.
+				for (int offset = 0; offset < buffer.getNumElements();)
+				{
+					const int*	span		= DE_NULL;
+					const int	spanSize	= buffer.peekBackSpan(offset, &span);
+
+					DE_TEST_ASSERT(de::inRange(spanSize, 1, buffer.getNumElements()-offset));
+
+					for (int i = 0; i < spanSize; i++)
+						DE_TEST_ASSERT(span[i] == data[readPos+offset+i]);
+
+					offset += spanSize;
+				}
+
 				buffer.popBack(&tmp[0], numBytes);
 
 				for (int i = 0; i < numBytes; i++)
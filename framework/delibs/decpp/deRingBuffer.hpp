@@ -50,6 +50,7 @@ public:
 
 	void	peekBack		(T* elemBuf, int count) const;
 	T		peekBack		(int offset) const;
+	int		peekBackSpan	(int offset, const T** ptr) const;
 
 	T		popBack			(void);
 	void	popBack			(T* elemBuf, int count) { peekBack(elemBuf, count); popBack(count); }
@@ -131,8 +132,15 @@ template <typename T>
 void RingBuffer<T>::pushFront (const T* elemBuf, int count)
 {
 	DE_ASSERT(de::inRange(count, 0, getNumFree()));
-	for (int i = 0; i < count; i++)
-		m_buffer[(m_front + i) % m_size] = elemBuf[i];
+
+	// Copy in at most two contiguous parts
+	const int numFirst = de::min(count, m_size - m_front);
+
+	for (int i = 0; i < numFirst; i++)
+		m_buffer[m_front + i] = elemBuf[i];
+	for (int i = numFirst; i < count; i++)
+		m_buffer[i - numFirst] = elemBuf[i];
+
 	m_front = (m_front + count) % m_size;
 	m_numElements += count;
 }
@@ -154,12 +162,34 @@ inline T RingBuffer<T>::peekBack (int offset) const
 	return m_buffer[(m_back + offset) % m_size];
 }
 
+/*--------------------------------------------------------------------*//*!
+ * \brief Get contiguous span of elements starting at offset from back
+ *
+ * Stores pointer to element at offset into ptr and returns number of
+ * elements that can be accessed contiguously through it. Rest of the
+ * elements, if any, start at offset + returned count. Pointer is valid
+ * until buffer is modified.
+ *//*--------------------------------------------------------------------*/
+template <typename T>
+inline int RingBuffer<T>::peekBackSpan (int offset, const T** ptr) const
+{
+	DE_ASSERT(de::inBounds(offset, 0, getNumElements()));
+	const int pos = (m_back + offset) % m_size;
+	*ptr = &m_buffer[pos];
+	return de::min(m_size - pos, m_numElements - offset);
+}
+
 template <typename T>
 void RingBuffer<T>::peekBack (T* elemBuf, int count) const
 {
 	DE_ASSERT(de::inRange(count, 0, getNumElements()));
-	for (int i = 0; i < count; i++)
-		elemBuf[i] = m_buffer[(m_back + i) % m_size];
+
+	const int numFirst = de::min(count, m_size - m_back);
+
+	for (int i = 0; i < numFirst; i++)
+		elemBuf[i] = m_buffer[m_back + i];
+	for (int i = numFirst; i < count; i++)
+		elemBuf[i] = m_buffer[i - numFirst];
 }
 
 template <typename T>
@@ -26,6 +26,7 @@
 #include "deDefs.hpp"
 
 #include "deSha1.h"
+#include "deMemory.h"
 
 #include <string>
 #include <vector>
@@ -43,6 +44,7 @@ public:
 
 	bool		operator==	(const Sha1& other) const { return deSha1_equal(&m_hash, &other.m_hash) == DE_TRUE; }
 	bool		operator!=	(const Sha1& other) const { return !(*this == other); }
+	bool		operator<	(const Sha1& other) const { return deMemCmp(m_hash.hash, other.m_hash.hash, sizeof(m_hash.hash)) < 0; }
 
 private:
 	deSha1		m_hash;
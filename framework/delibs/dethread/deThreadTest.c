@@ -435,6 +435,21 @@ void deSemaphore_selfTest (void)
 		deSemaphore_destroy(semaphore);
 	}
 
+	/* Timed decrement test. */
+	{
+		deSemaphore	semaphore	= deSemaphore_create(1, DE_NULL);
+		DE_TEST_ASSERT(semaphore);
+
+		DE_TEST_ASSERT(deSemaphore_timedDecrement(semaphore, 0));
+		DE_TEST_ASSERT(!deSemaphore_timedDecrement(semaphore, 0));
+		DE_TEST_ASSERT(!deSemaphore_timedDecrement(semaphore, 2000));
+
+		deSemaphore_increment(semaphore);
+		DE_TEST_ASSERT(deSemaphore_timedDecrement(semaphore, 1000000));
+
+		deSemaphore_destroy(semaphore);
+	}
+
 	/* Producer-consumer test. */
 	{
 		TestBuffer	testBuffer;
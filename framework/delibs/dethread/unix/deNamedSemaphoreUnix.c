@@ -27,6 +27,7 @@
 
 #include "deMemory.h"
 #include "deString.h"
+#include "deThread.h"
 
 #include <semaphore.h>
 #include <unistd.h>
@@ -105,4 +106,22 @@ deBool deSemaphore_tryDecrement (deSemaphore semaphore)
 	return (sem_trywait(sem) == 0);
 }
 
+deBool deSemaphore_timedDecrement (deSemaphore semaphore, deUint64 timeoutUs)
+{
+	/* \note Named semaphores don't support sem_timedwait(), poll once per millisecond instead. */
+	deUint64 numPolls = (timeoutUs + 999u) / 1000u;
+
+	for (;;)
+	{
+		if (deSemaphore_tryDecrement(semaphore))
+			return DE_TRUE;
+
+		if (numPolls == 0)
+			return DE_FALSE;
+
+		deSleep(1);
+		numPolls -= 1;
+	}
+}
+
 #endif /* DE_OS */
@@ -28,6 +28,8 @@
 #include "deMemory.h"
 
 #include <semaphore.h>
+#include <time.h>
+#include <errno.h>
 
 DE_STATIC_ASSERT(sizeof(deSemaphore) >= sizeof(sem_t*));
 
@@ -81,4 +83,52 @@ deBool deSemaphore_tryDecrement (deSemaphore semaphore)
 	return (sem_trywait(sem) == 0);
 }
 
+static deUint64 getMonotonicTimeUs (void)
+{
+	struct timespec now;
+	clock_gettime(CLOCK_MONOTONIC, &now);
+	return (deUint64)now.tv_sec * 1000000u + (deUint64)(now.tv_nsec / 1000);
+}
+
+deBool deSemaphore_timedDecrement (deSemaphore semaphore, deUint64 timeoutUs)
+{
+	sem_t*			sem		= (sem_t*)semaphore;
+	const deUint64	endTime	= getMonotonicTimeUs() + timeoutUs;
+
+	DE_ASSERT(sem);
+
+	/* \note sem_timedwait() only accepts a CLOCK_REALTIME deadline, which moves if the wall clock is changed.
+	 *		 Each wait is limited to one second and the total time is measured with the monotonic clock. */
+	for (;;)
+	{
+		const deUint64	curTime		= getMonotonicTimeUs();
+		deUint64		waitUs;
+		struct timespec	deadline;
+
+		if (curTime >= endTime)
+			return (sem_trywait(sem) == 0);
+
+		waitUs = endTime - curTime;
+		if (waitUs > 1000000u)
+			waitUs = 1000000u;
+
+		clock_gettime(CLOCK_REALTIME, &deadline);
+
+		deadline.tv_sec		+= (time_t)(waitUs / 1000000u);
+		deadline.tv_nsec	+= (long)(waitUs % 1000000u) * 1000;
+
+		if (deadline.tv_nsec >= 1000000000)
+		{
+			deadline.tv_sec		+= 1;
+			deadline.tv_nsec	-= 1000000000;
+		}
+
+		if (sem_timedwait(sem, &deadline) == 0)
+			return DE_TRUE;
+
+		if (errno != EINTR && errno != ETIMEDOUT)
+			return DE_FALSE;
+	}
+}
+
 #endif /* DE_OS */
@@ -77,4 +77,12 @@ deBool deSemaphore_tryDecrement (deSemaphore semaphore)
 	return (ret == WAIT_OBJECT_0);
 }
 
+deBool deSemaphore_timedDecrement (deSemaphore semaphore, deUint64 timeoutUs)
+{
+	HANDLE		handle		= (HANDLE)semaphore;
+	deUint64	timeoutMs	= (timeoutUs + 999u) / 1000u;
+	DWORD		ret			= WaitForSingleObject(handle, timeoutMs < (deUint64)INFINITE ? (DWORD)timeoutMs : INFINITE-1);
+	return (ret == WAIT_OBJECT_0);
+}
+
 #endif /* DE_OS */
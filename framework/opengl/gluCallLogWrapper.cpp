@@ -36,6 +36,7 @@ CallLogWrapper::CallLogWrapper (const glw::Functions& gl, tcu::TestLog& log)
 	: m_gl			(gl)
 	, m_log			(log)
 	, m_enableLog	(false)
+	, m_callTrace	(CallTrace::getThreadTrace())
 {
 }
 
@@ -43,6 +44,26 @@ CallLogWrapper::~CallLogWrapper (void)
 {
 }
 
+void CallLogWrapper::enableCallTrace (int numRetainedCalls)
+{
+	if (!m_callTraceStorage || m_callTraceStorage->getCapacity() != numRetainedCalls)
+	{
+		m_callTraceStorage.clear();
+		m_callTraceStorage = de::MovePtr<CallTrace>(new CallTrace(numRetainedCalls));
+	}
+
+	m_callTrace = m_callTraceStorage.get();
+}
+
+void CallLogWrapper::writeCallTrace (void)
+{
+	if (m_callTraceStorage)
+	{
+		m_callTraceStorage->write(m_log);
+		m_callTraceStorage->clear();
+	}
+}
+
 template <typename T>
 inline tcu::Format::ArrayPointer<T> getPointerStr (const T* arr, deUint32 size)
 {
@@ -131,7 +152,8 @@ inline FboParamPtrFmt getFramebufferAttachmentParameterValueStr (deUint32 param,
 #include "gluQueryUtil.inl"
 #include "gluCallLogUtil.inl"
 
-// API entry-point implementations are auto-generated
+// Call trace function descriptions and API entry-point implementations are auto-generated
+#include "gluCallLogWrapperTrace.inl"
 #include "gluCallLogWrapper.inl"
 
 } // glu
@@ -24,8 +24,10 @@
  *//*--------------------------------------------------------------------*/
 
 #include "gluDefs.hpp"
+#include "gluCallTrace.hpp"
 #include "tcuTestLog.hpp"
 #include "glwDefs.hpp"
+#include "deUniquePtr.hpp"
 
 namespace glw
 {
@@ -48,10 +50,25 @@ public:
 	bool					isLoggingEnabled		(void)			{ return m_enableLog; }
 	tcu::TestLog&			getLog					(void)			{ return m_log; }
 
+	//! Record calls into a ring buffer of the last numRetainedCalls calls. Calls are formatted only in writeCallTrace().
+	void					enableCallTrace			(int numRetainedCalls = DEFAULT_TRACE_CAPACITY);
+	void					disableCallTrace		(void)			{ m_callTrace = DE_NULL; }
+	bool					isCallTraceEnabled		(void) const	{ return m_callTrace != DE_NULL; }
+
+	//! Write recorded calls into the log and clear the trace
+	void					writeCallTrace			(void);
+
+	enum
+	{
+		DEFAULT_TRACE_CAPACITY	= 1024
+	};
+
 private:
 	const glw::Functions&	m_gl;
 	tcu::TestLog&			m_log;
 	bool					m_enableLog;
+	de::MovePtr<CallTrace>	m_callTraceStorage;
+	CallTrace*				m_callTrace;		//!< Active trace, or null if tracing is disabled. Initially the thread trace (see CallTrace::setThreadTrace()).
 } DE_WARN_UNUSED_TYPE;
 
 } // glu
@@ -8,6 +8,11 @@ void CallLogWrapper::glActiveShaderProgram (glw::GLuint pipeline, glw::GLuint pr
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glActiveShaderProgram(" << pipeline << ", " << program << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(pipeline), CallTrace::pack(program) };
+		m_callTrace->record(s_glActiveShaderProgramTraceInfo, traceArgs);
+	}
 	m_gl.activeShaderProgram(pipeline, program);
 }
 
@@ -15,6 +20,11 @@ void CallLogWrapper::glActiveTexture (glw::GLenum texture)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glActiveTexture(" << getTextureUnitStr(texture) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(texture) };
+		m_callTrace->record(s_glActiveTextureTraceInfo, traceArgs);
+	}
 	m_gl.activeTexture(texture);
 }
 
@@ -22,6 +32,11 @@ void CallLogWrapper::glAttachShader (glw::GLuint program, glw::GLuint shader)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glAttachShader(" << program << ", " << shader << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(program), CallTrace::pack(shader) };
+		m_callTrace->record(s_glAttachShaderTraceInfo, traceArgs);
+	}
 	m_gl.attachShader(program, shader);
 }
 
@@ -29,6 +44,11 @@ void CallLogWrapper::glBeginConditionalRender (glw::GLuint id, glw::GLenum mode)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glBeginConditionalRender(" << id << ", " << toHex(mode) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(id), CallTrace::pack(mode) };
+		m_callTrace->record(s_glBeginConditionalRenderTraceInfo, traceArgs);
+	}
 	m_gl.beginConditionalRender(id, mode);
 }
 
@@ -36,6 +56,11 @@ void CallLogWrapper::glBeginQuery (glw::GLenum target, glw::GLuint id)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glBeginQuery(" << getQueryTargetStr(target) << ", " << id << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(target), CallTrace::pack(id) };
+		m_callTrace->record(s_glBeginQueryTraceInfo, traceArgs);
+	}
 	m_gl.beginQuery(target, id);
 }
 
@@ -43,6 +68,11 @@ void CallLogWrapper::glBeginQueryIndexed (glw::GLenum target, glw::GLuint index,
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glBeginQueryIndexed(" << toHex(target) << ", " << index << ", " << id << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(target), CallTrace::pack(index), CallTrace::pack(id) };
+		m_callTrace->record(s_glBeginQueryIndexedTraceInfo, traceArgs);
+	}
 	m_gl.beginQueryIndexed(target, index, id);
 }
 
@@ -50,6 +80,11 @@ void CallLogWrapper::glBeginTransformFeedback (glw::GLenum primitiveMode)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glBeginTransformFeedback(" << getPrimitiveTypeStr(primitiveMode) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(primitiveMode) };
+		m_callTrace->record(s_glBeginTransformFeedbackTraceInfo, traceArgs);
+	}
 	m_gl.beginTransformFeedback(primitiveMode);
 }
 
@@ -57,6 +92,11 @@ void CallLogWrapper::glBindAttribLocation (glw::GLuint program, glw::GLuint inde
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glBindAttribLocation(" << program << ", " << index << ", " << getStringStr(name) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(program), CallTrace::pack(index), CallTrace::pack(name) };
+		m_callTrace->record(s_glBindAttribLocationTraceInfo, traceArgs);
+	}
 	m_gl.bindAttribLocation(program, index, name);
 }
 
@@ -64,6 +104,11 @@ void CallLogWrapper::glBindBuffer (glw::GLenum target, glw::GLuint buffer)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glBindBuffer(" << getBufferTargetStr(target) << ", " << buffer << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(target), CallTrace::pack(buffer) };
+		m_callTrace->record(s_glBindBufferTraceInfo, traceArgs);
+	}
 	m_gl.bindBuffer(target, buffer);
 }
 
@@ -71,6 +116,11 @@ void CallLogWrapper::glBindBufferBase (glw::GLenum target, glw::GLuint index, gl
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glBindBufferBase(" << getBufferTargetStr(target) << ", " << index << ", " << buffer << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(target), CallTrace::pack(index), CallTrace::pack(buffer) };
+		m_callTrace->record(s_glBindBufferBaseTraceInfo, traceArgs);
+	}
 	m_gl.bindBufferBase(target, index, buffer);
 }
 
@@ -78,6 +128,11 @@ void CallLogWrapper::glBindBufferRange (glw::GLenum target, glw::GLuint index, g
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glBindBufferRange(" << getBufferTargetStr(target) << ", " << index << ", " << buffer << ", " << offset << ", " << size << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(target), CallTrace::pack(index), CallTrace::pack(buffer), CallTrace::pack(offset), CallTrace::pack(size) };
+		m_callTrace->record(s_glBindBufferRangeTraceInfo, traceArgs);
+	}
 	m_gl.bindBufferRange(target, index, buffer, offset, size);
 }
 
@@ -85,6 +140,11 @@ void CallLogWrapper::glBindBuffersBase (glw::GLenum target, glw::GLuint first, g
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glBindBuffersBase(" << toHex(target) << ", " << first << ", " << count << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(buffers))) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(target), CallTrace::pack(first), CallTrace::pack(count), CallTrace::pack(buffers) };
+		m_callTrace->record(s_glBindBuffersBaseTraceInfo, traceArgs);
+	}
 	m_gl.bindBuffersBase(target, first, count, buffers);
 }
 
@@ -92,6 +152,11 @@ void CallLogWrapper::glBindBuffersRange (glw::GLenum target, glw::GLuint first,
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glBindBuffersRange(" << toHex(target) << ", " << first << ", " << count << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(buffers))) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(offsets))) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(sizes))) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(target), CallTrace::pack(first), CallTrace::pack(count), CallTrace::pack(buffers), CallTrace::pack(offsets), CallTrace::pack(sizes) };
+		m_callTrace->record(s_glBindBuffersRangeTraceInfo, traceArgs);
+	}
 	m_gl.bindBuffersRange(target, first, count, buffers, offsets, sizes);
 }
 
@@ -99,6 +164,11 @@ void CallLogWrapper::glBindFragDataLocation (glw::GLuint program, glw::GLuint co
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glBindFragDataLocation(" << program << ", " << color << ", " << getStringStr(name) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(program), CallTrace::pack(color), CallTrace::pack(name) };
+		m_callTrace->record(s_glBindFragDataLocationTraceInfo, traceArgs);
+	}
 	m_gl.bindFragDataLocation(program, color, name);
 }
 
@@ -106,6 +176,11 @@ void CallLogWrapper::glBindFragDataLocationIndexed (glw::GLuint program, glw::GL
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glBindFragDataLocationIndexed(" << program << ", " << colorNumber << ", " << index << ", " << getStringStr(name) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(program), CallTrace::pack(colorNumber), CallTrace::pack(index), CallTrace::pack(name) };
+		m_callTrace->record(s_glBindFragDataLocationIndexedTraceInfo, traceArgs);
+	}
 	m_gl.bindFragDataLocationIndexed(program, colorNumber, index, name);
 }
 
@@ -113,6 +188,11 @@ void CallLogWrapper::glBindFramebuffer (glw::GLenum target, glw::GLuint framebuf
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glBindFramebuffer(" << getFramebufferTargetStr(target) << ", " << framebuffer << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(target), CallTrace::pack(framebuffer) };
+		m_callTrace->record(s_glBindFramebufferTraceInfo, traceArgs);
+	}
 	m_gl.bindFramebuffer(target, framebuffer);
 }
 
@@ -120,6 +200,11 @@ void CallLogWrapper::glBindImageTexture (glw::GLuint unit, glw::GLuint texture,
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glBindImageTexture(" << unit << ", " << texture << ", " << level << ", " << getBooleanStr(layered) << ", " << layer << ", " << getImageAccessStr(access) << ", " << getUncompressedTextureFormatStr(format) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(unit), CallTrace::pack(texture), CallTrace::pack(level), CallTrace::pack(layered), CallTrace::pack(layer), CallTrace::pack(access), CallTrace::pack(format) };
+		m_callTrace->record(s_glBindImageTextureTraceInfo, traceArgs);
+	}
 	m_gl.bindImageTexture(unit, texture, level, layered, layer, access, format);
 }
 
@@ -127,6 +212,11 @@ void CallLogWrapper::glBindImageTextures (glw::GLuint first, glw::GLsizei count,
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glBindImageTextures(" << first << ", " << count << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(textures))) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(first), CallTrace::pack(count), CallTrace::pack(textures) };
+		m_callTrace->record(s_glBindImageTexturesTraceInfo, traceArgs);
+	}
 	m_gl.bindImageTextures(first, count, textures);
 }
 
@@ -134,6 +224,11 @@ void CallLogWrapper::glBindMultiTextureEXT (glw::GLenum texunit, glw::GLenum tar
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glBindMultiTextureEXT(" << toHex(texunit) << ", " << toHex(target) << ", " << texture << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(texunit), CallTrace::pack(target), CallTrace::pack(texture) };
+		m_callTrace->record(s_glBindMultiTextureEXTTraceInfo, traceArgs);
+	}
 	m_gl.bindMultiTextureEXT(texunit, target, texture);
 }
 
@@ -141,6 +236,11 @@ void CallLogWrapper::glBindProgramPipeline (glw::GLuint pipeline)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glBindProgramPipeline(" << pipeline << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(pipeline) };
+		m_callTrace->record(s_glBindProgramPipelineTraceInfo, traceArgs);
+	}
 	m_gl.bindProgramPipeline(pipeline);
 }
 
@@ -148,6 +248,11 @@ void CallLogWrapper::glBindRenderbuffer (glw::GLenum target, glw::GLuint renderb
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glBindRenderbuffer(" << getFramebufferTargetStr(target) << ", " << renderbuffer << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(target), CallTrace::pack(renderbuffer) };
+		m_callTrace->record(s_glBindRenderbufferTraceInfo, traceArgs);
+	}
 	m_gl.bindRenderbuffer(target, renderbuffer);
 }
 
@@ -155,6 +260,11 @@ void CallLogWrapper::glBindSampler (glw::GLuint unit, glw::GLuint sampler)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glBindSampler(" << unit << ", " << sampler << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(unit), CallTrace::pack(sampler) };
+		m_callTrace->record(s_glBindSamplerTraceInfo, traceArgs);
+	}
 	m_gl.bindSampler(unit, sampler);
 }
 
@@ -162,6 +272,11 @@ void CallLogWrapper::glBindSamplers (glw::GLuint first, glw::GLsizei count, cons
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glBindSamplers(" << first << ", " << count << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(samplers))) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(first), CallTrace::pack(count), CallTrace::pack(samplers) };
+		m_callTrace->record(s_glBindSamplersTraceInfo, traceArgs);
+	}
 	m_gl.bindSamplers(first, count, samplers);
 }
 
@@ -169,6 +284,11 @@ void CallLogWrapper::glBindTexture (glw::GLenum target, glw::GLuint texture)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glBindTexture(" << getTextureTargetStr(target) << ", " << texture << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(target), CallTrace::pack(texture) };
+		m_callTrace->record(s_glBindTextureTraceInfo, traceArgs);
+	}
 	m_gl.bindTexture(target, texture);
 }
 
@@ -176,6 +296,11 @@ void CallLogWrapper::glBindTextureUnit (glw::GLuint unit, glw::GLuint texture)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glBindTextureUnit(" << unit << ", " << texture << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(unit), CallTrace::pack(texture) };
+		m_callTrace->record(s_glBindTextureUnitTraceInfo, traceArgs);
+	}
 	m_gl.bindTextureUnit(unit, texture);
 }
 
@@ -183,6 +308,11 @@ void CallLogWrapper::glBindTextures (glw::GLuint first, glw::GLsizei count, cons
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glBindTextures(" << first << ", " << count << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(textures))) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(first), CallTrace::pack(count), CallTrace::pack(textures) };
+		m_callTrace->record(s_glBindTexturesTraceInfo, traceArgs);
+	}
 	m_gl.bindTextures(first, count, textures);
 }
 
@@ -190,6 +320,11 @@ void CallLogWrapper::glBindTransformFeedback (glw::GLenum target, glw::GLuint id
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glBindTransformFeedback(" << getTransformFeedbackTargetStr(target) << ", " << id << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(target), CallTrace::pack(id) };
+		m_callTrace->record(s_glBindTransformFeedbackTraceInfo, traceArgs);
+	}
 	m_gl.bindTransformFeedback(target, id);
 }
 
@@ -197,6 +332,11 @@ void CallLogWrapper::glBindVertexArray (glw::GLuint array)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glBindVertexArray(" << array << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(array) };
+		m_callTrace->record(s_glBindVertexArrayTraceInfo, traceArgs);
+	}
 	m_gl.bindVertexArray(array);
 }
 
@@ -204,6 +344,11 @@ void CallLogWrapper::glBindVertexBuffer (glw::GLuint bindingindex, glw::GLuint b
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glBindVertexBuffer(" << bindingindex << ", " << buffer << ", " << offset << ", " << stride << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(bindingindex), CallTrace::pack(buffer), CallTrace::pack(offset), CallTrace::pack(stride) };
+		m_callTrace->record(s_glBindVertexBufferTraceInfo, traceArgs);
+	}
 	m_gl.bindVertexBuffer(bindingindex, buffer, offset, stride);
 }
 
@@ -211,6 +356,11 @@ void CallLogWrapper::glBindVertexBuffers (glw::GLuint first, glw::GLsizei count,
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glBindVertexBuffers(" << first << ", " << count << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(buffers))) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(offsets))) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(strides))) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(first), CallTrace::pack(count), CallTrace::pack(buffers), CallTrace::pack(offsets), CallTrace::pack(strides) };
+		m_callTrace->record(s_glBindVertexBuffersTraceInfo, traceArgs);
+	}
 	m_gl.bindVertexBuffers(first, count, buffers, offsets, strides);
 }
 
@@ -218,6 +368,8 @@ void CallLogWrapper::glBlendBarrier (void)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glBlendBarrier(" << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+		m_callTrace->record(s_glBlendBarrierTraceInfo, DE_NULL);
 	m_gl.blendBarrier();
 }
 
@@ -225,6 +377,11 @@ void CallLogWrapper::glBlendColor (glw::GLfloat red, glw::GLfloat green, glw::GL
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glBlendColor(" << red << ", " << green << ", " << blue << ", " << alpha << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(red), CallTrace::pack(green), CallTrace::pack(blue), CallTrace::pack(alpha) };
+		m_callTrace->record(s_glBlendColorTraceInfo, traceArgs);
+	}
 	m_gl.blendColor(red, green, blue, alpha);
 }
 
@@ -232,6 +389,11 @@ void CallLogWrapper::glBlendEquation (glw::GLenum mode)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glBlendEquation(" << getBlendEquationStr(mode) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(mode) };
+		m_callTrace->record(s_glBlendEquationTraceInfo, traceArgs);
+	}
 	m_gl.blendEquation(mode);
 }
 
@@ -239,6 +401,11 @@ void CallLogWrapper::glBlendEquationSeparate (glw::GLenum modeRGB, glw::GLenum m
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glBlendEquationSeparate(" << getBlendEquationStr(modeRGB) << ", " << getBlendEquationStr(modeAlpha) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(modeRGB), CallTrace::pack(modeAlpha) };
+		m_callTrace->record(s_glBlendEquationSeparateTraceInfo, traceArgs);
+	}
 	m_gl.blendEquationSeparate(modeRGB, modeAlpha);
 }
 
@@ -246,6 +413,11 @@ void CallLogWrapper::glBlendEquationSeparatei (glw::GLuint buf, glw::GLenum mode
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glBlendEquationSeparatei(" << buf << ", " << getBlendEquationStr(modeRGB) << ", " << getBlendEquationStr(modeAlpha) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(buf), CallTrace::pack(modeRGB), CallTrace::pack(modeAlpha) };
+		m_callTrace->record(s_glBlendEquationSeparateiTraceInfo, traceArgs);
+	}
 	m_gl.blendEquationSeparatei(buf, modeRGB, modeAlpha);
 }
 
@@ -253,6 +425,11 @@ void CallLogWrapper::glBlendEquationi (glw::GLuint buf, glw::GLenum mode)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glBlendEquationi(" << buf << ", " << getBlendEquationStr(mode) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(buf), CallTrace::pack(mode) };
+		m_callTrace->record(s_glBlendEquationiTraceInfo, traceArgs);
+	}
 	m_gl.blendEquationi(buf, mode);
 }
 
@@ -260,6 +437,11 @@ void CallLogWrapper::glBlendFunc (glw::GLenum sfactor, glw::GLenum dfactor)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glBlendFunc(" << getBlendFactorStr(sfactor) << ", " << getBlendFactorStr(dfactor) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(sfactor), CallTrace::pack(dfactor) };
+		m_callTrace->record(s_glBlendFuncTraceInfo, traceArgs);
+	}
 	m_gl.blendFunc(sfactor, dfactor);
 }
 
@@ -267,6 +449,11 @@ void CallLogWrapper::glBlendFuncSeparate (glw::GLenum sfactorRGB, glw::GLenum df
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glBlendFuncSeparate(" << getBlendFactorStr(sfactorRGB) << ", " << getBlendFactorStr(dfactorRGB) << ", " << getBlendFactorStr(sfactorAlpha) << ", " << getBlendFactorStr(dfactorAlpha) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(sfactorRGB), CallTrace::pack(dfactorRGB), CallTrace::pack(sfactorAlpha), CallTrace::pack(dfactorAlpha) };
+		m_callTrace->record(s_glBlendFuncSeparateTraceInfo, traceArgs);
+	}
 	m_gl.blendFuncSeparate(sfactorRGB, dfactorRGB, sfactorAlpha, dfactorAlpha);
 }
 
@@ -274,6 +461,11 @@ void CallLogWrapper::glBlendFuncSeparatei (glw::GLuint buf, glw::GLenum srcRGB,
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glBlendFuncSeparatei(" << buf << ", " << toHex(srcRGB) << ", " << toHex(dstRGB) << ", " << toHex(srcAlpha) << ", " << toHex(dstAlpha) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(buf), CallTrace::pack(srcRGB), CallTrace::pack(dstRGB), CallTrace::pack(srcAlpha), CallTrace::pack(dstAlpha) };
+		m_callTrace->record(s_glBlendFuncSeparateiTraceInfo, traceArgs);
+	}
 	m_gl.blendFuncSeparatei(buf, srcRGB, dstRGB, srcAlpha, dstAlpha);
 }
 
@@ -281,6 +473,11 @@ void CallLogWrapper::glBlendFunci (glw::GLuint buf, glw::GLenum src, glw::GLenum
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glBlendFunci(" << buf << ", " << toHex(src) << ", " << toHex(dst) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(buf), CallTrace::pack(src), CallTrace::pack(dst) };
+		m_callTrace->record(s_glBlendFunciTraceInfo, traceArgs);
+	}
 	m_gl.blendFunci(buf, src, dst);
 }
 
@@ -288,6 +485,11 @@ void CallLogWrapper::glBlitFramebuffer (glw::GLint srcX0, glw::GLint srcY0, glw:
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glBlitFramebuffer(" << srcX0 << ", " << srcY0 << ", " << srcX1 << ", " << srcY1 << ", " << dstX0 << ", " << dstY0 << ", " << dstX1 << ", " << dstY1 << ", " << getBufferMaskStr(mask) << ", " << getTextureFilterStr(filter) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(srcX0), CallTrace::pack(srcY0), CallTrace::pack(srcX1), CallTrace::pack(srcY1), CallTrace::pack(dstX0), CallTrace::pack(dstY0), CallTrace::pack(dstX1), CallTrace::pack(dstY1), CallTrace::pack(mask), CallTrace::pack(filter) };
+		m_callTrace->record(s_glBlitFramebufferTraceInfo, traceArgs);
+	}
 	m_gl.blitFramebuffer(srcX0, srcY0, srcX1, srcY1, dstX0, dstY0, dstX1, dstY1, mask, filter);
 }
 
@@ -295,6 +497,11 @@ void CallLogWrapper::glBlitNamedFramebuffer (glw::GLuint readFramebuffer, glw::G
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glBlitNamedFramebuffer(" << readFramebuffer << ", " << drawFramebuffer << ", " << srcX0 << ", " << srcY0 << ", " << srcX1 << ", " << srcY1 << ", " << dstX0 << ", " << dstY0 << ", " << dstX1 << ", " << dstY1 << ", " << toHex(mask) << ", " << toHex(filter) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(readFramebuffer), CallTrace::pack(drawFramebuffer), CallTrace::pack(srcX0), CallTrace::pack(srcY0), CallTrace::pack(srcX1), CallTrace::pack(srcY1), CallTrace::pack(dstX0), CallTrace::pack(dstY0), CallTrace::pack(dstX1), CallTrace::pack(dstY1), CallTrace::pack(mask), CallTrace::pack(filter) };
+		m_callTrace->record(s_glBlitNamedFramebufferTraceInfo, traceArgs);
+	}
 	m_gl.blitNamedFramebuffer(readFramebuffer, drawFramebuffer, srcX0, srcY0, srcX1, srcY1, dstX0, dstY0, dstX1, dstY1, mask, filter);
 }
 
@@ -302,6 +509,11 @@ void CallLogWrapper::glBufferData (glw::GLenum target, glw::GLsizeiptr size, con
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glBufferData(" << getBufferTargetStr(target) << ", " << size << ", " << data << ", " << getUsageStr(usage) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(target), CallTrace::pack(size), CallTrace::pack(data), CallTrace::pack(usage) };
+		m_callTrace->record(s_glBufferDataTraceInfo, traceArgs);
+	}
 	m_gl.bufferData(target, size, data, usage);
 }
 
@@ -309,6 +521,11 @@ void CallLogWrapper::glBufferPageCommitmentARB (glw::GLenum target, glw::GLintpt
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glBufferPageCommitmentARB(" << toHex(target) << ", " << offset << ", " << size << ", " << getBooleanStr(commit) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(target), CallTrace::pack(offset), CallTrace::pack(size), CallTrace::pack(commit) };
+		m_callTrace->record(s_glBufferPageCommitmentARBTraceInfo, traceArgs);
+	}
 	m_gl.bufferPageCommitmentARB(target, offset, size, commit);
 }
 
@@ -316,6 +533,11 @@ void CallLogWrapper::glBufferStorage (glw::GLenum target, glw::GLsizeiptr size,
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glBufferStorage(" << toHex(target) << ", " << size << ", " << data << ", " << toHex(flags) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(target), CallTrace::pack(size), CallTrace::pack(data), CallTrace::pack(flags) };
+		m_callTrace->record(s_glBufferStorageTraceInfo, traceArgs);
+	}
 	m_gl.bufferStorage(target, size, data, flags);
 }
 
@@ -323,6 +545,11 @@ void CallLogWrapper::glBufferSubData (glw::GLenum target, glw::GLintptr offset,
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glBufferSubData(" << getBufferTargetStr(target) << ", " << offset << ", " << size << ", " << data << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(target), CallTrace::pack(offset), CallTrace::pack(size), CallTrace::pack(data) };
+		m_callTrace->record(s_glBufferSubDataTraceInfo, traceArgs);
+	}
 	m_gl.bufferSubData(target, offset, size, data);
 }
 
@@ -330,9 +557,16 @@ glw::GLenum CallLogWrapper::glCheckFramebufferStatus (glw::GLenum target)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glCheckFramebufferStatus(" << getFramebufferTargetStr(target) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(target) };
+		m_callTrace->record(s_glCheckFramebufferStatusTraceInfo, traceArgs);
+	}
 	glw::GLenum returnValue = m_gl.checkFramebufferStatus(target);
 	if (m_enableLog)
 		m_log << TestLog::Message << "// " << getFramebufferStatusStr(returnValue) << " returned" << TestLog::EndMessage;
+	if (m_callTrace)
+		m_callTrace->setReturnValue(CallTrace::pack(returnValue));
 	return returnValue;
 }
 
@@ -340,9 +574,16 @@ glw::GLenum CallLogWrapper::glCheckNamedFramebufferStatus (glw::GLuint framebuff
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glCheckNamedFramebufferStatus(" << framebuffer << ", " << toHex(target) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(framebuffer), CallTrace::pack(target) };
+		m_callTrace->record(s_glCheckNamedFramebufferStatusTraceInfo, traceArgs);
+	}
 	glw::GLenum returnValue = m_gl.checkNamedFramebufferStatus(framebuffer, target);
 	if (m_enableLog)
 		m_log << TestLog::Message << "// " << toHex(returnValue) << " returned" << TestLog::EndMessage;
+	if (m_callTrace)
+		m_callTrace->setReturnValue(CallTrace::pack(returnValue));
 	return returnValue;
 }
 
@@ -350,9 +591,16 @@ glw::GLenum CallLogWrapper::glCheckNamedFramebufferStatusEXT (glw::GLuint frameb
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glCheckNamedFramebufferStatusEXT(" << framebuffer << ", " << toHex(target) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(framebuffer), CallTrace::pack(target) };
+		m_callTrace->record(s_glCheckNamedFramebufferStatusEXTTraceInfo, traceArgs);
+	}
 	glw::GLenum returnValue = m_gl.checkNamedFramebufferStatusEXT(framebuffer, target);
 	if (m_enableLog)
 		m_log << TestLog::Message << "// " << toHex(returnValue) << " returned" << TestLog::EndMessage;
+	if (m_callTrace)
+		m_callTrace->setReturnValue(CallTrace::pack(returnValue));
 	return returnValue;
 }
 
@@ -360,6 +608,11 @@ void CallLogWrapper::glClampColor (glw::GLenum target, glw::GLenum clamp)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glClampColor(" << toHex(target) << ", " << toHex(clamp) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(target), CallTrace::pack(clamp) };
+		m_callTrace->record(s_glClampColorTraceInfo, traceArgs);
+	}
 	m_gl.clampColor(target, clamp);
 }
 
@@ -367,6 +620,11 @@ void CallLogWrapper::glClear (glw::GLbitfield mask)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glClear(" << getBufferMaskStr(mask) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(mask) };
+		m_callTrace->record(s_glClearTraceInfo, traceArgs);
+	}
 	m_gl.clear(mask);
 }
 
@@ -374,6 +632,11 @@ void CallLogWrapper::glClearBufferData (glw::GLenum target, glw::GLenum internal
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glClearBufferData(" << toHex(target) << ", " << toHex(internalformat) << ", " << toHex(format) << ", " << toHex(type) << ", " << data << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(target), CallTrace::pack(internalformat), CallTrace::pack(format), CallTrace::pack(type), CallTrace::pack(data) };
+		m_callTrace->record(s_glClearBufferDataTraceInfo, traceArgs);
+	}
 	m_gl.clearBufferData(target, internalformat, format, type, data);
 }
 
@@ -381,6 +644,11 @@ void CallLogWrapper::glClearBufferSubData (glw::GLenum target, glw::GLenum inter
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glClearBufferSubData(" << toHex(target) << ", " << toHex(internalformat) << ", " << offset << ", " << size << ", " << toHex(format) << ", " << toHex(type) << ", " << data << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(target), CallTrace::pack(internalformat), CallTrace::pack(offset), CallTrace::pack(size), CallTrace::pack(format), CallTrace::pack(type), CallTrace::pack(data) };
+		m_callTrace->record(s_glClearBufferSubDataTraceInfo, traceArgs);
+	}
 	m_gl.clearBufferSubData(target, internalformat, offset, size, format, type, data);
 }
 
@@ -388,6 +656,11 @@ void CallLogWrapper::glClearBufferfi (glw::GLenum buffer, glw::GLint drawbuffer,
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glClearBufferfi(" << getBufferStr(buffer) << ", " << drawbuffer << ", " << depth << ", " << stencil << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(buffer), CallTrace::pack(drawbuffer), CallTrace::pack(depth), CallTrace::pack(stencil) };
+		m_callTrace->record(s_glClearBufferfiTraceInfo, traceArgs);
+	}
 	m_gl.clearBufferfi(buffer, drawbuffer, depth, stencil);
 }
 
@@ -395,6 +668,11 @@ void CallLogWrapper::glClearBufferfv (glw::GLenum buffer, glw::GLint drawbuffer,
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glClearBufferfv(" << getBufferStr(buffer) << ", " << drawbuffer << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(value))) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(buffer), CallTrace::pack(drawbuffer), CallTrace::pack(value) };
+		m_callTrace->record(s_glClearBufferfvTraceInfo, traceArgs);
+	}
 	m_gl.clearBufferfv(buffer, drawbuffer, value);
 }
 
@@ -402,6 +680,11 @@ void CallLogWrapper::glClearBufferiv (glw::GLenum buffer, glw::GLint drawbuffer,
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glClearBufferiv(" << getBufferStr(buffer) << ", " << drawbuffer << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(value))) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(buffer), CallTrace::pack(drawbuffer), CallTrace::pack(value) };
+		m_callTrace->record(s_glClearBufferivTraceInfo, traceArgs);
+	}
 	m_gl.clearBufferiv(buffer, drawbuffer, value);
 }
 
@@ -409,6 +692,11 @@ void CallLogWrapper::glClearBufferuiv (glw::GLenum buffer, glw::GLint drawbuffer
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glClearBufferuiv(" << getBufferStr(buffer) << ", " << drawbuffer << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(value))) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(buffer), CallTrace::pack(drawbuffer), CallTrace::pack(value) };
+		m_callTrace->record(s_glClearBufferuivTraceInfo, traceArgs);
+	}
 	m_gl.clearBufferuiv(buffer, drawbuffer, value);
 }
 
@@ -416,6 +704,11 @@ void CallLogWrapper::glClearColor (glw::GLfloat red, glw::GLfloat green, glw::GL
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glClearColor(" << red << ", " << green << ", " << blue << ", " << alpha << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(red), CallTrace::pack(green), CallTrace::pack(blue), CallTrace::pack(alpha) };
+		m_callTrace->record(s_glClearColorTraceInfo, traceArgs);
+	}
 	m_gl.clearColor(red, green, blue, alpha);
 }
 
@@ -423,6 +716,11 @@ void CallLogWrapper::glClearDepth (glw::GLdouble depth)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glClearDepth(" << depth << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(depth) };
+		m_callTrace->record(s_glClearDepthTraceInfo, traceArgs);
+	}
 	m_gl.clearDepth(depth);
 }
 
@@ -430,6 +728,11 @@ void CallLogWrapper::glClearDepthf (glw::GLfloat d)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glClearDepthf(" << d << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(d) };
+		m_callTrace->record(s_glClearDepthfTraceInfo, traceArgs);
+	}
 	m_gl.clearDepthf(d);
 }
 
@@ -437,6 +740,11 @@ void CallLogWrapper::glClearNamedBufferData (glw::GLuint buffer, glw::GLenum int
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glClearNamedBufferData(" << buffer << ", " << toHex(internalformat) << ", " << toHex(format) << ", " << toHex(type) << ", " << data << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(buffer), CallTrace::pack(internalformat), CallTrace::pack(format), CallTrace::pack(type), CallTrace::pack(data) };
+		m_callTrace->record(s_glClearNamedBufferDataTraceInfo, traceArgs);
+	}
 	m_gl.clearNamedBufferData(buffer, internalformat, format, type, data);
 }
 
@@ -444,6 +752,11 @@ void CallLogWrapper::glClearNamedBufferDataEXT (glw::GLuint buffer, glw::GLenum
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glClearNamedBufferDataEXT(" << buffer << ", " << toHex(internalformat) << ", " << toHex(format) << ", " << toHex(type) << ", " << data << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(buffer), CallTrace::pack(internalformat), CallTrace::pack(format), CallTrace::pack(type), CallTrace::pack(data) };
+		m_callTrace->record(s_glClearNamedBufferDataEXTTraceInfo, traceArgs);
+	}
 	m_gl.clearNamedBufferDataEXT(buffer, internalformat, format, type, data);
 }
 
@@ -451,6 +764,11 @@ void CallLogWrapper::glClearNamedBufferSubData (glw::GLuint buffer, glw::GLenum
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glClearNamedBufferSubData(" << buffer << ", " << toHex(internalformat) << ", " << offset << ", " << size << ", " << toHex(format) << ", " << toHex(type) << ", " << data << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(buffer), CallTrace::pack(internalformat), CallTrace::pack(offset), CallTrace::pack(size), CallTrace::pack(format), CallTrace::pack(type), CallTrace::pack(data) };
+		m_callTrace->record(s_glClearNamedBufferSubDataTraceInfo, traceArgs);
+	}
 	m_gl.clearNamedBufferSubData(buffer, internalformat, offset, size, format, type, data);
 }
 
@@ -458,6 +776,11 @@ void CallLogWrapper::glClearNamedBufferSubDataEXT (glw::GLuint buffer, glw::GLen
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glClearNamedBufferSubDataEXT(" << buffer << ", " << toHex(internalformat) << ", " << offset << ", " << size << ", " << toHex(format) << ", " << toHex(type) << ", " << data << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(buffer), CallTrace::pack(internalformat), CallTrace::pack(offset), CallTrace::pack(size), CallTrace::pack(format), CallTrace::pack(type), CallTrace::pack(data) };
+		m_callTrace->record(s_glClearNamedBufferSubDataEXTTraceInfo, traceArgs);
+	}
 	m_gl.clearNamedBufferSubDataEXT(buffer, internalformat, offset, size, format, type, data);
 }
 
@@ -465,6 +788,11 @@ void CallLogWrapper::glClearNamedFramebufferfi (glw::GLuint framebuffer, glw::GL
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glClearNamedFramebufferfi(" << framebuffer << ", " << toHex(buffer) << ", " << drawbuffer << ", " << depth << ", " << stencil << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(framebuffer), CallTrace::pack(buffer), CallTrace::pack(drawbuffer), CallTrace::pack(depth), CallTrace::pack(stencil) };
+		m_callTrace->record(s_glClearNamedFramebufferfiTraceInfo, traceArgs);
+	}
 	m_gl.clearNamedFramebufferfi(framebuffer, buffer, drawbuffer, depth, stencil);
 }
 
@@ -472,6 +800,11 @@ void CallLogWrapper::glClearNamedFramebufferfv (glw::GLuint framebuffer, glw::GL
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glClearNamedFramebufferfv(" << framebuffer << ", " << toHex(buffer) << ", " << drawbuffer << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(value))) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(framebuffer), CallTrace::pack(buffer), CallTrace::pack(drawbuffer), CallTrace::pack(value) };
+		m_callTrace->record(s_glClearNamedFramebufferfvTraceInfo, traceArgs);
+	}
 	m_gl.clearNamedFramebufferfv(framebuffer, buffer, drawbuffer, value);
 }
 
@@ -479,6 +812,11 @@ void CallLogWrapper::glClearNamedFramebufferiv (glw::GLuint framebuffer, glw::GL
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glClearNamedFramebufferiv(" << framebuffer << ", " << toHex(buffer) << ", " << drawbuffer << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(value))) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(framebuffer), CallTrace::pack(buffer), CallTrace::pack(drawbuffer), CallTrace::pack(value) };
+		m_callTrace->record(s_glClearNamedFramebufferivTraceInfo, traceArgs);
+	}
 	m_gl.clearNamedFramebufferiv(framebuffer, buffer, drawbuffer, value);
 }
 
@@ -486,6 +824,11 @@ void CallLogWrapper::glClearNamedFramebufferuiv (glw::GLuint framebuffer, glw::G
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glClearNamedFramebufferuiv(" << framebuffer << ", " << toHex(buffer) << ", " << drawbuffer << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(value))) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(framebuffer), CallTrace::pack(buffer), CallTrace::pack(drawbuffer), CallTrace::pack(value) };
+		m_callTrace->record(s_glClearNamedFramebufferuivTraceInfo, traceArgs);
+	}
 	m_gl.clearNamedFramebufferuiv(framebuffer, buffer, drawbuffer, value);
 }
 
@@ -493,6 +836,11 @@ void CallLogWrapper::glClearStencil (glw::GLint s)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glClearStencil(" << s << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(s) };
+		m_callTrace->record(s_glClearStencilTraceInfo, traceArgs);
+	}
 	m_gl.clearStencil(s);
 }
 
@@ -500,6 +848,11 @@ void CallLogWrapper::glClearTexImage (glw::GLuint texture, glw::GLint level, glw
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glClearTexImage(" << texture << ", " << level << ", " << toHex(format) << ", " << toHex(type) << ", " << data << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(texture), CallTrace::pack(level), CallTrace::pack(format), CallTrace::pack(type), CallTrace::pack(data) };
+		m_callTrace->record(s_glClearTexImageTraceInfo, traceArgs);
+	}
 	m_gl.clearTexImage(texture, level, format, type, data);
 }
 
@@ -507,6 +860,11 @@ void CallLogWrapper::glClearTexSubImage (glw::GLuint texture, glw::GLint level,
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glClearTexSubImage(" << texture << ", " << level << ", " << xoffset << ", " << yoffset << ", " << zoffset << ", " << width << ", " << height << ", " << depth << ", " << toHex(format) << ", " << toHex(type) << ", " << data << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(texture), CallTrace::pack(level), CallTrace::pack(xoffset), CallTrace::pack(yoffset), CallTrace::pack(zoffset), CallTrace::pack(width), CallTrace::pack(height), CallTrace::pack(depth), CallTrace::pack(format), CallTrace::pack(type), CallTrace::pack(data) };
+		m_callTrace->record(s_glClearTexSubImageTraceInfo, traceArgs);
+	}
 	m_gl.clearTexSubImage(texture, level, xoffset, yoffset, zoffset, width, height, depth, format, type, data);
 }
 
@@ -514,6 +872,11 @@ void CallLogWrapper::glClientAttribDefaultEXT (glw::GLbitfield mask)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glClientAttribDefaultEXT(" << toHex(mask) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(mask) };
+		m_callTrace->record(s_glClientAttribDefaultEXTTraceInfo, traceArgs);
+	}
 	m_gl.clientAttribDefaultEXT(mask);
 }
 
@@ -521,9 +884,16 @@ glw::GLenum CallLogWrapper::glClientWaitSync (glw::GLsync sync, glw::GLbitfield
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glClientWaitSync(" << sync << ", " << toHex(flags) << ", " << timeout << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(sync), CallTrace::pack(flags), CallTrace::pack(timeout) };
+		m_callTrace->record(s_glClientWaitSyncTraceInfo, traceArgs);
+	}
 	glw::GLenum returnValue = m_gl.clientWaitSync(sync, flags, timeout);
 	if (m_enableLog)
 		m_log << TestLog::Message << "// " << toHex(returnValue) << " returned" << TestLog::EndMessage;
+	if (m_callTrace)
+		m_callTrace->setReturnValue(CallTrace::pack(returnValue));
 	return returnValue;
 }
 
@@ -531,6 +901,11 @@ void CallLogWrapper::glClipControl (glw::GLenum origin, glw::GLenum depth)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glClipControl(" << toHex(origin) << ", " << toHex(depth) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(origin), CallTrace::pack(depth) };
+		m_callTrace->record(s_glClipControlTraceInfo, traceArgs);
+	}
 	m_gl.clipControl(origin, depth);
 }
 
@@ -538,6 +913,11 @@ void CallLogWrapper::glColorMask (glw::GLboolean red, glw::GLboolean green, glw:
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glColorMask(" << getBooleanStr(red) << ", " << getBooleanStr(green) << ", " << getBooleanStr(blue) << ", " << getBooleanStr(alpha) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(red), CallTrace::pack(green), CallTrace::pack(blue), CallTrace::pack(alpha) };
+		m_callTrace->record(s_glColorMaskTraceInfo, traceArgs);
+	}
 	m_gl.colorMask(red, green, blue, alpha);
 }
 
@@ -545,6 +925,11 @@ void CallLogWrapper::glColorMaski (glw::GLuint index, glw::GLboolean r, glw::GLb
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glColorMaski(" << index << ", " << getBooleanStr(r) << ", " << getBooleanStr(g) << ", " << getBooleanStr(b) << ", " << getBooleanStr(a) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(index), CallTrace::pack(r), CallTrace::pack(g), CallTrace::pack(b), CallTrace::pack(a) };
+		m_callTrace->record(s_glColorMaskiTraceInfo, traceArgs);
+	}
 	m_gl.colorMaski(index, r, g, b, a);
 }
 
@@ -552,6 +937,11 @@ void CallLogWrapper::glCompileShader (glw::GLuint shader)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glCompileShader(" << shader << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(shader) };
+		m_callTrace->record(s_glCompileShaderTraceInfo, traceArgs);
+	}
 	m_gl.compileShader(shader);
 }
 
@@ -559,6 +949,11 @@ void CallLogWrapper::glCompressedMultiTexImage1DEXT (glw::GLenum texunit, glw::G
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glCompressedMultiTexImage1DEXT(" << toHex(texunit) << ", " << toHex(target) << ", " << level << ", " << toHex(internalformat) << ", " << width << ", " << border << ", " << imageSize << ", " << bits << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(texunit), CallTrace::pack(target), CallTrace::pack(level), CallTrace::pack(internalformat), CallTrace::pack(width), CallTrace::pack(border), CallTrace::pack(imageSize), CallTrace::pack(bits) };
+		m_callTrace->record(s_glCompressedMultiTexImage1DEXTTraceInfo, traceArgs);
+	}
 	m_gl.compressedMultiTexImage1DEXT(texunit, target, level, internalformat, width, border, imageSize, bits);
 }
 
@@ -566,6 +961,11 @@ void CallLogWrapper::glCompressedMultiTexImage2DEXT (glw::GLenum texunit, glw::G
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glCompressedMultiTexImage2DEXT(" << toHex(texunit) << ", " << toHex(target) << ", " << level << ", " << toHex(internalformat) << ", " << width << ", " << height << ", " << border << ", " << imageSize << ", " << bits << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(texunit), CallTrace::pack(target), CallTrace::pack(level), CallTrace::pack(internalformat), CallTrace::pack(width), CallTrace::pack(height), CallTrace::pack(border), CallTrace::pack(imageSize), CallTrace::pack(bits) };
+		m_callTrace->record(s_glCompressedMultiTexImage2DEXTTraceInfo, traceArgs);
+	}
 	m_gl.compressedMultiTexImage2DEXT(texunit, target, level, internalformat, width, height, border, imageSize, bits);
 }
 
@@ -573,6 +973,11 @@ void CallLogWrapper::glCompressedMultiTexImage3DEXT (glw::GLenum texunit, glw::G
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glCompressedMultiTexImage3DEXT(" << toHex(texunit) << ", " << toHex(target) << ", " << level << ", " << toHex(internalformat) << ", " << width << ", " << height << ", " << depth << ", " << border << ", " << imageSize << ", " << bits << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(texunit), CallTrace::pack(target), CallTrace::pack(level), CallTrace::pack(internalformat), CallTrace::pack(width), CallTrace::pack(height), CallTrace::pack(depth), CallTrace::pack(border), CallTrace::pack(imageSize), CallTrace::pack(bits) };
+		m_callTrace->record(s_glCompressedMultiTexImage3DEXTTraceInfo, traceArgs);
+	}
 	m_gl.compressedMultiTexImage3DEXT(texunit, target, level, internalformat, width, height, depth, border, imageSize, bits);
 }
 
@@ -580,6 +985,11 @@ void CallLogWrapper::glCompressedMultiTexSubImage1DEXT (glw::GLenum texunit, glw
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glCompressedMultiTexSubImage1DEXT(" << toHex(texunit) << ", " << toHex(target) << ", " << level << ", " << xoffset << ", " << width << ", " << toHex(format) << ", " << imageSize << ", " << bits << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(texunit), CallTrace::pack(target), CallTrace::pack(level), CallTrace::pack(xoffset), CallTrace::pack(width), CallTrace::pack(format), CallTrace::pack(imageSize), CallTrace::pack(bits) };
+		m_callTrace->record(s_glCompressedMultiTexSubImage1DEXTTraceInfo, traceArgs);
+	}
 	m_gl.compressedMultiTexSubImage1DEXT(texunit, target, level, xoffset, width, format, imageSize, bits);
 }
 
@@ -587,6 +997,11 @@ void CallLogWrapper::glCompressedMultiTexSubImage2DEXT (glw::GLenum texunit, glw
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glCompressedMultiTexSubImage2DEXT(" << toHex(texunit) << ", " << toHex(target) << ", " << level << ", " << xoffset << ", " << yoffset << ", " << width << ", " << height << ", " << toHex(format) << ", " << imageSize << ", " << bits << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(texunit), CallTrace::pack(target), CallTrace::pack(level), CallTrace::pack(xoffset), CallTrace::pack(yoffset), CallTrace::pack(width), CallTrace::pack(height), CallTrace::pack(format), CallTrace::pack(imageSize), CallTrace::pack(bits) };
+		m_callTrace->record(s_glCompressedMultiTexSubImage2DEXTTraceInfo, traceArgs);
+	}
 	m_gl.compressedMultiTexSubImage2DEXT(texunit, target, level, xoffset, yoffset, width, height, format, imageSize, bits);
 }
 
@@ -594,6 +1009,11 @@ void CallLogWrapper::glCompressedMultiTexSubImage3DEXT (glw::GLenum texunit, glw
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glCompressedMultiTexSubImage3DEXT(" << toHex(texunit) << ", " << toHex(target) << ", " << level << ", " << xoffset << ", " << yoffset << ", " << zoffset << ", " << width << ", " << height << ", " << depth << ", " << toHex(format) << ", " << imageSize << ", " << bits << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(texunit), CallTrace::pack(target), CallTrace::pack(level), CallTrace::pack(xoffset), CallTrace::pack(yoffset), CallTrace::pack(zoffset), CallTrace::pack(width), CallTrace::pack(height), CallTrace::pack(depth), CallTrace::pack(format), CallTrace::pack(imageSize), CallTrace::pack(bits) };
+		m_callTrace->record(s_glCompressedMultiTexSubImage3DEXTTraceInfo, traceArgs);
+	}
 	m_gl.compressedMultiTexSubImage3DEXT(texunit, target, level, xoffset, yoffset, zoffset, width, height, depth, format, imageSize, bits);
 }
 
@@ -601,6 +1021,11 @@ void CallLogWrapper::glCompressedTexImage1D (glw::GLenum target, glw::GLint leve
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glCompressedTexImage1D(" << toHex(target) << ", " << level << ", " << toHex(internalformat) << ", " << width << ", " << border << ", " << imageSize << ", " << data << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(target), CallTrace::pack(level), CallTrace::pack(internalformat), CallTrace::pack(width), CallTrace::pack(border), CallTrace::pack(imageSize), CallTrace::pack(data) };
+		m_callTrace->record(s_glCompressedTexImage1DTraceInfo, traceArgs);
+	}
 	m_gl.compressedTexImage1D(target, level, internalformat, width, border, imageSize, data);
 }
 
@@ -608,6 +1033,11 @@ void CallLogWrapper::glCompressedTexImage2D (glw::GLenum target, glw::GLint leve
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glCompressedTexImage2D(" << getTextureTargetStr(target) << ", " << level << ", " << getCompressedTextureFormatStr(internalformat) << ", " << width << ", " << height << ", " << border << ", " << imageSize << ", " << data << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(target), CallTrace::pack(level), CallTrace::pack(internalformat), CallTrace::pack(width), CallTrace::pack(height), CallTrace::pack(border), CallTrace::pack(imageSize), CallTrace::pack(data) };
+		m_callTrace->record(s_glCompressedTexImage2DTraceInfo, traceArgs);
+	}
 	m_gl.compressedTexImage2D(target, level, internalformat, width, height, border, imageSize, data);
 }
 
@@ -615,6 +1045,11 @@ void CallLogWrapper::glCompressedTexImage3D (glw::GLenum target, glw::GLint leve
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glCompressedTexImage3D(" << getTextureTargetStr(target) << ", " << level << ", " << getCompressedTextureFormatStr(internalformat) << ", " << width << ", " << height << ", " << depth << ", " << border << ", " << imageSize << ", " << data << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(target), CallTrace::pack(level), CallTrace::pack(internalformat), CallTrace::pack(width), CallTrace::pack(height), CallTrace::pack(depth), CallTrace::pack(border), CallTrace::pack(imageSize), CallTrace::pack(data) };
+		m_callTrace->record(s_glCompressedTexImage3DTraceInfo, traceArgs);
+	}
 	m_gl.compressedTexImage3D(target, level, internalformat, width, height, depth, border, imageSize, data);
 }
 
@@ -622,6 +1057,11 @@ void CallLogWrapper::glCompressedTexImage3DOES (glw::GLenum target, glw::GLint l
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glCompressedTexImage3DOES(" << toHex(target) << ", " << level << ", " << toHex(internalformat) << ", " << width << ", " << height << ", " << depth << ", " << border << ", " << imageSize << ", " << data << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(target), CallTrace::pack(level), CallTrace::pack(internalformat), CallTrace::pack(width), CallTrace::pack(height), CallTrace::pack(depth), CallTrace::pack(border), CallTrace::pack(imageSize), CallTrace::pack(data) };
+		m_callTrace->record(s_glCompressedTexImage3DOESTraceInfo, traceArgs);
+	}
 	m_gl.compressedTexImage3DOES(target, level, internalformat, width, height, depth, border, imageSize, data);
 }
 
@@ -629,6 +1069,11 @@ void CallLogWrapper::glCompressedTexSubImage1D (glw::GLenum target, glw::GLint l
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glCompressedTexSubImage1D(" << toHex(target) << ", " << level << ", " << xoffset << ", " << width << ", " << toHex(format) << ", " << imageSize << ", " << data << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(target), CallTrace::pack(level), CallTrace::pack(xoffset), CallTrace::pack(width), CallTrace::pack(format), CallTrace::pack(imageSize), CallTrace::pack(data) };
+		m_callTrace->record(s_glCompressedTexSubImage1DTraceInfo, traceArgs);
+	}
 	m_gl.compressedTexSubImage1D(target, level, xoffset, width, format, imageSize, data);
 }
 
@@ -636,6 +1081,11 @@ void CallLogWrapper::glCompressedTexSubImage2D (glw::GLenum target, glw::GLint l
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glCompressedTexSubImage2D(" << getTextureTargetStr(target) << ", " << level << ", " << xoffset << ", " << yoffset << ", " << width << ", " << height << ", " << getCompressedTextureFormatStr(format) << ", " << imageSize << ", " << data << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(target), CallTrace::pack(level), CallTrace::pack(xoffset), CallTrace::pack(yoffset), CallTrace::pack(width), CallTrace::pack(height), CallTrace::pack(format), CallTrace::pack(imageSize), CallTrace::pack(data) };
+		m_callTrace->record(s_glCompressedTexSubImage2DTraceInfo, traceArgs);
+	}
 	m_gl.compressedTexSubImage2D(target, level, xoffset, yoffset, width, height, format, imageSize, data);
 }
 
@@ -643,6 +1093,11 @@ void CallLogWrapper::glCompressedTexSubImage3D (glw::GLenum target, glw::GLint l
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glCompressedTexSubImage3D(" << getTextureTargetStr(target) << ", " << level << ", " << xoffset << ", " << yoffset << ", " << zoffset << ", " << width << ", " << height << ", " << depth << ", " << getCompressedTextureFormatStr(format) << ", " << imageSize << ", " << data << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(target), CallTrace::pack(level), CallTrace::pack(xoffset), CallTrace::pack(yoffset), CallTrace::pack(zoffset), CallTrace::pack(width), CallTrace::pack(height), CallTrace::pack(depth), CallTrace::pack(format), CallTrace::pack(imageSize), CallTrace::pack(data) };
+		m_callTrace->record(s_glCompressedTexSubImage3DTraceInfo, traceArgs);
+	}
 	m_gl.compressedTexSubImage3D(target, level, xoffset, yoffset, zoffset, width, height, depth, format, imageSize, data);
 }
 
@@ -650,6 +1105,11 @@ void CallLogWrapper::glCompressedTexSubImage3DOES (glw::GLenum target, glw::GLin
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glCompressedTexSubImage3DOES(" << toHex(target) << ", " << level << ", " << xoffset << ", " << yoffset << ", " << zoffset << ", " << width << ", " << height << ", " << depth << ", " << toHex(format) << ", " << imageSize << ", " << data << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(target), CallTrace::pack(level), CallTrace::pack(xoffset), CallTrace::pack(yoffset), CallTrace::pack(zoffset), CallTrace::pack(width), CallTrace::pack(height), CallTrace::pack(depth), CallTrace::pack(format), CallTrace::pack(imageSize), CallTrace::pack(data) };
+		m_callTrace->record(s_glCompressedTexSubImage3DOESTraceInfo, traceArgs);
+	}
 	m_gl.compressedTexSubImage3DOES(target, level, xoffset, yoffset, zoffset, width, height, depth, format, imageSize, data);
 }
 
@@ -657,6 +1117,11 @@ void CallLogWrapper::glCompressedTextureImage1DEXT (glw::GLuint texture, glw::GL
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glCompressedTextureImage1DEXT(" << texture << ", " << toHex(target) << ", " << level << ", " << toHex(internalformat) << ", " << width << ", " << border << ", " << imageSize << ", " << bits << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(texture), CallTrace::pack(target), CallTrace::pack(level), CallTrace::pack(internalformat), CallTrace::pack(width), CallTrace::pack(border), CallTrace::pack(imageSize), CallTrace::pack(bits) };
+		m_callTrace->record(s_glCompressedTextureImage1DEXTTraceInfo, traceArgs);
+	}
 	m_gl.compressedTextureImage1DEXT(texture, target, level, internalformat, width, border, imageSize, bits);
 }
 
@@ -664,6 +1129,11 @@ void CallLogWrapper::glCompressedTextureImage2DEXT (glw::GLuint texture, glw::GL
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glCompressedTextureImage2DEXT(" << texture << ", " << toHex(target) << ", " << level << ", " << toHex(internalformat) << ", " << width << ", " << height << ", " << border << ", " << imageSize << ", " << bits << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(texture), CallTrace::pack(target), CallTrace::pack(level), CallTrace::pack(internalformat), CallTrace::pack(width), CallTrace::pack(height), CallTrace::pack(border), CallTrace::pack(imageSize), CallTrace::pack(bits) };
+		m_callTrace->record(s_glCompressedTextureImage2DEXTTraceInfo, traceArgs);
+	}
 	m_gl.compressedTextureImage2DEXT(texture, target, level, internalformat, width, height, border, imageSize, bits);
 }
 
@@ -671,6 +1141,11 @@ void CallLogWrapper::glCompressedTextureImage3DEXT (glw::GLuint texture, glw::GL
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glCompressedTextureImage3DEXT(" << texture << ", " << toHex(target) << ", " << level << ", " << toHex(internalformat) << ", " << width << ", " << height << ", " << depth << ", " << border << ", " << imageSize << ", " << bits << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(texture), CallTrace::pack(target), CallTrace::pack(level), CallTrace::pack(internalformat), CallTrace::pack(width), CallTrace::pack(height), CallTrace::pack(depth), CallTrace::pack(border), CallTrace::pack(imageSize), CallTrace::pack(bits) };
+		m_callTrace->record(s_glCompressedTextureImage3DEXTTraceInfo, traceArgs);
+	}
 	m_gl.compressedTextureImage3DEXT(texture, target, level, internalformat, width, height, depth, border, imageSize, bits);
 }
 
@@ -678,6 +1153,11 @@ void CallLogWrapper::glCompressedTextureSubImage1D (glw::GLuint texture, glw::GL
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glCompressedTextureSubImage1D(" << texture << ", " << level << ", " << xoffset << ", " << width << ", " << toHex(format) << ", " << imageSize << ", " << data << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(texture), CallTrace::pack(level), CallTrace::pack(xoffset), CallTrace::pack(width), CallTrace::pack(format), CallTrace::pack(imageSize), CallTrace::pack(data) };
+		m_callTrace->record(s_glCompressedTextureSubImage1DTraceInfo, traceArgs);
+	}
 	m_gl.compressedTextureSubImage1D(texture, level, xoffset, width, format, imageSize, data);
 }
 
@@ -685,6 +1165,11 @@ void CallLogWrapper::glCompressedTextureSubImage1DEXT (glw::GLuint texture, glw:
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glCompressedTextureSubImage1DEXT(" << texture << ", " << toHex(target) << ", " << level << ", " << xoffset << ", " << width << ", " << toHex(format) << ", " << imageSize << ", " << bits << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(texture), CallTrace::pack(target), CallTrace::pack(level), CallTrace::pack(xoffset), CallTrace::pack(width), CallTrace::pack(format), CallTrace::pack(imageSize), CallTrace::pack(bits) };
+		m_callTrace->record(s_glCompressedTextureSubImage1DEXTTraceInfo, traceArgs);
+	}
 	m_gl.compressedTextureSubImage1DEXT(texture, target, level, xoffset, width, format, imageSize, bits);
 }
 
@@ -692,6 +1177,11 @@ void CallLogWrapper::glCompressedTextureSubImage2D (glw::GLuint texture, glw::GL
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glCompressedTextureSubImage2D(" << texture << ", " << level << ", " << xoffset << ", " << yoffset << ", " << width << ", " << height << ", " << toHex(format) << ", " << imageSize << ", " << data << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(texture), CallTrace::pack(level), CallTrace::pack(xoffset), CallTrace::pack(yoffset), CallTrace::pack(width), CallTrace::pack(height), CallTrace::pack(format), CallTrace::pack(imageSize), CallTrace::pack(data) };
+		m_callTrace->record(s_glCompressedTextureSubImage2DTraceInfo, traceArgs);
+	}
 	m_gl.compressedTextureSubImage2D(texture, level, xoffset, yoffset, width, height, format, imageSize, data);
 }
 
@@ -699,6 +1189,11 @@ void CallLogWrapper::glCompressedTextureSubImage2DEXT (glw::GLuint texture, glw:
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glCompressedTextureSubImage2DEXT(" << texture << ", " << toHex(target) << ", " << level << ", " << xoffset << ", " << yoffset << ", " << width << ", " << height << ", " << toHex(format) << ", " << imageSize << ", " << bits << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(texture), CallTrace::pack(target), CallTrace::pack(level), CallTrace::pack(xoffset), CallTrace::pack(yoffset), CallTrace::pack(width), CallTrace::pack(height), CallTrace::pack(format), CallTrace::pack(imageSize), CallTrace::pack(bits) };
+		m_callTrace->record(s_glCompressedTextureSubImage2DEXTTraceInfo, traceArgs);
+	}
 	m_gl.compressedTextureSubImage2DEXT(texture, target, level, xoffset, yoffset, width, height, format, imageSize, bits);
 }
 
@@ -706,6 +1201,11 @@ void CallLogWrapper::glCompressedTextureSubImage3D (glw::GLuint texture, glw::GL
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glCompressedTextureSubImage3D(" << texture << ", " << level << ", " << xoffset << ", " << yoffset << ", " << zoffset << ", " << width << ", " << height << ", " << depth << ", " << toHex(format) << ", " << imageSize << ", " << data << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(texture), CallTrace::pack(level), CallTrace::pack(xoffset), CallTrace::pack(yoffset), CallTrace::pack(zoffset), CallTrace::pack(width), CallTrace::pack(height), CallTrace::pack(depth), CallTrace::pack(format), CallTrace::pack(imageSize), CallTrace::pack(data) };
+		m_callTrace->record(s_glCompressedTextureSubImage3DTraceInfo, traceArgs);
+	}
 	m_gl.compressedTextureSubImage3D(texture, level, xoffset, yoffset, zoffset, width, height, depth, format, imageSize, data);
 }
 
@@ -713,6 +1213,11 @@ void CallLogWrapper::glCompressedTextureSubImage3DEXT (glw::GLuint texture, glw:
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glCompressedTextureSubImage3DEXT(" << texture << ", " << toHex(target) << ", " << level << ", " << xoffset << ", " << yoffset << ", " << zoffset << ", " << width << ", " << height << ", " << depth << ", " << toHex(format) << ", " << imageSize << ", " << bits << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(texture), CallTrace::pack(target), CallTrace::pack(level), CallTrace::pack(xoffset), CallTrace::pack(yoffset), CallTrace::pack(zoffset), CallTrace::pack(width), CallTrace::pack(height), CallTrace::pack(depth), CallTrace::pack(format), CallTrace::pack(imageSize), CallTrace::pack(bits) };
+		m_callTrace->record(s_glCompressedTextureSubImage3DEXTTraceInfo, traceArgs);
+	}
 	m_gl.compressedTextureSubImage3DEXT(texture, target, level, xoffset, yoffset, zoffset, width, height, depth, format, imageSize, bits);
 }
 
@@ -720,6 +1225,11 @@ void CallLogWrapper::glCopyBufferSubData (glw::GLenum readTarget, glw::GLenum wr
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glCopyBufferSubData(" << toHex(readTarget) << ", " << toHex(writeTarget) << ", " << readOffset << ", " << writeOffset << ", " << size << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(readTarget), CallTrace::pack(writeTarget), CallTrace::pack(readOffset), CallTrace::pack(writeOffset), CallTrace::pack(size) };
+		m_callTrace->record(s_glCopyBufferSubDataTraceInfo, traceArgs);
+	}
 	m_gl.copyBufferSubData(readTarget, writeTarget, readOffset, writeOffset, size);
 }
 
@@ -727,6 +1237,11 @@ void CallLogWrapper::glCopyImageSubData (glw::GLuint srcName, glw::GLenum srcTar
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glCopyImageSubData(" << srcName << ", " << toHex(srcTarget) << ", " << srcLevel << ", " << srcX << ", " << srcY << ", " << srcZ << ", " << dstName << ", " << toHex(dstTarget) << ", " << dstLevel << ", " << dstX << ", " << dstY << ", " << dstZ << ", " << srcWidth << ", " << srcHeight << ", " << srcDepth << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(srcName), CallTrace::pack(srcTarget), CallTrace::pack(srcLevel), CallTrace::pack(srcX), CallTrace::pack(srcY), CallTrace::pack(srcZ), CallTrace::pack(dstName), CallTrace::pack(dstTarget), CallTrace::pack(dstLevel), CallTrace::pack(dstX), CallTrace::pack(dstY), CallTrace::pack(dstZ), CallTrace::pack(srcWidth), CallTrace::pack(srcHeight), CallTrace::pack(srcDepth) };
+		m_callTrace->record(s_glCopyImageSubDataTraceInfo, traceArgs);
+	}
 	m_gl.copyImageSubData(srcName, srcTarget, srcLevel, srcX, srcY, srcZ, dstName, dstTarget, dstLevel, dstX, dstY, dstZ, srcWidth, srcHeight, srcDepth);
 }
 
@@ -734,6 +1249,11 @@ void CallLogWrapper::glCopyMultiTexImage1DEXT (glw::GLenum texunit, glw::GLenum
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glCopyMultiTexImage1DEXT(" << toHex(texunit) << ", " << toHex(target) << ", " << level << ", " << toHex(internalformat) << ", " << x << ", " << y << ", " << width << ", " << border << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(texunit), CallTrace::pack(target), CallTrace::pack(level), CallTrace::pack(internalformat), CallTrace::pack(x), CallTrace::pack(y), CallTrace::pack(width), CallTrace::pack(border) };
+		m_callTrace->record(s_glCopyMultiTexImage1DEXTTraceInfo, traceArgs);
+	}
 	m_gl.copyMultiTexImage1DEXT(texunit, target, level, internalformat, x, y, width, border);
 }
 
@@ -741,6 +1261,11 @@ void CallLogWrapper::glCopyMultiTexImage2DEXT (glw::GLenum texunit, glw::GLenum
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glCopyMultiTexImage2DEXT(" << toHex(texunit) << ", " << toHex(target) << ", " << level << ", " << toHex(internalformat) << ", " << x << ", " << y << ", " << width << ", " << height << ", " << border << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(texunit), CallTrace::pack(target), CallTrace::pack(level), CallTrace::pack(internalformat), CallTrace::pack(x), CallTrace::pack(y), CallTrace::pack(width), CallTrace::pack(height), CallTrace::pack(border) };
+		m_callTrace->record(s_glCopyMultiTexImage2DEXTTraceInfo, traceArgs);
+	}
 	m_gl.copyMultiTexImage2DEXT(texunit, target, level, internalformat, x, y, width, height, border);
 }
 
@@ -748,6 +1273,11 @@ void CallLogWrapper::glCopyMultiTexSubImage1DEXT (glw::GLenum texunit, glw::GLen
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glCopyMultiTexSubImage1DEXT(" << toHex(texunit) << ", " << toHex(target) << ", " << level << ", " << xoffset << ", " << x << ", " << y << ", " << width << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(texunit), CallTrace::pack(target), CallTrace::pack(level), CallTrace::pack(xoffset), CallTrace::pack(x), CallTrace::pack(y), CallTrace::pack(width) };
+		m_callTrace->record(s_glCopyMultiTexSubImage1DEXTTraceInfo, traceArgs);
+	}
 	m_gl.copyMultiTexSubImage1DEXT(texunit, target, level, xoffset, x, y, width);
 }
 
@@ -755,6 +1285,11 @@ void CallLogWrapper::glCopyMultiTexSubImage2DEXT (glw::GLenum texunit, glw::GLen
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glCopyMultiTexSubImage2DEXT(" << toHex(texunit) << ", " << toHex(target) << ", " << level << ", " << xoffset << ", " << yoffset << ", " << x << ", " << y << ", " << width << ", " << height << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(texunit), CallTrace::pack(target), CallTrace::pack(level), CallTrace::pack(xoffset), CallTrace::pack(yoffset), CallTrace::pack(x), CallTrace::pack(y), CallTrace::pack(width), CallTrace::pack(height) };
+		m_callTrace->record(s_glCopyMultiTexSubImage2DEXTTraceInfo, traceArgs);
+	}
 	m_gl.copyMultiTexSubImage2DEXT(texunit, target, level, xoffset, yoffset, x, y, width, height);
 }
 
@@ -762,6 +1297,11 @@ void CallLogWrapper::glCopyMultiTexSubImage3DEXT (glw::GLenum texunit, glw::GLen
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glCopyMultiTexSubImage3DEXT(" << toHex(texunit) << ", " << toHex(target) << ", " << level << ", " << xoffset << ", " << yoffset << ", " << zoffset << ", " << x << ", " << y << ", " << width << ", " << height << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(texunit), CallTrace::pack(target), CallTrace::pack(level), CallTrace::pack(xoffset), CallTrace::pack(yoffset), CallTrace::pack(zoffset), CallTrace::pack(x), CallTrace::pack(y), CallTrace::pack(width), CallTrace::pack(height) };
+		m_callTrace->record(s_glCopyMultiTexSubImage3DEXTTraceInfo, traceArgs);
+	}
 	m_gl.copyMultiTexSubImage3DEXT(texunit, target, level, xoffset, yoffset, zoffset, x, y, width, height);
 }
 
@@ -769,6 +1309,11 @@ void CallLogWrapper::glCopyNamedBufferSubData (glw::GLuint readBuffer, glw::GLui
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glCopyNamedBufferSubData(" << readBuffer << ", " << writeBuffer << ", " << readOffset << ", " << writeOffset << ", " << size << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(readBuffer), CallTrace::pack(writeBuffer), CallTrace::pack(readOffset), CallTrace::pack(writeOffset), CallTrace::pack(size) };
+		m_callTrace->record(s_glCopyNamedBufferSubDataTraceInfo, traceArgs);
+	}
 	m_gl.copyNamedBufferSubData(readBuffer, writeBuffer, readOffset, writeOffset, size);
 }
 
@@ -776,6 +1321,11 @@ void CallLogWrapper::glCopyTexImage1D (glw::GLenum target, glw::GLint level, glw
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glCopyTexImage1D(" << getTextureTargetStr(target) << ", " << level << ", " << getUncompressedTextureFormatStr(internalformat) << ", " << x << ", " << y << ", " << width << ", " << border << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(target), CallTrace::pack(level), CallTrace::pack(internalformat), CallTrace::pack(x), CallTrace::pack(y), CallTrace::pack(width), CallTrace::pack(border) };
+		m_callTrace->record(s_glCopyTexImage1DTraceInfo, traceArgs);
+	}
 	m_gl.copyTexImage1D(target, level, internalformat, x, y, width, border);
 }
 
@@ -783,6 +1333,11 @@ void CallLogWrapper::glCopyTexImage2D (glw::GLenum target, glw::GLint level, glw
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glCopyTexImage2D(" << getTextureTargetStr(target) << ", " << level << ", " << getUncompressedTextureFormatStr(internalformat) << ", " << x << ", " << y << ", " << width << ", " << height << ", " << border << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(target), CallTrace::pack(level), CallTrace::pack(internalformat), CallTrace::pack(x), CallTrace::pack(y), CallTrace::pack(width), CallTrace::pack(height), CallTrace::pack(border) };
+		m_callTrace->record(s_glCopyTexImage2DTraceInfo, traceArgs);
+	}
 	m_gl.copyTexImage2D(target, level, internalformat, x, y, width, height, border);
 }
 
@@ -790,6 +1345,11 @@ void CallLogWrapper::glCopyTexSubImage1D (glw::GLenum target, glw::GLint level,
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glCopyTexSubImage1D(" << toHex(target) << ", " << level << ", " << xoffset << ", " << x << ", " << y << ", " << width << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(target), CallTrace::pack(level), CallTrace::pack(xoffset), CallTrace::pack(x), CallTrace::pack(y), CallTrace::pack(width) };
+		m_callTrace->record(s_glCopyTexSubImage1DTraceInfo, traceArgs);
+	}
 	m_gl.copyTexSubImage1D(target, level, xoffset, x, y, width);
 }
 
@@ -797,6 +1357,11 @@ void CallLogWrapper::glCopyTexSubImage2D (glw::GLenum target, glw::GLint level,
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glCopyTexSubImage2D(" << toHex(target) << ", " << level << ", " << xoffset << ", " << yoffset << ", " << x << ", " << y << ", " << width << ", " << height << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(target), CallTrace::pack(level), CallTrace::pack(xoffset), CallTrace::pack(yoffset), CallTrace::pack(x), CallTrace::pack(y), CallTrace::pack(width), CallTrace::pack(height) };
+		m_callTrace->record(s_glCopyTexSubImage2DTraceInfo, traceArgs);
+	}
 	m_gl.copyTexSubImage2D(target, level, xoffset, yoffset, x, y, width, height);
 }
 
@@ -804,6 +1369,11 @@ void CallLogWrapper::glCopyTexSubImage3D (glw::GLenum target, glw::GLint level,
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glCopyTexSubImage3D(" << toHex(target) << ", " << level << ", " << xoffset << ", " << yoffset << ", " << zoffset << ", " << x << ", " << y << ", " << width << ", " << height << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(target), CallTrace::pack(level), CallTrace::pack(xoffset), CallTrace::pack(yoffset), CallTrace::pack(zoffset), CallTrace::pack(x), CallTrace::pack(y), CallTrace::pack(width), CallTrace::pack(height) };
+		m_callTrace->record(s_glCopyTexSubImage3DTraceInfo, traceArgs);
+	}
 	m_gl.copyTexSubImage3D(target, level, xoffset, yoffset, zoffset, x, y, width, height);
 }
 
@@ -811,6 +1381,11 @@ void CallLogWrapper::glCopyTexSubImage3DOES (glw::GLenum target, glw::GLint leve
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glCopyTexSubImage3DOES(" << toHex(target) << ", " << level << ", " << xoffset << ", " << yoffset << ", " << zoffset << ", " << x << ", " << y << ", " << width << ", " << height << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(target), CallTrace::pack(level), CallTrace::pack(xoffset), CallTrace::pack(yoffset), CallTrace::pack(zoffset), CallTrace::pack(x), CallTrace::pack(y), CallTrace::pack(width), CallTrace::pack(height) };
+		m_callTrace->record(s_glCopyTexSubImage3DOESTraceInfo, traceArgs);
+	}
 	m_gl.copyTexSubImage3DOES(target, level, xoffset, yoffset, zoffset, x, y, width, height);
 }
 
@@ -818,6 +1393,11 @@ void CallLogWrapper::glCopyTextureImage1DEXT (glw::GLuint texture, glw::GLenum t
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glCopyTextureImage1DEXT(" << texture << ", " << toHex(target) << ", " << level << ", " << toHex(internalformat) << ", " << x << ", " << y << ", " << width << ", " << border << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(texture), CallTrace::pack(target), CallTrace::pack(level), CallTrace::pack(internalformat), CallTrace::pack(x), CallTrace::pack(y), CallTrace::pack(width), CallTrace::pack(border) };
+		m_callTrace->record(s_glCopyTextureImage1DEXTTraceInfo, traceArgs);
+	}
 	m_gl.copyTextureImage1DEXT(texture, target, level, internalformat, x, y, width, border);
 }
 
@@ -825,6 +1405,11 @@ void CallLogWrapper::glCopyTextureImage2DEXT (glw::GLuint texture, glw::GLenum t
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glCopyTextureImage2DEXT(" << texture << ", " << toHex(target) << ", " << level << ", " << toHex(internalformat) << ", " << x << ", " << y << ", " << width << ", " << height << ", " << border << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(texture), CallTrace::pack(target), CallTrace::pack(level), CallTrace::pack(internalformat), CallTrace::pack(x), CallTrace::pack(y), CallTrace::pack(width), CallTrace::pack(height), CallTrace::pack(border) };
+		m_callTrace->record(s_glCopyTextureImage2DEXTTraceInfo, traceArgs);
+	}
 	m_gl.copyTextureImage2DEXT(texture, target, level, internalformat, x, y, width, height, border);
 }
 
@@ -832,6 +1417,11 @@ void CallLogWrapper::glCopyTextureSubImage1D (glw::GLuint texture, glw::GLint le
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glCopyTextureSubImage1D(" << texture << ", " << level << ", " << xoffset << ", " << x << ", " << y << ", " << width << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(texture), CallTrace::pack(level), CallTrace::pack(xoffset), CallTrace::pack(x), CallTrace::pack(y), CallTrace::pack(width) };
+		m_callTrace->record(s_glCopyTextureSubImage1DTraceInfo, traceArgs);
+	}
 	m_gl.copyTextureSubImage1D(texture, level, xoffset, x, y, width);
 }
 
@@ -839,6 +1429,11 @@ void CallLogWrapper::glCopyTextureSubImage1DEXT (glw::GLuint texture, glw::GLenu
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glCopyTextureSubImage1DEXT(" << texture << ", " << toHex(target) << ", " << level << ", " << xoffset << ", " << x << ", " << y << ", " << width << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(texture), CallTrace::pack(target), CallTrace::pack(level), CallTrace::pack(xoffset), CallTrace::pack(x), CallTrace::pack(y), CallTrace::pack(width) };
+		m_callTrace->record(s_glCopyTextureSubImage1DEXTTraceInfo, traceArgs);
+	}
 	m_gl.copyTextureSubImage1DEXT(texture, target, level, xoffset, x, y, width);
 }
 
@@ -846,6 +1441,11 @@ void CallLogWrapper::glCopyTextureSubImage2D (glw::GLuint texture, glw::GLint le
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glCopyTextureSubImage2D(" << texture << ", " << level << ", " << xoffset << ", " << yoffset << ", " << x << ", " << y << ", " << width << ", " << height << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(texture), CallTrace::pack(level), CallTrace::pack(xoffset), CallTrace::pack(yoffset), CallTrace::pack(x), CallTrace::pack(y), CallTrace::pack(width), CallTrace::pack(height) };
+		m_callTrace->record(s_glCopyTextureSubImage2DTraceInfo, traceArgs);
+	}
 	m_gl.copyTextureSubImage2D(texture, level, xoffset, yoffset, x, y, width, height);
 }
 
@@ -853,6 +1453,11 @@ void CallLogWrapper::glCopyTextureSubImage2DEXT (glw::GLuint texture, glw::GLenu
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glCopyTextureSubImage2DEXT(" << texture << ", " << toHex(target) << ", " << level << ", " << xoffset << ", " << yoffset << ", " << x << ", " << y << ", " << width << ", " << height << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(texture), CallTrace::pack(target), CallTrace::pack(level), CallTrace::pack(xoffset), CallTrace::pack(yoffset), CallTrace::pack(x), CallTrace::pack(y), CallTrace::pack(width), CallTrace::pack(height) };
+		m_callTrace->record(s_glCopyTextureSubImage2DEXTTraceInfo, traceArgs);
+	}
 	m_gl.copyTextureSubImage2DEXT(texture, target, level, xoffset, yoffset, x, y, width, height);
 }
 
@@ -860,6 +1465,11 @@ void CallLogWrapper::glCopyTextureSubImage3D (glw::GLuint texture, glw::GLint le
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glCopyTextureSubImage3D(" << texture << ", " << level << ", " << xoffset << ", " << yoffset << ", " << zoffset << ", " << x << ", " << y << ", " << width << ", " << height << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(texture), CallTrace::pack(level), CallTrace::pack(xoffset), CallTrace::pack(yoffset), CallTrace::pack(zoffset), CallTrace::pack(x), CallTrace::pack(y), CallTrace::pack(width), CallTrace::pack(height) };
+		m_callTrace->record(s_glCopyTextureSubImage3DTraceInfo, traceArgs);
+	}
 	m_gl.copyTextureSubImage3D(texture, level, xoffset, yoffset, zoffset, x, y, width, height);
 }
 
@@ -867,6 +1477,11 @@ void CallLogWrapper::glCopyTextureSubImage3DEXT (glw::GLuint texture, glw::GLenu
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glCopyTextureSubImage3DEXT(" << texture << ", " << toHex(target) << ", " << level << ", " << xoffset << ", " << yoffset << ", " << zoffset << ", " << x << ", " << y << ", " << width << ", " << height << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(texture), CallTrace::pack(target), CallTrace::pack(level), CallTrace::pack(xoffset), CallTrace::pack(yoffset), CallTrace::pack(zoffset), CallTrace::pack(x), CallTrace::pack(y), CallTrace::pack(width), CallTrace::pack(height) };
+		m_callTrace->record(s_glCopyTextureSubImage3DEXTTraceInfo, traceArgs);
+	}
 	m_gl.copyTextureSubImage3DEXT(texture, target, level, xoffset, yoffset, zoffset, x, y, width, height);
 }
 
@@ -874,6 +1489,11 @@ void CallLogWrapper::glCreateBuffers (glw::GLsizei n, glw::GLuint *buffers)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glCreateBuffers(" << n << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(buffers))) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(n), CallTrace::pack(buffers) };
+		m_callTrace->record(s_glCreateBuffersTraceInfo, traceArgs);
+	}
 	m_gl.createBuffers(n, buffers);
 }
 
@@ -881,6 +1501,11 @@ void CallLogWrapper::glCreateFramebuffers (glw::GLsizei n, glw::GLuint *framebuf
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glCreateFramebuffers(" << n << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(framebuffers))) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(n), CallTrace::pack(framebuffers) };
+		m_callTrace->record(s_glCreateFramebuffersTraceInfo, traceArgs);
+	}
 	m_gl.createFramebuffers(n, framebuffers);
 }
 
@@ -888,9 +1513,13 @@ glw::GLuint CallLogWrapper::glCreateProgram (void)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glCreateProgram(" << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+		m_callTrace->record(s_glCreateProgramTraceInfo, DE_NULL);
 	glw::GLuint returnValue = m_gl.createProgram();
 	if (m_enableLog)
 		m_log << TestLog::Message << "// " << returnValue << " returned" << TestLog::EndMessage;
+	if (m_callTrace)
+		m_callTrace->setReturnValue(CallTrace::pack(returnValue));
 	return returnValue;
 }
 
@@ -898,6 +1527,11 @@ void CallLogWrapper::glCreateProgramPipelines (glw::GLsizei n, glw::GLuint *pipe
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glCreateProgramPipelines(" << n << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(pipelines))) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(n), CallTrace::pack(pipelines) };
+		m_callTrace->record(s_glCreateProgramPipelinesTraceInfo, traceArgs);
+	}
 	m_gl.createProgramPipelines(n, pipelines);
 }
 
@@ -905,6 +1539,11 @@ void CallLogWrapper::glCreateQueries (glw::GLenum target, glw::GLsizei n, glw::G
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glCreateQueries(" << toHex(target) << ", " << n << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(ids))) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(target), CallTrace::pack(n), CallTrace::pack(ids) };
+		m_callTrace->record(s_glCreateQueriesTraceInfo, traceArgs);
+	}
 	m_gl.createQueries(target, n, ids);
 }
 
@@ -912,6 +1551,11 @@ void CallLogWrapper::glCreateRenderbuffers (glw::GLsizei n, glw::GLuint *renderb
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glCreateRenderbuffers(" << n << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(renderbuffers))) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(n), CallTrace::pack(renderbuffers) };
+		m_callTrace->record(s_glCreateRenderbuffersTraceInfo, traceArgs);
+	}
 	m_gl.createRenderbuffers(n, renderbuffers);
 }
 
@@ -919,6 +1563,11 @@ void CallLogWrapper::glCreateSamplers (glw::GLsizei n, glw::GLuint *samplers)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glCreateSamplers(" << n << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(samplers))) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(n), CallTrace::pack(samplers) };
+		m_callTrace->record(s_glCreateSamplersTraceInfo, traceArgs);
+	}
 	m_gl.createSamplers(n, samplers);
 }
 
@@ -926,9 +1575,16 @@ glw::GLuint CallLogWrapper::glCreateShader (glw::GLenum type)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glCreateShader(" << getShaderTypeStr(type) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(type) };
+		m_callTrace->record(s_glCreateShaderTraceInfo, traceArgs);
+	}
 	glw::GLuint returnValue = m_gl.createShader(type);
 	if (m_enableLog)
 		m_log << TestLog::Message << "// " << returnValue << " returned" << TestLog::EndMessage;
+	if (m_callTrace)
+		m_callTrace->setReturnValue(CallTrace::pack(returnValue));
 	return returnValue;
 }
 
@@ -936,9 +1592,16 @@ glw::GLuint CallLogWrapper::glCreateShaderProgramv (glw::GLenum type, glw::GLsiz
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glCreateShaderProgramv(" << toHex(type) << ", " << count << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(strings))) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(type), CallTrace::pack(count), CallTrace::pack(strings) };
+		m_callTrace->record(s_glCreateShaderProgramvTraceInfo, traceArgs);
+	}
 	glw::GLuint returnValue = m_gl.createShaderProgramv(type, count, strings);
 	if (m_enableLog)
 		m_log << TestLog::Message << "// " << returnValue << " returned" << TestLog::EndMessage;
+	if (m_callTrace)
+		m_callTrace->setReturnValue(CallTrace::pack(returnValue));
 	return returnValue;
 }
 
@@ -946,6 +1609,11 @@ void CallLogWrapper::glCreateTextures (glw::GLenum target, glw::GLsizei n, glw::
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glCreateTextures(" << toHex(target) << ", " << n << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(textures))) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(target), CallTrace::pack(n), CallTrace::pack(textures) };
+		m_callTrace->record(s_glCreateTexturesTraceInfo, traceArgs);
+	}
 	m_gl.createTextures(target, n, textures);
 }
 
@@ -953,6 +1621,11 @@ void CallLogWrapper::glCreateTransformFeedbacks (glw::GLsizei n, glw::GLuint *id
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glCreateTransformFeedbacks(" << n << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(ids))) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(n), CallTrace::pack(ids) };
+		m_callTrace->record(s_glCreateTransformFeedbacksTraceInfo, traceArgs);
+	}
 	m_gl.createTransformFeedbacks(n, ids);
 }
 
@@ -960,6 +1633,11 @@ void CallLogWrapper::glCreateVertexArrays (glw::GLsizei n, glw::GLuint *arrays)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glCreateVertexArrays(" << n << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(arrays))) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(n), CallTrace::pack(arrays) };
+		m_callTrace->record(s_glCreateVertexArraysTraceInfo, traceArgs);
+	}
 	m_gl.createVertexArrays(n, arrays);
 }
 
@@ -967,6 +1645,11 @@ void CallLogWrapper::glCullFace (glw::GLenum mode)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glCullFace(" << getFaceStr(mode) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(mode) };
+		m_callTrace->record(s_glCullFaceTraceInfo, traceArgs);
+	}
 	m_gl.cullFace(mode);
 }
 
@@ -974,6 +1657,11 @@ void CallLogWrapper::glDebugMessageCallback (glw::GLDEBUGPROC callback, const vo
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glDebugMessageCallback(" << toHex(reinterpret_cast<deUintptr>(callback)) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(userParam))) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(callback), CallTrace::pack(userParam) };
+		m_callTrace->record(s_glDebugMessageCallbackTraceInfo, traceArgs);
+	}
 	m_gl.debugMessageCallback(callback, userParam);
 }
 
@@ -981,6 +1669,11 @@ void CallLogWrapper::glDebugMessageControl (glw::GLenum source, glw::GLenum type
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glDebugMessageControl(" << getDebugMessageSourceStr(source) << ", " << getDebugMessageTypeStr(type) << ", " << getDebugMessageSeverityStr(severity) << ", " << count << ", " << getPointerStr(ids, (count)) << ", " << getBooleanStr(enabled) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(source), CallTrace::pack(type), CallTrace::pack(severity), CallTrace::pack(count), CallTrace::pack(ids), CallTrace::pack(enabled) };
+		m_callTrace->record(s_glDebugMessageControlTraceInfo, traceArgs);
+	}
 	m_gl.debugMessageControl(source, type, severity, count, ids, enabled);
 }
 
@@ -988,6 +1681,11 @@ void CallLogWrapper::glDebugMessageInsert (glw::GLenum source, glw::GLenum type,
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glDebugMessageInsert(" << getDebugMessageSourceStr(source) << ", " << getDebugMessageTypeStr(type) << ", " << id << ", " << getDebugMessageSeverityStr(severity) << ", " << length << ", " << getStringStr(buf) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(source), CallTrace::pack(type), CallTrace::pack(id), CallTrace::pack(severity), CallTrace::pack(length), CallTrace::pack(buf) };
+		m_callTrace->record(s_glDebugMessageInsertTraceInfo, traceArgs);
+	}
 	m_gl.debugMessageInsert(source, type, id, severity, length, buf);
 }
 
@@ -995,6 +1693,11 @@ void CallLogWrapper::glDeleteBuffers (glw::GLsizei n, const glw::GLuint *buffers
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glDeleteBuffers(" << n << ", " << getPointerStr(buffers, n) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(n), CallTrace::pack(buffers) };
+		m_callTrace->record(s_glDeleteBuffersTraceInfo, traceArgs);
+	}
 	m_gl.deleteBuffers(n, buffers);
 }
 
@@ -1002,6 +1705,11 @@ void CallLogWrapper::glDeleteFramebuffers (glw::GLsizei n, const glw::GLuint *fr
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glDeleteFramebuffers(" << n << ", " << getPointerStr(framebuffers, n) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(n), CallTrace::pack(framebuffers) };
+		m_callTrace->record(s_glDeleteFramebuffersTraceInfo, traceArgs);
+	}
 	m_gl.deleteFramebuffers(n, framebuffers);
 }
 
@@ -1009,6 +1717,11 @@ void CallLogWrapper::glDeleteProgram (glw::GLuint program)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glDeleteProgram(" << program << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(program) };
+		m_callTrace->record(s_glDeleteProgramTraceInfo, traceArgs);
+	}
 	m_gl.deleteProgram(program);
 }
 
@@ -1016,6 +1729,11 @@ void CallLogWrapper::glDeleteProgramPipelines (glw::GLsizei n, const glw::GLuint
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glDeleteProgramPipelines(" << n << ", " << getPointerStr(pipelines, n) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(n), CallTrace::pack(pipelines) };
+		m_callTrace->record(s_glDeleteProgramPipelinesTraceInfo, traceArgs);
+	}
 	m_gl.deleteProgramPipelines(n, pipelines);
 }
 
@@ -1023,6 +1741,11 @@ void CallLogWrapper::glDeleteQueries (glw::GLsizei n, const glw::GLuint *ids)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glDeleteQueries(" << n << ", " << getPointerStr(ids, n) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(n), CallTrace::pack(ids) };
+		m_callTrace->record(s_glDeleteQueriesTraceInfo, traceArgs);
+	}
 	m_gl.deleteQueries(n, ids);
 }
 
@@ -1030,6 +1753,11 @@ void CallLogWrapper::glDeleteRenderbuffers (glw::GLsizei n, const glw::GLuint *r
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glDeleteRenderbuffers(" << n << ", " << getPointerStr(renderbuffers, n) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(n), CallTrace::pack(renderbuffers) };
+		m_callTrace->record(s_glDeleteRenderbuffersTraceInfo, traceArgs);
+	}
 	m_gl.deleteRenderbuffers(n, renderbuffers);
 }
 
@@ -1037,6 +1765,11 @@ void CallLogWrapper::glDeleteSamplers (glw::GLsizei count, const glw::GLuint *sa
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glDeleteSamplers(" << count << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(samplers))) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(count), CallTrace::pack(samplers) };
+		m_callTrace->record(s_glDeleteSamplersTraceInfo, traceArgs);
+	}
 	m_gl.deleteSamplers(count, samplers);
 }
 
@@ -1044,6 +1777,11 @@ void CallLogWrapper::glDeleteShader (glw::GLuint shader)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glDeleteShader(" << shader << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(shader) };
+		m_callTrace->record(s_glDeleteShaderTraceInfo, traceArgs);
+	}
 	m_gl.deleteShader(shader);
 }
 
@@ -1051,6 +1789,11 @@ void CallLogWrapper::glDeleteSync (glw::GLsync sync)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glDeleteSync(" << sync << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(sync) };
+		m_callTrace->record(s_glDeleteSyncTraceInfo, traceArgs);
+	}
 	m_gl.deleteSync(sync);
 }
 
@@ -1058,6 +1801,11 @@ void CallLogWrapper::glDeleteTextures (glw::GLsizei n, const glw::GLuint *textur
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glDeleteTextures(" << n << ", " << getPointerStr(textures, n) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(n), CallTrace::pack(textures) };
+		m_callTrace->record(s_glDeleteTexturesTraceInfo, traceArgs);
+	}
 	m_gl.deleteTextures(n, textures);
 }
 
@@ -1065,6 +1813,11 @@ void CallLogWrapper::glDeleteTransformFeedbacks (glw::GLsizei n, const glw::GLui
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glDeleteTransformFeedbacks(" << n << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(ids))) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(n), CallTrace::pack(ids) };
+		m_callTrace->record(s_glDeleteTransformFeedbacksTraceInfo, traceArgs);
+	}
 	m_gl.deleteTransformFeedbacks(n, ids);
 }
 
@@ -1072,6 +1825,11 @@ void CallLogWrapper::glDeleteVertexArrays (glw::GLsizei n, const glw::GLuint *ar
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glDeleteVertexArrays(" << n << ", " << getPointerStr(arrays, n) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(n), CallTrace::pack(arrays) };
+		m_callTrace->record(s_glDeleteVertexArraysTraceInfo, traceArgs);
+	}
 	m_gl.deleteVertexArrays(n, arrays);
 }
 
@@ -1079,6 +1837,11 @@ void CallLogWrapper::glDepthBoundsEXT (glw::GLclampd zmin, glw::GLclampd zmax)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glDepthBoundsEXT(" << zmin << ", " << zmax << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(zmin), CallTrace::pack(zmax) };
+		m_callTrace->record(s_glDepthBoundsEXTTraceInfo, traceArgs);
+	}
 	m_gl.depthBoundsEXT(zmin, zmax);
 }
 
@@ -1086,6 +1849,11 @@ void CallLogWrapper::glDepthFunc (glw::GLenum func)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glDepthFunc(" << getCompareFuncStr(func) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(func) };
+		m_callTrace->record(s_glDepthFuncTraceInfo, traceArgs);
+	}
 	m_gl.depthFunc(func);
 }
 
@@ -1093,6 +1861,11 @@ void CallLogWrapper::glDepthMask (glw::GLboolean flag)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glDepthMask(" << getBooleanStr(flag) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(flag) };
+		m_callTrace->record(s_glDepthMaskTraceInfo, traceArgs);
+	}
 	m_gl.depthMask(flag);
 }
 
@@ -1100,6 +1873,11 @@ void CallLogWrapper::glDepthRange (glw::GLdouble n, glw::GLdouble f)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glDepthRange(" << n << ", " << f << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(n), CallTrace::pack(f) };
+		m_callTrace->record(s_glDepthRangeTraceInfo, traceArgs);
+	}
 	m_gl.depthRange(n, f);
 }
 
@@ -1107,6 +1885,11 @@ void CallLogWrapper::glDepthRangeArrayfvOES (glw::GLuint first, glw::GLsizei cou
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glDepthRangeArrayfvOES(" << first << ", " << count << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(v))) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(first), CallTrace::pack(count), CallTrace::pack(v) };
+		m_callTrace->record(s_glDepthRangeArrayfvOESTraceInfo, traceArgs);
+	}
 	m_gl.depthRangeArrayfvOES(first, count, v);
 }
 
@@ -1114,6 +1897,11 @@ void CallLogWrapper::glDepthRangeArrayv (glw::GLuint first, glw::GLsizei count,
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glDepthRangeArrayv(" << first << ", " << count << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(v))) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(first), CallTrace::pack(count), CallTrace::pack(v) };
+		m_callTrace->record(s_glDepthRangeArrayvTraceInfo, traceArgs);
+	}
 	m_gl.depthRangeArrayv(first, count, v);
 }
 
@@ -1121,6 +1909,11 @@ void CallLogWrapper::glDepthRangeIndexed (glw::GLuint index, glw::GLdouble n, gl
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glDepthRangeIndexed(" << index << ", " << n << ", " << f << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(index), CallTrace::pack(n), CallTrace::pack(f) };
+		m_callTrace->record(s_glDepthRangeIndexedTraceInfo, traceArgs);
+	}
 	m_gl.depthRangeIndexed(index, n, f);
 }
 
@@ -1128,6 +1921,11 @@ void CallLogWrapper::glDepthRangeIndexedfOES (glw::GLuint index, glw::GLfloat n,
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glDepthRangeIndexedfOES(" << index << ", " << n << ", " << f << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(index), CallTrace::pack(n), CallTrace::pack(f) };
+		m_callTrace->record(s_glDepthRangeIndexedfOESTraceInfo, traceArgs);
+	}
 	m_gl.depthRangeIndexedfOES(index, n, f);
 }
 
@@ -1135,6 +1933,11 @@ void CallLogWrapper::glDepthRangef (glw::GLfloat n, glw::GLfloat f)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glDepthRangef(" << n << ", " << f << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(n), CallTrace::pack(f) };
+		m_callTrace->record(s_glDepthRangefTraceInfo, traceArgs);
+	}
 	m_gl.depthRangef(n, f);
 }
 
@@ -1142,6 +1945,11 @@ void CallLogWrapper::glDetachShader (glw::GLuint program, glw::GLuint shader)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glDetachShader(" << program << ", " << shader << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(program), CallTrace::pack(shader) };
+		m_callTrace->record(s_glDetachShaderTraceInfo, traceArgs);
+	}
 	m_gl.detachShader(program, shader);
 }
 
@@ -1149,6 +1957,11 @@ void CallLogWrapper::glDisable (glw::GLenum cap)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glDisable(" << getEnableCapStr(cap) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(cap) };
+		m_callTrace->record(s_glDisableTraceInfo, traceArgs);
+	}
 	m_gl.disable(cap);
 }
 
@@ -1156,6 +1969,11 @@ void CallLogWrapper::glDisableClientStateIndexedEXT (glw::GLenum array, glw::GLu
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glDisableClientStateIndexedEXT(" << toHex(array) << ", " << index << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(array), CallTrace::pack(index) };
+		m_callTrace->record(s_glDisableClientStateIndexedEXTTraceInfo, traceArgs);
+	}
 	m_gl.disableClientStateIndexedEXT(array, index);
 }
 
@@ -1163,6 +1981,11 @@ void CallLogWrapper::glDisableClientStateiEXT (glw::GLenum array, glw::GLuint in
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glDisableClientStateiEXT(" << toHex(array) << ", " << index << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(array), CallTrace::pack(index) };
+		m_callTrace->record(s_glDisableClientStateiEXTTraceInfo, traceArgs);
+	}
 	m_gl.disableClientStateiEXT(array, index);
 }
 
@@ -1170,6 +1993,11 @@ void CallLogWrapper::glDisableVertexArrayAttrib (glw::GLuint vaobj, glw::GLuint
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glDisableVertexArrayAttrib(" << vaobj << ", " << index << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(vaobj), CallTrace::pack(index) };
+		m_callTrace->record(s_glDisableVertexArrayAttribTraceInfo, traceArgs);
+	}
 	m_gl.disableVertexArrayAttrib(vaobj, index);
 }
 
@@ -1177,6 +2005,11 @@ void CallLogWrapper::glDisableVertexArrayAttribEXT (glw::GLuint vaobj, glw::GLui
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glDisableVertexArrayAttribEXT(" << vaobj << ", " << index << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(vaobj), CallTrace::pack(index) };
+		m_callTrace->record(s_glDisableVertexArrayAttribEXTTraceInfo, traceArgs);
+	}
 	m_gl.disableVertexArrayAttribEXT(vaobj, index);
 }
 
@@ -1184,6 +2017,11 @@ void CallLogWrapper::glDisableVertexArrayEXT (glw::GLuint vaobj, glw::GLenum arr
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glDisableVertexArrayEXT(" << vaobj << ", " << toHex(array) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(vaobj), CallTrace::pack(array) };
+		m_callTrace->record(s_glDisableVertexArrayEXTTraceInfo, traceArgs);
+	}
 	m_gl.disableVertexArrayEXT(vaobj, array);
 }
 
@@ -1191,6 +2029,11 @@ void CallLogWrapper::glDisableVertexAttribArray (glw::GLuint index)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glDisableVertexAttribArray(" << index << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(index) };
+		m_callTrace->record(s_glDisableVertexAttribArrayTraceInfo, traceArgs);
+	}
 	m_gl.disableVertexAttribArray(index);
 }
 
@@ -1198,6 +2041,11 @@ void CallLogWrapper::glDisablei (glw::GLenum target, glw::GLuint index)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glDisablei(" << getIndexedEnableCapStr(target) << ", " << index << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(target), CallTrace::pack(index) };
+		m_callTrace->record(s_glDisableiTraceInfo, traceArgs);
+	}
 	m_gl.disablei(target, index);
 }
 
@@ -1205,6 +2053,11 @@ void CallLogWrapper::glDispatchCompute (glw::GLuint num_groups_x, glw::GLuint nu
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glDispatchCompute(" << num_groups_x << ", " << num_groups_y << ", " << num_groups_z << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(num_groups_x), CallTrace::pack(num_groups_y), CallTrace::pack(num_groups_z) };
+		m_callTrace->record(s_glDispatchComputeTraceInfo, traceArgs);
+	}
 	m_gl.dispatchCompute(num_groups_x, num_groups_y, num_groups_z);
 }
 
@@ -1212,6 +2065,11 @@ void CallLogWrapper::glDispatchComputeIndirect (glw::GLintptr indirect)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glDispatchComputeIndirect(" << indirect << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(indirect) };
+		m_callTrace->record(s_glDispatchComputeIndirectTraceInfo, traceArgs);
+	}
 	m_gl.dispatchComputeIndirect(indirect);
 }
 
@@ -1219,6 +2077,11 @@ void CallLogWrapper::glDrawArrays (glw::GLenum mode, glw::GLint first, glw::GLsi
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glDrawArrays(" << getPrimitiveTypeStr(mode) << ", " << first << ", " << count << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(mode), CallTrace::pack(first), CallTrace::pack(count) };
+		m_callTrace->record(s_glDrawArraysTraceInfo, traceArgs);
+	}
 	m_gl.drawArrays(mode, first, count);
 }
 
@@ -1226,6 +2089,11 @@ void CallLogWrapper::glDrawArraysIndirect (glw::GLenum mode, const void *indirec
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glDrawArraysIndirect(" << getPrimitiveTypeStr(mode) << ", " << indirect << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(mode), CallTrace::pack(indirect) };
+		m_callTrace->record(s_glDrawArraysIndirectTraceInfo, traceArgs);
+	}
 	m_gl.drawArraysIndirect(mode, indirect);
 }
 
@@ -1233,6 +2101,11 @@ void CallLogWrapper::glDrawArraysInstanced (glw::GLenum mode, glw::GLint first,
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glDrawArraysInstanced(" << getPrimitiveTypeStr(mode) << ", " << first << ", " << count << ", " << instancecount << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(mode), CallTrace::pack(first), CallTrace::pack(count), CallTrace::pack(instancecount) };
+		m_callTrace->record(s_glDrawArraysInstancedTraceInfo, traceArgs);
+	}
 	m_gl.drawArraysInstanced(mode, first, count, instancecount);
 }
 
@@ -1240,6 +2113,11 @@ void CallLogWrapper::glDrawArraysInstancedBaseInstance (glw::GLenum mode, glw::G
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glDrawArraysInstancedBaseInstance(" << toHex(mode) << ", " << first << ", " << count << ", " << instancecount << ", " << baseinstance << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(mode), CallTrace::pack(first), CallTrace::pack(count), CallTrace::pack(instancecount), CallTrace::pack(baseinstance) };
+		m_callTrace->record(s_glDrawArraysInstancedBaseInstanceTraceInfo, traceArgs);
+	}
 	m_gl.drawArraysInstancedBaseInstance(mode, first, count, instancecount, baseinstance);
 }
 
@@ -1247,6 +2125,11 @@ void CallLogWrapper::glDrawBuffer (glw::GLenum buf)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glDrawBuffer(" << toHex(buf) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(buf) };
+		m_callTrace->record(s_glDrawBufferTraceInfo, traceArgs);
+	}
 	m_gl.drawBuffer(buf);
 }
 
@@ -1254,6 +2137,11 @@ void CallLogWrapper::glDrawBuffers (glw::GLsizei n, const glw::GLenum *bufs)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glDrawBuffers(" << n << ", " << getEnumPointerStr(bufs, n, getDrawReadBufferName) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(n), CallTrace::pack(bufs) };
+		m_callTrace->record(s_glDrawBuffersTraceInfo, traceArgs);
+	}
 	m_gl.drawBuffers(n, bufs);
 }
 
@@ -1261,6 +2149,11 @@ void CallLogWrapper::glDrawElements (glw::GLenum mode, glw::GLsizei count, glw::
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glDrawElements(" << getPrimitiveTypeStr(mode) << ", " << count << ", " << getTypeStr(type) << ", " << indices << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(mode), CallTrace::pack(count), CallTrace::pack(type), CallTrace::pack(indices) };
+		m_callTrace->record(s_glDrawElementsTraceInfo, traceArgs);
+	}
 	m_gl.drawElements(mode, count, type, indices);
 }
 
@@ -1268,6 +2161,11 @@ void CallLogWrapper::glDrawElementsBaseVertex (glw::GLenum mode, glw::GLsizei co
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glDrawElementsBaseVertex(" << getPrimitiveTypeStr(mode) << ", " << count << ", " << getTypeStr(type) << ", " << indices << ", " << basevertex << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(mode), CallTrace::pack(count), CallTrace::pack(type), CallTrace::pack(indices), CallTrace::pack(basevertex) };
+		m_callTrace->record(s_glDrawElementsBaseVertexTraceInfo, traceArgs);
+	}
 	m_gl.drawElementsBaseVertex(mode, count, type, indices, basevertex);
 }
 
@@ -1275,6 +2173,11 @@ void CallLogWrapper::glDrawElementsIndirect (glw::GLenum mode, glw::GLenum type,
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glDrawElementsIndirect(" << getPrimitiveTypeStr(mode) << ", " << getTypeStr(type) << ", " << indirect << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(mode), CallTrace::pack(type), CallTrace::pack(indirect) };
+		m_callTrace->record(s_glDrawElementsIndirectTraceInfo, traceArgs);
+	}
 	m_gl.drawElementsIndirect(mode, type, indirect);
 }
 
@@ -1282,6 +2185,11 @@ void CallLogWrapper::glDrawElementsInstanced (glw::GLenum mode, glw::GLsizei cou
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glDrawElementsInstanced(" << getPrimitiveTypeStr(mode) << ", " << count << ", " << getTypeStr(type) << ", " << indices << ", " << instancecount << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(mode), CallTrace::pack(count), CallTrace::pack(type), CallTrace::pack(indices), CallTrace::pack(instancecount) };
+		m_callTrace->record(s_glDrawElementsInstancedTraceInfo, traceArgs);
+	}
 	m_gl.drawElementsInstanced(mode, count, type, indices, instancecount);
 }
 
@@ -1289,6 +2197,11 @@ void CallLogWrapper::glDrawElementsInstancedBaseInstance (glw::GLenum mode, glw:
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glDrawElementsInstancedBaseInstance(" << toHex(mode) << ", " << count << ", " << toHex(type) << ", " << indices << ", " << instancecount << ", " << baseinstance << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(mode), CallTrace::pack(count), CallTrace::pack(type), CallTrace::pack(indices), CallTrace::pack(instancecount), CallTrace::pack(baseinstance) };
+		m_callTrace->record(s_glDrawElementsInstancedBaseInstanceTraceInfo, traceArgs);
+	}
 	m_gl.drawElementsInstancedBaseInstance(mode, count, type, indices, instancecount, baseinstance);
 }
 
@@ -1296,6 +2209,11 @@ void CallLogWrapper::glDrawElementsInstancedBaseVertex (glw::GLenum mode, glw::G
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glDrawElementsInstancedBaseVertex(" << getPrimitiveTypeStr(mode) << ", " << count << ", " << getTypeStr(type) << ", " << indices << ", " << instancecount << ", " << basevertex << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(mode), CallTrace::pack(count), CallTrace::pack(type), CallTrace::pack(indices), CallTrace::pack(instancecount), CallTrace::pack(basevertex) };
+		m_callTrace->record(s_glDrawElementsInstancedBaseVertexTraceInfo, traceArgs);
+	}
 	m_gl.drawElementsInstancedBaseVertex(mode, count, type, indices, instancecount, basevertex);
 }
 
@@ -1303,6 +2221,11 @@ void CallLogWrapper::glDrawElementsInstancedBaseVertexBaseInstance (glw::GLenum
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glDrawElementsInstancedBaseVertexBaseInstance(" << toHex(mode) << ", " << count << ", " << toHex(type) << ", " << indices << ", " << instancecount << ", " << basevertex << ", " << baseinstance << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(mode), CallTrace::pack(count), CallTrace::pack(type), CallTrace::pack(indices), CallTrace::pack(instancecount), CallTrace::pack(basevertex), CallTrace::pack(baseinstance) };
+		m_callTrace->record(s_glDrawElementsInstancedBaseVertexBaseInstanceTraceInfo, traceArgs);
+	}
 	m_gl.drawElementsInstancedBaseVertexBaseInstance(mode, count, type, indices, instancecount, basevertex, baseinstance);
 }
 
@@ -1310,6 +2233,11 @@ void CallLogWrapper::glDrawRangeElements (glw::GLenum mode, glw::GLuint start, g
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glDrawRangeElements(" << getPrimitiveTypeStr(mode) << ", " << start << ", " << end << ", " << count << ", " << getTypeStr(type) << ", " << indices << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(mode), CallTrace::pack(start), CallTrace::pack(end), CallTrace::pack(count), CallTrace::pack(type), CallTrace::pack(indices) };
+		m_callTrace->record(s_glDrawRangeElementsTraceInfo, traceArgs);
+	}
 	m_gl.drawRangeElements(mode, start, end, count, type, indices);
 }
 
@@ -1317,6 +2245,11 @@ void CallLogWrapper::glDrawRangeElementsBaseVertex (glw::GLenum mode, glw::GLuin
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glDrawRangeElementsBaseVertex(" << getPrimitiveTypeStr(mode) << ", " << start << ", " << end << ", " << count << ", " << getTypeStr(type) << ", " << indices << ", " << basevertex << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(mode), CallTrace::pack(start), CallTrace::pack(end), CallTrace::pack(count), CallTrace::pack(type), CallTrace::pack(indices), CallTrace::pack(basevertex) };
+		m_callTrace->record(s_glDrawRangeElementsBaseVertexTraceInfo, traceArgs);
+	}
 	m_gl.drawRangeElementsBaseVertex(mode, start, end, count, type, indices, basevertex);
 }
 
@@ -1324,6 +2257,11 @@ void CallLogWrapper::glDrawTransformFeedback (glw::GLenum mode, glw::GLuint id)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glDrawTransformFeedback(" << toHex(mode) << ", " << id << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(mode), CallTrace::pack(id) };
+		m_callTrace->record(s_glDrawTransformFeedbackTraceInfo, traceArgs);
+	}
 	m_gl.drawTransformFeedback(mode, id);
 }
 
@@ -1331,6 +2269,11 @@ void CallLogWrapper::glDrawTransformFeedbackInstanced (glw::GLenum mode, glw::GL
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glDrawTransformFeedbackInstanced(" << toHex(mode) << ", " << id << ", " << instancecount << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(mode), CallTrace::pack(id), CallTrace::pack(instancecount) };
+		m_callTrace->record(s_glDrawTransformFeedbackInstancedTraceInfo, traceArgs);
+	}
 	m_gl.drawTransformFeedbackInstanced(mode, id, instancecount);
 }
 
@@ -1338,6 +2281,11 @@ void CallLogWrapper::glDrawTransformFeedbackStream (glw::GLenum mode, glw::GLuin
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glDrawTransformFeedbackStream(" << toHex(mode) << ", " << id << ", " << stream << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(mode), CallTrace::pack(id), CallTrace::pack(stream) };
+		m_callTrace->record(s_glDrawTransformFeedbackStreamTraceInfo, traceArgs);
+	}
 	m_gl.drawTransformFeedbackStream(mode, id, stream);
 }
 
@@ -1345,6 +2293,11 @@ void CallLogWrapper::glDrawTransformFeedbackStreamInstanced (glw::GLenum mode, g
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glDrawTransformFeedbackStreamInstanced(" << toHex(mode) << ", " << id << ", " << stream << ", " << instancecount << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(mode), CallTrace::pack(id), CallTrace::pack(stream), CallTrace::pack(instancecount) };
+		m_callTrace->record(s_glDrawTransformFeedbackStreamInstancedTraceInfo, traceArgs);
+	}
 	m_gl.drawTransformFeedbackStreamInstanced(mode, id, stream, instancecount);
 }
 
@@ -1352,6 +2305,11 @@ void CallLogWrapper::glEGLImageTargetRenderbufferStorageOES (glw::GLenum target,
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glEGLImageTargetRenderbufferStorageOES(" << toHex(target) << ", " << image << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(target), CallTrace::pack(image) };
+		m_callTrace->record(s_glEGLImageTargetRenderbufferStorageOESTraceInfo, traceArgs);
+	}
 	m_gl.eglImageTargetRenderbufferStorageOES(target, image);
 }
 
@@ -1359,6 +2317,11 @@ void CallLogWrapper::glEGLImageTargetTexture2DOES (glw::GLenum target, glw::GLeg
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glEGLImageTargetTexture2DOES(" << toHex(target) << ", " << image << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(target), CallTrace::pack(image) };
+		m_callTrace->record(s_glEGLImageTargetTexture2DOESTraceInfo, traceArgs);
+	}
 	m_gl.eglImageTargetTexture2DOES(target, image);
 }
 
@@ -1366,6 +2329,11 @@ void CallLogWrapper::glEnable (glw::GLenum cap)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glEnable(" << getEnableCapStr(cap) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(cap) };
+		m_callTrace->record(s_glEnableTraceInfo, traceArgs);
+	}
 	m_gl.enable(cap);
 }
 
@@ -1373,6 +2341,11 @@ void CallLogWrapper::glEnableClientStateIndexedEXT (glw::GLenum array, glw::GLui
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glEnableClientStateIndexedEXT(" << toHex(array) << ", " << index << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(array), CallTrace::pack(index) };
+		m_callTrace->record(s_glEnableClientStateIndexedEXTTraceInfo, traceArgs);
+	}
 	m_gl.enableClientStateIndexedEXT(array, index);
 }
 
@@ -1380,6 +2353,11 @@ void CallLogWrapper::glEnableClientStateiEXT (glw::GLenum array, glw::GLuint ind
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glEnableClientStateiEXT(" << toHex(array) << ", " << index << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(array), CallTrace::pack(index) };
+		m_callTrace->record(s_glEnableClientStateiEXTTraceInfo, traceArgs);
+	}
 	m_gl.enableClientStateiEXT(array, index);
 }
 
@@ -1387,6 +2365,11 @@ void CallLogWrapper::glEnableVertexArrayAttrib (glw::GLuint vaobj, glw::GLuint i
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glEnableVertexArrayAttrib(" << vaobj << ", " << index << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(vaobj), CallTrace::pack(index) };
+		m_callTrace->record(s_glEnableVertexArrayAttribTraceInfo, traceArgs);
+	}
 	m_gl.enableVertexArrayAttrib(vaobj, index);
 }
 
@@ -1394,6 +2377,11 @@ void CallLogWrapper::glEnableVertexArrayAttribEXT (glw::GLuint vaobj, glw::GLuin
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glEnableVertexArrayAttribEXT(" << vaobj << ", " << index << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(vaobj), CallTrace::pack(index) };
+		m_callTrace->record(s_glEnableVertexArrayAttribEXTTraceInfo, traceArgs);
+	}
 	m_gl.enableVertexArrayAttribEXT(vaobj, index);
 }
 
@@ -1401,6 +2389,11 @@ void CallLogWrapper::glEnableVertexArrayEXT (glw::GLuint vaobj, glw::GLenum arra
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glEnableVertexArrayEXT(" << vaobj << ", " << toHex(array) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(vaobj), CallTrace::pack(array) };
+		m_callTrace->record(s_glEnableVertexArrayEXTTraceInfo, traceArgs);
+	}
 	m_gl.enableVertexArrayEXT(vaobj, array);
 }
 
@@ -1408,6 +2401,11 @@ void CallLogWrapper::glEnableVertexAttribArray (glw::GLuint index)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glEnableVertexAttribArray(" << index << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(index) };
+		m_callTrace->record(s_glEnableVertexAttribArrayTraceInfo, traceArgs);
+	}
 	m_gl.enableVertexAttribArray(index);
 }
 
@@ -1415,6 +2413,11 @@ void CallLogWrapper::glEnablei (glw::GLenum target, glw::GLuint index)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glEnablei(" << getIndexedEnableCapStr(target) << ", " << index << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(target), CallTrace::pack(index) };
+		m_callTrace->record(s_glEnableiTraceInfo, traceArgs);
+	}
 	m_gl.enablei(target, index);
 }
 
@@ -1422,6 +2425,8 @@ void CallLogWrapper::glEndConditionalRender (void)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glEndConditionalRender(" << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+		m_callTrace->record(s_glEndConditionalRenderTraceInfo, DE_NULL);
 	m_gl.endConditionalRender();
 }
 
@@ -1429,6 +2434,11 @@ void CallLogWrapper::glEndQuery (glw::GLenum target)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glEndQuery(" << getQueryTargetStr(target) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(target) };
+		m_callTrace->record(s_glEndQueryTraceInfo, traceArgs);
+	}
 	m_gl.endQuery(target);
 }
 
@@ -1436,6 +2446,11 @@ void CallLogWrapper::glEndQueryIndexed (glw::GLenum target, glw::GLuint index)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glEndQueryIndexed(" << toHex(target) << ", " << index << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(target), CallTrace::pack(index) };
+		m_callTrace->record(s_glEndQueryIndexedTraceInfo, traceArgs);
+	}
 	m_gl.endQueryIndexed(target, index);
 }
 
@@ -1443,6 +2458,8 @@ void CallLogWrapper::glEndTransformFeedback (void)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glEndTransformFeedback(" << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+		m_callTrace->record(s_glEndTransformFeedbackTraceInfo, DE_NULL);
 	m_gl.endTransformFeedback();
 }
 
@@ -1450,9 +2467,16 @@ glw::GLsync CallLogWrapper::glFenceSync (glw::GLenum condition, glw::GLbitfield
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glFenceSync(" << toHex(condition) << ", " << toHex(flags) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(condition), CallTrace::pack(flags) };
+		m_callTrace->record(s_glFenceSyncTraceInfo, traceArgs);
+	}
 	glw::GLsync returnValue = m_gl.fenceSync(condition, flags);
 	if (m_enableLog)
 		m_log << TestLog::Message << "// " << returnValue << " returned" << TestLog::EndMessage;
+	if (m_callTrace)
+		m_callTrace->setReturnValue(CallTrace::pack(returnValue));
 	return returnValue;
 }
 
@@ -1460,6 +2484,8 @@ void CallLogWrapper::glFinish (void)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glFinish(" << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+		m_callTrace->record(s_glFinishTraceInfo, DE_NULL);
 	m_gl.finish();
 }
 
@@ -1467,6 +2493,8 @@ void CallLogWrapper::glFlush (void)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glFlush(" << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+		m_callTrace->record(s_glFlushTraceInfo, DE_NULL);
 	m_gl.flush();
 }
 
@@ -1474,6 +2502,11 @@ void CallLogWrapper::glFlushMappedBufferRange (glw::GLenum target, glw::GLintptr
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glFlushMappedBufferRange(" << getBufferTargetStr(target) << ", " << offset << ", " << length << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(target), CallTrace::pack(offset), CallTrace::pack(length) };
+		m_callTrace->record(s_glFlushMappedBufferRangeTraceInfo, traceArgs);
+	}
 	m_gl.flushMappedBufferRange(target, offset, length);
 }
 
@@ -1481,6 +2514,11 @@ void CallLogWrapper::glFlushMappedNamedBufferRange (glw::GLuint buffer, glw::GLi
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glFlushMappedNamedBufferRange(" << buffer << ", " << offset << ", " << length << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(buffer), CallTrace::pack(offset), CallTrace::pack(length) };
+		m_callTrace->record(s_glFlushMappedNamedBufferRangeTraceInfo, traceArgs);
+	}
 	m_gl.flushMappedNamedBufferRange(buffer, offset, length);
 }
 
@@ -1488,6 +2526,11 @@ void CallLogWrapper::glFlushMappedNamedBufferRangeEXT (glw::GLuint buffer, glw::
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glFlushMappedNamedBufferRangeEXT(" << buffer << ", " << offset << ", " << length << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(buffer), CallTrace::pack(offset), CallTrace::pack(length) };
+		m_callTrace->record(s_glFlushMappedNamedBufferRangeEXTTraceInfo, traceArgs);
+	}
 	m_gl.flushMappedNamedBufferRangeEXT(buffer, offset, length);
 }
 
@@ -1495,6 +2538,11 @@ void CallLogWrapper::glFramebufferDrawBufferEXT (glw::GLuint framebuffer, glw::G
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glFramebufferDrawBufferEXT(" << framebuffer << ", " << toHex(mode) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(framebuffer), CallTrace::pack(mode) };
+		m_callTrace->record(s_glFramebufferDrawBufferEXTTraceInfo, traceArgs);
+	}
 	m_gl.framebufferDrawBufferEXT(framebuffer, mode);
 }
 
@@ -1502,6 +2550,11 @@ void CallLogWrapper::glFramebufferDrawBuffersEXT (glw::GLuint framebuffer, glw::
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glFramebufferDrawBuffersEXT(" << framebuffer << ", " << n << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(bufs))) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(framebuffer), CallTrace::pack(n), CallTrace::pack(bufs) };
+		m_callTrace->record(s_glFramebufferDrawBuffersEXTTraceInfo, traceArgs);
+	}
 	m_gl.framebufferDrawBuffersEXT(framebuffer, n, bufs);
 }
 
@@ -1509,6 +2562,11 @@ void CallLogWrapper::glFramebufferParameteri (glw::GLenum target, glw::GLenum pn
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glFramebufferParameteri(" << getFramebufferTargetStr(target) << ", " << getFramebufferParameterStr(pname) << ", " << param << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(target), CallTrace::pack(pname), CallTrace::pack(param) };
+		m_callTrace->record(s_glFramebufferParameteriTraceInfo, traceArgs);
+	}
 	m_gl.framebufferParameteri(target, pname, param);
 }
 
@@ -1516,6 +2574,11 @@ void CallLogWrapper::glFramebufferReadBufferEXT (glw::GLuint framebuffer, glw::G
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glFramebufferReadBufferEXT(" << framebuffer << ", " << toHex(mode) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(framebuffer), CallTrace::pack(mode) };
+		m_callTrace->record(s_glFramebufferReadBufferEXTTraceInfo, traceArgs);
+	}
 	m_gl.framebufferReadBufferEXT(framebuffer, mode);
 }
 
@@ -1523,6 +2586,11 @@ void CallLogWrapper::glFramebufferRenderbuffer (glw::GLenum target, glw::GLenum
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glFramebufferRenderbuffer(" << getFramebufferTargetStr(target) << ", " << getFramebufferAttachmentStr(attachment) << ", " << getFramebufferTargetStr(renderbuffertarget) << ", " << renderbuffer << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(target), CallTrace::pack(attachment), CallTrace::pack(renderbuffertarget), CallTrace::pack(renderbuffer) };
+		m_callTrace->record(s_glFramebufferRenderbufferTraceInfo, traceArgs);
+	}
 	m_gl.framebufferRenderbuffer(target, attachment, renderbuffertarget, renderbuffer);
 }
 
@@ -1530,6 +2598,11 @@ void CallLogWrapper::glFramebufferTexture (glw::GLenum target, glw::GLenum attac
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glFramebufferTexture(" << getFramebufferTargetStr(target) << ", " << getFramebufferAttachmentStr(attachment) << ", " << texture << ", " << level << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(target), CallTrace::pack(attachment), CallTrace::pack(texture), CallTrace::pack(level) };
+		m_callTrace->record(s_glFramebufferTextureTraceInfo, traceArgs);
+	}
 	m_gl.framebufferTexture(target, attachment, texture, level);
 }
 
@@ -1537,6 +2610,11 @@ void CallLogWrapper::glFramebufferTexture1D (glw::GLenum target, glw::GLenum att
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glFramebufferTexture1D(" << toHex(target) << ", " << toHex(attachment) << ", " << toHex(textarget) << ", " << texture << ", " << level << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(target), CallTrace::pack(attachment), CallTrace::pack(textarget), CallTrace::pack(texture), CallTrace::pack(level) };
+		m_callTrace->record(s_glFramebufferTexture1DTraceInfo, traceArgs);
+	}
 	m_gl.framebufferTexture1D(target, attachment, textarget, texture, level);
 }
 
@@ -1544,6 +2622,11 @@ void CallLogWrapper::glFramebufferTexture2D (glw::GLenum target, glw::GLenum att
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glFramebufferTexture2D(" << getFramebufferTargetStr(target) << ", " << getFramebufferAttachmentStr(attachment) << ", " << getTextureTargetStr(textarget) << ", " << texture << ", " << level << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(target), CallTrace::pack(attachment), CallTrace::pack(textarget), CallTrace::pack(texture), CallTrace::pack(level) };
+		m_callTrace->record(s_glFramebufferTexture2DTraceInfo, traceArgs);
+	}
 	m_gl.framebufferTexture2D(target, attachment, textarget, texture, level);
 }
 
@@ -1551,6 +2634,11 @@ void CallLogWrapper::glFramebufferTexture3D (glw::GLenum target, glw::GLenum att
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glFramebufferTexture3D(" << toHex(target) << ", " << toHex(attachment) << ", " << toHex(textarget) << ", " << texture << ", " << level << ", " << zoffset << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(target), CallTrace::pack(attachment), CallTrace::pack(textarget), CallTrace::pack(texture), CallTrace::pack(level), CallTrace::pack(zoffset) };
+		m_callTrace->record(s_glFramebufferTexture3DTraceInfo, traceArgs);
+	}
 	m_gl.framebufferTexture3D(target, attachment, textarget, texture, level, zoffset);
 }
 
@@ -1558,6 +2646,11 @@ void CallLogWrapper::glFramebufferTexture3DOES (glw::GLenum target, glw::GLenum
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glFramebufferTexture3DOES(" << toHex(target) << ", " << toHex(attachment) << ", " << toHex(textarget) << ", " << texture << ", " << level << ", " << zoffset << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(target), CallTrace::pack(attachment), CallTrace::pack(textarget), CallTrace::pack(texture), CallTrace::pack(level), CallTrace::pack(zoffset) };
+		m_callTrace->record(s_glFramebufferTexture3DOESTraceInfo, traceArgs);
+	}
 	m_gl.framebufferTexture3DOES(target, attachment, textarget, texture, level, zoffset);
 }
 
@@ -1565,6 +2658,11 @@ void CallLogWrapper::glFramebufferTextureLayer (glw::GLenum target, glw::GLenum
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glFramebufferTextureLayer(" << getFramebufferTargetStr(target) << ", " << getFramebufferAttachmentStr(attachment) << ", " << texture << ", " << level << ", " << layer << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(target), CallTrace::pack(attachment), CallTrace::pack(texture), CallTrace::pack(level), CallTrace::pack(layer) };
+		m_callTrace->record(s_glFramebufferTextureLayerTraceInfo, traceArgs);
+	}
 	m_gl.framebufferTextureLayer(target, attachment, texture, level, layer);
 }
 
@@ -1572,6 +2670,11 @@ void CallLogWrapper::glFramebufferTextureMultisampleMultiviewOVR (glw::GLenum ta
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glFramebufferTextureMultisampleMultiviewOVR(" << toHex(target) << ", " << toHex(attachment) << ", " << texture << ", " << level << ", " << samples << ", " << baseViewIndex << ", " << numViews << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(target), CallTrace::pack(attachment), CallTrace::pack(texture), CallTrace::pack(level), CallTrace::pack(samples), CallTrace::pack(baseViewIndex), CallTrace::pack(numViews) };
+		m_callTrace->record(s_glFramebufferTextureMultisampleMultiviewOVRTraceInfo, traceArgs);
+	}
 	m_gl.framebufferTextureMultisampleMultiviewOVR(target, attachment, texture, level, samples, baseViewIndex, numViews);
 }
 
@@ -1579,6 +2682,11 @@ void CallLogWrapper::glFramebufferTextureMultiviewOVR (glw::GLenum target, glw::
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glFramebufferTextureMultiviewOVR(" << toHex(target) << ", " << toHex(attachment) << ", " << texture << ", " << level << ", " << baseViewIndex << ", " << numViews << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(target), CallTrace::pack(attachment), CallTrace::pack(texture), CallTrace::pack(level), CallTrace::pack(baseViewIndex), CallTrace::pack(numViews) };
+		m_callTrace->record(s_glFramebufferTextureMultiviewOVRTraceInfo, traceArgs);
+	}
 	m_gl.framebufferTextureMultiviewOVR(target, attachment, texture, level, baseViewIndex, numViews);
 }
 
@@ -1586,6 +2694,11 @@ void CallLogWrapper::glFrontFace (glw::GLenum mode)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glFrontFace(" << getWindingStr(mode) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(mode) };
+		m_callTrace->record(s_glFrontFaceTraceInfo, traceArgs);
+	}
 	m_gl.frontFace(mode);
 }
 
@@ -1593,6 +2706,11 @@ void CallLogWrapper::glGenBuffers (glw::GLsizei n, glw::GLuint *buffers)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGenBuffers(" << n << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(buffers))) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(n), CallTrace::pack(buffers) };
+		m_callTrace->record(s_glGenBuffersTraceInfo, traceArgs);
+	}
 	m_gl.genBuffers(n, buffers);
 	if (m_enableLog)
 		m_log << TestLog::Message << "// buffers = " << getPointerStr(buffers, n) << TestLog::EndMessage;
@@ -1602,6 +2720,11 @@ void CallLogWrapper::glGenFramebuffers (glw::GLsizei n, glw::GLuint *framebuffer
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGenFramebuffers(" << n << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(framebuffers))) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(n), CallTrace::pack(framebuffers) };
+		m_callTrace->record(s_glGenFramebuffersTraceInfo, traceArgs);
+	}
 	m_gl.genFramebuffers(n, framebuffers);
 	if (m_enableLog)
 		m_log << TestLog::Message << "// framebuffers = " << getPointerStr(framebuffers, n) << TestLog::EndMessage;
@@ -1611,6 +2734,11 @@ void CallLogWrapper::glGenProgramPipelines (glw::GLsizei n, glw::GLuint *pipelin
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGenProgramPipelines(" << n << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(pipelines))) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(n), CallTrace::pack(pipelines) };
+		m_callTrace->record(s_glGenProgramPipelinesTraceInfo, traceArgs);
+	}
 	m_gl.genProgramPipelines(n, pipelines);
 	if (m_enableLog)
 		m_log << TestLog::Message << "// pipelines = " << getPointerStr(pipelines, n) << TestLog::EndMessage;
@@ -1620,6 +2748,11 @@ void CallLogWrapper::glGenQueries (glw::GLsizei n, glw::GLuint *ids)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGenQueries(" << n << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(ids))) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(n), CallTrace::pack(ids) };
+		m_callTrace->record(s_glGenQueriesTraceInfo, traceArgs);
+	}
 	m_gl.genQueries(n, ids);
 	if (m_enableLog)
 		m_log << TestLog::Message << "// ids = " << getPointerStr(ids, n) << TestLog::EndMessage;
@@ -1629,6 +2762,11 @@ void CallLogWrapper::glGenRenderbuffers (glw::GLsizei n, glw::GLuint *renderbuff
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGenRenderbuffers(" << n << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(renderbuffers))) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(n), CallTrace::pack(renderbuffers) };
+		m_callTrace->record(s_glGenRenderbuffersTraceInfo, traceArgs);
+	}
 	m_gl.genRenderbuffers(n, renderbuffers);
 	if (m_enableLog)
 		m_log << TestLog::Message << "// renderbuffers = " << getPointerStr(renderbuffers, n) << TestLog::EndMessage;
@@ -1638,6 +2776,11 @@ void CallLogWrapper::glGenSamplers (glw::GLsizei count, glw::GLuint *samplers)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGenSamplers(" << count << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(samplers))) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(count), CallTrace::pack(samplers) };
+		m_callTrace->record(s_glGenSamplersTraceInfo, traceArgs);
+	}
 	m_gl.genSamplers(count, samplers);
 }
 
@@ -1645,6 +2788,11 @@ void CallLogWrapper::glGenTextures (glw::GLsizei n, glw::GLuint *textures)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGenTextures(" << n << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(textures))) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(n), CallTrace::pack(textures) };
+		m_callTrace->record(s_glGenTexturesTraceInfo, traceArgs);
+	}
 	m_gl.genTextures(n, textures);
 	if (m_enableLog)
 		m_log << TestLog::Message << "// textures = " << getPointerStr(textures, n) << TestLog::EndMessage;
@@ -1654,6 +2802,11 @@ void CallLogWrapper::glGenTransformFeedbacks (glw::GLsizei n, glw::GLuint *ids)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGenTransformFeedbacks(" << n << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(ids))) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(n), CallTrace::pack(ids) };
+		m_callTrace->record(s_glGenTransformFeedbacksTraceInfo, traceArgs);
+	}
 	m_gl.genTransformFeedbacks(n, ids);
 	if (m_enableLog)
 		m_log << TestLog::Message << "// ids = " << getPointerStr(ids, n) << TestLog::EndMessage;
@@ -1663,6 +2816,11 @@ void CallLogWrapper::glGenVertexArrays (glw::GLsizei n, glw::GLuint *arrays)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGenVertexArrays(" << n << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(arrays))) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(n), CallTrace::pack(arrays) };
+		m_callTrace->record(s_glGenVertexArraysTraceInfo, traceArgs);
+	}
 	m_gl.genVertexArrays(n, arrays);
 	if (m_enableLog)
 		m_log << TestLog::Message << "// arrays = " << getPointerStr(arrays, n) << TestLog::EndMessage;
@@ -1672,6 +2830,11 @@ void CallLogWrapper::glGenerateMipmap (glw::GLenum target)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGenerateMipmap(" << getTextureTargetStr(target) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(target) };
+		m_callTrace->record(s_glGenerateMipmapTraceInfo, traceArgs);
+	}
 	m_gl.generateMipmap(target);
 }
 
@@ -1679,6 +2842,11 @@ void CallLogWrapper::glGenerateMultiTexMipmapEXT (glw::GLenum texunit, glw::GLen
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGenerateMultiTexMipmapEXT(" << toHex(texunit) << ", " << toHex(target) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(texunit), CallTrace::pack(target) };
+		m_callTrace->record(s_glGenerateMultiTexMipmapEXTTraceInfo, traceArgs);
+	}
 	m_gl.generateMultiTexMipmapEXT(texunit, target);
 }
 
@@ -1686,6 +2854,11 @@ void CallLogWrapper::glGenerateTextureMipmap (glw::GLuint texture)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGenerateTextureMipmap(" << texture << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(texture) };
+		m_callTrace->record(s_glGenerateTextureMipmapTraceInfo, traceArgs);
+	}
 	m_gl.generateTextureMipmap(texture);
 }
 
@@ -1693,6 +2866,11 @@ void CallLogWrapper::glGenerateTextureMipmapEXT (glw::GLuint texture, glw::GLenu
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGenerateTextureMipmapEXT(" << texture << ", " << toHex(target) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(texture), CallTrace::pack(target) };
+		m_callTrace->record(s_glGenerateTextureMipmapEXTTraceInfo, traceArgs);
+	}
 	m_gl.generateTextureMipmapEXT(texture, target);
 }
 
@@ -1700,6 +2878,11 @@ void CallLogWrapper::glGetActiveAtomicCounterBufferiv (glw::GLuint program, glw:
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetActiveAtomicCounterBufferiv(" << program << ", " << bufferIndex << ", " << toHex(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(program), CallTrace::pack(bufferIndex), CallTrace::pack(pname), CallTrace::pack(params) };
+		m_callTrace->record(s_glGetActiveAtomicCounterBufferivTraceInfo, traceArgs);
+	}
 	m_gl.getActiveAtomicCounterBufferiv(program, bufferIndex, pname, params);
 }
 
@@ -1707,6 +2890,11 @@ void CallLogWrapper::glGetActiveAttrib (glw::GLuint program, glw::GLuint index,
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetActiveAttrib(" << program << ", " << index << ", " << bufSize << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(length))) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(size))) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(type))) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(name))) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(program), CallTrace::pack(index), CallTrace::pack(bufSize), CallTrace::pack(length), CallTrace::pack(size), CallTrace::pack(type), CallTrace::pack(name) };
+		m_callTrace->record(s_glGetActiveAttribTraceInfo, traceArgs);
+	}
 	m_gl.getActiveAttrib(program, index, bufSize, length, size, type, name);
 }
 
@@ -1714,6 +2902,11 @@ void CallLogWrapper::glGetActiveSubroutineName (glw::GLuint program, glw::GLenum
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetActiveSubroutineName(" << program << ", " << toHex(shadertype) << ", " << index << ", " << bufsize << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(length))) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(name))) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(program), CallTrace::pack(shadertype), CallTrace::pack(index), CallTrace::pack(bufsize), CallTrace::pack(length), CallTrace::pack(name) };
+		m_callTrace->record(s_glGetActiveSubroutineNameTraceInfo, traceArgs);
+	}
 	m_gl.getActiveSubroutineName(program, shadertype, index, bufsize, length, name);
 }
 
@@ -1721,6 +2914,11 @@ void CallLogWrapper::glGetActiveSubroutineUniformName (glw::GLuint program, glw:
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetActiveSubroutineUniformName(" << program << ", " << toHex(shadertype) << ", " << index << ", " << bufsize << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(length))) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(name))) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(program), CallTrace::pack(shadertype), CallTrace::pack(index), CallTrace::pack(bufsize), CallTrace::pack(length), CallTrace::pack(name) };
+		m_callTrace->record(s_glGetActiveSubroutineUniformNameTraceInfo, traceArgs);
+	}
 	m_gl.getActiveSubroutineUniformName(program, shadertype, index, bufsize, length, name);
 }
 
@@ -1728,6 +2926,11 @@ void CallLogWrapper::glGetActiveSubroutineUniformiv (glw::GLuint program, glw::G
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetActiveSubroutineUniformiv(" << program << ", " << toHex(shadertype) << ", " << index << ", " << toHex(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(values))) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(program), CallTrace::pack(shadertype), CallTrace::pack(index), CallTrace::pack(pname), CallTrace::pack(values) };
+		m_callTrace->record(s_glGetActiveSubroutineUniformivTraceInfo, traceArgs);
+	}
 	m_gl.getActiveSubroutineUniformiv(program, shadertype, index, pname, values);
 }
 
@@ -1735,6 +2938,11 @@ void CallLogWrapper::glGetActiveUniform (glw::GLuint program, glw::GLuint index,
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetActiveUniform(" << program << ", " << index << ", " << bufSize << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(length))) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(size))) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(type))) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(name))) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(program), CallTrace::pack(index), CallTrace::pack(bufSize), CallTrace::pack(length), CallTrace::pack(size), CallTrace::pack(type), CallTrace::pack(name) };
+		m_callTrace->record(s_glGetActiveUniformTraceInfo, traceArgs);
+	}
 	m_gl.getActiveUniform(program, index, bufSize, length, size, type, name);
 	if (m_enableLog)
 	{
@@ -1749,6 +2957,11 @@ void CallLogWrapper::glGetActiveUniformBlockName (glw::GLuint program, glw::GLui
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetActiveUniformBlockName(" << program << ", " << uniformBlockIndex << ", " << bufSize << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(length))) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(uniformBlockName))) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(program), CallTrace::pack(uniformBlockIndex), CallTrace::pack(bufSize), CallTrace::pack(length), CallTrace::pack(uniformBlockName) };
+		m_callTrace->record(s_glGetActiveUniformBlockNameTraceInfo, traceArgs);
+	}
 	m_gl.getActiveUniformBlockName(program, uniformBlockIndex, bufSize, length, uniformBlockName);
 }
 
@@ -1756,6 +2969,11 @@ void CallLogWrapper::glGetActiveUniformBlockiv (glw::GLuint program, glw::GLuint
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetActiveUniformBlockiv(" << program << ", " << uniformBlockIndex << ", " << toHex(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(program), CallTrace::pack(uniformBlockIndex), CallTrace::pack(pname), CallTrace::pack(params) };
+		m_callTrace->record(s_glGetActiveUniformBlockivTraceInfo, traceArgs);
+	}
 	m_gl.getActiveUniformBlockiv(program, uniformBlockIndex, pname, params);
 }
 
@@ -1763,6 +2981,11 @@ void CallLogWrapper::glGetActiveUniformName (glw::GLuint program, glw::GLuint un
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetActiveUniformName(" << program << ", " << uniformIndex << ", " << bufSize << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(length))) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(uniformName))) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(program), CallTrace::pack(uniformIndex), CallTrace::pack(bufSize), CallTrace::pack(length), CallTrace::pack(uniformName) };
+		m_callTrace->record(s_glGetActiveUniformNameTraceInfo, traceArgs);
+	}
 	m_gl.getActiveUniformName(program, uniformIndex, bufSize, length, uniformName);
 }
 
@@ -1770,6 +2993,11 @@ void CallLogWrapper::glGetActiveUniformsiv (glw::GLuint program, glw::GLsizei un
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetActiveUniformsiv(" << program << ", " << uniformCount << ", " << getPointerStr(uniformIndices, uniformCount) << ", " << getUniformParamStr(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(program), CallTrace::pack(uniformCount), CallTrace::pack(uniformIndices), CallTrace::pack(pname), CallTrace::pack(params) };
+		m_callTrace->record(s_glGetActiveUniformsivTraceInfo, traceArgs);
+	}
 	m_gl.getActiveUniformsiv(program, uniformCount, uniformIndices, pname, params);
 	if (m_enableLog)
 		m_log << TestLog::Message << "// params = " << getPointerStr(params, uniformCount) << TestLog::EndMessage;
@@ -1779,6 +3007,11 @@ void CallLogWrapper::glGetAttachedShaders (glw::GLuint program, glw::GLsizei max
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetAttachedShaders(" << program << ", " << maxCount << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(count))) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(shaders))) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(program), CallTrace::pack(maxCount), CallTrace::pack(count), CallTrace::pack(shaders) };
+		m_callTrace->record(s_glGetAttachedShadersTraceInfo, traceArgs);
+	}
 	m_gl.getAttachedShaders(program, maxCount, count, shaders);
 }
 
@@ -1786,9 +3019,16 @@ glw::GLint CallLogWrapper::glGetAttribLocation (glw::GLuint program, const glw::
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetAttribLocation(" << program << ", " << getStringStr(name) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(program), CallTrace::pack(name) };
+		m_callTrace->record(s_glGetAttribLocationTraceInfo, traceArgs);
+	}
 	glw::GLint returnValue = m_gl.getAttribLocation(program, name);
 	if (m_enableLog)
 		m_log << TestLog::Message << "// " << returnValue << " returned" << TestLog::EndMessage;
+	if (m_callTrace)
+		m_callTrace->setReturnValue(CallTrace::pack(returnValue));
 	return returnValue;
 }
 
@@ -1796,6 +3036,11 @@ void CallLogWrapper::glGetBooleani_v (glw::GLenum target, glw::GLuint index, glw
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetBooleani_v(" << getGettableIndexedStateStr(target) << ", " << index << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(data))) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(target), CallTrace::pack(index), CallTrace::pack(data) };
+		m_callTrace->record(s_glGetBooleani_vTraceInfo, traceArgs);
+	}
 	m_gl.getBooleani_v(target, index, data);
 	if (m_enableLog)
 		m_log << TestLog::Message << "// data = " << getBooleanPointerStr(data, getIndexedQueryNumArgsOut(target)) << TestLog::EndMessage;
@@ -1805,6 +3050,11 @@ void CallLogWrapper::glGetBooleanv (glw::GLenum pname, glw::GLboolean *data)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetBooleanv(" << getGettableStateStr(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(data))) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(pname), CallTrace::pack(data) };
+		m_callTrace->record(s_glGetBooleanvTraceInfo, traceArgs);
+	}
 	m_gl.getBooleanv(pname, data);
 	if (m_enableLog)
 		m_log << TestLog::Message << "// data = " << getBooleanPointerStr(data, getBasicQueryNumArgsOut(pname)) << TestLog::EndMessage;
@@ -1814,6 +3064,11 @@ void CallLogWrapper::glGetBufferParameteri64v (glw::GLenum target, glw::GLenum p
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetBufferParameteri64v(" << getBufferTargetStr(target) << ", " << getBufferQueryStr(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(target), CallTrace::pack(pname), CallTrace::pack(params) };
+		m_callTrace->record(s_glGetBufferParameteri64vTraceInfo, traceArgs);
+	}
 	m_gl.getBufferParameteri64v(target, pname, params);
 }
 
@@ -1821,6 +3076,11 @@ void CallLogWrapper::glGetBufferParameteriv (glw::GLenum target, glw::GLenum pna
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetBufferParameteriv(" << getBufferTargetStr(target) << ", " << getBufferQueryStr(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(target), CallTrace::pack(pname), CallTrace::pack(params) };
+		m_callTrace->record(s_glGetBufferParameterivTraceInfo, traceArgs);
+	}
 	m_gl.getBufferParameteriv(target, pname, params);
 }
 
@@ -1828,6 +3088,11 @@ void CallLogWrapper::glGetBufferPointerv (glw::GLenum target, glw::GLenum pname,
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetBufferPointerv(" << toHex(target) << ", " << toHex(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(target), CallTrace::pack(pname), CallTrace::pack(params) };
+		m_callTrace->record(s_glGetBufferPointervTraceInfo, traceArgs);
+	}
 	m_gl.getBufferPointerv(target, pname, params);
 }
 
@@ -1835,6 +3100,11 @@ void CallLogWrapper::glGetBufferSubData (glw::GLenum target, glw::GLintptr offse
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetBufferSubData(" << toHex(target) << ", " << offset << ", " << size << ", " << data << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(target), CallTrace::pack(offset), CallTrace::pack(size), CallTrace::pack(data) };
+		m_callTrace->record(s_glGetBufferSubDataTraceInfo, traceArgs);
+	}
 	m_gl.getBufferSubData(target, offset, size, data);
 }
 
@@ -1842,6 +3112,11 @@ void CallLogWrapper::glGetCompressedMultiTexImageEXT (glw::GLenum texunit, glw::
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetCompressedMultiTexImageEXT(" << toHex(texunit) << ", " << toHex(target) << ", " << lod << ", " << img << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(texunit), CallTrace::pack(target), CallTrace::pack(lod), CallTrace::pack(img) };
+		m_callTrace->record(s_glGetCompressedMultiTexImageEXTTraceInfo, traceArgs);
+	}
 	m_gl.getCompressedMultiTexImageEXT(texunit, target, lod, img);
 }
 
@@ -1849,6 +3124,11 @@ void CallLogWrapper::glGetCompressedTexImage (glw::GLenum target, glw::GLint lev
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetCompressedTexImage(" << toHex(target) << ", " << level << ", " << img << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(target), CallTrace::pack(level), CallTrace::pack(img) };
+		m_callTrace->record(s_glGetCompressedTexImageTraceInfo, traceArgs);
+	}
 	m_gl.getCompressedTexImage(target, level, img);
 }
 
@@ -1856,6 +3136,11 @@ void CallLogWrapper::glGetCompressedTextureImage (glw::GLuint texture, glw::GLin
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetCompressedTextureImage(" << texture << ", " << level << ", " << bufSize << ", " << pixels << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(texture), CallTrace::pack(level), CallTrace::pack(bufSize), CallTrace::pack(pixels) };
+		m_callTrace->record(s_glGetCompressedTextureImageTraceInfo, traceArgs);
+	}
 	m_gl.getCompressedTextureImage(texture, level, bufSize, pixels);
 }
 
@@ -1863,6 +3148,11 @@ void CallLogWrapper::glGetCompressedTextureImageEXT (glw::GLuint texture, glw::G
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetCompressedTextureImageEXT(" << texture << ", " << toHex(target) << ", " << lod << ", " << img << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(texture), CallTrace::pack(target), CallTrace::pack(lod), CallTrace::pack(img) };
+		m_callTrace->record(s_glGetCompressedTextureImageEXTTraceInfo, traceArgs);
+	}
 	m_gl.getCompressedTextureImageEXT(texture, target, lod, img);
 }
 
@@ -1870,6 +3160,11 @@ void CallLogWrapper::glGetCompressedTextureSubImage (glw::GLuint texture, glw::G
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetCompressedTextureSubImage(" << texture << ", " << level << ", " << xoffset << ", " << yoffset << ", " << zoffset << ", " << width << ", " << height << ", " << depth << ", " << bufSize << ", " << pixels << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(texture), CallTrace::pack(level), CallTrace::pack(xoffset), CallTrace::pack(yoffset), CallTrace::pack(zoffset), CallTrace::pack(width), CallTrace::pack(height), CallTrace::pack(depth), CallTrace::pack(bufSize), CallTrace::pack(pixels) };
+		m_callTrace->record(s_glGetCompressedTextureSubImageTraceInfo, traceArgs);
+	}
 	m_gl.getCompressedTextureSubImage(texture, level, xoffset, yoffset, zoffset, width, height, depth, bufSize, pixels);
 }
 
@@ -1877,9 +3172,16 @@ glw::GLuint CallLogWrapper::glGetDebugMessageLog (glw::GLuint count, glw::GLsize
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetDebugMessageLog(" << count << ", " << bufSize << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(sources))) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(types))) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(ids))) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(severities))) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(lengths))) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(messageLog))) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(count), CallTrace::pack(bufSize), CallTrace::pack(sources), CallTrace::pack(types), CallTrace::pack(ids), CallTrace::pack(severities), CallTrace::pack(lengths), CallTrace::pack(messageLog) };
+		m_callTrace->record(s_glGetDebugMessageLogTraceInfo, traceArgs);
+	}
 	glw::GLuint returnValue = m_gl.getDebugMessageLog(count, bufSize, sources, types, ids, severities, lengths, messageLog);
 	if (m_enableLog)
 		m_log << TestLog::Message << "// " << returnValue << " returned" << TestLog::EndMessage;
+	if (m_callTrace)
+		m_callTrace->setReturnValue(CallTrace::pack(returnValue));
 	return returnValue;
 }
 
@@ -1887,6 +3189,11 @@ void CallLogWrapper::glGetDoublei_v (glw::GLenum target, glw::GLuint index, glw:
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetDoublei_v(" << toHex(target) << ", " << index << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(data))) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(target), CallTrace::pack(index), CallTrace::pack(data) };
+		m_callTrace->record(s_glGetDoublei_vTraceInfo, traceArgs);
+	}
 	m_gl.getDoublei_v(target, index, data);
 }
 
@@ -1894,6 +3201,11 @@ void CallLogWrapper::glGetDoublev (glw::GLenum pname, glw::GLdouble *data)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetDoublev(" << toHex(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(data))) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(pname), CallTrace::pack(data) };
+		m_callTrace->record(s_glGetDoublevTraceInfo, traceArgs);
+	}
 	m_gl.getDoublev(pname, data);
 }
 
@@ -1901,9 +3213,13 @@ glw::GLenum CallLogWrapper::glGetError (void)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetError(" << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+		m_callTrace->record(s_glGetErrorTraceInfo, DE_NULL);
 	glw::GLenum returnValue = m_gl.getError();
 	if (m_enableLog)
 		m_log << TestLog::Message << "// " << getErrorStr(returnValue) << " returned" << TestLog::EndMessage;
+	if (m_callTrace)
+		m_callTrace->setReturnValue(CallTrace::pack(returnValue));
 	return returnValue;
 }
 
@@ -1911,6 +3227,11 @@ void CallLogWrapper::glGetFloati_v (glw::GLenum target, glw::GLuint index, glw::
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetFloati_v(" << toHex(target) << ", " << index << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(data))) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(target), CallTrace::pack(index), CallTrace::pack(data) };
+		m_callTrace->record(s_glGetFloati_vTraceInfo, traceArgs);
+	}
 	m_gl.getFloati_v(target, index, data);
 }
 
@@ -1918,6 +3239,11 @@ void CallLogWrapper::glGetFloatv (glw::GLenum pname, glw::GLfloat *data)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetFloatv(" << getGettableStateStr(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(data))) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(pname), CallTrace::pack(data) };
+		m_callTrace->record(s_glGetFloatvTraceInfo, traceArgs);
+	}
 	m_gl.getFloatv(pname, data);
 	if (m_enableLog)
 		m_log << TestLog::Message << "// data = " << getPointerStr(data, getBasicQueryNumArgsOut(pname)) << TestLog::EndMessage;
@@ -1927,9 +3253,16 @@ glw::GLint CallLogWrapper::glGetFragDataIndex (glw::GLuint program, const glw::G
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetFragDataIndex(" << program << ", " << getStringStr(name) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(program), CallTrace::pack(name) };
+		m_callTrace->record(s_glGetFragDataIndexTraceInfo, traceArgs);
+	}
 	glw::GLint returnValue = m_gl.getFragDataIndex(program, name);
 	if (m_enableLog)
 		m_log << TestLog::Message << "// " << returnValue << " returned" << TestLog::EndMessage;
+	if (m_callTrace)
+		m_callTrace->setReturnValue(CallTrace::pack(returnValue));
 	return returnValue;
 }
 
@@ -1937,9 +3270,16 @@ glw::GLint CallLogWrapper::glGetFragDataLocation (glw::GLuint program, const glw
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetFragDataLocation(" << program << ", " << getStringStr(name) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(program), CallTrace::pack(name) };
+		m_callTrace->record(s_glGetFragDataLocationTraceInfo, traceArgs);
+	}
 	glw::GLint returnValue = m_gl.getFragDataLocation(program, name);
 	if (m_enableLog)
 		m_log << TestLog::Message << "// " << returnValue << " returned" << TestLog::EndMessage;
+	if (m_callTrace)
+		m_callTrace->setReturnValue(CallTrace::pack(returnValue));
 	return returnValue;
 }
 
@@ -1947,6 +3287,11 @@ void CallLogWrapper::glGetFramebufferAttachmentParameteriv (glw::GLenum target,
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetFramebufferAttachmentParameteriv(" << getFramebufferTargetStr(target) << ", " << getFramebufferAttachmentStr(attachment) << ", " << getFramebufferAttachmentParameterStr(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(target), CallTrace::pack(attachment), CallTrace::pack(pname), CallTrace::pack(params) };
+		m_callTrace->record(s_glGetFramebufferAttachmentParameterivTraceInfo, traceArgs);
+	}
 	m_gl.getFramebufferAttachmentParameteriv(target, attachment, pname, params);
 	if (m_enableLog)
 		m_log << TestLog::Message << "// params = " << getFramebufferAttachmentParameterValueStr(pname, params) << TestLog::EndMessage;
@@ -1956,6 +3301,11 @@ void CallLogWrapper::glGetFramebufferParameteriv (glw::GLenum target, glw::GLenu
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetFramebufferParameteriv(" << getFramebufferTargetStr(target) << ", " << getFramebufferParameterStr(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(target), CallTrace::pack(pname), CallTrace::pack(params) };
+		m_callTrace->record(s_glGetFramebufferParameterivTraceInfo, traceArgs);
+	}
 	m_gl.getFramebufferParameteriv(target, pname, params);
 	if (m_enableLog)
 		m_log << TestLog::Message << "// params = " << getPointerStr(params, 1) << TestLog::EndMessage;
@@ -1965,6 +3315,11 @@ void CallLogWrapper::glGetFramebufferParameterivEXT (glw::GLuint framebuffer, gl
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetFramebufferParameterivEXT(" << framebuffer << ", " << toHex(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(framebuffer), CallTrace::pack(pname), CallTrace::pack(params) };
+		m_callTrace->record(s_glGetFramebufferParameterivEXTTraceInfo, traceArgs);
+	}
 	m_gl.getFramebufferParameterivEXT(framebuffer, pname, params);
 }
 
@@ -1972,9 +3327,13 @@ glw::GLenum CallLogWrapper::glGetGraphicsResetStatus (void)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetGraphicsResetStatus(" << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+		m_callTrace->record(s_glGetGraphicsResetStatusTraceInfo, DE_NULL);
 	glw::GLenum returnValue = m_gl.getGraphicsResetStatus();
 	if (m_enableLog)
 		m_log << TestLog::Message << "// " << toHex(returnValue) << " returned" << TestLog::EndMessage;
+	if (m_callTrace)
+		m_callTrace->setReturnValue(CallTrace::pack(returnValue));
 	return returnValue;
 }
 
@@ -1982,6 +3341,11 @@ void CallLogWrapper::glGetInteger64i_v (glw::GLenum target, glw::GLuint index, g
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetInteger64i_v(" << getGettableIndexedStateStr(target) << ", " << index << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(data))) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(target), CallTrace::pack(index), CallTrace::pack(data) };
+		m_callTrace->record(s_glGetInteger64i_vTraceInfo, traceArgs);
+	}
 	m_gl.getInteger64i_v(target, index, data);
 	if (m_enableLog)
 		m_log << TestLog::Message << "// data = " << getPointerStr(data, getIndexedQueryNumArgsOut(target)) << TestLog::EndMessage;
@@ -1991,6 +3355,11 @@ void CallLogWrapper::glGetInteger64v (glw::GLenum pname, glw::GLint64 *data)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetInteger64v(" << getGettableStateStr(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(data))) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(pname), CallTrace::pack(data) };
+		m_callTrace->record(s_glGetInteger64vTraceInfo, traceArgs);
+	}
 	m_gl.getInteger64v(pname, data);
 	if (m_enableLog)
 		m_log << TestLog::Message << "// data = " << getPointerStr(data, getBasicQueryNumArgsOut(pname)) << TestLog::EndMessage;
@@ -2000,6 +3369,11 @@ void CallLogWrapper::glGetIntegeri_v (glw::GLenum target, glw::GLuint index, glw
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetIntegeri_v(" << getGettableIndexedStateStr(target) << ", " << index << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(data))) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(target), CallTrace::pack(index), CallTrace::pack(data) };
+		m_callTrace->record(s_glGetIntegeri_vTraceInfo, traceArgs);
+	}
 	m_gl.getIntegeri_v(target, index, data);
 	if (m_enableLog)
 		m_log << TestLog::Message << "// data = " << getPointerStr(data, getIndexedQueryNumArgsOut(target)) << TestLog::EndMessage;
@@ -2009,6 +3383,11 @@ void CallLogWrapper::glGetIntegerv (glw::GLenum pname, glw::GLint *data)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetIntegerv(" << getGettableStateStr(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(data))) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(pname), CallTrace::pack(data) };
+		m_callTrace->record(s_glGetIntegervTraceInfo, traceArgs);
+	}
 	m_gl.getIntegerv(pname, data);
 	if (m_enableLog)
 		m_log << TestLog::Message << "// data = " << getPointerStr(data, getBasicQueryNumArgsOut(pname)) << TestLog::EndMessage;
@@ -2018,6 +3397,11 @@ void CallLogWrapper::glGetInternalformatSampleivNV (glw::GLenum target, glw::GLe
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetInternalformatSampleivNV(" << toHex(target) << ", " << toHex(internalformat) << ", " << samples << ", " << toHex(pname) << ", " << bufSize << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(target), CallTrace::pack(internalformat), CallTrace::pack(samples), CallTrace::pack(pname), CallTrace::pack(bufSize), CallTrace::pack(params) };
+		m_callTrace->record(s_glGetInternalformatSampleivNVTraceInfo, traceArgs);
+	}
 	m_gl.getInternalformatSampleivNV(target, internalformat, samples, pname, bufSize, params);
 }
 
@@ -2025,6 +3409,11 @@ void CallLogWrapper::glGetInternalformati64v (glw::GLenum target, glw::GLenum in
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetInternalformati64v(" << toHex(target) << ", " << toHex(internalformat) << ", " << toHex(pname) << ", " << bufSize << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(target), CallTrace::pack(internalformat), CallTrace::pack(pname), CallTrace::pack(bufSize), CallTrace::pack(params) };
+		m_callTrace->record(s_glGetInternalformati64vTraceInfo, traceArgs);
+	}
 	m_gl.getInternalformati64v(target, internalformat, pname, bufSize, params);
 }
 
@@ -2032,6 +3421,11 @@ void CallLogWrapper::glGetInternalformativ (glw::GLenum target, glw::GLenum inte
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetInternalformativ(" << getInternalFormatTargetStr(target) << ", " << getUncompressedTextureFormatStr(internalformat) << ", " << getInternalFormatParameterStr(pname) << ", " << bufSize << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(target), CallTrace::pack(internalformat), CallTrace::pack(pname), CallTrace::pack(bufSize), CallTrace::pack(params) };
+		m_callTrace->record(s_glGetInternalformativTraceInfo, traceArgs);
+	}
 	m_gl.getInternalformativ(target, internalformat, pname, bufSize, params);
 	if (m_enableLog)
 		m_log << TestLog::Message << "// params = " << getPointerStr(params, bufSize) << TestLog::EndMessage;
@@ -2041,6 +3435,11 @@ void CallLogWrapper::glGetMultiTexEnvfvEXT (glw::GLenum texunit, glw::GLenum tar
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetMultiTexEnvfvEXT(" << toHex(texunit) << ", " << toHex(target) << ", " << toHex(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(texunit), CallTrace::pack(target), CallTrace::pack(pname), CallTrace::pack(params) };
+		m_callTrace->record(s_glGetMultiTexEnvfvEXTTraceInfo, traceArgs);
+	}
 	m_gl.getMultiTexEnvfvEXT(texunit, target, pname, params);
 }
 
@@ -2048,6 +3447,11 @@ void CallLogWrapper::glGetMultiTexEnvivEXT (glw::GLenum texunit, glw::GLenum tar
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetMultiTexEnvivEXT(" << toHex(texunit) << ", " << toHex(target) << ", " << toHex(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(texunit), CallTrace::pack(target), CallTrace::pack(pname), CallTrace::pack(params) };
+		m_callTrace->record(s_glGetMultiTexEnvivEXTTraceInfo, traceArgs);
+	}
 	m_gl.getMultiTexEnvivEXT(texunit, target, pname, params);
 }
 
@@ -2055,6 +3459,11 @@ void CallLogWrapper::glGetMultiTexGendvEXT (glw::GLenum texunit, glw::GLenum coo
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetMultiTexGendvEXT(" << toHex(texunit) << ", " << toHex(coord) << ", " << toHex(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(texunit), CallTrace::pack(coord), CallTrace::pack(pname), CallTrace::pack(params) };
+		m_callTrace->record(s_glGetMultiTexGendvEXTTraceInfo, traceArgs);
+	}
 	m_gl.getMultiTexGendvEXT(texunit, coord, pname, params);
 }
 
@@ -2062,6 +3471,11 @@ void CallLogWrapper::glGetMultiTexGenfvEXT (glw::GLenum texunit, glw::GLenum coo
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetMultiTexGenfvEXT(" << toHex(texunit) << ", " << toHex(coord) << ", " << toHex(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(texunit), CallTrace::pack(coord), CallTrace::pack(pname), CallTrace::pack(params) };
+		m_callTrace->record(s_glGetMultiTexGenfvEXTTraceInfo, traceArgs);
+	}
 	m_gl.getMultiTexGenfvEXT(texunit, coord, pname, params);
 }
 
@@ -2069,6 +3483,11 @@ void CallLogWrapper::glGetMultiTexGenivEXT (glw::GLenum texunit, glw::GLenum coo
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetMultiTexGenivEXT(" << toHex(texunit) << ", " << toHex(coord) << ", " << toHex(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(texunit), CallTrace::pack(coord), CallTrace::pack(pname), CallTrace::pack(params) };
+		m_callTrace->record(s_glGetMultiTexGenivEXTTraceInfo, traceArgs);
+	}
 	m_gl.getMultiTexGenivEXT(texunit, coord, pname, params);
 }
 
@@ -2076,6 +3495,11 @@ void CallLogWrapper::glGetMultiTexImageEXT (glw::GLenum texunit, glw::GLenum tar
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetMultiTexImageEXT(" << toHex(texunit) << ", " << toHex(target) << ", " << level << ", " << toHex(format) << ", " << toHex(type) << ", " << pixels << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(texunit), CallTrace::pack(target), CallTrace::pack(level), CallTrace::pack(format), CallTrace::pack(type), CallTrace::pack(pixels) };
+		m_callTrace->record(s_glGetMultiTexImageEXTTraceInfo, traceArgs);
+	}
 	m_gl.getMultiTexImageEXT(texunit, target, level, format, type, pixels);
 }
 
@@ -2083,6 +3507,11 @@ void CallLogWrapper::glGetMultiTexLevelParameterfvEXT (glw::GLenum texunit, glw:
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetMultiTexLevelParameterfvEXT(" << toHex(texunit) << ", " << toHex(target) << ", " << level << ", " << toHex(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(texunit), CallTrace::pack(target), CallTrace::pack(level), CallTrace::pack(pname), CallTrace::pack(params) };
+		m_callTrace->record(s_glGetMultiTexLevelParameterfvEXTTraceInfo, traceArgs);
+	}
 	m_gl.getMultiTexLevelParameterfvEXT(texunit, target, level, pname, params);
 }
 
@@ -2090,6 +3519,11 @@ void CallLogWrapper::glGetMultiTexLevelParameterivEXT (glw::GLenum texunit, glw:
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetMultiTexLevelParameterivEXT(" << toHex(texunit) << ", " << toHex(target) << ", " << level << ", " << toHex(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(texunit), CallTrace::pack(target), CallTrace::pack(level), CallTrace::pack(pname), CallTrace::pack(params) };
+		m_callTrace->record(s_glGetMultiTexLevelParameterivEXTTraceInfo, traceArgs);
+	}
 	m_gl.getMultiTexLevelParameterivEXT(texunit, target, level, pname, params);
 }
 
@@ -2097,6 +3531,11 @@ void CallLogWrapper::glGetMultiTexParameterIivEXT (glw::GLenum texunit, glw::GLe
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetMultiTexParameterIivEXT(" << toHex(texunit) << ", " << toHex(target) << ", " << toHex(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(texunit), CallTrace::pack(target), CallTrace::pack(pname), CallTrace::pack(params) };
+		m_callTrace->record(s_glGetMultiTexParameterIivEXTTraceInfo, traceArgs);
+	}
 	m_gl.getMultiTexParameterIivEXT(texunit, target, pname, params);
 }
 
@@ -2104,6 +3543,11 @@ void CallLogWrapper::glGetMultiTexParameterIuivEXT (glw::GLenum texunit, glw::GL
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetMultiTexParameterIuivEXT(" << toHex(texunit) << ", " << toHex(target) << ", " << toHex(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(texunit), CallTrace::pack(target), CallTrace::pack(pname), CallTrace::pack(params) };
+		m_callTrace->record(s_glGetMultiTexParameterIuivEXTTraceInfo, traceArgs);
+	}
 	m_gl.getMultiTexParameterIuivEXT(texunit, target, pname, params);
 }
 
@@ -2111,6 +3555,11 @@ void CallLogWrapper::glGetMultiTexParameterfvEXT (glw::GLenum texunit, glw::GLen
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetMultiTexParameterfvEXT(" << toHex(texunit) << ", " << toHex(target) << ", " << toHex(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(texunit), CallTrace::pack(target), CallTrace::pack(pname), CallTrace::pack(params) };
+		m_callTrace->record(s_glGetMultiTexParameterfvEXTTraceInfo, traceArgs);
+	}
 	m_gl.getMultiTexParameterfvEXT(texunit, target, pname, params);
 }
 
@@ -2118,6 +3567,11 @@ void CallLogWrapper::glGetMultiTexParameterivEXT (glw::GLenum texunit, glw::GLen
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetMultiTexParameterivEXT(" << toHex(texunit) << ", " << toHex(target) << ", " << toHex(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(texunit), CallTrace::pack(target), CallTrace::pack(pname), CallTrace::pack(params) };
+		m_callTrace->record(s_glGetMultiTexParameterivEXTTraceInfo, traceArgs);
+	}
 	m_gl.getMultiTexParameterivEXT(texunit, target, pname, params);
 }
 
@@ -2125,6 +3579,11 @@ void CallLogWrapper::glGetMultisamplefv (glw::GLenum pname, glw::GLuint index, g
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetMultisamplefv(" << getMultisampleParameterStr(pname) << ", " << index << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(val))) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(pname), CallTrace::pack(index), CallTrace::pack(val) };
+		m_callTrace->record(s_glGetMultisamplefvTraceInfo, traceArgs);
+	}
 	m_gl.getMultisamplefv(pname, index, val);
 	if (m_enableLog)
 		m_log << TestLog::Message << "// val = " << getPointerStr(val, 2) << TestLog::EndMessage;
@@ -2134,6 +3593,11 @@ void CallLogWrapper::glGetNamedBufferParameteri64v (glw::GLuint buffer, glw::GLe
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetNamedBufferParameteri64v(" << buffer << ", " << toHex(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(buffer), CallTrace::pack(pname), CallTrace::pack(params) };
+		m_callTrace->record(s_glGetNamedBufferParameteri64vTraceInfo, traceArgs);
+	}
 	m_gl.getNamedBufferParameteri64v(buffer, pname, params);
 }
 
@@ -2141,6 +3605,11 @@ void CallLogWrapper::glGetNamedBufferParameteriv (glw::GLuint buffer, glw::GLenu
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetNamedBufferParameteriv(" << buffer << ", " << toHex(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(buffer), CallTrace::pack(pname), CallTrace::pack(params) };
+		m_callTrace->record(s_glGetNamedBufferParameterivTraceInfo, traceArgs);
+	}
 	m_gl.getNamedBufferParameteriv(buffer, pname, params);
 }
 
@@ -2148,6 +3617,11 @@ void CallLogWrapper::glGetNamedBufferParameterivEXT (glw::GLuint buffer, glw::GL
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetNamedBufferParameterivEXT(" << buffer << ", " << toHex(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(buffer), CallTrace::pack(pname), CallTrace::pack(params) };
+		m_callTrace->record(s_glGetNamedBufferParameterivEXTTraceInfo, traceArgs);
+	}
 	m_gl.getNamedBufferParameterivEXT(buffer, pname, params);
 }
 
@@ -2155,6 +3629,11 @@ void CallLogWrapper::glGetNamedBufferPointerv (glw::GLuint buffer, glw::GLenum p
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetNamedBufferPointerv(" << buffer << ", " << toHex(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(buffer), CallTrace::pack(pname), CallTrace::pack(params) };
+		m_callTrace->record(s_glGetNamedBufferPointervTraceInfo, traceArgs);
+	}
 	m_gl.getNamedBufferPointerv(buffer, pname, params);
 }
 
@@ -2162,6 +3641,11 @@ void CallLogWrapper::glGetNamedBufferPointervEXT (glw::GLuint buffer, glw::GLenu
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetNamedBufferPointervEXT(" << buffer << ", " << toHex(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(buffer), CallTrace::pack(pname), CallTrace::pack(params) };
+		m_callTrace->record(s_glGetNamedBufferPointervEXTTraceInfo, traceArgs);
+	}
 	m_gl.getNamedBufferPointervEXT(buffer, pname, params);
 }
 
@@ -2169,6 +3653,11 @@ void CallLogWrapper::glGetNamedBufferSubData (glw::GLuint buffer, glw::GLintptr
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetNamedBufferSubData(" << buffer << ", " << offset << ", " << size << ", " << data << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(buffer), CallTrace::pack(offset), CallTrace::pack(size), CallTrace::pack(data) };
+		m_callTrace->record(s_glGetNamedBufferSubDataTraceInfo, traceArgs);
+	}
 	m_gl.getNamedBufferSubData(buffer, offset, size, data);
 }
 
@@ -2176,6 +3665,11 @@ void CallLogWrapper::glGetNamedBufferSubDataEXT (glw::GLuint buffer, glw::GLintp
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetNamedBufferSubDataEXT(" << buffer << ", " << offset << ", " << size << ", " << data << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(buffer), CallTrace::pack(offset), CallTrace::pack(size), CallTrace::pack(data) };
+		m_callTrace->record(s_glGetNamedBufferSubDataEXTTraceInfo, traceArgs);
+	}
 	m_gl.getNamedBufferSubDataEXT(buffer, offset, size, data);
 }
 
@@ -2183,6 +3677,11 @@ void CallLogWrapper::glGetNamedFramebufferAttachmentParameteriv (glw::GLuint fra
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetNamedFramebufferAttachmentParameteriv(" << framebuffer << ", " << toHex(attachment) << ", " << toHex(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(framebuffer), CallTrace::pack(attachment), CallTrace::pack(pname), CallTrace::pack(params) };
+		m_callTrace->record(s_glGetNamedFramebufferAttachmentParameterivTraceInfo, traceArgs);
+	}
 	m_gl.getNamedFramebufferAttachmentParameteriv(framebuffer, attachment, pname, params);
 }
 
@@ -2190,6 +3689,11 @@ void CallLogWrapper::glGetNamedFramebufferAttachmentParameterivEXT (glw::GLuint
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetNamedFramebufferAttachmentParameterivEXT(" << framebuffer << ", " << toHex(attachment) << ", " << toHex(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(framebuffer), CallTrace::pack(attachment), CallTrace::pack(pname), CallTrace::pack(params) };
+		m_callTrace->record(s_glGetNamedFramebufferAttachmentParameterivEXTTraceInfo, traceArgs);
+	}
 	m_gl.getNamedFramebufferAttachmentParameterivEXT(framebuffer, attachment, pname, params);
 }
 
@@ -2197,6 +3701,11 @@ void CallLogWrapper::glGetNamedFramebufferParameteriv (glw::GLuint framebuffer,
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetNamedFramebufferParameteriv(" << framebuffer << ", " << toHex(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(param))) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(framebuffer), CallTrace::pack(pname), CallTrace::pack(param) };
+		m_callTrace->record(s_glGetNamedFramebufferParameterivTraceInfo, traceArgs);
+	}
 	m_gl.getNamedFramebufferParameteriv(framebuffer, pname, param);
 }
 
@@ -2204,6 +3713,11 @@ void CallLogWrapper::glGetNamedFramebufferParameterivEXT (glw::GLuint framebuffe
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetNamedFramebufferParameterivEXT(" << framebuffer << ", " << toHex(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(framebuffer), CallTrace::pack(pname), CallTrace::pack(params) };
+		m_callTrace->record(s_glGetNamedFramebufferParameterivEXTTraceInfo, traceArgs);
+	}
 	m_gl.getNamedFramebufferParameterivEXT(framebuffer, pname, params);
 }
 
@@ -2211,6 +3725,11 @@ void CallLogWrapper::glGetNamedProgramLocalParameterIivEXT (glw::GLuint program,
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetNamedProgramLocalParameterIivEXT(" << program << ", " << toHex(target) << ", " << index << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(program), CallTrace::pack(target), CallTrace::pack(index), CallTrace::pack(params) };
+		m_callTrace->record(s_glGetNamedProgramLocalParameterIivEXTTraceInfo, traceArgs);
+	}
 	m_gl.getNamedProgramLocalParameterIivEXT(program, target, index, params);
 }
 
@@ -2218,6 +3737,11 @@ void CallLogWrapper::glGetNamedProgramLocalParameterIuivEXT (glw::GLuint program
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetNamedProgramLocalParameterIuivEXT(" << program << ", " << toHex(target) << ", " << index << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(program), CallTrace::pack(target), CallTrace::pack(index), CallTrace::pack(params) };
+		m_callTrace->record(s_glGetNamedProgramLocalParameterIuivEXTTraceInfo, traceArgs);
+	}
 	m_gl.getNamedProgramLocalParameterIuivEXT(program, target, index, params);
 }
 
@@ -2225,6 +3749,11 @@ void CallLogWrapper::glGetNamedProgramLocalParameterdvEXT (glw::GLuint program,
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetNamedProgramLocalParameterdvEXT(" << program << ", " << toHex(target) << ", " << index << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(program), CallTrace::pack(target), CallTrace::pack(index), CallTrace::pack(params) };
+		m_callTrace->record(s_glGetNamedProgramLocalParameterdvEXTTraceInfo, traceArgs);
+	}
 	m_gl.getNamedProgramLocalParameterdvEXT(program, target, index, params);
 }
 
@@ -2232,6 +3761,11 @@ void CallLogWrapper::glGetNamedProgramLocalParameterfvEXT (glw::GLuint program,
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetNamedProgramLocalParameterfvEXT(" << program << ", " << toHex(target) << ", " << index << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(program), CallTrace::pack(target), CallTrace::pack(index), CallTrace::pack(params) };
+		m_callTrace->record(s_glGetNamedProgramLocalParameterfvEXTTraceInfo, traceArgs);
+	}
 	m_gl.getNamedProgramLocalParameterfvEXT(program, target, index, params);
 }
 
@@ -2239,6 +3773,11 @@ void CallLogWrapper::glGetNamedProgramStringEXT (glw::GLuint program, glw::GLenu
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetNamedProgramStringEXT(" << program << ", " << toHex(target) << ", " << toHex(pname) << ", " << string << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(program), CallTrace::pack(target), CallTrace::pack(pname), CallTrace::pack(string) };
+		m_callTrace->record(s_glGetNamedProgramStringEXTTraceInfo, traceArgs);
+	}
 	m_gl.getNamedProgramStringEXT(program, target, pname, string);
 }
 
@@ -2246,6 +3785,11 @@ void CallLogWrapper::glGetNamedProgramivEXT (glw::GLuint program, glw::GLenum ta
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetNamedProgramivEXT(" << program << ", " << toHex(target) << ", " << toHex(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(program), CallTrace::pack(target), CallTrace::pack(pname), CallTrace::pack(params) };
+		m_callTrace->record(s_glGetNamedProgramivEXTTraceInfo, traceArgs);
+	}
 	m_gl.getNamedProgramivEXT(program, target, pname, params);
 }
 
@@ -2253,6 +3797,11 @@ void CallLogWrapper::glGetNamedRenderbufferParameteriv (glw::GLuint renderbuffer
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetNamedRenderbufferParameteriv(" << renderbuffer << ", " << toHex(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(renderbuffer), CallTrace::pack(pname), CallTrace::pack(params) };
+		m_callTrace->record(s_glGetNamedRenderbufferParameterivTraceInfo, traceArgs);
+	}
 	m_gl.getNamedRenderbufferParameteriv(renderbuffer, pname, params);
 }
 
@@ -2260,6 +3809,11 @@ void CallLogWrapper::glGetNamedRenderbufferParameterivEXT (glw::GLuint renderbuf
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetNamedRenderbufferParameterivEXT(" << renderbuffer << ", " << toHex(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(renderbuffer), CallTrace::pack(pname), CallTrace::pack(params) };
+		m_callTrace->record(s_glGetNamedRenderbufferParameterivEXTTraceInfo, traceArgs);
+	}
 	m_gl.getNamedRenderbufferParameterivEXT(renderbuffer, pname, params);
 }
 
@@ -2267,6 +3821,11 @@ void CallLogWrapper::glGetObjectLabel (glw::GLenum identifier, glw::GLuint name,
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetObjectLabel(" << toHex(identifier) << ", " << name << ", " << bufSize << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(length))) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(label))) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(identifier), CallTrace::pack(name), CallTrace::pack(bufSize), CallTrace::pack(length), CallTrace::pack(label) };
+		m_callTrace->record(s_glGetObjectLabelTraceInfo, traceArgs);
+	}
 	m_gl.getObjectLabel(identifier, name, bufSize, length, label);
 }
 
@@ -2274,6 +3833,11 @@ void CallLogWrapper::glGetObjectPtrLabel (const void *ptr, glw::GLsizei bufSize,
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetObjectPtrLabel(" << ptr << ", " << bufSize << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(length))) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(label))) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(ptr), CallTrace::pack(bufSize), CallTrace::pack(length), CallTrace::pack(label) };
+		m_callTrace->record(s_glGetObjectPtrLabelTraceInfo, traceArgs);
+	}
 	m_gl.getObjectPtrLabel(ptr, bufSize, length, label);
 }
 
@@ -2281,6 +3845,11 @@ void CallLogWrapper::glGetPointerIndexedvEXT (glw::GLenum target, glw::GLuint in
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetPointerIndexedvEXT(" << toHex(target) << ", " << index << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(data))) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(target), CallTrace::pack(index), CallTrace::pack(data) };
+		m_callTrace->record(s_glGetPointerIndexedvEXTTraceInfo, traceArgs);
+	}
 	m_gl.getPointerIndexedvEXT(target, index, data);
 }
 
@@ -2288,6 +3857,11 @@ void CallLogWrapper::glGetPointeri_vEXT (glw::GLenum pname, glw::GLuint index, v
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetPointeri_vEXT(" << toHex(pname) << ", " << index << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(pname), CallTrace::pack(index), CallTrace::pack(params) };
+		m_callTrace->record(s_glGetPointeri_vEXTTraceInfo, traceArgs);
+	}
 	m_gl.getPointeri_vEXT(pname, index, params);
 }
 
@@ -2295,6 +3869,11 @@ void CallLogWrapper::glGetPointerv (glw::GLenum pname, void **params)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetPointerv(" << getPointerStateStr(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(pname), CallTrace::pack(params) };
+		m_callTrace->record(s_glGetPointervTraceInfo, traceArgs);
+	}
 	m_gl.getPointerv(pname, params);
 	if (m_enableLog)
 		m_log << TestLog::Message << "// params = " << getPointerStr(params, 1) << TestLog::EndMessage;
@@ -2304,6 +3883,11 @@ void CallLogWrapper::glGetProgramBinary (glw::GLuint program, glw::GLsizei bufSi
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetProgramBinary(" << program << ", " << bufSize << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(length))) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(binaryFormat))) << ", " << binary << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(program), CallTrace::pack(bufSize), CallTrace::pack(length), CallTrace::pack(binaryFormat), CallTrace::pack(binary) };
+		m_callTrace->record(s_glGetProgramBinaryTraceInfo, traceArgs);
+	}
 	m_gl.getProgramBinary(program, bufSize, length, binaryFormat, binary);
 }
 
@@ -2311,6 +3895,11 @@ void CallLogWrapper::glGetProgramInfoLog (glw::GLuint program, glw::GLsizei bufS
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetProgramInfoLog(" << program << ", " << bufSize << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(length))) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(infoLog))) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(program), CallTrace::pack(bufSize), CallTrace::pack(length), CallTrace::pack(infoLog) };
+		m_callTrace->record(s_glGetProgramInfoLogTraceInfo, traceArgs);
+	}
 	m_gl.getProgramInfoLog(program, bufSize, length, infoLog);
 	if (m_enableLog)
 		m_log << TestLog::Message << "// length = " << getPointerStr(length, 1) << TestLog::EndMessage;
@@ -2320,6 +3909,11 @@ void CallLogWrapper::glGetProgramInterfaceiv (glw::GLuint program, glw::GLenum p
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetProgramInterfaceiv(" << program << ", " << toHex(programInterface) << ", " << toHex(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(program), CallTrace::pack(programInterface), CallTrace::pack(pname), CallTrace::pack(params) };
+		m_callTrace->record(s_glGetProgramInterfaceivTraceInfo, traceArgs);
+	}
 	m_gl.getProgramInterfaceiv(program, programInterface, pname, params);
 }
 
@@ -2327,6 +3921,11 @@ void CallLogWrapper::glGetProgramPipelineInfoLog (glw::GLuint pipeline, glw::GLs
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetProgramPipelineInfoLog(" << pipeline << ", " << bufSize << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(length))) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(infoLog))) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(pipeline), CallTrace::pack(bufSize), CallTrace::pack(length), CallTrace::pack(infoLog) };
+		m_callTrace->record(s_glGetProgramPipelineInfoLogTraceInfo, traceArgs);
+	}
 	m_gl.getProgramPipelineInfoLog(pipeline, bufSize, length, infoLog);
 	if (m_enableLog)
 		m_log << TestLog::Message << "// length = " << getPointerStr(length, 1) << TestLog::EndMessage;
@@ -2336,6 +3935,11 @@ void CallLogWrapper::glGetProgramPipelineiv (glw::GLuint pipeline, glw::GLenum p
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetProgramPipelineiv(" << pipeline << ", " << getPipelineParamStr(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(pipeline), CallTrace::pack(pname), CallTrace::pack(params) };
+		m_callTrace->record(s_glGetProgramPipelineivTraceInfo, traceArgs);
+	}
 	m_gl.getProgramPipelineiv(pipeline, pname, params);
 	if (m_enableLog)
 		m_log << TestLog::Message << "// params = " << getPointerStr(params, 1) << TestLog::EndMessage;
@@ -2345,9 +3949,16 @@ glw::GLuint CallLogWrapper::glGetProgramResourceIndex (glw::GLuint program, glw:
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetProgramResourceIndex(" << program << ", " << getProgramInterfaceStr(programInterface) << ", " << getStringStr(name) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(program), CallTrace::pack(programInterface), CallTrace::pack(name) };
+		m_callTrace->record(s_glGetProgramResourceIndexTraceInfo, traceArgs);
+	}
 	glw::GLuint returnValue = m_gl.getProgramResourceIndex(program, programInterface, name);
 	if (m_enableLog)
 		m_log << TestLog::Message << "// " << returnValue << " returned" << TestLog::EndMessage;
+	if (m_callTrace)
+		m_callTrace->setReturnValue(CallTrace::pack(returnValue));
 	return returnValue;
 }
 
@@ -2355,9 +3966,16 @@ glw::GLint CallLogWrapper::glGetProgramResourceLocation (glw::GLuint program, gl
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetProgramResourceLocation(" << program << ", " << toHex(programInterface) << ", " << getStringStr(name) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(program), CallTrace::pack(programInterface), CallTrace::pack(name) };
+		m_callTrace->record(s_glGetProgramResourceLocationTraceInfo, traceArgs);
+	}
 	glw::GLint returnValue = m_gl.getProgramResourceLocation(program, programInterface, name);
 	if (m_enableLog)
 		m_log << TestLog::Message << "// " << returnValue << " returned" << TestLog::EndMessage;
+	if (m_callTrace)
+		m_callTrace->setReturnValue(CallTrace::pack(returnValue));
 	return returnValue;
 }
 
@@ -2365,9 +3983,16 @@ glw::GLint CallLogWrapper::glGetProgramResourceLocationIndex (glw::GLuint progra
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetProgramResourceLocationIndex(" << program << ", " << toHex(programInterface) << ", " << getStringStr(name) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(program), CallTrace::pack(programInterface), CallTrace::pack(name) };
+		m_callTrace->record(s_glGetProgramResourceLocationIndexTraceInfo, traceArgs);
+	}
 	glw::GLint returnValue = m_gl.getProgramResourceLocationIndex(program, programInterface, name);
 	if (m_enableLog)
 		m_log << TestLog::Message << "// " << returnValue << " returned" << TestLog::EndMessage;
+	if (m_callTrace)
+		m_callTrace->setReturnValue(CallTrace::pack(returnValue));
 	return returnValue;
 }
 
@@ -2375,6 +4000,11 @@ void CallLogWrapper::glGetProgramResourceName (glw::GLuint program, glw::GLenum
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetProgramResourceName(" << program << ", " << toHex(programInterface) << ", " << index << ", " << bufSize << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(length))) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(name))) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(program), CallTrace::pack(programInterface), CallTrace::pack(index), CallTrace::pack(bufSize), CallTrace::pack(length), CallTrace::pack(name) };
+		m_callTrace->record(s_glGetProgramResourceNameTraceInfo, traceArgs);
+	}
 	m_gl.getProgramResourceName(program, programInterface, index, bufSize, length, name);
 }
 
@@ -2382,6 +4012,11 @@ void CallLogWrapper::glGetProgramResourceiv (glw::GLuint program, glw::GLenum pr
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetProgramResourceiv(" << program << ", " << getProgramInterfaceStr(programInterface) << ", " << index << ", " << propCount << ", " << getEnumPointerStr(props, propCount, getProgramResourcePropertyName) << ", " << bufSize << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(length))) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(program), CallTrace::pack(programInterface), CallTrace::pack(index), CallTrace::pack(propCount), CallTrace::pack(props), CallTrace::pack(bufSize), CallTrace::pack(length), CallTrace::pack(params) };
+		m_callTrace->record(s_glGetProgramResourceivTraceInfo, traceArgs);
+	}
 	m_gl.getProgramResourceiv(program, programInterface, index, propCount, props, bufSize, length, params);
 	if (m_enableLog)
 	{
@@ -2394,6 +4029,11 @@ void CallLogWrapper::glGetProgramStageiv (glw::GLuint program, glw::GLenum shade
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetProgramStageiv(" << program << ", " << toHex(shadertype) << ", " << toHex(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(values))) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(program), CallTrace::pack(shadertype), CallTrace::pack(pname), CallTrace::pack(values) };
+		m_callTrace->record(s_glGetProgramStageivTraceInfo, traceArgs);
+	}
 	m_gl.getProgramStageiv(program, shadertype, pname, values);
 }
 
@@ -2401,6 +4041,11 @@ void CallLogWrapper::glGetProgramiv (glw::GLuint program, glw::GLenum pname, glw
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetProgramiv(" << program << ", " << getProgramParamStr(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(program), CallTrace::pack(pname), CallTrace::pack(params) };
+		m_callTrace->record(s_glGetProgramivTraceInfo, traceArgs);
+	}
 	m_gl.getProgramiv(program, pname, params);
 	if (m_enableLog)
 		m_log << TestLog::Message << "// params = " << getPointerStr(params, getProgramQueryNumArgsOut(pname)) << TestLog::EndMessage;
@@ -2410,6 +4055,11 @@ void CallLogWrapper::glGetQueryBufferObjecti64v (glw::GLuint id, glw::GLuint buf
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetQueryBufferObjecti64v(" << id << ", " << buffer << ", " << toHex(pname) << ", " << offset << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(id), CallTrace::pack(buffer), CallTrace::pack(pname), CallTrace::pack(offset) };
+		m_callTrace->record(s_glGetQueryBufferObjecti64vTraceInfo, traceArgs);
+	}
 	m_gl.getQueryBufferObjecti64v(id, buffer, pname, offset);
 }
 
@@ -2417,6 +4067,11 @@ void CallLogWrapper::glGetQueryBufferObjectiv (glw::GLuint id, glw::GLuint buffe
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetQueryBufferObjectiv(" << id << ", " << buffer << ", " << toHex(pname) << ", " << offset << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(id), CallTrace::pack(buffer), CallTrace::pack(pname), CallTrace::pack(offset) };
+		m_callTrace->record(s_glGetQueryBufferObjectivTraceInfo, traceArgs);
+	}
 	m_gl.getQueryBufferObjectiv(id, buffer, pname, offset);
 }
 
@@ -2424,6 +4079,11 @@ void CallLogWrapper::glGetQueryBufferObjectui64v (glw::GLuint id, glw::GLuint bu
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetQueryBufferObjectui64v(" << id << ", " << buffer << ", " << toHex(pname) << ", " << offset << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(id), CallTrace::pack(buffer), CallTrace::pack(pname), CallTrace::pack(offset) };
+		m_callTrace->record(s_glGetQueryBufferObjectui64vTraceInfo, traceArgs);
+	}
 	m_gl.getQueryBufferObjectui64v(id, buffer, pname, offset);
 }
 
@@ -2431,6 +4091,11 @@ void CallLogWrapper::glGetQueryBufferObjectuiv (glw::GLuint id, glw::GLuint buff
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetQueryBufferObjectuiv(" << id << ", " << buffer << ", " << toHex(pname) << ", " << offset << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(id), CallTrace::pack(buffer), CallTrace::pack(pname), CallTrace::pack(offset) };
+		m_callTrace->record(s_glGetQueryBufferObjectuivTraceInfo, traceArgs);
+	}
 	m_gl.getQueryBufferObjectuiv(id, buffer, pname, offset);
 }
 
@@ -2438,6 +4103,11 @@ void CallLogWrapper::glGetQueryIndexediv (glw::GLenum target, glw::GLuint index,
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetQueryIndexediv(" << toHex(target) << ", " << index << ", " << toHex(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(target), CallTrace::pack(index), CallTrace::pack(pname), CallTrace::pack(params) };
+		m_callTrace->record(s_glGetQueryIndexedivTraceInfo, traceArgs);
+	}
 	m_gl.getQueryIndexediv(target, index, pname, params);
 }
 
@@ -2445,6 +4115,11 @@ void CallLogWrapper::glGetQueryObjecti64v (glw::GLuint id, glw::GLenum pname, gl
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetQueryObjecti64v(" << id << ", " << getQueryObjectParamStr(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(id), CallTrace::pack(pname), CallTrace::pack(params) };
+		m_callTrace->record(s_glGetQueryObjecti64vTraceInfo, traceArgs);
+	}
 	m_gl.getQueryObjecti64v(id, pname, params);
 	if (m_enableLog)
 		m_log << TestLog::Message << "// params = " << getPointerStr(params, 1) << TestLog::EndMessage;
@@ -2454,6 +4129,11 @@ void CallLogWrapper::glGetQueryObjectiv (glw::GLuint id, glw::GLenum pname, glw:
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetQueryObjectiv(" << id << ", " << getQueryObjectParamStr(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(id), CallTrace::pack(pname), CallTrace::pack(params) };
+		m_callTrace->record(s_glGetQueryObjectivTraceInfo, traceArgs);
+	}
 	m_gl.getQueryObjectiv(id, pname, params);
 	if (m_enableLog)
 		m_log << TestLog::Message << "// params = " << getPointerStr(params, 1) << TestLog::EndMessage;
@@ -2463,6 +4143,11 @@ void CallLogWrapper::glGetQueryObjectui64v (glw::GLuint id, glw::GLenum pname, g
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetQueryObjectui64v(" << id << ", " << getQueryObjectParamStr(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(id), CallTrace::pack(pname), CallTrace::pack(params) };
+		m_callTrace->record(s_glGetQueryObjectui64vTraceInfo, traceArgs);
+	}
 	m_gl.getQueryObjectui64v(id, pname, params);
 	if (m_enableLog)
 		m_log << TestLog::Message << "// params = " << getPointerStr(params, 1) << TestLog::EndMessage;
@@ -2472,6 +4157,11 @@ void CallLogWrapper::glGetQueryObjectuiv (glw::GLuint id, glw::GLenum pname, glw
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetQueryObjectuiv(" << id << ", " << getQueryObjectParamStr(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(id), CallTrace::pack(pname), CallTrace::pack(params) };
+		m_callTrace->record(s_glGetQueryObjectuivTraceInfo, traceArgs);
+	}
 	m_gl.getQueryObjectuiv(id, pname, params);
 	if (m_enableLog)
 		m_log << TestLog::Message << "// params = " << getPointerStr(params, 1) << TestLog::EndMessage;
@@ -2481,6 +4171,11 @@ void CallLogWrapper::glGetQueryiv (glw::GLenum target, glw::GLenum pname, glw::G
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetQueryiv(" << getQueryTargetStr(target) << ", " << getQueryParamStr(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(target), CallTrace::pack(pname), CallTrace::pack(params) };
+		m_callTrace->record(s_glGetQueryivTraceInfo, traceArgs);
+	}
 	m_gl.getQueryiv(target, pname, params);
 	if (m_enableLog)
 		m_log << TestLog::Message << "// params = " << getPointerStr(params, 1) << TestLog::EndMessage;
@@ -2490,6 +4185,11 @@ void CallLogWrapper::glGetRenderbufferParameteriv (glw::GLenum target, glw::GLen
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetRenderbufferParameteriv(" << getFramebufferTargetStr(target) << ", " << getRenderbufferParameterStr(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(target), CallTrace::pack(pname), CallTrace::pack(params) };
+		m_callTrace->record(s_glGetRenderbufferParameterivTraceInfo, traceArgs);
+	}
 	m_gl.getRenderbufferParameteriv(target, pname, params);
 }
 
@@ -2497,6 +4197,11 @@ void CallLogWrapper::glGetSamplerParameterIiv (glw::GLuint sampler, glw::GLenum
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetSamplerParameterIiv(" << sampler << ", " << getTextureParameterStr(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(sampler), CallTrace::pack(pname), CallTrace::pack(params) };
+		m_callTrace->record(s_glGetSamplerParameterIivTraceInfo, traceArgs);
+	}
 	m_gl.getSamplerParameterIiv(sampler, pname, params);
 	if (m_enableLog)
 		m_log << TestLog::Message << "// params = " << getPointerStr(params, getTextureParamQueryNumArgsOut(pname)) << TestLog::EndMessage;
@@ -2506,6 +4211,11 @@ void CallLogWrapper::glGetSamplerParameterIuiv (glw::GLuint sampler, glw::GLenum
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetSamplerParameterIuiv(" << sampler << ", " << getTextureParameterStr(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(sampler), CallTrace::pack(pname), CallTrace::pack(params) };
+		m_callTrace->record(s_glGetSamplerParameterIuivTraceInfo, traceArgs);
+	}
 	m_gl.getSamplerParameterIuiv(sampler, pname, params);
 	if (m_enableLog)
 		m_log << TestLog::Message << "// params = " << getPointerStr(params, getTextureParamQueryNumArgsOut(pname)) << TestLog::EndMessage;
@@ -2515,6 +4225,11 @@ void CallLogWrapper::glGetSamplerParameterfv (glw::GLuint sampler, glw::GLenum p
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetSamplerParameterfv(" << sampler << ", " << getTextureParameterStr(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(sampler), CallTrace::pack(pname), CallTrace::pack(params) };
+		m_callTrace->record(s_glGetSamplerParameterfvTraceInfo, traceArgs);
+	}
 	m_gl.getSamplerParameterfv(sampler, pname, params);
 	if (m_enableLog)
 		m_log << TestLog::Message << "// params = " << getPointerStr(params, getTextureParamQueryNumArgsOut(pname)) << TestLog::EndMessage;
@@ -2524,6 +4239,11 @@ void CallLogWrapper::glGetSamplerParameteriv (glw::GLuint sampler, glw::GLenum p
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetSamplerParameteriv(" << sampler << ", " << getTextureParameterStr(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(sampler), CallTrace::pack(pname), CallTrace::pack(params) };
+		m_callTrace->record(s_glGetSamplerParameterivTraceInfo, traceArgs);
+	}
 	m_gl.getSamplerParameteriv(sampler, pname, params);
 	if (m_enableLog)
 		m_log << TestLog::Message << "// params = " << getPointerStr(params, getTextureParamQueryNumArgsOut(pname)) << TestLog::EndMessage;
@@ -2533,6 +4253,11 @@ void CallLogWrapper::glGetShaderInfoLog (glw::GLuint shader, glw::GLsizei bufSiz
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetShaderInfoLog(" << shader << ", " << bufSize << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(length))) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(infoLog))) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(shader), CallTrace::pack(bufSize), CallTrace::pack(length), CallTrace::pack(infoLog) };
+		m_callTrace->record(s_glGetShaderInfoLogTraceInfo, traceArgs);
+	}
 	m_gl.getShaderInfoLog(shader, bufSize, length, infoLog);
 	if (m_enableLog)
 		m_log << TestLog::Message << "// length = " << getPointerStr(length, 1) << TestLog::EndMessage;
@@ -2542,6 +4267,11 @@ void CallLogWrapper::glGetShaderPrecisionFormat (glw::GLenum shadertype, glw::GL
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetShaderPrecisionFormat(" << getShaderTypeStr(shadertype) << ", " << getPrecisionFormatTypeStr(precisiontype) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(range))) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(precision))) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(shadertype), CallTrace::pack(precisiontype), CallTrace::pack(range), CallTrace::pack(precision) };
+		m_callTrace->record(s_glGetShaderPrecisionFormatTraceInfo, traceArgs);
+	}
 	m_gl.getShaderPrecisionFormat(shadertype, precisiontype, range, precision);
 }
 
@@ -2549,6 +4279,11 @@ void CallLogWrapper::glGetShaderSource (glw::GLuint shader, glw::GLsizei bufSize
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetShaderSource(" << shader << ", " << bufSize << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(length))) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(source))) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(shader), CallTrace::pack(bufSize), CallTrace::pack(length), CallTrace::pack(source) };
+		m_callTrace->record(s_glGetShaderSourceTraceInfo, traceArgs);
+	}
 	m_gl.getShaderSource(shader, bufSize, length, source);
 }
 
@@ -2556,6 +4291,11 @@ void CallLogWrapper::glGetShaderiv (glw::GLuint shader, glw::GLenum pname, glw::
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetShaderiv(" << shader << ", " << getShaderParamStr(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(shader), CallTrace::pack(pname), CallTrace::pack(params) };
+		m_callTrace->record(s_glGetShaderivTraceInfo, traceArgs);
+	}
 	m_gl.getShaderiv(shader, pname, params);
 	if (m_enableLog)
 		m_log << TestLog::Message << "// params = " << getPointerStr(params, 1) << TestLog::EndMessage;
@@ -2565,9 +4305,16 @@ const glw::GLubyte * CallLogWrapper::glGetString (glw::GLenum name)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetString(" << getGettableStringStr(name) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(name) };
+		m_callTrace->record(s_glGetStringTraceInfo, traceArgs);
+	}
 	const glw::GLubyte * returnValue = m_gl.getString(name);
 	if (m_enableLog)
 		m_log << TestLog::Message << "// " << getStringStr(returnValue) << " returned" << TestLog::EndMessage;
+	if (m_callTrace)
+		m_callTrace->setReturnValue(CallTrace::pack(returnValue));
 	return returnValue;
 }
 
@@ -2575,9 +4322,16 @@ const glw::GLubyte * CallLogWrapper::glGetStringi (glw::GLenum name, glw::GLuint
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetStringi(" << getGettableStringStr(name) << ", " << index << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(name), CallTrace::pack(index) };
+		m_callTrace->record(s_glGetStringiTraceInfo, traceArgs);
+	}
 	const glw::GLubyte * returnValue = m_gl.getStringi(name, index);
 	if (m_enableLog)
 		m_log << TestLog::Message << "// " << getStringStr(returnValue) << " returned" << TestLog::EndMessage;
+	if (m_callTrace)
+		m_callTrace->setReturnValue(CallTrace::pack(returnValue));
 	return returnValue;
 }
 
@@ -2585,9 +4339,16 @@ glw::GLuint CallLogWrapper::glGetSubroutineIndex (glw::GLuint program, glw::GLen
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetSubroutineIndex(" << program << ", " << toHex(shadertype) << ", " << getStringStr(name) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(program), CallTrace::pack(shadertype), CallTrace::pack(name) };
+		m_callTrace->record(s_glGetSubroutineIndexTraceInfo, traceArgs);
+	}
 	glw::GLuint returnValue = m_gl.getSubroutineIndex(program, shadertype, name);
 	if (m_enableLog)
 		m_log << TestLog::Message << "// " << returnValue << " returned" << TestLog::EndMessage;
+	if (m_callTrace)
+		m_callTrace->setReturnValue(CallTrace::pack(returnValue));
 	return returnValue;
 }
 
@@ -2595,9 +4356,16 @@ glw::GLint CallLogWrapper::glGetSubroutineUniformLocation (glw::GLuint program,
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetSubroutineUniformLocation(" << program << ", " << toHex(shadertype) << ", " << getStringStr(name) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(program), CallTrace::pack(shadertype), CallTrace::pack(name) };
+		m_callTrace->record(s_glGetSubroutineUniformLocationTraceInfo, traceArgs);
+	}
 	glw::GLint returnValue = m_gl.getSubroutineUniformLocation(program, shadertype, name);
 	if (m_enableLog)
 		m_log << TestLog::Message << "// " << returnValue << " returned" << TestLog::EndMessage;
+	if (m_callTrace)
+		m_callTrace->setReturnValue(CallTrace::pack(returnValue));
 	return returnValue;
 }
 
@@ -2605,6 +4373,11 @@ void CallLogWrapper::glGetSynciv (glw::GLsync sync, glw::GLenum pname, glw::GLsi
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetSynciv(" << sync << ", " << toHex(pname) << ", " << bufSize << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(length))) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(values))) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(sync), CallTrace::pack(pname), CallTrace::pack(bufSize), CallTrace::pack(length), CallTrace::pack(values) };
+		m_callTrace->record(s_glGetSyncivTraceInfo, traceArgs);
+	}
 	m_gl.getSynciv(sync, pname, bufSize, length, values);
 }
 
@@ -2612,6 +4385,11 @@ void CallLogWrapper::glGetTexImage (glw::GLenum target, glw::GLint level, glw::G
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetTexImage(" << toHex(target) << ", " << level << ", " << toHex(format) << ", " << toHex(type) << ", " << pixels << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(target), CallTrace::pack(level), CallTrace::pack(format), CallTrace::pack(type), CallTrace::pack(pixels) };
+		m_callTrace->record(s_glGetTexImageTraceInfo, traceArgs);
+	}
 	m_gl.getTexImage(target, level, format, type, pixels);
 }
 
@@ -2619,6 +4397,11 @@ void CallLogWrapper::glGetTexLevelParameterfv (glw::GLenum target, glw::GLint le
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetTexLevelParameterfv(" << getTextureTargetStr(target) << ", " << level << ", " << getTextureLevelParameterStr(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(target), CallTrace::pack(level), CallTrace::pack(pname), CallTrace::pack(params) };
+		m_callTrace->record(s_glGetTexLevelParameterfvTraceInfo, traceArgs);
+	}
 	m_gl.getTexLevelParameterfv(target, level, pname, params);
 	if (m_enableLog)
 		m_log << TestLog::Message << "// params = " << getPointerStr(params, 1) << TestLog::EndMessage;
@@ -2628,6 +4411,11 @@ void CallLogWrapper::glGetTexLevelParameteriv (glw::GLenum target, glw::GLint le
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetTexLevelParameteriv(" << getTextureTargetStr(target) << ", " << level << ", " << getTextureLevelParameterStr(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(target), CallTrace::pack(level), CallTrace::pack(pname), CallTrace::pack(params) };
+		m_callTrace->record(s_glGetTexLevelParameterivTraceInfo, traceArgs);
+	}
 	m_gl.getTexLevelParameteriv(target, level, pname, params);
 	if (m_enableLog)
 		m_log << TestLog::Message << "// params = " << getPointerStr(params, 1) << TestLog::EndMessage;
@@ -2637,6 +4425,11 @@ void CallLogWrapper::glGetTexParameterIiv (glw::GLenum target, glw::GLenum pname
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetTexParameterIiv(" << getTextureTargetStr(target) << ", " << getTextureParameterStr(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(target), CallTrace::pack(pname), CallTrace::pack(params) };
+		m_callTrace->record(s_glGetTexParameterIivTraceInfo, traceArgs);
+	}
 	m_gl.getTexParameterIiv(target, pname, params);
 	if (m_enableLog)
 		m_log << TestLog::Message << "// params = " << getPointerStr(params, getTextureParamQueryNumArgsOut(pname)) << TestLog::EndMessage;
@@ -2646,6 +4439,11 @@ void CallLogWrapper::glGetTexParameterIuiv (glw::GLenum target, glw::GLenum pnam
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetTexParameterIuiv(" << getTextureTargetStr(target) << ", " << getTextureParameterStr(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(target), CallTrace::pack(pname), CallTrace::pack(params) };
+		m_callTrace->record(s_glGetTexParameterIuivTraceInfo, traceArgs);
+	}
 	m_gl.getTexParameterIuiv(target, pname, params);
 	if (m_enableLog)
 		m_log << TestLog::Message << "// params = " << getPointerStr(params, getTextureParamQueryNumArgsOut(pname)) << TestLog::EndMessage;
@@ -2655,6 +4453,11 @@ void CallLogWrapper::glGetTexParameterfv (glw::GLenum target, glw::GLenum pname,
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetTexParameterfv(" << getTextureTargetStr(target) << ", " << getTextureParameterStr(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(target), CallTrace::pack(pname), CallTrace::pack(params) };
+		m_callTrace->record(s_glGetTexParameterfvTraceInfo, traceArgs);
+	}
 	m_gl.getTexParameterfv(target, pname, params);
 	if (m_enableLog)
 		m_log << TestLog::Message << "// params = " << getPointerStr(params, getTextureParamQueryNumArgsOut(pname)) << TestLog::EndMessage;
@@ -2664,6 +4467,11 @@ void CallLogWrapper::glGetTexParameteriv (glw::GLenum target, glw::GLenum pname,
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetTexParameteriv(" << getTextureTargetStr(target) << ", " << getTextureParameterStr(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(target), CallTrace::pack(pname), CallTrace::pack(params) };
+		m_callTrace->record(s_glGetTexParameterivTraceInfo, traceArgs);
+	}
 	m_gl.getTexParameteriv(target, pname, params);
 	if (m_enableLog)
 		m_log << TestLog::Message << "// params = " << getPointerStr(params, getTextureParamQueryNumArgsOut(pname)) << TestLog::EndMessage;
@@ -2673,6 +4481,11 @@ void CallLogWrapper::glGetTextureImage (glw::GLuint texture, glw::GLint level, g
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetTextureImage(" << texture << ", " << level << ", " << toHex(format) << ", " << toHex(type) << ", " << bufSize << ", " << pixels << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(texture), CallTrace::pack(level), CallTrace::pack(format), CallTrace::pack(type), CallTrace::pack(bufSize), CallTrace::pack(pixels) };
+		m_callTrace->record(s_glGetTextureImageTraceInfo, traceArgs);
+	}
 	m_gl.getTextureImage(texture, level, format, type, bufSize, pixels);
 }
 
@@ -2680,6 +4493,11 @@ void CallLogWrapper::glGetTextureImageEXT (glw::GLuint texture, glw::GLenum targ
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetTextureImageEXT(" << texture << ", " << toHex(target) << ", " << level << ", " << toHex(format) << ", " << toHex(type) << ", " << pixels << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(texture), CallTrace::pack(target), CallTrace::pack(level), CallTrace::pack(format), CallTrace::pack(type), CallTrace::pack(pixels) };
+		m_callTrace->record(s_glGetTextureImageEXTTraceInfo, traceArgs);
+	}
 	m_gl.getTextureImageEXT(texture, target, level, format, type, pixels);
 }
 
@@ -2687,6 +4505,11 @@ void CallLogWrapper::glGetTextureLevelParameterfv (glw::GLuint texture, glw::GLi
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetTextureLevelParameterfv(" << texture << ", " << level << ", " << toHex(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(texture), CallTrace::pack(level), CallTrace::pack(pname), CallTrace::pack(params) };
+		m_callTrace->record(s_glGetTextureLevelParameterfvTraceInfo, traceArgs);
+	}
 	m_gl.getTextureLevelParameterfv(texture, level, pname, params);
 }
 
@@ -2694,6 +4517,11 @@ void CallLogWrapper::glGetTextureLevelParameterfvEXT (glw::GLuint texture, glw::
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetTextureLevelParameterfvEXT(" << texture << ", " << toHex(target) << ", " << level << ", " << toHex(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(texture), CallTrace::pack(target), CallTrace::pack(level), CallTrace::pack(pname), CallTrace::pack(params) };
+		m_callTrace->record(s_glGetTextureLevelParameterfvEXTTraceInfo, traceArgs);
+	}
 	m_gl.getTextureLevelParameterfvEXT(texture, target, level, pname, params);
 }
 
@@ -2701,6 +4529,11 @@ void CallLogWrapper::glGetTextureLevelParameteriv (glw::GLuint texture, glw::GLi
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetTextureLevelParameteriv(" << texture << ", " << level << ", " << toHex(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(texture), CallTrace::pack(level), CallTrace::pack(pname), CallTrace::pack(params) };
+		m_callTrace->record(s_glGetTextureLevelParameterivTraceInfo, traceArgs);
+	}
 	m_gl.getTextureLevelParameteriv(texture, level, pname, params);
 }
 
@@ -2708,6 +4541,11 @@ void CallLogWrapper::glGetTextureLevelParameterivEXT (glw::GLuint texture, glw::
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetTextureLevelParameterivEXT(" << texture << ", " << toHex(target) << ", " << level << ", " << toHex(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(texture), CallTrace::pack(target), CallTrace::pack(level), CallTrace::pack(pname), CallTrace::pack(params) };
+		m_callTrace->record(s_glGetTextureLevelParameterivEXTTraceInfo, traceArgs);
+	}
 	m_gl.getTextureLevelParameterivEXT(texture, target, level, pname, params);
 }
 
@@ -2715,6 +4553,11 @@ void CallLogWrapper::glGetTextureParameterIiv (glw::GLuint texture, glw::GLenum
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetTextureParameterIiv(" << texture << ", " << toHex(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(texture), CallTrace::pack(pname), CallTrace::pack(params) };
+		m_callTrace->record(s_glGetTextureParameterIivTraceInfo, traceArgs);
+	}
 	m_gl.getTextureParameterIiv(texture, pname, params);
 }
 
@@ -2722,6 +4565,11 @@ void CallLogWrapper::glGetTextureParameterIivEXT (glw::GLuint texture, glw::GLen
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetTextureParameterIivEXT(" << texture << ", " << toHex(target) << ", " << toHex(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(texture), CallTrace::pack(target), CallTrace::pack(pname), CallTrace::pack(params) };
+		m_callTrace->record(s_glGetTextureParameterIivEXTTraceInfo, traceArgs);
+	}
 	m_gl.getTextureParameterIivEXT(texture, target, pname, params);
 }
 
@@ -2729,6 +4577,11 @@ void CallLogWrapper::glGetTextureParameterIuiv (glw::GLuint texture, glw::GLenum
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetTextureParameterIuiv(" << texture << ", " << toHex(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(texture), CallTrace::pack(pname), CallTrace::pack(params) };
+		m_callTrace->record(s_glGetTextureParameterIuivTraceInfo, traceArgs);
+	}
 	m_gl.getTextureParameterIuiv(texture, pname, params);
 }
 
@@ -2736,6 +4589,11 @@ void CallLogWrapper::glGetTextureParameterIuivEXT (glw::GLuint texture, glw::GLe
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetTextureParameterIuivEXT(" << texture << ", " << toHex(target) << ", " << toHex(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(texture), CallTrace::pack(target), CallTrace::pack(pname), CallTrace::pack(params) };
+		m_callTrace->record(s_glGetTextureParameterIuivEXTTraceInfo, traceArgs);
+	}
 	m_gl.getTextureParameterIuivEXT(texture, target, pname, params);
 }
 
@@ -2743,6 +4601,11 @@ void CallLogWrapper::glGetTextureParameterfv (glw::GLuint texture, glw::GLenum p
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetTextureParameterfv(" << texture << ", " << toHex(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(texture), CallTrace::pack(pname), CallTrace::pack(params) };
+		m_callTrace->record(s_glGetTextureParameterfvTraceInfo, traceArgs);
+	}
 	m_gl.getTextureParameterfv(texture, pname, params);
 }
 
@@ -2750,6 +4613,11 @@ void CallLogWrapper::glGetTextureParameterfvEXT (glw::GLuint texture, glw::GLenu
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetTextureParameterfvEXT(" << texture << ", " << toHex(target) << ", " << toHex(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(texture), CallTrace::pack(target), CallTrace::pack(pname), CallTrace::pack(params) };
+		m_callTrace->record(s_glGetTextureParameterfvEXTTraceInfo, traceArgs);
+	}
 	m_gl.getTextureParameterfvEXT(texture, target, pname, params);
 }
 
@@ -2757,6 +4625,11 @@ void CallLogWrapper::glGetTextureParameteriv (glw::GLuint texture, glw::GLenum p
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetTextureParameteriv(" << texture << ", " << toHex(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(texture), CallTrace::pack(pname), CallTrace::pack(params) };
+		m_callTrace->record(s_glGetTextureParameterivTraceInfo, traceArgs);
+	}
 	m_gl.getTextureParameteriv(texture, pname, params);
 }
 
@@ -2764,6 +4637,11 @@ void CallLogWrapper::glGetTextureParameterivEXT (glw::GLuint texture, glw::GLenu
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetTextureParameterivEXT(" << texture << ", " << toHex(target) << ", " << toHex(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(texture), CallTrace::pack(target), CallTrace::pack(pname), CallTrace::pack(params) };
+		m_callTrace->record(s_glGetTextureParameterivEXTTraceInfo, traceArgs);
+	}
 	m_gl.getTextureParameterivEXT(texture, target, pname, params);
 }
 
@@ -2771,6 +4649,11 @@ void CallLogWrapper::glGetTextureSubImage (glw::GLuint texture, glw::GLint level
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetTextureSubImage(" << texture << ", " << level << ", " << xoffset << ", " << yoffset << ", " << zoffset << ", " << width << ", " << height << ", " << depth << ", " << toHex(format) << ", " << toHex(type) << ", " << bufSize << ", " << pixels << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(texture), CallTrace::pack(level), CallTrace::pack(xoffset), CallTrace::pack(yoffset), CallTrace::pack(zoffset), CallTrace::pack(width), CallTrace::pack(height), CallTrace::pack(depth), CallTrace::pack(format), CallTrace::pack(type), CallTrace::pack(bufSize), CallTrace::pack(pixels) };
+		m_callTrace->record(s_glGetTextureSubImageTraceInfo, traceArgs);
+	}
 	m_gl.getTextureSubImage(texture, level, xoffset, yoffset, zoffset, width, height, depth, format, type, bufSize, pixels);
 }
 
@@ -2778,6 +4661,11 @@ void CallLogWrapper::glGetTransformFeedbackVarying (glw::GLuint program, glw::GL
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetTransformFeedbackVarying(" << program << ", " << index << ", " << bufSize << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(length))) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(size))) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(type))) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(name))) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(program), CallTrace::pack(index), CallTrace::pack(bufSize), CallTrace::pack(length), CallTrace::pack(size), CallTrace::pack(type), CallTrace::pack(name) };
+		m_callTrace->record(s_glGetTransformFeedbackVaryingTraceInfo, traceArgs);
+	}
 	m_gl.getTransformFeedbackVarying(program, index, bufSize, length, size, type, name);
 }
 
@@ -2785,6 +4673,11 @@ void CallLogWrapper::glGetTransformFeedbacki64_v (glw::GLuint xfb, glw::GLenum p
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetTransformFeedbacki64_v(" << xfb << ", " << toHex(pname) << ", " << index << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(param))) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(xfb), CallTrace::pack(pname), CallTrace::pack(index), CallTrace::pack(param) };
+		m_callTrace->record(s_glGetTransformFeedbacki64_vTraceInfo, traceArgs);
+	}
 	m_gl.getTransformFeedbacki64_v(xfb, pname, index, param);
 }
 
@@ -2792,6 +4685,11 @@ void CallLogWrapper::glGetTransformFeedbacki_v (glw::GLuint xfb, glw::GLenum pna
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetTransformFeedbacki_v(" << xfb << ", " << toHex(pname) << ", " << index << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(param))) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(xfb), CallTrace::pack(pname), CallTrace::pack(index), CallTrace::pack(param) };
+		m_callTrace->record(s_glGetTransformFeedbacki_vTraceInfo, traceArgs);
+	}
 	m_gl.getTransformFeedbacki_v(xfb, pname, index, param);
 }
 
@@ -2799,6 +4697,11 @@ void CallLogWrapper::glGetTransformFeedbackiv (glw::GLuint xfb, glw::GLenum pnam
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetTransformFeedbackiv(" << xfb << ", " << toHex(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(param))) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(xfb), CallTrace::pack(pname), CallTrace::pack(param) };
+		m_callTrace->record(s_glGetTransformFeedbackivTraceInfo, traceArgs);
+	}
 	m_gl.getTransformFeedbackiv(xfb, pname, param);
 }
 
@@ -2806,9 +4709,16 @@ glw::GLuint CallLogWrapper::glGetUniformBlockIndex (glw::GLuint program, const g
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetUniformBlockIndex(" << program << ", " << getStringStr(uniformBlockName) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(program), CallTrace::pack(uniformBlockName) };
+		m_callTrace->record(s_glGetUniformBlockIndexTraceInfo, traceArgs);
+	}
 	glw::GLuint returnValue = m_gl.getUniformBlockIndex(program, uniformBlockName);
 	if (m_enableLog)
 		m_log << TestLog::Message << "// " << returnValue << " returned" << TestLog::EndMessage;
+	if (m_callTrace)
+		m_callTrace->setReturnValue(CallTrace::pack(returnValue));
 	return returnValue;
 }
 
@@ -2816,6 +4726,11 @@ void CallLogWrapper::glGetUniformIndices (glw::GLuint program, glw::GLsizei unif
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetUniformIndices(" << program << ", " << uniformCount << ", " << getPointerStr(uniformNames, uniformCount) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(uniformIndices))) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(program), CallTrace::pack(uniformCount), CallTrace::pack(uniformNames), CallTrace::pack(uniformIndices) };
+		m_callTrace->record(s_glGetUniformIndicesTraceInfo, traceArgs);
+	}
 	m_gl.getUniformIndices(program, uniformCount, uniformNames, uniformIndices);
 	if (m_enableLog)
 		m_log << TestLog::Message << "// uniformIndices = " << getPointerStr(uniformIndices, uniformCount) << TestLog::EndMessage;
@@ -2825,9 +4740,16 @@ glw::GLint CallLogWrapper::glGetUniformLocation (glw::GLuint program, const glw:
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetUniformLocation(" << program << ", " << getStringStr(name) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(program), CallTrace::pack(name) };
+		m_callTrace->record(s_glGetUniformLocationTraceInfo, traceArgs);
+	}
 	glw::GLint returnValue = m_gl.getUniformLocation(program, name);
 	if (m_enableLog)
 		m_log << TestLog::Message << "// " << returnValue << " returned" << TestLog::EndMessage;
+	if (m_callTrace)
+		m_callTrace->setReturnValue(CallTrace::pack(returnValue));
 	return returnValue;
 }
 
@@ -2835,6 +4757,11 @@ void CallLogWrapper::glGetUniformSubroutineuiv (glw::GLenum shadertype, glw::GLi
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetUniformSubroutineuiv(" << toHex(shadertype) << ", " << location << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(shadertype), CallTrace::pack(location), CallTrace::pack(params) };
+		m_callTrace->record(s_glGetUniformSubroutineuivTraceInfo, traceArgs);
+	}
 	m_gl.getUniformSubroutineuiv(shadertype, location, params);
 }
 
@@ -2842,6 +4769,11 @@ void CallLogWrapper::glGetUniformdv (glw::GLuint program, glw::GLint location, g
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetUniformdv(" << program << ", " << location << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(program), CallTrace::pack(location), CallTrace::pack(params) };
+		m_callTrace->record(s_glGetUniformdvTraceInfo, traceArgs);
+	}
 	m_gl.getUniformdv(program, location, params);
 }
 
@@ -2849,6 +4781,11 @@ void CallLogWrapper::glGetUniformfv (glw::GLuint program, glw::GLint location, g
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetUniformfv(" << program << ", " << location << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(program), CallTrace::pack(location), CallTrace::pack(params) };
+		m_callTrace->record(s_glGetUniformfvTraceInfo, traceArgs);
+	}
 	m_gl.getUniformfv(program, location, params);
 }
 
@@ -2856,6 +4793,11 @@ void CallLogWrapper::glGetUniformiv (glw::GLuint program, glw::GLint location, g
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetUniformiv(" << program << ", " << location << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(program), CallTrace::pack(location), CallTrace::pack(params) };
+		m_callTrace->record(s_glGetUniformivTraceInfo, traceArgs);
+	}
 	m_gl.getUniformiv(program, location, params);
 }
 
@@ -2863,6 +4805,11 @@ void CallLogWrapper::glGetUniformuiv (glw::GLuint program, glw::GLint location,
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetUniformuiv(" << program << ", " << location << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(program), CallTrace::pack(location), CallTrace::pack(params) };
+		m_callTrace->record(s_glGetUniformuivTraceInfo, traceArgs);
+	}
 	m_gl.getUniformuiv(program, location, params);
 }
 
@@ -2870,6 +4817,11 @@ void CallLogWrapper::glGetVertexArrayIndexed64iv (glw::GLuint vaobj, glw::GLuint
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetVertexArrayIndexed64iv(" << vaobj << ", " << index << ", " << toHex(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(param))) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(vaobj), CallTrace::pack(index), CallTrace::pack(pname), CallTrace::pack(param) };
+		m_callTrace->record(s_glGetVertexArrayIndexed64ivTraceInfo, traceArgs);
+	}
 	m_gl.getVertexArrayIndexed64iv(vaobj, index, pname, param);
 }
 
@@ -2877,6 +4829,11 @@ void CallLogWrapper::glGetVertexArrayIndexediv (glw::GLuint vaobj, glw::GLuint i
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetVertexArrayIndexediv(" << vaobj << ", " << index << ", " << toHex(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(param))) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(vaobj), CallTrace::pack(index), CallTrace::pack(pname), CallTrace::pack(param) };
+		m_callTrace->record(s_glGetVertexArrayIndexedivTraceInfo, traceArgs);
+	}
 	m_gl.getVertexArrayIndexediv(vaobj, index, pname, param);
 }
 
@@ -2884,6 +4841,11 @@ void CallLogWrapper::glGetVertexArrayIntegeri_vEXT (glw::GLuint vaobj, glw::GLui
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetVertexArrayIntegeri_vEXT(" << vaobj << ", " << index << ", " << toHex(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(param))) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(vaobj), CallTrace::pack(index), CallTrace::pack(pname), CallTrace::pack(param) };
+		m_callTrace->record(s_glGetVertexArrayIntegeri_vEXTTraceInfo, traceArgs);
+	}
 	m_gl.getVertexArrayIntegeri_vEXT(vaobj, index, pname, param);
 }
 
@@ -2891,6 +4853,11 @@ void CallLogWrapper::glGetVertexArrayIntegervEXT (glw::GLuint vaobj, glw::GLenum
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetVertexArrayIntegervEXT(" << vaobj << ", " << toHex(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(param))) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(vaobj), CallTrace::pack(pname), CallTrace::pack(param) };
+		m_callTrace->record(s_glGetVertexArrayIntegervEXTTraceInfo, traceArgs);
+	}
 	m_gl.getVertexArrayIntegervEXT(vaobj, pname, param);
 }
 
@@ -2898,6 +4865,11 @@ void CallLogWrapper::glGetVertexArrayPointeri_vEXT (glw::GLuint vaobj, glw::GLui
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetVertexArrayPointeri_vEXT(" << vaobj << ", " << index << ", " << toHex(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(param))) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(vaobj), CallTrace::pack(index), CallTrace::pack(pname), CallTrace::pack(param) };
+		m_callTrace->record(s_glGetVertexArrayPointeri_vEXTTraceInfo, traceArgs);
+	}
 	m_gl.getVertexArrayPointeri_vEXT(vaobj, index, pname, param);
 }
 
@@ -2905,6 +4877,11 @@ void CallLogWrapper::glGetVertexArrayPointervEXT (glw::GLuint vaobj, glw::GLenum
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetVertexArrayPointervEXT(" << vaobj << ", " << toHex(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(param))) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(vaobj), CallTrace::pack(pname), CallTrace::pack(param) };
+		m_callTrace->record(s_glGetVertexArrayPointervEXTTraceInfo, traceArgs);
+	}
 	m_gl.getVertexArrayPointervEXT(vaobj, pname, param);
 }
 
@@ -2912,6 +4889,11 @@ void CallLogWrapper::glGetVertexArrayiv (glw::GLuint vaobj, glw::GLenum pname, g
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetVertexArrayiv(" << vaobj << ", " << toHex(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(param))) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(vaobj), CallTrace::pack(pname), CallTrace::pack(param) };
+		m_callTrace->record(s_glGetVertexArrayivTraceInfo, traceArgs);
+	}
 	m_gl.getVertexArrayiv(vaobj, pname, param);
 }
 
@@ -2919,6 +4901,11 @@ void CallLogWrapper::glGetVertexAttribIiv (glw::GLuint index, glw::GLenum pname,
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetVertexAttribIiv(" << index << ", " << getVertexAttribParameterNameStr(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(index), CallTrace::pack(pname), CallTrace::pack(params) };
+		m_callTrace->record(s_glGetVertexAttribIivTraceInfo, traceArgs);
+	}
 	m_gl.getVertexAttribIiv(index, pname, params);
 	if (m_enableLog)
 		m_log << TestLog::Message << "// params = " << getPointerStr(params, getAttributeQueryNumArgsOut(pname)) << TestLog::EndMessage;
@@ -2928,6 +4915,11 @@ void CallLogWrapper::glGetVertexAttribIuiv (glw::GLuint index, glw::GLenum pname
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetVertexAttribIuiv(" << index << ", " << getVertexAttribParameterNameStr(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(index), CallTrace::pack(pname), CallTrace::pack(params) };
+		m_callTrace->record(s_glGetVertexAttribIuivTraceInfo, traceArgs);
+	}
 	m_gl.getVertexAttribIuiv(index, pname, params);
 	if (m_enableLog)
 		m_log << TestLog::Message << "// params = " << getPointerStr(params, getAttributeQueryNumArgsOut(pname)) << TestLog::EndMessage;
@@ -2937,6 +4929,11 @@ void CallLogWrapper::glGetVertexAttribLdv (glw::GLuint index, glw::GLenum pname,
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetVertexAttribLdv(" << index << ", " << toHex(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(index), CallTrace::pack(pname), CallTrace::pack(params) };
+		m_callTrace->record(s_glGetVertexAttribLdvTraceInfo, traceArgs);
+	}
 	m_gl.getVertexAttribLdv(index, pname, params);
 }
 
@@ -2944,6 +4941,11 @@ void CallLogWrapper::glGetVertexAttribPointerv (glw::GLuint index, glw::GLenum p
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetVertexAttribPointerv(" << index << ", " << toHex(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(pointer))) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(index), CallTrace::pack(pname), CallTrace::pack(pointer) };
+		m_callTrace->record(s_glGetVertexAttribPointervTraceInfo, traceArgs);
+	}
 	m_gl.getVertexAttribPointerv(index, pname, pointer);
 }
 
@@ -2951,6 +4953,11 @@ void CallLogWrapper::glGetVertexAttribdv (glw::GLuint index, glw::GLenum pname,
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetVertexAttribdv(" << index << ", " << toHex(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(index), CallTrace::pack(pname), CallTrace::pack(params) };
+		m_callTrace->record(s_glGetVertexAttribdvTraceInfo, traceArgs);
+	}
 	m_gl.getVertexAttribdv(index, pname, params);
 }
 
@@ -2958,6 +4965,11 @@ void CallLogWrapper::glGetVertexAttribfv (glw::GLuint index, glw::GLenum pname,
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetVertexAttribfv(" << index << ", " << getVertexAttribParameterNameStr(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(index), CallTrace::pack(pname), CallTrace::pack(params) };
+		m_callTrace->record(s_glGetVertexAttribfvTraceInfo, traceArgs);
+	}
 	m_gl.getVertexAttribfv(index, pname, params);
 	if (m_enableLog)
 		m_log << TestLog::Message << "// params = " << getPointerStr(params, getAttributeQueryNumArgsOut(pname)) << TestLog::EndMessage;
@@ -2967,6 +4979,11 @@ void CallLogWrapper::glGetVertexAttribiv (glw::GLuint index, glw::GLenum pname,
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetVertexAttribiv(" << index << ", " << getVertexAttribParameterNameStr(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(index), CallTrace::pack(pname), CallTrace::pack(params) };
+		m_callTrace->record(s_glGetVertexAttribivTraceInfo, traceArgs);
+	}
 	m_gl.getVertexAttribiv(index, pname, params);
 	if (m_enableLog)
 		m_log << TestLog::Message << "// params = " << getPointerStr(params, getAttributeQueryNumArgsOut(pname)) << TestLog::EndMessage;
@@ -2976,6 +4993,11 @@ void CallLogWrapper::glGetnCompressedTexImage (glw::GLenum target, glw::GLint lo
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetnCompressedTexImage(" << toHex(target) << ", " << lod << ", " << bufSize << ", " << pixels << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(target), CallTrace::pack(lod), CallTrace::pack(bufSize), CallTrace::pack(pixels) };
+		m_callTrace->record(s_glGetnCompressedTexImageTraceInfo, traceArgs);
+	}
 	m_gl.getnCompressedTexImage(target, lod, bufSize, pixels);
 }
 
@@ -2983,6 +5005,11 @@ void CallLogWrapper::glGetnTexImage (glw::GLenum target, glw::GLint level, glw::
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetnTexImage(" << toHex(target) << ", " << level << ", " << toHex(format) << ", " << toHex(type) << ", " << bufSize << ", " << pixels << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(target), CallTrace::pack(level), CallTrace::pack(format), CallTrace::pack(type), CallTrace::pack(bufSize), CallTrace::pack(pixels) };
+		m_callTrace->record(s_glGetnTexImageTraceInfo, traceArgs);
+	}
 	m_gl.getnTexImage(target, level, format, type, bufSize, pixels);
 }
 
@@ -2990,6 +5017,11 @@ void CallLogWrapper::glGetnUniformdv (glw::GLuint program, glw::GLint location,
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetnUniformdv(" << program << ", " << location << ", " << bufSize << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(program), CallTrace::pack(location), CallTrace::pack(bufSize), CallTrace::pack(params) };
+		m_callTrace->record(s_glGetnUniformdvTraceInfo, traceArgs);
+	}
 	m_gl.getnUniformdv(program, location, bufSize, params);
 }
 
@@ -2997,6 +5029,11 @@ void CallLogWrapper::glGetnUniformfv (glw::GLuint program, glw::GLint location,
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetnUniformfv(" << program << ", " << location << ", " << bufSize << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(program), CallTrace::pack(location), CallTrace::pack(bufSize), CallTrace::pack(params) };
+		m_callTrace->record(s_glGetnUniformfvTraceInfo, traceArgs);
+	}
 	m_gl.getnUniformfv(program, location, bufSize, params);
 }
 
@@ -3004,6 +5041,11 @@ void CallLogWrapper::glGetnUniformiv (glw::GLuint program, glw::GLint location,
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetnUniformiv(" << program << ", " << location << ", " << bufSize << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(program), CallTrace::pack(location), CallTrace::pack(bufSize), CallTrace::pack(params) };
+		m_callTrace->record(s_glGetnUniformivTraceInfo, traceArgs);
+	}
 	m_gl.getnUniformiv(program, location, bufSize, params);
 }
 
@@ -3011,6 +5053,11 @@ void CallLogWrapper::glGetnUniformuiv (glw::GLuint program, glw::GLint location,
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetnUniformuiv(" << program << ", " << location << ", " << bufSize << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(program), CallTrace::pack(location), CallTrace::pack(bufSize), CallTrace::pack(params) };
+		m_callTrace->record(s_glGetnUniformuivTraceInfo, traceArgs);
+	}
 	m_gl.getnUniformuiv(program, location, bufSize, params);
 }
 
@@ -3018,6 +5065,11 @@ void CallLogWrapper::glHint (glw::GLenum target, glw::GLenum mode)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glHint(" << getHintStr(target) << ", " << getHintModeStr(mode) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(target), CallTrace::pack(mode) };
+		m_callTrace->record(s_glHintTraceInfo, traceArgs);
+	}
 	m_gl.hint(target, mode);
 }
 
@@ -3025,6 +5077,11 @@ void CallLogWrapper::glInsertEventMarkerEXT (glw::GLsizei length, const glw::GLc
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glInsertEventMarkerEXT(" << length << ", " << getStringStr(marker) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(length), CallTrace::pack(marker) };
+		m_callTrace->record(s_glInsertEventMarkerEXTTraceInfo, traceArgs);
+	}
 	m_gl.insertEventMarkerEXT(length, marker);
 }
 
@@ -3032,6 +5089,11 @@ void CallLogWrapper::glInvalidateBufferData (glw::GLuint buffer)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glInvalidateBufferData(" << buffer << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(buffer) };
+		m_callTrace->record(s_glInvalidateBufferDataTraceInfo, traceArgs);
+	}
 	m_gl.invalidateBufferData(buffer);
 }
 
@@ -3039,6 +5101,11 @@ void CallLogWrapper::glInvalidateBufferSubData (glw::GLuint buffer, glw::GLintpt
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glInvalidateBufferSubData(" << buffer << ", " << offset << ", " << length << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(buffer), CallTrace::pack(offset), CallTrace::pack(length) };
+		m_callTrace->record(s_glInvalidateBufferSubDataTraceInfo, traceArgs);
+	}
 	m_gl.invalidateBufferSubData(buffer, offset, length);
 }
 
@@ -3046,6 +5113,11 @@ void CallLogWrapper::glInvalidateFramebuffer (glw::GLenum target, glw::GLsizei n
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glInvalidateFramebuffer(" << getFramebufferTargetStr(target) << ", " << numAttachments << ", " << getEnumPointerStr(attachments, numAttachments, getInvalidateAttachmentName) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(target), CallTrace::pack(numAttachments), CallTrace::pack(attachments) };
+		m_callTrace->record(s_glInvalidateFramebufferTraceInfo, traceArgs);
+	}
 	m_gl.invalidateFramebuffer(target, numAttachments, attachments);
 }
 
@@ -3053,6 +5125,11 @@ void CallLogWrapper::glInvalidateNamedFramebufferData (glw::GLuint framebuffer,
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glInvalidateNamedFramebufferData(" << framebuffer << ", " << numAttachments << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(attachments))) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(framebuffer), CallTrace::pack(numAttachments), CallTrace::pack(attachments) };
+		m_callTrace->record(s_glInvalidateNamedFramebufferDataTraceInfo, traceArgs);
+	}
 	m_gl.invalidateNamedFramebufferData(framebuffer, numAttachments, attachments);
 }
 
@@ -3060,6 +5137,11 @@ void CallLogWrapper::glInvalidateNamedFramebufferSubData (glw::GLuint framebuffe
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glInvalidateNamedFramebufferSubData(" << framebuffer << ", " << numAttachments << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(attachments))) << ", " << x << ", " << y << ", " << width << ", " << height << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(framebuffer), CallTrace::pack(numAttachments), CallTrace::pack(attachments), CallTrace::pack(x), CallTrace::pack(y), CallTrace::pack(width), CallTrace::pack(height) };
+		m_callTrace->record(s_glInvalidateNamedFramebufferSubDataTraceInfo, traceArgs);
+	}
 	m_gl.invalidateNamedFramebufferSubData(framebuffer, numAttachments, attachments, x, y, width, height);
 }
 
@@ -3067,6 +5149,11 @@ void CallLogWrapper::glInvalidateSubFramebuffer (glw::GLenum target, glw::GLsize
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glInvalidateSubFramebuffer(" << getFramebufferTargetStr(target) << ", " << numAttachments << ", " << getEnumPointerStr(attachments, numAttachments, getInvalidateAttachmentName) << ", " << x << ", " << y << ", " << width << ", " << height << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(target), CallTrace::pack(numAttachments), CallTrace::pack(attachments), CallTrace::pack(x), CallTrace::pack(y), CallTrace::pack(width), CallTrace::pack(height) };
+		m_callTrace->record(s_glInvalidateSubFramebufferTraceInfo, traceArgs);
+	}
 	m_gl.invalidateSubFramebuffer(target, numAttachments, attachments, x, y, width, height);
 }
 
@@ -3074,6 +5161,11 @@ void CallLogWrapper::glInvalidateTexImage (glw::GLuint texture, glw::GLint level
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glInvalidateTexImage(" << texture << ", " << level << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(texture), CallTrace::pack(level) };
+		m_callTrace->record(s_glInvalidateTexImageTraceInfo, traceArgs);
+	}
 	m_gl.invalidateTexImage(texture, level);
 }
 
@@ -3081,6 +5173,11 @@ void CallLogWrapper::glInvalidateTexSubImage (glw::GLuint texture, glw::GLint le
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glInvalidateTexSubImage(" << texture << ", " << level << ", " << xoffset << ", " << yoffset << ", " << zoffset << ", " << width << ", " << height << ", " << depth << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(texture), CallTrace::pack(level), CallTrace::pack(xoffset), CallTrace::pack(yoffset), CallTrace::pack(zoffset), CallTrace::pack(width), CallTrace::pack(height), CallTrace::pack(depth) };
+		m_callTrace->record(s_glInvalidateTexSubImageTraceInfo, traceArgs);
+	}
 	m_gl.invalidateTexSubImage(texture, level, xoffset, yoffset, zoffset, width, height, depth);
 }
 
@@ -3088,9 +5185,16 @@ glw::GLboolean CallLogWrapper::glIsBuffer (glw::GLuint buffer)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glIsBuffer(" << buffer << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(buffer) };
+		m_callTrace->record(s_glIsBufferTraceInfo, traceArgs);
+	}
 	glw::GLboolean returnValue = m_gl.isBuffer(buffer);
 	if (m_enableLog)
 		m_log << TestLog::Message << "// " << getBooleanStr(returnValue) << " returned" << TestLog::EndMessage;
+	if (m_callTrace)
+		m_callTrace->setReturnValue(CallTrace::pack(returnValue));
 	return returnValue;
 }
 
@@ -3098,9 +5202,16 @@ glw::GLboolean CallLogWrapper::glIsEnabled (glw::GLenum cap)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glIsEnabled(" << getEnableCapStr(cap) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(cap) };
+		m_callTrace->record(s_glIsEnabledTraceInfo, traceArgs);
+	}
 	glw::GLboolean returnValue = m_gl.isEnabled(cap);
 	if (m_enableLog)
 		m_log << TestLog::Message << "// " << getBooleanStr(returnValue) << " returned" << TestLog::EndMessage;
+	if (m_callTrace)
+		m_callTrace->setReturnValue(CallTrace::pack(returnValue));
 	return returnValue;
 }
 
@@ -3108,9 +5219,16 @@ glw::GLboolean CallLogWrapper::glIsEnabledi (glw::GLenum target, glw::GLuint ind
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glIsEnabledi(" << getIndexedEnableCapStr(target) << ", " << index << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(target), CallTrace::pack(index) };
+		m_callTrace->record(s_glIsEnablediTraceInfo, traceArgs);
+	}
 	glw::GLboolean returnValue = m_gl.isEnabledi(target, index);
 	if (m_enableLog)
 		m_log << TestLog::Message << "// " << getBooleanStr(returnValue) << " returned" << TestLog::EndMessage;
+	if (m_callTrace)
+		m_callTrace->setReturnValue(CallTrace::pack(returnValue));
 	return returnValue;
 }
 
@@ -3118,9 +5236,16 @@ glw::GLboolean CallLogWrapper::glIsFramebuffer (glw::GLuint framebuffer)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glIsFramebuffer(" << framebuffer << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(framebuffer) };
+		m_callTrace->record(s_glIsFramebufferTraceInfo, traceArgs);
+	}
 	glw::GLboolean returnValue = m_gl.isFramebuffer(framebuffer);
 	if (m_enableLog)
 		m_log << TestLog::Message << "// " << getBooleanStr(returnValue) << " returned" << TestLog::EndMessage;
+	if (m_callTrace)
+		m_callTrace->setReturnValue(CallTrace::pack(returnValue));
 	return returnValue;
 }
 
@@ -3128,9 +5253,16 @@ glw::GLboolean CallLogWrapper::glIsProgram (glw::GLuint program)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glIsProgram(" << program << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(program) };
+		m_callTrace->record(s_glIsProgramTraceInfo, traceArgs);
+	}
 	glw::GLboolean returnValue = m_gl.isProgram(program);
 	if (m_enableLog)
 		m_log << TestLog::Message << "// " << getBooleanStr(returnValue) << " returned" << TestLog::EndMessage;
+	if (m_callTrace)
+		m_callTrace->setReturnValue(CallTrace::pack(returnValue));
 	return returnValue;
 }
 
@@ -3138,9 +5270,16 @@ glw::GLboolean CallLogWrapper::glIsProgramPipeline (glw::GLuint pipeline)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glIsProgramPipeline(" << pipeline << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(pipeline) };
+		m_callTrace->record(s_glIsProgramPipelineTraceInfo, traceArgs);
+	}
 	glw::GLboolean returnValue = m_gl.isProgramPipeline(pipeline);
 	if (m_enableLog)
 		m_log << TestLog::Message << "// " << getBooleanStr(returnValue) << " returned" << TestLog::EndMessage;
+	if (m_callTrace)
+		m_callTrace->setReturnValue(CallTrace::pack(returnValue));
 	return returnValue;
 }
 
@@ -3148,9 +5287,16 @@ glw::GLboolean CallLogWrapper::glIsQuery (glw::GLuint id)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glIsQuery(" << id << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(id) };
+		m_callTrace->record(s_glIsQueryTraceInfo, traceArgs);
+	}
 	glw::GLboolean returnValue = m_gl.isQuery(id);
 	if (m_enableLog)
 		m_log << TestLog::Message << "// " << getBooleanStr(returnValue) << " returned" << TestLog::EndMessage;
+	if (m_callTrace)
+		m_callTrace->setReturnValue(CallTrace::pack(returnValue));
 	return returnValue;
 }
 
@@ -3158,9 +5304,16 @@ glw::GLboolean CallLogWrapper::glIsRenderbuffer (glw::GLuint renderbuffer)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glIsRenderbuffer(" << renderbuffer << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(renderbuffer) };
+		m_callTrace->record(s_glIsRenderbufferTraceInfo, traceArgs);
+	}
 	glw::GLboolean returnValue = m_gl.isRenderbuffer(renderbuffer);
 	if (m_enableLog)
 		m_log << TestLog::Message << "// " << getBooleanStr(returnValue) << " returned" << TestLog::EndMessage;
+	if (m_callTrace)
+		m_callTrace->setReturnValue(CallTrace::pack(returnValue));
 	return returnValue;
 }
 
@@ -3168,9 +5321,16 @@ glw::GLboolean CallLogWrapper::glIsSampler (glw::GLuint sampler)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glIsSampler(" << sampler << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(sampler) };
+		m_callTrace->record(s_glIsSamplerTraceInfo, traceArgs);
+	}
 	glw::GLboolean returnValue = m_gl.isSampler(sampler);
 	if (m_enableLog)
 		m_log << TestLog::Message << "// " << getBooleanStr(returnValue) << " returned" << TestLog::EndMessage;
+	if (m_callTrace)
+		m_callTrace->setReturnValue(CallTrace::pack(returnValue));
 	return returnValue;
 }
 
@@ -3178,9 +5338,16 @@ glw::GLboolean CallLogWrapper::glIsShader (glw::GLuint shader)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glIsShader(" << shader << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(shader) };
+		m_callTrace->record(s_glIsShaderTraceInfo, traceArgs);
+	}
 	glw::GLboolean returnValue = m_gl.isShader(shader);
 	if (m_enableLog)
 		m_log << TestLog::Message << "// " << getBooleanStr(returnValue) << " returned" << TestLog::EndMessage;
+	if (m_callTrace)
+		m_callTrace->setReturnValue(CallTrace::pack(returnValue));
 	return returnValue;
 }
 
@@ -3188,9 +5355,16 @@ glw::GLboolean CallLogWrapper::glIsSync (glw::GLsync sync)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glIsSync(" << sync << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(sync) };
+		m_callTrace->record(s_glIsSyncTraceInfo, traceArgs);
+	}
 	glw::GLboolean returnValue = m_gl.isSync(sync);
 	if (m_enableLog)
 		m_log << TestLog::Message << "// " << getBooleanStr(returnValue) << " returned" << TestLog::EndMessage;
+	if (m_callTrace)
+		m_callTrace->setReturnValue(CallTrace::pack(returnValue));
 	return returnValue;
 }
 
@@ -3198,9 +5372,16 @@ glw::GLboolean CallLogWrapper::glIsTexture (glw::GLuint texture)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glIsTexture(" << texture << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(texture) };
+		m_callTrace->record(s_glIsTextureTraceInfo, traceArgs);
+	}
 	glw::GLboolean returnValue = m_gl.isTexture(texture);
 	if (m_enableLog)
 		m_log << TestLog::Message << "// " << getBooleanStr(returnValue) << " returned" << TestLog::EndMessage;
+	if (m_callTrace)
+		m_callTrace->setReturnValue(CallTrace::pack(returnValue));
 	return returnValue;
 }
 
@@ -3208,9 +5389,16 @@ glw::GLboolean CallLogWrapper::glIsTransformFeedback (glw::GLuint id)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glIsTransformFeedback(" << id << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(id) };
+		m_callTrace->record(s_glIsTransformFeedbackTraceInfo, traceArgs);
+	}
 	glw::GLboolean returnValue = m_gl.isTransformFeedback(id);
 	if (m_enableLog)
 		m_log << TestLog::Message << "// " << getBooleanStr(returnValue) << " returned" << TestLog::EndMessage;
+	if (m_callTrace)
+		m_callTrace->setReturnValue(CallTrace::pack(returnValue));
 	return returnValue;
 }
 
@@ -3218,9 +5406,16 @@ glw::GLboolean CallLogWrapper::glIsVertexArray (glw::GLuint array)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glIsVertexArray(" << array << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(array) };
+		m_callTrace->record(s_glIsVertexArrayTraceInfo, traceArgs);
+	}
 	glw::GLboolean returnValue = m_gl.isVertexArray(array);
 	if (m_enableLog)
 		m_log << TestLog::Message << "// " << getBooleanStr(returnValue) << " returned" << TestLog::EndMessage;
+	if (m_callTrace)
+		m_callTrace->setReturnValue(CallTrace::pack(returnValue));
 	return returnValue;
 }
 
@@ -3228,6 +5423,11 @@ void CallLogWrapper::glLineWidth (glw::GLfloat width)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glLineWidth(" << width << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(width) };
+		m_callTrace->record(s_glLineWidthTraceInfo, traceArgs);
+	}
 	m_gl.lineWidth(width);
 }
 
@@ -3235,6 +5435,11 @@ void CallLogWrapper::glLinkProgram (glw::GLuint program)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glLinkProgram(" << program << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(program) };
+		m_callTrace->record(s_glLinkProgramTraceInfo, traceArgs);
+	}
 	m_gl.linkProgram(program);
 }
 
@@ -3242,6 +5447,11 @@ void CallLogWrapper::glLogicOp (glw::GLenum opcode)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glLogicOp(" << toHex(opcode) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(opcode) };
+		m_callTrace->record(s_glLogicOpTraceInfo, traceArgs);
+	}
 	m_gl.logicOp(opcode);
 }
 
@@ -3249,9 +5459,16 @@ void * CallLogWrapper::glMapBuffer (glw::GLenum target, glw::GLenum access)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glMapBuffer(" << toHex(target) << ", " << toHex(access) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(target), CallTrace::pack(access) };
+		m_callTrace->record(s_glMapBufferTraceInfo, traceArgs);
+	}
 	void * returnValue = m_gl.mapBuffer(target, access);
 	if (m_enableLog)
 		m_log << TestLog::Message << "// " << returnValue << " returned" << TestLog::EndMessage;
+	if (m_callTrace)
+		m_callTrace->setReturnValue(CallTrace::pack(returnValue));
 	return returnValue;
 }
 
@@ -3259,9 +5476,16 @@ void * CallLogWrapper::glMapBufferRange (glw::GLenum target, glw::GLintptr offse
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glMapBufferRange(" << getBufferTargetStr(target) << ", " << offset << ", " << length << ", " << getBufferMapFlagsStr(access) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(target), CallTrace::pack(offset), CallTrace::pack(length), CallTrace::pack(access) };
+		m_callTrace->record(s_glMapBufferRangeTraceInfo, traceArgs);
+	}
 	void * returnValue = m_gl.mapBufferRange(target, offset, length, access);
 	if (m_enableLog)
 		m_log << TestLog::Message << "// " << returnValue << " returned" << TestLog::EndMessage;
+	if (m_callTrace)
+		m_callTrace->setReturnValue(CallTrace::pack(returnValue));
 	return returnValue;
 }
 
@@ -3269,9 +5493,16 @@ void * CallLogWrapper::glMapNamedBuffer (glw::GLuint buffer, glw::GLenum access)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glMapNamedBuffer(" << buffer << ", " << toHex(access) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(buffer), CallTrace::pack(access) };
+		m_callTrace->record(s_glMapNamedBufferTraceInfo, traceArgs);
+	}
 	void * returnValue = m_gl.mapNamedBuffer(buffer, access);
 	if (m_enableLog)
 		m_log << TestLog::Message << "// " << returnValue << " returned" << TestLog::EndMessage;
+	if (m_callTrace)
+		m_callTrace->setReturnValue(CallTrace::pack(returnValue));
 	return returnValue;
 }
 
@@ -3279,9 +5510,16 @@ void * CallLogWrapper::glMapNamedBufferEXT (glw::GLuint buffer, glw::GLenum acce
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glMapNamedBufferEXT(" << buffer << ", " << toHex(access) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(buffer), CallTrace::pack(access) };
+		m_callTrace->record(s_glMapNamedBufferEXTTraceInfo, traceArgs);
+	}
 	void * returnValue = m_gl.mapNamedBufferEXT(buffer, access);
 	if (m_enableLog)
 		m_log << TestLog::Message << "// " << returnValue << " returned" << TestLog::EndMessage;
+	if (m_callTrace)
+		m_callTrace->setReturnValue(CallTrace::pack(returnValue));
 	return returnValue;
 }
 
@@ -3289,9 +5527,16 @@ void * CallLogWrapper::glMapNamedBufferRange (glw::GLuint buffer, glw::GLintptr
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glMapNamedBufferRange(" << buffer << ", " << offset << ", " << length << ", " << toHex(access) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(buffer), CallTrace::pack(offset), CallTrace::pack(length), CallTrace::pack(access) };
+		m_callTrace->record(s_glMapNamedBufferRangeTraceInfo, traceArgs);
+	}
 	void * returnValue = m_gl.mapNamedBufferRange(buffer, offset, length, access);
 	if (m_enableLog)
 		m_log << TestLog::Message << "// " << returnValue << " returned" << TestLog::EndMessage;
+	if (m_callTrace)
+		m_callTrace->setReturnValue(CallTrace::pack(returnValue));
 	return returnValue;
 }
 
@@ -3299,9 +5544,16 @@ void * CallLogWrapper::glMapNamedBufferRangeEXT (glw::GLuint buffer, glw::GLintp
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glMapNamedBufferRangeEXT(" << buffer << ", " << offset << ", " << length << ", " << toHex(access) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(buffer), CallTrace::pack(offset), CallTrace::pack(length), CallTrace::pack(access) };
+		m_callTrace->record(s_glMapNamedBufferRangeEXTTraceInfo, traceArgs);
+	}
 	void * returnValue = m_gl.mapNamedBufferRangeEXT(buffer, offset, length, access);
 	if (m_enableLog)
 		m_log << TestLog::Message << "// " << returnValue << " returned" << TestLog::EndMessage;
+	if (m_callTrace)
+		m_callTrace->setReturnValue(CallTrace::pack(returnValue));
 	return returnValue;
 }
 
@@ -3309,6 +5561,11 @@ void CallLogWrapper::glMatrixFrustumEXT (glw::GLenum mode, glw::GLdouble left, g
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glMatrixFrustumEXT(" << toHex(mode) << ", " << left << ", " << right << ", " << bottom << ", " << top << ", " << zNear << ", " << zFar << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(mode), CallTrace::pack(left), CallTrace::pack(right), CallTrace::pack(bottom), CallTrace::pack(top), CallTrace::pack(zNear), CallTrace::pack(zFar) };
+		m_callTrace->record(s_glMatrixFrustumEXTTraceInfo, traceArgs);
+	}
 	m_gl.matrixFrustumEXT(mode, left, right, bottom, top, zNear, zFar);
 }
 
@@ -3316,6 +5573,11 @@ void CallLogWrapper::glMatrixLoadIdentityEXT (glw::GLenum mode)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glMatrixLoadIdentityEXT(" << toHex(mode) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(mode) };
+		m_callTrace->record(s_glMatrixLoadIdentityEXTTraceInfo, traceArgs);
+	}
 	m_gl.matrixLoadIdentityEXT(mode);
 }
 
@@ -3323,6 +5585,11 @@ void CallLogWrapper::glMatrixLoadTransposedEXT (glw::GLenum mode, const glw::GLd
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glMatrixLoadTransposedEXT(" << toHex(mode) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(m))) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(mode), CallTrace::pack(m) };
+		m_callTrace->record(s_glMatrixLoadTransposedEXTTraceInfo, traceArgs);
+	}
 	m_gl.matrixLoadTransposedEXT(mode, m);
 }
 
@@ -3330,6 +5597,11 @@ void CallLogWrapper::glMatrixLoadTransposefEXT (glw::GLenum mode, const glw::GLf
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glMatrixLoadTransposefEXT(" << toHex(mode) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(m))) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(mode), CallTrace::pack(m) };
+		m_callTrace->record(s_glMatrixLoadTransposefEXTTraceInfo, traceArgs);
+	}
 	m_gl.matrixLoadTransposefEXT(mode, m);
 }
 
@@ -3337,6 +5609,11 @@ void CallLogWrapper::glMatrixLoaddEXT (glw::GLenum mode, const glw::GLdouble *m)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glMatrixLoaddEXT(" << toHex(mode) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(m))) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(mode), CallTrace::pack(m) };
+		m_callTrace->record(s_glMatrixLoaddEXTTraceInfo, traceArgs);
+	}
 	m_gl.matrixLoaddEXT(mode, m);
 }
 
@@ -3344,6 +5621,11 @@ void CallLogWrapper::glMatrixLoadfEXT (glw::GLenum mode, const glw::GLfloat *m)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glMatrixLoadfEXT(" << toHex(mode) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(m))) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(mode), CallTrace::pack(m) };
+		m_callTrace->record(s_glMatrixLoadfEXTTraceInfo, traceArgs);
+	}
 	m_gl.matrixLoadfEXT(mode, m);
 }
 
@@ -3351,6 +5633,11 @@ void CallLogWrapper::glMatrixMultTransposedEXT (glw::GLenum mode, const glw::GLd
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glMatrixMultTransposedEXT(" << toHex(mode) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(m))) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(mode), CallTrace::pack(m) };
+		m_callTrace->record(s_glMatrixMultTransposedEXTTraceInfo, traceArgs);
+	}
 	m_gl.matrixMultTransposedEXT(mode, m);
 }
 
@@ -3358,6 +5645,11 @@ void CallLogWrapper::glMatrixMultTransposefEXT (glw::GLenum mode, const glw::GLf
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glMatrixMultTransposefEXT(" << toHex(mode) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(m))) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(mode), CallTrace::pack(m) };
+		m_callTrace->record(s_glMatrixMultTransposefEXTTraceInfo, traceArgs);
+	}
 	m_gl.matrixMultTransposefEXT(mode, m);
 }
 
@@ -3365,6 +5657,11 @@ void CallLogWrapper::glMatrixMultdEXT (glw::GLenum mode, const glw::GLdouble *m)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glMatrixMultdEXT(" << toHex(mode) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(m))) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(mode), CallTrace::pack(m) };
+		m_callTrace->record(s_glMatrixMultdEXTTraceInfo, traceArgs);
+	}
 	m_gl.matrixMultdEXT(mode, m);
 }
 
@@ -3372,6 +5669,11 @@ void CallLogWrapper::glMatrixMultfEXT (glw::GLenum mode, const glw::GLfloat *m)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glMatrixMultfEXT(" << toHex(mode) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(m))) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(mode), CallTrace::pack(m) };
+		m_callTrace->record(s_glMatrixMultfEXTTraceInfo, traceArgs);
+	}
 	m_gl.matrixMultfEXT(mode, m);
 }
 
@@ -3379,6 +5681,11 @@ void CallLogWrapper::glMatrixOrthoEXT (glw::GLenum mode, glw::GLdouble left, glw
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glMatrixOrthoEXT(" << toHex(mode) << ", " << left << ", " << right << ", " << bottom << ", " << top << ", " << zNear << ", " << zFar << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(mode), CallTrace::pack(left), CallTrace::pack(right), CallTrace::pack(bottom), CallTrace::pack(top), CallTrace::pack(zNear), CallTrace::pack(zFar) };
+		m_callTrace->record(s_glMatrixOrthoEXTTraceInfo, traceArgs);
+	}
 	m_gl.matrixOrthoEXT(mode, left, right, bottom, top, zNear, zFar);
 }
 
@@ -3386,6 +5693,11 @@ void CallLogWrapper::glMatrixPopEXT (glw::GLenum mode)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glMatrixPopEXT(" << toHex(mode) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(mode) };
+		m_callTrace->record(s_glMatrixPopEXTTraceInfo, traceArgs);
+	}
 	m_gl.matrixPopEXT(mode);
 }
 
@@ -3393,6 +5705,11 @@ void CallLogWrapper::glMatrixPushEXT (glw::GLenum mode)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glMatrixPushEXT(" << toHex(mode) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(mode) };
+		m_callTrace->record(s_glMatrixPushEXTTraceInfo, traceArgs);
+	}
 	m_gl.matrixPushEXT(mode);
 }
 
@@ -3400,6 +5717,11 @@ void CallLogWrapper::glMatrixRotatedEXT (glw::GLenum mode, glw::GLdouble angle,
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glMatrixRotatedEXT(" << toHex(mode) << ", " << angle << ", " << x << ", " << y << ", " << z << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(mode), CallTrace::pack(angle), CallTrace::pack(x), CallTrace::pack(y), CallTrace::pack(z) };
+		m_callTrace->record(s_glMatrixRotatedEXTTraceInfo, traceArgs);
+	}
 	m_gl.matrixRotatedEXT(mode, angle, x, y, z);
 }
 
@@ -3407,6 +5729,11 @@ void CallLogWrapper::glMatrixRotatefEXT (glw::GLenum mode, glw::GLfloat angle, g
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glMatrixRotatefEXT(" << toHex(mode) << ", " << angle << ", " << x << ", " << y << ", " << z << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(mode), CallTrace::pack(angle), CallTrace::pack(x), CallTrace::pack(y), CallTrace::pack(z) };
+		m_callTrace->record(s_glMatrixRotatefEXTTraceInfo, traceArgs);
+	}
 	m_gl.matrixRotatefEXT(mode, angle, x, y, z);
 }
 
@@ -3414,6 +5741,11 @@ void CallLogWrapper::glMatrixScaledEXT (glw::GLenum mode, glw::GLdouble x, glw::
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glMatrixScaledEXT(" << toHex(mode) << ", " << x << ", " << y << ", " << z << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(mode), CallTrace::pack(x), CallTrace::pack(y), CallTrace::pack(z) };
+		m_callTrace->record(s_glMatrixScaledEXTTraceInfo, traceArgs);
+	}
 	m_gl.matrixScaledEXT(mode, x, y, z);
 }
 
@@ -3421,6 +5753,11 @@ void CallLogWrapper::glMatrixScalefEXT (glw::GLenum mode, glw::GLfloat x, glw::G
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glMatrixScalefEXT(" << toHex(mode) << ", " << x << ", " << y << ", " << z << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(mode), CallTrace::pack(x), CallTrace::pack(y), CallTrace::pack(z) };
+		m_callTrace->record(s_glMatrixScalefEXTTraceInfo, traceArgs);
+	}
 	m_gl.matrixScalefEXT(mode, x, y, z);
 }
 
@@ -3428,6 +5765,11 @@ void CallLogWrapper::glMatrixTranslatedEXT (glw::GLenum mode, glw::GLdouble x, g
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glMatrixTranslatedEXT(" << toHex(mode) << ", " << x << ", " << y << ", " << z << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(mode), CallTrace::pack(x), CallTrace::pack(y), CallTrace::pack(z) };
+		m_callTrace->record(s_glMatrixTranslatedEXTTraceInfo, traceArgs);
+	}
 	m_gl.matrixTranslatedEXT(mode, x, y, z);
 }
 
@@ -3435,6 +5777,11 @@ void CallLogWrapper::glMatrixTranslatefEXT (glw::GLenum mode, glw::GLfloat x, gl
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glMatrixTranslatefEXT(" << toHex(mode) << ", " << x << ", " << y << ", " << z << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(mode), CallTrace::pack(x), CallTrace::pack(y), CallTrace::pack(z) };
+		m_callTrace->record(s_glMatrixTranslatefEXTTraceInfo, traceArgs);
+	}
 	m_gl.matrixTranslatefEXT(mode, x, y, z);
 }
 
@@ -3442,6 +5789,11 @@ void CallLogWrapper::glMaxShaderCompilerThreadsKHR (glw::GLuint count)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glMaxShaderCompilerThreadsKHR(" << count << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(count) };
+		m_callTrace->record(s_glMaxShaderCompilerThreadsKHRTraceInfo, traceArgs);
+	}
 	m_gl.maxShaderCompilerThreadsKHR(count);
 }
 
@@ -3449,6 +5801,11 @@ void CallLogWrapper::glMemoryBarrier (glw::GLbitfield barriers)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glMemoryBarrier(" << getMemoryBarrierFlagsStr(barriers) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(barriers) };
+		m_callTrace->record(s_glMemoryBarrierTraceInfo, traceArgs);
+	}
 	m_gl.memoryBarrier(barriers);
 }
 
@@ -3456,6 +5813,11 @@ void CallLogWrapper::glMemoryBarrierByRegion (glw::GLbitfield barriers)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glMemoryBarrierByRegion(" << toHex(barriers) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(barriers) };
+		m_callTrace->record(s_glMemoryBarrierByRegionTraceInfo, traceArgs);
+	}
 	m_gl.memoryBarrierByRegion(barriers);
 }
 
@@ -3463,6 +5825,11 @@ void CallLogWrapper::glMinSampleShading (glw::GLfloat value)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glMinSampleShading(" << value << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(value) };
+		m_callTrace->record(s_glMinSampleShadingTraceInfo, traceArgs);
+	}
 	m_gl.minSampleShading(value);
 }
 
@@ -3470,6 +5837,11 @@ void CallLogWrapper::glMultiDrawArrays (glw::GLenum mode, const glw::GLint *firs
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glMultiDrawArrays(" << getPrimitiveTypeStr(mode) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(first))) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(count))) << ", " << drawcount << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(mode), CallTrace::pack(first), CallTrace::pack(count), CallTrace::pack(drawcount) };
+		m_callTrace->record(s_glMultiDrawArraysTraceInfo, traceArgs);
+	}
 	m_gl.multiDrawArrays(mode, first, count, drawcount);
 }
 
@@ -3477,6 +5849,11 @@ void CallLogWrapper::glMultiDrawArraysIndirect (glw::GLenum mode, const void *in
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glMultiDrawArraysIndirect(" << toHex(mode) << ", " << indirect << ", " << drawcount << ", " << stride << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(mode), CallTrace::pack(indirect), CallTrace::pack(drawcount), CallTrace::pack(stride) };
+		m_callTrace->record(s_glMultiDrawArraysIndirectTraceInfo, traceArgs);
+	}
 	m_gl.multiDrawArraysIndirect(mode, indirect, drawcount, stride);
 }
 
@@ -3484,6 +5861,11 @@ void CallLogWrapper::glMultiDrawArraysIndirectCount (glw::GLenum mode, const voi
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glMultiDrawArraysIndirectCount(" << toHex(mode) << ", " << indirect << ", " << drawcount << ", " << maxdrawcount << ", " << stride << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(mode), CallTrace::pack(indirect), CallTrace::pack(drawcount), CallTrace::pack(maxdrawcount), CallTrace::pack(stride) };
+		m_callTrace->record(s_glMultiDrawArraysIndirectCountTraceInfo, traceArgs);
+	}
 	m_gl.multiDrawArraysIndirectCount(mode, indirect, drawcount, maxdrawcount, stride);
 }
 
@@ -3491,6 +5873,11 @@ void CallLogWrapper::glMultiDrawElements (glw::GLenum mode, const glw::GLsizei *
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glMultiDrawElements(" << getPrimitiveTypeStr(mode) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(count))) << ", " << getTypeStr(type) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(indices))) << ", " << drawcount << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(mode), CallTrace::pack(count), CallTrace::pack(type), CallTrace::pack(indices), CallTrace::pack(drawcount) };
+		m_callTrace->record(s_glMultiDrawElementsTraceInfo, traceArgs);
+	}
 	m_gl.multiDrawElements(mode, count, type, indices, drawcount);
 }
 
@@ -3498,6 +5885,11 @@ void CallLogWrapper::glMultiDrawElementsBaseVertex (glw::GLenum mode, const glw:
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glMultiDrawElementsBaseVertex(" << getPrimitiveTypeStr(mode) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(count))) << ", " << getTypeStr(type) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(indices))) << ", " << drawcount << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(basevertex))) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(mode), CallTrace::pack(count), CallTrace::pack(type), CallTrace::pack(indices), CallTrace::pack(drawcount), CallTrace::pack(basevertex) };
+		m_callTrace->record(s_glMultiDrawElementsBaseVertexTraceInfo, traceArgs);
+	}
 	m_gl.multiDrawElementsBaseVertex(mode, count, type, indices, drawcount, basevertex);
 }
 
@@ -3505,6 +5897,11 @@ void CallLogWrapper::glMultiDrawElementsIndirect (glw::GLenum mode, glw::GLenum
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glMultiDrawElementsIndirect(" << toHex(mode) << ", " << toHex(type) << ", " << indirect << ", " << drawcount << ", " << stride << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(mode), CallTrace::pack(type), CallTrace::pack(indirect), CallTrace::pack(drawcount), CallTrace::pack(stride) };
+		m_callTrace->record(s_glMultiDrawElementsIndirectTraceInfo, traceArgs);
+	}
 	m_gl.multiDrawElementsIndirect(mode, type, indirect, drawcount, stride);
 }
 
@@ -3512,6 +5909,11 @@ void CallLogWrapper::glMultiDrawElementsIndirectCount (glw::GLenum mode, glw::GL
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glMultiDrawElementsIndirectCount(" << toHex(mode) << ", " << toHex(type) << ", " << indirect << ", " << drawcount << ", " << maxdrawcount << ", " << stride << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(mode), CallTrace::pack(type), CallTrace::pack(indirect), CallTrace::pack(drawcount), CallTrace::pack(maxdrawcount), CallTrace::pack(stride) };
+		m_callTrace->record(s_glMultiDrawElementsIndirectCountTraceInfo, traceArgs);
+	}
 	m_gl.multiDrawElementsIndirectCount(mode, type, indirect, drawcount, maxdrawcount, stride);
 }
 
@@ -3519,6 +5921,11 @@ void CallLogWrapper::glMultiTexBufferEXT (glw::GLenum texunit, glw::GLenum targe
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glMultiTexBufferEXT(" << toHex(texunit) << ", " << toHex(target) << ", " << toHex(internalformat) << ", " << buffer << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(texunit), CallTrace::pack(target), CallTrace::pack(internalformat), CallTrace::pack(buffer) };
+		m_callTrace->record(s_glMultiTexBufferEXTTraceInfo, traceArgs);
+	}
 	m_gl.multiTexBufferEXT(texunit, target, internalformat, buffer);
 }
 
@@ -3526,6 +5933,11 @@ void CallLogWrapper::glMultiTexCoordPointerEXT (glw::GLenum texunit, glw::GLint
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glMultiTexCoordPointerEXT(" << toHex(texunit) << ", " << size << ", " << toHex(type) << ", " << stride << ", " << pointer << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(texunit), CallTrace::pack(size), CallTrace::pack(type), CallTrace::pack(stride), CallTrace::pack(pointer) };
+		m_callTrace->record(s_glMultiTexCoordPointerEXTTraceInfo, traceArgs);
+	}
 	m_gl.multiTexCoordPointerEXT(texunit, size, type, stride, pointer);
 }
 
@@ -3533,6 +5945,11 @@ void CallLogWrapper::glMultiTexEnvfEXT (glw::GLenum texunit, glw::GLenum target,
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glMultiTexEnvfEXT(" << toHex(texunit) << ", " << toHex(target) << ", " << toHex(pname) << ", " << param << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(texunit), CallTrace::pack(target), CallTrace::pack(pname), CallTrace::pack(param) };
+		m_callTrace->record(s_glMultiTexEnvfEXTTraceInfo, traceArgs);
+	}
 	m_gl.multiTexEnvfEXT(texunit, target, pname, param);
 }
 
@@ -3540,6 +5957,11 @@ void CallLogWrapper::glMultiTexEnvfvEXT (glw::GLenum texunit, glw::GLenum target
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glMultiTexEnvfvEXT(" << toHex(texunit) << ", " << toHex(target) << ", " << toHex(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(texunit), CallTrace::pack(target), CallTrace::pack(pname), CallTrace::pack(params) };
+		m_callTrace->record(s_glMultiTexEnvfvEXTTraceInfo, traceArgs);
+	}
 	m_gl.multiTexEnvfvEXT(texunit, target, pname, params);
 }
 
@@ -3547,6 +5969,11 @@ void CallLogWrapper::glMultiTexEnviEXT (glw::GLenum texunit, glw::GLenum target,
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glMultiTexEnviEXT(" << toHex(texunit) << ", " << toHex(target) << ", " << toHex(pname) << ", " << param << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(texunit), CallTrace::pack(target), CallTrace::pack(pname), CallTrace::pack(param) };
+		m_callTrace->record(s_glMultiTexEnviEXTTraceInfo, traceArgs);
+	}
 	m_gl.multiTexEnviEXT(texunit, target, pname, param);
 }
 
@@ -3554,6 +5981,11 @@ void CallLogWrapper::glMultiTexEnvivEXT (glw::GLenum texunit, glw::GLenum target
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glMultiTexEnvivEXT(" << toHex(texunit) << ", " << toHex(target) << ", " << toHex(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(texunit), CallTrace::pack(target), CallTrace::pack(pname), CallTrace::pack(params) };
+		m_callTrace->record(s_glMultiTexEnvivEXTTraceInfo, traceArgs);
+	}
 	m_gl.multiTexEnvivEXT(texunit, target, pname, params);
 }
 
@@ -3561,6 +5993,11 @@ void CallLogWrapper::glMultiTexGendEXT (glw::GLenum texunit, glw::GLenum coord,
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glMultiTexGendEXT(" << toHex(texunit) << ", " << toHex(coord) << ", " << toHex(pname) << ", " << param << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(texunit), CallTrace::pack(coord), CallTrace::pack(pname), CallTrace::pack(param) };
+		m_callTrace->record(s_glMultiTexGendEXTTraceInfo, traceArgs);
+	}
 	m_gl.multiTexGendEXT(texunit, coord, pname, param);
 }
 
@@ -3568,6 +6005,11 @@ void CallLogWrapper::glMultiTexGendvEXT (glw::GLenum texunit, glw::GLenum coord,
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glMultiTexGendvEXT(" << toHex(texunit) << ", " << toHex(coord) << ", " << toHex(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(texunit), CallTrace::pack(coord), CallTrace::pack(pname), CallTrace::pack(params) };
+		m_callTrace->record(s_glMultiTexGendvEXTTraceInfo, traceArgs);
+	}
 	m_gl.multiTexGendvEXT(texunit, coord, pname, params);
 }
 
@@ -3575,6 +6017,11 @@ void CallLogWrapper::glMultiTexGenfEXT (glw::GLenum texunit, glw::GLenum coord,
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glMultiTexGenfEXT(" << toHex(texunit) << ", " << toHex(coord) << ", " << toHex(pname) << ", " << param << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(texunit), CallTrace::pack(coord), CallTrace::pack(pname), CallTrace::pack(param) };
+		m_callTrace->record(s_glMultiTexGenfEXTTraceInfo, traceArgs);
+	}
 	m_gl.multiTexGenfEXT(texunit, coord, pname, param);
 }
 
@@ -3582,6 +6029,11 @@ void CallLogWrapper::glMultiTexGenfvEXT (glw::GLenum texunit, glw::GLenum coord,
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glMultiTexGenfvEXT(" << toHex(texunit) << ", " << toHex(coord) << ", " << toHex(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(texunit), CallTrace::pack(coord), CallTrace::pack(pname), CallTrace::pack(params) };
+		m_callTrace->record(s_glMultiTexGenfvEXTTraceInfo, traceArgs);
+	}
 	m_gl.multiTexGenfvEXT(texunit, coord, pname, params);
 }
 
@@ -3589,6 +6041,11 @@ void CallLogWrapper::glMultiTexGeniEXT (glw::GLenum texunit, glw::GLenum coord,
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glMultiTexGeniEXT(" << toHex(texunit) << ", " << toHex(coord) << ", " << toHex(pname) << ", " << param << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(texunit), CallTrace::pack(coord), CallTrace::pack(pname), CallTrace::pack(param) };
+		m_callTrace->record(s_glMultiTexGeniEXTTraceInfo, traceArgs);
+	}
 	m_gl.multiTexGeniEXT(texunit, coord, pname, param);
 }
 
@@ -3596,6 +6053,11 @@ void CallLogWrapper::glMultiTexGenivEXT (glw::GLenum texunit, glw::GLenum coord,
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glMultiTexGenivEXT(" << toHex(texunit) << ", " << toHex(coord) << ", " << toHex(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(texunit), CallTrace::pack(coord), CallTrace::pack(pname), CallTrace::pack(params) };
+		m_callTrace->record(s_glMultiTexGenivEXTTraceInfo, traceArgs);
+	}
 	m_gl.multiTexGenivEXT(texunit, coord, pname, params);
 }
 
@@ -3603,6 +6065,11 @@ void CallLogWrapper::glMultiTexImage1DEXT (glw::GLenum texunit, glw::GLenum targ
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glMultiTexImage1DEXT(" << toHex(texunit) << ", " << toHex(target) << ", " << level << ", " << internalformat << ", " << width << ", " << border << ", " << toHex(format) << ", " << toHex(type) << ", " << pixels << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(texunit), CallTrace::pack(target), CallTrace::pack(level), CallTrace::pack(internalformat), CallTrace::pack(width), CallTrace::pack(border), CallTrace::pack(format), CallTrace::pack(type), CallTrace::pack(pixels) };
+		m_callTrace->record(s_glMultiTexImage1DEXTTraceInfo, traceArgs);
+	}
 	m_gl.multiTexImage1DEXT(texunit, target, level, internalformat, width, border, format, type, pixels);
 }
 
@@ -3610,6 +6077,11 @@ void CallLogWrapper::glMultiTexImage2DEXT (glw::GLenum texunit, glw::GLenum targ
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glMultiTexImage2DEXT(" << toHex(texunit) << ", " << toHex(target) << ", " << level << ", " << internalformat << ", " << width << ", " << height << ", " << border << ", " << toHex(format) << ", " << toHex(type) << ", " << pixels << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(texunit), CallTrace::pack(target), CallTrace::pack(level), CallTrace::pack(internalformat), CallTrace::pack(width), CallTrace::pack(height), CallTrace::pack(border), CallTrace::pack(format), CallTrace::pack(type), CallTrace::pack(pixels) };
+		m_callTrace->record(s_glMultiTexImage2DEXTTraceInfo, traceArgs);
+	}
 	m_gl.multiTexImage2DEXT(texunit, target, level, internalformat, width, height, border, format, type, pixels);
 }
 
@@ -3617,6 +6089,11 @@ void CallLogWrapper::glMultiTexImage3DEXT (glw::GLenum texunit, glw::GLenum targ
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glMultiTexImage3DEXT(" << toHex(texunit) << ", " << toHex(target) << ", " << level << ", " << internalformat << ", " << width << ", " << height << ", " << depth << ", " << border << ", " << toHex(format) << ", " << toHex(type) << ", " << pixels << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(texunit), CallTrace::pack(target), CallTrace::pack(level), CallTrace::pack(internalformat), CallTrace::pack(width), CallTrace::pack(height), CallTrace::pack(depth), CallTrace::pack(border), CallTrace::pack(format), CallTrace::pack(type), CallTrace::pack(pixels) };
+		m_callTrace->record(s_glMultiTexImage3DEXTTraceInfo, traceArgs);
+	}
 	m_gl.multiTexImage3DEXT(texunit, target, level, internalformat, width, height, depth, border, format, type, pixels);
 }
 
@@ -3624,6 +6101,11 @@ void CallLogWrapper::glMultiTexParameterIivEXT (glw::GLenum texunit, glw::GLenum
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glMultiTexParameterIivEXT(" << toHex(texunit) << ", " << toHex(target) << ", " << toHex(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(texunit), CallTrace::pack(target), CallTrace::pack(pname), CallTrace::pack(params) };
+		m_callTrace->record(s_glMultiTexParameterIivEXTTraceInfo, traceArgs);
+	}
 	m_gl.multiTexParameterIivEXT(texunit, target, pname, params);
 }
 
@@ -3631,6 +6113,11 @@ void CallLogWrapper::glMultiTexParameterIuivEXT (glw::GLenum texunit, glw::GLenu
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glMultiTexParameterIuivEXT(" << toHex(texunit) << ", " << toHex(target) << ", " << toHex(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(texunit), CallTrace::pack(target), CallTrace::pack(pname), CallTrace::pack(params) };
+		m_callTrace->record(s_glMultiTexParameterIuivEXTTraceInfo, traceArgs);
+	}
 	m_gl.multiTexParameterIuivEXT(texunit, target, pname, params);
 }
 
@@ -3638,6 +6125,11 @@ void CallLogWrapper::glMultiTexParameterfEXT (glw::GLenum texunit, glw::GLenum t
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glMultiTexParameterfEXT(" << toHex(texunit) << ", " << toHex(target) << ", " << toHex(pname) << ", " << param << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(texunit), CallTrace::pack(target), CallTrace::pack(pname), CallTrace::pack(param) };
+		m_callTrace->record(s_glMultiTexParameterfEXTTraceInfo, traceArgs);
+	}
 	m_gl.multiTexParameterfEXT(texunit, target, pname, param);
 }
 
@@ -3645,6 +6137,11 @@ void CallLogWrapper::glMultiTexParameterfvEXT (glw::GLenum texunit, glw::GLenum
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glMultiTexParameterfvEXT(" << toHex(texunit) << ", " << toHex(target) << ", " << toHex(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(texunit), CallTrace::pack(target), CallTrace::pack(pname), CallTrace::pack(params) };
+		m_callTrace->record(s_glMultiTexParameterfvEXTTraceInfo, traceArgs);
+	}
 	m_gl.multiTexParameterfvEXT(texunit, target, pname, params);
 }
 
@@ -3652,6 +6149,11 @@ void CallLogWrapper::glMultiTexParameteriEXT (glw::GLenum texunit, glw::GLenum t
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glMultiTexParameteriEXT(" << toHex(texunit) << ", " << toHex(target) << ", " << toHex(pname) << ", " << param << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(texunit), CallTrace::pack(target), CallTrace::pack(pname), CallTrace::pack(param) };
+		m_callTrace->record(s_glMultiTexParameteriEXTTraceInfo, traceArgs);
+	}
 	m_gl.multiTexParameteriEXT(texunit, target, pname, param);
 }
 
@@ -3659,6 +6161,11 @@ void CallLogWrapper::glMultiTexParameterivEXT (glw::GLenum texunit, glw::GLenum
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glMultiTexParameterivEXT(" << toHex(texunit) << ", " << toHex(target) << ", " << toHex(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(texunit), CallTrace::pack(target), CallTrace::pack(pname), CallTrace::pack(params) };
+		m_callTrace->record(s_glMultiTexParameterivEXTTraceInfo, traceArgs);
+	}
 	m_gl.multiTexParameterivEXT(texunit, target, pname, params);
 }
 
@@ -3666,6 +6173,11 @@ void CallLogWrapper::glMultiTexRenderbufferEXT (glw::GLenum texunit, glw::GLenum
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glMultiTexRenderbufferEXT(" << toHex(texunit) << ", " << toHex(target) << ", " << renderbuffer << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(texunit), CallTrace::pack(target), CallTrace::pack(renderbuffer) };
+		m_callTrace->record(s_glMultiTexRenderbufferEXTTraceInfo, traceArgs);
+	}
 	m_gl.multiTexRenderbufferEXT(texunit, target, renderbuffer);
 }
 
@@ -3673,6 +6185,11 @@ void CallLogWrapper::glMultiTexSubImage1DEXT (glw::GLenum texunit, glw::GLenum t
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glMultiTexSubImage1DEXT(" << toHex(texunit) << ", " << toHex(target) << ", " << level << ", " << xoffset << ", " << width << ", " << toHex(format) << ", " << toHex(type) << ", " << pixels << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(texunit), CallTrace::pack(target), CallTrace::pack(level), CallTrace::pack(xoffset), CallTrace::pack(width), CallTrace::pack(format), CallTrace::pack(type), CallTrace::pack(pixels) };
+		m_callTrace->record(s_glMultiTexSubImage1DEXTTraceInfo, traceArgs);
+	}
 	m_gl.multiTexSubImage1DEXT(texunit, target, level, xoffset, width, format, type, pixels);
 }
 
@@ -3680,6 +6197,11 @@ void CallLogWrapper::glMultiTexSubImage2DEXT (glw::GLenum texunit, glw::GLenum t
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glMultiTexSubImage2DEXT(" << toHex(texunit) << ", " << toHex(target) << ", " << level << ", " << xoffset << ", " << yoffset << ", " << width << ", " << height << ", " << toHex(format) << ", " << toHex(type) << ", " << pixels << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(texunit), CallTrace::pack(target), CallTrace::pack(level), CallTrace::pack(xoffset), CallTrace::pack(yoffset), CallTrace::pack(width), CallTrace::pack(height), CallTrace::pack(format), CallTrace::pack(type), CallTrace::pack(pixels) };
+		m_callTrace->record(s_glMultiTexSubImage2DEXTTraceInfo, traceArgs);
+	}
 	m_gl.multiTexSubImage2DEXT(texunit, target, level, xoffset, yoffset, width, height, format, type, pixels);
 }
 
@@ -3687,6 +6209,11 @@ void CallLogWrapper::glMultiTexSubImage3DEXT (glw::GLenum texunit, glw::GLenum t
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glMultiTexSubImage3DEXT(" << toHex(texunit) << ", " << toHex(target) << ", " << level << ", " << xoffset << ", " << yoffset << ", " << zoffset << ", " << width << ", " << height << ", " << depth << ", " << toHex(format) << ", " << toHex(type) << ", " << pixels << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(texunit), CallTrace::pack(target), CallTrace::pack(level), CallTrace::pack(xoffset), CallTrace::pack(yoffset), CallTrace::pack(zoffset), CallTrace::pack(width), CallTrace::pack(height), CallTrace::pack(depth), CallTrace::pack(format), CallTrace::pack(type), CallTrace::pack(pixels) };
+		m_callTrace->record(s_glMultiTexSubImage3DEXTTraceInfo, traceArgs);
+	}
 	m_gl.multiTexSubImage3DEXT(texunit, target, level, xoffset, yoffset, zoffset, width, height, depth, format, type, pixels);
 }
 
@@ -3694,6 +6221,8 @@ void CallLogWrapper::glMulticastBarrierNV (void)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glMulticastBarrierNV(" << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+		m_callTrace->record(s_glMulticastBarrierNVTraceInfo, DE_NULL);
 	m_gl.multicastBarrierNV();
 }
 
@@ -3701,6 +6230,11 @@ void CallLogWrapper::glMulticastBlitFramebufferNV (glw::GLuint srcGpu, glw::GLui
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glMulticastBlitFramebufferNV(" << srcGpu << ", " << dstGpu << ", " << srcX0 << ", " << srcY0 << ", " << srcX1 << ", " << srcY1 << ", " << dstX0 << ", " << dstY0 << ", " << dstX1 << ", " << dstY1 << ", " << toHex(mask) << ", " << toHex(filter) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(srcGpu), CallTrace::pack(dstGpu), CallTrace::pack(srcX0), CallTrace::pack(srcY0), CallTrace::pack(srcX1), CallTrace::pack(srcY1), CallTrace::pack(dstX0), CallTrace::pack(dstY0), CallTrace::pack(dstX1), CallTrace::pack(dstY1), CallTrace::pack(mask), CallTrace::pack(filter) };
+		m_callTrace->record(s_glMulticastBlitFramebufferNVTraceInfo, traceArgs);
+	}
 	m_gl.multicastBlitFramebufferNV(srcGpu, dstGpu, srcX0, srcY0, srcX1, srcY1, dstX0, dstY0, dstX1, dstY1, mask, filter);
 }
 
@@ -3708,6 +6242,11 @@ void CallLogWrapper::glMulticastBufferSubDataNV (glw::GLbitfield gpuMask, glw::G
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glMulticastBufferSubDataNV(" << toHex(gpuMask) << ", " << buffer << ", " << offset << ", " << size << ", " << data << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(gpuMask), CallTrace::pack(buffer), CallTrace::pack(offset), CallTrace::pack(size), CallTrace::pack(data) };
+		m_callTrace->record(s_glMulticastBufferSubDataNVTraceInfo, traceArgs);
+	}
 	m_gl.multicastBufferSubDataNV(gpuMask, buffer, offset, size, data);
 }
 
@@ -3715,6 +6254,11 @@ void CallLogWrapper::glMulticastCopyBufferSubDataNV (glw::GLuint readGpu, glw::G
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glMulticastCopyBufferSubDataNV(" << readGpu << ", " << toHex(writeGpuMask) << ", " << readBuffer << ", " << writeBuffer << ", " << readOffset << ", " << writeOffset << ", " << size << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(readGpu), CallTrace::pack(writeGpuMask), CallTrace::pack(readBuffer), CallTrace::pack(writeBuffer), CallTrace::pack(readOffset), CallTrace::pack(writeOffset), CallTrace::pack(size) };
+		m_callTrace->record(s_glMulticastCopyBufferSubDataNVTraceInfo, traceArgs);
+	}
 	m_gl.multicastCopyBufferSubDataNV(readGpu, writeGpuMask, readBuffer, writeBuffer, readOffset, writeOffset, size);
 }
 
@@ -3722,6 +6266,11 @@ void CallLogWrapper::glMulticastCopyImageSubDataNV (glw::GLuint srcGpu, glw::GLb
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glMulticastCopyImageSubDataNV(" << srcGpu << ", " << toHex(dstGpuMask) << ", " << srcName << ", " << toHex(srcTarget) << ", " << srcLevel << ", " << srcX << ", " << srcY << ", " << srcZ << ", " << dstName << ", " << toHex(dstTarget) << ", " << dstLevel << ", " << dstX << ", " << dstY << ", " << dstZ << ", " << srcWidth << ", " << srcHeight << ", " << srcDepth << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(srcGpu), CallTrace::pack(dstGpuMask), CallTrace::pack(srcName), CallTrace::pack(srcTarget), CallTrace::pack(srcLevel), CallTrace::pack(srcX), CallTrace::pack(srcY), CallTrace::pack(srcZ), CallTrace::pack(dstName), CallTrace::pack(dstTarget), CallTrace::pack(dstLevel), CallTrace::pack(dstX), CallTrace::pack(dstY), CallTrace::pack(dstZ), CallTrace::pack(srcWidth), CallTrace::pack(srcHeight), CallTrace::pack(srcDepth) };
+		m_callTrace->record(s_glMulticastCopyImageSubDataNVTraceInfo, traceArgs);
+	}
 	m_gl.multicastCopyImageSubDataNV(srcGpu, dstGpuMask, srcName, srcTarget, srcLevel, srcX, srcY, srcZ, dstName, dstTarget, dstLevel, dstX, dstY, dstZ, srcWidth, srcHeight, srcDepth);
 }
 
@@ -3729,6 +6278,11 @@ void CallLogWrapper::glMulticastFramebufferSampleLocationsfvNV (glw::GLuint gpu,
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glMulticastFramebufferSampleLocationsfvNV(" << gpu << ", " << framebuffer << ", " << start << ", " << count << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(v))) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(gpu), CallTrace::pack(framebuffer), CallTrace::pack(start), CallTrace::pack(count), CallTrace::pack(v) };
+		m_callTrace->record(s_glMulticastFramebufferSampleLocationsfvNVTraceInfo, traceArgs);
+	}
 	m_gl.multicastFramebufferSampleLocationsfvNV(gpu, framebuffer, start, count, v);
 }
 
@@ -3736,6 +6290,11 @@ void CallLogWrapper::glMulticastGetQueryObjecti64vNV (glw::GLuint gpu, glw::GLui
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glMulticastGetQueryObjecti64vNV(" << gpu << ", " << id << ", " << toHex(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(gpu), CallTrace::pack(id), CallTrace::pack(pname), CallTrace::pack(params) };
+		m_callTrace->record(s_glMulticastGetQueryObjecti64vNVTraceInfo, traceArgs);
+	}
 	m_gl.multicastGetQueryObjecti64vNV(gpu, id, pname, params);
 }
 
@@ -3743,6 +6302,11 @@ void CallLogWrapper::glMulticastGetQueryObjectivNV (glw::GLuint gpu, glw::GLuint
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glMulticastGetQueryObjectivNV(" << gpu << ", " << id << ", " << toHex(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(gpu), CallTrace::pack(id), CallTrace::pack(pname), CallTrace::pack(params) };
+		m_callTrace->record(s_glMulticastGetQueryObjectivNVTraceInfo, traceArgs);
+	}
 	m_gl.multicastGetQueryObjectivNV(gpu, id, pname, params);
 }
 
@@ -3750,6 +6314,11 @@ void CallLogWrapper::glMulticastGetQueryObjectui64vNV (glw::GLuint gpu, glw::GLu
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glMulticastGetQueryObjectui64vNV(" << gpu << ", " << id << ", " << toHex(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(gpu), CallTrace::pack(id), CallTrace::pack(pname), CallTrace::pack(params) };
+		m_callTrace->record(s_glMulticastGetQueryObjectui64vNVTraceInfo, traceArgs);
+	}
 	m_gl.multicastGetQueryObjectui64vNV(gpu, id, pname, params);
 }
 
@@ -3757,6 +6326,11 @@ void CallLogWrapper::glMulticastGetQueryObjectuivNV (glw::GLuint gpu, glw::GLuin
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glMulticastGetQueryObjectuivNV(" << gpu << ", " << id << ", " << toHex(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(gpu), CallTrace::pack(id), CallTrace::pack(pname), CallTrace::pack(params) };
+		m_callTrace->record(s_glMulticastGetQueryObjectuivNVTraceInfo, traceArgs);
+	}
 	m_gl.multicastGetQueryObjectuivNV(gpu, id, pname, params);
 }
 
@@ -3764,6 +6338,11 @@ void CallLogWrapper::glMulticastWaitSyncNV (glw::GLuint signalGpu, glw::GLbitfie
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glMulticastWaitSyncNV(" << signalGpu << ", " << toHex(waitGpuMask) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(signalGpu), CallTrace::pack(waitGpuMask) };
+		m_callTrace->record(s_glMulticastWaitSyncNVTraceInfo, traceArgs);
+	}
 	m_gl.multicastWaitSyncNV(signalGpu, waitGpuMask);
 }
 
@@ -3771,6 +6350,11 @@ void CallLogWrapper::glNamedBufferData (glw::GLuint buffer, glw::GLsizeiptr size
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glNamedBufferData(" << buffer << ", " << size << ", " << data << ", " << toHex(usage) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(buffer), CallTrace::pack(size), CallTrace::pack(data), CallTrace::pack(usage) };
+		m_callTrace->record(s_glNamedBufferDataTraceInfo, traceArgs);
+	}
 	m_gl.namedBufferData(buffer, size, data, usage);
 }
 
@@ -3778,6 +6362,11 @@ void CallLogWrapper::glNamedBufferDataEXT (glw::GLuint buffer, glw::GLsizeiptr s
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glNamedBufferDataEXT(" << buffer << ", " << size << ", " << data << ", " << toHex(usage) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(buffer), CallTrace::pack(size), CallTrace::pack(data), CallTrace::pack(usage) };
+		m_callTrace->record(s_glNamedBufferDataEXTTraceInfo, traceArgs);
+	}
 	m_gl.namedBufferDataEXT(buffer, size, data, usage);
 }
 
@@ -3785,6 +6374,11 @@ void CallLogWrapper::glNamedBufferPageCommitmentARB (glw::GLuint buffer, glw::GL
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glNamedBufferPageCommitmentARB(" << buffer << ", " << offset << ", " << size << ", " << getBooleanStr(commit) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(buffer), CallTrace::pack(offset), CallTrace::pack(size), CallTrace::pack(commit) };
+		m_callTrace->record(s_glNamedBufferPageCommitmentARBTraceInfo, traceArgs);
+	}
 	m_gl.namedBufferPageCommitmentARB(buffer, offset, size, commit);
 }
 
@@ -3792,6 +6386,11 @@ void CallLogWrapper::glNamedBufferPageCommitmentEXT (glw::GLuint buffer, glw::GL
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glNamedBufferPageCommitmentEXT(" << buffer << ", " << offset << ", " << size << ", " << getBooleanStr(commit) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(buffer), CallTrace::pack(offset), CallTrace::pack(size), CallTrace::pack(commit) };
+		m_callTrace->record(s_glNamedBufferPageCommitmentEXTTraceInfo, traceArgs);
+	}
 	m_gl.namedBufferPageCommitmentEXT(buffer, offset, size, commit);
 }
 
@@ -3799,6 +6398,11 @@ void CallLogWrapper::glNamedBufferStorage (glw::GLuint buffer, glw::GLsizeiptr s
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glNamedBufferStorage(" << buffer << ", " << size << ", " << data << ", " << toHex(flags) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(buffer), CallTrace::pack(size), CallTrace::pack(data), CallTrace::pack(flags) };
+		m_callTrace->record(s_glNamedBufferStorageTraceInfo, traceArgs);
+	}
 	m_gl.namedBufferStorage(buffer, size, data, flags);
 }
 
@@ -3806,6 +6410,11 @@ void CallLogWrapper::glNamedBufferSubData (glw::GLuint buffer, glw::GLintptr off
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glNamedBufferSubData(" << buffer << ", " << offset << ", " << size << ", " << data << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(buffer), CallTrace::pack(offset), CallTrace::pack(size), CallTrace::pack(data) };
+		m_callTrace->record(s_glNamedBufferSubDataTraceInfo, traceArgs);
+	}
 	m_gl.namedBufferSubData(buffer, offset, size, data);
 }
 
@@ -3813,6 +6422,11 @@ void CallLogWrapper::glNamedCopyBufferSubDataEXT (glw::GLuint readBuffer, glw::G
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glNamedCopyBufferSubDataEXT(" << readBuffer << ", " << writeBuffer << ", " << readOffset << ", " << writeOffset << ", " << size << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(readBuffer), CallTrace::pack(writeBuffer), CallTrace::pack(readOffset), CallTrace::pack(writeOffset), CallTrace::pack(size) };
+		m_callTrace->record(s_glNamedCopyBufferSubDataEXTTraceInfo, traceArgs);
+	}
 	m_gl.namedCopyBufferSubDataEXT(readBuffer, writeBuffer, readOffset, writeOffset, size);
 }
 
@@ -3820,6 +6434,11 @@ void CallLogWrapper::glNamedFramebufferDrawBuffer (glw::GLuint framebuffer, glw:
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glNamedFramebufferDrawBuffer(" << framebuffer << ", " << toHex(buf) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(framebuffer), CallTrace::pack(buf) };
+		m_callTrace->record(s_glNamedFramebufferDrawBufferTraceInfo, traceArgs);
+	}
 	m_gl.namedFramebufferDrawBuffer(framebuffer, buf);
 }
 
@@ -3827,6 +6446,11 @@ void CallLogWrapper::glNamedFramebufferDrawBuffers (glw::GLuint framebuffer, glw
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glNamedFramebufferDrawBuffers(" << framebuffer << ", " << n << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(bufs))) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(framebuffer), CallTrace::pack(n), CallTrace::pack(bufs) };
+		m_callTrace->record(s_glNamedFramebufferDrawBuffersTraceInfo, traceArgs);
+	}
 	m_gl.namedFramebufferDrawBuffers(framebuffer, n, bufs);
 }
 
@@ -3834,6 +6458,11 @@ void CallLogWrapper::glNamedFramebufferParameteri (glw::GLuint framebuffer, glw:
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glNamedFramebufferParameteri(" << framebuffer << ", " << toHex(pname) << ", " << param << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(framebuffer), CallTrace::pack(pname), CallTrace::pack(param) };
+		m_callTrace->record(s_glNamedFramebufferParameteriTraceInfo, traceArgs);
+	}
 	m_gl.namedFramebufferParameteri(framebuffer, pname, param);
 }
 
@@ -3841,6 +6470,11 @@ void CallLogWrapper::glNamedFramebufferParameteriEXT (glw::GLuint framebuffer, g
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glNamedFramebufferParameteriEXT(" << framebuffer << ", " << toHex(pname) << ", " << param << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(framebuffer), CallTrace::pack(pname), CallTrace::pack(param) };
+		m_callTrace->record(s_glNamedFramebufferParameteriEXTTraceInfo, traceArgs);
+	}
 	m_gl.namedFramebufferParameteriEXT(framebuffer, pname, param);
 }
 
@@ -3848,6 +6482,11 @@ void CallLogWrapper::glNamedFramebufferReadBuffer (glw::GLuint framebuffer, glw:
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glNamedFramebufferReadBuffer(" << framebuffer << ", " << toHex(src) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(framebuffer), CallTrace::pack(src) };
+		m_callTrace->record(s_glNamedFramebufferReadBufferTraceInfo, traceArgs);
+	}
 	m_gl.namedFramebufferReadBuffer(framebuffer, src);
 }
 
@@ -3855,6 +6494,11 @@ void CallLogWrapper::glNamedFramebufferRenderbuffer (glw::GLuint framebuffer, gl
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glNamedFramebufferRenderbuffer(" << framebuffer << ", " << toHex(attachment) << ", " << toHex(renderbuffertarget) << ", " << renderbuffer << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(framebuffer), CallTrace::pack(attachment), CallTrace::pack(renderbuffertarget), CallTrace::pack(renderbuffer) };
+		m_callTrace->record(s_glNamedFramebufferRenderbufferTraceInfo, traceArgs);
+	}
 	m_gl.namedFramebufferRenderbuffer(framebuffer, attachment, renderbuffertarget, renderbuffer);
 }
 
@@ -3862,6 +6506,11 @@ void CallLogWrapper::glNamedFramebufferRenderbufferEXT (glw::GLuint framebuffer,
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glNamedFramebufferRenderbufferEXT(" << framebuffer << ", " << toHex(attachment) << ", " << toHex(renderbuffertarget) << ", " << renderbuffer << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(framebuffer), CallTrace::pack(attachment), CallTrace::pack(renderbuffertarget), CallTrace::pack(renderbuffer) };
+		m_callTrace->record(s_glNamedFramebufferRenderbufferEXTTraceInfo, traceArgs);
+	}
 	m_gl.namedFramebufferRenderbufferEXT(framebuffer, attachment, renderbuffertarget, renderbuffer);
 }
 
@@ -3869,6 +6518,11 @@ void CallLogWrapper::glNamedFramebufferTexture (glw::GLuint framebuffer, glw::GL
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glNamedFramebufferTexture(" << framebuffer << ", " << toHex(attachment) << ", " << texture << ", " << level << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(framebuffer), CallTrace::pack(attachment), CallTrace::pack(texture), CallTrace::pack(level) };
+		m_callTrace->record(s_glNamedFramebufferTextureTraceInfo, traceArgs);
+	}
 	m_gl.namedFramebufferTexture(framebuffer, attachment, texture, level);
 }
 
@@ -3876,6 +6530,11 @@ void CallLogWrapper::glNamedFramebufferTexture1DEXT (glw::GLuint framebuffer, gl
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glNamedFramebufferTexture1DEXT(" << framebuffer << ", " << toHex(attachment) << ", " << toHex(textarget) << ", " << texture << ", " << level << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(framebuffer), CallTrace::pack(attachment), CallTrace::pack(textarget), CallTrace::pack(texture), CallTrace::pack(level) };
+		m_callTrace->record(s_glNamedFramebufferTexture1DEXTTraceInfo, traceArgs);
+	}
 	m_gl.namedFramebufferTexture1DEXT(framebuffer, attachment, textarget, texture, level);
 }
 
@@ -3883,6 +6542,11 @@ void CallLogWrapper::glNamedFramebufferTexture2DEXT (glw::GLuint framebuffer, gl
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glNamedFramebufferTexture2DEXT(" << framebuffer << ", " << toHex(attachment) << ", " << toHex(textarget) << ", " << texture << ", " << level << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(framebuffer), CallTrace::pack(attachment), CallTrace::pack(textarget), CallTrace::pack(texture), CallTrace::pack(level) };
+		m_callTrace->record(s_glNamedFramebufferTexture2DEXTTraceInfo, traceArgs);
+	}
 	m_gl.namedFramebufferTexture2DEXT(framebuffer, attachment, textarget, texture, level);
 }
 
@@ -3890,6 +6554,11 @@ void CallLogWrapper::glNamedFramebufferTexture3DEXT (glw::GLuint framebuffer, gl
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glNamedFramebufferTexture3DEXT(" << framebuffer << ", " << toHex(attachment) << ", " << toHex(textarget) << ", " << texture << ", " << level << ", " << zoffset << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(framebuffer), CallTrace::pack(attachment), CallTrace::pack(textarget), CallTrace::pack(texture), CallTrace::pack(level), CallTrace::pack(zoffset) };
+		m_callTrace->record(s_glNamedFramebufferTexture3DEXTTraceInfo, traceArgs);
+	}
 	m_gl.namedFramebufferTexture3DEXT(framebuffer, attachment, textarget, texture, level, zoffset);
 }
 
@@ -3897,6 +6566,11 @@ void CallLogWrapper::glNamedFramebufferTextureEXT (glw::GLuint framebuffer, glw:
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glNamedFramebufferTextureEXT(" << framebuffer << ", " << toHex(attachment) << ", " << texture << ", " << level << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(framebuffer), CallTrace::pack(attachment), CallTrace::pack(texture), CallTrace::pack(level) };
+		m_callTrace->record(s_glNamedFramebufferTextureEXTTraceInfo, traceArgs);
+	}
 	m_gl.namedFramebufferTextureEXT(framebuffer, attachment, texture, level);
 }
 
@@ -3904,6 +6578,11 @@ void CallLogWrapper::glNamedFramebufferTextureFaceEXT (glw::GLuint framebuffer,
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glNamedFramebufferTextureFaceEXT(" << framebuffer << ", " << toHex(attachment) << ", " << texture << ", " << level << ", " << toHex(face) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(framebuffer), CallTrace::pack(attachment), CallTrace::pack(texture), CallTrace::pack(level), CallTrace::pack(face) };
+		m_callTrace->record(s_glNamedFramebufferTextureFaceEXTTraceInfo, traceArgs);
+	}
 	m_gl.namedFramebufferTextureFaceEXT(framebuffer, attachment, texture, level, face);
 }
 
@@ -3911,6 +6590,11 @@ void CallLogWrapper::glNamedFramebufferTextureLayer (glw::GLuint framebuffer, gl
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glNamedFramebufferTextureLayer(" << framebuffer << ", " << toHex(attachment) << ", " << texture << ", " << level << ", " << layer << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(framebuffer), CallTrace::pack(attachment), CallTrace::pack(texture), CallTrace::pack(level), CallTrace::pack(layer) };
+		m_callTrace->record(s_glNamedFramebufferTextureLayerTraceInfo, traceArgs);
+	}
 	m_gl.namedFramebufferTextureLayer(framebuffer, attachment, texture, level, layer);
 }
 
@@ -3918,6 +6602,11 @@ void CallLogWrapper::glNamedFramebufferTextureLayerEXT (glw::GLuint framebuffer,
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glNamedFramebufferTextureLayerEXT(" << framebuffer << ", " << toHex(attachment) << ", " << texture << ", " << level << ", " << layer << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(framebuffer), CallTrace::pack(attachment), CallTrace::pack(texture), CallTrace::pack(level), CallTrace::pack(layer) };
+		m_callTrace->record(s_glNamedFramebufferTextureLayerEXTTraceInfo, traceArgs);
+	}
 	m_gl.namedFramebufferTextureLayerEXT(framebuffer, attachment, texture, level, layer);
 }
 
@@ -3925,6 +6614,11 @@ void CallLogWrapper::glNamedProgramLocalParameter4dEXT (glw::GLuint program, glw
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glNamedProgramLocalParameter4dEXT(" << program << ", " << toHex(target) << ", " << index << ", " << x << ", " << y << ", " << z << ", " << w << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(program), CallTrace::pack(target), CallTrace::pack(index), CallTrace::pack(x), CallTrace::pack(y), CallTrace::pack(z), CallTrace::pack(w) };
+		m_callTrace->record(s_glNamedProgramLocalParameter4dEXTTraceInfo, traceArgs);
+	}
 	m_gl.namedProgramLocalParameter4dEXT(program, target, index, x, y, z, w);
 }
 
@@ -3932,6 +6626,11 @@ void CallLogWrapper::glNamedProgramLocalParameter4dvEXT (glw::GLuint program, gl
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glNamedProgramLocalParameter4dvEXT(" << program << ", " << toHex(target) << ", " << index << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(program), CallTrace::pack(target), CallTrace::pack(index), CallTrace::pack(params) };
+		m_callTrace->record(s_glNamedProgramLocalParameter4dvEXTTraceInfo, traceArgs);
+	}
 	m_gl.namedProgramLocalParameter4dvEXT(program, target, index, params);
 }
 
@@ -3939,6 +6638,11 @@ void CallLogWrapper::glNamedProgramLocalParameter4fEXT (glw::GLuint program, glw
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glNamedProgramLocalParameter4fEXT(" << program << ", " << toHex(target) << ", " << index << ", " << x << ", " << y << ", " << z << ", " << w << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(program), CallTrace::pack(target), CallTrace::pack(index), CallTrace::pack(x), CallTrace::pack(y), CallTrace::pack(z), CallTrace::pack(w) };
+		m_callTrace->record(s_glNamedProgramLocalParameter4fEXTTraceInfo, traceArgs);
+	}
 	m_gl.namedProgramLocalParameter4fEXT(program, target, index, x, y, z, w);
 }
 
@@ -3946,6 +6650,11 @@ void CallLogWrapper::glNamedProgramLocalParameter4fvEXT (glw::GLuint program, gl
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glNamedProgramLocalParameter4fvEXT(" << program << ", " << toHex(target) << ", " << index << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(program), CallTrace::pack(target), CallTrace::pack(index), CallTrace::pack(params) };
+		m_callTrace->record(s_glNamedProgramLocalParameter4fvEXTTraceInfo, traceArgs);
+	}
 	m_gl.namedProgramLocalParameter4fvEXT(program, target, index, params);
 }
 
@@ -3953,6 +6662,11 @@ void CallLogWrapper::glNamedProgramLocalParameterI4iEXT (glw::GLuint program, gl
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glNamedProgramLocalParameterI4iEXT(" << program << ", " << toHex(target) << ", " << index << ", " << x << ", " << y << ", " << z << ", " << w << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(program), CallTrace::pack(target), CallTrace::pack(index), CallTrace::pack(x), CallTrace::pack(y), CallTrace::pack(z), CallTrace::pack(w) };
+		m_callTrace->record(s_glNamedProgramLocalParameterI4iEXTTraceInfo, traceArgs);
+	}
 	m_gl.namedProgramLocalParameterI4iEXT(program, target, index, x, y, z, w);
 }
 
@@ -3960,6 +6674,11 @@ void CallLogWrapper::glNamedProgramLocalParameterI4ivEXT (glw::GLuint program, g
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glNamedProgramLocalParameterI4ivEXT(" << program << ", " << toHex(target) << ", " << index << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(program), CallTrace::pack(target), CallTrace::pack(index), CallTrace::pack(params) };
+		m_callTrace->record(s_glNamedProgramLocalParameterI4ivEXTTraceInfo, traceArgs);
+	}
 	m_gl.namedProgramLocalParameterI4ivEXT(program, target, index, params);
 }
 
@@ -3967,6 +6686,11 @@ void CallLogWrapper::glNamedProgramLocalParameterI4uiEXT (glw::GLuint program, g
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glNamedProgramLocalParameterI4uiEXT(" << program << ", " << toHex(target) << ", " << index << ", " << x << ", " << y << ", " << z << ", " << w << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(program), CallTrace::pack(target), CallTrace::pack(index), CallTrace::pack(x), CallTrace::pack(y), CallTrace::pack(z), CallTrace::pack(w) };
+		m_callTrace->record(s_glNamedProgramLocalParameterI4uiEXTTraceInfo, traceArgs);
+	}
 	m_gl.namedProgramLocalParameterI4uiEXT(program, target, index, x, y, z, w);
 }
 
@@ -3974,6 +6698,11 @@ void CallLogWrapper::glNamedProgramLocalParameterI4uivEXT (glw::GLuint program,
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glNamedProgramLocalParameterI4uivEXT(" << program << ", " << toHex(target) << ", " << index << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(program), CallTrace::pack(target), CallTrace::pack(index), CallTrace::pack(params) };
+		m_callTrace->record(s_glNamedProgramLocalParameterI4uivEXTTraceInfo, traceArgs);
+	}
 	m_gl.namedProgramLocalParameterI4uivEXT(program, target, index, params);
 }
 
@@ -3981,6 +6710,11 @@ void CallLogWrapper::glNamedProgramLocalParameters4fvEXT (glw::GLuint program, g
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glNamedProgramLocalParameters4fvEXT(" << program << ", " << toHex(target) << ", " << index << ", " << count << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(program), CallTrace::pack(target), CallTrace::pack(index), CallTrace::pack(count), CallTrace::pack(params) };
+		m_callTrace->record(s_glNamedProgramLocalParameters4fvEXTTraceInfo, traceArgs);
+	}
 	m_gl.namedProgramLocalParameters4fvEXT(program, target, index, count, params);
 }
 
@@ -3988,6 +6722,11 @@ void CallLogWrapper::glNamedProgramLocalParametersI4ivEXT (glw::GLuint program,
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glNamedProgramLocalParametersI4ivEXT(" << program << ", " << toHex(target) << ", " << index << ", " << count << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(program), CallTrace::pack(target), CallTrace::pack(index), CallTrace::pack(count), CallTrace::pack(params) };
+		m_callTrace->record(s_glNamedProgramLocalParametersI4ivEXTTraceInfo, traceArgs);
+	}
 	m_gl.namedProgramLocalParametersI4ivEXT(program, target, index, count, params);
 }
 
@@ -3995,6 +6734,11 @@ void CallLogWrapper::glNamedProgramLocalParametersI4uivEXT (glw::GLuint program,
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glNamedProgramLocalParametersI4uivEXT(" << program << ", " << toHex(target) << ", " << index << ", " << count << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(program), CallTrace::pack(target), CallTrace::pack(index), CallTrace::pack(count), CallTrace::pack(params) };
+		m_callTrace->record(s_glNamedProgramLocalParametersI4uivEXTTraceInfo, traceArgs);
+	}
 	m_gl.namedProgramLocalParametersI4uivEXT(program, target, index, count, params);
 }
 
@@ -4002,6 +6746,11 @@ void CallLogWrapper::glNamedProgramStringEXT (glw::GLuint program, glw::GLenum t
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glNamedProgramStringEXT(" << program << ", " << toHex(target) << ", " << toHex(format) << ", " << len << ", " << string << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(program), CallTrace::pack(target), CallTrace::pack(format), CallTrace::pack(len), CallTrace::pack(string) };
+		m_callTrace->record(s_glNamedProgramStringEXTTraceInfo, traceArgs);
+	}
 	m_gl.namedProgramStringEXT(program, target, format, len, string);
 }
 
@@ -4009,6 +6758,11 @@ void CallLogWrapper::glNamedRenderbufferStorage (glw::GLuint renderbuffer, glw::
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glNamedRenderbufferStorage(" << renderbuffer << ", " << toHex(internalformat) << ", " << width << ", " << height << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(renderbuffer), CallTrace::pack(internalformat), CallTrace::pack(width), CallTrace::pack(height) };
+		m_callTrace->record(s_glNamedRenderbufferStorageTraceInfo, traceArgs);
+	}
 	m_gl.namedRenderbufferStorage(renderbuffer, internalformat, width, height);
 }
 
@@ -4016,6 +6770,11 @@ void CallLogWrapper::glNamedRenderbufferStorageEXT (glw::GLuint renderbuffer, gl
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glNamedRenderbufferStorageEXT(" << renderbuffer << ", " << toHex(internalformat) << ", " << width << ", " << height << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(renderbuffer), CallTrace::pack(internalformat), CallTrace::pack(width), CallTrace::pack(height) };
+		m_callTrace->record(s_glNamedRenderbufferStorageEXTTraceInfo, traceArgs);
+	}
 	m_gl.namedRenderbufferStorageEXT(renderbuffer, internalformat, width, height);
 }
 
@@ -4023,6 +6782,11 @@ void CallLogWrapper::glNamedRenderbufferStorageMultisample (glw::GLuint renderbu
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glNamedRenderbufferStorageMultisample(" << renderbuffer << ", " << samples << ", " << toHex(internalformat) << ", " << width << ", " << height << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(renderbuffer), CallTrace::pack(samples), CallTrace::pack(internalformat), CallTrace::pack(width), CallTrace::pack(height) };
+		m_callTrace->record(s_glNamedRenderbufferStorageMultisampleTraceInfo, traceArgs);
+	}
 	m_gl.namedRenderbufferStorageMultisample(renderbuffer, samples, internalformat, width, height);
 }
 
@@ -4030,6 +6794,11 @@ void CallLogWrapper::glNamedRenderbufferStorageMultisampleCoverageEXT (glw::GLui
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glNamedRenderbufferStorageMultisampleCoverageEXT(" << renderbuffer << ", " << coverageSamples << ", " << colorSamples << ", " << toHex(internalformat) << ", " << width << ", " << height << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(renderbuffer), CallTrace::pack(coverageSamples), CallTrace::pack(colorSamples), CallTrace::pack(internalformat), CallTrace::pack(width), CallTrace::pack(height) };
+		m_callTrace->record(s_glNamedRenderbufferStorageMultisampleCoverageEXTTraceInfo, traceArgs);
+	}
 	m_gl.namedRenderbufferStorageMultisampleCoverageEXT(renderbuffer, coverageSamples, colorSamples, internalformat, width, height);
 }
 
@@ -4037,6 +6806,11 @@ void CallLogWrapper::glNamedRenderbufferStorageMultisampleEXT (glw::GLuint rende
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glNamedRenderbufferStorageMultisampleEXT(" << renderbuffer << ", " << samples << ", " << toHex(internalformat) << ", " << width << ", " << height << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(renderbuffer), CallTrace::pack(samples), CallTrace::pack(internalformat), CallTrace::pack(width), CallTrace::pack(height) };
+		m_callTrace->record(s_glNamedRenderbufferStorageMultisampleEXTTraceInfo, traceArgs);
+	}
 	m_gl.namedRenderbufferStorageMultisampleEXT(renderbuffer, samples, internalformat, width, height);
 }
 
@@ -4044,6 +6818,11 @@ void CallLogWrapper::glObjectLabel (glw::GLenum identifier, glw::GLuint name, gl
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glObjectLabel(" << toHex(identifier) << ", " << name << ", " << length << ", " << getStringStr(label) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(identifier), CallTrace::pack(name), CallTrace::pack(length), CallTrace::pack(label) };
+		m_callTrace->record(s_glObjectLabelTraceInfo, traceArgs);
+	}
 	m_gl.objectLabel(identifier, name, length, label);
 }
 
@@ -4051,6 +6830,11 @@ void CallLogWrapper::glObjectPtrLabel (const void *ptr, glw::GLsizei length, con
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glObjectPtrLabel(" << ptr << ", " << length << ", " << getStringStr(label) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(ptr), CallTrace::pack(length), CallTrace::pack(label) };
+		m_callTrace->record(s_glObjectPtrLabelTraceInfo, traceArgs);
+	}
 	m_gl.objectPtrLabel(ptr, length, label);
 }
 
@@ -4058,6 +6842,11 @@ void CallLogWrapper::glPatchParameterfv (glw::GLenum pname, const glw::GLfloat *
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glPatchParameterfv(" << toHex(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(values))) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(pname), CallTrace::pack(values) };
+		m_callTrace->record(s_glPatchParameterfvTraceInfo, traceArgs);
+	}
 	m_gl.patchParameterfv(pname, values);
 }
 
@@ -4065,6 +6854,11 @@ void CallLogWrapper::glPatchParameteri (glw::GLenum pname, glw::GLint value)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glPatchParameteri(" << getPatchParamStr(pname) << ", " << value << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(pname), CallTrace::pack(value) };
+		m_callTrace->record(s_glPatchParameteriTraceInfo, traceArgs);
+	}
 	m_gl.patchParameteri(pname, value);
 }
 
@@ -4072,6 +6866,8 @@ void CallLogWrapper::glPauseTransformFeedback (void)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glPauseTransformFeedback(" << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+		m_callTrace->record(s_glPauseTransformFeedbackTraceInfo, DE_NULL);
 	m_gl.pauseTransformFeedback();
 }
 
@@ -4079,6 +6875,11 @@ void CallLogWrapper::glPixelStoref (glw::GLenum pname, glw::GLfloat param)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glPixelStoref(" << toHex(pname) << ", " << param << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(pname), CallTrace::pack(param) };
+		m_callTrace->record(s_glPixelStorefTraceInfo, traceArgs);
+	}
 	m_gl.pixelStoref(pname, param);
 }
 
@@ -4086,6 +6887,11 @@ void CallLogWrapper::glPixelStorei (glw::GLenum pname, glw::GLint param)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glPixelStorei(" << getPixelStoreParameterStr(pname) << ", " << param << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(pname), CallTrace::pack(param) };
+		m_callTrace->record(s_glPixelStoreiTraceInfo, traceArgs);
+	}
 	m_gl.pixelStorei(pname, param);
 }
 
@@ -4093,6 +6899,11 @@ void CallLogWrapper::glPointParameterf (glw::GLenum pname, glw::GLfloat param)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glPointParameterf(" << toHex(pname) << ", " << param << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(pname), CallTrace::pack(param) };
+		m_callTrace->record(s_glPointParameterfTraceInfo, traceArgs);
+	}
 	m_gl.pointParameterf(pname, param);
 }
 
@@ -4100,6 +6911,11 @@ void CallLogWrapper::glPointParameterfv (glw::GLenum pname, const glw::GLfloat *
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glPointParameterfv(" << toHex(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(pname), CallTrace::pack(params) };
+		m_callTrace->record(s_glPointParameterfvTraceInfo, traceArgs);
+	}
 	m_gl.pointParameterfv(pname, params);
 }
 
@@ -4107,6 +6923,11 @@ void CallLogWrapper::glPointParameteri (glw::GLenum pname, glw::GLint param)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glPointParameteri(" << toHex(pname) << ", " << param << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(pname), CallTrace::pack(param) };
+		m_callTrace->record(s_glPointParameteriTraceInfo, traceArgs);
+	}
 	m_gl.pointParameteri(pname, param);
 }
 
@@ -4114,6 +6935,11 @@ void CallLogWrapper::glPointParameteriv (glw::GLenum pname, const glw::GLint *pa
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glPointParameteriv(" << toHex(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(pname), CallTrace::pack(params) };
+		m_callTrace->record(s_glPointParameterivTraceInfo, traceArgs);
+	}
 	m_gl.pointParameteriv(pname, params);
 }
 
@@ -4121,6 +6947,11 @@ void CallLogWrapper::glPointSize (glw::GLfloat size)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glPointSize(" << size << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(size) };
+		m_callTrace->record(s_glPointSizeTraceInfo, traceArgs);
+	}
 	m_gl.pointSize(size);
 }
 
@@ -4128,6 +6959,11 @@ void CallLogWrapper::glPolygonMode (glw::GLenum face, glw::GLenum mode)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glPolygonMode(" << toHex(face) << ", " << toHex(mode) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(face), CallTrace::pack(mode) };
+		m_callTrace->record(s_glPolygonModeTraceInfo, traceArgs);
+	}
 	m_gl.polygonMode(face, mode);
 }
 
@@ -4135,6 +6971,11 @@ void CallLogWrapper::glPolygonOffset (glw::GLfloat factor, glw::GLfloat units)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glPolygonOffset(" << factor << ", " << units << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(factor), CallTrace::pack(units) };
+		m_callTrace->record(s_glPolygonOffsetTraceInfo, traceArgs);
+	}
 	m_gl.polygonOffset(factor, units);
 }
 
@@ -4142,6 +6983,11 @@ void CallLogWrapper::glPolygonOffsetClamp (glw::GLfloat factor, glw::GLfloat uni
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glPolygonOffsetClamp(" << factor << ", " << units << ", " << clamp << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(factor), CallTrace::pack(units), CallTrace::pack(clamp) };
+		m_callTrace->record(s_glPolygonOffsetClampTraceInfo, traceArgs);
+	}
 	m_gl.polygonOffsetClamp(factor, units, clamp);
 }
 
@@ -4149,6 +6995,8 @@ void CallLogWrapper::glPopDebugGroup (void)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glPopDebugGroup(" << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+		m_callTrace->record(s_glPopDebugGroupTraceInfo, DE_NULL);
 	m_gl.popDebugGroup();
 }
 
@@ -4156,6 +7004,8 @@ void CallLogWrapper::glPopGroupMarkerEXT (void)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glPopGroupMarkerEXT(" << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+		m_callTrace->record(s_glPopGroupMarkerEXTTraceInfo, DE_NULL);
 	m_gl.popGroupMarkerEXT();
 }
 
@@ -4163,6 +7013,11 @@ void CallLogWrapper::glPrimitiveBoundingBox (glw::GLfloat minX, glw::GLfloat min
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glPrimitiveBoundingBox(" << minX << ", " << minY << ", " << minZ << ", " << minW << ", " << maxX << ", " << maxY << ", " << maxZ << ", " << maxW << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(minX), CallTrace::pack(minY), CallTrace::pack(minZ), CallTrace::pack(minW), CallTrace::pack(maxX), CallTrace::pack(maxY), CallTrace::pack(maxZ), CallTrace::pack(maxW) };
+		m_callTrace->record(s_glPrimitiveBoundingBoxTraceInfo, traceArgs);
+	}
 	m_gl.primitiveBoundingBox(minX, minY, minZ, minW, maxX, maxY, maxZ, maxW);
 }
 
@@ -4170,6 +7025,11 @@ void CallLogWrapper::glPrimitiveRestartIndex (glw::GLuint index)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glPrimitiveRestartIndex(" << index << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(index) };
+		m_callTrace->record(s_glPrimitiveRestartIndexTraceInfo, traceArgs);
+	}
 	m_gl.primitiveRestartIndex(index);
 }
 
@@ -4177,6 +7037,11 @@ void CallLogWrapper::glProgramBinary (glw::GLuint program, glw::GLenum binaryFor
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glProgramBinary(" << program << ", " << toHex(binaryFormat) << ", " << binary << ", " << length << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(program), CallTrace::pack(binaryFormat), CallTrace::pack(binary), CallTrace::pack(length) };
+		m_callTrace->record(s_glProgramBinaryTraceInfo, traceArgs);
+	}
 	m_gl.programBinary(program, binaryFormat, binary, length);
 }
 
@@ -4184,6 +7049,11 @@ void CallLogWrapper::glProgramParameteri (glw::GLuint program, glw::GLenum pname
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glProgramParameteri(" << program << ", " << getProgramParamStr(pname) << ", " << value << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(program), CallTrace::pack(pname), CallTrace::pack(value) };
+		m_callTrace->record(s_glProgramParameteriTraceInfo, traceArgs);
+	}
 	m_gl.programParameteri(program, pname, value);
 }
 
@@ -4191,6 +7061,11 @@ void CallLogWrapper::glProgramUniform1d (glw::GLuint program, glw::GLint locatio
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glProgramUniform1d(" << program << ", " << location << ", " << v0 << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(program), CallTrace::pack(location), CallTrace::pack(v0) };
+		m_callTrace->record(s_glProgramUniform1dTraceInfo, traceArgs);
+	}
 	m_gl.programUniform1d(program, location, v0);
 }
 
@@ -4198,6 +7073,11 @@ void CallLogWrapper::glProgramUniform1dEXT (glw::GLuint program, glw::GLint loca
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glProgramUniform1dEXT(" << program << ", " << location << ", " << x << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(program), CallTrace::pack(location), CallTrace::pack(x) };
+		m_callTrace->record(s_glProgramUniform1dEXTTraceInfo, traceArgs);
+	}
 	m_gl.programUniform1dEXT(program, location, x);
 }
 
@@ -4205,6 +7085,11 @@ void CallLogWrapper::glProgramUniform1dv (glw::GLuint program, glw::GLint locati
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glProgramUniform1dv(" << program << ", " << location << ", " << count << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(value))) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(program), CallTrace::pack(location), CallTrace::pack(count), CallTrace::pack(value) };
+		m_callTrace->record(s_glProgramUniform1dvTraceInfo, traceArgs);
+	}
 	m_gl.programUniform1dv(program, location, count, value);
 }
 
@@ -4212,6 +7097,11 @@ void CallLogWrapper::glProgramUniform1dvEXT (glw::GLuint program, glw::GLint loc
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glProgramUniform1dvEXT(" << program << ", " << location << ", " << count << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(value))) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(program), CallTrace::pack(location), CallTrace::pack(count), CallTrace::pack(value) };
+		m_callTrace->record(s_glProgramUniform1dvEXTTraceInfo, traceArgs);
+	}
 	m_gl.programUniform1dvEXT(program, location, count, value);
 }
 
@@ -4219,6 +7109,11 @@ void CallLogWrapper::glProgramUniform1f (glw::GLuint program, glw::GLint locatio
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glProgramUniform1f(" << program << ", " << location << ", " << v0 << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(program), CallTrace::pack(location), CallTrace::pack(v0) };
+		m_callTrace->record(s_glProgramUniform1fTraceInfo, traceArgs);
+	}
 	m_gl.programUniform1f(program, location, v0);
 }
 
@@ -4226,6 +7121,11 @@ void CallLogWrapper::glProgramUniform1fv (glw::GLuint program, glw::GLint locati
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glProgramUniform1fv(" << program << ", " << location << ", " << count << ", " << getPointerStr(value, (count * 1)) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(program), CallTrace::pack(location), CallTrace::pack(count), CallTrace::pack(value) };
+		m_callTrace->record(s_glProgramUniform1fvTraceInfo, traceArgs);
+	}
 	m_gl.programUniform1fv(program, location, count, value);
 }
 
@@ -4233,6 +7133,11 @@ void CallLogWrapper::glProgramUniform1i (glw::GLuint program, glw::GLint locatio
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glProgramUniform1i(" << program << ", " << location << ", " << v0 << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(program), CallTrace::pack(location), CallTrace::pack(v0) };
+		m_callTrace->record(s_glProgramUniform1iTraceInfo, traceArgs);
+	}
 	m_gl.programUniform1i(program, location, v0);
 }
 
@@ -4240,6 +7145,11 @@ void CallLogWrapper::glProgramUniform1iv (glw::GLuint program, glw::GLint locati
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glProgramUniform1iv(" << program << ", " << location << ", " << count << ", " << getPointerStr(value, (count * 1)) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(program), CallTrace::pack(location), CallTrace::pack(count), CallTrace::pack(value) };
+		m_callTrace->record(s_glProgramUniform1ivTraceInfo, traceArgs);
+	}
 	m_gl.programUniform1iv(program, location, count, value);
 }
 
@@ -4247,6 +7157,11 @@ void CallLogWrapper::glProgramUniform1ui (glw::GLuint program, glw::GLint locati
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glProgramUniform1ui(" << program << ", " << location << ", " << v0 << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(program), CallTrace::pack(location), CallTrace::pack(v0) };
+		m_callTrace->record(s_glProgramUniform1uiTraceInfo, traceArgs);
+	}
 	m_gl.programUniform1ui(program, location, v0);
 }
 
@@ -4254,6 +7169,11 @@ void CallLogWrapper::glProgramUniform1uiv (glw::GLuint program, glw::GLint locat
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glProgramUniform1uiv(" << program << ", " << location << ", " << count << ", " << getPointerStr(value, (count * 1)) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(program), CallTrace::pack(location), CallTrace::pack(count), CallTrace::pack(value) };
+		m_callTrace->record(s_glProgramUniform1uivTraceInfo, traceArgs);
+	}
 	m_gl.programUniform1uiv(program, location, count, value);
 }
 
@@ -4261,6 +7181,11 @@ void CallLogWrapper::glProgramUniform2d (glw::GLuint program, glw::GLint locatio
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glProgramUniform2d(" << program << ", " << location << ", " << v0 << ", " << v1 << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(program), CallTrace::pack(location), CallTrace::pack(v0), CallTrace::pack(v1) };
+		m_callTrace->record(s_glProgramUniform2dTraceInfo, traceArgs);
+	}
 	m_gl.programUniform2d(program, location, v0, v1);
 }
 
@@ -4268,6 +7193,11 @@ void CallLogWrapper::glProgramUniform2dEXT (glw::GLuint program, glw::GLint loca
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glProgramUniform2dEXT(" << program << ", " << location << ", " << x << ", " << y << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(program), CallTrace::pack(location), CallTrace::pack(x), CallTrace::pack(y) };
+		m_callTrace->record(s_glProgramUniform2dEXTTraceInfo, traceArgs);
+	}
 	m_gl.programUniform2dEXT(program, location, x, y);
 }
 
@@ -4275,6 +7205,11 @@ void CallLogWrapper::glProgramUniform2dv (glw::GLuint program, glw::GLint locati
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glProgramUniform2dv(" << program << ", " << location << ", " << count << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(value))) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(program), CallTrace::pack(location), CallTrace::pack(count), CallTrace::pack(value) };
+		m_callTrace->record(s_glProgramUniform2dvTraceInfo, traceArgs);
+	}
 	m_gl.programUniform2dv(program, location, count, value);
 }
 
@@ -4282,6 +7217,11 @@ void CallLogWrapper::glProgramUniform2dvEXT (glw::GLuint program, glw::GLint loc
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glProgramUniform2dvEXT(" << program << ", " << location << ", " << count << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(value))) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(program), CallTrace::pack(location), CallTrace::pack(count), CallTrace::pack(value) };
+		m_callTrace->record(s_glProgramUniform2dvEXTTraceInfo, traceArgs);
+	}
 	m_gl.programUniform2dvEXT(program, location, count, value);
 }
 
@@ -4289,6 +7229,11 @@ void CallLogWrapper::glProgramUniform2f (glw::GLuint program, glw::GLint locatio
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glProgramUniform2f(" << program << ", " << location << ", " << v0 << ", " << v1 << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(program), CallTrace::pack(location), CallTrace::pack(v0), CallTrace::pack(v1) };
+		m_callTrace->record(s_glProgramUniform2fTraceInfo, traceArgs);
+	}
 	m_gl.programUniform2f(program, location, v0, v1);
 }
 
@@ -4296,6 +7241,11 @@ void CallLogWrapper::glProgramUniform2fv (glw::GLuint program, glw::GLint locati
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glProgramUniform2fv(" << program << ", " << location << ", " << count << ", " << getPointerStr(value, (count * 2)) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(program), CallTrace::pack(location), CallTrace::pack(count), CallTrace::pack(value) };
+		m_callTrace->record(s_glProgramUniform2fvTraceInfo, traceArgs);
+	}
 	m_gl.programUniform2fv(program, location, count, value);
 }
 
@@ -4303,6 +7253,11 @@ void CallLogWrapper::glProgramUniform2i (glw::GLuint program, glw::GLint locatio
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glProgramUniform2i(" << program << ", " << location << ", " << v0 << ", " << v1 << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(program), CallTrace::pack(location), CallTrace::pack(v0), CallTrace::pack(v1) };
+		m_callTrace->record(s_glProgramUniform2iTraceInfo, traceArgs);
+	}
 	m_gl.programUniform2i(program, location, v0, v1);
 }
 
@@ -4310,6 +7265,11 @@ void CallLogWrapper::glProgramUniform2iv (glw::GLuint program, glw::GLint locati
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glProgramUniform2iv(" << program << ", " << location << ", " << count << ", " << getPointerStr(value, (count * 2)) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(program), CallTrace::pack(location), CallTrace::pack(count), CallTrace::pack(value) };
+		m_callTrace->record(s_glProgramUniform2ivTraceInfo, traceArgs);
+	}
 	m_gl.programUniform2iv(program, location, count, value);
 }
 
@@ -4317,6 +7277,11 @@ void CallLogWrapper::glProgramUniform2ui (glw::GLuint program, glw::GLint locati
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glProgramUniform2ui(" << program << ", " << location << ", " << v0 << ", " << v1 << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(program), CallTrace::pack(location), CallTrace::pack(v0), CallTrace::pack(v1) };
+		m_callTrace->record(s_glProgramUniform2uiTraceInfo, traceArgs);
+	}
 	m_gl.programUniform2ui(program, location, v0, v1);
 }
 
@@ -4324,6 +7289,11 @@ void CallLogWrapper::glProgramUniform2uiv (glw::GLuint program, glw::GLint locat
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glProgramUniform2uiv(" << program << ", " << location << ", " << count << ", " << getPointerStr(value, (count * 2)) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(program), CallTrace::pack(location), CallTrace::pack(count), CallTrace::pack(value) };
+		m_callTrace->record(s_glProgramUniform2uivTraceInfo, traceArgs);
+	}
 	m_gl.programUniform2uiv(program, location, count, value);
 }
 
@@ -4331,6 +7301,11 @@ void CallLogWrapper::glProgramUniform3d (glw::GLuint program, glw::GLint locatio
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glProgramUniform3d(" << program << ", " << location << ", " << v0 << ", " << v1 << ", " << v2 << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(program), CallTrace::pack(location), CallTrace::pack(v0), CallTrace::pack(v1), CallTrace::pack(v2) };
+		m_callTrace->record(s_glProgramUniform3dTraceInfo, traceArgs);
+	}
 	m_gl.programUniform3d(program, location, v0, v1, v2);
 }
 
@@ -4338,6 +7313,11 @@ void CallLogWrapper::glProgramUniform3dEXT (glw::GLuint program, glw::GLint loca
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glProgramUniform3dEXT(" << program << ", " << location << ", " << x << ", " << y << ", " << z << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(program), CallTrace::pack(location), CallTrace::pack(x), CallTrace::pack(y), CallTrace::pack(z) };
+		m_callTrace->record(s_glProgramUniform3dEXTTraceInfo, traceArgs);
+	}
 	m_gl.programUniform3dEXT(program, location, x, y, z);
 }
 
@@ -4345,6 +7325,11 @@ void CallLogWrapper::glProgramUniform3dv (glw::GLuint program, glw::GLint locati
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glProgramUniform3dv(" << program << ", " << location << ", " << count << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(value))) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(program), CallTrace::pack(location), CallTrace::pack(count), CallTrace::pack(value) };
+		m_callTrace->record(s_glProgramUniform3dvTraceInfo, traceArgs);
+	}
 	m_gl.programUniform3dv(program, location, count, value);
 }
 
@@ -4352,6 +7337,11 @@ void CallLogWrapper::glProgramUniform3dvEXT (glw::GLuint program, glw::GLint loc
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glProgramUniform3dvEXT(" << program << ", " << location << ", " << count << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(value))) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(program), CallTrace::pack(location), CallTrace::pack(count), CallTrace::pack(value) };
+		m_callTrace->record(s_glProgramUniform3dvEXTTraceInfo, traceArgs);
+	}
 	m_gl.programUniform3dvEXT(program, location, count, value);
 }
 
@@ -4359,6 +7349,11 @@ void CallLogWrapper::glProgramUniform3f (glw::GLuint program, glw::GLint locatio
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glProgramUniform3f(" << program << ", " << location << ", " << v0 << ", " << v1 << ", " << v2 << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(program), CallTrace::pack(location), CallTrace::pack(v0), CallTrace::pack(v1), CallTrace::pack(v2) };
+		m_callTrace->record(s_glProgramUniform3fTraceInfo, traceArgs);
+	}
 	m_gl.programUniform3f(program, location, v0, v1, v2);
 }
 
@@ -4366,6 +7361,11 @@ void CallLogWrapper::glProgramUniform3fv (glw::GLuint program, glw::GLint locati
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glProgramUniform3fv(" << program << ", " << location << ", " << count << ", " << getPointerStr(value, (count * 3)) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(program), CallTrace::pack(location), CallTrace::pack(count), CallTrace::pack(value) };
+		m_callTrace->record(s_glProgramUniform3fvTraceInfo, traceArgs);
+	}
 	m_gl.programUniform3fv(program, location, count, value);
 }
 
@@ -4373,6 +7373,11 @@ void CallLogWrapper::glProgramUniform3i (glw::GLuint program, glw::GLint locatio
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glProgramUniform3i(" << program << ", " << location << ", " << v0 << ", " << v1 << ", " << v2 << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(program), CallTrace::pack(location), CallTrace::pack(v0), CallTrace::pack(v1), CallTrace::pack(v2) };
+		m_callTrace->record(s_glProgramUniform3iTraceInfo, traceArgs);
+	}
 	m_gl.programUniform3i(program, location, v0, v1, v2);
 }
 
@@ -4380,6 +7385,11 @@ void CallLogWrapper::glProgramUniform3iv (glw::GLuint program, glw::GLint locati
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glProgramUniform3iv(" << program << ", " << location << ", " << count << ", " << getPointerStr(value, (count * 3)) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(program), CallTrace::pack(location), CallTrace::pack(count), CallTrace::pack(value) };
+		m_callTrace->record(s_glProgramUniform3ivTraceInfo, traceArgs);
+	}
 	m_gl.programUniform3iv(program, location, count, value);
 }
 
@@ -4387,6 +7397,11 @@ void CallLogWrapper::glProgramUniform3ui (glw::GLuint program, glw::GLint locati
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glProgramUniform3ui(" << program << ", " << location << ", " << v0 << ", " << v1 << ", " << v2 << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(program), CallTrace::pack(location), CallTrace::pack(v0), CallTrace::pack(v1), CallTrace::pack(v2) };
+		m_callTrace->record(s_glProgramUniform3uiTraceInfo, traceArgs);
+	}
 	m_gl.programUniform3ui(program, location, v0, v1, v2);
 }
 
@@ -4394,6 +7409,11 @@ void CallLogWrapper::glProgramUniform3uiv (glw::GLuint program, glw::GLint locat
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glProgramUniform3uiv(" << program << ", " << location << ", " << count << ", " << getPointerStr(value, (count * 3)) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(program), CallTrace::pack(location), CallTrace::pack(count), CallTrace::pack(value) };
+		m_callTrace->record(s_glProgramUniform3uivTraceInfo, traceArgs);
+	}
 	m_gl.programUniform3uiv(program, location, count, value);
 }
 
@@ -4401,6 +7421,11 @@ void CallLogWrapper::glProgramUniform4d (glw::GLuint program, glw::GLint locatio
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glProgramUniform4d(" << program << ", " << location << ", " << v0 << ", " << v1 << ", " << v2 << ", " << v3 << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(program), CallTrace::pack(location), CallTrace::pack(v0), CallTrace::pack(v1), CallTrace::pack(v2), CallTrace::pack(v3) };
+		m_callTrace->record(s_glProgramUniform4dTraceInfo, traceArgs);
+	}
 	m_gl.programUniform4d(program, location, v0, v1, v2, v3);
 }
 
@@ -4408,6 +7433,11 @@ void CallLogWrapper::glProgramUniform4dEXT (glw::GLuint program, glw::GLint loca
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glProgramUniform4dEXT(" << program << ", " << location << ", " << x << ", " << y << ", " << z << ", " << w << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(program), CallTrace::pack(location), CallTrace::pack(x), CallTrace::pack(y), CallTrace::pack(z), CallTrace::pack(w) };
+		m_callTrace->record(s_glProgramUniform4dEXTTraceInfo, traceArgs);
+	}
 	m_gl.programUniform4dEXT(program, location, x, y, z, w);
 }
 
@@ -4415,6 +7445,11 @@ void CallLogWrapper::glProgramUniform4dv (glw::GLuint program, glw::GLint locati
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glProgramUniform4dv(" << program << ", " << location << ", " << count << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(value))) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(program), CallTrace::pack(location), CallTrace::pack(count), CallTrace::pack(value) };
+		m_callTrace->record(s_glProgramUniform4dvTraceInfo, traceArgs);
+	}
 	m_gl.programUniform4dv(program, location, count, value);
 }
 
@@ -4422,6 +7457,11 @@ void CallLogWrapper::glProgramUniform4dvEXT (glw::GLuint program, glw::GLint loc
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glProgramUniform4dvEXT(" << program << ", " << location << ", " << count << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(value))) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(program), CallTrace::pack(location), CallTrace::pack(count), CallTrace::pack(value) };
+		m_callTrace->record(s_glProgramUniform4dvEXTTraceInfo, traceArgs);
+	}
 	m_gl.programUniform4dvEXT(program, location, count, value);
 }
 
@@ -4429,6 +7469,11 @@ void CallLogWrapper::glProgramUniform4f (glw::GLuint program, glw::GLint locatio
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glProgramUniform4f(" << program << ", " << location << ", " << v0 << ", " << v1 << ", " << v2 << ", " << v3 << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(program), CallTrace::pack(location), CallTrace::pack(v0), CallTrace::pack(v1), CallTrace::pack(v2), CallTrace::pack(v3) };
+		m_callTrace->record(s_glProgramUniform4fTraceInfo, traceArgs);
+	}
 	m_gl.programUniform4f(program, location, v0, v1, v2, v3);
 }
 
@@ -4436,6 +7481,11 @@ void CallLogWrapper::glProgramUniform4fv (glw::GLuint program, glw::GLint locati
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glProgramUniform4fv(" << program << ", " << location << ", " << count << ", " << getPointerStr(value, (count * 4)) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(program), CallTrace::pack(location), CallTrace::pack(count), CallTrace::pack(value) };
+		m_callTrace->record(s_glProgramUniform4fvTraceInfo, traceArgs);
+	}
 	m_gl.programUniform4fv(program, location, count, value);
 }
 
@@ -4443,6 +7493,11 @@ void CallLogWrapper::glProgramUniform4i (glw::GLuint program, glw::GLint locatio
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glProgramUniform4i(" << program << ", " << location << ", " << v0 << ", " << v1 << ", " << v2 << ", " << v3 << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(program), CallTrace::pack(location), CallTrace::pack(v0), CallTrace::pack(v1), CallTrace::pack(v2), CallTrace::pack(v3) };
+		m_callTrace->record(s_glProgramUniform4iTraceInfo, traceArgs);
+	}
 	m_gl.programUniform4i(program, location, v0, v1, v2, v3);
 }
 
@@ -4450,6 +7505,11 @@ void CallLogWrapper::glProgramUniform4iv (glw::GLuint program, glw::GLint locati
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glProgramUniform4iv(" << program << ", " << location << ", " << count << ", " << getPointerStr(value, (count * 4)) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(program), CallTrace::pack(location), CallTrace::pack(count), CallTrace::pack(value) };
+		m_callTrace->record(s_glProgramUniform4ivTraceInfo, traceArgs);
+	}
 	m_gl.programUniform4iv(program, location, count, value);
 }
 
@@ -4457,6 +7517,11 @@ void CallLogWrapper::glProgramUniform4ui (glw::GLuint program, glw::GLint locati
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glProgramUniform4ui(" << program << ", " << location << ", " << v0 << ", " << v1 << ", " << v2 << ", " << v3 << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(program), CallTrace::pack(location), CallTrace::pack(v0), CallTrace::pack(v1), CallTrace::pack(v2), CallTrace::pack(v3) };
+		m_callTrace->record(s_glProgramUniform4uiTraceInfo, traceArgs);
+	}
 	m_gl.programUniform4ui(program, location, v0, v1, v2, v3);
 }
 
@@ -4464,6 +7529,11 @@ void CallLogWrapper::glProgramUniform4uiv (glw::GLuint program, glw::GLint locat
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glProgramUniform4uiv(" << program << ", " << location << ", " << count << ", " << getPointerStr(value, (count * 4)) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(program), CallTrace::pack(location), CallTrace::pack(count), CallTrace::pack(value) };
+		m_callTrace->record(s_glProgramUniform4uivTraceInfo, traceArgs);
+	}
 	m_gl.programUniform4uiv(program, location, count, value);
 }
 
@@ -4471,6 +7541,11 @@ void CallLogWrapper::glProgramUniformMatrix2dv (glw::GLuint program, glw::GLint
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glProgramUniformMatrix2dv(" << program << ", " << location << ", " << count << ", " << getBooleanStr(transpose) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(value))) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(program), CallTrace::pack(location), CallTrace::pack(count), CallTrace::pack(transpose), CallTrace::pack(value) };
+		m_callTrace->record(s_glProgramUniformMatrix2dvTraceInfo, traceArgs);
+	}
 	m_gl.programUniformMatrix2dv(program, location, count, transpose, value);
 }
 
@@ -4478,6 +7553,11 @@ void CallLogWrapper::glProgramUniformMatrix2dvEXT (glw::GLuint program, glw::GLi
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glProgramUniformMatrix2dvEXT(" << program << ", " << location << ", " << count << ", " << getBooleanStr(transpose) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(value))) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(program), CallTrace::pack(location), CallTrace::pack(count), CallTrace::pack(transpose), CallTrace::pack(value) };
+		m_callTrace->record(s_glProgramUniformMatrix2dvEXTTraceInfo, traceArgs);
+	}
 	m_gl.programUniformMatrix2dvEXT(program, location, count, transpose, value);
 }
 
@@ -4485,6 +7565,11 @@ void CallLogWrapper::glProgramUniformMatrix2fv (glw::GLuint program, glw::GLint
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glProgramUniformMatrix2fv(" << program << ", " << location << ", " << count << ", " << getBooleanStr(transpose) << ", " << getPointerStr(value, (count * 2*2)) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(program), CallTrace::pack(location), CallTrace::pack(count), CallTrace::pack(transpose), CallTrace::pack(value) };
+		m_callTrace->record(s_glProgramUniformMatrix2fvTraceInfo, traceArgs);
+	}
 	m_gl.programUniformMatrix2fv(program, location, count, transpose, value);
 }
 
@@ -4492,6 +7577,11 @@ void CallLogWrapper::glProgramUniformMatrix2x3dv (glw::GLuint program, glw::GLin
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glProgramUniformMatrix2x3dv(" << program << ", " << location << ", " << count << ", " << getBooleanStr(transpose) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(value))) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(program), CallTrace::pack(location), CallTrace::pack(count), CallTrace::pack(transpose), CallTrace::pack(value) };
+		m_callTrace->record(s_glProgramUniformMatrix2x3dvTraceInfo, traceArgs);
+	}
 	m_gl.programUniformMatrix2x3dv(program, location, count, transpose, value);
 }
 
@@ -4499,6 +7589,11 @@ void CallLogWrapper::glProgramUniformMatrix2x3dvEXT (glw::GLuint program, glw::G
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glProgramUniformMatrix2x3dvEXT(" << program << ", " << location << ", " << count << ", " << getBooleanStr(transpose) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(value))) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(program), CallTrace::pack(location), CallTrace::pack(count), CallTrace::pack(transpose), CallTrace::pack(value) };
+		m_callTrace->record(s_glProgramUniformMatrix2x3dvEXTTraceInfo, traceArgs);
+	}
 	m_gl.programUniformMatrix2x3dvEXT(program, location, count, transpose, value);
 }
 
@@ -4506,6 +7601,11 @@ void CallLogWrapper::glProgramUniformMatrix2x3fv (glw::GLuint program, glw::GLin
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glProgramUniformMatrix2x3fv(" << program << ", " << location << ", " << count << ", " << getBooleanStr(transpose) << ", " << getPointerStr(value, (count * 2*3)) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(program), CallTrace::pack(location), CallTrace::pack(count), CallTrace::pack(transpose), CallTrace::pack(value) };
+		m_callTrace->record(s_glProgramUniformMatrix2x3fvTraceInfo, traceArgs);
+	}
 	m_gl.programUniformMatrix2x3fv(program, location, count, transpose, value);
 }
 
@@ -4513,6 +7613,11 @@ void CallLogWrapper::glProgramUniformMatrix2x4dv (glw::GLuint program, glw::GLin
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glProgramUniformMatrix2x4dv(" << program << ", " << location << ", " << count << ", " << getBooleanStr(transpose) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(value))) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(program), CallTrace::pack(location), CallTrace::pack(count), CallTrace::pack(transpose), CallTrace::pack(value) };
+		m_callTrace->record(s_glProgramUniformMatrix2x4dvTraceInfo, traceArgs);
+	}
 	m_gl.programUniformMatrix2x4dv(program, location, count, transpose, value);
 }
 
@@ -4520,6 +7625,11 @@ void CallLogWrapper::glProgramUniformMatrix2x4dvEXT (glw::GLuint program, glw::G
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glProgramUniformMatrix2x4dvEXT(" << program << ", " << location << ", " << count << ", " << getBooleanStr(transpose) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(value))) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(program), CallTrace::pack(location), CallTrace::pack(count), CallTrace::pack(transpose), CallTrace::pack(value) };
+		m_callTrace->record(s_glProgramUniformMatrix2x4dvEXTTraceInfo, traceArgs);
+	}
 	m_gl.programUniformMatrix2x4dvEXT(program, location, count, transpose, value);
 }
 
@@ -4527,6 +7637,11 @@ void CallLogWrapper::glProgramUniformMatrix2x4fv (glw::GLuint program, glw::GLin
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glProgramUniformMatrix2x4fv(" << program << ", " << location << ", " << count << ", " << getBooleanStr(transpose) << ", " << getPointerStr(value, (count * 2*4)) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(program), CallTrace::pack(location), CallTrace::pack(count), CallTrace::pack(transpose), CallTrace::pack(value) };
+		m_callTrace->record(s_glProgramUniformMatrix2x4fvTraceInfo, traceArgs);
+	}
 	m_gl.programUniformMatrix2x4fv(program, location, count, transpose, value);
 }
 
@@ -4534,6 +7649,11 @@ void CallLogWrapper::glProgramUniformMatrix3dv (glw::GLuint program, glw::GLint
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glProgramUniformMatrix3dv(" << program << ", " << location << ", " << count << ", " << getBooleanStr(transpose) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(value))) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(program), CallTrace::pack(location), CallTrace::pack(count), CallTrace::pack(transpose), CallTrace::pack(value) };
+		m_callTrace->record(s_glProgramUniformMatrix3dvTraceInfo, traceArgs);
+	}
 	m_gl.programUniformMatrix3dv(program, location, count, transpose, value);
 }
 
@@ -4541,6 +7661,11 @@ void CallLogWrapper::glProgramUniformMatrix3dvEXT (glw::GLuint program, glw::GLi
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glProgramUniformMatrix3dvEXT(" << program << ", " << location << ", " << count << ", " << getBooleanStr(transpose) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(value))) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(program), CallTrace::pack(location), CallTrace::pack(count), CallTrace::pack(transpose), CallTrace::pack(value) };
+		m_callTrace->record(s_glProgramUniformMatrix3dvEXTTraceInfo, traceArgs);
+	}
 	m_gl.programUniformMatrix3dvEXT(program, location, count, transpose, value);
 }
 
@@ -4548,6 +7673,11 @@ void CallLogWrapper::glProgramUniformMatrix3fv (glw::GLuint program, glw::GLint
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glProgramUniformMatrix3fv(" << program << ", " << location << ", " << count << ", " << getBooleanStr(transpose) << ", " << getPointerStr(value, (count * 3*3)) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(program), CallTrace::pack(location), CallTrace::pack(count), CallTrace::pack(transpose), CallTrace::pack(value) };
+		m_callTrace->record(s_glProgramUniformMatrix3fvTraceInfo, traceArgs);
+	}
 	m_gl.programUniformMatrix3fv(program, location, count, transpose, value);
 }
 
@@ -4555,6 +7685,11 @@ void CallLogWrapper::glProgramUniformMatrix3x2dv (glw::GLuint program, glw::GLin
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glProgramUniformMatrix3x2dv(" << program << ", " << location << ", " << count << ", " << getBooleanStr(transpose) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(value))) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(program), CallTrace::pack(location), CallTrace::pack(count), CallTrace::pack(transpose), CallTrace::pack(value) };
+		m_callTrace->record(s_glProgramUniformMatrix3x2dvTraceInfo, traceArgs);
+	}
 	m_gl.programUniformMatrix3x2dv(program, location, count, transpose, value);
 }
 
@@ -4562,6 +7697,11 @@ void CallLogWrapper::glProgramUniformMatrix3x2dvEXT (glw::GLuint program, glw::G
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glProgramUniformMatrix3x2dvEXT(" << program << ", " << location << ", " << count << ", " << getBooleanStr(transpose) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(value))) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(program), CallTrace::pack(location), CallTrace::pack(count), CallTrace::pack(transpose), CallTrace::pack(value) };
+		m_callTrace->record(s_glProgramUniformMatrix3x2dvEXTTraceInfo, traceArgs);
+	}
 	m_gl.programUniformMatrix3x2dvEXT(program, location, count, transpose, value);
 }
 
@@ -4569,6 +7709,11 @@ void CallLogWrapper::glProgramUniformMatrix3x2fv (glw::GLuint program, glw::GLin
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glProgramUniformMatrix3x2fv(" << program << ", " << location << ", " << count << ", " << getBooleanStr(transpose) << ", " << getPointerStr(value, (count * 3*2)) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(program), CallTrace::pack(location), CallTrace::pack(count), CallTrace::pack(transpose), CallTrace::pack(value) };
+		m_callTrace->record(s_glProgramUniformMatrix3x2fvTraceInfo, traceArgs);
+	}
 	m_gl.programUniformMatrix3x2fv(program, location, count, transpose, value);
 }
 
@@ -4576,6 +7721,11 @@ void CallLogWrapper::glProgramUniformMatrix3x4dv (glw::GLuint program, glw::GLin
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glProgramUniformMatrix3x4dv(" << program << ", " << location << ", " << count << ", " << getBooleanStr(transpose) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(value))) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(program), CallTrace::pack(location), CallTrace::pack(count), CallTrace::pack(transpose), CallTrace::pack(value) };
+		m_callTrace->record(s_glProgramUniformMatrix3x4dvTraceInfo, traceArgs);
+	}
 	m_gl.programUniformMatrix3x4dv(program, location, count, transpose, value);
 }
 
@@ -4583,6 +7733,11 @@ void CallLogWrapper::glProgramUniformMatrix3x4dvEXT (glw::GLuint program, glw::G
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glProgramUniformMatrix3x4dvEXT(" << program << ", " << location << ", " << count << ", " << getBooleanStr(transpose) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(value))) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(program), CallTrace::pack(location), CallTrace::pack(count), CallTrace::pack(transpose), CallTrace::pack(value) };
+		m_callTrace->record(s_glProgramUniformMatrix3x4dvEXTTraceInfo, traceArgs);
+	}
 	m_gl.programUniformMatrix3x4dvEXT(program, location, count, transpose, value);
 }
 
@@ -4590,6 +7745,11 @@ void CallLogWrapper::glProgramUniformMatrix3x4fv (glw::GLuint program, glw::GLin
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glProgramUniformMatrix3x4fv(" << program << ", " << location << ", " << count << ", " << getBooleanStr(transpose) << ", " << getPointerStr(value, (count * 3*4)) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(program), CallTrace::pack(location), CallTrace::pack(count), CallTrace::pack(transpose), CallTrace::pack(value) };
+		m_callTrace->record(s_glProgramUniformMatrix3x4fvTraceInfo, traceArgs);
+	}
 	m_gl.programUniformMatrix3x4fv(program, location, count, transpose, value);
 }
 
@@ -4597,6 +7757,11 @@ void CallLogWrapper::glProgramUniformMatrix4dv (glw::GLuint program, glw::GLint
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glProgramUniformMatrix4dv(" << program << ", " << location << ", " << count << ", " << getBooleanStr(transpose) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(value))) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(program), CallTrace::pack(location), CallTrace::pack(count), CallTrace::pack(transpose), CallTrace::pack(value) };
+		m_callTrace->record(s_glProgramUniformMatrix4dvTraceInfo, traceArgs);
+	}
 	m_gl.programUniformMatrix4dv(program, location, count, transpose, value);
 }
 
@@ -4604,6 +7769,11 @@ void CallLogWrapper::glProgramUniformMatrix4dvEXT (glw::GLuint program, glw::GLi
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glProgramUniformMatrix4dvEXT(" << program << ", " << location << ", " << count << ", " << getBooleanStr(transpose) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(value))) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(program), CallTrace::pack(location), CallTrace::pack(count), CallTrace::pack(transpose), CallTrace::pack(value) };
+		m_callTrace->record(s_glProgramUniformMatrix4dvEXTTraceInfo, traceArgs);
+	}
 	m_gl.programUniformMatrix4dvEXT(program, location, count, transpose, value);
 }
 
@@ -4611,6 +7781,11 @@ void CallLogWrapper::glProgramUniformMatrix4fv (glw::GLuint program, glw::GLint
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glProgramUniformMatrix4fv(" << program << ", " << location << ", " << count << ", " << getBooleanStr(transpose) << ", " << getPointerStr(value, (count * 4*4)) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(program), CallTrace::pack(location), CallTrace::pack(count), CallTrace::pack(transpose), CallTrace::pack(value) };
+		m_callTrace->record(s_glProgramUniformMatrix4fvTraceInfo, traceArgs);
+	}
 	m_gl.programUniformMatrix4fv(program, location, count, transpose, value);
 }
 
@@ -4618,6 +7793,11 @@ void CallLogWrapper::glProgramUniformMatrix4x2dv (glw::GLuint program, glw::GLin
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glProgramUniformMatrix4x2dv(" << program << ", " << location << ", " << count << ", " << getBooleanStr(transpose) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(value))) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(program), CallTrace::pack(location), CallTrace::pack(count), CallTrace::pack(transpose), CallTrace::pack(value) };
+		m_callTrace->record(s_glProgramUniformMatrix4x2dvTraceInfo, traceArgs);
+	}
 	m_gl.programUniformMatrix4x2dv(program, location, count, transpose, value);
 }
 
@@ -4625,6 +7805,11 @@ void CallLogWrapper::glProgramUniformMatrix4x2dvEXT (glw::GLuint program, glw::G
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glProgramUniformMatrix4x2dvEXT(" << program << ", " << location << ", " << count << ", " << getBooleanStr(transpose) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(value))) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(program), CallTrace::pack(location), CallTrace::pack(count), CallTrace::pack(transpose), CallTrace::pack(value) };
+		m_callTrace->record(s_glProgramUniformMatrix4x2dvEXTTraceInfo, traceArgs);
+	}
 	m_gl.programUniformMatrix4x2dvEXT(program, location, count, transpose, value);
 }
 
@@ -4632,6 +7817,11 @@ void CallLogWrapper::glProgramUniformMatrix4x2fv (glw::GLuint program, glw::GLin
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glProgramUniformMatrix4x2fv(" << program << ", " << location << ", " << count << ", " << getBooleanStr(transpose) << ", " << getPointerStr(value, (count * 4*2)) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(program), CallTrace::pack(location), CallTrace::pack(count), CallTrace::pack(transpose), CallTrace::pack(value) };
+		m_callTrace->record(s_glProgramUniformMatrix4x2fvTraceInfo, traceArgs);
+	}
 	m_gl.programUniformMatrix4x2fv(program, location, count, transpose, value);
 }
 
@@ -4639,6 +7829,11 @@ void CallLogWrapper::glProgramUniformMatrix4x3dv (glw::GLuint program, glw::GLin
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glProgramUniformMatrix4x3dv(" << program << ", " << location << ", " << count << ", " << getBooleanStr(transpose) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(value))) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(program), CallTrace::pack(location), CallTrace::pack(count), CallTrace::pack(transpose), CallTrace::pack(value) };
+		m_callTrace->record(s_glProgramUniformMatrix4x3dvTraceInfo, traceArgs);
+	}
 	m_gl.programUniformMatrix4x3dv(program, location, count, transpose, value);
 }
 
@@ -4646,6 +7841,11 @@ void CallLogWrapper::glProgramUniformMatrix4x3dvEXT (glw::GLuint program, glw::G
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glProgramUniformMatrix4x3dvEXT(" << program << ", " << location << ", " << count << ", " << getBooleanStr(transpose) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(value))) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(program), CallTrace::pack(location), CallTrace::pack(count), CallTrace::pack(transpose), CallTrace::pack(value) };
+		m_callTrace->record(s_glProgramUniformMatrix4x3dvEXTTraceInfo, traceArgs);
+	}
 	m_gl.programUniformMatrix4x3dvEXT(program, location, count, transpose, value);
 }
 
@@ -4653,6 +7853,11 @@ void CallLogWrapper::glProgramUniformMatrix4x3fv (glw::GLuint program, glw::GLin
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glProgramUniformMatrix4x3fv(" << program << ", " << location << ", " << count << ", " << getBooleanStr(transpose) << ", " << getPointerStr(value, (count * 4*3)) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(program), CallTrace::pack(location), CallTrace::pack(count), CallTrace::pack(transpose), CallTrace::pack(value) };
+		m_callTrace->record(s_glProgramUniformMatrix4x3fvTraceInfo, traceArgs);
+	}
 	m_gl.programUniformMatrix4x3fv(program, location, count, transpose, value);
 }
 
@@ -4660,6 +7865,11 @@ void CallLogWrapper::glProvokingVertex (glw::GLenum mode)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glProvokingVertex(" << getProvokingVertexStr(mode) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(mode) };
+		m_callTrace->record(s_glProvokingVertexTraceInfo, traceArgs);
+	}
 	m_gl.provokingVertex(mode);
 }
 
@@ -4667,6 +7877,11 @@ void CallLogWrapper::glPushClientAttribDefaultEXT (glw::GLbitfield mask)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glPushClientAttribDefaultEXT(" << toHex(mask) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(mask) };
+		m_callTrace->record(s_glPushClientAttribDefaultEXTTraceInfo, traceArgs);
+	}
 	m_gl.pushClientAttribDefaultEXT(mask);
 }
 
@@ -4674,6 +7889,11 @@ void CallLogWrapper::glPushDebugGroup (glw::GLenum source, glw::GLuint id, glw::
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glPushDebugGroup(" << getDebugMessageSourceStr(source) << ", " << id << ", " << length << ", " << getStringStr(message) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(source), CallTrace::pack(id), CallTrace::pack(length), CallTrace::pack(message) };
+		m_callTrace->record(s_glPushDebugGroupTraceInfo, traceArgs);
+	}
 	m_gl.pushDebugGroup(source, id, length, message);
 }
 
@@ -4681,6 +7901,11 @@ void CallLogWrapper::glPushGroupMarkerEXT (glw::GLsizei length, const glw::GLcha
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glPushGroupMarkerEXT(" << length << ", " << getStringStr(marker) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(length), CallTrace::pack(marker) };
+		m_callTrace->record(s_glPushGroupMarkerEXTTraceInfo, traceArgs);
+	}
 	m_gl.pushGroupMarkerEXT(length, marker);
 }
 
@@ -4688,6 +7913,11 @@ void CallLogWrapper::glQueryCounter (glw::GLuint id, glw::GLenum target)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glQueryCounter(" << id << ", " << toHex(target) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(id), CallTrace::pack(target) };
+		m_callTrace->record(s_glQueryCounterTraceInfo, traceArgs);
+	}
 	m_gl.queryCounter(id, target);
 }
 
@@ -4695,6 +7925,11 @@ void CallLogWrapper::glReadBuffer (glw::GLenum src)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glReadBuffer(" << getDrawReadBufferStr(src) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(src) };
+		m_callTrace->record(s_glReadBufferTraceInfo, traceArgs);
+	}
 	m_gl.readBuffer(src);
 }
 
@@ -4702,6 +7937,11 @@ void CallLogWrapper::glReadPixels (glw::GLint x, glw::GLint y, glw::GLsizei widt
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glReadPixels(" << x << ", " << y << ", " << width << ", " << height << ", " << getUncompressedTextureFormatStr(format) << ", " << getTypeStr(type) << ", " << pixels << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(x), CallTrace::pack(y), CallTrace::pack(width), CallTrace::pack(height), CallTrace::pack(format), CallTrace::pack(type), CallTrace::pack(pixels) };
+		m_callTrace->record(s_glReadPixelsTraceInfo, traceArgs);
+	}
 	m_gl.readPixels(x, y, width, height, format, type, pixels);
 }
 
@@ -4709,6 +7949,11 @@ void CallLogWrapper::glReadnPixels (glw::GLint x, glw::GLint y, glw::GLsizei wid
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glReadnPixels(" << x << ", " << y << ", " << width << ", " << height << ", " << toHex(format) << ", " << toHex(type) << ", " << bufSize << ", " << data << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(x), CallTrace::pack(y), CallTrace::pack(width), CallTrace::pack(height), CallTrace::pack(format), CallTrace::pack(type), CallTrace::pack(bufSize), CallTrace::pack(data) };
+		m_callTrace->record(s_glReadnPixelsTraceInfo, traceArgs);
+	}
 	m_gl.readnPixels(x, y, width, height, format, type, bufSize, data);
 }
 
@@ -4716,6 +7961,8 @@ void CallLogWrapper::glReleaseShaderCompiler (void)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glReleaseShaderCompiler(" << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+		m_callTrace->record(s_glReleaseShaderCompilerTraceInfo, DE_NULL);
 	m_gl.releaseShaderCompiler();
 }
 
@@ -4723,6 +7970,11 @@ void CallLogWrapper::glRenderGpuMaskNV (glw::GLbitfield mask)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glRenderGpuMaskNV(" << toHex(mask) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(mask) };
+		m_callTrace->record(s_glRenderGpuMaskNVTraceInfo, traceArgs);
+	}
 	m_gl.renderGpuMaskNV(mask);
 }
 
@@ -4730,6 +7982,11 @@ void CallLogWrapper::glRenderbufferStorage (glw::GLenum target, glw::GLenum inte
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glRenderbufferStorage(" << getFramebufferTargetStr(target) << ", " << getUncompressedTextureFormatStr(internalformat) << ", " << width << ", " << height << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(target), CallTrace::pack(internalformat), CallTrace::pack(width), CallTrace::pack(height) };
+		m_callTrace->record(s_glRenderbufferStorageTraceInfo, traceArgs);
+	}
 	m_gl.renderbufferStorage(target, internalformat, width, height);
 }
 
@@ -4737,6 +7994,11 @@ void CallLogWrapper::glRenderbufferStorageMultisample (glw::GLenum target, glw::
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glRenderbufferStorageMultisample(" << getFramebufferTargetStr(target) << ", " << samples << ", " << getUncompressedTextureFormatStr(internalformat) << ", " << width << ", " << height << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(target), CallTrace::pack(samples), CallTrace::pack(internalformat), CallTrace::pack(width), CallTrace::pack(height) };
+		m_callTrace->record(s_glRenderbufferStorageMultisampleTraceInfo, traceArgs);
+	}
 	m_gl.renderbufferStorageMultisample(target, samples, internalformat, width, height);
 }
 
@@ -4744,6 +8006,8 @@ void CallLogWrapper::glResumeTransformFeedback (void)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glResumeTransformFeedback(" << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+		m_callTrace->record(s_glResumeTransformFeedbackTraceInfo, DE_NULL);
 	m_gl.resumeTransformFeedback();
 }
 
@@ -4751,6 +8015,11 @@ void CallLogWrapper::glSampleCoverage (glw::GLfloat value, glw::GLboolean invert
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glSampleCoverage(" << value << ", " << getBooleanStr(invert) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(value), CallTrace::pack(invert) };
+		m_callTrace->record(s_glSampleCoverageTraceInfo, traceArgs);
+	}
 	m_gl.sampleCoverage(value, invert);
 }
 
@@ -4758,6 +8027,11 @@ void CallLogWrapper::glSampleMaski (glw::GLuint maskNumber, glw::GLbitfield mask
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glSampleMaski(" << maskNumber << ", " << toHex(mask) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(maskNumber), CallTrace::pack(mask) };
+		m_callTrace->record(s_glSampleMaskiTraceInfo, traceArgs);
+	}
 	m_gl.sampleMaski(maskNumber, mask);
 }
 
@@ -4765,6 +8039,11 @@ void CallLogWrapper::glSamplerParameterIiv (glw::GLuint sampler, glw::GLenum pna
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glSamplerParameterIiv(" << sampler << ", " << getTextureParameterStr(pname) << ", " << getPointerStr(param, getTextureParamNumArgs(pname)) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(sampler), CallTrace::pack(pname), CallTrace::pack(param) };
+		m_callTrace->record(s_glSamplerParameterIivTraceInfo, traceArgs);
+	}
 	m_gl.samplerParameterIiv(sampler, pname, param);
 }
 
@@ -4772,6 +8051,11 @@ void CallLogWrapper::glSamplerParameterIuiv (glw::GLuint sampler, glw::GLenum pn
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glSamplerParameterIuiv(" << sampler << ", " << getTextureParameterStr(pname) << ", " << getPointerStr(param, getTextureParamNumArgs(pname)) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(sampler), CallTrace::pack(pname), CallTrace::pack(param) };
+		m_callTrace->record(s_glSamplerParameterIuivTraceInfo, traceArgs);
+	}
 	m_gl.samplerParameterIuiv(sampler, pname, param);
 }
 
@@ -4779,6 +8063,11 @@ void CallLogWrapper::glSamplerParameterf (glw::GLuint sampler, glw::GLenum pname
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glSamplerParameterf(" << sampler << ", " << getTextureParameterStr(pname) << ", " << param << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(sampler), CallTrace::pack(pname), CallTrace::pack(param) };
+		m_callTrace->record(s_glSamplerParameterfTraceInfo, traceArgs);
+	}
 	m_gl.samplerParameterf(sampler, pname, param);
 }
 
@@ -4786,6 +8075,11 @@ void CallLogWrapper::glSamplerParameterfv (glw::GLuint sampler, glw::GLenum pnam
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glSamplerParameterfv(" << sampler << ", " << getTextureParameterStr(pname) << ", " << getPointerStr(param, getTextureParamNumArgs(pname)) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(sampler), CallTrace::pack(pname), CallTrace::pack(param) };
+		m_callTrace->record(s_glSamplerParameterfvTraceInfo, traceArgs);
+	}
 	m_gl.samplerParameterfv(sampler, pname, param);
 }
 
@@ -4793,6 +8087,11 @@ void CallLogWrapper::glSamplerParameteri (glw::GLuint sampler, glw::GLenum pname
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glSamplerParameteri(" << sampler << ", " << getTextureParameterStr(pname) << ", " << getTextureParameterValueStr(pname, param) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(sampler), CallTrace::pack(pname), CallTrace::pack(param) };
+		m_callTrace->record(s_glSamplerParameteriTraceInfo, traceArgs);
+	}
 	m_gl.samplerParameteri(sampler, pname, param);
 }
 
@@ -4800,6 +8099,11 @@ void CallLogWrapper::glSamplerParameteriv (glw::GLuint sampler, glw::GLenum pnam
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glSamplerParameteriv(" << sampler << ", " << getTextureParameterStr(pname) << ", " << getPointerStr(param, getTextureParamNumArgs(pname)) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(sampler), CallTrace::pack(pname), CallTrace::pack(param) };
+		m_callTrace->record(s_glSamplerParameterivTraceInfo, traceArgs);
+	}
 	m_gl.samplerParameteriv(sampler, pname, param);
 }
 
@@ -4807,6 +8111,11 @@ void CallLogWrapper::glScissor (glw::GLint x, glw::GLint y, glw::GLsizei width,
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glScissor(" << x << ", " << y << ", " << width << ", " << height << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(x), CallTrace::pack(y), CallTrace::pack(width), CallTrace::pack(height) };
+		m_callTrace->record(s_glScissorTraceInfo, traceArgs);
+	}
 	m_gl.scissor(x, y, width, height);
 }
 
@@ -4814,6 +8123,11 @@ void CallLogWrapper::glScissorArrayv (glw::GLuint first, glw::GLsizei count, con
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glScissorArrayv(" << first << ", " << count << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(v))) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(first), CallTrace::pack(count), CallTrace::pack(v) };
+		m_callTrace->record(s_glScissorArrayvTraceInfo, traceArgs);
+	}
 	m_gl.scissorArrayv(first, count, v);
 }
 
@@ -4821,6 +8135,11 @@ void CallLogWrapper::glScissorIndexed (glw::GLuint index, glw::GLint left, glw::
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glScissorIndexed(" << index << ", " << left << ", " << bottom << ", " << width << ", " << height << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(index), CallTrace::pack(left), CallTrace::pack(bottom), CallTrace::pack(width), CallTrace::pack(height) };
+		m_callTrace->record(s_glScissorIndexedTraceInfo, traceArgs);
+	}
 	m_gl.scissorIndexed(index, left, bottom, width, height);
 }
 
@@ -4828,6 +8147,11 @@ void CallLogWrapper::glScissorIndexedv (glw::GLuint index, const glw::GLint *v)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glScissorIndexedv(" << index << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(v))) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(index), CallTrace::pack(v) };
+		m_callTrace->record(s_glScissorIndexedvTraceInfo, traceArgs);
+	}
 	m_gl.scissorIndexedv(index, v);
 }
 
@@ -4835,6 +8159,11 @@ void CallLogWrapper::glShaderBinary (glw::GLsizei count, const glw::GLuint *shad
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glShaderBinary(" << count << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(shaders))) << ", " << toHex(binaryformat) << ", " << binary << ", " << length << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(count), CallTrace::pack(shaders), CallTrace::pack(binaryformat), CallTrace::pack(binary), CallTrace::pack(length) };
+		m_callTrace->record(s_glShaderBinaryTraceInfo, traceArgs);
+	}
 	m_gl.shaderBinary(count, shaders, binaryformat, binary, length);
 }
 
@@ -4842,6 +8171,11 @@ void CallLogWrapper::glShaderSource (glw::GLuint shader, glw::GLsizei count, con
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glShaderSource(" << shader << ", " << count << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(string))) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(length))) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(shader), CallTrace::pack(count), CallTrace::pack(string), CallTrace::pack(length) };
+		m_callTrace->record(s_glShaderSourceTraceInfo, traceArgs);
+	}
 	m_gl.shaderSource(shader, count, string, length);
 }
 
@@ -4849,6 +8183,11 @@ void CallLogWrapper::glShaderStorageBlockBinding (glw::GLuint program, glw::GLui
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glShaderStorageBlockBinding(" << program << ", " << storageBlockIndex << ", " << storageBlockBinding << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(program), CallTrace::pack(storageBlockIndex), CallTrace::pack(storageBlockBinding) };
+		m_callTrace->record(s_glShaderStorageBlockBindingTraceInfo, traceArgs);
+	}
 	m_gl.shaderStorageBlockBinding(program, storageBlockIndex, storageBlockBinding);
 }
 
@@ -4856,6 +8195,11 @@ void CallLogWrapper::glSpecializeShader (glw::GLuint shader, const glw::GLchar *
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glSpecializeShader(" << shader << ", " << getStringStr(pEntryPoint) << ", " << numSpecializationConstants << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(pConstantIndex))) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(pConstantValue))) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(shader), CallTrace::pack(pEntryPoint), CallTrace::pack(numSpecializationConstants), CallTrace::pack(pConstantIndex), CallTrace::pack(pConstantValue) };
+		m_callTrace->record(s_glSpecializeShaderTraceInfo, traceArgs);
+	}
 	m_gl.specializeShader(shader, pEntryPoint, numSpecializationConstants, pConstantIndex, pConstantValue);
 }
 
@@ -4863,6 +8207,11 @@ void CallLogWrapper::glStencilFunc (glw::GLenum func, glw::GLint ref, glw::GLuin
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glStencilFunc(" << getCompareFuncStr(func) << ", " << ref << ", " << mask << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(func), CallTrace::pack(ref), CallTrace::pack(mask) };
+		m_callTrace->record(s_glStencilFuncTraceInfo, traceArgs);
+	}
 	m_gl.stencilFunc(func, ref, mask);
 }
 
@@ -4870,6 +8219,11 @@ void CallLogWrapper::glStencilFuncSeparate (glw::GLenum face, glw::GLenum func,
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glStencilFuncSeparate(" << getFaceStr(face) << ", " << getCompareFuncStr(func) << ", " << ref << ", " << mask << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(face), CallTrace::pack(func), CallTrace::pack(ref), CallTrace::pack(mask) };
+		m_callTrace->record(s_glStencilFuncSeparateTraceInfo, traceArgs);
+	}
 	m_gl.stencilFuncSeparate(face, func, ref, mask);
 }
 
@@ -4877,6 +8231,11 @@ void CallLogWrapper::glStencilMask (glw::GLuint mask)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glStencilMask(" << mask << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(mask) };
+		m_callTrace->record(s_glStencilMaskTraceInfo, traceArgs);
+	}
 	m_gl.stencilMask(mask);
 }
 
@@ -4884,6 +8243,11 @@ void CallLogWrapper::glStencilMaskSeparate (glw::GLenum face, glw::GLuint mask)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glStencilMaskSeparate(" << getFaceStr(face) << ", " << mask << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(face), CallTrace::pack(mask) };
+		m_callTrace->record(s_glStencilMaskSeparateTraceInfo, traceArgs);
+	}
 	m_gl.stencilMaskSeparate(face, mask);
 }
 
@@ -4891,6 +8255,11 @@ void CallLogWrapper::glStencilOp (glw::GLenum fail, glw::GLenum zfail, glw::GLen
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glStencilOp(" << getStencilOpStr(fail) << ", " << getStencilOpStr(zfail) << ", " << getStencilOpStr(zpass) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(fail), CallTrace::pack(zfail), CallTrace::pack(zpass) };
+		m_callTrace->record(s_glStencilOpTraceInfo, traceArgs);
+	}
 	m_gl.stencilOp(fail, zfail, zpass);
 }
 
@@ -4898,6 +8267,11 @@ void CallLogWrapper::glStencilOpSeparate (glw::GLenum face, glw::GLenum sfail, g
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glStencilOpSeparate(" << getFaceStr(face) << ", " << getStencilOpStr(sfail) << ", " << getStencilOpStr(dpfail) << ", " << getStencilOpStr(dppass) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(face), CallTrace::pack(sfail), CallTrace::pack(dpfail), CallTrace::pack(dppass) };
+		m_callTrace->record(s_glStencilOpSeparateTraceInfo, traceArgs);
+	}
 	m_gl.stencilOpSeparate(face, sfail, dpfail, dppass);
 }
 
@@ -4905,6 +8279,11 @@ void CallLogWrapper::glTexBuffer (glw::GLenum target, glw::GLenum internalformat
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glTexBuffer(" << getBufferTargetStr(target) << ", " << getUncompressedTextureFormatStr(internalformat) << ", " << buffer << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(target), CallTrace::pack(internalformat), CallTrace::pack(buffer) };
+		m_callTrace->record(s_glTexBufferTraceInfo, traceArgs);
+	}
 	m_gl.texBuffer(target, internalformat, buffer);
 }
 
@@ -4912,6 +8291,11 @@ void CallLogWrapper::glTexBufferRange (glw::GLenum target, glw::GLenum internalf
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glTexBufferRange(" << getBufferTargetStr(target) << ", " << getUncompressedTextureFormatStr(internalformat) << ", " << buffer << ", " << offset << ", " << size << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(target), CallTrace::pack(internalformat), CallTrace::pack(buffer), CallTrace::pack(offset), CallTrace::pack(size) };
+		m_callTrace->record(s_glTexBufferRangeTraceInfo, traceArgs);
+	}
 	m_gl.texBufferRange(target, internalformat, buffer, offset, size);
 }
 
@@ -4919,6 +8303,11 @@ void CallLogWrapper::glTexImage1D (glw::GLenum target, glw::GLint level, glw::GL
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glTexImage1D(" << getTextureTargetStr(target) << ", " << level << ", " << getUncompressedTextureFormatStr(internalformat) << ", " << width << ", " << border << ", " << getUncompressedTextureFormatStr(format) << ", " << getTypeStr(type) << ", " << pixels << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(target), CallTrace::pack(level), CallTrace::pack(internalformat), CallTrace::pack(width), CallTrace::pack(border), CallTrace::pack(format), CallTrace::pack(type), CallTrace::pack(pixels) };
+		m_callTrace->record(s_glTexImage1DTraceInfo, traceArgs);
+	}
 	m_gl.texImage1D(target, level, internalformat, width, border, format, type, pixels);
 }
 
@@ -4926,6 +8315,11 @@ void CallLogWrapper::glTexImage2D (glw::GLenum target, glw::GLint level, glw::GL
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glTexImage2D(" << getTextureTargetStr(target) << ", " << level << ", " << getUncompressedTextureFormatStr(internalformat) << ", " << width << ", " << height << ", " << border << ", " << getUncompressedTextureFormatStr(format) << ", " << getTypeStr(type) << ", " << pixels << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(target), CallTrace::pack(level), CallTrace::pack(internalformat), CallTrace::pack(width), CallTrace::pack(height), CallTrace::pack(border), CallTrace::pack(format), CallTrace::pack(type), CallTrace::pack(pixels) };
+		m_callTrace->record(s_glTexImage2DTraceInfo, traceArgs);
+	}
 	m_gl.texImage2D(target, level, internalformat, width, height, border, format, type, pixels);
 }
 
@@ -4933,6 +8327,11 @@ void CallLogWrapper::glTexImage2DMultisample (glw::GLenum target, glw::GLsizei s
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glTexImage2DMultisample(" << getTextureTargetStr(target) << ", " << samples << ", " << getUncompressedTextureFormatStr(internalformat) << ", " << width << ", " << height << ", " << getBooleanStr(fixedsamplelocations) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(target), CallTrace::pack(samples), CallTrace::pack(internalformat), CallTrace::pack(width), CallTrace::pack(height), CallTrace::pack(fixedsamplelocations) };
+		m_callTrace->record(s_glTexImage2DMultisampleTraceInfo, traceArgs);
+	}
 	m_gl.texImage2DMultisample(target, samples, internalformat, width, height, fixedsamplelocations);
 }
 
@@ -4940,6 +8339,11 @@ void CallLogWrapper::glTexImage3D (glw::GLenum target, glw::GLint level, glw::GL
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glTexImage3D(" << getTextureTargetStr(target) << ", " << level << ", " << getUncompressedTextureFormatStr(internalformat) << ", " << width << ", " << height << ", " << depth << ", " << border << ", " << getUncompressedTextureFormatStr(format) << ", " << getTypeStr(type) << ", " << pixels << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(target), CallTrace::pack(level), CallTrace::pack(internalformat), CallTrace::pack(width), CallTrace::pack(height), CallTrace::pack(depth), CallTrace::pack(border), CallTrace::pack(format), CallTrace::pack(type), CallTrace::pack(pixels) };
+		m_callTrace->record(s_glTexImage3DTraceInfo, traceArgs);
+	}
 	m_gl.texImage3D(target, level, internalformat, width, height, depth, border, format, type, pixels);
 }
 
@@ -4947,6 +8351,11 @@ void CallLogWrapper::glTexImage3DMultisample (glw::GLenum target, glw::GLsizei s
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glTexImage3DMultisample(" << toHex(target) << ", " << samples << ", " << toHex(internalformat) << ", " << width << ", " << height << ", " << depth << ", " << getBooleanStr(fixedsamplelocations) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(target), CallTrace::pack(samples), CallTrace::pack(internalformat), CallTrace::pack(width), CallTrace::pack(height), CallTrace::pack(depth), CallTrace::pack(fixedsamplelocations) };
+		m_callTrace->record(s_glTexImage3DMultisampleTraceInfo, traceArgs);
+	}
 	m_gl.texImage3DMultisample(target, samples, internalformat, width, height, depth, fixedsamplelocations);
 }
 
@@ -4954,6 +8363,11 @@ void CallLogWrapper::glTexImage3DOES (glw::GLenum target, glw::GLint level, glw:
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glTexImage3DOES(" << toHex(target) << ", " << level << ", " << toHex(internalformat) << ", " << width << ", " << height << ", " << depth << ", " << border << ", " << toHex(format) << ", " << toHex(type) << ", " << pixels << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(target), CallTrace::pack(level), CallTrace::pack(internalformat), CallTrace::pack(width), CallTrace::pack(height), CallTrace::pack(depth), CallTrace::pack(border), CallTrace::pack(format), CallTrace::pack(type), CallTrace::pack(pixels) };
+		m_callTrace->record(s_glTexImage3DOESTraceInfo, traceArgs);
+	}
 	m_gl.texImage3DOES(target, level, internalformat, width, height, depth, border, format, type, pixels);
 }
 
@@ -4961,6 +8375,11 @@ void CallLogWrapper::glTexPageCommitmentARB (glw::GLenum target, glw::GLint leve
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glTexPageCommitmentARB(" << toHex(target) << ", " << level << ", " << xoffset << ", " << yoffset << ", " << zoffset << ", " << width << ", " << height << ", " << depth << ", " << getBooleanStr(commit) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(target), CallTrace::pack(level), CallTrace::pack(xoffset), CallTrace::pack(yoffset), CallTrace::pack(zoffset), CallTrace::pack(width), CallTrace::pack(height), CallTrace::pack(depth), CallTrace::pack(commit) };
+		m_callTrace->record(s_glTexPageCommitmentARBTraceInfo, traceArgs);
+	}
 	m_gl.texPageCommitmentARB(target, level, xoffset, yoffset, zoffset, width, height, depth, commit);
 }
 
@@ -4968,6 +8387,11 @@ void CallLogWrapper::glTexParameterIiv (glw::GLenum target, glw::GLenum pname, c
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glTexParameterIiv(" << getTextureTargetStr(target) << ", " << getTextureParameterStr(pname) << ", " << getPointerStr(params, getTextureParamNumArgs(pname)) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(target), CallTrace::pack(pname), CallTrace::pack(params) };
+		m_callTrace->record(s_glTexParameterIivTraceInfo, traceArgs);
+	}
 	m_gl.texParameterIiv(target, pname, params);
 }
 
@@ -4975,6 +8399,11 @@ void CallLogWrapper::glTexParameterIuiv (glw::GLenum target, glw::GLenum pname,
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glTexParameterIuiv(" << getTextureTargetStr(target) << ", " << getTextureParameterStr(pname) << ", " << getPointerStr(params, getTextureParamNumArgs(pname)) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(target), CallTrace::pack(pname), CallTrace::pack(params) };
+		m_callTrace->record(s_glTexParameterIuivTraceInfo, traceArgs);
+	}
 	m_gl.texParameterIuiv(target, pname, params);
 }
 
@@ -4982,6 +8411,11 @@ void CallLogWrapper::glTexParameterf (glw::GLenum target, glw::GLenum pname, glw
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glTexParameterf(" << getTextureTargetStr(target) << ", " << getTextureParameterStr(pname) << ", " << param << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(target), CallTrace::pack(pname), CallTrace::pack(param) };
+		m_callTrace->record(s_glTexParameterfTraceInfo, traceArgs);
+	}
 	m_gl.texParameterf(target, pname, param);
 }
 
@@ -4989,6 +8423,11 @@ void CallLogWrapper::glTexParameterfv (glw::GLenum target, glw::GLenum pname, co
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glTexParameterfv(" << getTextureTargetStr(target) << ", " << getTextureParameterStr(pname) << ", " << getPointerStr(params, getTextureParamNumArgs(pname)) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(target), CallTrace::pack(pname), CallTrace::pack(params) };
+		m_callTrace->record(s_glTexParameterfvTraceInfo, traceArgs);
+	}
 	m_gl.texParameterfv(target, pname, params);
 }
 
@@ -4996,6 +8435,11 @@ void CallLogWrapper::glTexParameteri (glw::GLenum target, glw::GLenum pname, glw
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glTexParameteri(" << getTextureTargetStr(target) << ", " << getTextureParameterStr(pname) << ", " << getTextureParameterValueStr(pname, param) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(target), CallTrace::pack(pname), CallTrace::pack(param) };
+		m_callTrace->record(s_glTexParameteriTraceInfo, traceArgs);
+	}
 	m_gl.texParameteri(target, pname, param);
 }
 
@@ -5003,6 +8447,11 @@ void CallLogWrapper::glTexParameteriv (glw::GLenum target, glw::GLenum pname, co
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glTexParameteriv(" << getTextureTargetStr(target) << ", " << getTextureParameterStr(pname) << ", " << getPointerStr(params, getTextureParamNumArgs(pname)) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(target), CallTrace::pack(pname), CallTrace::pack(params) };
+		m_callTrace->record(s_glTexParameterivTraceInfo, traceArgs);
+	}
 	m_gl.texParameteriv(target, pname, params);
 }
 
@@ -5010,6 +8459,11 @@ void CallLogWrapper::glTexStorage1D (glw::GLenum target, glw::GLsizei levels, gl
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glTexStorage1D(" << toHex(target) << ", " << levels << ", " << toHex(internalformat) << ", " << width << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(target), CallTrace::pack(levels), CallTrace::pack(internalformat), CallTrace::pack(width) };
+		m_callTrace->record(s_glTexStorage1DTraceInfo, traceArgs);
+	}
 	m_gl.texStorage1D(target, levels, internalformat, width);
 }
 
@@ -5017,6 +8471,11 @@ void CallLogWrapper::glTexStorage2D (glw::GLenum target, glw::GLsizei levels, gl
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glTexStorage2D(" << getTextureTargetStr(target) << ", " << levels << ", " << getTextureFormatStr(internalformat) << ", " << width << ", " << height << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(target), CallTrace::pack(levels), CallTrace::pack(internalformat), CallTrace::pack(width), CallTrace::pack(height) };
+		m_callTrace->record(s_glTexStorage2DTraceInfo, traceArgs);
+	}
 	m_gl.texStorage2D(target, levels, internalformat, width, height);
 }
 
@@ -5024,6 +8483,11 @@ void CallLogWrapper::glTexStorage2DMultisample (glw::GLenum target, glw::GLsizei
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glTexStorage2DMultisample(" << getTextureTargetStr(target) << ", " << samples << ", " << getUncompressedTextureFormatStr(internalformat) << ", " << width << ", " << height << ", " << getBooleanStr(fixedsamplelocations) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(target), CallTrace::pack(samples), CallTrace::pack(internalformat), CallTrace::pack(width), CallTrace::pack(height), CallTrace::pack(fixedsamplelocations) };
+		m_callTrace->record(s_glTexStorage2DMultisampleTraceInfo, traceArgs);
+	}
 	m_gl.texStorage2DMultisample(target, samples, internalformat, width, height, fixedsamplelocations);
 }
 
@@ -5031,6 +8495,11 @@ void CallLogWrapper::glTexStorage3D (glw::GLenum target, glw::GLsizei levels, gl
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glTexStorage3D(" << getTextureTargetStr(target) << ", " << levels << ", " << getTextureFormatStr(internalformat) << ", " << width << ", " << height << ", " << depth << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(target), CallTrace::pack(levels), CallTrace::pack(internalformat), CallTrace::pack(width), CallTrace::pack(height), CallTrace::pack(depth) };
+		m_callTrace->record(s_glTexStorage3DTraceInfo, traceArgs);
+	}
 	m_gl.texStorage3D(target, levels, internalformat, width, height, depth);
 }
 
@@ -5038,6 +8507,11 @@ void CallLogWrapper::glTexStorage3DMultisample (glw::GLenum target, glw::GLsizei
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glTexStorage3DMultisample(" << getTextureTargetStr(target) << ", " << samples << ", " << getUncompressedTextureFormatStr(internalformat) << ", " << width << ", " << height << ", " << depth << ", " << getBooleanStr(fixedsamplelocations) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(target), CallTrace::pack(samples), CallTrace::pack(internalformat), CallTrace::pack(width), CallTrace::pack(height), CallTrace::pack(depth), CallTrace::pack(fixedsamplelocations) };
+		m_callTrace->record(s_glTexStorage3DMultisampleTraceInfo, traceArgs);
+	}
 	m_gl.texStorage3DMultisample(target, samples, internalformat, width, height, depth, fixedsamplelocations);
 }
 
@@ -5045,6 +8519,11 @@ void CallLogWrapper::glTexSubImage1D (glw::GLenum target, glw::GLint level, glw:
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glTexSubImage1D(" << getTextureTargetStr(target) << ", " << level << ", " << xoffset << ", " << width << ", " << getUncompressedTextureFormatStr(format) << ", " << getTypeStr(type) << ", " << pixels << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(target), CallTrace::pack(level), CallTrace::pack(xoffset), CallTrace::pack(width), CallTrace::pack(format), CallTrace::pack(type), CallTrace::pack(pixels) };
+		m_callTrace->record(s_glTexSubImage1DTraceInfo, traceArgs);
+	}
 	m_gl.texSubImage1D(target, level, xoffset, width, format, type, pixels);
 }
 
@@ -5052,6 +8531,11 @@ void CallLogWrapper::glTexSubImage2D (glw::GLenum target, glw::GLint level, glw:
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glTexSubImage2D(" << getTextureTargetStr(target) << ", " << level << ", " << xoffset << ", " << yoffset << ", " << width << ", " << height << ", " << getUncompressedTextureFormatStr(format) << ", " << getTypeStr(type) << ", " << pixels << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(target), CallTrace::pack(level), CallTrace::pack(xoffset), CallTrace::pack(yoffset), CallTrace::pack(width), CallTrace::pack(height), CallTrace::pack(format), CallTrace::pack(type), CallTrace::pack(pixels) };
+		m_callTrace->record(s_glTexSubImage2DTraceInfo, traceArgs);
+	}
 	m_gl.texSubImage2D(target, level, xoffset, yoffset, width, height, format, type, pixels);
 }
 
@@ -5059,6 +8543,11 @@ void CallLogWrapper::glTexSubImage3D (glw::GLenum target, glw::GLint level, glw:
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glTexSubImage3D(" << getTextureTargetStr(target) << ", " << level << ", " << xoffset << ", " << yoffset << ", " << zoffset << ", " << width << ", " << height << ", " << depth << ", " << getUncompressedTextureFormatStr(format) << ", " << getTypeStr(type) << ", " << pixels << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(target), CallTrace::pack(level), CallTrace::pack(xoffset), CallTrace::pack(yoffset), CallTrace::pack(zoffset), CallTrace::pack(width), CallTrace::pack(height), CallTrace::pack(depth), CallTrace::pack(format), CallTrace::pack(type), CallTrace::pack(pixels) };
+		m_callTrace->record(s_glTexSubImage3DTraceInfo, traceArgs);
+	}
 	m_gl.texSubImage3D(target, level, xoffset, yoffset, zoffset, width, height, depth, format, type, pixels);
 }
 
@@ -5066,6 +8555,11 @@ void CallLogWrapper::glTexSubImage3DOES (glw::GLenum target, glw::GLint level, g
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glTexSubImage3DOES(" << toHex(target) << ", " << level << ", " << xoffset << ", " << yoffset << ", " << zoffset << ", " << width << ", " << height << ", " << depth << ", " << toHex(format) << ", " << toHex(type) << ", " << pixels << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(target), CallTrace::pack(level), CallTrace::pack(xoffset), CallTrace::pack(yoffset), CallTrace::pack(zoffset), CallTrace::pack(width), CallTrace::pack(height), CallTrace::pack(depth), CallTrace::pack(format), CallTrace::pack(type), CallTrace::pack(pixels) };
+		m_callTrace->record(s_glTexSubImage3DOESTraceInfo, traceArgs);
+	}
 	m_gl.texSubImage3DOES(target, level, xoffset, yoffset, zoffset, width, height, depth, format, type, pixels);
 }
 
@@ -5073,6 +8567,8 @@ void CallLogWrapper::glTextureBarrier (void)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glTextureBarrier(" << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+		m_callTrace->record(s_glTextureBarrierTraceInfo, DE_NULL);
 	m_gl.textureBarrier();
 }
 
@@ -5080,6 +8576,11 @@ void CallLogWrapper::glTextureBuffer (glw::GLuint texture, glw::GLenum internalf
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glTextureBuffer(" << texture << ", " << toHex(internalformat) << ", " << buffer << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(texture), CallTrace::pack(internalformat), CallTrace::pack(buffer) };
+		m_callTrace->record(s_glTextureBufferTraceInfo, traceArgs);
+	}
 	m_gl.textureBuffer(texture, internalformat, buffer);
 }
 
@@ -5087,6 +8588,11 @@ void CallLogWrapper::glTextureBufferEXT (glw::GLuint texture, glw::GLenum target
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glTextureBufferEXT(" << texture << ", " << toHex(target) << ", " << toHex(internalformat) << ", " << buffer << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(texture), CallTrace::pack(target), CallTrace::pack(internalformat), CallTrace::pack(buffer) };
+		m_callTrace->record(s_glTextureBufferEXTTraceInfo, traceArgs);
+	}
 	m_gl.textureBufferEXT(texture, target, internalformat, buffer);
 }
 
@@ -5094,6 +8600,11 @@ void CallLogWrapper::glTextureBufferRange (glw::GLuint texture, glw::GLenum inte
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glTextureBufferRange(" << texture << ", " << toHex(internalformat) << ", " << buffer << ", " << offset << ", " << size << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(texture), CallTrace::pack(internalformat), CallTrace::pack(buffer), CallTrace::pack(offset), CallTrace::pack(size) };
+		m_callTrace->record(s_glTextureBufferRangeTraceInfo, traceArgs);
+	}
 	m_gl.textureBufferRange(texture, internalformat, buffer, offset, size);
 }
 
@@ -5101,6 +8612,11 @@ void CallLogWrapper::glTextureBufferRangeEXT (glw::GLuint texture, glw::GLenum t
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glTextureBufferRangeEXT(" << texture << ", " << toHex(target) << ", " << toHex(internalformat) << ", " << buffer << ", " << offset << ", " << size << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(texture), CallTrace::pack(target), CallTrace::pack(internalformat), CallTrace::pack(buffer), CallTrace::pack(offset), CallTrace::pack(size) };
+		m_callTrace->record(s_glTextureBufferRangeEXTTraceInfo, traceArgs);
+	}
 	m_gl.textureBufferRangeEXT(texture, target, internalformat, buffer, offset, size);
 }
 
@@ -5108,6 +8624,11 @@ void CallLogWrapper::glTextureImage1DEXT (glw::GLuint texture, glw::GLenum targe
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glTextureImage1DEXT(" << texture << ", " << toHex(target) << ", " << level << ", " << internalformat << ", " << width << ", " << border << ", " << toHex(format) << ", " << toHex(type) << ", " << pixels << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(texture), CallTrace::pack(target), CallTrace::pack(level), CallTrace::pack(internalformat), CallTrace::pack(width), CallTrace::pack(border), CallTrace::pack(format), CallTrace::pack(type), CallTrace::pack(pixels) };
+		m_callTrace->record(s_glTextureImage1DEXTTraceInfo, traceArgs);
+	}
 	m_gl.textureImage1DEXT(texture, target, level, internalformat, width, border, format, type, pixels);
 }
 
@@ -5115,6 +8636,11 @@ void CallLogWrapper::glTextureImage2DEXT (glw::GLuint texture, glw::GLenum targe
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glTextureImage2DEXT(" << texture << ", " << toHex(target) << ", " << level << ", " << internalformat << ", " << width << ", " << height << ", " << border << ", " << toHex(format) << ", " << toHex(type) << ", " << pixels << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(texture), CallTrace::pack(target), CallTrace::pack(level), CallTrace::pack(internalformat), CallTrace::pack(width), CallTrace::pack(height), CallTrace::pack(border), CallTrace::pack(format), CallTrace::pack(type), CallTrace::pack(pixels) };
+		m_callTrace->record(s_glTextureImage2DEXTTraceInfo, traceArgs);
+	}
 	m_gl.textureImage2DEXT(texture, target, level, internalformat, width, height, border, format, type, pixels);
 }
 
@@ -5122,6 +8648,11 @@ void CallLogWrapper::glTextureImage3DEXT (glw::GLuint texture, glw::GLenum targe
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glTextureImage3DEXT(" << texture << ", " << toHex(target) << ", " << level << ", " << internalformat << ", " << width << ", " << height << ", " << depth << ", " << border << ", " << toHex(format) << ", " << toHex(type) << ", " << pixels << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(texture), CallTrace::pack(target), CallTrace::pack(level), CallTrace::pack(internalformat), CallTrace::pack(width), CallTrace::pack(height), CallTrace::pack(depth), CallTrace::pack(border), CallTrace::pack(format), CallTrace::pack(type), CallTrace::pack(pixels) };
+		m_callTrace->record(s_glTextureImage3DEXTTraceInfo, traceArgs);
+	}
 	m_gl.textureImage3DEXT(texture, target, level, internalformat, width, height, depth, border, format, type, pixels);
 }
 
@@ -5129,6 +8660,11 @@ void CallLogWrapper::glTexturePageCommitmentEXT (glw::GLuint texture, glw::GLint
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glTexturePageCommitmentEXT(" << texture << ", " << level << ", " << xoffset << ", " << yoffset << ", " << zoffset << ", " << width << ", " << height << ", " << depth << ", " << getBooleanStr(commit) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(texture), CallTrace::pack(level), CallTrace::pack(xoffset), CallTrace::pack(yoffset), CallTrace::pack(zoffset), CallTrace::pack(width), CallTrace::pack(height), CallTrace::pack(depth), CallTrace::pack(commit) };
+		m_callTrace->record(s_glTexturePageCommitmentEXTTraceInfo, traceArgs);
+	}
 	m_gl.texturePageCommitmentEXT(texture, level, xoffset, yoffset, zoffset, width, height, depth, commit);
 }
 
@@ -5136,6 +8672,11 @@ void CallLogWrapper::glTextureParameterIiv (glw::GLuint texture, glw::GLenum pna
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glTextureParameterIiv(" << texture << ", " << toHex(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(texture), CallTrace::pack(pname), CallTrace::pack(params) };
+		m_callTrace->record(s_glTextureParameterIivTraceInfo, traceArgs);
+	}
 	m_gl.textureParameterIiv(texture, pname, params);
 }
 
@@ -5143,6 +8684,11 @@ void CallLogWrapper::glTextureParameterIivEXT (glw::GLuint texture, glw::GLenum
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glTextureParameterIivEXT(" << texture << ", " << toHex(target) << ", " << toHex(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(texture), CallTrace::pack(target), CallTrace::pack(pname), CallTrace::pack(params) };
+		m_callTrace->record(s_glTextureParameterIivEXTTraceInfo, traceArgs);
+	}
 	m_gl.textureParameterIivEXT(texture, target, pname, params);
 }
 
@@ -5150,6 +8696,11 @@ void CallLogWrapper::glTextureParameterIuiv (glw::GLuint texture, glw::GLenum pn
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glTextureParameterIuiv(" << texture << ", " << toHex(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(texture), CallTrace::pack(pname), CallTrace::pack(params) };
+		m_callTrace->record(s_glTextureParameterIuivTraceInfo, traceArgs);
+	}
 	m_gl.textureParameterIuiv(texture, pname, params);
 }
 
@@ -5157,6 +8708,11 @@ void CallLogWrapper::glTextureParameterIuivEXT (glw::GLuint texture, glw::GLenum
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glTextureParameterIuivEXT(" << texture << ", " << toHex(target) << ", " << toHex(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(texture), CallTrace::pack(target), CallTrace::pack(pname), CallTrace::pack(params) };
+		m_callTrace->record(s_glTextureParameterIuivEXTTraceInfo, traceArgs);
+	}
 	m_gl.textureParameterIuivEXT(texture, target, pname, params);
 }
 
@@ -5164,6 +8720,11 @@ void CallLogWrapper::glTextureParameterf (glw::GLuint texture, glw::GLenum pname
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glTextureParameterf(" << texture << ", " << toHex(pname) << ", " << param << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(texture), CallTrace::pack(pname), CallTrace::pack(param) };
+		m_callTrace->record(s_glTextureParameterfTraceInfo, traceArgs);
+	}
 	m_gl.textureParameterf(texture, pname, param);
 }
 
@@ -5171,6 +8732,11 @@ void CallLogWrapper::glTextureParameterfEXT (glw::GLuint texture, glw::GLenum ta
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glTextureParameterfEXT(" << texture << ", " << toHex(target) << ", " << toHex(pname) << ", " << param << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(texture), CallTrace::pack(target), CallTrace::pack(pname), CallTrace::pack(param) };
+		m_callTrace->record(s_glTextureParameterfEXTTraceInfo, traceArgs);
+	}
 	m_gl.textureParameterfEXT(texture, target, pname, param);
 }
 
@@ -5178,6 +8744,11 @@ void CallLogWrapper::glTextureParameterfv (glw::GLuint texture, glw::GLenum pnam
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glTextureParameterfv(" << texture << ", " << toHex(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(param))) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(texture), CallTrace::pack(pname), CallTrace::pack(param) };
+		m_callTrace->record(s_glTextureParameterfvTraceInfo, traceArgs);
+	}
 	m_gl.textureParameterfv(texture, pname, param);
 }
 
@@ -5185,6 +8756,11 @@ void CallLogWrapper::glTextureParameterfvEXT (glw::GLuint texture, glw::GLenum t
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glTextureParameterfvEXT(" << texture << ", " << toHex(target) << ", " << toHex(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(texture), CallTrace::pack(target), CallTrace::pack(pname), CallTrace::pack(params) };
+		m_callTrace->record(s_glTextureParameterfvEXTTraceInfo, traceArgs);
+	}
 	m_gl.textureParameterfvEXT(texture, target, pname, params);
 }
 
@@ -5192,6 +8768,11 @@ void CallLogWrapper::glTextureParameteri (glw::GLuint texture, glw::GLenum pname
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glTextureParameteri(" << texture << ", " << toHex(pname) << ", " << param << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(texture), CallTrace::pack(pname), CallTrace::pack(param) };
+		m_callTrace->record(s_glTextureParameteriTraceInfo, traceArgs);
+	}
 	m_gl.textureParameteri(texture, pname, param);
 }
 
@@ -5199,6 +8780,11 @@ void CallLogWrapper::glTextureParameteriEXT (glw::GLuint texture, glw::GLenum ta
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glTextureParameteriEXT(" << texture << ", " << toHex(target) << ", " << toHex(pname) << ", " << param << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(texture), CallTrace::pack(target), CallTrace::pack(pname), CallTrace::pack(param) };
+		m_callTrace->record(s_glTextureParameteriEXTTraceInfo, traceArgs);
+	}
 	m_gl.textureParameteriEXT(texture, target, pname, param);
 }
 
@@ -5206,6 +8792,11 @@ void CallLogWrapper::glTextureParameteriv (glw::GLuint texture, glw::GLenum pnam
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glTextureParameteriv(" << texture << ", " << toHex(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(param))) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(texture), CallTrace::pack(pname), CallTrace::pack(param) };
+		m_callTrace->record(s_glTextureParameterivTraceInfo, traceArgs);
+	}
 	m_gl.textureParameteriv(texture, pname, param);
 }
 
@@ -5213,6 +8804,11 @@ void CallLogWrapper::glTextureParameterivEXT (glw::GLuint texture, glw::GLenum t
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glTextureParameterivEXT(" << texture << ", " << toHex(target) << ", " << toHex(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(texture), CallTrace::pack(target), CallTrace::pack(pname), CallTrace::pack(params) };
+		m_callTrace->record(s_glTextureParameterivEXTTraceInfo, traceArgs);
+	}
 	m_gl.textureParameterivEXT(texture, target, pname, params);
 }
 
@@ -5220,6 +8816,11 @@ void CallLogWrapper::glTextureRenderbufferEXT (glw::GLuint texture, glw::GLenum
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glTextureRenderbufferEXT(" << texture << ", " << toHex(target) << ", " << renderbuffer << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(texture), CallTrace::pack(target), CallTrace::pack(renderbuffer) };
+		m_callTrace->record(s_glTextureRenderbufferEXTTraceInfo, traceArgs);
+	}
 	m_gl.textureRenderbufferEXT(texture, target, renderbuffer);
 }
 
@@ -5227,6 +8828,11 @@ void CallLogWrapper::glTextureStorage1D (glw::GLuint texture, glw::GLsizei level
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glTextureStorage1D(" << texture << ", " << levels << ", " << toHex(internalformat) << ", " << width << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(texture), CallTrace::pack(levels), CallTrace::pack(internalformat), CallTrace::pack(width) };
+		m_callTrace->record(s_glTextureStorage1DTraceInfo, traceArgs);
+	}
 	m_gl.textureStorage1D(texture, levels, internalformat, width);
 }
 
@@ -5234,6 +8840,11 @@ void CallLogWrapper::glTextureStorage1DEXT (glw::GLuint texture, glw::GLenum tar
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glTextureStorage1DEXT(" << texture << ", " << toHex(target) << ", " << levels << ", " << toHex(internalformat) << ", " << width << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(texture), CallTrace::pack(target), CallTrace::pack(levels), CallTrace::pack(internalformat), CallTrace::pack(width) };
+		m_callTrace->record(s_glTextureStorage1DEXTTraceInfo, traceArgs);
+	}
 	m_gl.textureStorage1DEXT(texture, target, levels, internalformat, width);
 }
 
@@ -5241,6 +8852,11 @@ void CallLogWrapper::glTextureStorage2D (glw::GLuint texture, glw::GLsizei level
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glTextureStorage2D(" << texture << ", " << levels << ", " << toHex(internalformat) << ", " << width << ", " << height << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(texture), CallTrace::pack(levels), CallTrace::pack(internalformat), CallTrace::pack(width), CallTrace::pack(height) };
+		m_callTrace->record(s_glTextureStorage2DTraceInfo, traceArgs);
+	}
 	m_gl.textureStorage2D(texture, levels, internalformat, width, height);
 }
 
@@ -5248,6 +8864,11 @@ void CallLogWrapper::glTextureStorage2DEXT (glw::GLuint texture, glw::GLenum tar
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glTextureStorage2DEXT(" << texture << ", " << toHex(target) << ", " << levels << ", " << toHex(internalformat) << ", " << width << ", " << height << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(texture), CallTrace::pack(target), CallTrace::pack(levels), CallTrace::pack(internalformat), CallTrace::pack(width), CallTrace::pack(height) };
+		m_callTrace->record(s_glTextureStorage2DEXTTraceInfo, traceArgs);
+	}
 	m_gl.textureStorage2DEXT(texture, target, levels, internalformat, width, height);
 }
 
@@ -5255,6 +8876,11 @@ void CallLogWrapper::glTextureStorage2DMultisample (glw::GLuint texture, glw::GL
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glTextureStorage2DMultisample(" << texture << ", " << samples << ", " << toHex(internalformat) << ", " << width << ", " << height << ", " << getBooleanStr(fixedsamplelocations) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(texture), CallTrace::pack(samples), CallTrace::pack(internalformat), CallTrace::pack(width), CallTrace::pack(height), CallTrace::pack(fixedsamplelocations) };
+		m_callTrace->record(s_glTextureStorage2DMultisampleTraceInfo, traceArgs);
+	}
 	m_gl.textureStorage2DMultisample(texture, samples, internalformat, width, height, fixedsamplelocations);
 }
 
@@ -5262,6 +8888,11 @@ void CallLogWrapper::glTextureStorage2DMultisampleEXT (glw::GLuint texture, glw:
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glTextureStorage2DMultisampleEXT(" << texture << ", " << toHex(target) << ", " << samples << ", " << toHex(internalformat) << ", " << width << ", " << height << ", " << getBooleanStr(fixedsamplelocations) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(texture), CallTrace::pack(target), CallTrace::pack(samples), CallTrace::pack(internalformat), CallTrace::pack(width), CallTrace::pack(height), CallTrace::pack(fixedsamplelocations) };
+		m_callTrace->record(s_glTextureStorage2DMultisampleEXTTraceInfo, traceArgs);
+	}
 	m_gl.textureStorage2DMultisampleEXT(texture, target, samples, internalformat, width, height, fixedsamplelocations);
 }
 
@@ -5269,6 +8900,11 @@ void CallLogWrapper::glTextureStorage3D (glw::GLuint texture, glw::GLsizei level
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glTextureStorage3D(" << texture << ", " << levels << ", " << toHex(internalformat) << ", " << width << ", " << height << ", " << depth << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(texture), CallTrace::pack(levels), CallTrace::pack(internalformat), CallTrace::pack(width), CallTrace::pack(height), CallTrace::pack(depth) };
+		m_callTrace->record(s_glTextureStorage3DTraceInfo, traceArgs);
+	}
 	m_gl.textureStorage3D(texture, levels, internalformat, width, height, depth);
 }
 
@@ -5276,6 +8912,11 @@ void CallLogWrapper::glTextureStorage3DEXT (glw::GLuint texture, glw::GLenum tar
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glTextureStorage3DEXT(" << texture << ", " << toHex(target) << ", " << levels << ", " << toHex(internalformat) << ", " << width << ", " << height << ", " << depth << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(texture), CallTrace::pack(target), CallTrace::pack(levels), CallTrace::pack(internalformat), CallTrace::pack(width), CallTrace::pack(height), CallTrace::pack(depth) };
+		m_callTrace->record(s_glTextureStorage3DEXTTraceInfo, traceArgs);
+	}
 	m_gl.textureStorage3DEXT(texture, target, levels, internalformat, width, height, depth);
 }
 
@@ -5283,6 +8924,11 @@ void CallLogWrapper::glTextureStorage3DMultisample (glw::GLuint texture, glw::GL
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glTextureStorage3DMultisample(" << texture << ", " << samples << ", " << toHex(internalformat) << ", " << width << ", " << height << ", " << depth << ", " << getBooleanStr(fixedsamplelocations) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(texture), CallTrace::pack(samples), CallTrace::pack(internalformat), CallTrace::pack(width), CallTrace::pack(height), CallTrace::pack(depth), CallTrace::pack(fixedsamplelocations) };
+		m_callTrace->record(s_glTextureStorage3DMultisampleTraceInfo, traceArgs);
+	}
 	m_gl.textureStorage3DMultisample(texture, samples, internalformat, width, height, depth, fixedsamplelocations);
 }
 
@@ -5290,6 +8936,11 @@ void CallLogWrapper::glTextureStorage3DMultisampleEXT (glw::GLuint texture, glw:
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glTextureStorage3DMultisampleEXT(" << texture << ", " << toHex(target) << ", " << samples << ", " << toHex(internalformat) << ", " << width << ", " << height << ", " << depth << ", " << getBooleanStr(fixedsamplelocations) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(texture), CallTrace::pack(target), CallTrace::pack(samples), CallTrace::pack(internalformat), CallTrace::pack(width), CallTrace::pack(height), CallTrace::pack(depth), CallTrace::pack(fixedsamplelocations) };
+		m_callTrace->record(s_glTextureStorage3DMultisampleEXTTraceInfo, traceArgs);
+	}
 	m_gl.textureStorage3DMultisampleEXT(texture, target, samples, internalformat, width, height, depth, fixedsamplelocations);
 }
 
@@ -5297,6 +8948,11 @@ void CallLogWrapper::glTextureSubImage1D (glw::GLuint texture, glw::GLint level,
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glTextureSubImage1D(" << texture << ", " << level << ", " << xoffset << ", " << width << ", " << toHex(format) << ", " << toHex(type) << ", " << pixels << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(texture), CallTrace::pack(level), CallTrace::pack(xoffset), CallTrace::pack(width), CallTrace::pack(format), CallTrace::pack(type), CallTrace::pack(pixels) };
+		m_callTrace->record(s_glTextureSubImage1DTraceInfo, traceArgs);
+	}
 	m_gl.textureSubImage1D(texture, level, xoffset, width, format, type, pixels);
 }
 
@@ -5304,6 +8960,11 @@ void CallLogWrapper::glTextureSubImage1DEXT (glw::GLuint texture, glw::GLenum ta
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glTextureSubImage1DEXT(" << texture << ", " << toHex(target) << ", " << level << ", " << xoffset << ", " << width << ", " << toHex(format) << ", " << toHex(type) << ", " << pixels << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(texture), CallTrace::pack(target), CallTrace::pack(level), CallTrace::pack(xoffset), CallTrace::pack(width), CallTrace::pack(format), CallTrace::pack(type), CallTrace::pack(pixels) };
+		m_callTrace->record(s_glTextureSubImage1DEXTTraceInfo, traceArgs);
+	}
 	m_gl.textureSubImage1DEXT(texture, target, level, xoffset, width, format, type, pixels);
 }
 
@@ -5311,6 +8972,11 @@ void CallLogWrapper::glTextureSubImage2D (glw::GLuint texture, glw::GLint level,
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glTextureSubImage2D(" << texture << ", " << level << ", " << xoffset << ", " << yoffset << ", " << width << ", " << height << ", " << toHex(format) << ", " << toHex(type) << ", " << pixels << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(texture), CallTrace::pack(level), CallTrace::pack(xoffset), CallTrace::pack(yoffset), CallTrace::pack(width), CallTrace::pack(height), CallTrace::pack(format), CallTrace::pack(type), CallTrace::pack(pixels) };
+		m_callTrace->record(s_glTextureSubImage2DTraceInfo, traceArgs);
+	}
 	m_gl.textureSubImage2D(texture, level, xoffset, yoffset, width, height, format, type, pixels);
 }
 
@@ -5318,6 +8984,11 @@ void CallLogWrapper::glTextureSubImage2DEXT (glw::GLuint texture, glw::GLenum ta
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glTextureSubImage2DEXT(" << texture << ", " << toHex(target) << ", " << level << ", " << xoffset << ", " << yoffset << ", " << width << ", " << height << ", " << toHex(format) << ", " << toHex(type) << ", " << pixels << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(texture), CallTrace::pack(target), CallTrace::pack(level), CallTrace::pack(xoffset), CallTrace::pack(yoffset), CallTrace::pack(width), CallTrace::pack(height), CallTrace::pack(format), CallTrace::pack(type), CallTrace::pack(pixels) };
+		m_callTrace->record(s_glTextureSubImage2DEXTTraceInfo, traceArgs);
+	}
 	m_gl.textureSubImage2DEXT(texture, target, level, xoffset, yoffset, width, height, format, type, pixels);
 }
 
@@ -5325,6 +8996,11 @@ void CallLogWrapper::glTextureSubImage3D (glw::GLuint texture, glw::GLint level,
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glTextureSubImage3D(" << texture << ", " << level << ", " << xoffset << ", " << yoffset << ", " << zoffset << ", " << width << ", " << height << ", " << depth << ", " << toHex(format) << ", " << toHex(type) << ", " << pixels << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(texture), CallTrace::pack(level), CallTrace::pack(xoffset), CallTrace::pack(yoffset), CallTrace::pack(zoffset), CallTrace::pack(width), CallTrace::pack(height), CallTrace::pack(depth), CallTrace::pack(format), CallTrace::pack(type), CallTrace::pack(pixels) };
+		m_callTrace->record(s_glTextureSubImage3DTraceInfo, traceArgs);
+	}
 	m_gl.textureSubImage3D(texture, level, xoffset, yoffset, zoffset, width, height, depth, format, type, pixels);
 }
 
@@ -5332,6 +9008,11 @@ void CallLogWrapper::glTextureSubImage3DEXT (glw::GLuint texture, glw::GLenum ta
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glTextureSubImage3DEXT(" << texture << ", " << toHex(target) << ", " << level << ", " << xoffset << ", " << yoffset << ", " << zoffset << ", " << width << ", " << height << ", " << depth << ", " << toHex(format) << ", " << toHex(type) << ", " << pixels << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(texture), CallTrace::pack(target), CallTrace::pack(level), CallTrace::pack(xoffset), CallTrace::pack(yoffset), CallTrace::pack(zoffset), CallTrace::pack(width), CallTrace::pack(height), CallTrace::pack(depth), CallTrace::pack(format), CallTrace::pack(type), CallTrace::pack(pixels) };
+		m_callTrace->record(s_glTextureSubImage3DEXTTraceInfo, traceArgs);
+	}
 	m_gl.textureSubImage3DEXT(texture, target, level, xoffset, yoffset, zoffset, width, height, depth, format, type, pixels);
 }
 
@@ -5339,6 +9020,11 @@ void CallLogWrapper::glTextureView (glw::GLuint texture, glw::GLenum target, glw
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glTextureView(" << texture << ", " << toHex(target) << ", " << origtexture << ", " << toHex(internalformat) << ", " << minlevel << ", " << numlevels << ", " << minlayer << ", " << numlayers << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(texture), CallTrace::pack(target), CallTrace::pack(origtexture), CallTrace::pack(internalformat), CallTrace::pack(minlevel), CallTrace::pack(numlevels), CallTrace::pack(minlayer), CallTrace::pack(numlayers) };
+		m_callTrace->record(s_glTextureViewTraceInfo, traceArgs);
+	}
 	m_gl.textureView(texture, target, origtexture, internalformat, minlevel, numlevels, minlayer, numlayers);
 }
 
@@ -5346,6 +9032,11 @@ void CallLogWrapper::glTransformFeedbackBufferBase (glw::GLuint xfb, glw::GLuint
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glTransformFeedbackBufferBase(" << xfb << ", " << index << ", " << buffer << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(xfb), CallTrace::pack(index), CallTrace::pack(buffer) };
+		m_callTrace->record(s_glTransformFeedbackBufferBaseTraceInfo, traceArgs);
+	}
 	m_gl.transformFeedbackBufferBase(xfb, index, buffer);
 }
 
@@ -5353,6 +9044,11 @@ void CallLogWrapper::glTransformFeedbackBufferRange (glw::GLuint xfb, glw::GLuin
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glTransformFeedbackBufferRange(" << xfb << ", " << index << ", " << buffer << ", " << offset << ", " << size << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(xfb), CallTrace::pack(index), CallTrace::pack(buffer), CallTrace::pack(offset), CallTrace::pack(size) };
+		m_callTrace->record(s_glTransformFeedbackBufferRangeTraceInfo, traceArgs);
+	}
 	m_gl.transformFeedbackBufferRange(xfb, index, buffer, offset, size);
 }
 
@@ -5360,6 +9056,11 @@ void CallLogWrapper::glTransformFeedbackVaryings (glw::GLuint program, glw::GLsi
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glTransformFeedbackVaryings(" << program << ", " << count << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(varyings))) << ", " << toHex(bufferMode) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(program), CallTrace::pack(count), CallTrace::pack(varyings), CallTrace::pack(bufferMode) };
+		m_callTrace->record(s_glTransformFeedbackVaryingsTraceInfo, traceArgs);
+	}
 	m_gl.transformFeedbackVaryings(program, count, varyings, bufferMode);
 }
 
@@ -5367,6 +9068,11 @@ void CallLogWrapper::glUniform1d (glw::GLint location, glw::GLdouble x)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glUniform1d(" << location << ", " << x << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(location), CallTrace::pack(x) };
+		m_callTrace->record(s_glUniform1dTraceInfo, traceArgs);
+	}
 	m_gl.uniform1d(location, x);
 }
 
@@ -5374,6 +9080,11 @@ void CallLogWrapper::glUniform1dv (glw::GLint location, glw::GLsizei count, cons
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glUniform1dv(" << location << ", " << count << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(value))) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(location), CallTrace::pack(count), CallTrace::pack(value) };
+		m_callTrace->record(s_glUniform1dvTraceInfo, traceArgs);
+	}
 	m_gl.uniform1dv(location, count, value);
 }
 
@@ -5381,6 +9092,11 @@ void CallLogWrapper::glUniform1f (glw::GLint location, glw::GLfloat v0)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glUniform1f(" << location << ", " << v0 << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(location), CallTrace::pack(v0) };
+		m_callTrace->record(s_glUniform1fTraceInfo, traceArgs);
+	}
 	m_gl.uniform1f(location, v0);
 }
 
@@ -5388,6 +9104,11 @@ void CallLogWrapper::glUniform1fv (glw::GLint location, glw::GLsizei count, cons
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glUniform1fv(" << location << ", " << count << ", " << getPointerStr(value, (count * 1)) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(location), CallTrace::pack(count), CallTrace::pack(value) };
+		m_callTrace->record(s_glUniform1fvTraceInfo, traceArgs);
+	}
 	m_gl.uniform1fv(location, count, value);
 }
 
@@ -5395,6 +9116,11 @@ void CallLogWrapper::glUniform1i (glw::GLint location, glw::GLint v0)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glUniform1i(" << location << ", " << v0 << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(location), CallTrace::pack(v0) };
+		m_callTrace->record(s_glUniform1iTraceInfo, traceArgs);
+	}
 	m_gl.uniform1i(location, v0);
 }
 
@@ -5402,6 +9128,11 @@ void CallLogWrapper::glUniform1iv (glw::GLint location, glw::GLsizei count, cons
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glUniform1iv(" << location << ", " << count << ", " << getPointerStr(value, (count * 1)) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(location), CallTrace::pack(count), CallTrace::pack(value) };
+		m_callTrace->record(s_glUniform1ivTraceInfo, traceArgs);
+	}
 	m_gl.uniform1iv(location, count, value);
 }
 
@@ -5409,6 +9140,11 @@ void CallLogWrapper::glUniform1ui (glw::GLint location, glw::GLuint v0)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glUniform1ui(" << location << ", " << v0 << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(location), CallTrace::pack(v0) };
+		m_callTrace->record(s_glUniform1uiTraceInfo, traceArgs);
+	}
 	m_gl.uniform1ui(location, v0);
 }
 
@@ -5416,6 +9152,11 @@ void CallLogWrapper::glUniform1uiv (glw::GLint location, glw::GLsizei count, con
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glUniform1uiv(" << location << ", " << count << ", " << getPointerStr(value, (count * 1)) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(location), CallTrace::pack(count), CallTrace::pack(value) };
+		m_callTrace->record(s_glUniform1uivTraceInfo, traceArgs);
+	}
 	m_gl.uniform1uiv(location, count, value);
 }
 
@@ -5423,6 +9164,11 @@ void CallLogWrapper::glUniform2d (glw::GLint location, glw::GLdouble x, glw::GLd
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glUniform2d(" << location << ", " << x << ", " << y << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(location), CallTrace::pack(x), CallTrace::pack(y) };
+		m_callTrace->record(s_glUniform2dTraceInfo, traceArgs);
+	}
 	m_gl.uniform2d(location, x, y);
 }
 
@@ -5430,6 +9176,11 @@ void CallLogWrapper::glUniform2dv (glw::GLint location, glw::GLsizei count, cons
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glUniform2dv(" << location << ", " << count << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(value))) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(location), CallTrace::pack(count), CallTrace::pack(value) };
+		m_callTrace->record(s_glUniform2dvTraceInfo, traceArgs);
+	}
 	m_gl.uniform2dv(location, count, value);
 }
 
@@ -5437,6 +9188,11 @@ void CallLogWrapper::glUniform2f (glw::GLint location, glw::GLfloat v0, glw::GLf
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glUniform2f(" << location << ", " << v0 << ", " << v1 << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(location), CallTrace::pack(v0), CallTrace::pack(v1) };
+		m_callTrace->record(s_glUniform2fTraceInfo, traceArgs);
+	}
 	m_gl.uniform2f(location, v0, v1);
 }
 
@@ -5444,6 +9200,11 @@ void CallLogWrapper::glUniform2fv (glw::GLint location, glw::GLsizei count, cons
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glUniform2fv(" << location << ", " << count << ", " << getPointerStr(value, (count * 2)) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(location), CallTrace::pack(count), CallTrace::pack(value) };
+		m_callTrace->record(s_glUniform2fvTraceInfo, traceArgs);
+	}
 	m_gl.uniform2fv(location, count, value);
 }
 
@@ -5451,6 +9212,11 @@ void CallLogWrapper::glUniform2i (glw::GLint location, glw::GLint v0, glw::GLint
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glUniform2i(" << location << ", " << v0 << ", " << v1 << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(location), CallTrace::pack(v0), CallTrace::pack(v1) };
+		m_callTrace->record(s_glUniform2iTraceInfo, traceArgs);
+	}
 	m_gl.uniform2i(location, v0, v1);
 }
 
@@ -5458,6 +9224,11 @@ void CallLogWrapper::glUniform2iv (glw::GLint location, glw::GLsizei count, cons
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glUniform2iv(" << location << ", " << count << ", " << getPointerStr(value, (count * 2)) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(location), CallTrace::pack(count), CallTrace::pack(value) };
+		m_callTrace->record(s_glUniform2ivTraceInfo, traceArgs);
+	}
 	m_gl.uniform2iv(location, count, value);
 }
 
@@ -5465,6 +9236,11 @@ void CallLogWrapper::glUniform2ui (glw::GLint location, glw::GLuint v0, glw::GLu
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glUniform2ui(" << location << ", " << v0 << ", " << v1 << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(location), CallTrace::pack(v0), CallTrace::pack(v1) };
+		m_callTrace->record(s_glUniform2uiTraceInfo, traceArgs);
+	}
 	m_gl.uniform2ui(location, v0, v1);
 }
 
@@ -5472,6 +9248,11 @@ void CallLogWrapper::glUniform2uiv (glw::GLint location, glw::GLsizei count, con
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glUniform2uiv(" << location << ", " << count << ", " << getPointerStr(value, (count * 2)) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(location), CallTrace::pack(count), CallTrace::pack(value) };
+		m_callTrace->record(s_glUniform2uivTraceInfo, traceArgs);
+	}
 	m_gl.uniform2uiv(location, count, value);
 }
 
@@ -5479,6 +9260,11 @@ void CallLogWrapper::glUniform3d (glw::GLint location, glw::GLdouble x, glw::GLd
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glUniform3d(" << location << ", " << x << ", " << y << ", " << z << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(location), CallTrace::pack(x), CallTrace::pack(y), CallTrace::pack(z) };
+		m_callTrace->record(s_glUniform3dTraceInfo, traceArgs);
+	}
 	m_gl.uniform3d(location, x, y, z);
 }
 
@@ -5486,6 +9272,11 @@ void CallLogWrapper::glUniform3dv (glw::GLint location, glw::GLsizei count, cons
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glUniform3dv(" << location << ", " << count << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(value))) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(location), CallTrace::pack(count), CallTrace::pack(value) };
+		m_callTrace->record(s_glUniform3dvTraceInfo, traceArgs);
+	}
 	m_gl.uniform3dv(location, count, value);
 }
 
@@ -5493,6 +9284,11 @@ void CallLogWrapper::glUniform3f (glw::GLint location, glw::GLfloat v0, glw::GLf
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glUniform3f(" << location << ", " << v0 << ", " << v1 << ", " << v2 << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(location), CallTrace::pack(v0), CallTrace::pack(v1), CallTrace::pack(v2) };
+		m_callTrace->record(s_glUniform3fTraceInfo, traceArgs);
+	}
 	m_gl.uniform3f(location, v0, v1, v2);
 }
 
@@ -5500,6 +9296,11 @@ void CallLogWrapper::glUniform3fv (glw::GLint location, glw::GLsizei count, cons
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glUniform3fv(" << location << ", " << count << ", " << getPointerStr(value, (count * 3)) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(location), CallTrace::pack(count), CallTrace::pack(value) };
+		m_callTrace->record(s_glUniform3fvTraceInfo, traceArgs);
+	}
 	m_gl.uniform3fv(location, count, value);
 }
 
@@ -5507,6 +9308,11 @@ void CallLogWrapper::glUniform3i (glw::GLint location, glw::GLint v0, glw::GLint
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glUniform3i(" << location << ", " << v0 << ", " << v1 << ", " << v2 << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(location), CallTrace::pack(v0), CallTrace::pack(v1), CallTrace::pack(v2) };
+		m_callTrace->record(s_glUniform3iTraceInfo, traceArgs);
+	}
 	m_gl.uniform3i(location, v0, v1, v2);
 }
 
@@ -5514,6 +9320,11 @@ void CallLogWrapper::glUniform3iv (glw::GLint location, glw::GLsizei count, cons
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glUniform3iv(" << location << ", " << count << ", " << getPointerStr(value, (count * 3)) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(location), CallTrace::pack(count), CallTrace::pack(value) };
+		m_callTrace->record(s_glUniform3ivTraceInfo, traceArgs);
+	}
 	m_gl.uniform3iv(location, count, value);
 }
 
@@ -5521,6 +9332,11 @@ void CallLogWrapper::glUniform3ui (glw::GLint location, glw::GLuint v0, glw::GLu
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glUniform3ui(" << location << ", " << v0 << ", " << v1 << ", " << v2 << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(location), CallTrace::pack(v0), CallTrace::pack(v1), CallTrace::pack(v2) };
+		m_callTrace->record(s_glUniform3uiTraceInfo, traceArgs);
+	}
 	m_gl.uniform3ui(location, v0, v1, v2);
 }
 
@@ -5528,6 +9344,11 @@ void CallLogWrapper::glUniform3uiv (glw::GLint location, glw::GLsizei count, con
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glUniform3uiv(" << location << ", " << count << ", " << getPointerStr(value, (count * 3)) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(location), CallTrace::pack(count), CallTrace::pack(value) };
+		m_callTrace->record(s_glUniform3uivTraceInfo, traceArgs);
+	}
 	m_gl.uniform3uiv(location, count, value);
 }
 
@@ -5535,6 +9356,11 @@ void CallLogWrapper::glUniform4d (glw::GLint location, glw::GLdouble x, glw::GLd
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glUniform4d(" << location << ", " << x << ", " << y << ", " << z << ", " << w << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(location), CallTrace::pack(x), CallTrace::pack(y), CallTrace::pack(z), CallTrace::pack(w) };
+		m_callTrace->record(s_glUniform4dTraceInfo, traceArgs);
+	}
 	m_gl.uniform4d(location, x, y, z, w);
 }
 
@@ -5542,6 +9368,11 @@ void CallLogWrapper::glUniform4dv (glw::GLint location, glw::GLsizei count, cons
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glUniform4dv(" << location << ", " << count << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(value))) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(location), CallTrace::pack(count), CallTrace::pack(value) };
+		m_callTrace->record(s_glUniform4dvTraceInfo, traceArgs);
+	}
 	m_gl.uniform4dv(location, count, value);
 }
 
@@ -5549,6 +9380,11 @@ void CallLogWrapper::glUniform4f (glw::GLint location, glw::GLfloat v0, glw::GLf
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glUniform4f(" << location << ", " << v0 << ", " << v1 << ", " << v2 << ", " << v3 << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(location), CallTrace::pack(v0), CallTrace::pack(v1), CallTrace::pack(v2), CallTrace::pack(v3) };
+		m_callTrace->record(s_glUniform4fTraceInfo, traceArgs);
+	}
 	m_gl.uniform4f(location, v0, v1, v2, v3);
 }
 
@@ -5556,6 +9392,11 @@ void CallLogWrapper::glUniform4fv (glw::GLint location, glw::GLsizei count, cons
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glUniform4fv(" << location << ", " << count << ", " << getPointerStr(value, (count * 4)) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(location), CallTrace::pack(count), CallTrace::pack(value) };
+		m_callTrace->record(s_glUniform4fvTraceInfo, traceArgs);
+	}
 	m_gl.uniform4fv(location, count, value);
 }
 
@@ -5563,6 +9404,11 @@ void CallLogWrapper::glUniform4i (glw::GLint location, glw::GLint v0, glw::GLint
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glUniform4i(" << location << ", " << v0 << ", " << v1 << ", " << v2 << ", " << v3 << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(location), CallTrace::pack(v0), CallTrace::pack(v1), CallTrace::pack(v2), CallTrace::pack(v3) };
+		m_callTrace->record(s_glUniform4iTraceInfo, traceArgs);
+	}
 	m_gl.uniform4i(location, v0, v1, v2, v3);
 }
 
@@ -5570,6 +9416,11 @@ void CallLogWrapper::glUniform4iv (glw::GLint location, glw::GLsizei count, cons
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glUniform4iv(" << location << ", " << count << ", " << getPointerStr(value, (count * 4)) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(location), CallTrace::pack(count), CallTrace::pack(value) };
+		m_callTrace->record(s_glUniform4ivTraceInfo, traceArgs);
+	}
 	m_gl.uniform4iv(location, count, value);
 }
 
@@ -5577,6 +9428,11 @@ void CallLogWrapper::glUniform4ui (glw::GLint location, glw::GLuint v0, glw::GLu
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glUniform4ui(" << location << ", " << v0 << ", " << v1 << ", " << v2 << ", " << v3 << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(location), CallTrace::pack(v0), CallTrace::pack(v1), CallTrace::pack(v2), CallTrace::pack(v3) };
+		m_callTrace->record(s_glUniform4uiTraceInfo, traceArgs);
+	}
 	m_gl.uniform4ui(location, v0, v1, v2, v3);
 }
 
@@ -5584,6 +9440,11 @@ void CallLogWrapper::glUniform4uiv (glw::GLint location, glw::GLsizei count, con
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glUniform4uiv(" << location << ", " << count << ", " << getPointerStr(value, (count * 4)) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(location), CallTrace::pack(count), CallTrace::pack(value) };
+		m_callTrace->record(s_glUniform4uivTraceInfo, traceArgs);
+	}
 	m_gl.uniform4uiv(location, count, value);
 }
 
@@ -5591,6 +9452,11 @@ void CallLogWrapper::glUniformBlockBinding (glw::GLuint program, glw::GLuint uni
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glUniformBlockBinding(" << program << ", " << uniformBlockIndex << ", " << uniformBlockBinding << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(program), CallTrace::pack(uniformBlockIndex), CallTrace::pack(uniformBlockBinding) };
+		m_callTrace->record(s_glUniformBlockBindingTraceInfo, traceArgs);
+	}
 	m_gl.uniformBlockBinding(program, uniformBlockIndex, uniformBlockBinding);
 }
 
@@ -5598,6 +9464,11 @@ void CallLogWrapper::glUniformMatrix2dv (glw::GLint location, glw::GLsizei count
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glUniformMatrix2dv(" << location << ", " << count << ", " << getBooleanStr(transpose) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(value))) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(location), CallTrace::pack(count), CallTrace::pack(transpose), CallTrace::pack(value) };
+		m_callTrace->record(s_glUniformMatrix2dvTraceInfo, traceArgs);
+	}
 	m_gl.uniformMatrix2dv(location, count, transpose, value);
 }
 
@@ -5605,6 +9476,11 @@ void CallLogWrapper::glUniformMatrix2fv (glw::GLint location, glw::GLsizei count
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glUniformMatrix2fv(" << location << ", " << count << ", " << getBooleanStr(transpose) << ", " << getPointerStr(value, (count * 2*2)) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(location), CallTrace::pack(count), CallTrace::pack(transpose), CallTrace::pack(value) };
+		m_callTrace->record(s_glUniformMatrix2fvTraceInfo, traceArgs);
+	}
 	m_gl.uniformMatrix2fv(location, count, transpose, value);
 }
 
@@ -5612,6 +9488,11 @@ void CallLogWrapper::glUniformMatrix2x3dv (glw::GLint location, glw::GLsizei cou
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glUniformMatrix2x3dv(" << location << ", " << count << ", " << getBooleanStr(transpose) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(value))) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(location), CallTrace::pack(count), CallTrace::pack(transpose), CallTrace::pack(value) };
+		m_callTrace->record(s_glUniformMatrix2x3dvTraceInfo, traceArgs);
+	}
 	m_gl.uniformMatrix2x3dv(location, count, transpose, value);
 }
 
@@ -5619,6 +9500,11 @@ void CallLogWrapper::glUniformMatrix2x3fv (glw::GLint location, glw::GLsizei cou
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glUniformMatrix2x3fv(" << location << ", " << count << ", " << getBooleanStr(transpose) << ", " << getPointerStr(value, (count * 2*3)) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(location), CallTrace::pack(count), CallTrace::pack(transpose), CallTrace::pack(value) };
+		m_callTrace->record(s_glUniformMatrix2x3fvTraceInfo, traceArgs);
+	}
 	m_gl.uniformMatrix2x3fv(location, count, transpose, value);
 }
 
@@ -5626,6 +9512,11 @@ void CallLogWrapper::glUniformMatrix2x4dv (glw::GLint location, glw::GLsizei cou
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glUniformMatrix2x4dv(" << location << ", " << count << ", " << getBooleanStr(transpose) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(value))) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(location), CallTrace::pack(count), CallTrace::pack(transpose), CallTrace::pack(value) };
+		m_callTrace->record(s_glUniformMatrix2x4dvTraceInfo, traceArgs);
+	}
 	m_gl.uniformMatrix2x4dv(location, count, transpose, value);
 }
 
@@ -5633,6 +9524,11 @@ void CallLogWrapper::glUniformMatrix2x4fv (glw::GLint location, glw::GLsizei cou
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glUniformMatrix2x4fv(" << location << ", " << count << ", " << getBooleanStr(transpose) << ", " << getPointerStr(value, (count * 2*4)) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(location), CallTrace::pack(count), CallTrace::pack(transpose), CallTrace::pack(value) };
+		m_callTrace->record(s_glUniformMatrix2x4fvTraceInfo, traceArgs);
+	}
 	m_gl.uniformMatrix2x4fv(location, count, transpose, value);
 }
 
@@ -5640,6 +9536,11 @@ void CallLogWrapper::glUniformMatrix3dv (glw::GLint location, glw::GLsizei count
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glUniformMatrix3dv(" << location << ", " << count << ", " << getBooleanStr(transpose) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(value))) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(location), CallTrace::pack(count), CallTrace::pack(transpose), CallTrace::pack(value) };
+		m_callTrace->record(s_glUniformMatrix3dvTraceInfo, traceArgs);
+	}
 	m_gl.uniformMatrix3dv(location, count, transpose, value);
 }
 
@@ -5647,6 +9548,11 @@ void CallLogWrapper::glUniformMatrix3fv (glw::GLint location, glw::GLsizei count
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glUniformMatrix3fv(" << location << ", " << count << ", " << getBooleanStr(transpose) << ", " << getPointerStr(value, (count * 3*3)) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(location), CallTrace::pack(count), CallTrace::pack(transpose), CallTrace::pack(value) };
+		m_callTrace->record(s_glUniformMatrix3fvTraceInfo, traceArgs);
+	}
 	m_gl.uniformMatrix3fv(location, count, transpose, value);
 }
 
@@ -5654,6 +9560,11 @@ void CallLogWrapper::glUniformMatrix3x2dv (glw::GLint location, glw::GLsizei cou
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glUniformMatrix3x2dv(" << location << ", " << count << ", " << getBooleanStr(transpose) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(value))) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(location), CallTrace::pack(count), CallTrace::pack(transpose), CallTrace::pack(value) };
+		m_callTrace->record(s_glUniformMatrix3x2dvTraceInfo, traceArgs);
+	}
 	m_gl.uniformMatrix3x2dv(location, count, transpose, value);
 }
 
@@ -5661,6 +9572,11 @@ void CallLogWrapper::glUniformMatrix3x2fv (glw::GLint location, glw::GLsizei cou
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glUniformMatrix3x2fv(" << location << ", " << count << ", " << getBooleanStr(transpose) << ", " << getPointerStr(value, (count * 3*2)) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(location), CallTrace::pack(count), CallTrace::pack(transpose), CallTrace::pack(value) };
+		m_callTrace->record(s_glUniformMatrix3x2fvTraceInfo, traceArgs);
+	}
 	m_gl.uniformMatrix3x2fv(location, count, transpose, value);
 }
 
@@ -5668,6 +9584,11 @@ void CallLogWrapper::glUniformMatrix3x4dv (glw::GLint location, glw::GLsizei cou
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glUniformMatrix3x4dv(" << location << ", " << count << ", " << getBooleanStr(transpose) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(value))) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(location), CallTrace::pack(count), CallTrace::pack(transpose), CallTrace::pack(value) };
+		m_callTrace->record(s_glUniformMatrix3x4dvTraceInfo, traceArgs);
+	}
 	m_gl.uniformMatrix3x4dv(location, count, transpose, value);
 }
 
@@ -5675,6 +9596,11 @@ void CallLogWrapper::glUniformMatrix3x4fv (glw::GLint location, glw::GLsizei cou
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glUniformMatrix3x4fv(" << location << ", " << count << ", " << getBooleanStr(transpose) << ", " << getPointerStr(value, (count * 3*4)) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(location), CallTrace::pack(count), CallTrace::pack(transpose), CallTrace::pack(value) };
+		m_callTrace->record(s_glUniformMatrix3x4fvTraceInfo, traceArgs);
+	}
 	m_gl.uniformMatrix3x4fv(location, count, transpose, value);
 }
 
@@ -5682,6 +9608,11 @@ void CallLogWrapper::glUniformMatrix4dv (glw::GLint location, glw::GLsizei count
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glUniformMatrix4dv(" << location << ", " << count << ", " << getBooleanStr(transpose) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(value))) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(location), CallTrace::pack(count), CallTrace::pack(transpose), CallTrace::pack(value) };
+		m_callTrace->record(s_glUniformMatrix4dvTraceInfo, traceArgs);
+	}
 	m_gl.uniformMatrix4dv(location, count, transpose, value);
 }
 
@@ -5689,6 +9620,11 @@ void CallLogWrapper::glUniformMatrix4fv (glw::GLint location, glw::GLsizei count
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glUniformMatrix4fv(" << location << ", " << count << ", " << getBooleanStr(transpose) << ", " << getPointerStr(value, (count * 4*4)) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(location), CallTrace::pack(count), CallTrace::pack(transpose), CallTrace::pack(value) };
+		m_callTrace->record(s_glUniformMatrix4fvTraceInfo, traceArgs);
+	}
 	m_gl.uniformMatrix4fv(location, count, transpose, value);
 }
 
@@ -5696,6 +9632,11 @@ void CallLogWrapper::glUniformMatrix4x2dv (glw::GLint location, glw::GLsizei cou
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glUniformMatrix4x2dv(" << location << ", " << count << ", " << getBooleanStr(transpose) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(value))) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(location), CallTrace::pack(count), CallTrace::pack(transpose), CallTrace::pack(value) };
+		m_callTrace->record(s_glUniformMatrix4x2dvTraceInfo, traceArgs);
+	}
 	m_gl.uniformMatrix4x2dv(location, count, transpose, value);
 }
 
@@ -5703,6 +9644,11 @@ void CallLogWrapper::glUniformMatrix4x2fv (glw::GLint location, glw::GLsizei cou
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glUniformMatrix4x2fv(" << location << ", " << count << ", " << getBooleanStr(transpose) << ", " << getPointerStr(value, (count * 4*2)) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(location), CallTrace::pack(count), CallTrace::pack(transpose), CallTrace::pack(value) };
+		m_callTrace->record(s_glUniformMatrix4x2fvTraceInfo, traceArgs);
+	}
 	m_gl.uniformMatrix4x2fv(location, count, transpose, value);
 }
 
@@ -5710,6 +9656,11 @@ void CallLogWrapper::glUniformMatrix4x3dv (glw::GLint location, glw::GLsizei cou
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glUniformMatrix4x3dv(" << location << ", " << count << ", " << getBooleanStr(transpose) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(value))) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(location), CallTrace::pack(count), CallTrace::pack(transpose), CallTrace::pack(value) };
+		m_callTrace->record(s_glUniformMatrix4x3dvTraceInfo, traceArgs);
+	}
 	m_gl.uniformMatrix4x3dv(location, count, transpose, value);
 }
 
@@ -5717,6 +9668,11 @@ void CallLogWrapper::glUniformMatrix4x3fv (glw::GLint location, glw::GLsizei cou
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glUniformMatrix4x3fv(" << location << ", " << count << ", " << getBooleanStr(transpose) << ", " << getPointerStr(value, (count * 4*3)) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(location), CallTrace::pack(count), CallTrace::pack(transpose), CallTrace::pack(value) };
+		m_callTrace->record(s_glUniformMatrix4x3fvTraceInfo, traceArgs);
+	}
 	m_gl.uniformMatrix4x3fv(location, count, transpose, value);
 }
 
@@ -5724,6 +9680,11 @@ void CallLogWrapper::glUniformSubroutinesuiv (glw::GLenum shadertype, glw::GLsiz
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glUniformSubroutinesuiv(" << toHex(shadertype) << ", " << count << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(indices))) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(shadertype), CallTrace::pack(count), CallTrace::pack(indices) };
+		m_callTrace->record(s_glUniformSubroutinesuivTraceInfo, traceArgs);
+	}
 	m_gl.uniformSubroutinesuiv(shadertype, count, indices);
 }
 
@@ -5731,9 +9692,16 @@ glw::GLboolean CallLogWrapper::glUnmapBuffer (glw::GLenum target)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glUnmapBuffer(" << getBufferTargetStr(target) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(target) };
+		m_callTrace->record(s_glUnmapBufferTraceInfo, traceArgs);
+	}
 	glw::GLboolean returnValue = m_gl.unmapBuffer(target);
 	if (m_enableLog)
 		m_log << TestLog::Message << "// " << getBooleanStr(returnValue) << " returned" << TestLog::EndMessage;
+	if (m_callTrace)
+		m_callTrace->setReturnValue(CallTrace::pack(returnValue));
 	return returnValue;
 }
 
@@ -5741,9 +9709,16 @@ glw::GLboolean CallLogWrapper::glUnmapNamedBuffer (glw::GLuint buffer)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glUnmapNamedBuffer(" << buffer << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(buffer) };
+		m_callTrace->record(s_glUnmapNamedBufferTraceInfo, traceArgs);
+	}
 	glw::GLboolean returnValue = m_gl.unmapNamedBuffer(buffer);
 	if (m_enableLog)
 		m_log << TestLog::Message << "// " << getBooleanStr(returnValue) << " returned" << TestLog::EndMessage;
+	if (m_callTrace)
+		m_callTrace->setReturnValue(CallTrace::pack(returnValue));
 	return returnValue;
 }
 
@@ -5751,9 +9726,16 @@ glw::GLboolean CallLogWrapper::glUnmapNamedBufferEXT (glw::GLuint buffer)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glUnmapNamedBufferEXT(" << buffer << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(buffer) };
+		m_callTrace->record(s_glUnmapNamedBufferEXTTraceInfo, traceArgs);
+	}
 	glw::GLboolean returnValue = m_gl.unmapNamedBufferEXT(buffer);
 	if (m_enableLog)
 		m_log << TestLog::Message << "// " << getBooleanStr(returnValue) << " returned" << TestLog::EndMessage;
+	if (m_callTrace)
+		m_callTrace->setReturnValue(CallTrace::pack(returnValue));
 	return returnValue;
 }
 
@@ -5761,6 +9743,11 @@ void CallLogWrapper::glUseProgram (glw::GLuint program)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glUseProgram(" << program << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(program) };
+		m_callTrace->record(s_glUseProgramTraceInfo, traceArgs);
+	}
 	m_gl.useProgram(program);
 }
 
@@ -5768,6 +9755,11 @@ void CallLogWrapper::glUseProgramStages (glw::GLuint pipeline, glw::GLbitfield s
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glUseProgramStages(" << pipeline << ", " << getShaderTypeMaskStr(stages) << ", " << program << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(pipeline), CallTrace::pack(stages), CallTrace::pack(program) };
+		m_callTrace->record(s_glUseProgramStagesTraceInfo, traceArgs);
+	}
 	m_gl.useProgramStages(pipeline, stages, program);
 }
 
@@ -5775,6 +9767,11 @@ void CallLogWrapper::glValidateProgram (glw::GLuint program)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glValidateProgram(" << program << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(program) };
+		m_callTrace->record(s_glValidateProgramTraceInfo, traceArgs);
+	}
 	m_gl.validateProgram(program);
 }
 
@@ -5782,6 +9779,11 @@ void CallLogWrapper::glValidateProgramPipeline (glw::GLuint pipeline)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glValidateProgramPipeline(" << pipeline << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(pipeline) };
+		m_callTrace->record(s_glValidateProgramPipelineTraceInfo, traceArgs);
+	}
 	m_gl.validateProgramPipeline(pipeline);
 }
 
@@ -5789,6 +9791,11 @@ void CallLogWrapper::glVertexArrayAttribBinding (glw::GLuint vaobj, glw::GLuint
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glVertexArrayAttribBinding(" << vaobj << ", " << attribindex << ", " << bindingindex << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(vaobj), CallTrace::pack(attribindex), CallTrace::pack(bindingindex) };
+		m_callTrace->record(s_glVertexArrayAttribBindingTraceInfo, traceArgs);
+	}
 	m_gl.vertexArrayAttribBinding(vaobj, attribindex, bindingindex);
 }
 
@@ -5796,6 +9803,11 @@ void CallLogWrapper::glVertexArrayAttribFormat (glw::GLuint vaobj, glw::GLuint a
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glVertexArrayAttribFormat(" << vaobj << ", " << attribindex << ", " << size << ", " << toHex(type) << ", " << getBooleanStr(normalized) << ", " << relativeoffset << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(vaobj), CallTrace::pack(attribindex), CallTrace::pack(size), CallTrace::pack(type), CallTrace::pack(normalized), CallTrace::pack(relativeoffset) };
+		m_callTrace->record(s_glVertexArrayAttribFormatTraceInfo, traceArgs);
+	}
 	m_gl.vertexArrayAttribFormat(vaobj, attribindex, size, type, normalized, relativeoffset);
 }
 
@@ -5803,6 +9815,11 @@ void CallLogWrapper::glVertexArrayAttribIFormat (glw::GLuint vaobj, glw::GLuint
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glVertexArrayAttribIFormat(" << vaobj << ", " << attribindex << ", " << size << ", " << toHex(type) << ", " << relativeoffset << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(vaobj), CallTrace::pack(attribindex), CallTrace::pack(size), CallTrace::pack(type), CallTrace::pack(relativeoffset) };
+		m_callTrace->record(s_glVertexArrayAttribIFormatTraceInfo, traceArgs);
+	}
 	m_gl.vertexArrayAttribIFormat(vaobj, attribindex, size, type, relativeoffset);
 }
 
@@ -5810,6 +9827,11 @@ void CallLogWrapper::glVertexArrayAttribLFormat (glw::GLuint vaobj, glw::GLuint
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glVertexArrayAttribLFormat(" << vaobj << ", " << attribindex << ", " << size << ", " << toHex(type) << ", " << relativeoffset << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(vaobj), CallTrace::pack(attribindex), CallTrace::pack(size), CallTrace::pack(type), CallTrace::pack(relativeoffset) };
+		m_callTrace->record(s_glVertexArrayAttribLFormatTraceInfo, traceArgs);
+	}
 	m_gl.vertexArrayAttribLFormat(vaobj, attribindex, size, type, relativeoffset);
 }
 
@@ -5817,6 +9839,11 @@ void CallLogWrapper::glVertexArrayBindVertexBufferEXT (glw::GLuint vaobj, glw::G
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glVertexArrayBindVertexBufferEXT(" << vaobj << ", " << bindingindex << ", " << buffer << ", " << offset << ", " << stride << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(vaobj), CallTrace::pack(bindingindex), CallTrace::pack(buffer), CallTrace::pack(offset), CallTrace::pack(stride) };
+		m_callTrace->record(s_glVertexArrayBindVertexBufferEXTTraceInfo, traceArgs);
+	}
 	m_gl.vertexArrayBindVertexBufferEXT(vaobj, bindingindex, buffer, offset, stride);
 }
 
@@ -5824,6 +9851,11 @@ void CallLogWrapper::glVertexArrayBindingDivisor (glw::GLuint vaobj, glw::GLuint
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glVertexArrayBindingDivisor(" << vaobj << ", " << bindingindex << ", " << divisor << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(vaobj), CallTrace::pack(bindingindex), CallTrace::pack(divisor) };
+		m_callTrace->record(s_glVertexArrayBindingDivisorTraceInfo, traceArgs);
+	}
 	m_gl.vertexArrayBindingDivisor(vaobj, bindingindex, divisor);
 }
 
@@ -5831,6 +9863,11 @@ void CallLogWrapper::glVertexArrayColorOffsetEXT (glw::GLuint vaobj, glw::GLuint
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glVertexArrayColorOffsetEXT(" << vaobj << ", " << buffer << ", " << size << ", " << toHex(type) << ", " << stride << ", " << offset << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(vaobj), CallTrace::pack(buffer), CallTrace::pack(size), CallTrace::pack(type), CallTrace::pack(stride), CallTrace::pack(offset) };
+		m_callTrace->record(s_glVertexArrayColorOffsetEXTTraceInfo, traceArgs);
+	}
 	m_gl.vertexArrayColorOffsetEXT(vaobj, buffer, size, type, stride, offset);
 }
 
@@ -5838,6 +9875,11 @@ void CallLogWrapper::glVertexArrayEdgeFlagOffsetEXT (glw::GLuint vaobj, glw::GLu
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glVertexArrayEdgeFlagOffsetEXT(" << vaobj << ", " << buffer << ", " << stride << ", " << offset << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(vaobj), CallTrace::pack(buffer), CallTrace::pack(stride), CallTrace::pack(offset) };
+		m_callTrace->record(s_glVertexArrayEdgeFlagOffsetEXTTraceInfo, traceArgs);
+	}
 	m_gl.vertexArrayEdgeFlagOffsetEXT(vaobj, buffer, stride, offset);
 }
 
@@ -5845,6 +9887,11 @@ void CallLogWrapper::glVertexArrayElementBuffer (glw::GLuint vaobj, glw::GLuint
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glVertexArrayElementBuffer(" << vaobj << ", " << buffer << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(vaobj), CallTrace::pack(buffer) };
+		m_callTrace->record(s_glVertexArrayElementBufferTraceInfo, traceArgs);
+	}
 	m_gl.vertexArrayElementBuffer(vaobj, buffer);
 }
 
@@ -5852,6 +9899,11 @@ void CallLogWrapper::glVertexArrayFogCoordOffsetEXT (glw::GLuint vaobj, glw::GLu
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glVertexArrayFogCoordOffsetEXT(" << vaobj << ", " << buffer << ", " << toHex(type) << ", " << stride << ", " << offset << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(vaobj), CallTrace::pack(buffer), CallTrace::pack(type), CallTrace::pack(stride), CallTrace::pack(offset) };
+		m_callTrace->record(s_glVertexArrayFogCoordOffsetEXTTraceInfo, traceArgs);
+	}
 	m_gl.vertexArrayFogCoordOffsetEXT(vaobj, buffer, type, stride, offset);
 }
 
@@ -5859,6 +9911,11 @@ void CallLogWrapper::glVertexArrayIndexOffsetEXT (glw::GLuint vaobj, glw::GLuint
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glVertexArrayIndexOffsetEXT(" << vaobj << ", " << buffer << ", " << toHex(type) << ", " << stride << ", " << offset << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(vaobj), CallTrace::pack(buffer), CallTrace::pack(type), CallTrace::pack(stride), CallTrace::pack(offset) };
+		m_callTrace->record(s_glVertexArrayIndexOffsetEXTTraceInfo, traceArgs);
+	}
 	m_gl.vertexArrayIndexOffsetEXT(vaobj, buffer, type, stride, offset);
 }
 
@@ -5866,6 +9923,11 @@ void CallLogWrapper::glVertexArrayMultiTexCoordOffsetEXT (glw::GLuint vaobj, glw
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glVertexArrayMultiTexCoordOffsetEXT(" << vaobj << ", " << buffer << ", " << toHex(texunit) << ", " << size << ", " << toHex(type) << ", " << stride << ", " << offset << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(vaobj), CallTrace::pack(buffer), CallTrace::pack(texunit), CallTrace::pack(size), CallTrace::pack(type), CallTrace::pack(stride), CallTrace::pack(offset) };
+		m_callTrace->record(s_glVertexArrayMultiTexCoordOffsetEXTTraceInfo, traceArgs);
+	}
 	m_gl.vertexArrayMultiTexCoordOffsetEXT(vaobj, buffer, texunit, size, type, stride, offset);
 }
 
@@ -5873,6 +9935,11 @@ void CallLogWrapper::glVertexArrayNormalOffsetEXT (glw::GLuint vaobj, glw::GLuin
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glVertexArrayNormalOffsetEXT(" << vaobj << ", " << buffer << ", " << toHex(type) << ", " << stride << ", " << offset << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(vaobj), CallTrace::pack(buffer), CallTrace::pack(type), CallTrace::pack(stride), CallTrace::pack(offset) };
+		m_callTrace->record(s_glVertexArrayNormalOffsetEXTTraceInfo, traceArgs);
+	}
 	m_gl.vertexArrayNormalOffsetEXT(vaobj, buffer, type, stride, offset);
 }
 
@@ -5880,6 +9947,11 @@ void CallLogWrapper::glVertexArraySecondaryColorOffsetEXT (glw::GLuint vaobj, gl
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glVertexArraySecondaryColorOffsetEXT(" << vaobj << ", " << buffer << ", " << size << ", " << toHex(type) << ", " << stride << ", " << offset << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(vaobj), CallTrace::pack(buffer), CallTrace::pack(size), CallTrace::pack(type), CallTrace::pack(stride), CallTrace::pack(offset) };
+		m_callTrace->record(s_glVertexArraySecondaryColorOffsetEXTTraceInfo, traceArgs);
+	}
 	m_gl.vertexArraySecondaryColorOffsetEXT(vaobj, buffer, size, type, stride, offset);
 }
 
@@ -5887,6 +9959,11 @@ void CallLogWrapper::glVertexArrayTexCoordOffsetEXT (glw::GLuint vaobj, glw::GLu
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glVertexArrayTexCoordOffsetEXT(" << vaobj << ", " << buffer << ", " << size << ", " << toHex(type) << ", " << stride << ", " << offset << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(vaobj), CallTrace::pack(buffer), CallTrace::pack(size), CallTrace::pack(type), CallTrace::pack(stride), CallTrace::pack(offset) };
+		m_callTrace->record(s_glVertexArrayTexCoordOffsetEXTTraceInfo, traceArgs);
+	}
 	m_gl.vertexArrayTexCoordOffsetEXT(vaobj, buffer, size, type, stride, offset);
 }
 
@@ -5894,6 +9971,11 @@ void CallLogWrapper::glVertexArrayVertexAttribBindingEXT (glw::GLuint vaobj, glw
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glVertexArrayVertexAttribBindingEXT(" << vaobj << ", " << attribindex << ", " << bindingindex << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(vaobj), CallTrace::pack(attribindex), CallTrace::pack(bindingindex) };
+		m_callTrace->record(s_glVertexArrayVertexAttribBindingEXTTraceInfo, traceArgs);
+	}
 	m_gl.vertexArrayVertexAttribBindingEXT(vaobj, attribindex, bindingindex);
 }
 
@@ -5901,6 +9983,11 @@ void CallLogWrapper::glVertexArrayVertexAttribDivisorEXT (glw::GLuint vaobj, glw
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glVertexArrayVertexAttribDivisorEXT(" << vaobj << ", " << index << ", " << divisor << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(vaobj), CallTrace::pack(index), CallTrace::pack(divisor) };
+		m_callTrace->record(s_glVertexArrayVertexAttribDivisorEXTTraceInfo, traceArgs);
+	}
 	m_gl.vertexArrayVertexAttribDivisorEXT(vaobj, index, divisor);
 }
 
@@ -5908,6 +9995,11 @@ void CallLogWrapper::glVertexArrayVertexAttribFormatEXT (glw::GLuint vaobj, glw:
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glVertexArrayVertexAttribFormatEXT(" << vaobj << ", " << attribindex << ", " << size << ", " << toHex(type) << ", " << getBooleanStr(normalized) << ", " << relativeoffset << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(vaobj), CallTrace::pack(attribindex), CallTrace::pack(size), CallTrace::pack(type), CallTrace::pack(normalized), CallTrace::pack(relativeoffset) };
+		m_callTrace->record(s_glVertexArrayVertexAttribFormatEXTTraceInfo, traceArgs);
+	}
 	m_gl.vertexArrayVertexAttribFormatEXT(vaobj, attribindex, size, type, normalized, relativeoffset);
 }
 
@@ -5915,6 +10007,11 @@ void CallLogWrapper::glVertexArrayVertexAttribIFormatEXT (glw::GLuint vaobj, glw
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glVertexArrayVertexAttribIFormatEXT(" << vaobj << ", " << attribindex << ", " << size << ", " << toHex(type) << ", " << relativeoffset << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(vaobj), CallTrace::pack(attribindex), CallTrace::pack(size), CallTrace::pack(type), CallTrace::pack(relativeoffset) };
+		m_callTrace->record(s_glVertexArrayVertexAttribIFormatEXTTraceInfo, traceArgs);
+	}
 	m_gl.vertexArrayVertexAttribIFormatEXT(vaobj, attribindex, size, type, relativeoffset);
 }
 
@@ -5922,6 +10019,11 @@ void CallLogWrapper::glVertexArrayVertexAttribIOffsetEXT (glw::GLuint vaobj, glw
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glVertexArrayVertexAttribIOffsetEXT(" << vaobj << ", " << buffer << ", " << index << ", " << size << ", " << toHex(type) << ", " << stride << ", " << offset << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(vaobj), CallTrace::pack(buffer), CallTrace::pack(index), CallTrace::pack(size), CallTrace::pack(type), CallTrace::pack(stride), CallTrace::pack(offset) };
+		m_callTrace->record(s_glVertexArrayVertexAttribIOffsetEXTTraceInfo, traceArgs);
+	}
 	m_gl.vertexArrayVertexAttribIOffsetEXT(vaobj, buffer, index, size, type, stride, offset);
 }
 
@@ -5929,6 +10031,11 @@ void CallLogWrapper::glVertexArrayVertexAttribLFormatEXT (glw::GLuint vaobj, glw
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glVertexArrayVertexAttribLFormatEXT(" << vaobj << ", " << attribindex << ", " << size << ", " << toHex(type) << ", " << relativeoffset << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(vaobj), CallTrace::pack(attribindex), CallTrace::pack(size), CallTrace::pack(type), CallTrace::pack(relativeoffset) };
+		m_callTrace->record(s_glVertexArrayVertexAttribLFormatEXTTraceInfo, traceArgs);
+	}
 	m_gl.vertexArrayVertexAttribLFormatEXT(vaobj, attribindex, size, type, relativeoffset);
 }
 
@@ -5936,6 +10043,11 @@ void CallLogWrapper::glVertexArrayVertexAttribLOffsetEXT (glw::GLuint vaobj, glw
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glVertexArrayVertexAttribLOffsetEXT(" << vaobj << ", " << buffer << ", " << index << ", " << size << ", " << toHex(type) << ", " << stride << ", " << offset << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(vaobj), CallTrace::pack(buffer), CallTrace::pack(index), CallTrace::pack(size), CallTrace::pack(type), CallTrace::pack(stride), CallTrace::pack(offset) };
+		m_callTrace->record(s_glVertexArrayVertexAttribLOffsetEXTTraceInfo, traceArgs);
+	}
 	m_gl.vertexArrayVertexAttribLOffsetEXT(vaobj, buffer, index, size, type, stride, offset);
 }
 
@@ -5943,6 +10055,11 @@ void CallLogWrapper::glVertexArrayVertexAttribOffsetEXT (glw::GLuint vaobj, glw:
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glVertexArrayVertexAttribOffsetEXT(" << vaobj << ", " << buffer << ", " << index << ", " << size << ", " << toHex(type) << ", " << getBooleanStr(normalized) << ", " << stride << ", " << offset << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(vaobj), CallTrace::pack(buffer), CallTrace::pack(index), CallTrace::pack(size), CallTrace::pack(type), CallTrace::pack(normalized), CallTrace::pack(stride), CallTrace::pack(offset) };
+		m_callTrace->record(s_glVertexArrayVertexAttribOffsetEXTTraceInfo, traceArgs);
+	}
 	m_gl.vertexArrayVertexAttribOffsetEXT(vaobj, buffer, index, size, type, normalized, stride, offset);
 }
 
@@ -5950,6 +10067,11 @@ void CallLogWrapper::glVertexArrayVertexBindingDivisorEXT (glw::GLuint vaobj, gl
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glVertexArrayVertexBindingDivisorEXT(" << vaobj << ", " << bindingindex << ", " << divisor << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(vaobj), CallTrace::pack(bindingindex), CallTrace::pack(divisor) };
+		m_callTrace->record(s_glVertexArrayVertexBindingDivisorEXTTraceInfo, traceArgs);
+	}
 	m_gl.vertexArrayVertexBindingDivisorEXT(vaobj, bindingindex, divisor);
 }
 
@@ -5957,6 +10079,11 @@ void CallLogWrapper::glVertexArrayVertexBuffer (glw::GLuint vaobj, glw::GLuint b
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glVertexArrayVertexBuffer(" << vaobj << ", " << bindingindex << ", " << buffer << ", " << offset << ", " << stride << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(vaobj), CallTrace::pack(bindingindex), CallTrace::pack(buffer), CallTrace::pack(offset), CallTrace::pack(stride) };
+		m_callTrace->record(s_glVertexArrayVertexBufferTraceInfo, traceArgs);
+	}
 	m_gl.vertexArrayVertexBuffer(vaobj, bindingindex, buffer, offset, stride);
 }
 
@@ -5964,6 +10091,11 @@ void CallLogWrapper::glVertexArrayVertexBuffers (glw::GLuint vaobj, glw::GLuint
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glVertexArrayVertexBuffers(" << vaobj << ", " << first << ", " << count << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(buffers))) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(offsets))) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(strides))) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(vaobj), CallTrace::pack(first), CallTrace::pack(count), CallTrace::pack(buffers), CallTrace::pack(offsets), CallTrace::pack(strides) };
+		m_callTrace->record(s_glVertexArrayVertexBuffersTraceInfo, traceArgs);
+	}
 	m_gl.vertexArrayVertexBuffers(vaobj, first, count, buffers, offsets, strides);
 }
 
@@ -5971,6 +10103,11 @@ void CallLogWrapper::glVertexArrayVertexOffsetEXT (glw::GLuint vaobj, glw::GLuin
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glVertexArrayVertexOffsetEXT(" << vaobj << ", " << buffer << ", " << size << ", " << toHex(type) << ", " << stride << ", " << offset << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(vaobj), CallTrace::pack(buffer), CallTrace::pack(size), CallTrace::pack(type), CallTrace::pack(stride), CallTrace::pack(offset) };
+		m_callTrace->record(s_glVertexArrayVertexOffsetEXTTraceInfo, traceArgs);
+	}
 	m_gl.vertexArrayVertexOffsetEXT(vaobj, buffer, size, type, stride, offset);
 }
 
@@ -5978,6 +10115,11 @@ void CallLogWrapper::glVertexAttrib1d (glw::GLuint index, glw::GLdouble x)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glVertexAttrib1d(" << index << ", " << x << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(index), CallTrace::pack(x) };
+		m_callTrace->record(s_glVertexAttrib1dTraceInfo, traceArgs);
+	}
 	m_gl.vertexAttrib1d(index, x);
 }
 
@@ -5985,6 +10127,11 @@ void CallLogWrapper::glVertexAttrib1dv (glw::GLuint index, const glw::GLdouble *
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glVertexAttrib1dv(" << index << ", " << getPointerStr(v, 1) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(index), CallTrace::pack(v) };
+		m_callTrace->record(s_glVertexAttrib1dvTraceInfo, traceArgs);
+	}
 	m_gl.vertexAttrib1dv(index, v);
 }
 
@@ -5992,6 +10139,11 @@ void CallLogWrapper::glVertexAttrib1f (glw::GLuint index, glw::GLfloat x)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glVertexAttrib1f(" << index << ", " << x << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(index), CallTrace::pack(x) };
+		m_callTrace->record(s_glVertexAttrib1fTraceInfo, traceArgs);
+	}
 	m_gl.vertexAttrib1f(index, x);
 }
 
@@ -5999,6 +10151,11 @@ void CallLogWrapper::glVertexAttrib1fv (glw::GLuint index, const glw::GLfloat *v
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glVertexAttrib1fv(" << index << ", " << getPointerStr(v, 1) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(index), CallTrace::pack(v) };
+		m_callTrace->record(s_glVertexAttrib1fvTraceInfo, traceArgs);
+	}
 	m_gl.vertexAttrib1fv(index, v);
 }
 
@@ -6006,6 +10163,11 @@ void CallLogWrapper::glVertexAttrib1s (glw::GLuint index, glw::GLshort x)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glVertexAttrib1s(" << index << ", " << x << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(index), CallTrace::pack(x) };
+		m_callTrace->record(s_glVertexAttrib1sTraceInfo, traceArgs);
+	}
 	m_gl.vertexAttrib1s(index, x);
 }
 
@@ -6013,6 +10175,11 @@ void CallLogWrapper::glVertexAttrib1sv (glw::GLuint index, const glw::GLshort *v
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glVertexAttrib1sv(" << index << ", " << getPointerStr(v, 1) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(index), CallTrace::pack(v) };
+		m_callTrace->record(s_glVertexAttrib1svTraceInfo, traceArgs);
+	}
 	m_gl.vertexAttrib1sv(index, v);
 }
 
@@ -6020,6 +10187,11 @@ void CallLogWrapper::glVertexAttrib2d (glw::GLuint index, glw::GLdouble x, glw::
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glVertexAttrib2d(" << index << ", " << x << ", " << y << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(index), CallTrace::pack(x), CallTrace::pack(y) };
+		m_callTrace->record(s_glVertexAttrib2dTraceInfo, traceArgs);
+	}
 	m_gl.vertexAttrib2d(index, x, y);
 }
 
@@ -6027,6 +10199,11 @@ void CallLogWrapper::glVertexAttrib2dv (glw::GLuint index, const glw::GLdouble *
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glVertexAttrib2dv(" << index << ", " << getPointerStr(v, 2) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(index), CallTrace::pack(v) };
+		m_callTrace->record(s_glVertexAttrib2dvTraceInfo, traceArgs);
+	}
 	m_gl.vertexAttrib2dv(index, v);
 }
 
@@ -6034,6 +10211,11 @@ void CallLogWrapper::glVertexAttrib2f (glw::GLuint index, glw::GLfloat x, glw::G
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glVertexAttrib2f(" << index << ", " << x << ", " << y << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(index), CallTrace::pack(x), CallTrace::pack(y) };
+		m_callTrace->record(s_glVertexAttrib2fTraceInfo, traceArgs);
+	}
 	m_gl.vertexAttrib2f(index, x, y);
 }
 
@@ -6041,6 +10223,11 @@ void CallLogWrapper::glVertexAttrib2fv (glw::GLuint index, const glw::GLfloat *v
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glVertexAttrib2fv(" << index << ", " << getPointerStr(v, 2) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(index), CallTrace::pack(v) };
+		m_callTrace->record(s_glVertexAttrib2fvTraceInfo, traceArgs);
+	}
 	m_gl.vertexAttrib2fv(index, v);
 }
 
@@ -6048,6 +10235,11 @@ void CallLogWrapper::glVertexAttrib2s (glw::GLuint index, glw::GLshort x, glw::G
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glVertexAttrib2s(" << index << ", " << x << ", " << y << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(index), CallTrace::pack(x), CallTrace::pack(y) };
+		m_callTrace->record(s_glVertexAttrib2sTraceInfo, traceArgs);
+	}
 	m_gl.vertexAttrib2s(index, x, y);
 }
 
@@ -6055,6 +10247,11 @@ void CallLogWrapper::glVertexAttrib2sv (glw::GLuint index, const glw::GLshort *v
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glVertexAttrib2sv(" << index << ", " << getPointerStr(v, 2) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(index), CallTrace::pack(v) };
+		m_callTrace->record(s_glVertexAttrib2svTraceInfo, traceArgs);
+	}
 	m_gl.vertexAttrib2sv(index, v);
 }
 
@@ -6062,6 +10259,11 @@ void CallLogWrapper::glVertexAttrib3d (glw::GLuint index, glw::GLdouble x, glw::
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glVertexAttrib3d(" << index << ", " << x << ", " << y << ", " << z << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(index), CallTrace::pack(x), CallTrace::pack(y), CallTrace::pack(z) };
+		m_callTrace->record(s_glVertexAttrib3dTraceInfo, traceArgs);
+	}
 	m_gl.vertexAttrib3d(index, x, y, z);
 }
 
@@ -6069,6 +10271,11 @@ void CallLogWrapper::glVertexAttrib3dv (glw::GLuint index, const glw::GLdouble *
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glVertexAttrib3dv(" << index << ", " << getPointerStr(v, 3) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(index), CallTrace::pack(v) };
+		m_callTrace->record(s_glVertexAttrib3dvTraceInfo, traceArgs);
+	}
 	m_gl.vertexAttrib3dv(index, v);
 }
 
@@ -6076,6 +10283,11 @@ void CallLogWrapper::glVertexAttrib3f (glw::GLuint index, glw::GLfloat x, glw::G
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glVertexAttrib3f(" << index << ", " << x << ", " << y << ", " << z << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(index), CallTrace::pack(x), CallTrace::pack(y), CallTrace::pack(z) };
+		m_callTrace->record(s_glVertexAttrib3fTraceInfo, traceArgs);
+	}
 	m_gl.vertexAttrib3f(index, x, y, z);
 }
 
@@ -6083,6 +10295,11 @@ void CallLogWrapper::glVertexAttrib3fv (glw::GLuint index, const glw::GLfloat *v
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glVertexAttrib3fv(" << index << ", " << getPointerStr(v, 3) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(index), CallTrace::pack(v) };
+		m_callTrace->record(s_glVertexAttrib3fvTraceInfo, traceArgs);
+	}
 	m_gl.vertexAttrib3fv(index, v);
 }
 
@@ -6090,6 +10307,11 @@ void CallLogWrapper::glVertexAttrib3s (glw::GLuint index, glw::GLshort x, glw::G
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glVertexAttrib3s(" << index << ", " << x << ", " << y << ", " << z << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(index), CallTrace::pack(x), CallTrace::pack(y), CallTrace::pack(z) };
+		m_callTrace->record(s_glVertexAttrib3sTraceInfo, traceArgs);
+	}
 	m_gl.vertexAttrib3s(index, x, y, z);
 }
 
@@ -6097,6 +10319,11 @@ void CallLogWrapper::glVertexAttrib3sv (glw::GLuint index, const glw::GLshort *v
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glVertexAttrib3sv(" << index << ", " << getPointerStr(v, 3) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(index), CallTrace::pack(v) };
+		m_callTrace->record(s_glVertexAttrib3svTraceInfo, traceArgs);
+	}
 	m_gl.vertexAttrib3sv(index, v);
 }
 
@@ -6104,6 +10331,11 @@ void CallLogWrapper::glVertexAttrib4Nbv (glw::GLuint index, const glw::GLbyte *v
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glVertexAttrib4Nbv(" << index << ", " << getPointerStr(v, 4) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(index), CallTrace::pack(v) };
+		m_callTrace->record(s_glVertexAttrib4NbvTraceInfo, traceArgs);
+	}
 	m_gl.vertexAttrib4Nbv(index, v);
 }
 
@@ -6111,6 +10343,11 @@ void CallLogWrapper::glVertexAttrib4Niv (glw::GLuint index, const glw::GLint *v)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glVertexAttrib4Niv(" << index << ", " << getPointerStr(v, 4) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(index), CallTrace::pack(v) };
+		m_callTrace->record(s_glVertexAttrib4NivTraceInfo, traceArgs);
+	}
 	m_gl.vertexAttrib4Niv(index, v);
 }
 
@@ -6118,6 +10355,11 @@ void CallLogWrapper::glVertexAttrib4Nsv (glw::GLuint index, const glw::GLshort *
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glVertexAttrib4Nsv(" << index << ", " << getPointerStr(v, 4) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(index), CallTrace::pack(v) };
+		m_callTrace->record(s_glVertexAttrib4NsvTraceInfo, traceArgs);
+	}
 	m_gl.vertexAttrib4Nsv(index, v);
 }
 
@@ -6125,6 +10367,11 @@ void CallLogWrapper::glVertexAttrib4Nub (glw::GLuint index, glw::GLubyte x, glw:
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glVertexAttrib4Nub(" << index << ", " << toHex(x) << ", " << toHex(y) << ", " << toHex(z) << ", " << toHex(w) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(index), CallTrace::pack(x), CallTrace::pack(y), CallTrace::pack(z), CallTrace::pack(w) };
+		m_callTrace->record(s_glVertexAttrib4NubTraceInfo, traceArgs);
+	}
 	m_gl.vertexAttrib4Nub(index, x, y, z, w);
 }
 
@@ -6132,6 +10379,11 @@ void CallLogWrapper::glVertexAttrib4Nubv (glw::GLuint index, const glw::GLubyte
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glVertexAttrib4Nubv(" << index << ", " << getPointerStr(v, 4) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(index), CallTrace::pack(v) };
+		m_callTrace->record(s_glVertexAttrib4NubvTraceInfo, traceArgs);
+	}
 	m_gl.vertexAttrib4Nubv(index, v);
 }
 
@@ -6139,6 +10391,11 @@ void CallLogWrapper::glVertexAttrib4Nuiv (glw::GLuint index, const glw::GLuint *
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glVertexAttrib4Nuiv(" << index << ", " << getPointerStr(v, 4) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(index), CallTrace::pack(v) };
+		m_callTrace->record(s_glVertexAttrib4NuivTraceInfo, traceArgs);
+	}
 	m_gl.vertexAttrib4Nuiv(index, v);
 }
 
@@ -6146,6 +10403,11 @@ void CallLogWrapper::glVertexAttrib4Nusv (glw::GLuint index, const glw::GLushort
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glVertexAttrib4Nusv(" << index << ", " << getPointerStr(v, 4) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(index), CallTrace::pack(v) };
+		m_callTrace->record(s_glVertexAttrib4NusvTraceInfo, traceArgs);
+	}
 	m_gl.vertexAttrib4Nusv(index, v);
 }
 
@@ -6153,6 +10415,11 @@ void CallLogWrapper::glVertexAttrib4bv (glw::GLuint index, const glw::GLbyte *v)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glVertexAttrib4bv(" << index << ", " << getPointerStr(v, 4) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(index), CallTrace::pack(v) };
+		m_callTrace->record(s_glVertexAttrib4bvTraceInfo, traceArgs);
+	}
 	m_gl.vertexAttrib4bv(index, v);
 }
 
@@ -6160,6 +10427,11 @@ void CallLogWrapper::glVertexAttrib4d (glw::GLuint index, glw::GLdouble x, glw::
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glVertexAttrib4d(" << index << ", " << x << ", " << y << ", " << z << ", " << w << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(index), CallTrace::pack(x), CallTrace::pack(y), CallTrace::pack(z), CallTrace::pack(w) };
+		m_callTrace->record(s_glVertexAttrib4dTraceInfo, traceArgs);
+	}
 	m_gl.vertexAttrib4d(index, x, y, z, w);
 }
 
@@ -6167,6 +10439,11 @@ void CallLogWrapper::glVertexAttrib4dv (glw::GLuint index, const glw::GLdouble *
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glVertexAttrib4dv(" << index << ", " << getPointerStr(v, 4) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(index), CallTrace::pack(v) };
+		m_callTrace->record(s_glVertexAttrib4dvTraceInfo, traceArgs);
+	}
 	m_gl.vertexAttrib4dv(index, v);
 }
 
@@ -6174,6 +10451,11 @@ void CallLogWrapper::glVertexAttrib4f (glw::GLuint index, glw::GLfloat x, glw::G
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glVertexAttrib4f(" << index << ", " << x << ", " << y << ", " << z << ", " << w << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(index), CallTrace::pack(x), CallTrace::pack(y), CallTrace::pack(z), CallTrace::pack(w) };
+		m_callTrace->record(s_glVertexAttrib4fTraceInfo, traceArgs);
+	}
 	m_gl.vertexAttrib4f(index, x, y, z, w);
 }
 
@@ -6181,6 +10463,11 @@ void CallLogWrapper::glVertexAttrib4fv (glw::GLuint index, const glw::GLfloat *v
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glVertexAttrib4fv(" << index << ", " << getPointerStr(v, 4) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(index), CallTrace::pack(v) };
+		m_callTrace->record(s_glVertexAttrib4fvTraceInfo, traceArgs);
+	}
 	m_gl.vertexAttrib4fv(index, v);
 }
 
@@ -6188,6 +10475,11 @@ void CallLogWrapper::glVertexAttrib4iv (glw::GLuint index, const glw::GLint *v)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glVertexAttrib4iv(" << index << ", " << getPointerStr(v, 4) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(index), CallTrace::pack(v) };
+		m_callTrace->record(s_glVertexAttrib4ivTraceInfo, traceArgs);
+	}
 	m_gl.vertexAttrib4iv(index, v);
 }
 
@@ -6195,6 +10487,11 @@ void CallLogWrapper::glVertexAttrib4s (glw::GLuint index, glw::GLshort x, glw::G
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glVertexAttrib4s(" << index << ", " << x << ", " << y << ", " << z << ", " << w << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(index), CallTrace::pack(x), CallTrace::pack(y), CallTrace::pack(z), CallTrace::pack(w) };
+		m_callTrace->record(s_glVertexAttrib4sTraceInfo, traceArgs);
+	}
 	m_gl.vertexAttrib4s(index, x, y, z, w);
 }
 
@@ -6202,6 +10499,11 @@ void CallLogWrapper::glVertexAttrib4sv (glw::GLuint index, const glw::GLshort *v
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glVertexAttrib4sv(" << index << ", " << getPointerStr(v, 4) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(index), CallTrace::pack(v) };
+		m_callTrace->record(s_glVertexAttrib4svTraceInfo, traceArgs);
+	}
 	m_gl.vertexAttrib4sv(index, v);
 }
 
@@ -6209,6 +10511,11 @@ void CallLogWrapper::glVertexAttrib4ubv (glw::GLuint index, const glw::GLubyte *
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glVertexAttrib4ubv(" << index << ", " << getPointerStr(v, 4) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(index), CallTrace::pack(v) };
+		m_callTrace->record(s_glVertexAttrib4ubvTraceInfo, traceArgs);
+	}
 	m_gl.vertexAttrib4ubv(index, v);
 }
 
@@ -6216,6 +10523,11 @@ void CallLogWrapper::glVertexAttrib4uiv (glw::GLuint index, const glw::GLuint *v
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glVertexAttrib4uiv(" << index << ", " << getPointerStr(v, 4) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(index), CallTrace::pack(v) };
+		m_callTrace->record(s_glVertexAttrib4uivTraceInfo, traceArgs);
+	}
 	m_gl.vertexAttrib4uiv(index, v);
 }
 
@@ -6223,6 +10535,11 @@ void CallLogWrapper::glVertexAttrib4usv (glw::GLuint index, const glw::GLushort
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glVertexAttrib4usv(" << index << ", " << getPointerStr(v, 4) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(index), CallTrace::pack(v) };
+		m_callTrace->record(s_glVertexAttrib4usvTraceInfo, traceArgs);
+	}
 	m_gl.vertexAttrib4usv(index, v);
 }
 
@@ -6230,6 +10547,11 @@ void CallLogWrapper::glVertexAttribBinding (glw::GLuint attribindex, glw::GLuint
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glVertexAttribBinding(" << attribindex << ", " << bindingindex << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(attribindex), CallTrace::pack(bindingindex) };
+		m_callTrace->record(s_glVertexAttribBindingTraceInfo, traceArgs);
+	}
 	m_gl.vertexAttribBinding(attribindex, bindingindex);
 }
 
@@ -6237,6 +10559,11 @@ void CallLogWrapper::glVertexAttribDivisor (glw::GLuint index, glw::GLuint divis
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glVertexAttribDivisor(" << index << ", " << divisor << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(index), CallTrace::pack(divisor) };
+		m_callTrace->record(s_glVertexAttribDivisorTraceInfo, traceArgs);
+	}
 	m_gl.vertexAttribDivisor(index, divisor);
 }
 
@@ -6244,6 +10571,11 @@ void CallLogWrapper::glVertexAttribFormat (glw::GLuint attribindex, glw::GLint s
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glVertexAttribFormat(" << attribindex << ", " << size << ", " << getTypeStr(type) << ", " << getBooleanStr(normalized) << ", " << relativeoffset << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(attribindex), CallTrace::pack(size), CallTrace::pack(type), CallTrace::pack(normalized), CallTrace::pack(relativeoffset) };
+		m_callTrace->record(s_glVertexAttribFormatTraceInfo, traceArgs);
+	}
 	m_gl.vertexAttribFormat(attribindex, size, type, normalized, relativeoffset);
 }
 
@@ -6251,6 +10583,11 @@ void CallLogWrapper::glVertexAttribI1i (glw::GLuint index, glw::GLint x)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glVertexAttribI1i(" << index << ", " << x << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(index), CallTrace::pack(x) };
+		m_callTrace->record(s_glVertexAttribI1iTraceInfo, traceArgs);
+	}
 	m_gl.vertexAttribI1i(index, x);
 }
 
@@ -6258,6 +10595,11 @@ void CallLogWrapper::glVertexAttribI1iv (glw::GLuint index, const glw::GLint *v)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glVertexAttribI1iv(" << index << ", " << getPointerStr(v, 1) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(index), CallTrace::pack(v) };
+		m_callTrace->record(s_glVertexAttribI1ivTraceInfo, traceArgs);
+	}
 	m_gl.vertexAttribI1iv(index, v);
 }
 
@@ -6265,6 +10607,11 @@ void CallLogWrapper::glVertexAttribI1ui (glw::GLuint index, glw::GLuint x)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glVertexAttribI1ui(" << index << ", " << x << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(index), CallTrace::pack(x) };
+		m_callTrace->record(s_glVertexAttribI1uiTraceInfo, traceArgs);
+	}
 	m_gl.vertexAttribI1ui(index, x);
 }
 
@@ -6272,6 +10619,11 @@ void CallLogWrapper::glVertexAttribI1uiv (glw::GLuint index, const glw::GLuint *
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glVertexAttribI1uiv(" << index << ", " << getPointerStr(v, 1) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(index), CallTrace::pack(v) };
+		m_callTrace->record(s_glVertexAttribI1uivTraceInfo, traceArgs);
+	}
 	m_gl.vertexAttribI1uiv(index, v);
 }
 
@@ -6279,6 +10631,11 @@ void CallLogWrapper::glVertexAttribI2i (glw::GLuint index, glw::GLint x, glw::GL
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glVertexAttribI2i(" << index << ", " << x << ", " << y << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(index), CallTrace::pack(x), CallTrace::pack(y) };
+		m_callTrace->record(s_glVertexAttribI2iTraceInfo, traceArgs);
+	}
 	m_gl.vertexAttribI2i(index, x, y);
 }
 
@@ -6286,6 +10643,11 @@ void CallLogWrapper::glVertexAttribI2iv (glw::GLuint index, const glw::GLint *v)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glVertexAttribI2iv(" << index << ", " << getPointerStr(v, 2) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(index), CallTrace::pack(v) };
+		m_callTrace->record(s_glVertexAttribI2ivTraceInfo, traceArgs);
+	}
 	m_gl.vertexAttribI2iv(index, v);
 }
 
@@ -6293,6 +10655,11 @@ void CallLogWrapper::glVertexAttribI2ui (glw::GLuint index, glw::GLuint x, glw::
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glVertexAttribI2ui(" << index << ", " << x << ", " << y << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(index), CallTrace::pack(x), CallTrace::pack(y) };
+		m_callTrace->record(s_glVertexAttribI2uiTraceInfo, traceArgs);
+	}
 	m_gl.vertexAttribI2ui(index, x, y);
 }
 
@@ -6300,6 +10667,11 @@ void CallLogWrapper::glVertexAttribI2uiv (glw::GLuint index, const glw::GLuint *
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glVertexAttribI2uiv(" << index << ", " << getPointerStr(v, 2) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(index), CallTrace::pack(v) };
+		m_callTrace->record(s_glVertexAttribI2uivTraceInfo, traceArgs);
+	}
 	m_gl.vertexAttribI2uiv(index, v);
 }
 
@@ -6307,6 +10679,11 @@ void CallLogWrapper::glVertexAttribI3i (glw::GLuint index, glw::GLint x, glw::GL
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glVertexAttribI3i(" << index << ", " << x << ", " << y << ", " << z << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(index), CallTrace::pack(x), CallTrace::pack(y), CallTrace::pack(z) };
+		m_callTrace->record(s_glVertexAttribI3iTraceInfo, traceArgs);
+	}
 	m_gl.vertexAttribI3i(index, x, y, z);
 }
 
@@ -6314,6 +10691,11 @@ void CallLogWrapper::glVertexAttribI3iv (glw::GLuint index, const glw::GLint *v)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glVertexAttribI3iv(" << index << ", " << getPointerStr(v, 3) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(index), CallTrace::pack(v) };
+		m_callTrace->record(s_glVertexAttribI3ivTraceInfo, traceArgs);
+	}
 	m_gl.vertexAttribI3iv(index, v);
 }
 
@@ -6321,6 +10703,11 @@ void CallLogWrapper::glVertexAttribI3ui (glw::GLuint index, glw::GLuint x, glw::
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glVertexAttribI3ui(" << index << ", " << x << ", " << y << ", " << z << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(index), CallTrace::pack(x), CallTrace::pack(y), CallTrace::pack(z) };
+		m_callTrace->record(s_glVertexAttribI3uiTraceInfo, traceArgs);
+	}
 	m_gl.vertexAttribI3ui(index, x, y, z);
 }
 
@@ -6328,6 +10715,11 @@ void CallLogWrapper::glVertexAttribI3uiv (glw::GLuint index, const glw::GLuint *
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glVertexAttribI3uiv(" << index << ", " << getPointerStr(v, 3) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(index), CallTrace::pack(v) };
+		m_callTrace->record(s_glVertexAttribI3uivTraceInfo, traceArgs);
+	}
 	m_gl.vertexAttribI3uiv(index, v);
 }
 
@@ -6335,6 +10727,11 @@ void CallLogWrapper::glVertexAttribI4bv (glw::GLuint index, const glw::GLbyte *v
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glVertexAttribI4bv(" << index << ", " << getPointerStr(v, 4) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(index), CallTrace::pack(v) };
+		m_callTrace->record(s_glVertexAttribI4bvTraceInfo, traceArgs);
+	}
 	m_gl.vertexAttribI4bv(index, v);
 }
 
@@ -6342,6 +10739,11 @@ void CallLogWrapper::glVertexAttribI4i (glw::GLuint index, glw::GLint x, glw::GL
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glVertexAttribI4i(" << index << ", " << x << ", " << y << ", " << z << ", " << w << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(index), CallTrace::pack(x), CallTrace::pack(y), CallTrace::pack(z), CallTrace::pack(w) };
+		m_callTrace->record(s_glVertexAttribI4iTraceInfo, traceArgs);
+	}
 	m_gl.vertexAttribI4i(index, x, y, z, w);
 }
 
@@ -6349,6 +10751,11 @@ void CallLogWrapper::glVertexAttribI4iv (glw::GLuint index, const glw::GLint *v)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glVertexAttribI4iv(" << index << ", " << getPointerStr(v, 4) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(index), CallTrace::pack(v) };
+		m_callTrace->record(s_glVertexAttribI4ivTraceInfo, traceArgs);
+	}
 	m_gl.vertexAttribI4iv(index, v);
 }
 
@@ -6356,6 +10763,11 @@ void CallLogWrapper::glVertexAttribI4sv (glw::GLuint index, const glw::GLshort *
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glVertexAttribI4sv(" << index << ", " << getPointerStr(v, 4) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(index), CallTrace::pack(v) };
+		m_callTrace->record(s_glVertexAttribI4svTraceInfo, traceArgs);
+	}
 	m_gl.vertexAttribI4sv(index, v);
 }
 
@@ -6363,6 +10775,11 @@ void CallLogWrapper::glVertexAttribI4ubv (glw::GLuint index, const glw::GLubyte
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glVertexAttribI4ubv(" << index << ", " << getPointerStr(v, 4) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(index), CallTrace::pack(v) };
+		m_callTrace->record(s_glVertexAttribI4ubvTraceInfo, traceArgs);
+	}
 	m_gl.vertexAttribI4ubv(index, v);
 }
 
@@ -6370,6 +10787,11 @@ void CallLogWrapper::glVertexAttribI4ui (glw::GLuint index, glw::GLuint x, glw::
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glVertexAttribI4ui(" << index << ", " << x << ", " << y << ", " << z << ", " << w << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(index), CallTrace::pack(x), CallTrace::pack(y), CallTrace::pack(z), CallTrace::pack(w) };
+		m_callTrace->record(s_glVertexAttribI4uiTraceInfo, traceArgs);
+	}
 	m_gl.vertexAttribI4ui(index, x, y, z, w);
 }
 
@@ -6377,6 +10799,11 @@ void CallLogWrapper::glVertexAttribI4uiv (glw::GLuint index, const glw::GLuint *
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glVertexAttribI4uiv(" << index << ", " << getPointerStr(v, 4) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(index), CallTrace::pack(v) };
+		m_callTrace->record(s_glVertexAttribI4uivTraceInfo, traceArgs);
+	}
 	m_gl.vertexAttribI4uiv(index, v);
 }
 
@@ -6384,6 +10811,11 @@ void CallLogWrapper::glVertexAttribI4usv (glw::GLuint index, const glw::GLushort
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glVertexAttribI4usv(" << index << ", " << getPointerStr(v, 4) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(index), CallTrace::pack(v) };
+		m_callTrace->record(s_glVertexAttribI4usvTraceInfo, traceArgs);
+	}
 	m_gl.vertexAttribI4usv(index, v);
 }
 
@@ -6391,6 +10823,11 @@ void CallLogWrapper::glVertexAttribIFormat (glw::GLuint attribindex, glw::GLint
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glVertexAttribIFormat(" << attribindex << ", " << size << ", " << getTypeStr(type) << ", " << relativeoffset << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(attribindex), CallTrace::pack(size), CallTrace::pack(type), CallTrace::pack(relativeoffset) };
+		m_callTrace->record(s_glVertexAttribIFormatTraceInfo, traceArgs);
+	}
 	m_gl.vertexAttribIFormat(attribindex, size, type, relativeoffset);
 }
 
@@ -6398,6 +10835,11 @@ void CallLogWrapper::glVertexAttribIPointer (glw::GLuint index, glw::GLint size,
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glVertexAttribIPointer(" << index << ", " << size << ", " << getTypeStr(type) << ", " << stride << ", " << pointer << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(index), CallTrace::pack(size), CallTrace::pack(type), CallTrace::pack(stride), CallTrace::pack(pointer) };
+		m_callTrace->record(s_glVertexAttribIPointerTraceInfo, traceArgs);
+	}
 	m_gl.vertexAttribIPointer(index, size, type, stride, pointer);
 }
 
@@ -6405,6 +10847,11 @@ void CallLogWrapper::glVertexAttribL1d (glw::GLuint index, glw::GLdouble x)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glVertexAttribL1d(" << index << ", " << x << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(index), CallTrace::pack(x) };
+		m_callTrace->record(s_glVertexAttribL1dTraceInfo, traceArgs);
+	}
 	m_gl.vertexAttribL1d(index, x);
 }
 
@@ -6412,6 +10859,11 @@ void CallLogWrapper::glVertexAttribL1dv (glw::GLuint index, const glw::GLdouble
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glVertexAttribL1dv(" << index << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(v))) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(index), CallTrace::pack(v) };
+		m_callTrace->record(s_glVertexAttribL1dvTraceInfo, traceArgs);
+	}
 	m_gl.vertexAttribL1dv(index, v);
 }
 
@@ -6419,6 +10871,11 @@ void CallLogWrapper::glVertexAttribL2d (glw::GLuint index, glw::GLdouble x, glw:
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glVertexAttribL2d(" << index << ", " << x << ", " << y << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(index), CallTrace::pack(x), CallTrace::pack(y) };
+		m_callTrace->record(s_glVertexAttribL2dTraceInfo, traceArgs);
+	}
 	m_gl.vertexAttribL2d(index, x, y);
 }
 
@@ -6426,6 +10883,11 @@ void CallLogWrapper::glVertexAttribL2dv (glw::GLuint index, const glw::GLdouble
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glVertexAttribL2dv(" << index << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(v))) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(index), CallTrace::pack(v) };
+		m_callTrace->record(s_glVertexAttribL2dvTraceInfo, traceArgs);
+	}
 	m_gl.vertexAttribL2dv(index, v);
 }
 
@@ -6433,6 +10895,11 @@ void CallLogWrapper::glVertexAttribL3d (glw::GLuint index, glw::GLdouble x, glw:
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glVertexAttribL3d(" << index << ", " << x << ", " << y << ", " << z << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(index), CallTrace::pack(x), CallTrace::pack(y), CallTrace::pack(z) };
+		m_callTrace->record(s_glVertexAttribL3dTraceInfo, traceArgs);
+	}
 	m_gl.vertexAttribL3d(index, x, y, z);
 }
 
@@ -6440,6 +10907,11 @@ void CallLogWrapper::glVertexAttribL3dv (glw::GLuint index, const glw::GLdouble
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glVertexAttribL3dv(" << index << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(v))) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(index), CallTrace::pack(v) };
+		m_callTrace->record(s_glVertexAttribL3dvTraceInfo, traceArgs);
+	}
 	m_gl.vertexAttribL3dv(index, v);
 }
 
@@ -6447,6 +10919,11 @@ void CallLogWrapper::glVertexAttribL4d (glw::GLuint index, glw::GLdouble x, glw:
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glVertexAttribL4d(" << index << ", " << x << ", " << y << ", " << z << ", " << w << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(index), CallTrace::pack(x), CallTrace::pack(y), CallTrace::pack(z), CallTrace::pack(w) };
+		m_callTrace->record(s_glVertexAttribL4dTraceInfo, traceArgs);
+	}
 	m_gl.vertexAttribL4d(index, x, y, z, w);
 }
 
@@ -6454,6 +10931,11 @@ void CallLogWrapper::glVertexAttribL4dv (glw::GLuint index, const glw::GLdouble
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glVertexAttribL4dv(" << index << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(v))) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(index), CallTrace::pack(v) };
+		m_callTrace->record(s_glVertexAttribL4dvTraceInfo, traceArgs);
+	}
 	m_gl.vertexAttribL4dv(index, v);
 }
 
@@ -6461,6 +10943,11 @@ void CallLogWrapper::glVertexAttribLFormat (glw::GLuint attribindex, glw::GLint
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glVertexAttribLFormat(" << attribindex << ", " << size << ", " << toHex(type) << ", " << relativeoffset << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(attribindex), CallTrace::pack(size), CallTrace::pack(type), CallTrace::pack(relativeoffset) };
+		m_callTrace->record(s_glVertexAttribLFormatTraceInfo, traceArgs);
+	}
 	m_gl.vertexAttribLFormat(attribindex, size, type, relativeoffset);
 }
 
@@ -6468,6 +10955,11 @@ void CallLogWrapper::glVertexAttribLPointer (glw::GLuint index, glw::GLint size,
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glVertexAttribLPointer(" << index << ", " << size << ", " << toHex(type) << ", " << stride << ", " << pointer << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(index), CallTrace::pack(size), CallTrace::pack(type), CallTrace::pack(stride), CallTrace::pack(pointer) };
+		m_callTrace->record(s_glVertexAttribLPointerTraceInfo, traceArgs);
+	}
 	m_gl.vertexAttribLPointer(index, size, type, stride, pointer);
 }
 
@@ -6475,6 +10967,11 @@ void CallLogWrapper::glVertexAttribP1ui (glw::GLuint index, glw::GLenum type, gl
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glVertexAttribP1ui(" << index << ", " << toHex(type) << ", " << getBooleanStr(normalized) << ", " << value << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(index), CallTrace::pack(type), CallTrace::pack(normalized), CallTrace::pack(value) };
+		m_callTrace->record(s_glVertexAttribP1uiTraceInfo, traceArgs);
+	}
 	m_gl.vertexAttribP1ui(index, type, normalized, value);
 }
 
@@ -6482,6 +10979,11 @@ void CallLogWrapper::glVertexAttribP1uiv (glw::GLuint index, glw::GLenum type, g
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glVertexAttribP1uiv(" << index << ", " << toHex(type) << ", " << getBooleanStr(normalized) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(value))) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(index), CallTrace::pack(type), CallTrace::pack(normalized), CallTrace::pack(value) };
+		m_callTrace->record(s_glVertexAttribP1uivTraceInfo, traceArgs);
+	}
 	m_gl.vertexAttribP1uiv(index, type, normalized, value);
 }
 
@@ -6489,6 +10991,11 @@ void CallLogWrapper::glVertexAttribP2ui (glw::GLuint index, glw::GLenum type, gl
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glVertexAttribP2ui(" << index << ", " << toHex(type) << ", " << getBooleanStr(normalized) << ", " << value << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(index), CallTrace::pack(type), CallTrace::pack(normalized), CallTrace::pack(value) };
+		m_callTrace->record(s_glVertexAttribP2uiTraceInfo, traceArgs);
+	}
 	m_gl.vertexAttribP2ui(index, type, normalized, value);
 }
 
@@ -6496,6 +11003,11 @@ void CallLogWrapper::glVertexAttribP2uiv (glw::GLuint index, glw::GLenum type, g
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glVertexAttribP2uiv(" << index << ", " << toHex(type) << ", " << getBooleanStr(normalized) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(value))) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(index), CallTrace::pack(type), CallTrace::pack(normalized), CallTrace::pack(value) };
+		m_callTrace->record(s_glVertexAttribP2uivTraceInfo, traceArgs);
+	}
 	m_gl.vertexAttribP2uiv(index, type, normalized, value);
 }
 
@@ -6503,6 +11015,11 @@ void CallLogWrapper::glVertexAttribP3ui (glw::GLuint index, glw::GLenum type, gl
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glVertexAttribP3ui(" << index << ", " << toHex(type) << ", " << getBooleanStr(normalized) << ", " << value << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(index), CallTrace::pack(type), CallTrace::pack(normalized), CallTrace::pack(value) };
+		m_callTrace->record(s_glVertexAttribP3uiTraceInfo, traceArgs);
+	}
 	m_gl.vertexAttribP3ui(index, type, normalized, value);
 }
 
@@ -6510,6 +11027,11 @@ void CallLogWrapper::glVertexAttribP3uiv (glw::GLuint index, glw::GLenum type, g
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glVertexAttribP3uiv(" << index << ", " << toHex(type) << ", " << getBooleanStr(normalized) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(value))) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(index), CallTrace::pack(type), CallTrace::pack(normalized), CallTrace::pack(value) };
+		m_callTrace->record(s_glVertexAttribP3uivTraceInfo, traceArgs);
+	}
 	m_gl.vertexAttribP3uiv(index, type, normalized, value);
 }
 
@@ -6517,6 +11039,11 @@ void CallLogWrapper::glVertexAttribP4ui (glw::GLuint index, glw::GLenum type, gl
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glVertexAttribP4ui(" << index << ", " << toHex(type) << ", " << getBooleanStr(normalized) << ", " << value << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(index), CallTrace::pack(type), CallTrace::pack(normalized), CallTrace::pack(value) };
+		m_callTrace->record(s_glVertexAttribP4uiTraceInfo, traceArgs);
+	}
 	m_gl.vertexAttribP4ui(index, type, normalized, value);
 }
 
@@ -6524,6 +11051,11 @@ void CallLogWrapper::glVertexAttribP4uiv (glw::GLuint index, glw::GLenum type, g
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glVertexAttribP4uiv(" << index << ", " << toHex(type) << ", " << getBooleanStr(normalized) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(value))) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(index), CallTrace::pack(type), CallTrace::pack(normalized), CallTrace::pack(value) };
+		m_callTrace->record(s_glVertexAttribP4uivTraceInfo, traceArgs);
+	}
 	m_gl.vertexAttribP4uiv(index, type, normalized, value);
 }
 
@@ -6531,6 +11063,11 @@ void CallLogWrapper::glVertexAttribPointer (glw::GLuint index, glw::GLint size,
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glVertexAttribPointer(" << index << ", " << size << ", " << getTypeStr(type) << ", " << getBooleanStr(normalized) << ", " << stride << ", " << pointer << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(index), CallTrace::pack(size), CallTrace::pack(type), CallTrace::pack(normalized), CallTrace::pack(stride), CallTrace::pack(pointer) };
+		m_callTrace->record(s_glVertexAttribPointerTraceInfo, traceArgs);
+	}
 	m_gl.vertexAttribPointer(index, size, type, normalized, stride, pointer);
 }
 
@@ -6538,6 +11075,11 @@ void CallLogWrapper::glVertexBindingDivisor (glw::GLuint bindingindex, glw::GLui
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glVertexBindingDivisor(" << bindingindex << ", " << divisor << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(bindingindex), CallTrace::pack(divisor) };
+		m_callTrace->record(s_glVertexBindingDivisorTraceInfo, traceArgs);
+	}
 	m_gl.vertexBindingDivisor(bindingindex, divisor);
 }
 
@@ -6545,6 +11087,11 @@ void CallLogWrapper::glViewport (glw::GLint x, glw::GLint y, glw::GLsizei width,
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glViewport(" << x << ", " << y << ", " << width << ", " << height << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(x), CallTrace::pack(y), CallTrace::pack(width), CallTrace::pack(height) };
+		m_callTrace->record(s_glViewportTraceInfo, traceArgs);
+	}
 	m_gl.viewport(x, y, width, height);
 }
 
@@ -6552,6 +11099,11 @@ void CallLogWrapper::glViewportArrayv (glw::GLuint first, glw::GLsizei count, co
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glViewportArrayv(" << first << ", " << count << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(v))) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(first), CallTrace::pack(count), CallTrace::pack(v) };
+		m_callTrace->record(s_glViewportArrayvTraceInfo, traceArgs);
+	}
 	m_gl.viewportArrayv(first, count, v);
 }
 
@@ -6559,6 +11111,11 @@ void CallLogWrapper::glViewportIndexedf (glw::GLuint index, glw::GLfloat x, glw:
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glViewportIndexedf(" << index << ", " << x << ", " << y << ", " << w << ", " << h << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(index), CallTrace::pack(x), CallTrace::pack(y), CallTrace::pack(w), CallTrace::pack(h) };
+		m_callTrace->record(s_glViewportIndexedfTraceInfo, traceArgs);
+	}
 	m_gl.viewportIndexedf(index, x, y, w, h);
 }
 
@@ -6566,6 +11123,11 @@ void CallLogWrapper::glViewportIndexedfv (glw::GLuint index, const glw::GLfloat
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glViewportIndexedfv(" << index << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(v))) << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(index), CallTrace::pack(v) };
+		m_callTrace->record(s_glViewportIndexedfvTraceInfo, traceArgs);
+	}
 	m_gl.viewportIndexedfv(index, v);
 }
 
@@ -6573,5 +11135,10 @@ void CallLogWrapper::glWaitSync (glw::GLsync sync, glw::GLbitfield flags, glw::G
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glWaitSync(" << sync << ", " << toHex(flags) << ", " << timeout << ");" << TestLog::EndMessage;
+	if (m_callTrace)
+	{
+		const deUint64 traceArgs[] = { CallTrace::pack(sync), CallTrace::pack(flags), CallTrace::pack(timeout) };
+		m_callTrace->record(s_glWaitSyncTraceInfo, traceArgs);
+	}
 	m_gl.waitSync(sync, flags, timeout);
 }
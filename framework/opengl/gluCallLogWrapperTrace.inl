@@ -0,0 +1,1064 @@
+/* WARNING: This is auto-generated file. Do not modify, since changes will
+ * be lost! Modify the generating script instead.
+ *
+ * Generated from Khronos GL API description (gl.xml) revision b7aee529f02340247e45621e9dbd054817d39c71.
+ */
+static const CallTrace::FuncInfo		s_glActiveShaderProgramTraceInfo							= { "glActiveShaderProgram", "vuu", 2, DE_NULL };
+static const CallTrace::FuncInfo		s_glActiveTextureTraceInfo									= { "glActiveTexture", "vx", 1, DE_NULL };
+static const CallTrace::FuncInfo		s_glAttachShaderTraceInfo									= { "glAttachShader", "vuu", 2, DE_NULL };
+static const CallTrace::FuncInfo		s_glBeginConditionalRenderTraceInfo							= { "glBeginConditionalRender", "vux", 2, DE_NULL };
+static const CallTrace::GetEnumNameFunc	s_glBeginQueryTraceEnums[]									= { DE_NULL, getQueryTargetName, DE_NULL };
+static const CallTrace::FuncInfo		s_glBeginQueryTraceInfo										= { "glBeginQuery", "vxu", 2, s_glBeginQueryTraceEnums };
+static const CallTrace::FuncInfo		s_glBeginQueryIndexedTraceInfo								= { "glBeginQueryIndexed", "vxuu", 3, DE_NULL };
+static const CallTrace::GetEnumNameFunc	s_glBeginTransformFeedbackTraceEnums[]						= { DE_NULL, getPrimitiveTypeName };
+static const CallTrace::FuncInfo		s_glBeginTransformFeedbackTraceInfo							= { "glBeginTransformFeedback", "vx", 1, s_glBeginTransformFeedbackTraceEnums };
+static const CallTrace::FuncInfo		s_glBindAttribLocationTraceInfo								= { "glBindAttribLocation", "vuup", 3, DE_NULL };
+static const CallTrace::GetEnumNameFunc	s_glBindBufferTraceEnums[]									= { DE_NULL, getBufferTargetName, DE_NULL };
+static const CallTrace::FuncInfo		s_glBindBufferTraceInfo										= { "glBindBuffer", "vxu", 2, s_glBindBufferTraceEnums };
+static const CallTrace::GetEnumNameFunc	s_glBindBufferBaseTraceEnums[]								= { DE_NULL, getBufferTargetName, DE_NULL, DE_NULL };
+static const CallTrace::FuncInfo		s_glBindBufferBaseTraceInfo									= { "glBindBufferBase", "vxuu", 3, s_glBindBufferBaseTraceEnums };
+static const CallTrace::GetEnumNameFunc	s_glBindBufferRangeTraceEnums[]								= { DE_NULL, getBufferTargetName, DE_NULL, DE_NULL, DE_NULL, DE_NULL };
+static const CallTrace::FuncInfo		s_glBindBufferRangeTraceInfo								= { "glBindBufferRange", "vxuuii", 5, s_glBindBufferRangeTraceEnums };
+static const CallTrace::FuncInfo		s_glBindBuffersBaseTraceInfo								= { "glBindBuffersBase", "vxuip", 4, DE_NULL };
+static const CallTrace::FuncInfo		s_glBindBuffersRangeTraceInfo								= { "glBindBuffersRange", "vxuippp", 6, DE_NULL };
+static const CallTrace::FuncInfo		s_glBindFragDataLocationTraceInfo							= { "glBindFragDataLocation", "vuup", 3, DE_NULL };
+static const CallTrace::FuncInfo		s_glBindFragDataLocationIndexedTraceInfo					= { "glBindFragDataLocationIndexed", "vuuup", 4, DE_NULL };
+static const CallTrace::GetEnumNameFunc	s_glBindFramebufferTraceEnums[]								= { DE_NULL, getFramebufferTargetName, DE_NULL };
+static const CallTrace::FuncInfo		s_glBindFramebufferTraceInfo								= { "glBindFramebuffer", "vxu", 2, s_glBindFramebufferTraceEnums };
+static const CallTrace::GetEnumNameFunc	s_glBindImageTextureTraceEnums[]							= { DE_NULL, DE_NULL, DE_NULL, DE_NULL, DE_NULL, DE_NULL, getImageAccessName, getUncompressedTextureFormatName };
+static const CallTrace::FuncInfo		s_glBindImageTextureTraceInfo								= { "glBindImageTexture", "vuuibixx", 7, s_glBindImageTextureTraceEnums };
+static const CallTrace::FuncInfo		s_glBindImageTexturesTraceInfo								= { "glBindImageTextures", "vuip", 3, DE_NULL };
+static const CallTrace::FuncInfo		s_glBindMultiTextureEXTTraceInfo							= { "glBindMultiTextureEXT", "vxxu", 3, DE_NULL };
+static const CallTrace::FuncInfo		s_glBindProgramPipelineTraceInfo							= { "glBindProgramPipeline", "vu", 1, DE_NULL };
+static const CallTrace::GetEnumNameFunc	s_glBindRenderbufferTraceEnums[]							= { DE_NULL, getFramebufferTargetName, DE_NULL };
+static const CallTrace::FuncInfo		s_glBindRenderbufferTraceInfo								= { "glBindRenderbuffer", "vxu", 2, s_glBindRenderbufferTraceEnums };
+static const CallTrace::FuncInfo		s_glBindSamplerTraceInfo									= { "glBindSampler", "vuu", 2, DE_NULL };
+static const CallTrace::FuncInfo		s_glBindSamplersTraceInfo									= { "glBindSamplers", "vuip", 3, DE_NULL };
+static const CallTrace::GetEnumNameFunc	s_glBindTextureTraceEnums[]									= { DE_NULL, getTextureTargetName, DE_NULL };
+static const CallTrace::FuncInfo		s_glBindTextureTraceInfo									= { "glBindTexture", "vxu", 2, s_glBindTextureTraceEnums };
+static const CallTrace::FuncInfo		s_glBindTextureUnitTraceInfo								= { "glBindTextureUnit", "vuu", 2, DE_NULL };
+static const CallTrace::FuncInfo		s_glBindTexturesTraceInfo									= { "glBindTextures", "vuip", 3, DE_NULL };
+static const CallTrace::GetEnumNameFunc	s_glBindTransformFeedbackTraceEnums[]						= { DE_NULL, getTransformFeedbackTargetName, DE_NULL };
+static const CallTrace::FuncInfo		s_glBindTransformFeedbackTraceInfo							= { "glBindTransformFeedback", "vxu", 2, s_glBindTransformFeedbackTraceEnums };
+static const CallTrace::FuncInfo		s_glBindVertexArrayTraceInfo								= { "glBindVertexArray", "vu", 1, DE_NULL };
+static const CallTrace::FuncInfo		s_glBindVertexBufferTraceInfo								= { "glBindVertexBuffer", "vuuii", 4, DE_NULL };
+static const CallTrace::FuncInfo		s_glBindVertexBuffersTraceInfo								= { "glBindVertexBuffers", "vuippp", 5, DE_NULL };
+static const CallTrace::FuncInfo		s_glBlendBarrierTraceInfo									= { "glBlendBarrier", "v", 0, DE_NULL };
+static const CallTrace::FuncInfo		s_glBlendColorTraceInfo										= { "glBlendColor", "vffff", 4, DE_NULL };
+static const CallTrace::GetEnumNameFunc	s_glBlendEquationTraceEnums[]								= { DE_NULL, getBlendEquationName };
+static const CallTrace::FuncInfo		s_glBlendEquationTraceInfo									= { "glBlendEquation", "vx", 1, s_glBlendEquationTraceEnums };
+static const CallTrace::GetEnumNameFunc	s_glBlendEquationSeparateTraceEnums[]						= { DE_NULL, getBlendEquationName, getBlendEquationName };
+static const CallTrace::FuncInfo		s_glBlendEquationSeparateTraceInfo							= { "glBlendEquationSeparate", "vxx", 2, s_glBlendEquationSeparateTraceEnums };
+static const CallTrace::GetEnumNameFunc	s_glBlendEquationSeparateiTraceEnums[]						= { DE_NULL, DE_NULL, getBlendEquationName, getBlendEquationName };
+static const CallTrace::FuncInfo		s_glBlendEquationSeparateiTraceInfo							= { "glBlendEquationSeparatei", "vuxx", 3, s_glBlendEquationSeparateiTraceEnums };
+static const CallTrace::GetEnumNameFunc	s_glBlendEquationiTraceEnums[]								= { DE_NULL, DE_NULL, getBlendEquationName };
+static const CallTrace::FuncInfo		s_glBlendEquationiTraceInfo									= { "glBlendEquationi", "vux", 2, s_glBlendEquationiTraceEnums };
+static const CallTrace::GetEnumNameFunc	s_glBlendFuncTraceEnums[]									= { DE_NULL, getBlendFactorName, getBlendFactorName };
+static const CallTrace::FuncInfo		s_glBlendFuncTraceInfo										= { "glBlendFunc", "vxx", 2, s_glBlendFuncTraceEnums };
+static const CallTrace::GetEnumNameFunc	s_glBlendFuncSeparateTraceEnums[]							= { DE_NULL, getBlendFactorName, getBlendFactorName, getBlendFactorName, getBlendFactorName };
+static const CallTrace::FuncInfo		s_glBlendFuncSeparateTraceInfo								= { "glBlendFuncSeparate", "vxxxx", 4, s_glBlendFuncSeparateTraceEnums };
+static const CallTrace::FuncInfo		s_glBlendFuncSeparateiTraceInfo								= { "glBlendFuncSeparatei", "vuxxxx", 5, DE_NULL };
+static const CallTrace::FuncInfo		s_glBlendFunciTraceInfo										= { "glBlendFunci", "vuxx", 3, DE_NULL };
+static const CallTrace::GetEnumNameFunc	s_glBlitFramebufferTraceEnums[]								= { DE_NULL, DE_NULL, DE_NULL, DE_NULL, DE_NULL, DE_NULL, DE_NULL, DE_NULL, DE_NULL, DE_NULL, getTextureFilterName };
+static const CallTrace::FuncInfo		s_glBlitFramebufferTraceInfo								= { "glBlitFramebuffer", "viiiiiiiixx", 10, s_glBlitFramebufferTraceEnums };
+static const CallTrace::FuncInfo		s_glBlitNamedFramebufferTraceInfo							= { "glBlitNamedFramebuffer", "vuuiiiiiiiixx", 12, DE_NULL };
+static const CallTrace::GetEnumNameFunc	s_glBufferDataTraceEnums[]									= { DE_NULL, getBufferTargetName, DE_NULL, DE_NULL, getUsageName };
+static const CallTrace::FuncInfo		s_glBufferDataTraceInfo										= { "glBufferData", "vxipx", 4, s_glBufferDataTraceEnums };
+static const CallTrace::FuncInfo		s_glBufferPageCommitmentARBTraceInfo						= { "glBufferPageCommitmentARB", "vxiib", 4, DE_NULL };
+static const CallTrace::FuncInfo		s_glBufferStorageTraceInfo									= { "glBufferStorage", "vxipx", 4, DE_NULL };
+static const CallTrace::GetEnumNameFunc	s_glBufferSubDataTraceEnums[]								= { DE_NULL, getBufferTargetName, DE_NULL, DE_NULL, DE_NULL };
+static const CallTrace::FuncInfo		s_glBufferSubDataTraceInfo									= { "glBufferSubData", "vxiip", 4, s_glBufferSubDataTraceEnums };
+static const CallTrace::GetEnumNameFunc	s_glCheckFramebufferStatusTraceEnums[]						= { getFramebufferStatusName, getFramebufferTargetName };
+static const CallTrace::FuncInfo		s_glCheckFramebufferStatusTraceInfo							= { "glCheckFramebufferStatus", "xx", 1, s_glCheckFramebufferStatusTraceEnums };
+static const CallTrace::FuncInfo		s_glCheckNamedFramebufferStatusTraceInfo					= { "glCheckNamedFramebufferStatus", "xux", 2, DE_NULL };
+static const CallTrace::FuncInfo		s_glCheckNamedFramebufferStatusEXTTraceInfo					= { "glCheckNamedFramebufferStatusEXT", "xux", 2, DE_NULL };
+static const CallTrace::FuncInfo		s_glClampColorTraceInfo										= { "glClampColor", "vxx", 2, DE_NULL };
+static const CallTrace::FuncInfo		s_glClearTraceInfo											= { "glClear", "vx", 1, DE_NULL };
+static const CallTrace::FuncInfo		s_glClearBufferDataTraceInfo								= { "glClearBufferData", "vxxxxp", 5, DE_NULL };
+static const CallTrace::FuncInfo		s_glClearBufferSubDataTraceInfo								= { "glClearBufferSubData", "vxxiixxp", 7, DE_NULL };
+static const CallTrace::GetEnumNameFunc	s_glClearBufferfiTraceEnums[]								= { DE_NULL, getBufferName, DE_NULL, DE_NULL, DE_NULL };
+static const CallTrace::FuncInfo		s_glClearBufferfiTraceInfo									= { "glClearBufferfi", "vxifi", 4, s_glClearBufferfiTraceEnums };
+static const CallTrace::GetEnumNameFunc	s_glClearBufferfvTraceEnums[]								= { DE_NULL, getBufferName, DE_NULL, DE_NULL };
+static const CallTrace::FuncInfo		s_glClearBufferfvTraceInfo									= { "glClearBufferfv", "vxip", 3, s_glClearBufferfvTraceEnums };
+static const CallTrace::GetEnumNameFunc	s_glClearBufferivTraceEnums[]								= { DE_NULL, getBufferName, DE_NULL, DE_NULL };
+static const CallTrace::FuncInfo		s_glClearBufferivTraceInfo									= { "glClearBufferiv", "vxip", 3, s_glClearBufferivTraceEnums };
+static const CallTrace::GetEnumNameFunc	s_glClearBufferuivTraceEnums[]								= { DE_NULL, getBufferName, DE_NULL, DE_NULL };
+static const CallTrace::FuncInfo		s_glClearBufferuivTraceInfo									= { "glClearBufferuiv", "vxip", 3, s_glClearBufferuivTraceEnums };
+static const CallTrace::FuncInfo		s_glClearColorTraceInfo										= { "glClearColor", "vffff", 4, DE_NULL };
+static const CallTrace::FuncInfo		s_glClearDepthTraceInfo										= { "glClearDepth", "vd", 1, DE_NULL };
+static const CallTrace::FuncInfo		s_glClearDepthfTraceInfo									= { "glClearDepthf", "vf", 1, DE_NULL };
+static const CallTrace::FuncInfo		s_glClearNamedBufferDataTraceInfo							= { "glClearNamedBufferData", "vuxxxp", 5, DE_NULL };
+static const CallTrace::FuncInfo		s_glClearNamedBufferDataEXTTraceInfo						= { "glClearNamedBufferDataEXT", "vuxxxp", 5, DE_NULL };
+static const CallTrace::FuncInfo		s_glClearNamedBufferSubDataTraceInfo						= { "glClearNamedBufferSubData", "vuxiixxp", 7, DE_NULL };
+static const CallTrace::FuncInfo		s_glClearNamedBufferSubDataEXTTraceInfo						= { "glClearNamedBufferSubDataEXT", "vuxiixxp", 7, DE_NULL };
+static const CallTrace::FuncInfo		s_glClearNamedFramebufferfiTraceInfo						= { "glClearNamedFramebufferfi", "vuxifi", 5, DE_NULL };
+static const CallTrace::FuncInfo		s_glClearNamedFramebufferfvTraceInfo						= { "glClearNamedFramebufferfv", "vuxip", 4, DE_NULL };
+static const CallTrace::FuncInfo		s_glClearNamedFramebufferivTraceInfo						= { "glClearNamedFramebufferiv", "vuxip", 4, DE_NULL };
+static const CallTrace::FuncInfo		s_glClearNamedFramebufferuivTraceInfo						= { "glClearNamedFramebufferuiv", "vuxip", 4, DE_NULL };
+static const CallTrace::FuncInfo		s_glClearStencilTraceInfo									= { "glClearStencil", "vi", 1, DE_NULL };
+static const CallTrace::FuncInfo		s_glClearTexImageTraceInfo									= { "glClearTexImage", "vuixxp", 5, DE_NULL };
+static const CallTrace::FuncInfo		s_glClearTexSubImageTraceInfo								= { "glClearTexSubImage", "vuiiiiiiixxp", 11, DE_NULL };
+static const CallTrace::FuncInfo		s_glClientAttribDefaultEXTTraceInfo							= { "glClientAttribDefaultEXT", "vx", 1, DE_NULL };
+static const CallTrace::FuncInfo		s_glClientWaitSyncTraceInfo									= { "glClientWaitSync", "xpxu", 3, DE_NULL };
+static const CallTrace::FuncInfo		s_glClipControlTraceInfo									= { "glClipControl", "vxx", 2, DE_NULL };
+static const CallTrace::FuncInfo		s_glColorMaskTraceInfo										= { "glColorMask", "vbbbb", 4, DE_NULL };
+static const CallTrace::FuncInfo		s_glColorMaskiTraceInfo										= { "glColorMaski", "vubbbb", 5, DE_NULL };
+static const CallTrace::FuncInfo		s_glCompileShaderTraceInfo									= { "glCompileShader", "vu", 1, DE_NULL };
+static const CallTrace::FuncInfo		s_glCompressedMultiTexImage1DEXTTraceInfo					= { "glCompressedMultiTexImage1DEXT", "vxxixiiip", 8, DE_NULL };
+static const CallTrace::FuncInfo		s_glCompressedMultiTexImage2DEXTTraceInfo					= { "glCompressedMultiTexImage2DEXT", "vxxixiiiip", 9, DE_NULL };
+static const CallTrace::FuncInfo		s_glCompressedMultiTexImage3DEXTTraceInfo					= { "glCompressedMultiTexImage3DEXT", "vxxixiiiiip", 10, DE_NULL };
+static const CallTrace::FuncInfo		s_glCompressedMultiTexSubImage1DEXTTraceInfo				= { "glCompressedMultiTexSubImage1DEXT", "vxxiiixip", 8, DE_NULL };
+static const CallTrace::FuncInfo		s_glCompressedMultiTexSubImage2DEXTTraceInfo				= { "glCompressedMultiTexSubImage2DEXT", "vxxiiiiixip", 10, DE_NULL };
+static const CallTrace::FuncInfo		s_glCompressedMultiTexSubImage3DEXTTraceInfo				= { "glCompressedMultiTexSubImage3DEXT", "vxxiiiiiiixip", 12, DE_NULL };
+static const CallTrace::FuncInfo		s_glCompressedTexImage1DTraceInfo							= { "glCompressedTexImage1D", "vxixiiip", 7, DE_NULL };
+static const CallTrace::GetEnumNameFunc	s_glCompressedTexImage2DTraceEnums[]						= { DE_NULL, getTextureTargetName, DE_NULL, getCompressedTextureFormatName, DE_NULL, DE_NULL, DE_NULL, DE_NULL, DE_NULL };
+static const CallTrace::FuncInfo		s_glCompressedTexImage2DTraceInfo							= { "glCompressedTexImage2D", "vxixiiiip", 8, s_glCompressedTexImage2DTraceEnums };
+static const CallTrace::GetEnumNameFunc	s_glCompressedTexImage3DTraceEnums[]						= { DE_NULL, getTextureTargetName, DE_NULL, getCompressedTextureFormatName, DE_NULL, DE_NULL, DE_NULL, DE_NULL, DE_NULL, DE_NULL };
+static const CallTrace::FuncInfo		s_glCompressedTexImage3DTraceInfo							= { "glCompressedTexImage3D", "vxixiiiiip", 9, s_glCompressedTexImage3DTraceEnums };
+static const CallTrace::FuncInfo		s_glCompressedTexImage3DOESTraceInfo						= { "glCompressedTexImage3DOES", "vxixiiiiip", 9, DE_NULL };
+static const CallTrace::FuncInfo		s_glCompressedTexSubImage1DTraceInfo						= { "glCompressedTexSubImage1D", "vxiiixip", 7, DE_NULL };
+static const CallTrace::GetEnumNameFunc	s_glCompressedTexSubImage2DTraceEnums[]						= { DE_NULL, getTextureTargetName, DE_NULL, DE_NULL, DE_NULL, DE_NULL, DE_NULL, getCompressedTextureFormatName, DE_NULL, DE_NULL };
+static const CallTrace::FuncInfo		s_glCompressedTexSubImage2DTraceInfo						= { "glCompressedTexSubImage2D", "vxiiiiixip", 9, s_glCompressedTexSubImage2DTraceEnums };
+static const CallTrace::GetEnumNameFunc	s_glCompressedTexSubImage3DTraceEnums[]						= { DE_NULL, getTextureTargetName, DE_NULL, DE_NULL, DE_NULL, DE_NULL, DE_NULL, DE_NULL, DE_NULL, getCompressedTextureFormatName, DE_NULL, DE_NULL };
+static const CallTrace::FuncInfo		s_glCompressedTexSubImage3DTraceInfo						= { "glCompressedTexSubImage3D", "vxiiiiiiixip", 11, s_glCompressedTexSubImage3DTraceEnums };
+static const CallTrace::FuncInfo		s_glCompressedTexSubImage3DOESTraceInfo						= { "glCompressedTexSubImage3DOES", "vxiiiiiiixip", 11, DE_NULL };
+static const CallTrace::FuncInfo		s_glCompressedTextureImage1DEXTTraceInfo					= { "glCompressedTextureImage1DEXT", "vuxixiiip", 8, DE_NULL };
+static const CallTrace::FuncInfo		s_glCompressedTextureImage2DEXTTraceInfo					= { "glCompressedTextureImage2DEXT", "vuxixiiiip", 9, DE_NULL };
+static const CallTrace::FuncInfo		s_glCompressedTextureImage3DEXTTraceInfo					= { "glCompressedTextureImage3DEXT", "vuxixiiiiip", 10, DE_NULL };
+static const CallTrace::FuncInfo		s_glCompressedTextureSubImage1DTraceInfo					= { "glCompressedTextureSubImage1D", "vuiiixip", 7, DE_NULL };
+static const CallTrace::FuncInfo		s_glCompressedTextureSubImage1DEXTTraceInfo					= { "glCompressedTextureSubImage1DEXT", "vuxiiixip", 8, DE_NULL };
+static const CallTrace::FuncInfo		s_glCompressedTextureSubImage2DTraceInfo					= { "glCompressedTextureSubImage2D", "vuiiiiixip", 9, DE_NULL };
+static const CallTrace::FuncInfo		s_glCompressedTextureSubImage2DEXTTraceInfo					= { "glCompressedTextureSubImage2DEXT", "vuxiiiiixip", 10, DE_NULL };
+static const CallTrace::FuncInfo		s_glCompressedTextureSubImage3DTraceInfo					= { "glCompressedTextureSubImage3D", "vuiiiiiiixip", 11, DE_NULL };
+static const CallTrace::FuncInfo		s_glCompressedTextureSubImage3DEXTTraceInfo					= { "glCompressedTextureSubImage3DEXT", "vuxiiiiiiixip", 12, DE_NULL };
+static const CallTrace::FuncInfo		s_glCopyBufferSubDataTraceInfo								= { "glCopyBufferSubData", "vxxiii", 5, DE_NULL };
+static const CallTrace::FuncInfo		s_glCopyImageSubDataTraceInfo								= { "glCopyImageSubData", "vuxiiiiuxiiiiiii", 15, DE_NULL };
+static const CallTrace::FuncInfo		s_glCopyMultiTexImage1DEXTTraceInfo							= { "glCopyMultiTexImage1DEXT", "vxxixiiii", 8, DE_NULL };
+static const CallTrace::FuncInfo		s_glCopyMultiTexImage2DEXTTraceInfo							= { "glCopyMultiTexImage2DEXT", "vxxixiiiii", 9, DE_NULL };
+static const CallTrace::FuncInfo		s_glCopyMultiTexSubImage1DEXTTraceInfo						= { "glCopyMultiTexSubImage1DEXT", "vxxiiiii", 7, DE_NULL };
+static const CallTrace::FuncInfo		s_glCopyMultiTexSubImage2DEXTTraceInfo						= { "glCopyMultiTexSubImage2DEXT", "vxxiiiiiii", 9, DE_NULL };
+static const CallTrace::FuncInfo		s_glCopyMultiTexSubImage3DEXTTraceInfo						= { "glCopyMultiTexSubImage3DEXT", "vxxiiiiiiii", 10, DE_NULL };
+static const CallTrace::FuncInfo		s_glCopyNamedBufferSubDataTraceInfo							= { "glCopyNamedBufferSubData", "vuuiii", 5, DE_NULL };
+static const CallTrace::GetEnumNameFunc	s_glCopyTexImage1DTraceEnums[]								= { DE_NULL, getTextureTargetName, DE_NULL, getUncompressedTextureFormatName, DE_NULL, DE_NULL, DE_NULL, DE_NULL };
+static const CallTrace::FuncInfo		s_glCopyTexImage1DTraceInfo									= { "glCopyTexImage1D", "vxixiiii", 7, s_glCopyTexImage1DTraceEnums };
+static const CallTrace::GetEnumNameFunc	s_glCopyTexImage2DTraceEnums[]								= { DE_NULL, getTextureTargetName, DE_NULL, getUncompressedTextureFormatName, DE_NULL, DE_NULL, DE_NULL, DE_NULL, DE_NULL };
+static const CallTrace::FuncInfo		s_glCopyTexImage2DTraceInfo									= { "glCopyTexImage2D", "vxixiiiii", 8, s_glCopyTexImage2DTraceEnums };
+static const CallTrace::FuncInfo		s_glCopyTexSubImage1DTraceInfo								= { "glCopyTexSubImage1D", "vxiiiii", 6, DE_NULL };
+static const CallTrace::FuncInfo		s_glCopyTexSubImage2DTraceInfo								= { "glCopyTexSubImage2D", "vxiiiiiii", 8, DE_NULL };
+static const CallTrace::FuncInfo		s_glCopyTexSubImage3DTraceInfo								= { "glCopyTexSubImage3D", "vxiiiiiiii", 9, DE_NULL };
+static const CallTrace::FuncInfo		s_glCopyTexSubImage3DOESTraceInfo							= { "glCopyTexSubImage3DOES", "vxiiiiiiii", 9, DE_NULL };
+static const CallTrace::FuncInfo		s_glCopyTextureImage1DEXTTraceInfo							= { "glCopyTextureImage1DEXT", "vuxixiiii", 8, DE_NULL };
+static const CallTrace::FuncInfo		s_glCopyTextureImage2DEXTTraceInfo							= { "glCopyTextureImage2DEXT", "vuxixiiiii", 9, DE_NULL };
+static const CallTrace::FuncInfo		s_glCopyTextureSubImage1DTraceInfo							= { "glCopyTextureSubImage1D", "vuiiiii", 6, DE_NULL };
+static const CallTrace::FuncInfo		s_glCopyTextureSubImage1DEXTTraceInfo						= { "glCopyTextureSubImage1DEXT", "vuxiiiii", 7, DE_NULL };
+static const CallTrace::FuncInfo		s_glCopyTextureSubImage2DTraceInfo							= { "glCopyTextureSubImage2D", "vuiiiiiii", 8, DE_NULL };
+static const CallTrace::FuncInfo		s_glCopyTextureSubImage2DEXTTraceInfo						= { "glCopyTextureSubImage2DEXT", "vuxiiiiiii", 9, DE_NULL };
+static const CallTrace::FuncInfo		s_glCopyTextureSubImage3DTraceInfo							= { "glCopyTextureSubImage3D", "vuiiiiiiii", 9, DE_NULL };
+static const CallTrace::FuncInfo		s_glCopyTextureSubImage3DEXTTraceInfo						= { "glCopyTextureSubImage3DEXT", "vuxiiiiiiii", 10, DE_NULL };
+static const CallTrace::FuncInfo		s_glCreateBuffersTraceInfo									= { "glCreateBuffers", "vip", 2, DE_NULL };
+static const CallTrace::FuncInfo		s_glCreateFramebuffersTraceInfo								= { "glCreateFramebuffers", "vip", 2, DE_NULL };
+static const CallTrace::FuncInfo		s_glCreateProgramTraceInfo									= { "glCreateProgram", "u", 0, DE_NULL };
+static const CallTrace::FuncInfo		s_glCreateProgramPipelinesTraceInfo							= { "glCreateProgramPipelines", "vip", 2, DE_NULL };
+static const CallTrace::FuncInfo		s_glCreateQueriesTraceInfo									= { "glCreateQueries", "vxip", 3, DE_NULL };
+static const CallTrace::FuncInfo		s_glCreateRenderbuffersTraceInfo							= { "glCreateRenderbuffers", "vip", 2, DE_NULL };
+static const CallTrace::FuncInfo		s_glCreateSamplersTraceInfo									= { "glCreateSamplers", "vip", 2, DE_NULL };
+static const CallTrace::GetEnumNameFunc	s_glCreateShaderTraceEnums[]								= { DE_NULL, getShaderTypeName };
+static const CallTrace::FuncInfo		s_glCreateShaderTraceInfo									= { "glCreateShader", "ux", 1, s_glCreateShaderTraceEnums };
+static const CallTrace::FuncInfo		s_glCreateShaderProgramvTraceInfo							= { "glCreateShaderProgramv", "uxip", 3, DE_NULL };
+static const CallTrace::FuncInfo		s_glCreateTexturesTraceInfo									= { "glCreateTextures", "vxip", 3, DE_NULL };
+static const CallTrace::FuncInfo		s_glCreateTransformFeedbacksTraceInfo						= { "glCreateTransformFeedbacks", "vip", 2, DE_NULL };
+static const CallTrace::FuncInfo		s_glCreateVertexArraysTraceInfo								= { "glCreateVertexArrays", "vip", 2, DE_NULL };
+static const CallTrace::GetEnumNameFunc	s_glCullFaceTraceEnums[]									= { DE_NULL, getFaceName };
+static const CallTrace::FuncInfo		s_glCullFaceTraceInfo										= { "glCullFace", "vx", 1, s_glCullFaceTraceEnums };
+static const CallTrace::FuncInfo		s_glDebugMessageCallbackTraceInfo							= { "glDebugMessageCallback", "vpp", 2, DE_NULL };
+static const CallTrace::GetEnumNameFunc	s_glDebugMessageControlTraceEnums[]							= { DE_NULL, getDebugMessageSourceName, getDebugMessageTypeName, getDebugMessageSeverityName, DE_NULL, DE_NULL, DE_NULL };
+static const CallTrace::FuncInfo		s_glDebugMessageControlTraceInfo							= { "glDebugMessageControl", "vxxxipb", 6, s_glDebugMessageControlTraceEnums };
+static const CallTrace::GetEnumNameFunc	s_glDebugMessageInsertTraceEnums[]							= { DE_NULL, getDebugMessageSourceName, getDebugMessageTypeName, DE_NULL, getDebugMessageSeverityName, DE_NULL, DE_NULL };
+static const CallTrace::FuncInfo		s_glDebugMessageInsertTraceInfo								= { "glDebugMessageInsert", "vxxuxip", 6, s_glDebugMessageInsertTraceEnums };
+static const CallTrace::FuncInfo		s_glDeleteBuffersTraceInfo									= { "glDeleteBuffers", "vip", 2, DE_NULL };
+static const CallTrace::FuncInfo		s_glDeleteFramebuffersTraceInfo								= { "glDeleteFramebuffers", "vip", 2, DE_NULL };
+static const CallTrace::FuncInfo		s_glDeleteProgramTraceInfo									= { "glDeleteProgram", "vu", 1, DE_NULL };
+static const CallTrace::FuncInfo		s_glDeleteProgramPipelinesTraceInfo							= { "glDeleteProgramPipelines", "vip", 2, DE_NULL };
+static const CallTrace::FuncInfo		s_glDeleteQueriesTraceInfo									= { "glDeleteQueries", "vip", 2, DE_NULL };
+static const CallTrace::FuncInfo		s_glDeleteRenderbuffersTraceInfo							= { "glDeleteRenderbuffers", "vip", 2, DE_NULL };
+static const CallTrace::FuncInfo		s_glDeleteSamplersTraceInfo									= { "glDeleteSamplers", "vip", 2, DE_NULL };
+static const CallTrace::FuncInfo		s_glDeleteShaderTraceInfo									= { "glDeleteShader", "vu", 1, DE_NULL };
+static const CallTrace::FuncInfo		s_glDeleteSyncTraceInfo										= { "glDeleteSync", "vp", 1, DE_NULL };
+static const CallTrace::FuncInfo		s_glDeleteTexturesTraceInfo									= { "glDeleteTextures", "vip", 2, DE_NULL };
+static const CallTrace::FuncInfo		s_glDeleteTransformFeedbacksTraceInfo						= { "glDeleteTransformFeedbacks", "vip", 2, DE_NULL };
+static const CallTrace::FuncInfo		s_glDeleteVertexArraysTraceInfo								= { "glDeleteVertexArrays", "vip", 2, DE_NULL };
+static const CallTrace::FuncInfo		s_glDepthBoundsEXTTraceInfo									= { "glDepthBoundsEXT", "vdd", 2, DE_NULL };
+static const CallTrace::GetEnumNameFunc	s_glDepthFuncTraceEnums[]									= { DE_NULL, getCompareFuncName };
+static const CallTrace::FuncInfo		s_glDepthFuncTraceInfo										= { "glDepthFunc", "vx", 1, s_glDepthFuncTraceEnums };
+static const CallTrace::FuncInfo		s_glDepthMaskTraceInfo										= { "glDepthMask", "vb", 1, DE_NULL };
+static const CallTrace::FuncInfo		s_glDepthRangeTraceInfo										= { "glDepthRange", "vdd", 2, DE_NULL };
+static const CallTrace::FuncInfo		s_glDepthRangeArrayfvOESTraceInfo							= { "glDepthRangeArrayfvOES", "vuip", 3, DE_NULL };
+static const CallTrace::FuncInfo		s_glDepthRangeArrayvTraceInfo								= { "glDepthRangeArrayv", "vuip", 3, DE_NULL };
+static const CallTrace::FuncInfo		s_glDepthRangeIndexedTraceInfo								= { "glDepthRangeIndexed", "vudd", 3, DE_NULL };
+static const CallTrace::FuncInfo		s_glDepthRangeIndexedfOESTraceInfo							= { "glDepthRangeIndexedfOES", "vuff", 3, DE_NULL };
+static const CallTrace::FuncInfo		s_glDepthRangefTraceInfo									= { "glDepthRangef", "vff", 2, DE_NULL };
+static const CallTrace::FuncInfo		s_glDetachShaderTraceInfo									= { "glDetachShader", "vuu", 2, DE_NULL };
+static const CallTrace::GetEnumNameFunc	s_glDisableTraceEnums[]										= { DE_NULL, getEnableCapName };
+static const CallTrace::FuncInfo		s_glDisableTraceInfo										= { "glDisable", "vx", 1, s_glDisableTraceEnums };
+static const CallTrace::FuncInfo		s_glDisableClientStateIndexedEXTTraceInfo					= { "glDisableClientStateIndexedEXT", "vxu", 2, DE_NULL };
+static const CallTrace::FuncInfo		s_glDisableClientStateiEXTTraceInfo							= { "glDisableClientStateiEXT", "vxu", 2, DE_NULL };
+static const CallTrace::FuncInfo		s_glDisableVertexArrayAttribTraceInfo						= { "glDisableVertexArrayAttrib", "vuu", 2, DE_NULL };
+static const CallTrace::FuncInfo		s_glDisableVertexArrayAttribEXTTraceInfo					= { "glDisableVertexArrayAttribEXT", "vuu", 2, DE_NULL };
+static const CallTrace::FuncInfo		s_glDisableVertexArrayEXTTraceInfo							= { "glDisableVertexArrayEXT", "vux", 2, DE_NULL };
+static const CallTrace::FuncInfo		s_glDisableVertexAttribArrayTraceInfo						= { "glDisableVertexAttribArray", "vu", 1, DE_NULL };
+static const CallTrace::GetEnumNameFunc	s_glDisableiTraceEnums[]									= { DE_NULL, getIndexedEnableCapName, DE_NULL };
+static const CallTrace::FuncInfo		s_glDisableiTraceInfo										= { "glDisablei", "vxu", 2, s_glDisableiTraceEnums };
+static const CallTrace::FuncInfo		s_glDispatchComputeTraceInfo								= { "glDispatchCompute", "vuuu", 3, DE_NULL };
+static const CallTrace::FuncInfo		s_glDispatchComputeIndirectTraceInfo						= { "glDispatchComputeIndirect", "vi", 1, DE_NULL };
+static const CallTrace::GetEnumNameFunc	s_glDrawArraysTraceEnums[]									= { DE_NULL, getPrimitiveTypeName, DE_NULL, DE_NULL };
+static const CallTrace::FuncInfo		s_glDrawArraysTraceInfo										= { "glDrawArrays", "vxii", 3, s_glDrawArraysTraceEnums };
+static const CallTrace::GetEnumNameFunc	s_glDrawArraysIndirectTraceEnums[]							= { DE_NULL, getPrimitiveTypeName, DE_NULL };
+static const CallTrace::FuncInfo		s_glDrawArraysIndirectTraceInfo								= { "glDrawArraysIndirect", "vxp", 2, s_glDrawArraysIndirectTraceEnums };
+static const CallTrace::GetEnumNameFunc	s_glDrawArraysInstancedTraceEnums[]							= { DE_NULL, getPrimitiveTypeName, DE_NULL, DE_NULL, DE_NULL };
+static const CallTrace::FuncInfo		s_glDrawArraysInstancedTraceInfo							= { "glDrawArraysInstanced", "vxiii", 4, s_glDrawArraysInstancedTraceEnums };
+static const CallTrace::FuncInfo		s_glDrawArraysInstancedBaseInstanceTraceInfo				= { "glDrawArraysInstancedBaseInstance", "vxiiiu", 5, DE_NULL };
+static const CallTrace::FuncInfo		s_glDrawBufferTraceInfo										= { "glDrawBuffer", "vx", 1, DE_NULL };
+static const CallTrace::FuncInfo		s_glDrawBuffersTraceInfo									= { "glDrawBuffers", "vip", 2, DE_NULL };
+static const CallTrace::GetEnumNameFunc	s_glDrawElementsTraceEnums[]								= { DE_NULL, getPrimitiveTypeName, DE_NULL, getTypeName, DE_NULL };
+static const CallTrace::FuncInfo		s_glDrawElementsTraceInfo									= { "glDrawElements", "vxixp", 4, s_glDrawElementsTraceEnums };
+static const CallTrace::GetEnumNameFunc	s_glDrawElementsBaseVertexTraceEnums[]						= { DE_NULL, getPrimitiveTypeName, DE_NULL, getTypeName, DE_NULL, DE_NULL };
+static const CallTrace::FuncInfo		s_glDrawElementsBaseVertexTraceInfo							= { "glDrawElementsBaseVertex", "vxixpi", 5, s_glDrawElementsBaseVertexTraceEnums };
+static const CallTrace::GetEnumNameFunc	s_glDrawElementsIndirectTraceEnums[]						= { DE_NULL, getPrimitiveTypeName, getTypeName, DE_NULL };
+static const CallTrace::FuncInfo		s_glDrawElementsIndirectTraceInfo							= { "glDrawElementsIndirect", "vxxp", 3, s_glDrawElementsIndirectTraceEnums };
+static const CallTrace::GetEnumNameFunc	s_glDrawElementsInstancedTraceEnums[]						= { DE_NULL, getPrimitiveTypeName, DE_NULL, getTypeName, DE_NULL, DE_NULL };
+static const CallTrace::FuncInfo		s_glDrawElementsInstancedTraceInfo							= { "glDrawElementsInstanced", "vxixpi", 5, s_glDrawElementsInstancedTraceEnums };
+static const CallTrace::FuncInfo		s_glDrawElementsInstancedBaseInstanceTraceInfo				= { "glDrawElementsInstancedBaseInstance", "vxixpiu", 6, DE_NULL };
+static const CallTrace::GetEnumNameFunc	s_glDrawElementsInstancedBaseVertexTraceEnums[]				= { DE_NULL, getPrimitiveTypeName, DE_NULL, getTypeName, DE_NULL, DE_NULL, DE_NULL };
+static const CallTrace::FuncInfo		s_glDrawElementsInstancedBaseVertexTraceInfo				= { "glDrawElementsInstancedBaseVertex", "vxixpii", 6, s_glDrawElementsInstancedBaseVertexTraceEnums };
+static const CallTrace::FuncInfo		s_glDrawElementsInstancedBaseVertexBaseInstanceTraceInfo	= { "glDrawElementsInstancedBaseVertexBaseInstance", "vxixpiiu", 7, DE_NULL };
+static const CallTrace::GetEnumNameFunc	s_glDrawRangeElementsTraceEnums[]							= { DE_NULL, getPrimitiveTypeName, DE_NULL, DE_NULL, DE_NULL, getTypeName, DE_NULL };
+static const CallTrace::FuncInfo		s_glDrawRangeElementsTraceInfo								= { "glDrawRangeElements", "vxuuixp", 6, s_glDrawRangeElementsTraceEnums };
+static const CallTrace::GetEnumNameFunc	s_glDrawRangeElementsBaseVertexTraceEnums[]					= { DE_NULL, getPrimitiveTypeName, DE_NULL, DE_NULL, DE_NULL, getTypeName, DE_NULL, DE_NULL };
+static const CallTrace::FuncInfo		s_glDrawRangeElementsBaseVertexTraceInfo					= { "glDrawRangeElementsBaseVertex", "vxuuixpi", 7, s_glDrawRangeElementsBaseVertexTraceEnums };
+static const CallTrace::FuncInfo		s_glDrawTransformFeedbackTraceInfo							= { "glDrawTransformFeedback", "vxu", 2, DE_NULL };
+static const CallTrace::FuncInfo		s_glDrawTransformFeedbackInstancedTraceInfo					= { "glDrawTransformFeedbackInstanced", "vxui", 3, DE_NULL };
+static const CallTrace::FuncInfo		s_glDrawTransformFeedbackStreamTraceInfo					= { "glDrawTransformFeedbackStream", "vxuu", 3, DE_NULL };
+static const CallTrace::FuncInfo		s_glDrawTransformFeedbackStreamInstancedTraceInfo			= { "glDrawTransformFeedbackStreamInstanced", "vxuui", 4, DE_NULL };
+static const CallTrace::FuncInfo		s_glEGLImageTargetRenderbufferStorageOESTraceInfo			= { "glEGLImageTargetRenderbufferStorageOES", "vxp", 2, DE_NULL };
+static const CallTrace::FuncInfo		s_glEGLImageTargetTexture2DOESTraceInfo						= { "glEGLImageTargetTexture2DOES", "vxp", 2, DE_NULL };
+static const CallTrace::GetEnumNameFunc	s_glEnableTraceEnums[]										= { DE_NULL, getEnableCapName };
+static const CallTrace::FuncInfo		s_glEnableTraceInfo											= { "glEnable", "vx", 1, s_glEnableTraceEnums };
+static const CallTrace::FuncInfo		s_glEnableClientStateIndexedEXTTraceInfo					= { "glEnableClientStateIndexedEXT", "vxu", 2, DE_NULL };
+static const CallTrace::FuncInfo		s_glEnableClientStateiEXTTraceInfo							= { "glEnableClientStateiEXT", "vxu", 2, DE_NULL };
+static const CallTrace::FuncInfo		s_glEnableVertexArrayAttribTraceInfo						= { "glEnableVertexArrayAttrib", "vuu", 2, DE_NULL };
+static const CallTrace::FuncInfo		s_glEnableVertexArrayAttribEXTTraceInfo						= { "glEnableVertexArrayAttribEXT", "vuu", 2, DE_NULL };
+static const CallTrace::FuncInfo		s_glEnableVertexArrayEXTTraceInfo							= { "glEnableVertexArrayEXT", "vux", 2, DE_NULL };
+static const CallTrace::FuncInfo		s_glEnableVertexAttribArrayTraceInfo						= { "glEnableVertexAttribArray", "vu", 1, DE_NULL };
+static const CallTrace::GetEnumNameFunc	s_glEnableiTraceEnums[]										= { DE_NULL, getIndexedEnableCapName, DE_NULL };
+static const CallTrace::FuncInfo		s_glEnableiTraceInfo										= { "glEnablei", "vxu", 2, s_glEnableiTraceEnums };
+static const CallTrace::FuncInfo		s_glEndConditionalRenderTraceInfo							= { "glEndConditionalRender", "v", 0, DE_NULL };
+static const CallTrace::GetEnumNameFunc	s_glEndQueryTraceEnums[]									= { DE_NULL, getQueryTargetName };
+static const CallTrace::FuncInfo		s_glEndQueryTraceInfo										= { "glEndQuery", "vx", 1, s_glEndQueryTraceEnums };
+static const CallTrace::FuncInfo		s_glEndQueryIndexedTraceInfo								= { "glEndQueryIndexed", "vxu", 2, DE_NULL };
+static const CallTrace::FuncInfo		s_glEndTransformFeedbackTraceInfo							= { "glEndTransformFeedback", "v", 0, DE_NULL };
+static const CallTrace::FuncInfo		s_glFenceSyncTraceInfo										= { "glFenceSync", "pxx", 2, DE_NULL };
+static const CallTrace::FuncInfo		s_glFinishTraceInfo											= { "glFinish", "v", 0, DE_NULL };
+static const CallTrace::FuncInfo		s_glFlushTraceInfo											= { "glFlush", "v", 0, DE_NULL };
+static const CallTrace::GetEnumNameFunc	s_glFlushMappedBufferRangeTraceEnums[]						= { DE_NULL, getBufferTargetName, DE_NULL, DE_NULL };
+static const CallTrace::FuncInfo		s_glFlushMappedBufferRangeTraceInfo							= { "glFlushMappedBufferRange", "vxii", 3, s_glFlushMappedBufferRangeTraceEnums };
+static const CallTrace::FuncInfo		s_glFlushMappedNamedBufferRangeTraceInfo					= { "glFlushMappedNamedBufferRange", "vuii", 3, DE_NULL };
+static const CallTrace::FuncInfo		s_glFlushMappedNamedBufferRangeEXTTraceInfo					= { "glFlushMappedNamedBufferRangeEXT", "vuii", 3, DE_NULL };
+static const CallTrace::FuncInfo		s_glFramebufferDrawBufferEXTTraceInfo						= { "glFramebufferDrawBufferEXT", "vux", 2, DE_NULL };
+static const CallTrace::FuncInfo		s_glFramebufferDrawBuffersEXTTraceInfo						= { "glFramebufferDrawBuffersEXT", "vuip", 3, DE_NULL };
+static const CallTrace::GetEnumNameFunc	s_glFramebufferParameteriTraceEnums[]						= { DE_NULL, getFramebufferTargetName, getFramebufferParameterName, DE_NULL };
+static const CallTrace::FuncInfo		s_glFramebufferParameteriTraceInfo							= { "glFramebufferParameteri", "vxxi", 3, s_glFramebufferParameteriTraceEnums };
+static const CallTrace::FuncInfo		s_glFramebufferReadBufferEXTTraceInfo						= { "glFramebufferReadBufferEXT", "vux", 2, DE_NULL };
+static const CallTrace::GetEnumNameFunc	s_glFramebufferRenderbufferTraceEnums[]						= { DE_NULL, getFramebufferTargetName, getFramebufferAttachmentName, getFramebufferTargetName, DE_NULL };
+static const CallTrace::FuncInfo		s_glFramebufferRenderbufferTraceInfo						= { "glFramebufferRenderbuffer", "vxxxu", 4, s_glFramebufferRenderbufferTraceEnums };
+static const CallTrace::GetEnumNameFunc	s_glFramebufferTextureTraceEnums[]							= { DE_NULL, getFramebufferTargetName, getFramebufferAttachmentName, DE_NULL, DE_NULL };
+static const CallTrace::FuncInfo		s_glFramebufferTextureTraceInfo								= { "glFramebufferTexture", "vxxui", 4, s_glFramebufferTextureTraceEnums };
+static const CallTrace::FuncInfo		s_glFramebufferTexture1DTraceInfo							= { "glFramebufferTexture1D", "vxxxui", 5, DE_NULL };
+static const CallTrace::GetEnumNameFunc	s_glFramebufferTexture2DTraceEnums[]						= { DE_NULL, getFramebufferTargetName, getFramebufferAttachmentName, getTextureTargetName, DE_NULL, DE_NULL };
+static const CallTrace::FuncInfo		s_glFramebufferTexture2DTraceInfo							= { "glFramebufferTexture2D", "vxxxui", 5, s_glFramebufferTexture2DTraceEnums };
+static const CallTrace::FuncInfo		s_glFramebufferTexture3DTraceInfo							= { "glFramebufferTexture3D", "vxxxuii", 6, DE_NULL };
+static const CallTrace::FuncInfo		s_glFramebufferTexture3DOESTraceInfo						= { "glFramebufferTexture3DOES", "vxxxuii", 6, DE_NULL };
+static const CallTrace::GetEnumNameFunc	s_glFramebufferTextureLayerTraceEnums[]						= { DE_NULL, getFramebufferTargetName, getFramebufferAttachmentName, DE_NULL, DE_NULL, DE_NULL };
+static const CallTrace::FuncInfo		s_glFramebufferTextureLayerTraceInfo						= { "glFramebufferTextureLayer", "vxxuii", 5, s_glFramebufferTextureLayerTraceEnums };
+static const CallTrace::FuncInfo		s_glFramebufferTextureMultisampleMultiviewOVRTraceInfo		= { "glFramebufferTextureMultisampleMultiviewOVR", "vxxuiiii", 7, DE_NULL };
+static const CallTrace::FuncInfo		s_glFramebufferTextureMultiviewOVRTraceInfo					= { "glFramebufferTextureMultiviewOVR", "vxxuiii", 6, DE_NULL };
+static const CallTrace::GetEnumNameFunc	s_glFrontFaceTraceEnums[]									= { DE_NULL, getWindingName };
+static const CallTrace::FuncInfo		s_glFrontFaceTraceInfo										= { "glFrontFace", "vx", 1, s_glFrontFaceTraceEnums };
+static const CallTrace::FuncInfo		s_glGenBuffersTraceInfo										= { "glGenBuffers", "vip", 2, DE_NULL };
+static const CallTrace::FuncInfo		s_glGenFramebuffersTraceInfo								= { "glGenFramebuffers", "vip", 2, DE_NULL };
+static const CallTrace::FuncInfo		s_glGenProgramPipelinesTraceInfo							= { "glGenProgramPipelines", "vip", 2, DE_NULL };
+static const CallTrace::FuncInfo		s_glGenQueriesTraceInfo										= { "glGenQueries", "vip", 2, DE_NULL };
+static const CallTrace::FuncInfo		s_glGenRenderbuffersTraceInfo								= { "glGenRenderbuffers", "vip", 2, DE_NULL };
+static const CallTrace::FuncInfo		s_glGenSamplersTraceInfo									= { "glGenSamplers", "vip", 2, DE_NULL };
+static const CallTrace::FuncInfo		s_glGenTexturesTraceInfo									= { "glGenTextures", "vip", 2, DE_NULL };
+static const CallTrace::FuncInfo		s_glGenTransformFeedbacksTraceInfo							= { "glGenTransformFeedbacks", "vip", 2, DE_NULL };
+static const CallTrace::FuncInfo		s_glGenVertexArraysTraceInfo								= { "glGenVertexArrays", "vip", 2, DE_NULL };
+static const CallTrace::GetEnumNameFunc	s_glGenerateMipmapTraceEnums[]								= { DE_NULL, getTextureTargetName };
+static const CallTrace::FuncInfo		s_glGenerateMipmapTraceInfo									= { "glGenerateMipmap", "vx", 1, s_glGenerateMipmapTraceEnums };
+static const CallTrace::FuncInfo		s_glGenerateMultiTexMipmapEXTTraceInfo						= { "glGenerateMultiTexMipmapEXT", "vxx", 2, DE_NULL };
+static const CallTrace::FuncInfo		s_glGenerateTextureMipmapTraceInfo							= { "glGenerateTextureMipmap", "vu", 1, DE_NULL };
+static const CallTrace::FuncInfo		s_glGenerateTextureMipmapEXTTraceInfo						= { "glGenerateTextureMipmapEXT", "vux", 2, DE_NULL };
+static const CallTrace::FuncInfo		s_glGetActiveAtomicCounterBufferivTraceInfo					= { "glGetActiveAtomicCounterBufferiv", "vuuxp", 4, DE_NULL };
+static const CallTrace::FuncInfo		s_glGetActiveAttribTraceInfo								= { "glGetActiveAttrib", "vuuipppp", 7, DE_NULL };
+static const CallTrace::FuncInfo		s_glGetActiveSubroutineNameTraceInfo						= { "glGetActiveSubroutineName", "vuxuipp", 6, DE_NULL };
+static const CallTrace::FuncInfo		s_glGetActiveSubroutineUniformNameTraceInfo					= { "glGetActiveSubroutineUniformName", "vuxuipp", 6, DE_NULL };
+static const CallTrace::FuncInfo		s_glGetActiveSubroutineUniformivTraceInfo					= { "glGetActiveSubroutineUniformiv", "vuxuxp", 5, DE_NULL };
+static const CallTrace::FuncInfo		s_glGetActiveUniformTraceInfo								= { "glGetActiveUniform", "vuuipppp", 7, DE_NULL };
+static const CallTrace::FuncInfo		s_glGetActiveUniformBlockNameTraceInfo						= { "glGetActiveUniformBlockName", "vuuipp", 5, DE_NULL };
+static const CallTrace::FuncInfo		s_glGetActiveUniformBlockivTraceInfo						= { "glGetActiveUniformBlockiv", "vuuxp", 4, DE_NULL };
+static const CallTrace::FuncInfo		s_glGetActiveUniformNameTraceInfo							= { "glGetActiveUniformName", "vuuipp", 5, DE_NULL };
+static const CallTrace::GetEnumNameFunc	s_glGetActiveUniformsivTraceEnums[]							= { DE_NULL, DE_NULL, DE_NULL, DE_NULL, getUniformParamName, DE_NULL };
+static const CallTrace::FuncInfo		s_glGetActiveUniformsivTraceInfo							= { "glGetActiveUniformsiv", "vuipxp", 5, s_glGetActiveUniformsivTraceEnums };
+static const CallTrace::FuncInfo		s_glGetAttachedShadersTraceInfo								= { "glGetAttachedShaders", "vuipp", 4, DE_NULL };
+static const CallTrace::FuncInfo		s_glGetAttribLocationTraceInfo								= { "glGetAttribLocation", "iup", 2, DE_NULL };
+static const CallTrace::GetEnumNameFunc	s_glGetBooleani_vTraceEnums[]								= { DE_NULL, getGettableIndexedStateName, DE_NULL, DE_NULL };
+static const CallTrace::FuncInfo		s_glGetBooleani_vTraceInfo									= { "glGetBooleani_v", "vxup", 3, s_glGetBooleani_vTraceEnums };
+static const CallTrace::GetEnumNameFunc	s_glGetBooleanvTraceEnums[]									= { DE_NULL, getGettableStateName, DE_NULL };
+static const CallTrace::FuncInfo		s_glGetBooleanvTraceInfo									= { "glGetBooleanv", "vxp", 2, s_glGetBooleanvTraceEnums };
+static const CallTrace::GetEnumNameFunc	s_glGetBufferParameteri64vTraceEnums[]						= { DE_NULL, getBufferTargetName, getBufferQueryName, DE_NULL };
+static const CallTrace::FuncInfo		s_glGetBufferParameteri64vTraceInfo							= { "glGetBufferParameteri64v", "vxxp", 3, s_glGetBufferParameteri64vTraceEnums };
+static const CallTrace::GetEnumNameFunc	s_glGetBufferParameterivTraceEnums[]						= { DE_NULL, getBufferTargetName, getBufferQueryName, DE_NULL };
+static const CallTrace::FuncInfo		s_glGetBufferParameterivTraceInfo							= { "glGetBufferParameteriv", "vxxp", 3, s_glGetBufferParameterivTraceEnums };
+static const CallTrace::FuncInfo		s_glGetBufferPointervTraceInfo								= { "glGetBufferPointerv", "vxxp", 3, DE_NULL };
+static const CallTrace::FuncInfo		s_glGetBufferSubDataTraceInfo								= { "glGetBufferSubData", "vxiip", 4, DE_NULL };
+static const CallTrace::FuncInfo		s_glGetCompressedMultiTexImageEXTTraceInfo					= { "glGetCompressedMultiTexImageEXT", "vxxip", 4, DE_NULL };
+static const CallTrace::FuncInfo		s_glGetCompressedTexImageTraceInfo							= { "glGetCompressedTexImage", "vxip", 3, DE_NULL };
+static const CallTrace::FuncInfo		s_glGetCompressedTextureImageTraceInfo						= { "glGetCompressedTextureImage", "vuiip", 4, DE_NULL };
+static const CallTrace::FuncInfo		s_glGetCompressedTextureImageEXTTraceInfo					= { "glGetCompressedTextureImageEXT", "vuxip", 4, DE_NULL };
+static const CallTrace::FuncInfo		s_glGetCompressedTextureSubImageTraceInfo					= { "glGetCompressedTextureSubImage", "vuiiiiiiiip", 10, DE_NULL };
+static const CallTrace::FuncInfo		s_glGetDebugMessageLogTraceInfo								= { "glGetDebugMessageLog", "uuipppppp", 8, DE_NULL };
+static const CallTrace::FuncInfo		s_glGetDoublei_vTraceInfo									= { "glGetDoublei_v", "vxup", 3, DE_NULL };
+static const CallTrace::FuncInfo		s_glGetDoublevTraceInfo										= { "glGetDoublev", "vxp", 2, DE_NULL };
+static const CallTrace::GetEnumNameFunc	s_glGetErrorTraceEnums[]									= { getErrorName };
+static const CallTrace::FuncInfo		s_glGetErrorTraceInfo										= { "glGetError", "x", 0, s_glGetErrorTraceEnums };
+static const CallTrace::FuncInfo		s_glGetFloati_vTraceInfo									= { "glGetFloati_v", "vxup", 3, DE_NULL };
+static const CallTrace::GetEnumNameFunc	s_glGetFloatvTraceEnums[]									= { DE_NULL, getGettableStateName, DE_NULL };
+static const CallTrace::FuncInfo		s_glGetFloatvTraceInfo										= { "glGetFloatv", "vxp", 2, s_glGetFloatvTraceEnums };
+static const CallTrace::FuncInfo		s_glGetFragDataIndexTraceInfo								= { "glGetFragDataIndex", "iup", 2, DE_NULL };
+static const CallTrace::FuncInfo		s_glGetFragDataLocationTraceInfo							= { "glGetFragDataLocation", "iup", 2, DE_NULL };
+static const CallTrace::GetEnumNameFunc	s_glGetFramebufferAttachmentParameterivTraceEnums[]			= { DE_NULL, getFramebufferTargetName, getFramebufferAttachmentName, getFramebufferAttachmentParameterName, DE_NULL };
+static const CallTrace::FuncInfo		s_glGetFramebufferAttachmentParameterivTraceInfo			= { "glGetFramebufferAttachmentParameteriv", "vxxxp", 4, s_glGetFramebufferAttachmentParameterivTraceEnums };
+static const CallTrace::GetEnumNameFunc	s_glGetFramebufferParameterivTraceEnums[]					= { DE_NULL, getFramebufferTargetName, getFramebufferParameterName, DE_NULL };
+static const CallTrace::FuncInfo		s_glGetFramebufferParameterivTraceInfo						= { "glGetFramebufferParameteriv", "vxxp", 3, s_glGetFramebufferParameterivTraceEnums };
+static const CallTrace::FuncInfo		s_glGetFramebufferParameterivEXTTraceInfo					= { "glGetFramebufferParameterivEXT", "vuxp", 3, DE_NULL };
+static const CallTrace::FuncInfo		s_glGetGraphicsResetStatusTraceInfo							= { "glGetGraphicsResetStatus", "x", 0, DE_NULL };
+static const CallTrace::GetEnumNameFunc	s_glGetInteger64i_vTraceEnums[]								= { DE_NULL, getGettableIndexedStateName, DE_NULL, DE_NULL };
+static const CallTrace::FuncInfo		s_glGetInteger64i_vTraceInfo								= { "glGetInteger64i_v", "vxup", 3, s_glGetInteger64i_vTraceEnums };
+static const CallTrace::GetEnumNameFunc	s_glGetInteger64vTraceEnums[]								= { DE_NULL, getGettableStateName, DE_NULL };
+static const CallTrace::FuncInfo		s_glGetInteger64vTraceInfo									= { "glGetInteger64v", "vxp", 2, s_glGetInteger64vTraceEnums };
+static const CallTrace::GetEnumNameFunc	s_glGetIntegeri_vTraceEnums[]								= { DE_NULL, getGettableIndexedStateName, DE_NULL, DE_NULL };
+static const CallTrace::FuncInfo		s_glGetIntegeri_vTraceInfo									= { "glGetIntegeri_v", "vxup", 3, s_glGetIntegeri_vTraceEnums };
+static const CallTrace::GetEnumNameFunc	s_glGetIntegervTraceEnums[]									= { DE_NULL, getGettableStateName, DE_NULL };
+static const CallTrace::FuncInfo		s_glGetIntegervTraceInfo									= { "glGetIntegerv", "vxp", 2, s_glGetIntegervTraceEnums };
+static const CallTrace::FuncInfo		s_glGetInternalformatSampleivNVTraceInfo					= { "glGetInternalformatSampleivNV", "vxxixip", 6, DE_NULL };
+static const CallTrace::FuncInfo		s_glGetInternalformati64vTraceInfo							= { "glGetInternalformati64v", "vxxxip", 5, DE_NULL };
+static const CallTrace::GetEnumNameFunc	s_glGetInternalformativTraceEnums[]							= { DE_NULL, getInternalFormatTargetName, getUncompressedTextureFormatName, getInternalFormatParameterName, DE_NULL, DE_NULL };
+static const CallTrace::FuncInfo		s_glGetInternalformativTraceInfo							= { "glGetInternalformativ", "vxxxip", 5, s_glGetInternalformativTraceEnums };
+static const CallTrace::FuncInfo		s_glGetMultiTexEnvfvEXTTraceInfo							= { "glGetMultiTexEnvfvEXT", "vxxxp", 4, DE_NULL };
+static const CallTrace::FuncInfo		s_glGetMultiTexEnvivEXTTraceInfo							= { "glGetMultiTexEnvivEXT", "vxxxp", 4, DE_NULL };
+static const CallTrace::FuncInfo		s_glGetMultiTexGendvEXTTraceInfo							= { "glGetMultiTexGendvEXT", "vxxxp", 4, DE_NULL };
+static const CallTrace::FuncInfo		s_glGetMultiTexGenfvEXTTraceInfo							= { "glGetMultiTexGenfvEXT", "vxxxp", 4, DE_NULL };
+static const CallTrace::FuncInfo		s_glGetMultiTexGenivEXTTraceInfo							= { "glGetMultiTexGenivEXT", "vxxxp", 4, DE_NULL };
+static const CallTrace::FuncInfo		s_glGetMultiTexImageEXTTraceInfo							= { "glGetMultiTexImageEXT", "vxxixxp", 6, DE_NULL };
+static const CallTrace::FuncInfo		s_glGetMultiTexLevelParameterfvEXTTraceInfo					= { "glGetMultiTexLevelParameterfvEXT", "vxxixp", 5, DE_NULL };
+static const CallTrace::FuncInfo		s_glGetMultiTexLevelParameterivEXTTraceInfo					= { "glGetMultiTexLevelParameterivEXT", "vxxixp", 5, DE_NULL };
+static const CallTrace::FuncInfo		s_glGetMultiTexParameterIivEXTTraceInfo						= { "glGetMultiTexParameterIivEXT", "vxxxp", 4, DE_NULL };
+static const CallTrace::FuncInfo		s_glGetMultiTexParameterIuivEXTTraceInfo					= { "glGetMultiTexParameterIuivEXT", "vxxxp", 4, DE_NULL };
+static const CallTrace::FuncInfo		s_glGetMultiTexParameterfvEXTTraceInfo						= { "glGetMultiTexParameterfvEXT", "vxxxp", 4, DE_NULL };
+static const CallTrace::FuncInfo		s_glGetMultiTexParameterivEXTTraceInfo						= { "glGetMultiTexParameterivEXT", "vxxxp", 4, DE_NULL };
+static const CallTrace::GetEnumNameFunc	s_glGetMultisamplefvTraceEnums[]							= { DE_NULL, getMultisampleParameterName, DE_NULL, DE_NULL };
+static const CallTrace::FuncInfo		s_glGetMultisamplefvTraceInfo								= { "glGetMultisamplefv", "vxup", 3, s_glGetMultisamplefvTraceEnums };
+static const CallTrace::FuncInfo		s_glGetNamedBufferParameteri64vTraceInfo					= { "glGetNamedBufferParameteri64v", "vuxp", 3, DE_NULL };
+static const CallTrace::FuncInfo		s_glGetNamedBufferParameterivTraceInfo						= { "glGetNamedBufferParameteriv", "vuxp", 3, DE_NULL };
+static const CallTrace::FuncInfo		s_glGetNamedBufferParameterivEXTTraceInfo					= { "glGetNamedBufferParameterivEXT", "vuxp", 3, DE_NULL };
+static const CallTrace::FuncInfo		s_glGetNamedBufferPointervTraceInfo							= { "glGetNamedBufferPointerv", "vuxp", 3, DE_NULL };
+static const CallTrace::FuncInfo		s_glGetNamedBufferPointervEXTTraceInfo						= { "glGetNamedBufferPointervEXT", "vuxp", 3, DE_NULL };
+static const CallTrace::FuncInfo		s_glGetNamedBufferSubDataTraceInfo							= { "glGetNamedBufferSubData", "vuiip", 4, DE_NULL };
+static const CallTrace::FuncInfo		s_glGetNamedBufferSubDataEXTTraceInfo						= { "glGetNamedBufferSubDataEXT", "vuiip", 4, DE_NULL };
+static const CallTrace::FuncInfo		s_glGetNamedFramebufferAttachmentParameterivTraceInfo		= { "glGetNamedFramebufferAttachmentParameteriv", "vuxxp", 4, DE_NULL };
+static const CallTrace::FuncInfo		s_glGetNamedFramebufferAttachmentParameterivEXTTraceInfo	= { "glGetNamedFramebufferAttachmentParameterivEXT", "vuxxp", 4, DE_NULL };
+static const CallTrace::FuncInfo		s_glGetNamedFramebufferParameterivTraceInfo					= { "glGetNamedFramebufferParameteriv", "vuxp", 3, DE_NULL };
+static const CallTrace::FuncInfo		s_glGetNamedFramebufferParameterivEXTTraceInfo				= { "glGetNamedFramebufferParameterivEXT", "vuxp", 3, DE_NULL };
+static const CallTrace::FuncInfo		s_glGetNamedProgramLocalParameterIivEXTTraceInfo			= { "glGetNamedProgramLocalParameterIivEXT", "vuxup", 4, DE_NULL };
+static const CallTrace::FuncInfo		s_glGetNamedProgramLocalParameterIuivEXTTraceInfo			= { "glGetNamedProgramLocalParameterIuivEXT", "vuxup", 4, DE_NULL };
+static const CallTrace::FuncInfo		s_glGetNamedProgramLocalParameterdvEXTTraceInfo				= { "glGetNamedProgramLocalParameterdvEXT", "vuxup", 4, DE_NULL };
+static const CallTrace::FuncInfo		s_glGetNamedProgramLocalParameterfvEXTTraceInfo				= { "glGetNamedProgramLocalParameterfvEXT", "vuxup", 4, DE_NULL };
+static const CallTrace::FuncInfo		s_glGetNamedProgramStringEXTTraceInfo						= { "glGetNamedProgramStringEXT", "vuxxp", 4, DE_NULL };
+static const CallTrace::FuncInfo		s_glGetNamedProgramivEXTTraceInfo							= { "glGetNamedProgramivEXT", "vuxxp", 4, DE_NULL };
+static const CallTrace::FuncInfo		s_glGetNamedRenderbufferParameterivTraceInfo				= { "glGetNamedRenderbufferParameteriv", "vuxp", 3, DE_NULL };
+static const CallTrace::FuncInfo		s_glGetNamedRenderbufferParameterivEXTTraceInfo				= { "glGetNamedRenderbufferParameterivEXT", "vuxp", 3, DE_NULL };
+static const CallTrace::FuncInfo		s_glGetObjectLabelTraceInfo									= { "glGetObjectLabel", "vxuipp", 5, DE_NULL };
+static const CallTrace::FuncInfo		s_glGetObjectPtrLabelTraceInfo								= { "glGetObjectPtrLabel", "vpipp", 4, DE_NULL };
+static const CallTrace::FuncInfo		s_glGetPointerIndexedvEXTTraceInfo							= { "glGetPointerIndexedvEXT", "vxup", 3, DE_NULL };
+static const CallTrace::FuncInfo		s_glGetPointeri_vEXTTraceInfo								= { "glGetPointeri_vEXT", "vxup", 3, DE_NULL };
+static const CallTrace::GetEnumNameFunc	s_glGetPointervTraceEnums[]									= { DE_NULL, getPointerStateName, DE_NULL };
+static const CallTrace::FuncInfo		s_glGetPointervTraceInfo									= { "glGetPointerv", "vxp", 2, s_glGetPointervTraceEnums };
+static const CallTrace::FuncInfo		s_glGetProgramBinaryTraceInfo								= { "glGetProgramBinary", "vuippp", 5, DE_NULL };
+static const CallTrace::FuncInfo		s_glGetProgramInfoLogTraceInfo								= { "glGetProgramInfoLog", "vuipp", 4, DE_NULL };
+static const CallTrace::FuncInfo		s_glGetProgramInterfaceivTraceInfo							= { "glGetProgramInterfaceiv", "vuxxp", 4, DE_NULL };
+static const CallTrace::FuncInfo		s_glGetProgramPipelineInfoLogTraceInfo						= { "glGetProgramPipelineInfoLog", "vuipp", 4, DE_NULL };
+static const CallTrace::GetEnumNameFunc	s_glGetProgramPipelineivTraceEnums[]						= { DE_NULL, DE_NULL, getPipelineParamName, DE_NULL };
+static const CallTrace::FuncInfo		s_glGetProgramPipelineivTraceInfo							= { "glGetProgramPipelineiv", "vuxp", 3, s_glGetProgramPipelineivTraceEnums };
+static const CallTrace::GetEnumNameFunc	s_glGetProgramResourceIndexTraceEnums[]						= { DE_NULL, DE_NULL, getProgramInterfaceName, DE_NULL };
+static const CallTrace::FuncInfo		s_glGetProgramResourceIndexTraceInfo						= { "glGetProgramResourceIndex", "uuxp", 3, s_glGetProgramResourceIndexTraceEnums };
+static const CallTrace::FuncInfo		s_glGetProgramResourceLocationTraceInfo						= { "glGetProgramResourceLocation", "iuxp", 3, DE_NULL };
+static const CallTrace::FuncInfo		s_glGetProgramResourceLocationIndexTraceInfo				= { "glGetProgramResourceLocationIndex", "iuxp", 3, DE_NULL };
+static const CallTrace::FuncInfo		s_glGetProgramResourceNameTraceInfo							= { "glGetProgramResourceName", "vuxuipp", 6, DE_NULL };
+static const CallTrace::GetEnumNameFunc	s_glGetProgramResourceivTraceEnums[]						= { DE_NULL, DE_NULL, getProgramInterfaceName, DE_NULL, DE_NULL, DE_NULL, DE_NULL, DE_NULL, DE_NULL };
+static const CallTrace::FuncInfo		s_glGetProgramResourceivTraceInfo							= { "glGetProgramResourceiv", "vuxuipipp", 8, s_glGetProgramResourceivTraceEnums };
+static const CallTrace::FuncInfo		s_glGetProgramStageivTraceInfo								= { "glGetProgramStageiv", "vuxxp", 4, DE_NULL };
+static const CallTrace::GetEnumNameFunc	s_glGetProgramivTraceEnums[]								= { DE_NULL, DE_NULL, getProgramParamName, DE_NULL };
+static const CallTrace::FuncInfo		s_glGetProgramivTraceInfo									= { "glGetProgramiv", "vuxp", 3, s_glGetProgramivTraceEnums };
+static const CallTrace::FuncInfo		s_glGetQueryBufferObjecti64vTraceInfo						= { "glGetQueryBufferObjecti64v", "vuuxi", 4, DE_NULL };
+static const CallTrace::FuncInfo		s_glGetQueryBufferObjectivTraceInfo							= { "glGetQueryBufferObjectiv", "vuuxi", 4, DE_NULL };
+static const CallTrace::FuncInfo		s_glGetQueryBufferObjectui64vTraceInfo						= { "glGetQueryBufferObjectui64v", "vuuxi", 4, DE_NULL };
+static const CallTrace::FuncInfo		s_glGetQueryBufferObjectuivTraceInfo						= { "glGetQueryBufferObjectuiv", "vuuxi", 4, DE_NULL };
+static const CallTrace::FuncInfo		s_glGetQueryIndexedivTraceInfo								= { "glGetQueryIndexediv", "vxuxp", 4, DE_NULL };
+static const CallTrace::GetEnumNameFunc	s_glGetQueryObjecti64vTraceEnums[]							= { DE_NULL, DE_NULL, getQueryObjectParamName, DE_NULL };
+static const CallTrace::FuncInfo		s_glGetQueryObjecti64vTraceInfo								= { "glGetQueryObjecti64v", "vuxp", 3, s_glGetQueryObjecti64vTraceEnums };
+static const CallTrace::GetEnumNameFunc	s_glGetQueryObjectivTraceEnums[]							= { DE_NULL, DE_NULL, getQueryObjectParamName, DE_NULL };
+static const CallTrace::FuncInfo		s_glGetQueryObjectivTraceInfo								= { "glGetQueryObjectiv", "vuxp", 3, s_glGetQueryObjectivTraceEnums };
+static const CallTrace::GetEnumNameFunc	s_glGetQueryObjectui64vTraceEnums[]							= { DE_NULL, DE_NULL, getQueryObjectParamName, DE_NULL };
+static const CallTrace::FuncInfo		s_glGetQueryObjectui64vTraceInfo							= { "glGetQueryObjectui64v", "vuxp", 3, s_glGetQueryObjectui64vTraceEnums };
+static const CallTrace::GetEnumNameFunc	s_glGetQueryObjectuivTraceEnums[]							= { DE_NULL, DE_NULL, getQueryObjectParamName, DE_NULL };
+static const CallTrace::FuncInfo		s_glGetQueryObjectuivTraceInfo								= { "glGetQueryObjectuiv", "vuxp", 3, s_glGetQueryObjectuivTraceEnums };
+static const CallTrace::GetEnumNameFunc	s_glGetQueryivTraceEnums[]									= { DE_NULL, getQueryTargetName, getQueryParamName, DE_NULL };
+static const CallTrace::FuncInfo		s_glGetQueryivTraceInfo										= { "glGetQueryiv", "vxxp", 3, s_glGetQueryivTraceEnums };
+static const CallTrace::GetEnumNameFunc	s_glGetRenderbufferParameterivTraceEnums[]					= { DE_NULL, getFramebufferTargetName, getRenderbufferParameterName, DE_NULL };
+static const CallTrace::FuncInfo		s_glGetRenderbufferParameterivTraceInfo						= { "glGetRenderbufferParameteriv", "vxxp", 3, s_glGetRenderbufferParameterivTraceEnums };
+static const CallTrace::GetEnumNameFunc	s_glGetSamplerParameterIivTraceEnums[]						= { DE_NULL, DE_NULL, getTextureParameterName, DE_NULL };
+static const CallTrace::FuncInfo		s_glGetSamplerParameterIivTraceInfo							= { "glGetSamplerParameterIiv", "vuxp", 3, s_glGetSamplerParameterIivTraceEnums };
+static const CallTrace::GetEnumNameFunc	s_glGetSamplerParameterIuivTraceEnums[]						= { DE_NULL, DE_NULL, getTextureParameterName, DE_NULL };
+static const CallTrace::FuncInfo		s_glGetSamplerParameterIuivTraceInfo						= { "glGetSamplerParameterIuiv", "vuxp", 3, s_glGetSamplerParameterIuivTraceEnums };
+static const CallTrace::GetEnumNameFunc	s_glGetSamplerParameterfvTraceEnums[]						= { DE_NULL, DE_NULL, getTextureParameterName, DE_NULL };
+static const CallTrace::FuncInfo		s_glGetSamplerParameterfvTraceInfo							= { "glGetSamplerParameterfv", "vuxp", 3, s_glGetSamplerParameterfvTraceEnums };
+static const CallTrace::GetEnumNameFunc	s_glGetSamplerParameterivTraceEnums[]						= { DE_NULL, DE_NULL, getTextureParameterName, DE_NULL };
+static const CallTrace::FuncInfo		s_glGetSamplerParameterivTraceInfo							= { "glGetSamplerParameteriv", "vuxp", 3, s_glGetSamplerParameterivTraceEnums };
+static const CallTrace::FuncInfo		s_glGetShaderInfoLogTraceInfo								= { "glGetShaderInfoLog", "vuipp", 4, DE_NULL };
+static const CallTrace::GetEnumNameFunc	s_glGetShaderPrecisionFormatTraceEnums[]					= { DE_NULL, getShaderTypeName, getPrecisionFormatTypeName, DE_NULL, DE_NULL };
+static const CallTrace::FuncInfo		s_glGetShaderPrecisionFormatTraceInfo						= { "glGetShaderPrecisionFormat", "vxxpp", 4, s_glGetShaderPrecisionFormatTraceEnums };
+static const CallTrace::FuncInfo		s_glGetShaderSourceTraceInfo								= { "glGetShaderSource", "vuipp", 4, DE_NULL };
+static const CallTrace::GetEnumNameFunc	s_glGetShaderivTraceEnums[]									= { DE_NULL, DE_NULL, getShaderParamName, DE_NULL };
+static const CallTrace::FuncInfo		s_glGetShaderivTraceInfo									= { "glGetShaderiv", "vuxp", 3, s_glGetShaderivTraceEnums };
+static const CallTrace::GetEnumNameFunc	s_glGetStringTraceEnums[]									= { DE_NULL, getGettableStringName };
+static const CallTrace::FuncInfo		s_glGetStringTraceInfo										= { "glGetString", "px", 1, s_glGetStringTraceEnums };
+static const CallTrace::GetEnumNameFunc	s_glGetStringiTraceEnums[]									= { DE_NULL, getGettableStringName, DE_NULL };
+static const CallTrace::FuncInfo		s_glGetStringiTraceInfo										= { "glGetStringi", "pxu", 2, s_glGetStringiTraceEnums };
+static const CallTrace::FuncInfo		s_glGetSubroutineIndexTraceInfo								= { "glGetSubroutineIndex", "uuxp", 3, DE_NULL };
+static const CallTrace::FuncInfo		s_glGetSubroutineUniformLocationTraceInfo					= { "glGetSubroutineUniformLocation", "iuxp", 3, DE_NULL };
+static const CallTrace::FuncInfo		s_glGetSyncivTraceInfo										= { "glGetSynciv", "vpxipp", 5, DE_NULL };
+static const CallTrace::FuncInfo		s_glGetTexImageTraceInfo									= { "glGetTexImage", "vxixxp", 5, DE_NULL };
+static const CallTrace::GetEnumNameFunc	s_glGetTexLevelParameterfvTraceEnums[]						= { DE_NULL, getTextureTargetName, DE_NULL, getTextureLevelParameterName, DE_NULL };
+static const CallTrace::FuncInfo		s_glGetTexLevelParameterfvTraceInfo							= { "glGetTexLevelParameterfv", "vxixp", 4, s_glGetTexLevelParameterfvTraceEnums };
+static const CallTrace::GetEnumNameFunc	s_glGetTexLevelParameterivTraceEnums[]						= { DE_NULL, getTextureTargetName, DE_NULL, getTextureLevelParameterName, DE_NULL };
+static const CallTrace::FuncInfo		s_glGetTexLevelParameterivTraceInfo							= { "glGetTexLevelParameteriv", "vxixp", 4, s_glGetTexLevelParameterivTraceEnums };
+static const CallTrace::GetEnumNameFunc	s_glGetTexParameterIivTraceEnums[]							= { DE_NULL, getTextureTargetName, getTextureParameterName, DE_NULL };
+static const CallTrace::FuncInfo		s_glGetTexParameterIivTraceInfo								= { "glGetTexParameterIiv", "vxxp", 3, s_glGetTexParameterIivTraceEnums };
+static const CallTrace::GetEnumNameFunc	s_glGetTexParameterIuivTraceEnums[]							= { DE_NULL, getTextureTargetName, getTextureParameterName, DE_NULL };
+static const CallTrace::FuncInfo		s_glGetTexParameterIuivTraceInfo							= { "glGetTexParameterIuiv", "vxxp", 3, s_glGetTexParameterIuivTraceEnums };
+static const CallTrace::GetEnumNameFunc	s_glGetTexParameterfvTraceEnums[]							= { DE_NULL, getTextureTargetName, getTextureParameterName, DE_NULL };
+static const CallTrace::FuncInfo		s_glGetTexParameterfvTraceInfo								= { "glGetTexParameterfv", "vxxp", 3, s_glGetTexParameterfvTraceEnums };
+static const CallTrace::GetEnumNameFunc	s_glGetTexParameterivTraceEnums[]							= { DE_NULL, getTextureTargetName, getTextureParameterName, DE_NULL };
+static const CallTrace::FuncInfo		s_glGetTexParameterivTraceInfo								= { "glGetTexParameteriv", "vxxp", 3, s_glGetTexParameterivTraceEnums };
+static const CallTrace::FuncInfo		s_glGetTextureImageTraceInfo								= { "glGetTextureImage", "vuixxip", 6, DE_NULL };
+static const CallTrace::FuncInfo		s_glGetTextureImageEXTTraceInfo								= { "glGetTextureImageEXT", "vuxixxp", 6, DE_NULL };
+static const CallTrace::FuncInfo		s_glGetTextureLevelParameterfvTraceInfo						= { "glGetTextureLevelParameterfv", "vuixp", 4, DE_NULL };
+static const CallTrace::FuncInfo		s_glGetTextureLevelParameterfvEXTTraceInfo					= { "glGetTextureLevelParameterfvEXT", "vuxixp", 5, DE_NULL };
+static const CallTrace::FuncInfo		s_glGetTextureLevelParameterivTraceInfo						= { "glGetTextureLevelParameteriv", "vuixp", 4, DE_NULL };
+static const CallTrace::FuncInfo		s_glGetTextureLevelParameterivEXTTraceInfo					= { "glGetTextureLevelParameterivEXT", "vuxixp", 5, DE_NULL };
+static const CallTrace::FuncInfo		s_glGetTextureParameterIivTraceInfo							= { "glGetTextureParameterIiv", "vuxp", 3, DE_NULL };
+static const CallTrace::FuncInfo		s_glGetTextureParameterIivEXTTraceInfo						= { "glGetTextureParameterIivEXT", "vuxxp", 4, DE_NULL };
+static const CallTrace::FuncInfo		s_glGetTextureParameterIuivTraceInfo						= { "glGetTextureParameterIuiv", "vuxp", 3, DE_NULL };
+static const CallTrace::FuncInfo		s_glGetTextureParameterIuivEXTTraceInfo						= { "glGetTextureParameterIuivEXT", "vuxxp", 4, DE_NULL };
+static const CallTrace::FuncInfo		s_glGetTextureParameterfvTraceInfo							= { "glGetTextureParameterfv", "vuxp", 3, DE_NULL };
+static const CallTrace::FuncInfo		s_glGetTextureParameterfvEXTTraceInfo						= { "glGetTextureParameterfvEXT", "vuxxp", 4, DE_NULL };
+static const CallTrace::FuncInfo		s_glGetTextureParameterivTraceInfo							= { "glGetTextureParameteriv", "vuxp", 3, DE_NULL };
+static const CallTrace::FuncInfo		s_glGetTextureParameterivEXTTraceInfo						= { "glGetTextureParameterivEXT", "vuxxp", 4, DE_NULL };
+static const CallTrace::FuncInfo		s_glGetTextureSubImageTraceInfo								= { "glGetTextureSubImage", "vuiiiiiiixxip", 12, DE_NULL };
+static const CallTrace::FuncInfo		s_glGetTransformFeedbackVaryingTraceInfo					= { "glGetTransformFeedbackVarying", "vuuipppp", 7, DE_NULL };
+static const CallTrace::FuncInfo		s_glGetTransformFeedbacki64_vTraceInfo						= { "glGetTransformFeedbacki64_v", "vuxup", 4, DE_NULL };
+static const CallTrace::FuncInfo		s_glGetTransformFeedbacki_vTraceInfo						= { "glGetTransformFeedbacki_v", "vuxup", 4, DE_NULL };
+static const CallTrace::FuncInfo		s_glGetTransformFeedbackivTraceInfo							= { "glGetTransformFeedbackiv", "vuxp", 3, DE_NULL };
+static const CallTrace::FuncInfo		s_glGetUniformBlockIndexTraceInfo							= { "glGetUniformBlockIndex", "uup", 2, DE_NULL };
+static const CallTrace::FuncInfo		s_glGetUniformIndicesTraceInfo								= { "glGetUniformIndices", "vuipp", 4, DE_NULL };
+static const CallTrace::FuncInfo		s_glGetUniformLocationTraceInfo								= { "glGetUniformLocation", "iup", 2, DE_NULL };
+static const CallTrace::FuncInfo		s_glGetUniformSubroutineuivTraceInfo						= { "glGetUniformSubroutineuiv", "vxip", 3, DE_NULL };
+static const CallTrace::FuncInfo		s_glGetUniformdvTraceInfo									= { "glGetUniformdv", "vuip", 3, DE_NULL };
+static const CallTrace::FuncInfo		s_glGetUniformfvTraceInfo									= { "glGetUniformfv", "vuip", 3, DE_NULL };
+static const CallTrace::FuncInfo		s_glGetUniformivTraceInfo									= { "glGetUniformiv", "vuip", 3, DE_NULL };
+static const CallTrace::FuncInfo		s_glGetUniformuivTraceInfo									= { "glGetUniformuiv", "vuip", 3, DE_NULL };
+static const CallTrace::FuncInfo		s_glGetVertexArrayIndexed64ivTraceInfo						= { "glGetVertexArrayIndexed64iv", "vuuxp", 4, DE_NULL };
+static const CallTrace::FuncInfo		s_glGetVertexArrayIndexedivTraceInfo						= { "glGetVertexArrayIndexediv", "vuuxp", 4, DE_NULL };
+static const CallTrace::FuncInfo		s_glGetVertexArrayIntegeri_vEXTTraceInfo					= { "glGetVertexArrayIntegeri_vEXT", "vuuxp", 4, DE_NULL };
+static const CallTrace::FuncInfo		s_glGetVertexArrayIntegervEXTTraceInfo						= { "glGetVertexArrayIntegervEXT", "vuxp", 3, DE_NULL };
+static const CallTrace::FuncInfo		s_glGetVertexArrayPointeri_vEXTTraceInfo					= { "glGetVertexArrayPointeri_vEXT", "vuuxp", 4, DE_NULL };
+static const CallTrace::FuncInfo		s_glGetVertexArrayPointervEXTTraceInfo						= { "glGetVertexArrayPointervEXT", "vuxp", 3, DE_NULL };
+static const CallTrace::FuncInfo		s_glGetVertexArrayivTraceInfo								= { "glGetVertexArrayiv", "vuxp", 3, DE_NULL };
+static const CallTrace::GetEnumNameFunc	s_glGetVertexAttribIivTraceEnums[]							= { DE_NULL, DE_NULL, getVertexAttribParameterNameName, DE_NULL };
+static const CallTrace::FuncInfo		s_glGetVertexAttribIivTraceInfo								= { "glGetVertexAttribIiv", "vuxp", 3, s_glGetVertexAttribIivTraceEnums };
+static const CallTrace::GetEnumNameFunc	s_glGetVertexAttribIuivTraceEnums[]							= { DE_NULL, DE_NULL, getVertexAttribParameterNameName, DE_NULL };
+static const CallTrace::FuncInfo		s_glGetVertexAttribIuivTraceInfo							= { "glGetVertexAttribIuiv", "vuxp", 3, s_glGetVertexAttribIuivTraceEnums };
+static const CallTrace::FuncInfo		s_glGetVertexAttribLdvTraceInfo								= { "glGetVertexAttribLdv", "vuxp", 3, DE_NULL };
+static const CallTrace::FuncInfo		s_glGetVertexAttribPointervTraceInfo						= { "glGetVertexAttribPointerv", "vuxp", 3, DE_NULL };
+static const CallTrace::FuncInfo		s_glGetVertexAttribdvTraceInfo								= { "glGetVertexAttribdv", "vuxp", 3, DE_NULL };
+static const CallTrace::GetEnumNameFunc	s_glGetVertexAttribfvTraceEnums[]							= { DE_NULL, DE_NULL, getVertexAttribParameterNameName, DE_NULL };
+static const CallTrace::FuncInfo		s_glGetVertexAttribfvTraceInfo								= { "glGetVertexAttribfv", "vuxp", 3, s_glGetVertexAttribfvTraceEnums };
+static const CallTrace::GetEnumNameFunc	s_glGetVertexAttribivTraceEnums[]							= { DE_NULL, DE_NULL, getVertexAttribParameterNameName, DE_NULL };
+static const CallTrace::FuncInfo		s_glGetVertexAttribivTraceInfo								= { "glGetVertexAttribiv", "vuxp", 3, s_glGetVertexAttribivTraceEnums };
+static const CallTrace::FuncInfo		s_glGetnCompressedTexImageTraceInfo							= { "glGetnCompressedTexImage", "vxiip", 4, DE_NULL };
+static const CallTrace::FuncInfo		s_glGetnTexImageTraceInfo									= { "glGetnTexImage", "vxixxip", 6, DE_NULL };
+static const CallTrace::FuncInfo		s_glGetnUniformdvTraceInfo									= { "glGetnUniformdv", "vuiip", 4, DE_NULL };
+static const CallTrace::FuncInfo		s_glGetnUniformfvTraceInfo									= { "glGetnUniformfv", "vuiip", 4, DE_NULL };
+static const CallTrace::FuncInfo		s_glGetnUniformivTraceInfo									= { "glGetnUniformiv", "vuiip", 4, DE_NULL };
+static const CallTrace::FuncInfo		s_glGetnUniformuivTraceInfo									= { "glGetnUniformuiv", "vuiip", 4, DE_NULL };
+static const CallTrace::GetEnumNameFunc	s_glHintTraceEnums[]										= { DE_NULL, getHintName, getHintModeName };
+static const CallTrace::FuncInfo		s_glHintTraceInfo											= { "glHint", "vxx", 2, s_glHintTraceEnums };
+static const CallTrace::FuncInfo		s_glInsertEventMarkerEXTTraceInfo							= { "glInsertEventMarkerEXT", "vip", 2, DE_NULL };
+static const CallTrace::FuncInfo		s_glInvalidateBufferDataTraceInfo							= { "glInvalidateBufferData", "vu", 1, DE_NULL };
+static const CallTrace::FuncInfo		s_glInvalidateBufferSubDataTraceInfo						= { "glInvalidateBufferSubData", "vuii", 3, DE_NULL };
+static const CallTrace::GetEnumNameFunc	s_glInvalidateFramebufferTraceEnums[]						= { DE_NULL, getFramebufferTargetName, DE_NULL, DE_NULL };
+static const CallTrace::FuncInfo		s_glInvalidateFramebufferTraceInfo							= { "glInvalidateFramebuffer", "vxip", 3, s_glInvalidateFramebufferTraceEnums };
+static const CallTrace::FuncInfo		s_glInvalidateNamedFramebufferDataTraceInfo					= { "glInvalidateNamedFramebufferData", "vuip", 3, DE_NULL };
+static const CallTrace::FuncInfo		s_glInvalidateNamedFramebufferSubDataTraceInfo				= { "glInvalidateNamedFramebufferSubData", "vuipiiii", 7, DE_NULL };
+static const CallTrace::GetEnumNameFunc	s_glInvalidateSubFramebufferTraceEnums[]					= { DE_NULL, getFramebufferTargetName, DE_NULL, DE_NULL, DE_NULL, DE_NULL, DE_NULL, DE_NULL };
+static const CallTrace::FuncInfo		s_glInvalidateSubFramebufferTraceInfo						= { "glInvalidateSubFramebuffer", "vxipiiii", 7, s_glInvalidateSubFramebufferTraceEnums };
+static const CallTrace::FuncInfo		s_glInvalidateTexImageTraceInfo								= { "glInvalidateTexImage", "vui", 2, DE_NULL };
+static const CallTrace::FuncInfo		s_glInvalidateTexSubImageTraceInfo							= { "glInvalidateTexSubImage", "vuiiiiiii", 8, DE_NULL };
+static const CallTrace::FuncInfo		s_glIsBufferTraceInfo										= { "glIsBuffer", "bu", 1, DE_NULL };
+static const CallTrace::GetEnumNameFunc	s_glIsEnabledTraceEnums[]									= { DE_NULL, getEnableCapName };
+static const CallTrace::FuncInfo		s_glIsEnabledTraceInfo										= { "glIsEnabled", "bx", 1, s_glIsEnabledTraceEnums };
+static const CallTrace::GetEnumNameFunc	s_glIsEnablediTraceEnums[]									= { DE_NULL, getIndexedEnableCapName, DE_NULL };
+static const CallTrace::FuncInfo		s_glIsEnablediTraceInfo										= { "glIsEnabledi", "bxu", 2, s_glIsEnablediTraceEnums };
+static const CallTrace::FuncInfo		s_glIsFramebufferTraceInfo									= { "glIsFramebuffer", "bu", 1, DE_NULL };
+static const CallTrace::FuncInfo		s_glIsProgramTraceInfo										= { "glIsProgram", "bu", 1, DE_NULL };
+static const CallTrace::FuncInfo		s_glIsProgramPipelineTraceInfo								= { "glIsProgramPipeline", "bu", 1, DE_NULL };
+static const CallTrace::FuncInfo		s_glIsQueryTraceInfo										= { "glIsQuery", "bu", 1, DE_NULL };
+static const CallTrace::FuncInfo		s_glIsRenderbufferTraceInfo									= { "glIsRenderbuffer", "bu", 1, DE_NULL };
+static const CallTrace::FuncInfo		s_glIsSamplerTraceInfo										= { "glIsSampler", "bu", 1, DE_NULL };
+static const CallTrace::FuncInfo		s_glIsShaderTraceInfo										= { "glIsShader", "bu", 1, DE_NULL };
+static const CallTrace::FuncInfo		s_glIsSyncTraceInfo											= { "glIsSync", "bp", 1, DE_NULL };
+static const CallTrace::FuncInfo		s_glIsTextureTraceInfo										= { "glIsTexture", "bu", 1, DE_NULL };
+static const CallTrace::FuncInfo		s_glIsTransformFeedbackTraceInfo							= { "glIsTransformFeedback", "bu", 1, DE_NULL };
+static const CallTrace::FuncInfo		s_glIsVertexArrayTraceInfo									= { "glIsVertexArray", "bu", 1, DE_NULL };
+static const CallTrace::FuncInfo		s_glLineWidthTraceInfo										= { "glLineWidth", "vf", 1, DE_NULL };
+static const CallTrace::FuncInfo		s_glLinkProgramTraceInfo									= { "glLinkProgram", "vu", 1, DE_NULL };
+static const CallTrace::FuncInfo		s_glLogicOpTraceInfo										= { "glLogicOp", "vx", 1, DE_NULL };
+static const CallTrace::FuncInfo		s_glMapBufferTraceInfo										= { "glMapBuffer", "pxx", 2, DE_NULL };
+static const CallTrace::GetEnumNameFunc	s_glMapBufferRangeTraceEnums[]								= { DE_NULL, getBufferTargetName, DE_NULL, DE_NULL, DE_NULL };
+static const CallTrace::FuncInfo		s_glMapBufferRangeTraceInfo									= { "glMapBufferRange", "pxiix", 4, s_glMapBufferRangeTraceEnums };
+static const CallTrace::FuncInfo		s_glMapNamedBufferTraceInfo									= { "glMapNamedBuffer", "pux", 2, DE_NULL };
+static const CallTrace::FuncInfo		s_glMapNamedBufferEXTTraceInfo								= { "glMapNamedBufferEXT", "pux", 2, DE_NULL };
+static const CallTrace::FuncInfo		s_glMapNamedBufferRangeTraceInfo							= { "glMapNamedBufferRange", "puiix", 4, DE_NULL };
+static const CallTrace::FuncInfo		s_glMapNamedBufferRangeEXTTraceInfo							= { "glMapNamedBufferRangeEXT", "puiix", 4, DE_NULL };
+static const CallTrace::FuncInfo		s_glMatrixFrustumEXTTraceInfo								= { "glMatrixFrustumEXT", "vxdddddd", 7, DE_NULL };
+static const CallTrace::FuncInfo		s_glMatrixLoadIdentityEXTTraceInfo							= { "glMatrixLoadIdentityEXT", "vx", 1, DE_NULL };
+static const CallTrace::FuncInfo		s_glMatrixLoadTransposedEXTTraceInfo						= { "glMatrixLoadTransposedEXT", "vxp", 2, DE_NULL };
+static const CallTrace::FuncInfo		s_glMatrixLoadTransposefEXTTraceInfo						= { "glMatrixLoadTransposefEXT", "vxp", 2, DE_NULL };
+static const CallTrace::FuncInfo		s_glMatrixLoaddEXTTraceInfo									= { "glMatrixLoaddEXT", "vxp", 2, DE_NULL };
+static const CallTrace::FuncInfo		s_glMatrixLoadfEXTTraceInfo									= { "glMatrixLoadfEXT", "vxp", 2, DE_NULL };
+static const CallTrace::FuncInfo		s_glMatrixMultTransposedEXTTraceInfo						= { "glMatrixMultTransposedEXT", "vxp", 2, DE_NULL };
+static const CallTrace::FuncInfo		s_glMatrixMultTransposefEXTTraceInfo						= { "glMatrixMultTransposefEXT", "vxp", 2, DE_NULL };
+static const CallTrace::FuncInfo		s_glMatrixMultdEXTTraceInfo									= { "glMatrixMultdEXT", "vxp", 2, DE_NULL };
+static const CallTrace::FuncInfo		s_glMatrixMultfEXTTraceInfo									= { "glMatrixMultfEXT", "vxp", 2, DE_NULL };
+static const CallTrace::FuncInfo		s_glMatrixOrthoEXTTraceInfo									= { "glMatrixOrthoEXT", "vxdddddd", 7, DE_NULL };
+static const CallTrace::FuncInfo		s_glMatrixPopEXTTraceInfo									= { "glMatrixPopEXT", "vx", 1, DE_NULL };
+static const CallTrace::FuncInfo		s_glMatrixPushEXTTraceInfo									= { "glMatrixPushEXT", "vx", 1, DE_NULL };
+static const CallTrace::FuncInfo		s_glMatrixRotatedEXTTraceInfo								= { "glMatrixRotatedEXT", "vxdddd", 5, DE_NULL };
+static const CallTrace::FuncInfo		s_glMatrixRotatefEXTTraceInfo								= { "glMatrixRotatefEXT", "vxffff", 5, DE_NULL };
+static const CallTrace::FuncInfo		s_glMatrixScaledEXTTraceInfo								= { "glMatrixScaledEXT", "vxddd", 4, DE_NULL };
+static const CallTrace::FuncInfo		s_glMatrixScalefEXTTraceInfo								= { "glMatrixScalefEXT", "vxfff", 4, DE_NULL };
+static const CallTrace::FuncInfo		s_glMatrixTranslatedEXTTraceInfo							= { "glMatrixTranslatedEXT", "vxddd", 4, DE_NULL };
+static const CallTrace::FuncInfo		s_glMatrixTranslatefEXTTraceInfo							= { "glMatrixTranslatefEXT", "vxfff", 4, DE_NULL };
+static const CallTrace::FuncInfo		s_glMaxShaderCompilerThreadsKHRTraceInfo					= { "glMaxShaderCompilerThreadsKHR", "vu", 1, DE_NULL };
+static const CallTrace::FuncInfo		s_glMemoryBarrierTraceInfo									= { "glMemoryBarrier", "vx", 1, DE_NULL };
+static const CallTrace::FuncInfo		s_glMemoryBarrierByRegionTraceInfo							= { "glMemoryBarrierByRegion", "vx", 1, DE_NULL };
+static const CallTrace::FuncInfo		s_glMinSampleShadingTraceInfo								= { "glMinSampleShading", "vf", 1, DE_NULL };
+static const CallTrace::GetEnumNameFunc	s_glMultiDrawArraysTraceEnums[]								= { DE_NULL, getPrimitiveTypeName, DE_NULL, DE_NULL, DE_NULL };
+static const CallTrace::FuncInfo		s_glMultiDrawArraysTraceInfo								= { "glMultiDrawArrays", "vxppi", 4, s_glMultiDrawArraysTraceEnums };
+static const CallTrace::FuncInfo		s_glMultiDrawArraysIndirectTraceInfo						= { "glMultiDrawArraysIndirect", "vxpii", 4, DE_NULL };
+static const CallTrace::FuncInfo		s_glMultiDrawArraysIndirectCountTraceInfo					= { "glMultiDrawArraysIndirectCount", "vxpiii", 5, DE_NULL };
+static const CallTrace::GetEnumNameFunc	s_glMultiDrawElementsTraceEnums[]							= { DE_NULL, getPrimitiveTypeName, DE_NULL, getTypeName, DE_NULL, DE_NULL };
+static const CallTrace::FuncInfo		s_glMultiDrawElementsTraceInfo								= { "glMultiDrawElements", "vxpxpi", 5, s_glMultiDrawElementsTraceEnums };
+static const CallTrace::GetEnumNameFunc	s_glMultiDrawElementsBaseVertexTraceEnums[]					= { DE_NULL, getPrimitiveTypeName, DE_NULL, getTypeName, DE_NULL, DE_NULL, DE_NULL };
+static const CallTrace::FuncInfo		s_glMultiDrawElementsBaseVertexTraceInfo					= { "glMultiDrawElementsBaseVertex", "vxpxpip", 6, s_glMultiDrawElementsBaseVertexTraceEnums };
+static const CallTrace::FuncInfo		s_glMultiDrawElementsIndirectTraceInfo						= { "glMultiDrawElementsIndirect", "vxxpii", 5, DE_NULL };
+static const CallTrace::FuncInfo		s_glMultiDrawElementsIndirectCountTraceInfo					= { "glMultiDrawElementsIndirectCount", "vxxpiii", 6, DE_NULL };
+static const CallTrace::FuncInfo		s_glMultiTexBufferEXTTraceInfo								= { "glMultiTexBufferEXT", "vxxxu", 4, DE_NULL };
+static const CallTrace::FuncInfo		s_glMultiTexCoordPointerEXTTraceInfo						= { "glMultiTexCoordPointerEXT", "vxixip", 5, DE_NULL };
+static const CallTrace::FuncInfo		s_glMultiTexEnvfEXTTraceInfo								= { "glMultiTexEnvfEXT", "vxxxf", 4, DE_NULL };
+static const CallTrace::FuncInfo		s_glMultiTexEnvfvEXTTraceInfo								= { "glMultiTexEnvfvEXT", "vxxxp", 4, DE_NULL };
+static const CallTrace::FuncInfo		s_glMultiTexEnviEXTTraceInfo								= { "glMultiTexEnviEXT", "vxxxi", 4, DE_NULL };
+static const CallTrace::FuncInfo		s_glMultiTexEnvivEXTTraceInfo								= { "glMultiTexEnvivEXT", "vxxxp", 4, DE_NULL };
+static const CallTrace::FuncInfo		s_glMultiTexGendEXTTraceInfo								= { "glMultiTexGendEXT", "vxxxd", 4, DE_NULL };
+static const CallTrace::FuncInfo		s_glMultiTexGendvEXTTraceInfo								= { "glMultiTexGendvEXT", "vxxxp", 4, DE_NULL };
+static const CallTrace::FuncInfo		s_glMultiTexGenfEXTTraceInfo								= { "glMultiTexGenfEXT", "vxxxf", 4, DE_NULL };
+static const CallTrace::FuncInfo		s_glMultiTexGenfvEXTTraceInfo								= { "glMultiTexGenfvEXT", "vxxxp", 4, DE_NULL };
+static const CallTrace::FuncInfo		s_glMultiTexGeniEXTTraceInfo								= { "glMultiTexGeniEXT", "vxxxi", 4, DE_NULL };
+static const CallTrace::FuncInfo		s_glMultiTexGenivEXTTraceInfo								= { "glMultiTexGenivEXT", "vxxxp", 4, DE_NULL };
+static const CallTrace::FuncInfo		s_glMultiTexImage1DEXTTraceInfo								= { "glMultiTexImage1DEXT", "vxxiiiixxp", 9, DE_NULL };
+static const CallTrace::FuncInfo		s_glMultiTexImage2DEXTTraceInfo								= { "glMultiTexImage2DEXT", "vxxiiiiixxp", 10, DE_NULL };
+static const CallTrace::FuncInfo		s_glMultiTexImage3DEXTTraceInfo								= { "glMultiTexImage3DEXT", "vxxiiiiiixxp", 11, DE_NULL };
+static const CallTrace::FuncInfo		s_glMultiTexParameterIivEXTTraceInfo						= { "glMultiTexParameterIivEXT", "vxxxp", 4, DE_NULL };
+static const CallTrace::FuncInfo		s_glMultiTexParameterIuivEXTTraceInfo						= { "glMultiTexParameterIuivEXT", "vxxxp", 4, DE_NULL };
+static const CallTrace::FuncInfo		s_glMultiTexParameterfEXTTraceInfo							= { "glMultiTexParameterfEXT", "vxxxf", 4, DE_NULL };
+static const CallTrace::FuncInfo		s_glMultiTexParameterfvEXTTraceInfo							= { "glMultiTexParameterfvEXT", "vxxxp", 4, DE_NULL };
+static const CallTrace::FuncInfo		s_glMultiTexParameteriEXTTraceInfo							= { "glMultiTexParameteriEXT", "vxxxi", 4, DE_NULL };
+static const CallTrace::FuncInfo		s_glMultiTexParameterivEXTTraceInfo							= { "glMultiTexParameterivEXT", "vxxxp", 4, DE_NULL };
+static const CallTrace::FuncInfo		s_glMultiTexRenderbufferEXTTraceInfo						= { "glMultiTexRenderbufferEXT", "vxxu", 3, DE_NULL };
+static const CallTrace::FuncInfo		s_glMultiTexSubImage1DEXTTraceInfo							= { "glMultiTexSubImage1DEXT", "vxxiiixxp", 8, DE_NULL };
+static const CallTrace::FuncInfo		s_glMultiTexSubImage2DEXTTraceInfo							= { "glMultiTexSubImage2DEXT", "vxxiiiiixxp", 10, DE_NULL };
+static const CallTrace::FuncInfo		s_glMultiTexSubImage3DEXTTraceInfo							= { "glMultiTexSubImage3DEXT", "vxxiiiiiiixxp", 12, DE_NULL };
+static const CallTrace::FuncInfo		s_glMulticastBarrierNVTraceInfo								= { "glMulticastBarrierNV", "v", 0, DE_NULL };
+static const CallTrace::FuncInfo		s_glMulticastBlitFramebufferNVTraceInfo						= { "glMulticastBlitFramebufferNV", "vuuiiiiiiiixx", 12, DE_NULL };
+static const CallTrace::FuncInfo		s_glMulticastBufferSubDataNVTraceInfo						= { "glMulticastBufferSubDataNV", "vxuiip", 5, DE_NULL };
+static const CallTrace::FuncInfo		s_glMulticastCopyBufferSubDataNVTraceInfo					= { "glMulticastCopyBufferSubDataNV", "vuxuuiii", 7, DE_NULL };
+static const CallTrace::FuncInfo		s_glMulticastCopyImageSubDataNVTraceInfo					= { "glMulticastCopyImageSubDataNV", "vuxuxiiiiuxiiiiiii", 17, DE_NULL };
+static const CallTrace::FuncInfo		s_glMulticastFramebufferSampleLocationsfvNVTraceInfo		= { "glMulticastFramebufferSampleLocationsfvNV", "vuuuip", 5, DE_NULL };
+static const CallTrace::FuncInfo		s_glMulticastGetQueryObjecti64vNVTraceInfo					= { "glMulticastGetQueryObjecti64vNV", "vuuxp", 4, DE_NULL };
+static const CallTrace::FuncInfo		s_glMulticastGetQueryObjectivNVTraceInfo					= { "glMulticastGetQueryObjectivNV", "vuuxp", 4, DE_NULL };
+static const CallTrace::FuncInfo		s_glMulticastGetQueryObjectui64vNVTraceInfo					= { "glMulticastGetQueryObjectui64vNV", "vuuxp", 4, DE_NULL };
+static const CallTrace::FuncInfo		s_glMulticastGetQueryObjectuivNVTraceInfo					= { "glMulticastGetQueryObjectuivNV", "vuuxp", 4, DE_NULL };
+static const CallTrace::FuncInfo		s_glMulticastWaitSyncNVTraceInfo							= { "glMulticastWaitSyncNV", "vux", 2, DE_NULL };
+static const CallTrace::FuncInfo		s_glNamedBufferDataTraceInfo								= { "glNamedBufferData", "vuipx", 4, DE_NULL };
+static const CallTrace::FuncInfo		s_glNamedBufferDataEXTTraceInfo								= { "glNamedBufferDataEXT", "vuipx", 4, DE_NULL };
+static const CallTrace::FuncInfo		s_glNamedBufferPageCommitmentARBTraceInfo					= { "glNamedBufferPageCommitmentARB", "vuiib", 4, DE_NULL };
+static const CallTrace::FuncInfo		s_glNamedBufferPageCommitmentEXTTraceInfo					= { "glNamedBufferPageCommitmentEXT", "vuiib", 4, DE_NULL };
+static const CallTrace::FuncInfo		s_glNamedBufferStorageTraceInfo								= { "glNamedBufferStorage", "vuipx", 4, DE_NULL };
+static const CallTrace::FuncInfo		s_glNamedBufferSubDataTraceInfo								= { "glNamedBufferSubData", "vuiip", 4, DE_NULL };
+static const CallTrace::FuncInfo		s_glNamedCopyBufferSubDataEXTTraceInfo						= { "glNamedCopyBufferSubDataEXT", "vuuiii", 5, DE_NULL };
+static const CallTrace::FuncInfo		s_glNamedFramebufferDrawBufferTraceInfo						= { "glNamedFramebufferDrawBuffer", "vux", 2, DE_NULL };
+static const CallTrace::FuncInfo		s_glNamedFramebufferDrawBuffersTraceInfo					= { "glNamedFramebufferDrawBuffers", "vuip", 3, DE_NULL };
+static const CallTrace::FuncInfo		s_glNamedFramebufferParameteriTraceInfo						= { "glNamedFramebufferParameteri", "vuxi", 3, DE_NULL };
+static const CallTrace::FuncInfo		s_glNamedFramebufferParameteriEXTTraceInfo					= { "glNamedFramebufferParameteriEXT", "vuxi", 3, DE_NULL };
+static const CallTrace::FuncInfo		s_glNamedFramebufferReadBufferTraceInfo						= { "glNamedFramebufferReadBuffer", "vux", 2, DE_NULL };
+static const CallTrace::FuncInfo		s_glNamedFramebufferRenderbufferTraceInfo					= { "glNamedFramebufferRenderbuffer", "vuxxu", 4, DE_NULL };
+static const CallTrace::FuncInfo		s_glNamedFramebufferRenderbufferEXTTraceInfo				= { "glNamedFramebufferRenderbufferEXT", "vuxxu", 4, DE_NULL };
+static const CallTrace::FuncInfo		s_glNamedFramebufferTextureTraceInfo						= { "glNamedFramebufferTexture", "vuxui", 4, DE_NULL };
+static const CallTrace::FuncInfo		s_glNamedFramebufferTexture1DEXTTraceInfo					= { "glNamedFramebufferTexture1DEXT", "vuxxui", 5, DE_NULL };
+static const CallTrace::FuncInfo		s_glNamedFramebufferTexture2DEXTTraceInfo					= { "glNamedFramebufferTexture2DEXT", "vuxxui", 5, DE_NULL };
+static const CallTrace::FuncInfo		s_glNamedFramebufferTexture3DEXTTraceInfo					= { "glNamedFramebufferTexture3DEXT", "vuxxuii", 6, DE_NULL };
+static const CallTrace::FuncInfo		s_glNamedFramebufferTextureEXTTraceInfo						= { "glNamedFramebufferTextureEXT", "vuxui", 4, DE_NULL };
+static const CallTrace::FuncInfo		s_glNamedFramebufferTextureFaceEXTTraceInfo					= { "glNamedFramebufferTextureFaceEXT", "vuxuix", 5, DE_NULL };
+static const CallTrace::FuncInfo		s_glNamedFramebufferTextureLayerTraceInfo					= { "glNamedFramebufferTextureLayer", "vuxuii", 5, DE_NULL };
+static const CallTrace::FuncInfo		s_glNamedFramebufferTextureLayerEXTTraceInfo				= { "glNamedFramebufferTextureLayerEXT", "vuxuii", 5, DE_NULL };
+static const CallTrace::FuncInfo		s_glNamedProgramLocalParameter4dEXTTraceInfo				= { "glNamedProgramLocalParameter4dEXT", "vuxudddd", 7, DE_NULL };
+static const CallTrace::FuncInfo		s_glNamedProgramLocalParameter4dvEXTTraceInfo				= { "glNamedProgramLocalParameter4dvEXT", "vuxup", 4, DE_NULL };
+static const CallTrace::FuncInfo		s_glNamedProgramLocalParameter4fEXTTraceInfo				= { "glNamedProgramLocalParameter4fEXT", "vuxuffff", 7, DE_NULL };
+static const CallTrace::FuncInfo		s_glNamedProgramLocalParameter4fvEXTTraceInfo				= { "glNamedProgramLocalParameter4fvEXT", "vuxup", 4, DE_NULL };
+static const CallTrace::FuncInfo		s_glNamedProgramLocalParameterI4iEXTTraceInfo				= { "glNamedProgramLocalParameterI4iEXT", "vuxuiiii", 7, DE_NULL };
+static const CallTrace::FuncInfo		s_glNamedProgramLocalParameterI4ivEXTTraceInfo				= { "glNamedProgramLocalParameterI4ivEXT", "vuxup", 4, DE_NULL };
+static const CallTrace::FuncInfo		s_glNamedProgramLocalParameterI4uiEXTTraceInfo				= { "glNamedProgramLocalParameterI4uiEXT", "vuxuuuuu", 7, DE_NULL };
+static const CallTrace::FuncInfo		s_glNamedProgramLocalParameterI4uivEXTTraceInfo				= { "glNamedProgramLocalParameterI4uivEXT", "vuxup", 4, DE_NULL };
+static const CallTrace::FuncInfo		s_glNamedProgramLocalParameters4fvEXTTraceInfo				= { "glNamedProgramLocalParameters4fvEXT", "vuxuip", 5, DE_NULL };
+static const CallTrace::FuncInfo		s_glNamedProgramLocalParametersI4ivEXTTraceInfo				= { "glNamedProgramLocalParametersI4ivEXT", "vuxuip", 5, DE_NULL };
+static const CallTrace::FuncInfo		s_glNamedProgramLocalParametersI4uivEXTTraceInfo			= { "glNamedProgramLocalParametersI4uivEXT", "vuxuip", 5, DE_NULL };
+static const CallTrace::FuncInfo		s_glNamedProgramStringEXTTraceInfo							= { "glNamedProgramStringEXT", "vuxxip", 5, DE_NULL };
+static const CallTrace::FuncInfo		s_glNamedRenderbufferStorageTraceInfo						= { "glNamedRenderbufferStorage", "vuxii", 4, DE_NULL };
+static const CallTrace::FuncInfo		s_glNamedRenderbufferStorageEXTTraceInfo					= { "glNamedRenderbufferStorageEXT", "vuxii", 4, DE_NULL };
+static const CallTrace::FuncInfo		s_glNamedRenderbufferStorageMultisampleTraceInfo			= { "glNamedRenderbufferStorageMultisample", "vuixii", 5, DE_NULL };
+static const CallTrace::FuncInfo		s_glNamedRenderbufferStorageMultisampleCoverageEXTTraceInfo	= { "glNamedRenderbufferStorageMultisampleCoverageEXT", "vuiixii", 6, DE_NULL };
+static const CallTrace::FuncInfo		s_glNamedRenderbufferStorageMultisampleEXTTraceInfo			= { "glNamedRenderbufferStorageMultisampleEXT", "vuixii", 5, DE_NULL };
+static const CallTrace::FuncInfo		s_glObjectLabelTraceInfo									= { "glObjectLabel", "vxuip", 4, DE_NULL };
+static const CallTrace::FuncInfo		s_glObjectPtrLabelTraceInfo									= { "glObjectPtrLabel", "vpip", 3, DE_NULL };
+static const CallTrace::FuncInfo		s_glPatchParameterfvTraceInfo								= { "glPatchParameterfv", "vxp", 2, DE_NULL };
+static const CallTrace::GetEnumNameFunc	s_glPatchParameteriTraceEnums[]								= { DE_NULL, getPatchParamName, DE_NULL };
+static const CallTrace::FuncInfo		s_glPatchParameteriTraceInfo								= { "glPatchParameteri", "vxi", 2, s_glPatchParameteriTraceEnums };
+static const CallTrace::FuncInfo		s_glPauseTransformFeedbackTraceInfo							= { "glPauseTransformFeedback", "v", 0, DE_NULL };
+static const CallTrace::FuncInfo		s_glPixelStorefTraceInfo									= { "glPixelStoref", "vxf", 2, DE_NULL };
+static const CallTrace::GetEnumNameFunc	s_glPixelStoreiTraceEnums[]									= { DE_NULL, getPixelStoreParameterName, DE_NULL };
+static const CallTrace::FuncInfo		s_glPixelStoreiTraceInfo									= { "glPixelStorei", "vxi", 2, s_glPixelStoreiTraceEnums };
+static const CallTrace::FuncInfo		s_glPointParameterfTraceInfo								= { "glPointParameterf", "vxf", 2, DE_NULL };
+static const CallTrace::FuncInfo		s_glPointParameterfvTraceInfo								= { "glPointParameterfv", "vxp", 2, DE_NULL };
+static const CallTrace::FuncInfo		s_glPointParameteriTraceInfo								= { "glPointParameteri", "vxi", 2, DE_NULL };
+static const CallTrace::FuncInfo		s_glPointParameterivTraceInfo								= { "glPointParameteriv", "vxp", 2, DE_NULL };
+static const CallTrace::FuncInfo		s_glPointSizeTraceInfo										= { "glPointSize", "vf", 1, DE_NULL };
+static const CallTrace::FuncInfo		s_glPolygonModeTraceInfo									= { "glPolygonMode", "vxx", 2, DE_NULL };
+static const CallTrace::FuncInfo		s_glPolygonOffsetTraceInfo									= { "glPolygonOffset", "vff", 2, DE_NULL };
+static const CallTrace::FuncInfo		s_glPolygonOffsetClampTraceInfo								= { "glPolygonOffsetClamp", "vfff", 3, DE_NULL };
+static const CallTrace::FuncInfo		s_glPopDebugGroupTraceInfo									= { "glPopDebugGroup", "v", 0, DE_NULL };
+static const CallTrace::FuncInfo		s_glPopGroupMarkerEXTTraceInfo								= { "glPopGroupMarkerEXT", "v", 0, DE_NULL };
+static const CallTrace::FuncInfo		s_glPrimitiveBoundingBoxTraceInfo							= { "glPrimitiveBoundingBox", "vffffffff", 8, DE_NULL };
+static const CallTrace::FuncInfo		s_glPrimitiveRestartIndexTraceInfo							= { "glPrimitiveRestartIndex", "vu", 1, DE_NULL };
+static const CallTrace::FuncInfo		s_glProgramBinaryTraceInfo									= { "glProgramBinary", "vuxpi", 4, DE_NULL };
+static const CallTrace::GetEnumNameFunc	s_glProgramParameteriTraceEnums[]							= { DE_NULL, DE_NULL, getProgramParamName, DE_NULL };
+static const CallTrace::FuncInfo		s_glProgramParameteriTraceInfo								= { "glProgramParameteri", "vuxi", 3, s_glProgramParameteriTraceEnums };
+static const CallTrace::FuncInfo		s_glProgramUniform1dTraceInfo								= { "glProgramUniform1d", "vuid", 3, DE_NULL };
+static const CallTrace::FuncInfo		s_glProgramUniform1dEXTTraceInfo							= { "glProgramUniform1dEXT", "vuid", 3, DE_NULL };
+static const CallTrace::FuncInfo		s_glProgramUniform1dvTraceInfo								= { "glProgramUniform1dv", "vuiip", 4, DE_NULL };
+static const CallTrace::FuncInfo		s_glProgramUniform1dvEXTTraceInfo							= { "glProgramUniform1dvEXT", "vuiip", 4, DE_NULL };
+static const CallTrace::FuncInfo		s_glProgramUniform1fTraceInfo								= { "glProgramUniform1f", "vuif", 3, DE_NULL };
+static const CallTrace::FuncInfo		s_glProgramUniform1fvTraceInfo								= { "glProgramUniform1fv", "vuiip", 4, DE_NULL };
+static const CallTrace::FuncInfo		s_glProgramUniform1iTraceInfo								= { "glProgramUniform1i", "vuii", 3, DE_NULL };
+static const CallTrace::FuncInfo		s_glProgramUniform1ivTraceInfo								= { "glProgramUniform1iv", "vuiip", 4, DE_NULL };
+static const CallTrace::FuncInfo		s_glProgramUniform1uiTraceInfo								= { "glProgramUniform1ui", "vuiu", 3, DE_NULL };
+static const CallTrace::FuncInfo		s_glProgramUniform1uivTraceInfo								= { "glProgramUniform1uiv", "vuiip", 4, DE_NULL };
+static const CallTrace::FuncInfo		s_glProgramUniform2dTraceInfo								= { "glProgramUniform2d", "vuidd", 4, DE_NULL };
+static const CallTrace::FuncInfo		s_glProgramUniform2dEXTTraceInfo							= { "glProgramUniform2dEXT", "vuidd", 4, DE_NULL };
+static const CallTrace::FuncInfo		s_glProgramUniform2dvTraceInfo								= { "glProgramUniform2dv", "vuiip", 4, DE_NULL };
+static const CallTrace::FuncInfo		s_glProgramUniform2dvEXTTraceInfo							= { "glProgramUniform2dvEXT", "vuiip", 4, DE_NULL };
+static const CallTrace::FuncInfo		s_glProgramUniform2fTraceInfo								= { "glProgramUniform2f", "vuiff", 4, DE_NULL };
+static const CallTrace::FuncInfo		s_glProgramUniform2fvTraceInfo								= { "glProgramUniform2fv", "vuiip", 4, DE_NULL };
+static const CallTrace::FuncInfo		s_glProgramUniform2iTraceInfo								= { "glProgramUniform2i", "vuiii", 4, DE_NULL };
+static const CallTrace::FuncInfo		s_glProgramUniform2ivTraceInfo								= { "glProgramUniform2iv", "vuiip", 4, DE_NULL };
+static const CallTrace::FuncInfo		s_glProgramUniform2uiTraceInfo								= { "glProgramUniform2ui", "vuiuu", 4, DE_NULL };
+static const CallTrace::FuncInfo		s_glProgramUniform2uivTraceInfo								= { "glProgramUniform2uiv", "vuiip", 4, DE_NULL };
+static const CallTrace::FuncInfo		s_glProgramUniform3dTraceInfo								= { "glProgramUniform3d", "vuiddd", 5, DE_NULL };
+static const CallTrace::FuncInfo		s_glProgramUniform3dEXTTraceInfo							= { "glProgramUniform3dEXT", "vuiddd", 5, DE_NULL };
+static const CallTrace::FuncInfo		s_glProgramUniform3dvTraceInfo								= { "glProgramUniform3dv", "vuiip", 4, DE_NULL };
+static const CallTrace::FuncInfo		s_glProgramUniform3dvEXTTraceInfo							= { "glProgramUniform3dvEXT", "vuiip", 4, DE_NULL };
+static const CallTrace::FuncInfo		s_glProgramUniform3fTraceInfo								= { "glProgramUniform3f", "vuifff", 5, DE_NULL };
+static const CallTrace::FuncInfo		s_glProgramUniform3fvTraceInfo								= { "glProgramUniform3fv", "vuiip", 4, DE_NULL };
+static const CallTrace::FuncInfo		s_glProgramUniform3iTraceInfo								= { "glProgramUniform3i", "vuiiii", 5, DE_NULL };
+static const CallTrace::FuncInfo		s_glProgramUniform3ivTraceInfo								= { "glProgramUniform3iv", "vuiip", 4, DE_NULL };
+static const CallTrace::FuncInfo		s_glProgramUniform3uiTraceInfo								= { "glProgramUniform3ui", "vuiuuu", 5, DE_NULL };
+static const CallTrace::FuncInfo		s_glProgramUniform3uivTraceInfo								= { "glProgramUniform3uiv", "vuiip", 4, DE_NULL };
+static const CallTrace::FuncInfo		s_glProgramUniform4dTraceInfo								= { "glProgramUniform4d", "vuidddd", 6, DE_NULL };
+static const CallTrace::FuncInfo		s_glProgramUniform4dEXTTraceInfo							= { "glProgramUniform4dEXT", "vuidddd", 6, DE_NULL };
+static const CallTrace::FuncInfo		s_glProgramUniform4dvTraceInfo								= { "glProgramUniform4dv", "vuiip", 4, DE_NULL };
+static const CallTrace::FuncInfo		s_glProgramUniform4dvEXTTraceInfo							= { "glProgramUniform4dvEXT", "vuiip", 4, DE_NULL };
+static const CallTrace::FuncInfo		s_glProgramUniform4fTraceInfo								= { "glProgramUniform4f", "vuiffff", 6, DE_NULL };
+static const CallTrace::FuncInfo		s_glProgramUniform4fvTraceInfo								= { "glProgramUniform4fv", "vuiip", 4, DE_NULL };
+static const CallTrace::FuncInfo		s_glProgramUniform4iTraceInfo								= { "glProgramUniform4i", "vuiiiii", 6, DE_NULL };
+static const CallTrace::FuncInfo		s_glProgramUniform4ivTraceInfo								= { "glProgramUniform4iv", "vuiip", 4, DE_NULL };
+static const CallTrace::FuncInfo		s_glProgramUniform4uiTraceInfo								= { "glProgramUniform4ui", "vuiuuuu", 6, DE_NULL };
+static const CallTrace::FuncInfo		s_glProgramUniform4uivTraceInfo								= { "glProgramUniform4uiv", "vuiip", 4, DE_NULL };
+static const CallTrace::FuncInfo		s_glProgramUniformMatrix2dvTraceInfo						= { "glProgramUniformMatrix2dv", "vuiibp", 5, DE_NULL };
+static const CallTrace::FuncInfo		s_glProgramUniformMatrix2dvEXTTraceInfo						= { "glProgramUniformMatrix2dvEXT", "vuiibp", 5, DE_NULL };
+static const CallTrace::FuncInfo		s_glProgramUniformMatrix2fvTraceInfo						= { "glProgramUniformMatrix2fv", "vuiibp", 5, DE_NULL };
+static const CallTrace::FuncInfo		s_glProgramUniformMatrix2x3dvTraceInfo						= { "glProgramUniformMatrix2x3dv", "vuiibp", 5, DE_NULL };
+static const CallTrace::FuncInfo		s_glProgramUniformMatrix2x3dvEXTTraceInfo					= { "glProgramUniformMatrix2x3dvEXT", "vuiibp", 5, DE_NULL };
+static const CallTrace::FuncInfo		s_glProgramUniformMatrix2x3fvTraceInfo						= { "glProgramUniformMatrix2x3fv", "vuiibp", 5, DE_NULL };
+static const CallTrace::FuncInfo		s_glProgramUniformMatrix2x4dvTraceInfo						= { "glProgramUniformMatrix2x4dv", "vuiibp", 5, DE_NULL };
+static const CallTrace::FuncInfo		s_glProgramUniformMatrix2x4dvEXTTraceInfo					= { "glProgramUniformMatrix2x4dvEXT", "vuiibp", 5, DE_NULL };
+static const CallTrace::FuncInfo		s_glProgramUniformMatrix2x4fvTraceInfo						= { "glProgramUniformMatrix2x4fv", "vuiibp", 5, DE_NULL };
+static const CallTrace::FuncInfo		s_glProgramUniformMatrix3dvTraceInfo						= { "glProgramUniformMatrix3dv", "vuiibp", 5, DE_NULL };
+static const CallTrace::FuncInfo		s_glProgramUniformMatrix3dvEXTTraceInfo						= { "glProgramUniformMatrix3dvEXT", "vuiibp", 5, DE_NULL };
+static const CallTrace::FuncInfo		s_glProgramUniformMatrix3fvTraceInfo						= { "glProgramUniformMatrix3fv", "vuiibp", 5, DE_NULL };
+static const CallTrace::FuncInfo		s_glProgramUniformMatrix3x2dvTraceInfo						= { "glProgramUniformMatrix3x2dv", "vuiibp", 5, DE_NULL };
+static const CallTrace::FuncInfo		s_glProgramUniformMatrix3x2dvEXTTraceInfo					= { "glProgramUniformMatrix3x2dvEXT", "vuiibp", 5, DE_NULL };
+static const CallTrace::FuncInfo		s_glProgramUniformMatrix3x2fvTraceInfo						= { "glProgramUniformMatrix3x2fv", "vuiibp", 5, DE_NULL };
+static const CallTrace::FuncInfo		s_glProgramUniformMatrix3x4dvTraceInfo						= { "glProgramUniformMatrix3x4dv", "vuiibp", 5, DE_NULL };
+static const CallTrace::FuncInfo		s_glProgramUniformMatrix3x4dvEXTTraceInfo					= { "glProgramUniformMatrix3x4dvEXT", "vuiibp", 5, DE_NULL };
+static const CallTrace::FuncInfo		s_glProgramUniformMatrix3x4fvTraceInfo						= { "glProgramUniformMatrix3x4fv", "vuiibp", 5, DE_NULL };
+static const CallTrace::FuncInfo		s_glProgramUniformMatrix4dvTraceInfo						= { "glProgramUniformMatrix4dv", "vuiibp", 5, DE_NULL };
+static const CallTrace::FuncInfo		s_glProgramUniformMatrix4dvEXTTraceInfo						= { "glProgramUniformMatrix4dvEXT", "vuiibp", 5, DE_NULL };
+static const CallTrace::FuncInfo		s_glProgramUniformMatrix4fvTraceInfo						= { "glProgramUniformMatrix4fv", "vuiibp", 5, DE_NULL };
+static const CallTrace::FuncInfo		s_glProgramUniformMatrix4x2dvTraceInfo						= { "glProgramUniformMatrix4x2dv", "vuiibp", 5, DE_NULL };
+static const CallTrace::FuncInfo		s_glProgramUniformMatrix4x2dvEXTTraceInfo					= { "glProgramUniformMatrix4x2dvEXT", "vuiibp", 5, DE_NULL };
+static const CallTrace::FuncInfo		s_glProgramUniformMatrix4x2fvTraceInfo						= { "glProgramUniformMatrix4x2fv", "vuiibp", 5, DE_NULL };
+static const CallTrace::FuncInfo		s_glProgramUniformMatrix4x3dvTraceInfo						= { "glProgramUniformMatrix4x3dv", "vuiibp", 5, DE_NULL };
+static const CallTrace::FuncInfo		s_glProgramUniformMatrix4x3dvEXTTraceInfo					= { "glProgramUniformMatrix4x3dvEXT", "vuiibp", 5, DE_NULL };
+static const CallTrace::FuncInfo		s_glProgramUniformMatrix4x3fvTraceInfo						= { "glProgramUniformMatrix4x3fv", "vuiibp", 5, DE_NULL };
+static const CallTrace::GetEnumNameFunc	s_glProvokingVertexTraceEnums[]								= { DE_NULL, getProvokingVertexName };
+static const CallTrace::FuncInfo		s_glProvokingVertexTraceInfo								= { "glProvokingVertex", "vx", 1, s_glProvokingVertexTraceEnums };
+static const CallTrace::FuncInfo		s_glPushClientAttribDefaultEXTTraceInfo						= { "glPushClientAttribDefaultEXT", "vx", 1, DE_NULL };
+static const CallTrace::GetEnumNameFunc	s_glPushDebugGroupTraceEnums[]								= { DE_NULL, getDebugMessageSourceName, DE_NULL, DE_NULL, DE_NULL };
+static const CallTrace::FuncInfo		s_glPushDebugGroupTraceInfo									= { "glPushDebugGroup", "vxuip", 4, s_glPushDebugGroupTraceEnums };
+static const CallTrace::FuncInfo		s_glPushGroupMarkerEXTTraceInfo								= { "glPushGroupMarkerEXT", "vip", 2, DE_NULL };
+static const CallTrace::FuncInfo		s_glQueryCounterTraceInfo									= { "glQueryCounter", "vux", 2, DE_NULL };
+static const CallTrace::GetEnumNameFunc	s_glReadBufferTraceEnums[]									= { DE_NULL, getDrawReadBufferName };
+static const CallTrace::FuncInfo		s_glReadBufferTraceInfo										= { "glReadBuffer", "vx", 1, s_glReadBufferTraceEnums };
+static const CallTrace::GetEnumNameFunc	s_glReadPixelsTraceEnums[]									= { DE_NULL, DE_NULL, DE_NULL, DE_NULL, DE_NULL, getUncompressedTextureFormatName, getTypeName, DE_NULL };
+static const CallTrace::FuncInfo		s_glReadPixelsTraceInfo										= { "glReadPixels", "viiiixxp", 7, s_glReadPixelsTraceEnums };
+static const CallTrace::FuncInfo		s_glReadnPixelsTraceInfo									= { "glReadnPixels", "viiiixxip", 8, DE_NULL };
+static const CallTrace::FuncInfo		s_glReleaseShaderCompilerTraceInfo							= { "glReleaseShaderCompiler", "v", 0, DE_NULL };
+static const CallTrace::FuncInfo		s_glRenderGpuMaskNVTraceInfo								= { "glRenderGpuMaskNV", "vx", 1, DE_NULL };
+static const CallTrace::GetEnumNameFunc	s_glRenderbufferStorageTraceEnums[]							= { DE_NULL, getFramebufferTargetName, getUncompressedTextureFormatName, DE_NULL, DE_NULL };
+static const CallTrace::FuncInfo		s_glRenderbufferStorageTraceInfo							= { "glRenderbufferStorage", "vxxii", 4, s_glRenderbufferStorageTraceEnums };
+static const CallTrace::GetEnumNameFunc	s_glRenderbufferStorageMultisampleTraceEnums[]				= { DE_NULL, getFramebufferTargetName, DE_NULL, getUncompressedTextureFormatName, DE_NULL, DE_NULL };
+static const CallTrace::FuncInfo		s_glRenderbufferStorageMultisampleTraceInfo					= { "glRenderbufferStorageMultisample", "vxixii", 5, s_glRenderbufferStorageMultisampleTraceEnums };
+static const CallTrace::FuncInfo		s_glResumeTransformFeedbackTraceInfo						= { "glResumeTransformFeedback", "v", 0, DE_NULL };
+static const CallTrace::FuncInfo		s_glSampleCoverageTraceInfo									= { "glSampleCoverage", "vfb", 2, DE_NULL };
+static const CallTrace::FuncInfo		s_glSampleMaskiTraceInfo									= { "glSampleMaski", "vux", 2, DE_NULL };
+static const CallTrace::GetEnumNameFunc	s_glSamplerParameterIivTraceEnums[]							= { DE_NULL, DE_NULL, getTextureParameterName, DE_NULL };
+static const CallTrace::FuncInfo		s_glSamplerParameterIivTraceInfo							= { "glSamplerParameterIiv", "vuxp", 3, s_glSamplerParameterIivTraceEnums };
+static const CallTrace::GetEnumNameFunc	s_glSamplerParameterIuivTraceEnums[]						= { DE_NULL, DE_NULL, getTextureParameterName, DE_NULL };
+static const CallTrace::FuncInfo		s_glSamplerParameterIuivTraceInfo							= { "glSamplerParameterIuiv", "vuxp", 3, s_glSamplerParameterIuivTraceEnums };
+static const CallTrace::GetEnumNameFunc	s_glSamplerParameterfTraceEnums[]							= { DE_NULL, DE_NULL, getTextureParameterName, DE_NULL };
+static const CallTrace::FuncInfo		s_glSamplerParameterfTraceInfo								= { "glSamplerParameterf", "vuxf", 3, s_glSamplerParameterfTraceEnums };
+static const CallTrace::GetEnumNameFunc	s_glSamplerParameterfvTraceEnums[]							= { DE_NULL, DE_NULL, getTextureParameterName, DE_NULL };
+static const CallTrace::FuncInfo		s_glSamplerParameterfvTraceInfo								= { "glSamplerParameterfv", "vuxp", 3, s_glSamplerParameterfvTraceEnums };
+static const CallTrace::GetEnumNameFunc	s_glSamplerParameteriTraceEnums[]							= { DE_NULL, DE_NULL, getTextureParameterName, DE_NULL };
+static const CallTrace::FuncInfo		s_glSamplerParameteriTraceInfo								= { "glSamplerParameteri", "vuxi", 3, s_glSamplerParameteriTraceEnums };
+static const CallTrace::GetEnumNameFunc	s_glSamplerParameterivTraceEnums[]							= { DE_NULL, DE_NULL, getTextureParameterName, DE_NULL };
+static const CallTrace::FuncInfo		s_glSamplerParameterivTraceInfo								= { "glSamplerParameteriv", "vuxp", 3, s_glSamplerParameterivTraceEnums };
+static const CallTrace::FuncInfo		s_glScissorTraceInfo										= { "glScissor", "viiii", 4, DE_NULL };
+static const CallTrace::FuncInfo		s_glScissorArrayvTraceInfo									= { "glScissorArrayv", "vuip", 3, DE_NULL };
+static const CallTrace::FuncInfo		s_glScissorIndexedTraceInfo									= { "glScissorIndexed", "vuiiii", 5, DE_NULL };
+static const CallTrace::FuncInfo		s_glScissorIndexedvTraceInfo								= { "glScissorIndexedv", "vup", 2, DE_NULL };
+static const CallTrace::FuncInfo		s_glShaderBinaryTraceInfo									= { "glShaderBinary", "vipxpi", 5, DE_NULL };
+static const CallTrace::FuncInfo		s_glShaderSourceTraceInfo									= { "glShaderSource", "vuipp", 4, DE_NULL };
+static const CallTrace::FuncInfo		s_glShaderStorageBlockBindingTraceInfo						= { "glShaderStorageBlockBinding", "vuuu", 3, DE_NULL };
+static const CallTrace::FuncInfo		s_glSpecializeShaderTraceInfo								= { "glSpecializeShader", "vupupp", 5, DE_NULL };
+static const CallTrace::GetEnumNameFunc	s_glStencilFuncTraceEnums[]									= { DE_NULL, getCompareFuncName, DE_NULL, DE_NULL };
+static const CallTrace::FuncInfo		s_glStencilFuncTraceInfo									= { "glStencilFunc", "vxiu", 3, s_glStencilFuncTraceEnums };
+static const CallTrace::GetEnumNameFunc	s_glStencilFuncSeparateTraceEnums[]							= { DE_NULL, getFaceName, getCompareFuncName, DE_NULL, DE_NULL };
+static const CallTrace::FuncInfo		s_glStencilFuncSeparateTraceInfo							= { "glStencilFuncSeparate", "vxxiu", 4, s_glStencilFuncSeparateTraceEnums };
+static const CallTrace::FuncInfo		s_glStencilMaskTraceInfo									= { "glStencilMask", "vu", 1, DE_NULL };
+static const CallTrace::GetEnumNameFunc	s_glStencilMaskSeparateTraceEnums[]							= { DE_NULL, getFaceName, DE_NULL };
+static const CallTrace::FuncInfo		s_glStencilMaskSeparateTraceInfo							= { "glStencilMaskSeparate", "vxu", 2, s_glStencilMaskSeparateTraceEnums };
+static const CallTrace::GetEnumNameFunc	s_glStencilOpTraceEnums[]									= { DE_NULL, getStencilOpName, getStencilOpName, getStencilOpName };
+static const CallTrace::FuncInfo		s_glStencilOpTraceInfo										= { "glStencilOp", "vxxx", 3, s_glStencilOpTraceEnums };
+static const CallTrace::GetEnumNameFunc	s_glStencilOpSeparateTraceEnums[]							= { DE_NULL, getFaceName, getStencilOpName, getStencilOpName, getStencilOpName };
+static const CallTrace::FuncInfo		s_glStencilOpSeparateTraceInfo								= { "glStencilOpSeparate", "vxxxx", 4, s_glStencilOpSeparateTraceEnums };
+static const CallTrace::GetEnumNameFunc	s_glTexBufferTraceEnums[]									= { DE_NULL, getBufferTargetName, getUncompressedTextureFormatName, DE_NULL };
+static const CallTrace::FuncInfo		s_glTexBufferTraceInfo										= { "glTexBuffer", "vxxu", 3, s_glTexBufferTraceEnums };
+static const CallTrace::GetEnumNameFunc	s_glTexBufferRangeTraceEnums[]								= { DE_NULL, getBufferTargetName, getUncompressedTextureFormatName, DE_NULL, DE_NULL, DE_NULL };
+static const CallTrace::FuncInfo		s_glTexBufferRangeTraceInfo									= { "glTexBufferRange", "vxxuii", 5, s_glTexBufferRangeTraceEnums };
+static const CallTrace::GetEnumNameFunc	s_glTexImage1DTraceEnums[]									= { DE_NULL, getTextureTargetName, DE_NULL, getUncompressedTextureFormatName, DE_NULL, DE_NULL, getUncompressedTextureFormatName, getTypeName, DE_NULL };
+static const CallTrace::FuncInfo		s_glTexImage1DTraceInfo										= { "glTexImage1D", "vxiiiixxp", 8, s_glTexImage1DTraceEnums };
+static const CallTrace::GetEnumNameFunc	s_glTexImage2DTraceEnums[]									= { DE_NULL, getTextureTargetName, DE_NULL, getUncompressedTextureFormatName, DE_NULL, DE_NULL, DE_NULL, getUncompressedTextureFormatName, getTypeName, DE_NULL };
+static const CallTrace::FuncInfo		s_glTexImage2DTraceInfo										= { "glTexImage2D", "vxiiiiixxp", 9, s_glTexImage2DTraceEnums };
+static const CallTrace::GetEnumNameFunc	s_glTexImage2DMultisampleTraceEnums[]						= { DE_NULL, getTextureTargetName, DE_NULL, getUncompressedTextureFormatName, DE_NULL, DE_NULL, getBooleanName };
+static const CallTrace::FuncInfo		s_glTexImage2DMultisampleTraceInfo							= { "glTexImage2DMultisample", "vxixiib", 6, s_glTexImage2DMultisampleTraceEnums };
+static const CallTrace::GetEnumNameFunc	s_glTexImage3DTraceEnums[]									= { DE_NULL, getTextureTargetName, DE_NULL, getUncompressedTextureFormatName, DE_NULL, DE_NULL, DE_NULL, DE_NULL, getUncompressedTextureFormatName, getTypeName, DE_NULL };
+static const CallTrace::FuncInfo		s_glTexImage3DTraceInfo										= { "glTexImage3D", "vxiiiiiixxp", 10, s_glTexImage3DTraceEnums };
+static const CallTrace::FuncInfo		s_glTexImage3DMultisampleTraceInfo							= { "glTexImage3DMultisample", "vxixiiib", 7, DE_NULL };
+static const CallTrace::FuncInfo		s_glTexImage3DOESTraceInfo									= { "glTexImage3DOES", "vxixiiiixxp", 10, DE_NULL };
+static const CallTrace::FuncInfo		s_glTexPageCommitmentARBTraceInfo							= { "glTexPageCommitmentARB", "vxiiiiiiib", 9, DE_NULL };
+static const CallTrace::GetEnumNameFunc	s_glTexParameterIivTraceEnums[]								= { DE_NULL, getTextureTargetName, getTextureParameterName, DE_NULL };
+static const CallTrace::FuncInfo		s_glTexParameterIivTraceInfo								= { "glTexParameterIiv", "vxxp", 3, s_glTexParameterIivTraceEnums };
+static const CallTrace::GetEnumNameFunc	s_glTexParameterIuivTraceEnums[]							= { DE_NULL, getTextureTargetName, getTextureParameterName, DE_NULL };
+static const CallTrace::FuncInfo		s_glTexParameterIuivTraceInfo								= { "glTexParameterIuiv", "vxxp", 3, s_glTexParameterIuivTraceEnums };
+static const CallTrace::GetEnumNameFunc	s_glTexParameterfTraceEnums[]								= { DE_NULL, getTextureTargetName, getTextureParameterName, DE_NULL };
+static const CallTrace::FuncInfo		s_glTexParameterfTraceInfo									= { "glTexParameterf", "vxxf", 3, s_glTexParameterfTraceEnums };
+static const CallTrace::GetEnumNameFunc	s_glTexParameterfvTraceEnums[]								= { DE_NULL, getTextureTargetName, getTextureParameterName, DE_NULL };
+static const CallTrace::FuncInfo		s_glTexParameterfvTraceInfo									= { "glTexParameterfv", "vxxp", 3, s_glTexParameterfvTraceEnums };
+static const CallTrace::GetEnumNameFunc	s_glTexParameteriTraceEnums[]								= { DE_NULL, getTextureTargetName, getTextureParameterName, DE_NULL };
+static const CallTrace::FuncInfo		s_glTexParameteriTraceInfo									= { "glTexParameteri", "vxxi", 3, s_glTexParameteriTraceEnums };
+static const CallTrace::GetEnumNameFunc	s_glTexParameterivTraceEnums[]								= { DE_NULL, getTextureTargetName, getTextureParameterName, DE_NULL };
+static const CallTrace::FuncInfo		s_glTexParameterivTraceInfo									= { "glTexParameteriv", "vxxp", 3, s_glTexParameterivTraceEnums };
+static const CallTrace::FuncInfo		s_glTexStorage1DTraceInfo									= { "glTexStorage1D", "vxixi", 4, DE_NULL };
+static const CallTrace::GetEnumNameFunc	s_glTexStorage2DTraceEnums[]								= { DE_NULL, getTextureTargetName, DE_NULL, getTextureFormatName, DE_NULL, DE_NULL };
+static const CallTrace::FuncInfo		s_glTexStorage2DTraceInfo									= { "glTexStorage2D", "vxixii", 5, s_glTexStorage2DTraceEnums };
+static const CallTrace::GetEnumNameFunc	s_glTexStorage2DMultisampleTraceEnums[]						= { DE_NULL, getTextureTargetName, DE_NULL, getUncompressedTextureFormatName, DE_NULL, DE_NULL, getBooleanName };
+static const CallTrace::FuncInfo		s_glTexStorage2DMultisampleTraceInfo						= { "glTexStorage2DMultisample", "vxixiib", 6, s_glTexStorage2DMultisampleTraceEnums };
+static const CallTrace::GetEnumNameFunc	s_glTexStorage3DTraceEnums[]								= { DE_NULL, getTextureTargetName, DE_NULL, getTextureFormatName, DE_NULL, DE_NULL, DE_NULL };
+static const CallTrace::FuncInfo		s_glTexStorage3DTraceInfo									= { "glTexStorage3D", "vxixiii", 6, s_glTexStorage3DTraceEnums };
+static const CallTrace::GetEnumNameFunc	s_glTexStorage3DMultisampleTraceEnums[]						= { DE_NULL, getTextureTargetName, DE_NULL, getUncompressedTextureFormatName, DE_NULL, DE_NULL, DE_NULL, getBooleanName };
+static const CallTrace::FuncInfo		s_glTexStorage3DMultisampleTraceInfo						= { "glTexStorage3DMultisample", "vxixiiib", 7, s_glTexStorage3DMultisampleTraceEnums };
+static const CallTrace::GetEnumNameFunc	s_glTexSubImage1DTraceEnums[]								= { DE_NULL, getTextureTargetName, DE_NULL, DE_NULL, DE_NULL, getUncompressedTextureFormatName, getTypeName, DE_NULL };
+static const CallTrace::FuncInfo		s_glTexSubImage1DTraceInfo									= { "glTexSubImage1D", "vxiiixxp", 7, s_glTexSubImage1DTraceEnums };
+static const CallTrace::GetEnumNameFunc	s_glTexSubImage2DTraceEnums[]								= { DE_NULL, getTextureTargetName, DE_NULL, DE_NULL, DE_NULL, DE_NULL, DE_NULL, getUncompressedTextureFormatName, getTypeName, DE_NULL };
+static const CallTrace::FuncInfo		s_glTexSubImage2DTraceInfo									= { "glTexSubImage2D", "vxiiiiixxp", 9, s_glTexSubImage2DTraceEnums };
+static const CallTrace::GetEnumNameFunc	s_glTexSubImage3DTraceEnums[]								= { DE_NULL, getTextureTargetName, DE_NULL, DE_NULL, DE_NULL, DE_NULL, DE_NULL, DE_NULL, DE_NULL, getUncompressedTextureFormatName, getTypeName, DE_NULL };
+static const CallTrace::FuncInfo		s_glTexSubImage3DTraceInfo									= { "glTexSubImage3D", "vxiiiiiiixxp", 11, s_glTexSubImage3DTraceEnums };
+static const CallTrace::FuncInfo		s_glTexSubImage3DOESTraceInfo								= { "glTexSubImage3DOES", "vxiiiiiiixxp", 11, DE_NULL };
+static const CallTrace::FuncInfo		s_glTextureBarrierTraceInfo									= { "glTextureBarrier", "v", 0, DE_NULL };
+static const CallTrace::FuncInfo		s_glTextureBufferTraceInfo									= { "glTextureBuffer", "vuxu", 3, DE_NULL };
+static const CallTrace::FuncInfo		s_glTextureBufferEXTTraceInfo								= { "glTextureBufferEXT", "vuxxu", 4, DE_NULL };
+static const CallTrace::FuncInfo		s_glTextureBufferRangeTraceInfo								= { "glTextureBufferRange", "vuxuii", 5, DE_NULL };
+static const CallTrace::FuncInfo		s_glTextureBufferRangeEXTTraceInfo							= { "glTextureBufferRangeEXT", "vuxxuii", 6, DE_NULL };
+static const CallTrace::FuncInfo		s_glTextureImage1DEXTTraceInfo								= { "glTextureImage1DEXT", "vuxiiiixxp", 9, DE_NULL };
+static const CallTrace::FuncInfo		s_glTextureImage2DEXTTraceInfo								= { "glTextureImage2DEXT", "vuxiiiiixxp", 10, DE_NULL };
+static const CallTrace::FuncInfo		s_glTextureImage3DEXTTraceInfo								= { "glTextureImage3DEXT", "vuxiiiiiixxp", 11, DE_NULL };
+static const CallTrace::FuncInfo		s_glTexturePageCommitmentEXTTraceInfo						= { "glTexturePageCommitmentEXT", "vuiiiiiiib", 9, DE_NULL };
+static const CallTrace::FuncInfo		s_glTextureParameterIivTraceInfo							= { "glTextureParameterIiv", "vuxp", 3, DE_NULL };
+static const CallTrace::FuncInfo		s_glTextureParameterIivEXTTraceInfo							= { "glTextureParameterIivEXT", "vuxxp", 4, DE_NULL };
+static const CallTrace::FuncInfo		s_glTextureParameterIuivTraceInfo							= { "glTextureParameterIuiv", "vuxp", 3, DE_NULL };
+static const CallTrace::FuncInfo		s_glTextureParameterIuivEXTTraceInfo						= { "glTextureParameterIuivEXT", "vuxxp", 4, DE_NULL };
+static const CallTrace::FuncInfo		s_glTextureParameterfTraceInfo								= { "glTextureParameterf", "vuxf", 3, DE_NULL };
+static const CallTrace::FuncInfo		s_glTextureParameterfEXTTraceInfo							= { "glTextureParameterfEXT", "vuxxf", 4, DE_NULL };
+static const CallTrace::FuncInfo		s_glTextureParameterfvTraceInfo								= { "glTextureParameterfv", "vuxp", 3, DE_NULL };
+static const CallTrace::FuncInfo		s_glTextureParameterfvEXTTraceInfo							= { "glTextureParameterfvEXT", "vuxxp", 4, DE_NULL };
+static const CallTrace::FuncInfo		s_glTextureParameteriTraceInfo								= { "glTextureParameteri", "vuxi", 3, DE_NULL };
+static const CallTrace::FuncInfo		s_glTextureParameteriEXTTraceInfo							= { "glTextureParameteriEXT", "vuxxi", 4, DE_NULL };
+static const CallTrace::FuncInfo		s_glTextureParameterivTraceInfo								= { "glTextureParameteriv", "vuxp", 3, DE_NULL };
+static const CallTrace::FuncInfo		s_glTextureParameterivEXTTraceInfo							= { "glTextureParameterivEXT", "vuxxp", 4, DE_NULL };
+static const CallTrace::FuncInfo		s_glTextureRenderbufferEXTTraceInfo							= { "glTextureRenderbufferEXT", "vuxu", 3, DE_NULL };
+static const CallTrace::FuncInfo		s_glTextureStorage1DTraceInfo								= { "glTextureStorage1D", "vuixi", 4, DE_NULL };
+static const CallTrace::FuncInfo		s_glTextureStorage1DEXTTraceInfo							= { "glTextureStorage1DEXT", "vuxixi", 5, DE_NULL };
+static const CallTrace::FuncInfo		s_glTextureStorage2DTraceInfo								= { "glTextureStorage2D", "vuixii", 5, DE_NULL };
+static const CallTrace::FuncInfo		s_glTextureStorage2DEXTTraceInfo							= { "glTextureStorage2DEXT", "vuxixii", 6, DE_NULL };
+static const CallTrace::FuncInfo		s_glTextureStorage2DMultisampleTraceInfo					= { "glTextureStorage2DMultisample", "vuixiib", 6, DE_NULL };
+static const CallTrace::FuncInfo		s_glTextureStorage2DMultisampleEXTTraceInfo					= { "glTextureStorage2DMultisampleEXT", "vuxixiib", 7, DE_NULL };
+static const CallTrace::FuncInfo		s_glTextureStorage3DTraceInfo								= { "glTextureStorage3D", "vuixiii", 6, DE_NULL };
+static const CallTrace::FuncInfo		s_glTextureStorage3DEXTTraceInfo							= { "glTextureStorage3DEXT", "vuxixiii", 7, DE_NULL };
+static const CallTrace::FuncInfo		s_glTextureStorage3DMultisampleTraceInfo					= { "glTextureStorage3DMultisample", "vuixiiib", 7, DE_NULL };
+static const CallTrace::FuncInfo		s_glTextureStorage3DMultisampleEXTTraceInfo					= { "glTextureStorage3DMultisampleEXT", "vuxixiiib", 8, DE_NULL };
+static const CallTrace::FuncInfo		s_glTextureSubImage1DTraceInfo								= { "glTextureSubImage1D", "vuiiixxp", 7, DE_NULL };
+static const CallTrace::FuncInfo		s_glTextureSubImage1DEXTTraceInfo							= { "glTextureSubImage1DEXT", "vuxiiixxp", 8, DE_NULL };
+static const CallTrace::FuncInfo		s_glTextureSubImage2DTraceInfo								= { "glTextureSubImage2D", "vuiiiiixxp", 9, DE_NULL };
+static const CallTrace::FuncInfo		s_glTextureSubImage2DEXTTraceInfo							= { "glTextureSubImage2DEXT", "vuxiiiiixxp", 10, DE_NULL };
+static const CallTrace::FuncInfo		s_glTextureSubImage3DTraceInfo								= { "glTextureSubImage3D", "vuiiiiiiixxp", 11, DE_NULL };
+static const CallTrace::FuncInfo		s_glTextureSubImage3DEXTTraceInfo							= { "glTextureSubImage3DEXT", "vuxiiiiiiixxp", 12, DE_NULL };
+static const CallTrace::FuncInfo		s_glTextureViewTraceInfo									= { "glTextureView", "vuxuxuuuu", 8, DE_NULL };
+static const CallTrace::FuncInfo		s_glTransformFeedbackBufferBaseTraceInfo					= { "glTransformFeedbackBufferBase", "vuuu", 3, DE_NULL };
+static const CallTrace::FuncInfo		s_glTransformFeedbackBufferRangeTraceInfo					= { "glTransformFeedbackBufferRange", "vuuuii", 5, DE_NULL };
+static const CallTrace::FuncInfo		s_glTransformFeedbackVaryingsTraceInfo						= { "glTransformFeedbackVaryings", "vuipx", 4, DE_NULL };
+static const CallTrace::FuncInfo		s_glUniform1dTraceInfo										= { "glUniform1d", "vid", 2, DE_NULL };
+static const CallTrace::FuncInfo		s_glUniform1dvTraceInfo										= { "glUniform1dv", "viip", 3, DE_NULL };
+static const CallTrace::FuncInfo		s_glUniform1fTraceInfo										= { "glUniform1f", "vif", 2, DE_NULL };
+static const CallTrace::FuncInfo		s_glUniform1fvTraceInfo										= { "glUniform1fv", "viip", 3, DE_NULL };
+static const CallTrace::FuncInfo		s_glUniform1iTraceInfo										= { "glUniform1i", "vii", 2, DE_NULL };
+static const CallTrace::FuncInfo		s_glUniform1ivTraceInfo										= { "glUniform1iv", "viip", 3, DE_NULL };
+static const CallTrace::FuncInfo		s_glUniform1uiTraceInfo										= { "glUniform1ui", "viu", 2, DE_NULL };
+static const CallTrace::FuncInfo		s_glUniform1uivTraceInfo									= { "glUniform1uiv", "viip", 3, DE_NULL };
+static const CallTrace::FuncInfo		s_glUniform2dTraceInfo										= { "glUniform2d", "vidd", 3, DE_NULL };
+static const CallTrace::FuncInfo		s_glUniform2dvTraceInfo										= { "glUniform2dv", "viip", 3, DE_NULL };
+static const CallTrace::FuncInfo		s_glUniform2fTraceInfo										= { "glUniform2f", "viff", 3, DE_NULL };
+static const CallTrace::FuncInfo		s_glUniform2fvTraceInfo										= { "glUniform2fv", "viip", 3, DE_NULL };
+static const CallTrace::FuncInfo		s_glUniform2iTraceInfo										= { "glUniform2i", "viii", 3, DE_NULL };
+static const CallTrace::FuncInfo		s_glUniform2ivTraceInfo										= { "glUniform2iv", "viip", 3, DE_NULL };
+static const CallTrace::FuncInfo		s_glUniform2uiTraceInfo										= { "glUniform2ui", "viuu", 3, DE_NULL };
+static const CallTrace::FuncInfo		s_glUniform2uivTraceInfo									= { "glUniform2uiv", "viip", 3, DE_NULL };
+static const CallTrace::FuncInfo		s_glUniform3dTraceInfo										= { "glUniform3d", "viddd", 4, DE_NULL };
+static const CallTrace::FuncInfo		s_glUniform3dvTraceInfo										= { "glUniform3dv", "viip", 3, DE_NULL };
+static const CallTrace::FuncInfo		s_glUniform3fTraceInfo										= { "glUniform3f", "vifff", 4, DE_NULL };
+static const CallTrace::FuncInfo		s_glUniform3fvTraceInfo										= { "glUniform3fv", "viip", 3, DE_NULL };
+static const CallTrace::FuncInfo		s_glUniform3iTraceInfo										= { "glUniform3i", "viiii", 4, DE_NULL };
+static const CallTrace::FuncInfo		s_glUniform3ivTraceInfo										= { "glUniform3iv", "viip", 3, DE_NULL };
+static const CallTrace::FuncInfo		s_glUniform3uiTraceInfo										= { "glUniform3ui", "viuuu", 4, DE_NULL };
+static const CallTrace::FuncInfo		s_glUniform3uivTraceInfo									= { "glUniform3uiv", "viip", 3, DE_NULL };
+static const CallTrace::FuncInfo		s_glUniform4dTraceInfo										= { "glUniform4d", "vidddd", 5, DE_NULL };
+static const CallTrace::FuncInfo		s_glUniform4dvTraceInfo										= { "glUniform4dv", "viip", 3, DE_NULL };
+static const CallTrace::FuncInfo		s_glUniform4fTraceInfo										= { "glUniform4f", "viffff", 5, DE_NULL };
+static const CallTrace::FuncInfo		s_glUniform4fvTraceInfo										= { "glUniform4fv", "viip", 3, DE_NULL };
+static const CallTrace::FuncInfo		s_glUniform4iTraceInfo										= { "glUniform4i", "viiiii", 5, DE_NULL };
+static const CallTrace::FuncInfo		s_glUniform4ivTraceInfo										= { "glUniform4iv", "viip", 3, DE_NULL };
+static const CallTrace::FuncInfo		s_glUniform4uiTraceInfo										= { "glUniform4ui", "viuuuu", 5, DE_NULL };
+static const CallTrace::FuncInfo		s_glUniform4uivTraceInfo									= { "glUniform4uiv", "viip", 3, DE_NULL };
+static const CallTrace::FuncInfo		s_glUniformBlockBindingTraceInfo							= { "glUniformBlockBinding", "vuuu", 3, DE_NULL };
+static const CallTrace::FuncInfo		s_glUniformMatrix2dvTraceInfo								= { "glUniformMatrix2dv", "viibp", 4, DE_NULL };
+static const CallTrace::FuncInfo		s_glUniformMatrix2fvTraceInfo								= { "glUniformMatrix2fv", "viibp", 4, DE_NULL };
+static const CallTrace::FuncInfo		s_glUniformMatrix2x3dvTraceInfo								= { "glUniformMatrix2x3dv", "viibp", 4, DE_NULL };
+static const CallTrace::FuncInfo		s_glUniformMatrix2x3fvTraceInfo								= { "glUniformMatrix2x3fv", "viibp", 4, DE_NULL };
+static const CallTrace::FuncInfo		s_glUniformMatrix2x4dvTraceInfo								= { "glUniformMatrix2x4dv", "viibp", 4, DE_NULL };
+static const CallTrace::FuncInfo		s_glUniformMatrix2x4fvTraceInfo								= { "glUniformMatrix2x4fv", "viibp", 4, DE_NULL };
+static const CallTrace::FuncInfo		s_glUniformMatrix3dvTraceInfo								= { "glUniformMatrix3dv", "viibp", 4, DE_NULL };
+static const CallTrace::FuncInfo		s_glUniformMatrix3fvTraceInfo								= { "glUniformMatrix3fv", "viibp", 4, DE_NULL };
+static const CallTrace::FuncInfo		s_glUniformMatrix3x2dvTraceInfo								= { "glUniformMatrix3x2dv", "viibp", 4, DE_NULL };
+static const CallTrace::FuncInfo		s_glUniformMatrix3x2fvTraceInfo								= { "glUniformMatrix3x2fv", "viibp", 4, DE_NULL };
+static const CallTrace::FuncInfo		s_glUniformMatrix3x4dvTraceInfo								= { "glUniformMatrix3x4dv", "viibp", 4, DE_NULL };
+static const CallTrace::FuncInfo		s_glUniformMatrix3x4fvTraceInfo								= { "glUniformMatrix3x4fv", "viibp", 4, DE_NULL };
+static const CallTrace::FuncInfo		s_glUniformMatrix4dvTraceInfo								= { "glUniformMatrix4dv", "viibp", 4, DE_NULL };
+static const CallTrace::FuncInfo		s_glUniformMatrix4fvTraceInfo								= { "glUniformMatrix4fv", "viibp", 4, DE_NULL };
+static const CallTrace::FuncInfo		s_glUniformMatrix4x2dvTraceInfo								= { "glUniformMatrix4x2dv", "viibp", 4, DE_NULL };
+static const CallTrace::FuncInfo		s_glUniformMatrix4x2fvTraceInfo								= { "glUniformMatrix4x2fv", "viibp", 4, DE_NULL };
+static const CallTrace::FuncInfo		s_glUniformMatrix4x3dvTraceInfo								= { "glUniformMatrix4x3dv", "viibp", 4, DE_NULL };
+static const CallTrace::FuncInfo		s_glUniformMatrix4x3fvTraceInfo								= { "glUniformMatrix4x3fv", "viibp", 4, DE_NULL };
+static const CallTrace::FuncInfo		s_glUniformSubroutinesuivTraceInfo							= { "glUniformSubroutinesuiv", "vxip", 3, DE_NULL };
+static const CallTrace::GetEnumNameFunc	s_glUnmapBufferTraceEnums[]									= { DE_NULL, getBufferTargetName };
+static const CallTrace::FuncInfo		s_glUnmapBufferTraceInfo									= { "glUnmapBuffer", "bx", 1, s_glUnmapBufferTraceEnums };
+static const CallTrace::FuncInfo		s_glUnmapNamedBufferTraceInfo								= { "glUnmapNamedBuffer", "bu", 1, DE_NULL };
+static const CallTrace::FuncInfo		s_glUnmapNamedBufferEXTTraceInfo							= { "glUnmapNamedBufferEXT", "bu", 1, DE_NULL };
+static const CallTrace::FuncInfo		s_glUseProgramTraceInfo										= { "glUseProgram", "vu", 1, DE_NULL };
+static const CallTrace::FuncInfo		s_glUseProgramStagesTraceInfo								= { "glUseProgramStages", "vuxu", 3, DE_NULL };
+static const CallTrace::FuncInfo		s_glValidateProgramTraceInfo								= { "glValidateProgram", "vu", 1, DE_NULL };
+static const CallTrace::FuncInfo		s_glValidateProgramPipelineTraceInfo						= { "glValidateProgramPipeline", "vu", 1, DE_NULL };
+static const CallTrace::FuncInfo		s_glVertexArrayAttribBindingTraceInfo						= { "glVertexArrayAttribBinding", "vuuu", 3, DE_NULL };
+static const CallTrace::FuncInfo		s_glVertexArrayAttribFormatTraceInfo						= { "glVertexArrayAttribFormat", "vuuixbu", 6, DE_NULL };
+static const CallTrace::FuncInfo		s_glVertexArrayAttribIFormatTraceInfo						= { "glVertexArrayAttribIFormat", "vuuixu", 5, DE_NULL };
+static const CallTrace::FuncInfo		s_glVertexArrayAttribLFormatTraceInfo						= { "glVertexArrayAttribLFormat", "vuuixu", 5, DE_NULL };
+static const CallTrace::FuncInfo		s_glVertexArrayBindVertexBufferEXTTraceInfo					= { "glVertexArrayBindVertexBufferEXT", "vuuuii", 5, DE_NULL };
+static const CallTrace::FuncInfo		s_glVertexArrayBindingDivisorTraceInfo						= { "glVertexArrayBindingDivisor", "vuuu", 3, DE_NULL };
+static const CallTrace::FuncInfo		s_glVertexArrayColorOffsetEXTTraceInfo						= { "glVertexArrayColorOffsetEXT", "vuuixii", 6, DE_NULL };
+static const CallTrace::FuncInfo		s_glVertexArrayEdgeFlagOffsetEXTTraceInfo					= { "glVertexArrayEdgeFlagOffsetEXT", "vuuii", 4, DE_NULL };
+static const CallTrace::FuncInfo		s_glVertexArrayElementBufferTraceInfo						= { "glVertexArrayElementBuffer", "vuu", 2, DE_NULL };
+static const CallTrace::FuncInfo		s_glVertexArrayFogCoordOffsetEXTTraceInfo					= { "glVertexArrayFogCoordOffsetEXT", "vuuxii", 5, DE_NULL };
+static const CallTrace::FuncInfo		s_glVertexArrayIndexOffsetEXTTraceInfo						= { "glVertexArrayIndexOffsetEXT", "vuuxii", 5, DE_NULL };
+static const CallTrace::FuncInfo		s_glVertexArrayMultiTexCoordOffsetEXTTraceInfo				= { "glVertexArrayMultiTexCoordOffsetEXT", "vuuxixii", 7, DE_NULL };
+static const CallTrace::FuncInfo		s_glVertexArrayNormalOffsetEXTTraceInfo						= { "glVertexArrayNormalOffsetEXT", "vuuxii", 5, DE_NULL };
+static const CallTrace::FuncInfo		s_glVertexArraySecondaryColorOffsetEXTTraceInfo				= { "glVertexArraySecondaryColorOffsetEXT", "vuuixii", 6, DE_NULL };
+static const CallTrace::FuncInfo		s_glVertexArrayTexCoordOffsetEXTTraceInfo					= { "glVertexArrayTexCoordOffsetEXT", "vuuixii", 6, DE_NULL };
+static const CallTrace::FuncInfo		s_glVertexArrayVertexAttribBindingEXTTraceInfo				= { "glVertexArrayVertexAttribBindingEXT", "vuuu", 3, DE_NULL };
+static const CallTrace::FuncInfo		s_glVertexArrayVertexAttribDivisorEXTTraceInfo				= { "glVertexArrayVertexAttribDivisorEXT", "vuuu", 3, DE_NULL };
+static const CallTrace::FuncInfo		s_glVertexArrayVertexAttribFormatEXTTraceInfo				= { "glVertexArrayVertexAttribFormatEXT", "vuuixbu", 6, DE_NULL };
+static const CallTrace::FuncInfo		s_glVertexArrayVertexAttribIFormatEXTTraceInfo				= { "glVertexArrayVertexAttribIFormatEXT", "vuuixu", 5, DE_NULL };
+static const CallTrace::FuncInfo		s_glVertexArrayVertexAttribIOffsetEXTTraceInfo				= { "glVertexArrayVertexAttribIOffsetEXT", "vuuuixii", 7, DE_NULL };
+static const CallTrace::FuncInfo		s_glVertexArrayVertexAttribLFormatEXTTraceInfo				= { "glVertexArrayVertexAttribLFormatEXT", "vuuixu", 5, DE_NULL };
+static const CallTrace::FuncInfo		s_glVertexArrayVertexAttribLOffsetEXTTraceInfo				= { "glVertexArrayVertexAttribLOffsetEXT", "vuuuixii", 7, DE_NULL };
+static const CallTrace::FuncInfo		s_glVertexArrayVertexAttribOffsetEXTTraceInfo				= { "glVertexArrayVertexAttribOffsetEXT", "vuuuixbii", 8, DE_NULL };
+static const CallTrace::FuncInfo		s_glVertexArrayVertexBindingDivisorEXTTraceInfo				= { "glVertexArrayVertexBindingDivisorEXT", "vuuu", 3, DE_NULL };
+static const CallTrace::FuncInfo		s_glVertexArrayVertexBufferTraceInfo						= { "glVertexArrayVertexBuffer", "vuuuii", 5, DE_NULL };
+static const CallTrace::FuncInfo		s_glVertexArrayVertexBuffersTraceInfo						= { "glVertexArrayVertexBuffers", "vuuippp", 6, DE_NULL };
+static const CallTrace::FuncInfo		s_glVertexArrayVertexOffsetEXTTraceInfo						= { "glVertexArrayVertexOffsetEXT", "vuuixii", 6, DE_NULL };
+static const CallTrace::FuncInfo		s_glVertexAttrib1dTraceInfo									= { "glVertexAttrib1d", "vud", 2, DE_NULL };
+static const CallTrace::FuncInfo		s_glVertexAttrib1dvTraceInfo								= { "glVertexAttrib1dv", "vup", 2, DE_NULL };
+static const CallTrace::FuncInfo		s_glVertexAttrib1fTraceInfo									= { "glVertexAttrib1f", "vuf", 2, DE_NULL };
+static const CallTrace::FuncInfo		s_glVertexAttrib1fvTraceInfo								= { "glVertexAttrib1fv", "vup", 2, DE_NULL };
+static const CallTrace::FuncInfo		s_glVertexAttrib1sTraceInfo									= { "glVertexAttrib1s", "vui", 2, DE_NULL };
+static const CallTrace::FuncInfo		s_glVertexAttrib1svTraceInfo								= { "glVertexAttrib1sv", "vup", 2, DE_NULL };
+static const CallTrace::FuncInfo		s_glVertexAttrib2dTraceInfo									= { "glVertexAttrib2d", "vudd", 3, DE_NULL };
+static const CallTrace::FuncInfo		s_glVertexAttrib2dvTraceInfo								= { "glVertexAttrib2dv", "vup", 2, DE_NULL };
+static const CallTrace::FuncInfo		s_glVertexAttrib2fTraceInfo									= { "glVertexAttrib2f", "vuff", 3, DE_NULL };
+static const CallTrace::FuncInfo		s_glVertexAttrib2fvTraceInfo								= { "glVertexAttrib2fv", "vup", 2, DE_NULL };
+static const CallTrace::FuncInfo		s_glVertexAttrib2sTraceInfo									= { "glVertexAttrib2s", "vuii", 3, DE_NULL };
+static const CallTrace::FuncInfo		s_glVertexAttrib2svTraceInfo								= { "glVertexAttrib2sv", "vup", 2, DE_NULL };
+static const CallTrace::FuncInfo		s_glVertexAttrib3dTraceInfo									= { "glVertexAttrib3d", "vuddd", 4, DE_NULL };
+static const CallTrace::FuncInfo		s_glVertexAttrib3dvTraceInfo								= { "glVertexAttrib3dv", "vup", 2, DE_NULL };
+static const CallTrace::FuncInfo		s_glVertexAttrib3fTraceInfo									= { "glVertexAttrib3f", "vufff", 4, DE_NULL };
+static const CallTrace::FuncInfo		s_glVertexAttrib3fvTraceInfo								= { "glVertexAttrib3fv", "vup", 2, DE_NULL };
+static const CallTrace::FuncInfo		s_glVertexAttrib3sTraceInfo									= { "glVertexAttrib3s", "vuiii", 4, DE_NULL };
+static const CallTrace::FuncInfo		s_glVertexAttrib3svTraceInfo								= { "glVertexAttrib3sv", "vup", 2, DE_NULL };
+static const CallTrace::FuncInfo		s_glVertexAttrib4NbvTraceInfo								= { "glVertexAttrib4Nbv", "vup", 2, DE_NULL };
+static const CallTrace::FuncInfo		s_glVertexAttrib4NivTraceInfo								= { "glVertexAttrib4Niv", "vup", 2, DE_NULL };
+static const CallTrace::FuncInfo		s_glVertexAttrib4NsvTraceInfo								= { "glVertexAttrib4Nsv", "vup", 2, DE_NULL };
+static const CallTrace::FuncInfo		s_glVertexAttrib4NubTraceInfo								= { "glVertexAttrib4Nub", "vuxxxx", 5, DE_NULL };
+static const CallTrace::FuncInfo		s_glVertexAttrib4NubvTraceInfo								= { "glVertexAttrib4Nubv", "vup", 2, DE_NULL };
+static const CallTrace::FuncInfo		s_glVertexAttrib4NuivTraceInfo								= { "glVertexAttrib4Nuiv", "vup", 2, DE_NULL };
+static const CallTrace::FuncInfo		s_glVertexAttrib4NusvTraceInfo								= { "glVertexAttrib4Nusv", "vup", 2, DE_NULL };
+static const CallTrace::FuncInfo		s_glVertexAttrib4bvTraceInfo								= { "glVertexAttrib4bv", "vup", 2, DE_NULL };
+static const CallTrace::FuncInfo		s_glVertexAttrib4dTraceInfo									= { "glVertexAttrib4d", "vudddd", 5, DE_NULL };
+static const CallTrace::FuncInfo		s_glVertexAttrib4dvTraceInfo								= { "glVertexAttrib4dv", "vup", 2, DE_NULL };
+static const CallTrace::FuncInfo		s_glVertexAttrib4fTraceInfo									= { "glVertexAttrib4f", "vuffff", 5, DE_NULL };
+static const CallTrace::FuncInfo		s_glVertexAttrib4fvTraceInfo								= { "glVertexAttrib4fv", "vup", 2, DE_NULL };
+static const CallTrace::FuncInfo		s_glVertexAttrib4ivTraceInfo								= { "glVertexAttrib4iv", "vup", 2, DE_NULL };
+static const CallTrace::FuncInfo		s_glVertexAttrib4sTraceInfo									= { "glVertexAttrib4s", "vuiiii", 5, DE_NULL };
+static const CallTrace::FuncInfo		s_glVertexAttrib4svTraceInfo								= { "glVertexAttrib4sv", "vup", 2, DE_NULL };
+static const CallTrace::FuncInfo		s_glVertexAttrib4ubvTraceInfo								= { "glVertexAttrib4ubv", "vup", 2, DE_NULL };
+static const CallTrace::FuncInfo		s_glVertexAttrib4uivTraceInfo								= { "glVertexAttrib4uiv", "vup", 2, DE_NULL };
+static const CallTrace::FuncInfo		s_glVertexAttrib4usvTraceInfo								= { "glVertexAttrib4usv", "vup", 2, DE_NULL };
+static const CallTrace::FuncInfo		s_glVertexAttribBindingTraceInfo							= { "glVertexAttribBinding", "vuu", 2, DE_NULL };
+static const CallTrace::FuncInfo		s_glVertexAttribDivisorTraceInfo							= { "glVertexAttribDivisor", "vuu", 2, DE_NULL };
+static const CallTrace::GetEnumNameFunc	s_glVertexAttribFormatTraceEnums[]							= { DE_NULL, DE_NULL, DE_NULL, getTypeName, DE_NULL, DE_NULL };
+static const CallTrace::FuncInfo		s_glVertexAttribFormatTraceInfo								= { "glVertexAttribFormat", "vuixbu", 5, s_glVertexAttribFormatTraceEnums };
+static const CallTrace::FuncInfo		s_glVertexAttribI1iTraceInfo								= { "glVertexAttribI1i", "vui", 2, DE_NULL };
+static const CallTrace::FuncInfo		s_glVertexAttribI1ivTraceInfo								= { "glVertexAttribI1iv", "vup", 2, DE_NULL };
+static const CallTrace::FuncInfo		s_glVertexAttribI1uiTraceInfo								= { "glVertexAttribI1ui", "vuu", 2, DE_NULL };
+static const CallTrace::FuncInfo		s_glVertexAttribI1uivTraceInfo								= { "glVertexAttribI1uiv", "vup", 2, DE_NULL };
+static const CallTrace::FuncInfo		s_glVertexAttribI2iTraceInfo								= { "glVertexAttribI2i", "vuii", 3, DE_NULL };
+static const CallTrace::FuncInfo		s_glVertexAttribI2ivTraceInfo								= { "glVertexAttribI2iv", "vup", 2, DE_NULL };
+static const CallTrace::FuncInfo		s_glVertexAttribI2uiTraceInfo								= { "glVertexAttribI2ui", "vuuu", 3, DE_NULL };
+static const CallTrace::FuncInfo		s_glVertexAttribI2uivTraceInfo								= { "glVertexAttribI2uiv", "vup", 2, DE_NULL };
+static const CallTrace::FuncInfo		s_glVertexAttribI3iTraceInfo								= { "glVertexAttribI3i", "vuiii", 4, DE_NULL };
+static const CallTrace::FuncInfo		s_glVertexAttribI3ivTraceInfo								= { "glVertexAttribI3iv", "vup", 2, DE_NULL };
+static const CallTrace::FuncInfo		s_glVertexAttribI3uiTraceInfo								= { "glVertexAttribI3ui", "vuuuu", 4, DE_NULL };
+static const CallTrace::FuncInfo		s_glVertexAttribI3uivTraceInfo								= { "glVertexAttribI3uiv", "vup", 2, DE_NULL };
+static const CallTrace::FuncInfo		s_glVertexAttribI4bvTraceInfo								= { "glVertexAttribI4bv", "vup", 2, DE_NULL };
+static const CallTrace::FuncInfo		s_glVertexAttribI4iTraceInfo								= { "glVertexAttribI4i", "vuiiii", 5, DE_NULL };
+static const CallTrace::FuncInfo		s_glVertexAttribI4ivTraceInfo								= { "glVertexAttribI4iv", "vup", 2, DE_NULL };
+static const CallTrace::FuncInfo		s_glVertexAttribI4svTraceInfo								= { "glVertexAttribI4sv", "vup", 2, DE_NULL };
+static const CallTrace::FuncInfo		s_glVertexAttribI4ubvTraceInfo								= { "glVertexAttribI4ubv", "vup", 2, DE_NULL };
+static const CallTrace::FuncInfo		s_glVertexAttribI4uiTraceInfo								= { "glVertexAttribI4ui", "vuuuuu", 5, DE_NULL };
+static const CallTrace::FuncInfo		s_glVertexAttribI4uivTraceInfo								= { "glVertexAttribI4uiv", "vup", 2, DE_NULL };
+static const CallTrace::FuncInfo		s_glVertexAttribI4usvTraceInfo								= { "glVertexAttribI4usv", "vup", 2, DE_NULL };
+static const CallTrace::GetEnumNameFunc	s_glVertexAttribIFormatTraceEnums[]							= { DE_NULL, DE_NULL, DE_NULL, getTypeName, DE_NULL };
+static const CallTrace::FuncInfo		s_glVertexAttribIFormatTraceInfo							= { "glVertexAttribIFormat", "vuixu", 4, s_glVertexAttribIFormatTraceEnums };
+static const CallTrace::GetEnumNameFunc	s_glVertexAttribIPointerTraceEnums[]						= { DE_NULL, DE_NULL, DE_NULL, getTypeName, DE_NULL, DE_NULL };
+static const CallTrace::FuncInfo		s_glVertexAttribIPointerTraceInfo							= { "glVertexAttribIPointer", "vuixip", 5, s_glVertexAttribIPointerTraceEnums };
+static const CallTrace::FuncInfo		s_glVertexAttribL1dTraceInfo								= { "glVertexAttribL1d", "vud", 2, DE_NULL };
+static const CallTrace::FuncInfo		s_glVertexAttribL1dvTraceInfo								= { "glVertexAttribL1dv", "vup", 2, DE_NULL };
+static const CallTrace::FuncInfo		s_glVertexAttribL2dTraceInfo								= { "glVertexAttribL2d", "vudd", 3, DE_NULL };
+static const CallTrace::FuncInfo		s_glVertexAttribL2dvTraceInfo								= { "glVertexAttribL2dv", "vup", 2, DE_NULL };
+static const CallTrace::FuncInfo		s_glVertexAttribL3dTraceInfo								= { "glVertexAttribL3d", "vuddd", 4, DE_NULL };
+static const CallTrace::FuncInfo		s_glVertexAttribL3dvTraceInfo								= { "glVertexAttribL3dv", "vup", 2, DE_NULL };
+static const CallTrace::FuncInfo		s_glVertexAttribL4dTraceInfo								= { "glVertexAttribL4d", "vudddd", 5, DE_NULL };
+static const CallTrace::FuncInfo		s_glVertexAttribL4dvTraceInfo								= { "glVertexAttribL4dv", "vup", 2, DE_NULL };
+static const CallTrace::FuncInfo		s_glVertexAttribLFormatTraceInfo							= { "glVertexAttribLFormat", "vuixu", 4, DE_NULL };
+static const CallTrace::FuncInfo		s_glVertexAttribLPointerTraceInfo							= { "glVertexAttribLPointer", "vuixip", 5, DE_NULL };
+static const CallTrace::FuncInfo		s_glVertexAttribP1uiTraceInfo								= { "glVertexAttribP1ui", "vuxbu", 4, DE_NULL };
+static const CallTrace::FuncInfo		s_glVertexAttribP1uivTraceInfo								= { "glVertexAttribP1uiv", "vuxbp", 4, DE_NULL };
+static const CallTrace::FuncInfo		s_glVertexAttribP2uiTraceInfo								= { "glVertexAttribP2ui", "vuxbu", 4, DE_NULL };
+static const CallTrace::FuncInfo		s_glVertexAttribP2uivTraceInfo								= { "glVertexAttribP2uiv", "vuxbp", 4, DE_NULL };
+static const CallTrace::FuncInfo		s_glVertexAttribP3uiTraceInfo								= { "glVertexAttribP3ui", "vuxbu", 4, DE_NULL };
+static const CallTrace::FuncInfo		s_glVertexAttribP3uivTraceInfo								= { "glVertexAttribP3uiv", "vuxbp", 4, DE_NULL };
+static const CallTrace::FuncInfo		s_glVertexAttribP4uiTraceInfo								= { "glVertexAttribP4ui", "vuxbu", 4, DE_NULL };
+static const CallTrace::FuncInfo		s_glVertexAttribP4uivTraceInfo								= { "glVertexAttribP4uiv", "vuxbp", 4, DE_NULL };
+static const CallTrace::GetEnumNameFunc	s_glVertexAttribPointerTraceEnums[]							= { DE_NULL, DE_NULL, DE_NULL, getTypeName, DE_NULL, DE_NULL, DE_NULL };
+static const CallTrace::FuncInfo		s_glVertexAttribPointerTraceInfo							= { "glVertexAttribPointer", "vuixbip", 6, s_glVertexAttribPointerTraceEnums };
+static const CallTrace::FuncInfo		s_glVertexBindingDivisorTraceInfo							= { "glVertexBindingDivisor", "vuu", 2, DE_NULL };
+static const CallTrace::FuncInfo		s_glViewportTraceInfo										= { "glViewport", "viiii", 4, DE_NULL };
+static const CallTrace::FuncInfo		s_glViewportArrayvTraceInfo									= { "glViewportArrayv", "vuip", 3, DE_NULL };
+static const CallTrace::FuncInfo		s_glViewportIndexedfTraceInfo								= { "glViewportIndexedf", "vuffff", 5, DE_NULL };
+static const CallTrace::FuncInfo		s_glViewportIndexedfvTraceInfo								= { "glViewportIndexedfv", "vup", 2, DE_NULL };
+static const CallTrace::FuncInfo		s_glWaitSyncTraceInfo										= { "glWaitSync", "vpxu", 3, DE_NULL };
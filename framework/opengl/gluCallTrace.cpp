@@ -0,0 +1,330 @@
+/*-------------------------------------------------------------------------
+ * drawElements Quality Program OpenGL ES Utilities
+ * ------------------------------------------------
+ *
+ * Copyright 2019 The Android Open Source Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ *//*!
+ * \file
+ * \brief Binary GL call trace.
+ *//*--------------------------------------------------------------------*/
+
+#include "gluCallTrace.hpp"
+#include "gluStrUtil.hpp"
+#include "tcuTestLog.hpp"
+#include "tcuTestContext.hpp"
+#include "tcuTestCase.hpp"
+#include "tcuCommandLine.hpp"
+#include "tcuFormatUtil.hpp"
+#include "deThreadLocal.hpp"
+#include "deStringUtil.hpp"
+#include "glwEnums.hpp"
+
+#include <sstream>
+
+namespace glu
+{
+
+namespace
+{
+
+de::ThreadLocal s_threadTrace;
+
+float unpackFloat (deUint64 value)
+{
+	const deUint32	bits	= (deUint32)value;
+	float			result;
+
+	deMemcpy(&result, &bits, sizeof(result));
+	return result;
+}
+
+double unpackDouble (deUint64 value)
+{
+	double result;
+
+	deMemcpy(&result, &value, sizeof(result));
+	return result;
+}
+
+void formatValue (std::ostream& str, char type, CallTrace::GetEnumNameFunc getName, deUint64 value)
+{
+	if (getName)
+	{
+		str << tcu::Format::Enum<int, 2>(getName, (int)value);
+		return;
+	}
+
+	switch (type)
+	{
+		case CallTrace::VALUETYPE_INT:		str << (deInt64)value;					break;
+		case CallTrace::VALUETYPE_UINT:		str << value;							break;
+		case CallTrace::VALUETYPE_HEX:		str << tcu::toHex((deUint32)value);		break;
+		case CallTrace::VALUETYPE_BOOLEAN:	str << getBooleanStr((deUint8)value);	break;
+		case CallTrace::VALUETYPE_FLOAT:	str << unpackFloat(value);				break;
+		case CallTrace::VALUETYPE_DOUBLE:	str << unpackDouble(value);				break;
+		case CallTrace::VALUETYPE_POINTER:	str << tcu::toHex((deUintptr)value);	break;
+		default:
+			DE_ASSERT(false);
+	}
+}
+
+inline CallTrace::GetEnumNameFunc getEnumName (const CallTrace::FuncInfo& func, int valueNdx)
+{
+	return func.enumNames ? func.enumNames[valueNdx] : DE_NULL;
+}
+
+} // anonymous
+
+CallTrace::CallTrace (int capacity)
+	: m_records		(capacity)
+	, m_next		(0)
+	, m_last		(DE_NULL)
+	, m_numCalls	(0)
+{
+	DE_ASSERT(capacity > 0);
+}
+
+CallTrace::~CallTrace (void)
+{
+}
+
+int CallTrace::getNumRecords (void) const
+{
+	return (int)de::min<deUint64>(m_numCalls, (deUint64)m_records.size());
+}
+
+const CallTrace::Record& CallTrace::getRecord (int ndx) const
+{
+	const int numRecords = getNumRecords();
+
+	DE_ASSERT(de::inBounds(ndx, 0, numRecords));
+
+	// Oldest retained record is at m_next once the buffer has wrapped around
+	return m_records[(m_next - numRecords + ndx + (int)m_records.size()) % (int)m_records.size()];
+}
+
+void CallTrace::clear (void)
+{
+	m_next		= 0;
+	m_last		= DE_NULL;
+	m_numCalls	= 0;
+}
+
+void CallTrace::setThreadTrace (CallTrace* trace)
+{
+	s_threadTrace.set(trace);
+}
+
+CallTrace* CallTrace::getThreadTrace (void)
+{
+	return static_cast<CallTrace*>(s_threadTrace.get());
+}
+
+std::string CallTrace::formatCall (const Record& record)
+{
+	const FuncInfo&		func	= *record.func;
+	std::ostringstream	str;
+
+	str << func.name << "(";
+
+	for (int argNdx = 0; argNdx < func.numArgs; argNdx++)
+	{
+		if (argNdx > 0)
+			str << ", ";
+
+		formatValue(str, func.signature[argNdx + 1], getEnumName(func, argNdx + 1), record.args[argNdx]);
+	}
+
+	str << ");";
+
+	return str.str();
+}
+
+std::string CallTrace::formatReturnValue (const Record& record)
+{
+	const FuncInfo&		func	= *record.func;
+	std::ostringstream	str;
+
+	DE_ASSERT(func.signature[0] != VALUETYPE_VOID);
+
+	str << "// ";
+	formatValue(str, func.signature[0], getEnumName(func, 0), record.returnValue);
+	str << " returned";
+
+	return str.str();
+}
+
+void CallTrace::write (tcu::TestLog& log) const
+{
+	const int numRecords = getNumRecords();
+
+	if (m_numCalls > (deUint64)numRecords)
+		log << tcu::TestLog::Message << "// " << (m_numCalls - (deUint64)numRecords) << " earlier calls not retained" << tcu::TestLog::EndMessage;
+
+	for (int ndx = 0; ndx < numRecords; ndx++)
+	{
+		const Record& record = getRecord(ndx);
+
+		log << tcu::TestLog::Message << formatCall(record) << tcu::TestLog::EndMessage;
+
+		if (record.func->signature[0] != VALUETYPE_VOID)
+			log << tcu::TestLog::Message << formatReturnValue(record) << tcu::TestLog::EndMessage;
+	}
+}
+
+namespace
+{
+
+CallTrace* createCaseCallTrace (const tcu::CommandLine& cmdLine)
+{
+	const int size = cmdLine.getGLCallTraceSize();
+
+	return size > 0 ? new CallTrace(size) : DE_NULL;
+}
+
+//! Ends recording of a case into trace when going out of scope, also if case deinit throws
+class CaseTraceEnd
+{
+public:
+					CaseTraceEnd	(CallTrace& trace) : m_trace(trace) {}
+					~CaseTraceEnd	(void)
+					{
+						CallTrace::setThreadTrace(DE_NULL);
+						m_trace.clear();
+					}
+
+private:
+					CaseTraceEnd	(const CaseTraceEnd&);
+	CaseTraceEnd&	operator=		(const CaseTraceEnd&);
+
+	CallTrace&		m_trace;
+};
+
+} // anonymous
+
+TestCaseCallTrace::TestCaseCallTrace (tcu::TestContext& testCtx)
+	: m_testCtx	(testCtx)
+	, m_trace	(createCaseCallTrace(testCtx.getCommandLine()))
+{
+}
+
+TestCaseCallTrace::~TestCaseCallTrace (void)
+{
+	if (m_trace && CallTrace::getThreadTrace() == m_trace.get())
+		CallTrace::setThreadTrace(DE_NULL);
+}
+
+void TestCaseCallTrace::initCase (tcu::TestCase* testCase)
+{
+	// CallLogWrappers created by the case record into the trace
+	if (m_trace)
+		CallTrace::setThreadTrace(m_trace.get());
+
+	testCase->init();
+}
+
+void TestCaseCallTrace::deinitCase (tcu::TestCase* testCase)
+{
+	if (m_trace)
+	{
+		const CaseTraceEnd	caseTraceEnd	(*m_trace);
+		tcu::TestLog&		log				= m_testCtx.getLog();
+		qpTestResult		result;
+
+		testCase->deinit();
+
+		result = m_testCtx.getTestResult();
+
+		if (result != QP_TEST_RESULT_PASS && result != QP_TEST_RESULT_NOT_SUPPORTED)
+		{
+			log << tcu::TestLog::Section("CallTrace", "Last GL calls made through CallLogWrapper");
+			m_trace->write(log);
+			log << tcu::TestLog::EndSection;
+		}
+	}
+	else
+		testCase->deinit();
+}
+
+void CallTrace_selfTest (void)
+{
+	static const CallTrace::GetEnumNameFunc	s_drawEnums[]	= { DE_NULL, getPrimitiveTypeName, DE_NULL, DE_NULL, DE_NULL, DE_NULL };
+	static const CallTrace::FuncInfo		s_draw			= { "glTestDraw", "viibxp", 5, s_drawEnums };
+	static const CallTrace::FuncInfo		s_get			= { "glTestGet", "ud", 1, DE_NULL };
+	static const CallTrace::FuncInfo		s_finish		= { "glTestFinish", "v", 0, DE_NULL };
+
+	// Packing and formatting
+	{
+		CallTrace		trace		(4);
+		const void*		ptr			= reinterpret_cast<const void*>((deUintptr)0x1230);
+		const deUint64	drawArgs[]	=
+		{
+			CallTrace::pack((glw::GLenum)GL_TRIANGLES),
+			CallTrace::pack((glw::GLint)-3),
+			CallTrace::pack((glw::GLboolean)GL_TRUE),
+			CallTrace::pack((glw::GLbitfield)GL_COLOR_BUFFER_BIT),
+			CallTrace::pack(ptr)
+		};
+		const deUint64	getArgs[]	= { CallTrace::pack(0.25) };
+
+		DE_TEST_ASSERT(CallTrace::pack(1.5f) == 0x3fc00000u);
+		DE_TEST_ASSERT(CallTrace::pack((glw::GLint)-1) == ~(deUint64)0);
+		DE_TEST_ASSERT(CallTrace::pack((glw::GLuint)0xffffffffu) == 0xffffffffu);
+
+		trace.record(s_draw, drawArgs);
+		trace.record(s_get, getArgs);
+		trace.setReturnValue(CallTrace::pack((glw::GLuint)4000000000u));
+
+		DE_TEST_ASSERT(trace.getNumRecords() == 2);
+		DE_TEST_ASSERT(CallTrace::formatCall(trace.getRecord(0)) ==
+					   std::string("glTestDraw(GL_TRIANGLES, -3, GL_TRUE, 0x00004000, ") + de::toString(tcu::toHex((deUintptr)0x1230)) + ");");
+		DE_TEST_ASSERT(CallTrace::formatCall(trace.getRecord(1)) == "glTestGet(0.25);");
+		DE_TEST_ASSERT(CallTrace::formatReturnValue(trace.getRecord(1)) == "// 4000000000 returned");
+	}
+
+	// Retention
+	{
+		CallTrace		trace		(2);
+		const deUint64	args[]		= { CallTrace::pack(1.0) };
+
+		trace.setReturnValue(1);
+		DE_TEST_ASSERT(trace.getNumRecords() == 0);
+
+		trace.record(s_finish, DE_NULL);
+		trace.record(s_get, args);
+		trace.record(s_finish, DE_NULL);
+
+		DE_TEST_ASSERT(trace.getNumCalls() == 3);
+		DE_TEST_ASSERT(trace.getNumRecords() == 2);
+		DE_TEST_ASSERT(trace.getRecord(0).func == &s_get);
+		DE_TEST_ASSERT(trace.getRecord(1).func == &s_finish);
+
+		trace.clear();
+		DE_TEST_ASSERT(trace.getNumCalls() == 0 && trace.getNumRecords() == 0);
+	}
+
+	// Thread trace
+	{
+		CallTrace trace (1);
+
+		DE_TEST_ASSERT(CallTrace::getThreadTrace() == DE_NULL);
+		CallTrace::setThreadTrace(&trace);
+		DE_TEST_ASSERT(CallTrace::getThreadTrace() == &trace);
+		CallTrace::setThreadTrace(DE_NULL);
+	}
+}
+
+} // glu
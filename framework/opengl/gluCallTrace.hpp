@@ -0,0 +1,207 @@
+#ifndef _GLUCALLTRACE_HPP
+#define _GLUCALLTRACE_HPP
+/*-------------------------------------------------------------------------
+ * drawElements Quality Program OpenGL ES Utilities
+ * ------------------------------------------------
+ *
+ * Copyright 2019 The Android Open Source Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ *//*!
+ * \file
+ * \brief Binary GL call trace.
+ *//*--------------------------------------------------------------------*/
+
+#include "gluDefs.hpp"
+#include "deMemory.h"
+#include "deUniquePtr.hpp"
+
+#include <vector>
+#include <string>
+
+namespace tcu
+{
+class TestLog;
+class TestContext;
+class TestCase;
+}
+
+namespace glu
+{
+
+/*--------------------------------------------------------------------*//*!
+ * \brief Ring buffer of recorded GL calls
+ *
+ * Calls are stored as fixed-size records holding a pointer to static
+ * function info and the raw argument values. Only the most recent calls
+ * are retained. Formatting into text is deferred until the trace is
+ * written into a log, so recording costs a few stores per call.
+ *
+ * Pointer arguments are recorded as addresses, since the memory they
+ * point to may not be valid anymore when the trace is written.
+ *
+ * A trace is not thread-safe. Each thread should record into its own
+ * trace. setThreadTrace() selects the trace that CallLogWrappers created
+ * on the calling thread record into, which lets a test case executor
+ * capture calls made by wrappers that are local to the case.
+ *//*--------------------------------------------------------------------*/
+class CallTrace
+{
+public:
+	typedef const char* (*GetEnumNameFunc) (int value);
+
+	//! Value type codes used in FuncInfo::signature
+	enum ValueType
+	{
+		VALUETYPE_VOID		= 'v',
+		VALUETYPE_INT		= 'i',
+		VALUETYPE_UINT		= 'u',
+		VALUETYPE_HEX		= 'x',
+		VALUETYPE_BOOLEAN	= 'b',
+		VALUETYPE_FLOAT		= 'f',
+		VALUETYPE_DOUBLE	= 'd',
+		VALUETYPE_POINTER	= 'p'
+	};
+
+	enum
+	{
+		MAX_ARGS = 17		//!< Must match CALL_TRACE_MAX_ARGS in gen_call_log_wrapper.py
+	};
+
+	//! Static description of a traced function
+	struct FuncInfo
+	{
+		const char*				name;
+		const char*				signature;		//!< Return value type followed by argument types
+		int						numArgs;
+		const GetEnumNameFunc*	enumNames;		//!< Name lookups for return value and arguments (null entries for none), or null
+	};
+
+	struct Record
+	{
+		const FuncInfo*			func;
+		deUint64				returnValue;
+		deUint64				args[MAX_ARGS];
+	};
+
+	explicit					CallTrace			(int capacity);
+								~CallTrace			(void);
+
+	inline void					record				(const FuncInfo& func, const deUint64* args);
+	inline void					setReturnValue		(deUint64 value);
+
+	int							getCapacity			(void) const { return (int)m_records.size();	}
+	//! Number of retained records
+	int							getNumRecords		(void) const;
+	//! Retained record, 0 is the oldest
+	const Record&				getRecord			(int ndx) const;
+	//! Number of calls recorded since last clear(), including ones no longer retained
+	deUint64					getNumCalls			(void) const { return m_numCalls;	}
+
+	void						clear				(void);
+
+	//! Write retained calls into log
+	void						write				(tcu::TestLog& log) const;
+
+	//! Set trace that CallLogWrappers created on the calling thread record into, or null for none
+	static void					setThreadTrace		(CallTrace* trace);
+	static CallTrace*			getThreadTrace		(void);
+
+	static std::string			formatCall			(const Record& record);
+	static std::string			formatReturnValue	(const Record& record);
+
+	template<typename T>
+	static deUint64				pack				(T value)	{ return (deUint64)(deInt64)value;								}
+	template<typename T>
+	static deUint64				pack				(T* value)	{ return (deUint64)reinterpret_cast<deUintptr>(value);			}
+	static deUint64				pack				(float value);
+	static deUint64				pack				(double value);
+
+private:
+								CallTrace			(const CallTrace&);
+	CallTrace&					operator=			(const CallTrace&);
+
+	std::vector<Record>			m_records;
+	int							m_next;				//!< Slot of the next record
+	Record*						m_last;				//!< Most recent record, or null
+	deUint64					m_numCalls;
+};
+
+inline void CallTrace::record (const FuncInfo& func, const deUint64* args)
+{
+	Record& dst = m_records[m_next];
+
+	DE_ASSERT(func.numArgs <= MAX_ARGS);
+
+	dst.func		= &func;
+	dst.returnValue	= 0;
+	if (func.numArgs > 0)
+		deMemcpy(dst.args, args, sizeof(deUint64) * func.numArgs);
+
+	m_last		 = &dst;
+	m_next		 = (m_next + 1 == (int)m_records.size()) ? 0 : m_next + 1;
+	m_numCalls	+= 1;
+}
+
+inline void CallTrace::setReturnValue (deUint64 value)
+{
+	if (m_last)
+		m_last->returnValue = value;
+}
+
+inline deUint64 CallTrace::pack (float value)
+{
+	deUint32 bits;
+	deMemcpy(&bits, &value, sizeof(bits));
+	return (deUint64)bits;
+}
+
+inline deUint64 CallTrace::pack (double value)
+{
+	deUint64 bits;
+	deMemcpy(&bits, &value, sizeof(bits));
+	return bits;
+}
+
+/*--------------------------------------------------------------------*//*!
+ * \brief Call trace of cases run by a test case executor
+ *
+ * Trace size is taken from --deqp-gl-call-trace, and the trace is
+ * disabled if it is 0. initCase() makes the trace the calling thread's
+ * trace before initializing the case. deinitCase() clears the thread
+ * trace even if case deinit throws, and writes the retained calls into
+ * the log if the case did not pass.
+ *//*--------------------------------------------------------------------*/
+class TestCaseCallTrace
+{
+public:
+	explicit					TestCaseCallTrace	(tcu::TestContext& testCtx);
+								~TestCaseCallTrace	(void);
+
+	void						initCase			(tcu::TestCase* testCase);
+	void						deinitCase			(tcu::TestCase* testCase);
+
+private:
+								TestCaseCallTrace	(const TestCaseCallTrace&);
+	TestCaseCallTrace&			operator=			(const TestCaseCallTrace&);
+
+	tcu::TestContext&			m_testCtx;
+	de::UniquePtr<CallTrace>	m_trace;			//!< Null if disabled
+};
+
+void CallTrace_selfTest (void);
+
+} // glu
+
+#endif // _GLUCALLTRACE_HPP
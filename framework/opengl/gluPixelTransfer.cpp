@@ -139,4 +139,152 @@ void texSubImage3D (const RenderContext& context, deUint32 target, int level, in
 	gl.texSubImage3D(target, level, x, y, z, width, height, depth, format.format, format.dataType, src.getDataPtr());
 }
 
+static bool isAsyncReadSupported (ContextType type)
+{
+	// Pixel pack buffers and fence syncs
+	return contextSupports(type, ApiType::es(3,0)) || contextSupports(type, ApiType::core(3,2));
+}
+
+AsyncPixelReader::AsyncPixelReader (const RenderContext& context, int maxPendingReads)
+	: m_context	(context)
+	, m_isAsync	(isAsyncReadSupported(context.getType()))
+{
+	TCU_CHECK_INTERNAL(maxPendingReads > 0);
+
+	if (m_isAsync)
+	{
+		const glw::Functions& gl = context.getFunctions();
+
+		m_buffers.resize(maxPendingReads, 0);
+		m_bufferSizes.resize(maxPendingReads, 0);
+
+		gl.genBuffers(maxPendingReads, &m_buffers[0]);
+		GLU_EXPECT_NO_ERROR(gl.getError(), "glGenBuffers()");
+
+		for (int ndx = maxPendingReads-1; ndx >= 0; ndx--)
+			m_freeBuffers.push_back(ndx);
+	}
+}
+
+AsyncPixelReader::~AsyncPixelReader (void)
+{
+	const glw::Functions& gl = m_context.getFunctions();
+
+	for (std::deque<PendingRead>::const_iterator read = m_pendingReads.begin(); read != m_pendingReads.end(); ++read)
+		gl.deleteSync(read->sync);
+
+	if (!m_buffers.empty())
+		gl.deleteBuffers((glw::GLsizei)m_buffers.size(), &m_buffers[0]);
+}
+
+void AsyncPixelReader::read (int x, int y, const tcu::PixelBufferAccess& dst)
+{
+	TCU_CHECK_INTERNAL(dst.getDepth() == 1);
+	TCU_CHECK_INTERNAL(dst.getRowPitch() == dst.getFormat().getPixelSize()*dst.getWidth());
+
+	if (!m_isAsync)
+	{
+		readPixels(m_context, x, y, dst);
+		return;
+	}
+
+	if (m_freeBuffers.empty())
+		completeOldestRead();
+
+	{
+		const glw::Functions&	gl			= m_context.getFunctions();
+		const int				bufferNdx	= m_freeBuffers.back();
+		const int				dataSize	= dst.getRowPitch()*dst.getHeight();
+		const TransferFormat	format		= getTransferFormat(dst.getFormat());
+		glw::GLsync				sync;
+
+		gl.bindBuffer(GL_PIXEL_PACK_BUFFER, m_buffers[bufferNdx]);
+
+		if (m_bufferSizes[bufferNdx] < dataSize)
+		{
+			gl.bufferData(GL_PIXEL_PACK_BUFFER, dataSize, DE_NULL, GL_STREAM_READ);
+			m_bufferSizes[bufferNdx] = dataSize;
+		}
+
+		gl.pixelStorei(GL_PACK_ALIGNMENT, getTransferAlignment(dst.getFormat()));
+		gl.readPixels(x, y, dst.getWidth(), dst.getHeight(), format.format, format.dataType, DE_NULL);
+		gl.bindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+		GLU_EXPECT_NO_ERROR(gl.getError(), "Failed to read pixels to pixel pack buffer");
+
+		sync = gl.fenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+		GLU_EXPECT_NO_ERROR(gl.getError(), "glFenceSync()");
+
+		// Make sure the fence gets to the GPU so that poll() can observe it
+		gl.flush();
+
+		m_freeBuffers.pop_back();
+		m_pendingReads.push_back(PendingRead(bufferNdx, sync, dst));
+	}
+}
+
+int AsyncPixelReader::poll (void)
+{
+	const glw::Functions& gl = m_context.getFunctions();
+
+	while (!m_pendingReads.empty())
+	{
+		const glw::GLenum result = gl.clientWaitSync(m_pendingReads.front().sync, 0, 0);
+		GLU_EXPECT_NO_ERROR(gl.getError(), "glClientWaitSync()");
+
+		if (result == GL_TIMEOUT_EXPIRED)
+			break;
+
+		completeOldestRead();
+	}
+
+	return getNumPendingReads();
+}
+
+void AsyncPixelReader::finish (void)
+{
+	while (!m_pendingReads.empty())
+		completeOldestRead();
+}
+
+void AsyncPixelReader::completeOldestRead (void)
+{
+	DE_ASSERT(!m_pendingReads.empty());
+
+	const glw::Functions&	gl		= m_context.getFunctions();
+	const PendingRead		read	= m_pendingReads.front();
+	const int				size	= read.dst.getRowPitch()*read.dst.getHeight();
+
+	// Wait in slices to avoid passing an unbounded timeout to the driver. The watchdog catches hangs.
+	for (;;)
+	{
+		const glw::GLenum result = gl.clientWaitSync(read.sync, GL_SYNC_FLUSH_COMMANDS_BIT, 100000000ull);
+		GLU_EXPECT_NO_ERROR(gl.getError(), "glClientWaitSync()");
+
+		if (result == GL_ALREADY_SIGNALED || result == GL_CONDITION_SATISFIED)
+			break;
+		else if (result == GL_WAIT_FAILED)
+			TCU_FAIL("glClientWaitSync() failed");
+	}
+
+	m_pendingReads.pop_front();
+	m_freeBuffers.push_back(read.bufferNdx);
+	gl.deleteSync(read.sync);
+
+	gl.bindBuffer(GL_PIXEL_PACK_BUFFER, m_buffers[read.bufferNdx]);
+
+	{
+		const void* const ptr = gl.mapBufferRange(GL_PIXEL_PACK_BUFFER, 0, size, GL_MAP_READ_BIT);
+
+		if (ptr)
+		{
+			deMemcpy(read.dst.getDataPtr(), ptr, size);
+			gl.unmapBuffer(GL_PIXEL_PACK_BUFFER);
+		}
+
+		gl.bindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+		GLU_EXPECT_NO_ERROR(gl.getError(), "Failed to map pixel pack buffer");
+		TCU_CHECK(ptr);
+	}
+}
+
 } // glu
@@ -24,12 +24,15 @@
  *//*--------------------------------------------------------------------*/
 
 #include "gluDefs.hpp"
+#include "glwDefs.hpp"
+#include "tcuTexture.hpp"
+
+#include <vector>
+#include <deque>
 
 namespace tcu
 {
 
-class ConstPixelBufferAccess;
-class PixelBufferAccess;
 class Surface;
 
 } // tcu
@@ -45,6 +48,69 @@ void	texImage3D		(const RenderContext& context, deUint32 target, int level, deUi
 void	texSubImage2D	(const RenderContext& context, deUint32 target, int level, int x, int y, const tcu::ConstPixelBufferAccess& src);
 void	texSubImage3D	(const RenderContext& context, deUint32 target, int level, int x, int y, int z, const tcu::ConstPixelBufferAccess& src);
 
+/*--------------------------------------------------------------------*//*!
+ * \brief Asynchronous readPixels through pixel pack buffers
+ *
+ * read() issues glReadPixels() from the current read framebuffer into a
+ * pixel pack buffer and inserts a fence. The pixels are copied into the
+ * destination access only when the read is completed, so rendering of
+ * the following frames can overlap with the transfer. Reads complete in
+ * issue order, in poll() once their fence has been signaled, in finish(),
+ * or in read() when all buffers are in use.
+ *
+ * On contexts without pixel pack buffers and fence syncs (ES2) reads are
+ * completed synchronously in read().
+ *
+ * Destination accesses must remain valid until the read is completed.
+ * Pending reads are discarded on destruction. The pixel pack buffer
+ * binding is left at 0.
+ *//*--------------------------------------------------------------------*/
+class AsyncPixelReader
+{
+public:
+	enum
+	{
+		DEFAULT_MAX_PENDING_READS	= 3
+	};
+
+								AsyncPixelReader	(const RenderContext& context, int maxPendingReads = DEFAULT_MAX_PENDING_READS);
+								~AsyncPixelReader	(void);
+
+	//! Start reading pixels to dst. Stride must be default stride for format.
+	void						read				(int x, int y, const tcu::PixelBufferAccess& dst);
+
+	//! Complete reads that have finished on the GPU without waiting. Returns number of reads still pending.
+	int							poll				(void);
+
+	//! Wait for and complete all pending reads
+	void						finish				(void);
+
+	int							getNumPendingReads	(void) const { return (int)m_pendingReads.size();	}
+	bool						isAsync				(void) const { return m_isAsync;						}
+
+private:
+								AsyncPixelReader	(const AsyncPixelReader&);
+	AsyncPixelReader&			operator=			(const AsyncPixelReader&);
+
+	struct PendingRead
+	{
+		int						bufferNdx;
+		glw::GLsync				sync;
+		tcu::PixelBufferAccess	dst;
+
+		PendingRead (int bufferNdx_, glw::GLsync sync_, const tcu::PixelBufferAccess& dst_) : bufferNdx(bufferNdx_), sync(sync_), dst(dst_) {}
+	};
+
+	void						completeOldestRead	(void);
+
+	const RenderContext&		m_context;
+	const bool					m_isAsync;
+	std::vector<deUint32>		m_buffers;
+	std::vector<int>			m_bufferSizes;
+	std::vector<int>			m_freeBuffers;		//!< Indices to m_buffers
+	std::deque<PendingRead>		m_pendingReads;		//!< In issue order
+};
+
 } // glu
 
 #endif // _GLUPIXELTRANSFER_HPP
@@ -25,6 +25,7 @@
 #include "gluDefs.hpp"
 #include "gluRenderConfig.hpp"
 #include "gluFboRenderContext.hpp"
+#include "gluStateTrackingRenderContext.hpp"
 #include "gluPlatform.hpp"
 #include "gluStrUtil.hpp"
 #include "glwInitFunctions.hpp"
@@ -33,6 +34,7 @@
 #include "tcuCommandLine.hpp"
 #include "deStringUtil.hpp"
 #include "deSTLUtil.hpp"
+#include "deUniquePtr.hpp"
 
 namespace glu
 {
@@ -181,7 +183,20 @@ RenderContext* createDefaultRenderContext (tcu::Platform& platform, const tcu::C
 	config.type = glu::ContextType(apiType, ctxFlags);
 	parseRenderConfig(&config, cmdLine);
 
-	return createRenderContext(platform, cmdLine, config);
+	{
+		const tcu::GLStateResetMode	resetMode	= cmdLine.getGLStateResetMode();
+		de::MovePtr<RenderContext>	context		(createRenderContext(platform, cmdLine, config));
+
+		// Only one context can be tracked at a time; others fall back to full reset
+		if (resetMode != tcu::GLSTATERESET_FULL && StateTrackingRenderContext::isAvailable())
+		{
+			RenderContext* const trackingContext = new StateTrackingRenderContext(context.get(), resetMode == tcu::GLSTATERESET_VERIFY);
+			context.release();
+			return trackingContext;
+		}
+
+		return context.release();
+	}
 }
 
 static std::vector<std::string> getExtensions (const glw::Functions& gl, ApiType apiType)
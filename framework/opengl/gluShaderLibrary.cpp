@@ -22,11 +22,13 @@
  *//*--------------------------------------------------------------------*/
 
 #include "gluShaderLibrary.hpp"
+#include "gluShaderLibraryBinary.hpp"
 
 #include "tcuStringTemplate.hpp"
 #include "tcuResource.hpp"
 #include "tcuTestLog.hpp"
 
+#include "deString.h"
 #include "deStringUtil.hpp"
 #include "deUniquePtr.hpp"
 #include "deFilePath.hpp"
@@ -278,10 +280,11 @@ DE_INLINE deBool isCaseNameChar (char c)
 class ShaderParser
 {
 public:
-							ShaderParser			(const tcu::Archive& archive, const std::string& filename, ShaderCaseFactory* caseFactory);
+							ShaderParser			(const tcu::Archive& archive, const std::string& filename, LibraryFile& dst);
 							~ShaderParser			(void);
 
-	vector<tcu::TestNode*>	parse					(void);
+	//! Parse into destination file, returns number of top-level nodes added
+	int						parse					(void);
 
 private:
 	enum Token
@@ -387,13 +390,15 @@ private:
 	void						parseFormat					(DataType& format);
 	void						parseGLSLVersion			(glu::GLSLVersion& version);
 	void						parsePipelineProgram		(ProgramSpecification& program);
-	void						parseShaderCase				(vector<tcu::TestNode*>& shaderNodeList);
-	void						parseShaderGroup			(vector<tcu::TestNode*>& shaderNodeList);
-	void						parseImport					(vector<tcu::TestNode*>& shaderNodeList);
+	void						parseShaderCase				(int& numNodes);
+	void						parseShaderGroup			(int& numNodes);
+	void						parseImport					(int& numNodes);
+
+	void						addCase						(const string& name, const string& description, const ShaderCaseSpecification& spec);
 
 	const tcu::Archive&			m_archive;
 	const string				m_filename;
-	ShaderCaseFactory* const	m_caseFactory;
+	LibraryFile&				m_dst;
 
 	UniquePtr<tcu::Resource>	m_resource;
 	vector<char>				m_input;
@@ -403,10 +408,10 @@ private:
 	std::string					m_curTokenStr;
 };
 
-ShaderParser::ShaderParser (const tcu::Archive& archive, const string& filename, ShaderCaseFactory* caseFactroy)
+ShaderParser::ShaderParser (const tcu::Archive& archive, const string& filename, LibraryFile& dst)
 	: m_archive			(archive)
 	, m_filename		(filename)
-	, m_caseFactory		(caseFactroy)
+	, m_dst				(dst)
 	, m_resource		(archive.getResource(m_filename.c_str()))
 	, m_curPtr			(DE_NULL)
 	, m_curToken		(TOKEN_LAST)
@@ -1328,7 +1333,19 @@ void ShaderParser::parsePipelineProgram (ProgramSpecification& program)
 		parseError("program pipeline object must have active stages");
 }
 
-void ShaderParser::parseShaderCase (vector<tcu::TestNode*>& shaderNodeList)
+void ShaderParser::addCase (const string& name, const string& description, const ShaderCaseSpecification& spec)
+{
+	m_dst.nodes.push_back(LibraryNode());
+
+	LibraryNode& node = m_dst.nodes.back();
+
+	node.type			= LIBRARYNODETYPE_CASE;
+	node.name			= name;
+	node.description	= description;
+	node.spec			= spec;
+}
+
+void ShaderParser::parseShaderCase (int& numNodes)
 {
 	// Parse 'case'.
 	PARSE_DBG(("  parseShaderCase()\n"));
@@ -1468,7 +1485,8 @@ void ShaderParser::parseShaderCase (vector<tcu::TestNode*>& shaderNodeList)
 			spec.programs[0].sources << VertexSource(bothSource);
 			spec.programs[0].requiredExtensions	= requiredExts;
 
-			shaderNodeList.push_back(m_caseFactory->createCase(caseName + "_vertex", description, ShaderCaseSpecification(spec)));
+			addCase(caseName + "_vertex", description, spec);
+			numNodes += 1;
 		}
 
 		// fragment
@@ -1484,7 +1502,8 @@ void ShaderParser::parseShaderCase (vector<tcu::TestNode*>& shaderNodeList)
 			spec.programs[0].sources << FragmentSource(bothSource);
 			spec.programs[0].requiredExtensions	= requiredExts;
 
-			shaderNodeList.push_back(m_caseFactory->createCase(caseName + "_fragment", description, ShaderCaseSpecification(spec)));
+			addCase(caseName + "_fragment", description, spec);
+			numNodes += 1;
 		}
 	}
 	else if (pipelinePrograms.empty())
@@ -1506,7 +1525,8 @@ void ShaderParser::parseShaderCase (vector<tcu::TestNode*>& shaderNodeList)
 		spec.programs[0].sources.sources[SHADERTYPE_GEOMETRY].swap(geometrySources);
 		spec.programs[0].requiredExtensions.swap(requiredExts);
 
-		shaderNodeList.push_back(m_caseFactory->createCase(caseName, description, ShaderCaseSpecification(spec)));
+		addCase(caseName, description, spec);
+		numNodes += 1;
 	}
 	else
 	{
@@ -1533,12 +1553,13 @@ void ShaderParser::parseShaderCase (vector<tcu::TestNode*>& shaderNodeList)
 
 			spec.programs.swap(pipelinePrograms);
 
-			shaderNodeList.push_back(m_caseFactory->createCase(caseName, description, ShaderCaseSpecification(spec)));
+			addCase(caseName, description, spec);
+			numNodes += 1;
 		}
 	}
 }
 
-void ShaderParser::parseShaderGroup (vector<tcu::TestNode*>& shaderNodeList)
+void ShaderParser::parseShaderGroup (int& numNodes)
 {
 	// Parse 'case'.
 	PARSE_DBG(("  parseShaderGroup()\n"));
@@ -1553,7 +1574,14 @@ void ShaderParser::parseShaderGroup (vector<tcu::TestNode*>& shaderNodeList)
 	string description = parseStringLiteral(m_curTokenStr.c_str());
 	advanceToken(TOKEN_STRING);
 
-	std::vector<tcu::TestNode*> children;
+	// Add group node, children follow it.
+	const size_t	groupNdx		= m_dst.nodes.size();
+	int				numChildren		= 0;
+
+	m_dst.nodes.push_back(LibraryNode());
+	m_dst.nodes.back().type			= LIBRARYNODETYPE_GROUP;
+	m_dst.nodes.back().name			= name;
+	m_dst.nodes.back().description	= description;
 
 	// Parse group children.
 	for (;;)
@@ -1561,23 +1589,22 @@ void ShaderParser::parseShaderGroup (vector<tcu::TestNode*>& shaderNodeList)
 		if (m_curToken == TOKEN_END)
 			break;
 		else if (m_curToken == TOKEN_GROUP)
-			parseShaderGroup(children);
+			parseShaderGroup(numChildren);
 		else if (m_curToken == TOKEN_CASE)
-			parseShaderCase(children);
+			parseShaderCase(numChildren);
 		else if (m_curToken == TOKEN_IMPORT)
-			parseImport(children);
+			parseImport(numChildren);
 		else
 			parseError(string("unexpected token while parsing shader group: " + m_curTokenStr));
 	}
 
 	advanceToken(TOKEN_END); // group end
 
-	// Create group node.
-	tcu::TestCaseGroup* groupNode = m_caseFactory->createGroup(name, description, children);
-	shaderNodeList.push_back(groupNode);
+	m_dst.nodes[groupNdx].numChildren = numChildren;
+	numNodes += 1;
 }
 
-void ShaderParser::parseImport (vector<tcu::TestNode*>& shaderNodeList)
+void ShaderParser::parseImport (int& numNodes)
 {
 	std::string	importFileName;
 
@@ -1588,15 +1615,13 @@ void ShaderParser::parseImport (vector<tcu::TestNode*>& shaderNodeList)
 	advanceToken(TOKEN_STRING);
 
 	{
-		ShaderParser					subParser		(m_archive, de::FilePath::join(de::FilePath(m_filename).getDirName(), importFileName).getPath(), m_caseFactory);
-		const vector<tcu::TestNode*>	importedCases = subParser.parse();
+		ShaderParser subParser (m_archive, de::FilePath::join(de::FilePath(m_filename).getDirName(), importFileName).getPath(), m_dst);
 
-		// \todo [2015-08-03 pyry] Not exception safe
-		shaderNodeList.insert(shaderNodeList.end(), importedCases.begin(), importedCases.end());
+		numNodes += subParser.parse();
 	}
 }
 
-vector<tcu::TestNode*> ShaderParser::parse (void)
+int ShaderParser::parse (void)
 {
 	const int	dataLen		= m_resource->getSize();
 
@@ -1605,24 +1630,35 @@ vector<tcu::TestNode*> ShaderParser::parse (void)
 	m_resource->read((deUint8*)&m_input[0], dataLen);
 	m_input[dataLen] = '\0';
 
+	// Record source for detecting stale binaries.
+	{
+		LibrarySourceFile source;
+
+		source.filename	= m_filename;
+		source.size		= (deUint32)dataLen;
+		source.hash		= deMemoryHash(&m_input[0], (size_t)dataLen);
+
+		m_dst.sources.push_back(source);
+	}
+
 	// Initialize parser.
 	m_curPtr		= &m_input[0];
 	m_curToken		= TOKEN_INVALID;
 	m_curTokenStr	= "";
 	advanceToken();
 
-	vector<tcu::TestNode*> nodeList;
+	int numNodes = 0;
 
 	// Parse all cases.
 	PARSE_DBG(("parse()\n"));
 	for (;;)
 	{
 		if (m_curToken == TOKEN_CASE)
-			parseShaderCase(nodeList);
+			parseShaderCase(numNodes);
 		else if (m_curToken == TOKEN_GROUP)
-			parseShaderGroup(nodeList);
+			parseShaderGroup(numNodes);
 		else if (m_curToken == TOKEN_IMPORT)
-			parseImport(nodeList);
+			parseImport(numNodes);
 		else if (m_curToken == TOKEN_EOF)
 			break;
 		else
@@ -1631,14 +1667,79 @@ vector<tcu::TestNode*> ShaderParser::parse (void)
 
 	assumeToken(TOKEN_EOF);
 //	printf("  parsed %d test cases.\n", caseList.size());
-	return nodeList;
+	return numNodes;
+}
+
+namespace
+{
+
+tcu::TestNode* createNode (const LibraryFile& file, size_t& nodeNdx, ShaderCaseFactory* caseFactory)
+{
+	const LibraryNode& node = file.nodes[nodeNdx++];
+
+	if (node.type == LIBRARYNODETYPE_CASE)
+		return caseFactory->createCase(node.name, node.description, node.spec);
+	else
+	{
+		vector<tcu::TestNode*> children;
+
+		DE_ASSERT(node.type == LIBRARYNODETYPE_GROUP);
+
+		try
+		{
+			for (int childNdx = 0; childNdx < node.numChildren; childNdx++)
+				children.push_back(createNode(file, nodeNdx, caseFactory));
+		}
+		catch (...)
+		{
+			for (size_t ndx = 0; ndx < children.size(); ndx++)
+				delete children[ndx];
+			throw;
+		}
+
+		return caseFactory->createGroup(node.name, node.description, children);
+	}
+}
+
+} // anonymous
+
+void parseFile (const tcu::Archive& archive, const std::string& filename, LibraryFile& dst)
+{
+	sl::ShaderParser	parser	(archive, filename, dst);
+
+	dst.numRootNodes += parser.parse();
+}
+
+std::vector<tcu::TestNode*> createNodes (const LibraryFile& file, ShaderCaseFactory* caseFactory)
+{
+	vector<tcu::TestNode*>	nodes;
+	size_t					nodeNdx	= 0;
+
+	try
+	{
+		for (int rootNdx = 0; rootNdx < file.numRootNodes; rootNdx++)
+			nodes.push_back(createNode(file, nodeNdx, caseFactory));
+	}
+	catch (...)
+	{
+		for (size_t ndx = 0; ndx < nodes.size(); ndx++)
+			delete nodes[ndx];
+		throw;
+	}
+
+	DE_ASSERT(nodeNdx == file.nodes.size());
+
+	return nodes;
 }
 
 std::vector<tcu::TestNode*> parseFile (const tcu::Archive& archive, const std::string& filename, ShaderCaseFactory* caseFactory)
 {
-	sl::ShaderParser	parser	(archive, filename, caseFactory);
+	LibraryFile file;
+
+	if (!loadBinary(archive, filename, file))
+		parseFile(archive, filename, file);
 
-	return parser.parse();
+	return createNodes(file, caseFactory);
 }
 
 // Execution utilities
@@ -30,6 +30,7 @@
 
 #include <string>
 #include <vector>
+#include <deque>
 
 namespace glu
 {
@@ -200,8 +201,63 @@ public:
 	virtual tcu::TestCase*		createCase	(const std::string& name, const std::string& description, const ShaderCaseSpecification& spec) = 0;
 };
 
+enum LibraryNodeType
+{
+	LIBRARYNODETYPE_GROUP = 0,
+	LIBRARYNODETYPE_CASE,
+
+	LIBRARYNODETYPE_LAST
+};
+
+struct LibraryNode
+{
+	LibraryNodeType				type;
+	std::string					name;
+	std::string					description;
+	int							numChildren;	// Groups only, children follow the group in node list
+	ShaderCaseSpecification		spec;			// Cases only
+
+	LibraryNode (void)
+		: type			(LIBRARYNODETYPE_LAST)
+		, numChildren	(0)
+	{
+	}
+};
+
+struct LibrarySourceFile
+{
+	std::string					filename;
+	deUint32					size;
+	deUint32					hash;			// deMemoryHash() of file contents
+
+	LibrarySourceFile (void)
+		: size	(0u)
+		, hash	(0u)
+	{
+	}
+};
+
+//! Parsed .test file
+struct LibraryFile
+{
+	std::vector<LibrarySourceFile>	sources;	// Parsed file and all files imported by it
+	std::deque<LibraryNode>			nodes;		// Top-level nodes and their subtrees in depth-first order
+	int								numRootNodes;
+
+	LibraryFile (void)
+		: numRootNodes	(0)
+	{
+	}
+};
+
+//! Parse file, using precompiled binary (filename + ".bin") if present and up to date.
 std::vector<tcu::TestNode*>		parseFile	(const tcu::Archive& archive, const std::string& filename, ShaderCaseFactory* caseFactory);
 
+//! Parse text file.
+void							parseFile	(const tcu::Archive& archive, const std::string& filename, LibraryFile& dst);
+
+std::vector<tcu::TestNode*>		createNodes	(const LibraryFile& file, ShaderCaseFactory* caseFactory);
+
 // Specialization utilties
 
 struct ProgramSpecializationParams
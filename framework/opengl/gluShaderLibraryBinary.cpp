@@ -0,0 +1,847 @@
+/*-------------------------------------------------------------------------
+ * drawElements Quality Program OpenGL ES Utilities
+ * ------------------------------------------------
+ *
+ * Copyright 2019 The Android Open Source Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ *//*!
+ * \file
+ * \brief Precompiled binary format for shader .test files.
+ *//*--------------------------------------------------------------------*/
+
+#include "gluShaderLibraryBinary.hpp"
+#include "tcuResource.hpp"
+#include "deUniquePtr.hpp"
+#include "deString.h"
+#include "deMemory.h"
+
+#include <map>
+#include <algorithm>
+
+namespace glu
+{
+namespace sl
+{
+
+using std::string;
+using std::vector;
+
+namespace
+{
+
+/*--------------------------------------------------------------------*//*!
+ * Layout, all integers are 32-bit little-endian:
+ *
+ *  header:		magic[8], version, SHADERTYPE_LAST, TYPE_LAST, GLSL_VERSION_LAST
+ *  strings:	count, { length, bytes }
+ *  sources:	count, { filename, size, hash }
+ *  nodes:		count, numRootNodes, { type, name, description, group | case }
+ *  group:		numChildren
+ *  case:		caseType, expectResult, outputType, outputFormat, targetVersion,
+ *				count, { capType, flagName | enumName, referenceValue },
+ *				inputs, outputs, uniforms: count, { dataType, name, count, { element } },
+ *				count, { separable, activeStages, SHADERTYPE_LAST * (count, { source }),
+ *						 count, { count, { alternative }, effectiveStages } }
+ *
+ * Strings are stored as indices into string table. Enum ranges are part
+ * of the header, so that changes to them invalidate binaries.
+ *//*--------------------------------------------------------------------*/
+
+const deUint8	s_magic[8]		= { 'd', 'E', 'Q', 'P', 'S', 'L', 'B', 0 };
+const deUint32	s_version		= 1u;
+
+class BinaryWriter
+{
+public:
+	void					writeFile		(const LibraryFile& file, vector<deUint8>& dst);
+
+private:
+	void					writeU32		(deUint32 value);
+	void					writeString		(const string& str);
+	void					writeValues		(const vector<Value>& values);
+	void					writeCase		(const ShaderCaseSpecification& spec);
+
+	vector<deUint8>			m_body;
+	vector<const string*>	m_strings;
+	std::map<string, int>	m_stringNdx;
+};
+
+void BinaryWriter::writeU32 (deUint32 value)
+{
+	m_body.push_back((deUint8)(value & 0xffu));
+	m_body.push_back((deUint8)((value >> 8) & 0xffu));
+	m_body.push_back((deUint8)((value >> 16) & 0xffu));
+	m_body.push_back((deUint8)(value >> 24));
+}
+
+void BinaryWriter::writeString (const string& str)
+{
+	const std::map<string, int>::iterator	pos	= m_stringNdx.insert(std::make_pair(str, (int)m_strings.size())).first;
+
+	if (pos->second == (int)m_strings.size())
+		m_strings.push_back(&pos->first);
+
+	writeU32((deUint32)pos->second);
+}
+
+void BinaryWriter::writeValues (const vector<Value>& values)
+{
+	writeU32((deUint32)values.size());
+
+	for (vector<Value>::const_iterator value = values.begin(); value != values.end(); ++value)
+	{
+		DE_ASSERT(value->type.isBasicType());
+
+		writeU32((deUint32)value->type.getBasicType());
+		writeString(value->name);
+		writeU32((deUint32)value->elements.size());
+
+		for (size_t elemNdx = 0; elemNdx < value->elements.size(); elemNdx++)
+			writeU32((deUint32)value->elements[elemNdx].int32);
+	}
+}
+
+void BinaryWriter::writeCase (const ShaderCaseSpecification& spec)
+{
+	writeU32((deUint32)spec.caseType);
+	writeU32((deUint32)spec.expectResult);
+	writeU32((deUint32)spec.outputType);
+	writeU32((deUint32)spec.outputFormat);
+	writeU32((deUint32)spec.targetVersion);
+
+	writeU32((deUint32)spec.requiredCaps.size());
+	for (vector<RequiredCapability>::const_iterator cap = spec.requiredCaps.begin(); cap != spec.requiredCaps.end(); ++cap)
+	{
+		writeU32((deUint32)cap->type);
+		writeU32(cap->type == CAPABILITY_FLAG ? (deUint32)cap->flagName : cap->enumName);
+		writeU32((deUint32)cap->referenceValue);
+	}
+
+	writeValues(spec.values.inputs);
+	writeValues(spec.values.outputs);
+	writeValues(spec.values.uniforms);
+
+	writeU32((deUint32)spec.programs.size());
+	for (vector<ProgramSpecification>::const_iterator program = spec.programs.begin(); program != spec.programs.end(); ++program)
+	{
+		// \note Parser only sets shader sources and separable flag
+		DE_ASSERT(program->sources.attribLocationBindings.empty() && program->sources.transformFeedbackVaryings.empty());
+
+		writeU32(program->sources.separable ? 1u : 0u);
+		writeU32(program->activeStages);
+
+		for (int shaderType = 0; shaderType < SHADERTYPE_LAST; shaderType++)
+		{
+			const vector<string>& sources = program->sources.sources[shaderType];
+
+			writeU32((deUint32)sources.size());
+			for (size_t srcNdx = 0; srcNdx < sources.size(); srcNdx++)
+				writeString(sources[srcNdx]);
+		}
+
+		writeU32((deUint32)program->requiredExtensions.size());
+		for (vector<RequiredExtension>::const_iterator ext = program->requiredExtensions.begin(); ext != program->requiredExtensions.end(); ++ext)
+		{
+			writeU32((deUint32)ext->alternatives.size());
+			for (size_t altNdx = 0; altNdx < ext->alternatives.size(); altNdx++)
+				writeString(ext->alternatives[altNdx]);
+			writeU32(ext->effectiveStages);
+		}
+	}
+}
+
+void BinaryWriter::writeFile (const LibraryFile& file, vector<deUint8>& dst)
+{
+	m_body.clear();
+	m_strings.clear();
+	m_stringNdx.clear();
+
+	// Sources and nodes go to body first, as they determine string table contents.
+	writeU32((deUint32)file.sources.size());
+	for (vector<LibrarySourceFile>::const_iterator source = file.sources.begin(); source != file.sources.end(); ++source)
+	{
+		writeString(source->filename);
+		writeU32(source->size);
+		writeU32(source->hash);
+	}
+
+	writeU32((deUint32)file.nodes.size());
+	writeU32((deUint32)file.numRootNodes);
+	for (std::deque<LibraryNode>::const_iterator node = file.nodes.begin(); node != file.nodes.end(); ++node)
+	{
+		writeU32((deUint32)node->type);
+		writeString(node->name);
+		writeString(node->description);
+
+		if (node->type == LIBRARYNODETYPE_GROUP)
+			writeU32((deUint32)node->numChildren);
+		else
+			writeCase(node->spec);
+	}
+
+	{
+		vector<deUint8> body;
+
+		body.swap(m_body);
+
+		for (int ndx = 0; ndx < DE_LENGTH_OF_ARRAY(s_magic); ndx++)
+			m_body.push_back(s_magic[ndx]);
+		writeU32(s_version);
+		writeU32((deUint32)SHADERTYPE_LAST);
+		writeU32((deUint32)TYPE_LAST);
+		writeU32((deUint32)GLSL_VERSION_LAST);
+
+		writeU32((deUint32)m_strings.size());
+		for (vector<const string*>::const_iterator str = m_strings.begin(); str != m_strings.end(); ++str)
+		{
+			writeU32((deUint32)(*str)->size());
+			m_body.insert(m_body.end(), (*str)->begin(), (*str)->end());
+		}
+
+		m_body.insert(m_body.end(), body.begin(), body.end());
+	}
+
+	dst.swap(m_body);
+	m_body.clear();
+}
+
+class BinaryReader
+{
+public:
+	//! Thrown when data ends prematurely or contains invalid values
+	struct FormatError {};
+
+							BinaryReader	(const deUint8* data, size_t size) : m_cur(data), m_end(data + size) {}
+
+	void					readFile		(LibraryFile& dst);
+
+private:
+	deUint32				readU32			(void);
+	deUint32				readU32			(deUint32 limit);
+	const string&			readString		(void);
+	void					readValues		(vector<Value>& dst);
+	void					readCase		(ShaderCaseSpecification& dst);
+
+	const deUint8*			m_cur;
+	const deUint8* const	m_end;
+	vector<string>			m_strings;
+};
+
+deUint32 BinaryReader::readU32 (void)
+{
+	if (m_end - m_cur < 4)
+		throw FormatError();
+
+	const deUint32 value = (deUint32)m_cur[0] | ((deUint32)m_cur[1] << 8) | ((deUint32)m_cur[2] << 16) | ((deUint32)m_cur[3] << 24);
+
+	m_cur += 4;
+
+	return value;
+}
+
+//! Read value in range [0, limit]
+deUint32 BinaryReader::readU32 (deUint32 limit)
+{
+	const deUint32 value = readU32();
+
+	if (value > limit)
+		throw FormatError();
+
+	return value;
+}
+
+const string& BinaryReader::readString (void)
+{
+	const deUint32 ndx = readU32();
+
+	if (ndx >= (deUint32)m_strings.size())
+		throw FormatError();
+
+	return m_strings[ndx];
+}
+
+void BinaryReader::readValues (vector<Value>& dst)
+{
+	dst.resize(readU32((deUint32)(m_end - m_cur) / 12u));
+
+	for (vector<Value>::iterator value = dst.begin(); value != dst.end(); ++value)
+	{
+		value->type	= VarType((DataType)readU32((deUint32)TYPE_LAST - 1u), PRECISION_LAST);
+		value->name	= readString();
+
+		value->elements.resize(readU32((deUint32)(m_end - m_cur) / 4u));
+		for (size_t elemNdx = 0; elemNdx < value->elements.size(); elemNdx++)
+			value->elements[elemNdx].int32 = (deInt32)readU32();
+	}
+}
+
+void BinaryReader::readCase (ShaderCaseSpecification& dst)
+{
+	dst.caseType		= (CaseType)readU32((deUint32)CASETYPE_LAST - 1u);
+	dst.expectResult	= (ExpectResult)readU32((deUint32)EXPECT_LAST - 1u);
+	dst.outputType		= (OutputType)readU32((deUint32)OUTPUT_LAST - 1u);
+	dst.outputFormat	= (DataType)readU32((deUint32)TYPE_LAST);
+	dst.targetVersion	= (GLSLVersion)readU32((deUint32)GLSL_VERSION_LAST);
+
+	{
+		const deUint32 numCaps = readU32((deUint32)(m_end - m_cur) / 12u);
+
+		dst.requiredCaps.reserve(numCaps);
+
+		for (deUint32 capNdx = 0; capNdx < numCaps; capNdx++)
+		{
+			const CapabilityType	type	= (CapabilityType)readU32((deUint32)CAPABILITY_LAST - 1u);
+			const deUint32			value	= readU32();
+			const int				ref		= (int)readU32();
+
+			if (type == CAPABILITY_FLAG)
+				dst.requiredCaps.push_back(RequiredCapability((CapabilityFlag)value));
+			else
+				dst.requiredCaps.push_back(RequiredCapability(value, ref));
+		}
+	}
+
+	readValues(dst.values.inputs);
+	readValues(dst.values.outputs);
+	readValues(dst.values.uniforms);
+
+	dst.programs.resize(readU32((deUint32)(m_end - m_cur) / 8u));
+	for (vector<ProgramSpecification>::iterator program = dst.programs.begin(); program != dst.programs.end(); ++program)
+	{
+		program->sources.separable	= readU32(1u) != 0;
+		program->activeStages		= readU32();
+
+		for (int shaderType = 0; shaderType < SHADERTYPE_LAST; shaderType++)
+		{
+			vector<string>& sources = program->sources.sources[shaderType];
+
+			sources.resize(readU32((deUint32)(m_end - m_cur) / 4u));
+			for (size_t srcNdx = 0; srcNdx < sources.size(); srcNdx++)
+				sources[srcNdx] = readString();
+		}
+
+		program->requiredExtensions.resize(readU32((deUint32)(m_end - m_cur) / 8u));
+		for (vector<RequiredExtension>::iterator ext = program->requiredExtensions.begin(); ext != program->requiredExtensions.end(); ++ext)
+		{
+			ext->alternatives.resize(readU32((deUint32)(m_end - m_cur) / 4u));
+			for (size_t altNdx = 0; altNdx < ext->alternatives.size(); altNdx++)
+				ext->alternatives[altNdx] = readString();
+			ext->effectiveStages = readU32();
+		}
+	}
+}
+
+void BinaryReader::readFile (LibraryFile& dst)
+{
+	// Header
+	if (m_end - m_cur < DE_LENGTH_OF_ARRAY(s_magic) || deMemCmp(m_cur, s_magic, sizeof(s_magic)) != 0)
+		throw FormatError();
+
+	m_cur += DE_LENGTH_OF_ARRAY(s_magic);
+
+	if (readU32() != s_version					||
+		readU32() != (deUint32)SHADERTYPE_LAST	||
+		readU32() != (deUint32)TYPE_LAST		||
+		readU32() != (deUint32)GLSL_VERSION_LAST)
+		throw FormatError();
+
+	// String table
+	m_strings.resize(readU32((deUint32)(m_end - m_cur) / 4u));
+	for (vector<string>::iterator str = m_strings.begin(); str != m_strings.end(); ++str)
+	{
+		const deUint32 length = readU32((deUint32)(m_end - m_cur));
+
+		str->assign((const char*)m_cur, (size_t)length);
+		m_cur += length;
+	}
+
+	// Sources
+	dst.sources.resize(readU32((deUint32)(m_end - m_cur) / 12u));
+	for (vector<LibrarySourceFile>::iterator source = dst.sources.begin(); source != dst.sources.end(); ++source)
+	{
+		source->filename	= readString();
+		source->size		= readU32();
+		source->hash		= readU32();
+	}
+
+	// Nodes
+	{
+		const deUint32	numNodes		= readU32((deUint32)(m_end - m_cur) / 16u);
+		int				numRootsLeft	= 0;
+		vector<int>		numChildrenLeft;	// Stack of groups that still have children to come
+
+		dst.numRootNodes	= (int)readU32(numNodes);
+		numRootsLeft		= dst.numRootNodes;
+		dst.nodes.resize(numNodes);
+
+		for (std::deque<LibraryNode>::iterator node = dst.nodes.begin(); node != dst.nodes.end(); ++node)
+		{
+			node->type			= (LibraryNodeType)readU32((deUint32)LIBRARYNODETYPE_LAST - 1u);
+			node->name			= readString();
+			node->description	= readString();
+
+			if (node->type == LIBRARYNODETYPE_GROUP)
+				node->numChildren = (int)readU32(numNodes);
+			else
+				readCase(node->spec);
+
+			// Validate hierarchy
+			if (!numChildrenLeft.empty())
+				numChildrenLeft.back() -= 1;
+			else if (numRootsLeft > 0)
+				numRootsLeft -= 1;
+			else
+				throw FormatError();
+
+			if (node->type == LIBRARYNODETYPE_GROUP)
+				numChildrenLeft.push_back(node->numChildren);
+
+			while (!numChildrenLeft.empty() && numChildrenLeft.back() == 0)
+				numChildrenLeft.pop_back();
+		}
+
+		if (numRootsLeft != 0 || !numChildrenLeft.empty())
+			throw FormatError();
+	}
+
+	if (m_cur != m_end)
+		throw FormatError();
+}
+
+} // anonymous
+
+string getBinaryFilename (const string& filename)
+{
+	return filename + ".bin";
+}
+
+void writeBinary (const LibraryFile& file, vector<deUint8>& dst)
+{
+	BinaryWriter().writeFile(file, dst);
+}
+
+bool readBinary (const deUint8* data, size_t size, LibraryFile& dst)
+{
+	try
+	{
+		LibraryFile file;
+
+		BinaryReader(data, size).readFile(file);
+
+		std::swap(dst.sources, file.sources);
+		std::swap(dst.nodes, file.nodes);
+		std::swap(dst.numRootNodes, file.numRootNodes);
+
+		return true;
+	}
+	catch (const BinaryReader::FormatError&)
+	{
+		return false;
+	}
+}
+
+bool isUpToDate (const tcu::Archive& archive, const LibraryFile& file)
+{
+	vector<deUint8> data;
+
+	for (vector<LibrarySourceFile>::const_iterator source = file.sources.begin(); source != file.sources.end(); ++source)
+	{
+		try
+		{
+			const de::UniquePtr<tcu::Resource> resource (archive.getResource(source->filename.c_str()));
+
+			if ((deUint32)resource->getSize() != source->size)
+				return false;
+
+			data.resize(source->size);
+
+			if (source->size > 0)
+			{
+				resource->setPosition(0);
+				resource->read(&data[0], (int)source->size);
+			}
+		}
+		catch (const tcu::ResourceError&)
+		{
+			return false;
+		}
+
+		if (deMemoryHash(data.empty() ? DE_NULL : &data[0], data.size()) != source->hash)
+			return false;
+	}
+
+	return true;
+}
+
+bool loadBinary (const tcu::Archive& archive, const string& filename, LibraryFile& dst)
+{
+	vector<deUint8>	data;
+	LibraryFile		file;
+
+	try
+	{
+		const de::UniquePtr<tcu::Resource> resource (archive.getResource(getBinaryFilename(filename).c_str()));
+
+		data.resize(resource->getSize());
+
+		if (data.empty())
+			return false;
+
+		resource->setPosition(0);
+		resource->read(&data[0], (int)data.size());
+	}
+	catch (const tcu::ResourceError&)
+	{
+		return false;
+	}
+
+	if (!readBinary(&data[0], data.size(), file)	||
+		file.sources.empty()						||
+		file.sources[0].filename != filename		||
+		!isUpToDate(archive, file))
+		return false;
+
+	std::swap(dst.sources, file.sources);
+	std::swap(dst.nodes, file.nodes);
+	std::swap(dst.numRootNodes, file.numRootNodes);
+
+	return true;
+}
+
+// Self-test
+
+namespace
+{
+
+class MemoryResource : public tcu::Resource
+{
+public:
+					MemoryResource	(const string& name, const vector<deUint8>& data) : tcu::Resource(name), m_data(data), m_position(0) {}
+
+	void			read			(deUint8* dst, int numBytes);
+	int				getSize			(void) const					{ return (int)m_data.size();	}
+	int				getPosition		(void) const					{ return m_position;			}
+	void			setPosition		(int position)					{ m_position = position;		}
+
+private:
+	const vector<deUint8>	m_data;
+	int						m_position;
+};
+
+void MemoryResource::read (deUint8* dst, int numBytes)
+{
+	DE_TEST_ASSERT(de::inBounds(numBytes, 0, getSize() - m_position + 1));
+
+	if (numBytes > 0)
+		deMemcpy(dst, &m_data[m_position], numBytes);
+
+	m_position += numBytes;
+}
+
+class MemoryArchive : public tcu::Archive
+{
+public:
+	void			setFile			(const string& name, const vector<deUint8>& data)	{ m_files[name] = data;									}
+	void			setFile			(const string& name, const string& text)			{ m_files[name] = vector<deUint8>(text.begin(), text.end());	}
+
+	tcu::Resource*	getResource		(const char* name) const
+	{
+		const std::map<string, vector<deUint8> >::const_iterator file = m_files.find(name);
+
+		if (file == m_files.end())
+			throw tcu::ResourceError(string("No such file: ") + name);
+
+		return new MemoryResource(name, file->second);
+	}
+
+private:
+	std::map<string, vector<deUint8> >	m_files;
+};
+
+bool valuesEqual (const vector<Value>& a, const vector<Value>& b)
+{
+	if (a.size() != b.size())
+		return false;
+
+	for (size_t valueNdx = 0; valueNdx < a.size(); valueNdx++)
+	{
+		if (a[valueNdx].type.getBasicType() != b[valueNdx].type.getBasicType()	||
+			a[valueNdx].name != b[valueNdx].name									||
+			a[valueNdx].elements.size() != b[valueNdx].elements.size())
+			return false;
+
+		for (size_t elemNdx = 0; elemNdx < a[valueNdx].elements.size(); elemNdx++)
+		{
+			if (a[valueNdx].elements[elemNdx].int32 != b[valueNdx].elements[elemNdx].int32)
+				return false;
+		}
+	}
+
+	return true;
+}
+
+bool casesEqual (const ShaderCaseSpecification& a, const ShaderCaseSpecification& b)
+{
+	if (a.caseType != b.caseType				||
+		a.expectResult != b.expectResult		||
+		a.outputType != b.outputType			||
+		a.outputFormat != b.outputFormat		||
+		a.targetVersion != b.targetVersion		||
+		a.requiredCaps.size() != b.requiredCaps.size()	||
+		a.programs.size() != b.programs.size())
+		return false;
+
+	for (size_t capNdx = 0; capNdx < a.requiredCaps.size(); capNdx++)
+	{
+		const RequiredCapability&	capA	= a.requiredCaps[capNdx];
+		const RequiredCapability&	capB	= b.requiredCaps[capNdx];
+
+		if (capA.type != capB.type || capA.enumName != capB.enumName || capA.referenceValue != capB.referenceValue)
+			return false;
+	}
+
+	if (!valuesEqual(a.values.inputs, b.values.inputs)		||
+		!valuesEqual(a.values.outputs, b.values.outputs)	||
+		!valuesEqual(a.values.uniforms, b.values.uniforms))
+		return false;
+
+	for (size_t progNdx = 0; progNdx < a.programs.size(); progNdx++)
+	{
+		const ProgramSpecification&	progA	= a.programs[progNdx];
+		const ProgramSpecification&	progB	= b.programs[progNdx];
+
+		if (progA.sources.separable != progB.sources.separable	||
+			progA.activeStages != progB.activeStages			||
+			progA.requiredExtensions.size() != progB.requiredExtensions.size())
+			return false;
+
+		for (int shaderType = 0; shaderType < SHADERTYPE_LAST; shaderType++)
+		{
+			if (progA.sources.sources[shaderType] != progB.sources.sources[shaderType])
+				return false;
+		}
+
+		for (size_t extNdx = 0; extNdx < progA.requiredExtensions.size(); extNdx++)
+		{
+			if (progA.requiredExtensions[extNdx].alternatives != progB.requiredExtensions[extNdx].alternatives ||
+				progA.requiredExtensions[extNdx].effectiveStages != progB.requiredExtensions[extNdx].effectiveStages)
+				return false;
+		}
+	}
+
+	return true;
+}
+
+bool filesEqual (const LibraryFile& a, const LibraryFile& b)
+{
+	if (a.numRootNodes != b.numRootNodes || a.sources.size() != b.sources.size() || a.nodes.size() != b.nodes.size())
+		return false;
+
+	for (size_t sourceNdx = 0; sourceNdx < a.sources.size(); sourceNdx++)
+	{
+		if (a.sources[sourceNdx].filename != b.sources[sourceNdx].filename	||
+			a.sources[sourceNdx].size != b.sources[sourceNdx].size			||
+			a.sources[sourceNdx].hash != b.sources[sourceNdx].hash)
+			return false;
+	}
+
+	for (size_t nodeNdx = 0; nodeNdx < a.nodes.size(); nodeNdx++)
+	{
+		const LibraryNode&	nodeA	= a.nodes[nodeNdx];
+		const LibraryNode&	nodeB	= b.nodes[nodeNdx];
+
+		if (nodeA.type != nodeB.type || nodeA.name != nodeB.name || nodeA.description != nodeB.description)
+			return false;
+
+		if (nodeA.type == LIBRARYNODETYPE_GROUP ? (nodeA.numChildren != nodeB.numChildren) : !casesEqual(nodeA.spec, nodeB.spec))
+			return false;
+	}
+
+	return true;
+}
+
+const char* const s_selfTestMain =
+	"import \"common.test\"\n"
+	"\n"
+	"group basic \"Basic cases\"\n"
+	"\tcase values\n"
+	"\t\tversion 300 es\n"
+	"\t\tdesc \"Inputs, outputs and uniforms\"\n"
+	"\t\tvalues\n"
+	"\t\t{\n"
+	"\t\t\tinput vec2 in0 = [ vec2(0.5, -1.0) | vec2(2.0, 3.25) ];\n"
+	"\t\t\tuniform int uni0 = [ 7 | -3 ];\n"
+	"\t\t\toutput bool out0 = [ true | false ];\n"
+	"\t\t}\n"
+	"\t\tboth \"\"\n"
+	"\t\t\t#version 300 es\n"
+	"\t\t\tprecision highp float;\n"
+	"\t\t\t${DECLARATIONS}\n"
+	"\t\t\tvoid main() { out0 = in0.x > 0.0; ${OUTPUT} }\n"
+	"\t\t\"\"\n"
+	"\tend\n"
+	"\n"
+	"\tcase compile_fail\n"
+	"\t\tversion 300 es\n"
+	"\t\texpect compile_fail\n"
+	"\t\trequire limit \"GL_MAX_VERTEX_SHADER_STORAGE_BLOCKS\" > 0\n"
+	"\t\tvertex \"\"\n"
+	"\t\t\t#version 300 es\n"
+	"\t\t\t${VERTEX_DECLARATIONS}\n"
+	"\t\t\tvoid main() { ${VERTEX_OUTPUT} }\n"
+	"\t\t\"\"\n"
+	"\t\tfragment \"\"\n"
+	"\t\t\t#version 300 es\n"
+	"\t\t\t${FRAGMENT_DECLARATIONS}\n"
+	"\t\t\tvoid main() { nope; }\n"
+	"\t\t\"\"\n"
+	"\tend\n"
+	"end\n"
+	"\n"
+	"group pipeline \"Separable programs\"\n"
+	"\tcase two_programs\n"
+	"\t\tversion 310 es\n"
+	"\t\texpect validation_fail\n"
+	"\t\tpipeline_program\n"
+	"\t\t\tactive_stages {vertex}\n"
+	"\t\t\trequire extension { \"GL_OES_shader_io_blocks\" | \"GL_EXT_shader_io_blocks\" } in { vertex }\n"
+	"\t\t\tvertex \"\"\n"
+	"\t\t\t\t#version 310 es\n"
+	"\t\t\t\t${VERTEX_DECLARATIONS}\n"
+	"\t\t\t\tvoid main() { ${VERTEX_OUTPUT} }\n"
+	"\t\t\t\"\"\n"
+	"\t\tend\n"
+	"\t\tpipeline_program\n"
+	"\t\t\tactive_stages {fragment}\n"
+	"\t\t\tfragment \"\"\n"
+	"\t\t\t\t#version 310 es\n"
+	"\t\t\t\t${FRAGMENT_DECLARATIONS}\n"
+	"\t\t\t\tvoid main() { ${FRAG_COLOR} = vec4(1.0); }\n"
+	"\t\t\t\"\"\n"
+	"\t\tend\n"
+	"\tend\n"
+	"end\n";
+
+const char* const s_selfTestCommon =
+	"case imported\n"
+	"\tversion 100 es\n"
+	"\tvalues { output float out0 = 1.5; }\n"
+	"\tboth \"\"\n"
+	"\t\tprecision mediump float;\n"
+	"\t\t${DECLARATIONS}\n"
+	"\t\tvoid main() { out0 = 1.5; ${OUTPUT} }\n"
+	"\t\"\"\n"
+	"end\n";
+
+} // anonymous
+
+void ShaderLibraryBinary_selfTest (void)
+{
+	const string	mainName	= "shaders/main.test";
+	const string	commonName	= "shaders/common.test";
+	MemoryArchive	archive;
+	LibraryFile		textFile;
+	vector<deUint8>	binary;
+
+	archive.setFile(mainName, string(s_selfTestMain));
+	archive.setFile(commonName, string(s_selfTestCommon));
+
+	parseFile(archive, mainName, textFile);
+
+	// "both" cases expand into separate vertex and fragment cases
+	DE_TEST_ASSERT(textFile.numRootNodes == 4 && textFile.nodes.size() == 8);
+	DE_TEST_ASSERT(textFile.sources.size() == 2 && textFile.sources[0].filename == mainName);
+
+	// No binary
+	{
+		LibraryFile file;
+		DE_TEST_ASSERT(!loadBinary(archive, mainName, file));
+	}
+
+	writeBinary(textFile, binary);
+
+	// Decoding binary gives same cases as text
+	{
+		LibraryFile file;
+		DE_TEST_ASSERT(readBinary(&binary[0], binary.size(), file));
+		DE_TEST_ASSERT(filesEqual(textFile, file));
+	}
+
+	// Truncated or corrupted binary is rejected
+	{
+		LibraryFile		file;
+		vector<deUint8>	corrupted	(binary);
+
+		DE_TEST_ASSERT(!readBinary(&binary[0], binary.size() - 1, file));
+
+		corrupted[8] ^= 0xffu; // version
+		DE_TEST_ASSERT(!readBinary(&corrupted[0], corrupted.size(), file));
+	}
+
+	archive.setFile(getBinaryFilename(mainName), binary);
+
+	// Up-to-date binary is loaded from archive
+	{
+		LibraryFile file;
+		DE_TEST_ASSERT(loadBinary(archive, mainName, file));
+		DE_TEST_ASSERT(filesEqual(textFile, file));
+	}
+
+	// Binary is stale if imported file changes, even if size stays same
+	{
+		string		modifiedCommon	(s_selfTestCommon);
+		LibraryFile	file;
+
+		modifiedCommon.replace(modifiedCommon.find("1.5"), 3, "2.5");
+		archive.setFile(commonName, modifiedCommon);
+
+		DE_TEST_ASSERT(!isUpToDate(archive, textFile));
+		DE_TEST_ASSERT(!loadBinary(archive, mainName, file));
+
+		archive.setFile(commonName, string(s_selfTestCommon));
+		DE_TEST_ASSERT(loadBinary(archive, mainName, file));
+	}
+
+	// Stale binary falls back to text
+	{
+		string		modifiedMain	(s_selfTestMain);
+		LibraryFile	expected;
+		LibraryFile	file;
+
+		modifiedMain.replace(modifiedMain.find("case values"), 11, "case renamed_values");
+		archive.setFile(mainName, modifiedMain);
+
+		DE_TEST_ASSERT(!loadBinary(archive, mainName, file));
+
+		{
+			MemoryArchive textOnly;
+			textOnly.setFile(mainName, modifiedMain);
+			textOnly.setFile(commonName, string(s_selfTestCommon));
+			parseFile(textOnly, mainName, expected);
+		}
+
+		{
+			// Same check as parseFile() does before creating nodes
+			if (!loadBinary(archive, mainName, file))
+				parseFile(archive, mainName, file);
+		}
+
+		DE_TEST_ASSERT(filesEqual(expected, file));
+		DE_TEST_ASSERT(!filesEqual(textFile, file));
+	}
+}
+
+} // sl
+} // glu
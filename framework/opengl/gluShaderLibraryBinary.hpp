@@ -0,0 +1,69 @@
+#ifndef _GLUSHADERLIBRARYBINARY_HPP
+#define _GLUSHADERLIBRARYBINARY_HPP
+/*-------------------------------------------------------------------------
+ * drawElements Quality Program OpenGL ES Utilities
+ * ------------------------------------------------
+ *
+ * Copyright 2019 The Android Open Source Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ *//*!
+ * \file
+ * \brief Precompiled binary format for shader .test files.
+ *
+ * Binary contains parsed test hierarchy of a .test file and all files it
+ * imports. Strings are interned into a single table and values are stored
+ * as flat blocks of 32-bit words, so loading a binary does not require
+ * tokenizing or parsing.
+ *
+ * Binary also records size and hash of each source file. Binary that
+ * does not match current sources is treated as stale and ignored.
+ *//*--------------------------------------------------------------------*/
+
+#include "gluDefs.hpp"
+#include "gluShaderLibrary.hpp"
+
+#include <string>
+#include <vector>
+
+namespace tcu
+{
+class Archive;
+}
+
+namespace glu
+{
+namespace sl
+{
+
+//! Binary file name for .test file
+std::string		getBinaryFilename	(const std::string& filename);
+
+void			writeBinary			(const LibraryFile& file, std::vector<deUint8>& dst);
+
+//! Decode binary into dst, replacing its contents. Returns false if data is not a valid binary of this version
+bool			readBinary			(const deUint8* data, size_t size, LibraryFile& dst);
+
+//! Check that sources in archive match ones recorded into file
+bool			isUpToDate			(const tcu::Archive& archive, const LibraryFile& file);
+
+//! Load binary for .test file, returns false if binary is missing, invalid or stale
+bool			loadBinary			(const tcu::Archive& archive, const std::string& filename, LibraryFile& dst);
+
+void			ShaderLibraryBinary_selfTest	(void);
+
+} // sl
+} // glu
+
+#endif // _GLUSHADERLIBRARYBINARY_HPP
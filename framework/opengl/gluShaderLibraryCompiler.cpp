@@ -0,0 +1,134 @@
+/*-------------------------------------------------------------------------
+ * drawElements Quality Program OpenGL ES Utilities
+ * ------------------------------------------------
+ *
+ * Copyright 2019 The Android Open Source Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ *//*!
+ * \file
+ * \brief Precompile shader .test files into binaries.
+ *
+ * Usage: compile-shader-library [archive dir] [path]...
+ *
+ * Paths are relative to archive dir, as used by test packages. Directories
+ * are searched recursively for .test files. Each binary is written next
+ * to its .test file. Files that fail to parse are skipped, as test
+ * packages fall back to parsing the text file.
+ *//*--------------------------------------------------------------------*/
+
+#include "gluShaderLibrary.hpp"
+#include "gluShaderLibraryBinary.hpp"
+#include "tcuResource.hpp"
+#include "deFilePath.hpp"
+#include "deDirectoryIterator.hpp"
+#include "deStringUtil.hpp"
+
+#include <vector>
+#include <string>
+#include <cstdio>
+#include <fstream>
+#include <stdexcept>
+
+using std::vector;
+using std::string;
+
+static void findTestFiles (const string& archiveDir, const string& path, vector<string>& dst)
+{
+	const de::FilePath fullPath = de::FilePath::join(archiveDir, path);
+
+	if (fullPath.getType() == de::FilePath::TYPE_DIRECTORY)
+	{
+		for (de::DirectoryIterator iter (fullPath); iter.hasItem(); iter.next())
+			findTestFiles(archiveDir, de::FilePath::join(path, iter.getItem().getBaseName()).getPath(), dst);
+	}
+	else if (de::endsWith(path, ".test"))
+		dst.push_back(path);
+}
+
+static bool compileFile (const tcu::Archive& archive, const string& archiveDir, const string& filename)
+{
+	glu::sl::LibraryFile	file;
+	vector<deUint8>			binary;
+
+	try
+	{
+		glu::sl::parseFile(archive, filename, file);
+	}
+	catch (const std::exception& e)
+	{
+		printf("Skipping %s: %s\n", filename.c_str(), e.what());
+		return false;
+	}
+
+	glu::sl::writeBinary(file, binary);
+
+	{
+		const string	dstPath	= de::FilePath::join(archiveDir, glu::sl::getBinaryFilename(filename)).getPath();
+		std::ofstream	out		(dstPath.c_str(), std::ios_base::binary);
+
+		out.write((const char*)&binary[0], (std::streamsize)binary.size());
+		out.close();
+
+		if (!out.good())
+			throw std::runtime_error("Failed to write '" + dstPath + "'");
+	}
+
+	return true;
+}
+
+static void printHelp (const char* binName)
+{
+	printf("%s: [archive dir] [path]...\n", binName);
+}
+
+int main (int argc, const char* const* argv)
+{
+	if (argc < 3)
+	{
+		printHelp(argv[0]);
+		return -1;
+	}
+
+	try
+	{
+		const string			archiveDir	= argv[1];
+		const tcu::DirArchive	archive		(archiveDir.c_str());
+		vector<string>			filenames;
+		int						numCompiled	= 0;
+
+		for (int argNdx = 2; argNdx < argc; argNdx++)
+		{
+			if (!de::FilePath::join(archiveDir, argv[argNdx]).exists())
+				throw std::runtime_error(string("'") + argv[argNdx] + "' not found in '" + archiveDir + "'");
+
+			findTestFiles(archiveDir, argv[argNdx], filenames);
+		}
+
+		for (vector<string>::const_iterator filename = filenames.begin(); filename != filenames.end(); ++filename)
+		{
+			if (compileFile(archive, archiveDir, *filename))
+				numCompiled += 1;
+		}
+
+		printf("Compiled %d of %d shader library files\n", numCompiled, (int)filenames.size());
+	}
+	catch (const std::exception& e)
+	{
+		printf("FATAL ERROR: %s\n", e.what());
+		return -1;
+	}
+
+	return 0;
+}
@@ -24,11 +24,15 @@
 #include "gluStateReset.hpp"
 #include "gluContextInfo.hpp"
 #include "gluRenderContext.hpp"
+#include "gluStateTrackingRenderContext.hpp"
 #include "tcuRenderTarget.hpp"
 #include "glwFunctions.hpp"
 #include "glwEnums.hpp"
 #include "deUniquePtr.hpp"
 
+#include <vector>
+#include <string>
+
 namespace glu
 {
 namespace
@@ -52,9 +56,352 @@ void resetErrors (const glw::Functions& gl)
 		TCU_FAIL("Couldn't reset error state");
 }
 
+inline bool needsReset (deUint32 categoryMask, StateCategory category)
+{
+	return (categoryMask & STATECATEGORY_MASK(category)) != 0;
+}
+
+typedef std::vector<float> StateValues;
+
+void getFloats (const glw::Functions& gl, deUint32 pname, int numValues, StateValues& dst)
+{
+	float values[4] = { 0.0f, 0.0f, 0.0f, 0.0f };
+
+	DE_ASSERT(numValues <= DE_LENGTH_OF_ARRAY(values));
+
+	gl.getFloatv(pname, &values[0]);
+	dst.insert(dst.end(), &values[0], &values[0] + numValues);
 }
 
-void resetStateES (const RenderContext& renderCtx, const ContextInfo& ctxInfo)
+void getFloat (const glw::Functions& gl, deUint32 pname, StateValues& dst)
+{
+	getFloats(gl, pname, 1, dst);
+}
+
+void getEnabled (const glw::Functions& gl, deUint32 cap, StateValues& dst)
+{
+	dst.push_back(gl.isEnabled(cap) ? 1.0f : 0.0f);
+}
+
+// Query a representative subset of the state reset by resetState(). Not all state in all categories is covered.
+void captureState (const RenderContext& renderCtx, StateValues* dst)
+{
+	const glw::Functions&	gl			= renderCtx.getFunctions();
+	const ContextType		type		= renderCtx.getType();
+	const bool				isES		= isContextTypeES(type);
+	const bool				isES30		= isES && contextSupports(type, ApiType::es(3,0));
+	const bool				is30		= isES30 || isContextTypeGLCore(type);
+	const bool				is31		= contextSupports(type, ApiType::es(3,1)) || contextSupports(type, ApiType::core(4,3));
+	int						numAttribs	= 0;
+
+	gl.getIntegerv(GL_MAX_VERTEX_ATTRIBS, &numAttribs);
+
+	// Vertex array state. Array state of the default vertex array object only exists in ES.
+	{
+		StateValues& values = dst[STATECATEGORY_VERTEX_ARRAY];
+
+		getFloat(gl, GL_ARRAY_BUFFER_BINDING,			values);
+		getFloat(gl, GL_ELEMENT_ARRAY_BUFFER_BINDING,	values);
+
+		if (is30)
+			getFloat(gl, GL_VERTEX_ARRAY_BINDING, values);
+
+		if (is31)
+			getFloat(gl, GL_DRAW_INDIRECT_BUFFER_BINDING, values);
+
+		if (isES)
+		{
+			static const deUint32 attribParams[] =
+			{
+				GL_VERTEX_ATTRIB_ARRAY_ENABLED,
+				GL_VERTEX_ATTRIB_ARRAY_SIZE,
+				GL_VERTEX_ATTRIB_ARRAY_TYPE,
+				GL_VERTEX_ATTRIB_ARRAY_STRIDE,
+				GL_VERTEX_ATTRIB_ARRAY_NORMALIZED,
+				GL_VERTEX_ATTRIB_ARRAY_BUFFER_BINDING,
+				GL_VERTEX_ATTRIB_ARRAY_DIVISOR,
+			};
+			const int numParams = isES30 ? DE_LENGTH_OF_ARRAY(attribParams) : DE_LENGTH_OF_ARRAY(attribParams) - 1;
+
+			for (int attribNdx = 0; attribNdx < numAttribs; attribNdx++)
+			for (int paramNdx = 0; paramNdx < numParams; paramNdx++)
+			{
+				float value = 0.0f;
+				gl.getVertexAttribfv(attribNdx, attribParams[paramNdx], &value);
+				values.push_back(value);
+			}
+		}
+	}
+
+	// Transformation state.
+	{
+		StateValues& values = dst[STATECATEGORY_TRANSFORMATION];
+
+		getFloats(gl, GL_VIEWPORT,		4, values);
+		getFloats(gl, GL_DEPTH_RANGE,	2, values);
+
+		if (is30)
+			getFloat(gl, GL_TRANSFORM_FEEDBACK_BINDING, values);
+	}
+
+	// Rasterization state.
+	{
+		StateValues& values = dst[STATECATEGORY_RASTERIZATION];
+
+		getFloat	(gl, GL_LINE_WIDTH,				values);
+		getEnabled	(gl, GL_CULL_FACE,				values);
+		getFloat	(gl, GL_CULL_FACE_MODE,			values);
+		getFloat	(gl, GL_FRONT_FACE,				values);
+		getFloat	(gl, GL_POLYGON_OFFSET_FACTOR,	values);
+		getFloat	(gl, GL_POLYGON_OFFSET_UNITS,	values);
+		getEnabled	(gl, GL_POLYGON_OFFSET_FILL,	values);
+
+		if (is30)
+			getEnabled(gl, GL_RASTERIZER_DISCARD, values);
+	}
+
+	// Multisampling state.
+	{
+		StateValues& values = dst[STATECATEGORY_MULTISAMPLE];
+
+		getEnabled	(gl, GL_SAMPLE_ALPHA_TO_COVERAGE,	values);
+		getEnabled	(gl, GL_SAMPLE_COVERAGE,			values);
+		getFloat	(gl, GL_SAMPLE_COVERAGE_VALUE,		values);
+		getFloat	(gl, GL_SAMPLE_COVERAGE_INVERT,		values);
+
+		if (is31)
+			getEnabled(gl, GL_SAMPLE_MASK, values);
+	}
+
+	// Texture unit bindings.
+	{
+		StateValues&	values			= dst[STATECATEGORY_TEXTURE];
+		int				activeTexture	= 0;
+		int				numTexUnits		= 0;
+
+		gl.getIntegerv(GL_ACTIVE_TEXTURE,						&activeTexture);
+		gl.getIntegerv(GL_MAX_COMBINED_TEXTURE_IMAGE_UNITS,	&numTexUnits);
+
+		values.push_back((float)activeTexture);
+
+		for (int unitNdx = 0; unitNdx < numTexUnits; unitNdx++)
+		{
+			gl.activeTexture(GL_TEXTURE0 + unitNdx);
+
+			getFloat(gl, GL_TEXTURE_BINDING_2D,			values);
+			getFloat(gl, GL_TEXTURE_BINDING_CUBE_MAP,	values);
+
+			if (is30)
+			{
+				getFloat(gl, GL_TEXTURE_BINDING_2D_ARRAY,	values);
+				getFloat(gl, GL_TEXTURE_BINDING_3D,			values);
+				getFloat(gl, GL_SAMPLER_BINDING,			values);
+			}
+		}
+
+		gl.activeTexture((deUint32)activeTexture);
+	}
+
+	// Pixel operations.
+	{
+		StateValues&			values			= dst[STATECATEGORY_PIXEL_OPERATIONS];
+		static const deUint32	params[]		=
+		{
+			GL_STENCIL_FUNC,
+			GL_STENCIL_REF,
+			GL_STENCIL_VALUE_MASK,
+			GL_STENCIL_FAIL,
+			GL_STENCIL_PASS_DEPTH_FAIL,
+			GL_STENCIL_PASS_DEPTH_PASS,
+			GL_STENCIL_BACK_FUNC,
+			GL_STENCIL_BACK_REF,
+			GL_STENCIL_BACK_VALUE_MASK,
+			GL_STENCIL_BACK_FAIL,
+			GL_STENCIL_BACK_PASS_DEPTH_FAIL,
+			GL_STENCIL_BACK_PASS_DEPTH_PASS,
+			GL_DEPTH_FUNC,
+			GL_BLEND_SRC_RGB,
+			GL_BLEND_DST_RGB,
+			GL_BLEND_SRC_ALPHA,
+			GL_BLEND_DST_ALPHA,
+			GL_BLEND_EQUATION_RGB,
+			GL_BLEND_EQUATION_ALPHA,
+		};
+		static const deUint32	caps[]			=
+		{
+			GL_SCISSOR_TEST,
+			GL_STENCIL_TEST,
+			GL_DEPTH_TEST,
+			GL_BLEND,
+			GL_DITHER,
+		};
+
+		for (int ndx = 0; ndx < DE_LENGTH_OF_ARRAY(params); ndx++)
+			getFloat(gl, params[ndx], values);
+
+		for (int ndx = 0; ndx < DE_LENGTH_OF_ARRAY(caps); ndx++)
+			getEnabled(gl, caps[ndx], values);
+
+		getFloats(gl, GL_SCISSOR_BOX,	4, values);
+		getFloats(gl, GL_BLEND_COLOR,	4, values);
+	}
+
+	// Framebuffer control.
+	{
+		StateValues& values = dst[STATECATEGORY_FRAMEBUFFER_CONTROL];
+
+		getFloats	(gl, GL_COLOR_WRITEMASK,		4, values);
+		getFloat	(gl, GL_DEPTH_WRITEMASK,		values);
+		getFloat	(gl, GL_STENCIL_WRITEMASK,		values);
+		getFloat	(gl, GL_STENCIL_BACK_WRITEMASK,	values);
+		getFloats	(gl, GL_COLOR_CLEAR_VALUE,		4, values);
+		getFloat	(gl, GL_DEPTH_CLEAR_VALUE,		values);
+		getFloat	(gl, GL_STENCIL_CLEAR_VALUE,	values);
+	}
+
+	// Framebuffer state.
+	{
+		StateValues& values = dst[STATECATEGORY_FRAMEBUFFER];
+
+		getFloat(gl, GL_FRAMEBUFFER_BINDING, values);
+
+		if (is30)
+		{
+			getFloat(gl, GL_READ_FRAMEBUFFER_BINDING,	values);
+			getFloat(gl, GL_READ_BUFFER,				values);
+			getFloat(gl, GL_DRAW_BUFFER0,				values);
+		}
+	}
+
+	// Renderbuffer state.
+	getFloat(gl, GL_RENDERBUFFER_BINDING, dst[STATECATEGORY_RENDERBUFFER]);
+
+	// Pixel transfer state.
+	{
+		StateValues& values = dst[STATECATEGORY_PIXEL_TRANSFER];
+
+		getFloat(gl, GL_UNPACK_ALIGNMENT,	values);
+		getFloat(gl, GL_PACK_ALIGNMENT,		values);
+
+		if (is30)
+		{
+			getFloat(gl, GL_UNPACK_ROW_LENGTH,				values);
+			getFloat(gl, GL_UNPACK_IMAGE_HEIGHT,			values);
+			getFloat(gl, GL_UNPACK_SKIP_ROWS,				values);
+			getFloat(gl, GL_UNPACK_SKIP_PIXELS,				values);
+			getFloat(gl, GL_UNPACK_SKIP_IMAGES,				values);
+			getFloat(gl, GL_PACK_ROW_LENGTH,				values);
+			getFloat(gl, GL_PACK_SKIP_ROWS,					values);
+			getFloat(gl, GL_PACK_SKIP_PIXELS,				values);
+			getFloat(gl, GL_PIXEL_PACK_BUFFER_BINDING,		values);
+			getFloat(gl, GL_PIXEL_UNPACK_BUFFER_BINDING,	values);
+		}
+	}
+
+	// Program object state.
+	{
+		StateValues& values = dst[STATECATEGORY_PROGRAM];
+
+		getFloat(gl, GL_CURRENT_PROGRAM, values);
+
+		if (is30)
+			getFloat(gl, GL_UNIFORM_BUFFER_BINDING, values);
+
+		if (is31)
+		{
+			getFloat(gl, GL_PROGRAM_PIPELINE_BINDING,			values);
+			getFloat(gl, GL_ATOMIC_COUNTER_BUFFER_BINDING,		values);
+			getFloat(gl, GL_SHADER_STORAGE_BUFFER_BINDING,		values);
+		}
+	}
+
+	// Generic vertex attribute values. Not queryable without a vertex array object in core profile.
+	if (isES)
+	{
+		StateValues& values = dst[STATECATEGORY_VERTEX_SHADER];
+
+		for (int attribNdx = 0; attribNdx < numAttribs; attribNdx++)
+		{
+			float value[4] = { 0.0f, 0.0f, 0.0f, 0.0f };
+			gl.getVertexAttribfv(attribNdx, GL_CURRENT_VERTEX_ATTRIB, &value[0]);
+			values.insert(values.end(), &value[0], &value[0] + DE_LENGTH_OF_ARRAY(value));
+		}
+	}
+
+	// Transform feedback state.
+	if (is30)
+	{
+		StateValues& values = dst[STATECATEGORY_TRANSFORM_FEEDBACK];
+
+		getFloat(gl, GL_TRANSFORM_FEEDBACK_BUFFER_BINDING, values);
+
+		if (isES30)
+			getFloat(gl, GL_TRANSFORM_FEEDBACK_ACTIVE, values);
+	}
+
+	// Hints.
+	{
+		StateValues& values = dst[STATECATEGORY_HINT];
+
+		if (isES)
+			getFloat(gl, GL_GENERATE_MIPMAP_HINT, values);
+
+		if (is30)
+			getFloat(gl, GL_FRAGMENT_SHADER_DERIVATIVE_HINT, values);
+	}
+
+	// Buffer copy and dispatch state.
+	{
+		StateValues& values = dst[STATECATEGORY_BUFFER_BINDING];
+
+		if (is30)
+		{
+			getFloat(gl, GL_COPY_READ_BUFFER_BINDING,	values);
+			getFloat(gl, GL_COPY_WRITE_BUFFER_BINDING,	values);
+		}
+
+		if (is31)
+			getFloat(gl, GL_DISPATCH_INDIRECT_BUFFER_BINDING, values);
+	}
+
+	GLU_EXPECT_NO_ERROR(gl.getError(), "State query failed");
+}
+
+} // anonymous
+
+const char* getStateCategoryName (StateCategory category)
+{
+	static const char* const s_names[] =
+	{
+		"vertex array",
+		"transformation",
+		"rasterization",
+		"multisample",
+		"texture",
+		"pixel operations",
+		"framebuffer control",
+		"framebuffer",
+		"renderbuffer",
+		"pixel transfer",
+		"program",
+		"vertex shader",
+		"transform feedback",
+		"query",
+		"hint",
+		"buffer binding",
+		"image",
+		"sample shading",
+		"debug",
+		"primitive",
+	};
+
+	DE_STATIC_ASSERT(DE_LENGTH_OF_ARRAY(s_names) == STATECATEGORY_LAST);
+	DE_ASSERT(de::inBounds<int>(category, 0, STATECATEGORY_LAST));
+
+	return s_names[category];
+}
+
+void resetStateES (const RenderContext& renderCtx, const ContextInfo& ctxInfo, deUint32 categoryMask)
 {
 	const glw::Functions&	gl	= renderCtx.getFunctions();
 	const ContextType		type	= renderCtx.getType();
@@ -65,6 +412,7 @@ void resetStateES (const RenderContext& renderCtx, const ContextInfo& ctxInfo)
 	DE_ASSERT(isContextTypeES(type));
 
 	// Vertex attrib array state.
+	if (needsReset(categoryMask, STATECATEGORY_VERTEX_ARRAY))
 	{
 		int numVertexAttribArrays = 0;
 		gl.getIntegerv(GL_MAX_VERTEX_ATTRIBS, &numVertexAttribArrays);
@@ -94,6 +442,7 @@ void resetStateES (const RenderContext& renderCtx, const ContextInfo& ctxInfo)
 	}
 
 	// Transformation state.
+	if (needsReset(categoryMask, STATECATEGORY_TRANSFORMATION))
 	{
 		const tcu::RenderTarget& renderTarget = renderCtx.getRenderTarget();
 
@@ -107,6 +456,7 @@ void resetStateES (const RenderContext& renderCtx, const ContextInfo& ctxInfo)
 	}
 
 	// Rasterization state
+	if (needsReset(categoryMask, STATECATEGORY_RASTERIZATION))
 	{
 		gl.lineWidth	(1.0f);
 		gl.disable		(GL_CULL_FACE);
@@ -122,6 +472,7 @@ void resetStateES (const RenderContext& renderCtx, const ContextInfo& ctxInfo)
 	}
 
 	// Multisampling state
+	if (needsReset(categoryMask, STATECATEGORY_MULTISAMPLE))
 	{
 		gl.disable			(GL_SAMPLE_ALPHA_TO_COVERAGE);
 		gl.disable			(GL_SAMPLE_COVERAGE);
@@ -143,6 +494,7 @@ void resetStateES (const RenderContext& renderCtx, const ContextInfo& ctxInfo)
 
 	// Texture state.
 	// \todo [2013-04-08 pyry] Reset all levels?
+	if (needsReset(categoryMask, STATECATEGORY_TEXTURE))
 	{
 		const float	borderColor[]		= { 0.0f, 0.0f, 0.0f, 0.0f };
 		int			numTexUnits			= 0;
@@ -331,7 +683,7 @@ void resetStateES (const RenderContext& renderCtx, const ContextInfo& ctxInfo)
 	// Resetting state using non-indexed variants should be enough, but some
 	// implementations have bugs so we need to make sure indexed state gets
 	// set back to initial values.
-	if (ctxInfo.isExtensionSupported("GL_EXT_draw_buffers_indexed"))
+	if (needsReset(categoryMask, STATECATEGORY_PIXEL_OPERATIONS) && ctxInfo.isExtensionSupported("GL_EXT_draw_buffers_indexed"))
 	{
 		int numDrawBuffers = 0;
 
@@ -349,6 +701,7 @@ void resetStateES (const RenderContext& renderCtx, const ContextInfo& ctxInfo)
 	}
 
 	// Pixel operations.
+	if (needsReset(categoryMask, STATECATEGORY_PIXEL_OPERATIONS))
 	{
 		const tcu::RenderTarget& renderTarget = renderCtx.getRenderTarget();
 
@@ -378,6 +731,7 @@ void resetStateES (const RenderContext& renderCtx, const ContextInfo& ctxInfo)
 	}
 
 	// Framebuffer control.
+	if (needsReset(categoryMask, STATECATEGORY_FRAMEBUFFER_CONTROL))
 	{
 		gl.colorMask		(GL_TRUE, GL_TRUE, GL_TRUE, GL_TRUE);
 		gl.depthMask		(GL_TRUE);
@@ -391,6 +745,7 @@ void resetStateES (const RenderContext& renderCtx, const ContextInfo& ctxInfo)
 	}
 
 	// Framebuffer state.
+	if (needsReset(categoryMask, STATECATEGORY_FRAMEBUFFER))
 	{
 		// \note Actually spec explictly says 0 but on some platforms (iOS) no default framebuffer exists.
 		const deUint32		defaultFbo		= renderCtx.getDefaultFramebuffer();
@@ -418,12 +773,14 @@ void resetStateES (const RenderContext& renderCtx, const ContextInfo& ctxInfo)
 	}
 
 	// Renderbuffer state.
+	if (needsReset(categoryMask, STATECATEGORY_RENDERBUFFER))
 	{
 		gl.bindRenderbuffer(GL_RENDERBUFFER, 0);
 		GLU_EXPECT_NO_ERROR(gl.getError(), "Renderbuffer state reset failed");
 	}
 
 	// Pixel transfer state.
+	if (needsReset(categoryMask, STATECATEGORY_PIXEL_TRANSFER))
 	{
 		gl.pixelStorei(GL_UNPACK_ALIGNMENT,		4);
 		gl.pixelStorei(GL_PACK_ALIGNMENT,		4);
@@ -448,6 +805,7 @@ void resetStateES (const RenderContext& renderCtx, const ContextInfo& ctxInfo)
 	}
 
 	// Program object state.
+	if (needsReset(categoryMask, STATECATEGORY_PROGRAM))
 	{
 		gl.useProgram(0);
 
@@ -488,6 +846,7 @@ void resetStateES (const RenderContext& renderCtx, const ContextInfo& ctxInfo)
 	}
 
 	// Vertex shader state.
+	if (needsReset(categoryMask, STATECATEGORY_VERTEX_SHADER))
 	{
 		int numVertexAttribArrays = 0;
 		gl.getIntegerv(GL_MAX_VERTEX_ATTRIBS, &numVertexAttribArrays);
@@ -499,7 +858,7 @@ void resetStateES (const RenderContext& renderCtx, const ContextInfo& ctxInfo)
 	}
 
 	// Transform feedback state.
-	if (contextSupports(type, ApiType::es(3,0)))
+	if (needsReset(categoryMask, STATECATEGORY_TRANSFORM_FEEDBACK) && contextSupports(type, ApiType::es(3,0)))
 	{
 		int				numTransformFeedbackSeparateAttribs	= 0;
 		glw::GLboolean	transformFeedbackActive				= 0;
@@ -518,7 +877,7 @@ void resetStateES (const RenderContext& renderCtx, const ContextInfo& ctxInfo)
 	}
 
 	// Asynchronous query state.
-	if (contextSupports(type, ApiType::es(3,0)))
+	if (needsReset(categoryMask, STATECATEGORY_QUERY) && contextSupports(type, ApiType::es(3,0)))
 	{
 		static const deUint32 targets[] = { GL_ANY_SAMPLES_PASSED, GL_ANY_SAMPLES_PASSED_CONSERVATIVE, GL_TRANSFORM_FEEDBACK_PRIMITIVES_WRITTEN };
 
@@ -535,6 +894,7 @@ void resetStateES (const RenderContext& renderCtx, const ContextInfo& ctxInfo)
 	}
 
 	// Hints.
+	if (needsReset(categoryMask, STATECATEGORY_HINT))
 	{
 		gl.hint(GL_GENERATE_MIPMAP_HINT, GL_DONT_CARE);
 
@@ -545,14 +905,14 @@ void resetStateES (const RenderContext& renderCtx, const ContextInfo& ctxInfo)
 	}
 
 	// Compute.
-	if (contextSupports(type, ApiType::es(3,1)))
+	if (needsReset(categoryMask, STATECATEGORY_BUFFER_BINDING) && contextSupports(type, ApiType::es(3,1)))
 	{
 		gl.bindBuffer(GL_DISPATCH_INDIRECT_BUFFER, 0);
 		GLU_EXPECT_NO_ERROR(gl.getError(), "Compute dispatch state reset failed");
 	}
 
 	// Buffer copy state.
-	if (contextSupports(type, ApiType::es(3,0)))
+	if (needsReset(categoryMask, STATECATEGORY_BUFFER_BINDING) && contextSupports(type, ApiType::es(3,0)))
 	{
 		gl.bindBuffer(GL_COPY_READ_BUFFER,	0);
 		gl.bindBuffer(GL_COPY_WRITE_BUFFER,	0);
@@ -561,7 +921,7 @@ void resetStateES (const RenderContext& renderCtx, const ContextInfo& ctxInfo)
 	}
 
 	// Images.
-	if (contextSupports(type, ApiType::es(3,1)))
+	if (needsReset(categoryMask, STATECATEGORY_IMAGE) && contextSupports(type, ApiType::es(3,1)))
 	{
 		int numImageUnits = 0;
 		gl.getIntegerv(GL_MAX_IMAGE_UNITS, &numImageUnits);
@@ -573,7 +933,7 @@ void resetStateES (const RenderContext& renderCtx, const ContextInfo& ctxInfo)
 	}
 
 	// Sample shading state.
-	if (contextSupports(type, ApiType::es(3,1)) && ctxInfo.isExtensionSupported("GL_OES_sample_shading"))
+	if (needsReset(categoryMask, STATECATEGORY_SAMPLE_SHADING) && contextSupports(type, ApiType::es(3,1)) && ctxInfo.isExtensionSupported("GL_OES_sample_shading"))
 	{
 		gl.minSampleShading(0.0f);
 		gl.disable(GL_SAMPLE_SHADING);
@@ -582,7 +942,7 @@ void resetStateES (const RenderContext& renderCtx, const ContextInfo& ctxInfo)
 	}
 
 	// Debug state
-	if (ctxInfo.isExtensionSupported("GL_KHR_debug"))
+	if (needsReset(categoryMask, STATECATEGORY_DEBUG) && ctxInfo.isExtensionSupported("GL_KHR_debug"))
 	{
 		const bool entrypointsPresent =	gl.debugMessageControl	!= DE_NULL	&&
 										gl.debugMessageCallback	!= DE_NULL	&&
@@ -611,28 +971,28 @@ void resetStateES (const RenderContext& renderCtx, const ContextInfo& ctxInfo)
 	}
 
 	// Primitive bounding box state.
-	if (ctxInfo.isExtensionSupported("GL_EXT_primitive_bounding_box"))
+	if (needsReset(categoryMask, STATECATEGORY_PRIMITIVE) && ctxInfo.isExtensionSupported("GL_EXT_primitive_bounding_box"))
 	{
 		gl.primitiveBoundingBox(-1.0f, -1.0f, -1.0f, 1.0f, 1.0f, 1.0f, 1.0f, 1.0f);
 		GLU_EXPECT_NO_ERROR(gl.getError(), "Primitive bounding box state reset failed");
 	}
 
 	// Tessellation state
-	if (ctxInfo.isExtensionSupported("GL_EXT_tessellation_shader"))
+	if (needsReset(categoryMask, STATECATEGORY_PRIMITIVE) && ctxInfo.isExtensionSupported("GL_EXT_tessellation_shader"))
 	{
 		gl.patchParameteri(GL_PATCH_VERTICES, 3);
 		GLU_EXPECT_NO_ERROR(gl.getError(), "Tessellation patch vertices state reset failed");
 	}
 
 	// Advanced coherent blending
-	if (ctxInfo.isExtensionSupported("GL_KHR_blend_equation_advanced_coherent"))
+	if (needsReset(categoryMask, STATECATEGORY_PIXEL_OPERATIONS) && ctxInfo.isExtensionSupported("GL_KHR_blend_equation_advanced_coherent"))
 	{
 		gl.enable(GL_BLEND_ADVANCED_COHERENT_KHR);
 		GLU_EXPECT_NO_ERROR(gl.getError(), "Blend equation advanced coherent state reset failed");
 	}
 
 	// Texture buffer
-	if (ctxInfo.isExtensionSupported("GL_EXT_texture_buffer"))
+	if (needsReset(categoryMask, STATECATEGORY_TEXTURE) && ctxInfo.isExtensionSupported("GL_EXT_texture_buffer"))
 	{
 		gl.bindTexture(GL_TEXTURE_BUFFER, 0);
 		gl.bindBuffer(GL_TEXTURE_BUFFER, 0);
@@ -640,7 +1000,7 @@ void resetStateES (const RenderContext& renderCtx, const ContextInfo& ctxInfo)
 	}
 }
 
-void resetStateGLCore (const RenderContext& renderCtx, const ContextInfo& ctxInfo)
+void resetStateGLCore (const RenderContext& renderCtx, const ContextInfo& ctxInfo, deUint32 categoryMask)
 {
 	const glw::Functions&	gl		= renderCtx.getFunctions();
 	const ContextType		type	= renderCtx.getType();
@@ -649,6 +1009,7 @@ void resetStateGLCore (const RenderContext& renderCtx, const ContextInfo& ctxInf
 	resetErrors(gl);
 
 	// Primitives and vertices state
+	if (needsReset(categoryMask, STATECATEGORY_PRIMITIVE))
 	{
 		if (contextSupports(type, glu::ApiType::core(4, 0)))
 		{
@@ -662,6 +1023,7 @@ void resetStateGLCore (const RenderContext& renderCtx, const ContextInfo& ctxInf
 	}
 
 	// Vertex attrib array state.
+	if (needsReset(categoryMask, STATECATEGORY_VERTEX_ARRAY))
 	{
 		gl.bindVertexArray	(0);
 		gl.bindBuffer		(GL_ARRAY_BUFFER,			0);
@@ -677,6 +1039,7 @@ void resetStateGLCore (const RenderContext& renderCtx, const ContextInfo& ctxInf
 	}
 
 	// Transformation state.
+	if (needsReset(categoryMask, STATECATEGORY_TRANSFORMATION))
 	{
 		const tcu::RenderTarget&	renderTarget		= renderCtx.getRenderTarget();
 		int							numUserClipPlanes	= 0;
@@ -698,6 +1061,7 @@ void resetStateGLCore (const RenderContext& renderCtx, const ContextInfo& ctxInf
 	}
 
 	// Coloring
+	if (needsReset(categoryMask, STATECATEGORY_RASTERIZATION))
 	{
 		gl.clampColor(GL_CLAMP_READ_COLOR, GL_FIXED_ONLY);
 
@@ -708,6 +1072,7 @@ void resetStateGLCore (const RenderContext& renderCtx, const ContextInfo& ctxInf
 	}
 
 	// Rasterization state
+	if (needsReset(categoryMask, STATECATEGORY_RASTERIZATION))
 	{
 		gl.disable			(GL_RASTERIZER_DISCARD);
 		gl.pointSize		(1.0f);
@@ -728,6 +1093,7 @@ void resetStateGLCore (const RenderContext& renderCtx, const ContextInfo& ctxInf
 	}
 
 	// Multisampling state
+	if (needsReset(categoryMask, STATECATEGORY_MULTISAMPLE))
 	{
 		gl.enable			(GL_MULTISAMPLE);
 		gl.disable			(GL_SAMPLE_ALPHA_TO_COVERAGE);
@@ -751,6 +1117,7 @@ void resetStateGLCore (const RenderContext& renderCtx, const ContextInfo& ctxInf
 
 	// Texture state.
 	// \todo [2013-04-08 pyry] Reset all levels?
+	if (needsReset(categoryMask, STATECATEGORY_TEXTURE))
 	{
 		const float	borderColor[]	= { 0.0f, 0.0f, 0.0f, 0.0f };
 		int			numTexUnits		= 0;
@@ -966,6 +1333,7 @@ void resetStateGLCore (const RenderContext& renderCtx, const ContextInfo& ctxInf
 	}
 
 	// Pixel operations.
+	if (needsReset(categoryMask, STATECATEGORY_PIXEL_OPERATIONS))
 	{
 		const tcu::RenderTarget& renderTarget = renderCtx.getRenderTarget();
 
@@ -994,6 +1362,7 @@ void resetStateGLCore (const RenderContext& renderCtx, const ContextInfo& ctxInf
 	}
 
 	// Framebuffer control.
+	if (needsReset(categoryMask, STATECATEGORY_FRAMEBUFFER_CONTROL))
 	{
 		gl.colorMask		(GL_TRUE, GL_TRUE, GL_TRUE, GL_TRUE);
 		gl.depthMask		(GL_TRUE);
@@ -1007,6 +1376,7 @@ void resetStateGLCore (const RenderContext& renderCtx, const ContextInfo& ctxInf
 	}
 
 	// Framebuffer state.
+	if (needsReset(categoryMask, STATECATEGORY_FRAMEBUFFER))
 	{
 		const deUint32	framebuffer	= renderCtx.getDefaultFramebuffer();
 
@@ -1037,12 +1407,14 @@ void resetStateGLCore (const RenderContext& renderCtx, const ContextInfo& ctxInf
 	}
 
 	// Renderbuffer state.
+	if (needsReset(categoryMask, STATECATEGORY_RENDERBUFFER))
 	{
 		gl.bindRenderbuffer(GL_RENDERBUFFER, 0);
 		GLU_EXPECT_NO_ERROR(gl.getError(), "Renderbuffer state reset failed");
 	}
 
 	// Pixel transfer state.
+	if (needsReset(categoryMask, STATECATEGORY_PIXEL_TRANSFER))
 	{
 		gl.pixelStorei	(GL_UNPACK_SWAP_BYTES,		GL_FALSE);
 		gl.pixelStorei	(GL_UNPACK_LSB_FIRST,		GL_FALSE);
@@ -1069,6 +1441,7 @@ void resetStateGLCore (const RenderContext& renderCtx, const ContextInfo& ctxInf
 	}
 
 	// Program object state.
+	if (needsReset(categoryMask, STATECATEGORY_PROGRAM))
 	{
 		gl.useProgram(0);
 
@@ -1087,6 +1460,7 @@ void resetStateGLCore (const RenderContext& renderCtx, const ContextInfo& ctxInf
 	}
 
 	// Vertex shader state.
+	if (needsReset(categoryMask, STATECATEGORY_VERTEX_SHADER))
 	{
 		int numVertexAttribArrays = 0;
 		gl.getIntegerv(GL_MAX_VERTEX_ATTRIBS, &numVertexAttribArrays);
@@ -1100,6 +1474,7 @@ void resetStateGLCore (const RenderContext& renderCtx, const ContextInfo& ctxInf
 	}
 
 	// Transform feedback state.
+	if (needsReset(categoryMask, STATECATEGORY_TRANSFORM_FEEDBACK))
 	{
 		int numTransformFeedbackSeparateAttribs = 0;
 		gl.getIntegerv(GL_MAX_TRANSFORM_FEEDBACK_SEPARATE_ATTRIBS, &numTransformFeedbackSeparateAttribs);
@@ -1122,6 +1497,7 @@ void resetStateGLCore (const RenderContext& renderCtx, const ContextInfo& ctxInf
 	}
 
 	// Asynchronous query state.
+	if (needsReset(categoryMask, STATECATEGORY_QUERY))
 	{
 		deUint32	queryTargets[8];
 		int			numTargets		= 0;
@@ -1145,6 +1521,7 @@ void resetStateGLCore (const RenderContext& renderCtx, const ContextInfo& ctxInf
 	}
 
 	// Hints.
+	if (needsReset(categoryMask, STATECATEGORY_HINT))
 	{
 		gl.hint(GL_LINE_SMOOTH_HINT,				GL_DONT_CARE);
 		gl.hint(GL_POLYGON_SMOOTH_HINT,				GL_DONT_CARE);
@@ -1155,7 +1532,7 @@ void resetStateGLCore (const RenderContext& renderCtx, const ContextInfo& ctxInf
 	}
 
 	// Buffer copy state.
-	if (contextSupports(type, ApiType::core(3,1)))
+	if (needsReset(categoryMask, STATECATEGORY_BUFFER_BINDING) && contextSupports(type, ApiType::core(3,1)))
 	{
 		gl.bindBuffer(GL_COPY_READ_BUFFER,	0);
 		gl.bindBuffer(GL_COPY_WRITE_BUFFER,	0);
@@ -1164,7 +1541,7 @@ void resetStateGLCore (const RenderContext& renderCtx, const ContextInfo& ctxInf
 	}
 
 	// Debug state
-	if (ctxInfo.isExtensionSupported("GL_KHR_debug"))
+	if (needsReset(categoryMask, STATECATEGORY_DEBUG) && ctxInfo.isExtensionSupported("GL_KHR_debug"))
 	{
 		const bool entrypointsPresent =	gl.debugMessageControl	!= DE_NULL	&&
 										gl.debugMessageCallback	!= DE_NULL;
@@ -1184,14 +1561,51 @@ void resetStateGLCore (const RenderContext& renderCtx, const ContextInfo& ctxInf
 	}
 }
 
-void resetState (const RenderContext& renderCtx, const ContextInfo& ctxInfo)
+void resetState (const RenderContext& renderCtx, const ContextInfo& ctxInfo, deUint32 categoryMask)
 {
 	if (isContextTypeES(renderCtx.getType()))
-		resetStateES(renderCtx, ctxInfo);
+		resetStateES(renderCtx, ctxInfo, categoryMask);
 	else if (isContextTypeGLCore(renderCtx.getType()))
-		resetStateGLCore(renderCtx, ctxInfo);
+		resetStateGLCore(renderCtx, ctxInfo, categoryMask);
 	else
 		throw tcu::InternalError("State reset requested for unsupported context type");
 }
 
+void resetState (const RenderContext& renderCtx, const ContextInfo& ctxInfo)
+{
+	const StateTrackingRenderContext* const trackingCtx = dynamic_cast<const StateTrackingRenderContext*>(&renderCtx);
+
+	if (trackingCtx)
+		trackingCtx->resetState(ctxInfo);
+	else
+		resetState(renderCtx, ctxInfo, STATECATEGORY_MASK_ALL);
+}
+
+void resetAndVerifyState (const RenderContext& renderCtx, const ContextInfo& ctxInfo, deUint32 categoryMask)
+{
+	StateValues	partialResetState	[STATECATEGORY_LAST];
+	StateValues	fullResetState		[STATECATEGORY_LAST];
+	std::string	mismatches;
+
+	resetState(renderCtx, ctxInfo, categoryMask);
+	captureState(renderCtx, partialResetState);
+
+	resetState(renderCtx, ctxInfo, STATECATEGORY_MASK_ALL);
+	captureState(renderCtx, fullResetState);
+
+	for (int categoryNdx = 0; categoryNdx < STATECATEGORY_LAST; categoryNdx++)
+	{
+		if (partialResetState[categoryNdx] != fullResetState[categoryNdx])
+		{
+			if (!mismatches.empty())
+				mismatches += ", ";
+
+			mismatches += getStateCategoryName((StateCategory)categoryNdx);
+		}
+	}
+
+	if (!mismatches.empty())
+		throw tcu::InternalError("State modified without being tracked: " + mismatches);
+}
+
 } // glu
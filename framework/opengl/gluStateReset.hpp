@@ -31,7 +31,52 @@ namespace glu
 class RenderContext;
 class ContextInfo;
 
-void resetState (const RenderContext& renderCtx, const ContextInfo& ctxInfo);
+/*--------------------------------------------------------------------*//*!
+ * \brief Groups of GL state restored together by resetState()
+ *//*--------------------------------------------------------------------*/
+enum StateCategory
+{
+	STATECATEGORY_VERTEX_ARRAY = 0,		//!< Vertex array object, attrib arrays, array and index buffers
+	STATECATEGORY_TRANSFORMATION,		//!< Viewport, depth range, clip distances
+	STATECATEGORY_RASTERIZATION,		//!< Culling, polygon offset, line width, point parameters
+	STATECATEGORY_MULTISAMPLE,			//!< Sample coverage and sample mask
+	STATECATEGORY_TEXTURE,				//!< Texture units, default textures and samplers
+	STATECATEGORY_PIXEL_OPERATIONS,		//!< Scissor, stencil, depth and blend tests
+	STATECATEGORY_FRAMEBUFFER_CONTROL,	//!< Write masks and clear values
+	STATECATEGORY_FRAMEBUFFER,			//!< Framebuffer binding, draw and read buffers
+	STATECATEGORY_RENDERBUFFER,			//!< Renderbuffer binding
+	STATECATEGORY_PIXEL_TRANSFER,		//!< Pixel store parameters and pixel buffers
+	STATECATEGORY_PROGRAM,				//!< Current program, pipeline and indexed program buffer bindings
+	STATECATEGORY_VERTEX_SHADER,		//!< Generic vertex attribute values
+	STATECATEGORY_TRANSFORM_FEEDBACK,	//!< Active transform feedback and its buffer bindings
+	STATECATEGORY_QUERY,				//!< Active queries
+	STATECATEGORY_HINT,					//!< Hints
+	STATECATEGORY_BUFFER_BINDING,		//!< Copy and dispatch indirect buffer bindings
+	STATECATEGORY_IMAGE,				//!< Image unit bindings
+	STATECATEGORY_SAMPLE_SHADING,		//!< Sample shading
+	STATECATEGORY_DEBUG,				//!< Debug output and debug groups
+	STATECATEGORY_PRIMITIVE,			//!< Patch parameters and primitive bounding box
+
+	STATECATEGORY_LAST
+};
+
+#define STATECATEGORY_MASK(CATEGORY) (1u << (CATEGORY))
+
+enum
+{
+	STATECATEGORY_MASK_ALL = (1u << STATECATEGORY_LAST) - 1u
+};
+
+const char*	getStateCategoryName	(StateCategory category);
+
+//! Reset all state. Only state modified since the last reset is restored if renderCtx tracks state changes.
+void		resetState				(const RenderContext& renderCtx, const ContextInfo& ctxInfo);
+
+//! Reset state in given categories
+void		resetState				(const RenderContext& renderCtx, const ContextInfo& ctxInfo, deUint32 categoryMask);
+
+//! Reset state in given categories and check that the rest of the state already has its initial values
+void		resetAndVerifyState		(const RenderContext& renderCtx, const ContextInfo& ctxInfo, deUint32 categoryMask);
 
 } // glu
 
@@ -0,0 +1,662 @@
+/*-------------------------------------------------------------------------
+ * drawElements Quality Program OpenGL ES Utilities
+ * ------------------------------------------------
+ *
+ * Copyright 2019 The Android Open Source Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ *//*!
+ * \file
+ * \brief Context wrapper that tracks which state categories are modified.
+ *//*--------------------------------------------------------------------*/
+
+#include "gluStateTrackingRenderContext.hpp"
+#include "gluStateReset.hpp"
+#include "glwEnums.hpp"
+
+namespace glu
+{
+namespace
+{
+
+using namespace glw;
+
+StateTrackingRenderContext*	s_trackingContext	= DE_NULL;
+const glw::Functions*		s_baseFunctions		= DE_NULL;
+
+inline const glw::Functions& getBaseFunctions (void)
+{
+	DE_ASSERT(s_baseFunctions);
+	return *s_baseFunctions;
+}
+
+inline void markDirty (deUint32 categoryMask)
+{
+	DE_ASSERT(s_trackingContext);
+	s_trackingContext->markDirty(categoryMask);
+}
+
+deUint32 getCapabilityStateMask (GLenum cap)
+{
+	switch (cap)
+	{
+		case GL_PRIMITIVE_RESTART:
+		case GL_PRIMITIVE_RESTART_FIXED_INDEX:
+			return STATECATEGORY_MASK(STATECATEGORY_VERTEX_ARRAY);
+
+		case GL_DEPTH_CLAMP:
+			return STATECATEGORY_MASK(STATECATEGORY_TRANSFORMATION);
+
+		case GL_CULL_FACE:
+		case GL_POLYGON_OFFSET_FILL:
+		case GL_POLYGON_OFFSET_LINE:
+		case GL_POLYGON_OFFSET_POINT:
+		case GL_POLYGON_SMOOTH:
+		case GL_LINE_SMOOTH:
+		case GL_RASTERIZER_DISCARD:
+			return STATECATEGORY_MASK(STATECATEGORY_RASTERIZATION);
+
+		case GL_MULTISAMPLE:
+		case GL_SAMPLE_ALPHA_TO_COVERAGE:
+		case GL_SAMPLE_ALPHA_TO_ONE:
+		case GL_SAMPLE_COVERAGE:
+		case GL_SAMPLE_MASK:
+			return STATECATEGORY_MASK(STATECATEGORY_MULTISAMPLE);
+
+		case GL_TEXTURE_CUBE_MAP_SEAMLESS:
+			return STATECATEGORY_MASK(STATECATEGORY_TEXTURE);
+
+		case GL_SCISSOR_TEST:
+		case GL_STENCIL_TEST:
+		case GL_DEPTH_TEST:
+		case GL_BLEND:
+		case GL_DITHER:
+		case GL_FRAMEBUFFER_SRGB:
+		case GL_COLOR_LOGIC_OP:
+		case GL_BLEND_ADVANCED_COHERENT_KHR:
+			return STATECATEGORY_MASK(STATECATEGORY_PIXEL_OPERATIONS);
+
+		case GL_PROGRAM_POINT_SIZE:
+			return STATECATEGORY_MASK(STATECATEGORY_VERTEX_SHADER);
+
+		case GL_SAMPLE_SHADING:
+			return STATECATEGORY_MASK(STATECATEGORY_SAMPLE_SHADING);
+
+		case GL_DEBUG_OUTPUT:
+		case GL_DEBUG_OUTPUT_SYNCHRONOUS:
+			return STATECATEGORY_MASK(STATECATEGORY_DEBUG);
+
+		default:
+			if (de::inRange<GLenum>(cap, GL_CLIP_DISTANCE0, GL_CLIP_DISTANCE7))
+				return STATECATEGORY_MASK(STATECATEGORY_TRANSFORMATION);
+
+			// Unknown capability, assume anything may have changed
+			return STATECATEGORY_MASK_ALL;
+	}
+}
+
+deUint32 getIndexedCapabilityStateMask (GLenum target)
+{
+	switch (target)
+	{
+		case GL_BLEND:
+		case GL_SCISSOR_TEST:
+			return STATECATEGORY_MASK(STATECATEGORY_PIXEL_OPERATIONS);
+
+		default:
+			return STATECATEGORY_MASK_ALL;
+	}
+}
+
+deUint32 getBufferTargetStateMask (GLenum target)
+{
+	switch (target)
+	{
+		case GL_ARRAY_BUFFER:
+		case GL_ELEMENT_ARRAY_BUFFER:
+		case GL_DRAW_INDIRECT_BUFFER:
+			return STATECATEGORY_MASK(STATECATEGORY_VERTEX_ARRAY);
+
+		case GL_TEXTURE_BUFFER:
+			return STATECATEGORY_MASK(STATECATEGORY_TEXTURE);
+
+		case GL_PIXEL_PACK_BUFFER:
+		case GL_PIXEL_UNPACK_BUFFER:
+			return STATECATEGORY_MASK(STATECATEGORY_PIXEL_TRANSFER);
+
+		case GL_UNIFORM_BUFFER:
+		case GL_ATOMIC_COUNTER_BUFFER:
+		case GL_SHADER_STORAGE_BUFFER:
+			return STATECATEGORY_MASK(STATECATEGORY_PROGRAM);
+
+		case GL_TRANSFORM_FEEDBACK_BUFFER:
+			return STATECATEGORY_MASK(STATECATEGORY_TRANSFORM_FEEDBACK);
+
+		case GL_COPY_READ_BUFFER:
+		case GL_COPY_WRITE_BUFFER:
+		case GL_DISPATCH_INDIRECT_BUFFER:
+			return STATECATEGORY_MASK(STATECATEGORY_BUFFER_BINDING);
+
+		default:
+			return STATECATEGORY_MASK_ALL;
+	}
+}
+
+namespace thunk
+{
+
+#define TRACKED_FUNC(NAME, CATEGORY_MASK, PARAMS, ARGS) \
+	void GLW_APIENTRY NAME PARAMS { markDirty(CATEGORY_MASK); getBaseFunctions().NAME ARGS; }
+
+TRACKED_FUNC(enable,					getCapabilityStateMask(cap),							(GLenum cap), (cap))
+TRACKED_FUNC(disable,					getCapabilityStateMask(cap),							(GLenum cap), (cap))
+
+TRACKED_FUNC(enablei,					getIndexedCapabilityStateMask(target),					(GLenum target, GLuint index), (target, index))
+TRACKED_FUNC(disablei,					getIndexedCapabilityStateMask(target),					(GLenum target, GLuint index), (target, index))
+
+TRACKED_FUNC(bindBuffer,				getBufferTargetStateMask(target),						(GLenum target, GLuint buffer), (target, buffer))
+TRACKED_FUNC(bindBufferBase,			getBufferTargetStateMask(target),						(GLenum target, GLuint index, GLuint buffer), (target, index, buffer))
+TRACKED_FUNC(bindBufferRange,			getBufferTargetStateMask(target),						(GLenum target, GLuint index, GLuint buffer, GLintptr offset, GLsizeiptr size), (target, index, buffer, offset, size))
+TRACKED_FUNC(bindBuffersBase,			getBufferTargetStateMask(target),						(GLenum target, GLuint first, GLsizei count, const GLuint *buffers), (target, first, count, buffers))
+TRACKED_FUNC(bindBuffersRange,			getBufferTargetStateMask(target),						(GLenum target, GLuint first, GLsizei count, const GLuint *buffers, const GLintptr *offsets, const GLsizeiptr *sizes), (target, first, count, buffers, offsets, sizes))
+
+TRACKED_FUNC(bindVertexArray,			STATECATEGORY_MASK(STATECATEGORY_VERTEX_ARRAY),			(GLuint array), (array))
+TRACKED_FUNC(enableVertexAttribArray,	STATECATEGORY_MASK(STATECATEGORY_VERTEX_ARRAY),			(GLuint index), (index))
+TRACKED_FUNC(disableVertexAttribArray,	STATECATEGORY_MASK(STATECATEGORY_VERTEX_ARRAY),			(GLuint index), (index))
+TRACKED_FUNC(vertexAttribPointer,		STATECATEGORY_MASK(STATECATEGORY_VERTEX_ARRAY),			(GLuint index, GLint size, GLenum type, GLboolean normalized, GLsizei stride, const void *pointer), (index, size, type, normalized, stride, pointer))
+TRACKED_FUNC(vertexAttribIPointer,		STATECATEGORY_MASK(STATECATEGORY_VERTEX_ARRAY),			(GLuint index, GLint size, GLenum type, GLsizei stride, const void *pointer), (index, size, type, stride, pointer))
+TRACKED_FUNC(vertexAttribLPointer,		STATECATEGORY_MASK(STATECATEGORY_VERTEX_ARRAY),			(GLuint index, GLint size, GLenum type, GLsizei stride, const void *pointer), (index, size, type, stride, pointer))
+TRACKED_FUNC(vertexAttribDivisor,		STATECATEGORY_MASK(STATECATEGORY_VERTEX_ARRAY),			(GLuint index, GLuint divisor), (index, divisor))
+TRACKED_FUNC(vertexAttribFormat,		STATECATEGORY_MASK(STATECATEGORY_VERTEX_ARRAY),			(GLuint attribindex, GLint size, GLenum type, GLboolean normalized, GLuint relativeoffset), (attribindex, size, type, normalized, relativeoffset))
+TRACKED_FUNC(vertexAttribIFormat,		STATECATEGORY_MASK(STATECATEGORY_VERTEX_ARRAY),			(GLuint attribindex, GLint size, GLenum type, GLuint relativeoffset), (attribindex, size, type, relativeoffset))
+TRACKED_FUNC(vertexAttribLFormat,		STATECATEGORY_MASK(STATECATEGORY_VERTEX_ARRAY),			(GLuint attribindex, GLint size, GLenum type, GLuint relativeoffset), (attribindex, size, type, relativeoffset))
+TRACKED_FUNC(vertexAttribBinding,		STATECATEGORY_MASK(STATECATEGORY_VERTEX_ARRAY),			(GLuint attribindex, GLuint bindingindex), (attribindex, bindingindex))
+TRACKED_FUNC(bindVertexBuffer,			STATECATEGORY_MASK(STATECATEGORY_VERTEX_ARRAY),			(GLuint bindingindex, GLuint buffer, GLintptr offset, GLsizei stride), (bindingindex, buffer, offset, stride))
+TRACKED_FUNC(bindVertexBuffers,			STATECATEGORY_MASK(STATECATEGORY_VERTEX_ARRAY),			(GLuint first, GLsizei count, const GLuint *buffers, const GLintptr *offsets, const GLsizei *strides), (first, count, buffers, offsets, strides))
+TRACKED_FUNC(vertexBindingDivisor,		STATECATEGORY_MASK(STATECATEGORY_VERTEX_ARRAY),			(GLuint bindingindex, GLuint divisor), (bindingindex, divisor))
+TRACKED_FUNC(primitiveRestartIndex,		STATECATEGORY_MASK(STATECATEGORY_VERTEX_ARRAY),			(GLuint index), (index))
+
+// Direct state access to vertex array objects, vaobj may name the bound or default array
+TRACKED_FUNC(enableVertexArrayAttrib,	STATECATEGORY_MASK(STATECATEGORY_VERTEX_ARRAY),			(GLuint vaobj, GLuint index), (vaobj, index))
+TRACKED_FUNC(disableVertexArrayAttrib,	STATECATEGORY_MASK(STATECATEGORY_VERTEX_ARRAY),			(GLuint vaobj, GLuint index), (vaobj, index))
+TRACKED_FUNC(vertexArrayAttribBinding,	STATECATEGORY_MASK(STATECATEGORY_VERTEX_ARRAY),			(GLuint vaobj, GLuint attribindex, GLuint bindingindex), (vaobj, attribindex, bindingindex))
+TRACKED_FUNC(vertexArrayAttribFormat,	STATECATEGORY_MASK(STATECATEGORY_VERTEX_ARRAY),			(GLuint vaobj, GLuint attribindex, GLint size, GLenum type, GLboolean normalized, GLuint relativeoffset), (vaobj, attribindex, size, type, normalized, relativeoffset))
+TRACKED_FUNC(vertexArrayAttribIFormat,	STATECATEGORY_MASK(STATECATEGORY_VERTEX_ARRAY),			(GLuint vaobj, GLuint attribindex, GLint size, GLenum type, GLuint relativeoffset), (vaobj, attribindex, size, type, relativeoffset))
+TRACKED_FUNC(vertexArrayAttribLFormat,	STATECATEGORY_MASK(STATECATEGORY_VERTEX_ARRAY),			(GLuint vaobj, GLuint attribindex, GLint size, GLenum type, GLuint relativeoffset), (vaobj, attribindex, size, type, relativeoffset))
+TRACKED_FUNC(vertexArrayBindingDivisor,	STATECATEGORY_MASK(STATECATEGORY_VERTEX_ARRAY),			(GLuint vaobj, GLuint bindingindex, GLuint divisor), (vaobj, bindingindex, divisor))
+TRACKED_FUNC(vertexArrayElementBuffer,	STATECATEGORY_MASK(STATECATEGORY_VERTEX_ARRAY),			(GLuint vaobj, GLuint buffer), (vaobj, buffer))
+TRACKED_FUNC(vertexArrayVertexBuffer,	STATECATEGORY_MASK(STATECATEGORY_VERTEX_ARRAY),			(GLuint vaobj, GLuint bindingindex, GLuint buffer, GLintptr offset, GLsizei stride), (vaobj, bindingindex, buffer, offset, stride))
+TRACKED_FUNC(vertexArrayVertexBuffers,	STATECATEGORY_MASK(STATECATEGORY_VERTEX_ARRAY),			(GLuint vaobj, GLuint first, GLsizei count, const GLuint *buffers, const GLintptr *offsets, const GLsizei *strides), (vaobj, first, count, buffers, offsets, strides))
+
+TRACKED_FUNC(viewport,					STATECATEGORY_MASK(STATECATEGORY_TRANSFORMATION),		(GLint x, GLint y, GLsizei width, GLsizei height), (x, y, width, height))
+TRACKED_FUNC(depthRange,				STATECATEGORY_MASK(STATECATEGORY_TRANSFORMATION),		(GLdouble n, GLdouble f), (n, f))
+TRACKED_FUNC(depthRangef,				STATECATEGORY_MASK(STATECATEGORY_TRANSFORMATION),		(GLfloat n, GLfloat f), (n, f))
+TRACKED_FUNC(bindTransformFeedback,		STATECATEGORY_MASK(STATECATEGORY_TRANSFORMATION),		(GLenum target, GLuint id), (target, id))
+
+TRACKED_FUNC(lineWidth,					STATECATEGORY_MASK(STATECATEGORY_RASTERIZATION),		(GLfloat width), (width))
+TRACKED_FUNC(cullFace,					STATECATEGORY_MASK(STATECATEGORY_RASTERIZATION),		(GLenum mode), (mode))
+TRACKED_FUNC(frontFace,					STATECATEGORY_MASK(STATECATEGORY_RASTERIZATION),		(GLenum mode), (mode))
+TRACKED_FUNC(polygonOffset,				STATECATEGORY_MASK(STATECATEGORY_RASTERIZATION),		(GLfloat factor, GLfloat units), (factor, units))
+TRACKED_FUNC(pointSize,					STATECATEGORY_MASK(STATECATEGORY_RASTERIZATION),		(GLfloat size), (size))
+TRACKED_FUNC(pointParameterf,			STATECATEGORY_MASK(STATECATEGORY_RASTERIZATION),		(GLenum pname, GLfloat param), (pname, param))
+TRACKED_FUNC(pointParameterfv,			STATECATEGORY_MASK(STATECATEGORY_RASTERIZATION),		(GLenum pname, const GLfloat *params), (pname, params))
+TRACKED_FUNC(pointParameteri,			STATECATEGORY_MASK(STATECATEGORY_RASTERIZATION),		(GLenum pname, GLint param), (pname, param))
+TRACKED_FUNC(pointParameteriv,			STATECATEGORY_MASK(STATECATEGORY_RASTERIZATION),		(GLenum pname, const GLint *params), (pname, params))
+TRACKED_FUNC(provokingVertex,			STATECATEGORY_MASK(STATECATEGORY_RASTERIZATION),		(GLenum mode), (mode))
+TRACKED_FUNC(clampColor,				STATECATEGORY_MASK(STATECATEGORY_RASTERIZATION),		(GLenum target, GLenum clamp), (target, clamp))
+
+TRACKED_FUNC(sampleCoverage,			STATECATEGORY_MASK(STATECATEGORY_MULTISAMPLE),			(GLfloat value, GLboolean invert), (value, invert))
+TRACKED_FUNC(sampleMaski,				STATECATEGORY_MASK(STATECATEGORY_MULTISAMPLE),			(GLuint maskNumber, GLbitfield mask), (maskNumber, mask))
+
+TRACKED_FUNC(activeTexture,				STATECATEGORY_MASK(STATECATEGORY_TEXTURE),				(GLenum texture), (texture))
+TRACKED_FUNC(bindTexture,				STATECATEGORY_MASK(STATECATEGORY_TEXTURE),				(GLenum target, GLuint texture), (target, texture))
+TRACKED_FUNC(bindTextureUnit,			STATECATEGORY_MASK(STATECATEGORY_TEXTURE),				(GLuint unit, GLuint texture), (unit, texture))
+TRACKED_FUNC(bindTextures,				STATECATEGORY_MASK(STATECATEGORY_TEXTURE),				(GLuint first, GLsizei count, const GLuint *textures), (first, count, textures))
+TRACKED_FUNC(texParameterIiv,			STATECATEGORY_MASK(STATECATEGORY_TEXTURE),				(GLenum target, GLenum pname, const GLint *params), (target, pname, params))
+TRACKED_FUNC(texParameterIuiv,			STATECATEGORY_MASK(STATECATEGORY_TEXTURE),				(GLenum target, GLenum pname, const GLuint *params), (target, pname, params))
+TRACKED_FUNC(texParameterf,				STATECATEGORY_MASK(STATECATEGORY_TEXTURE),				(GLenum target, GLenum pname, GLfloat param), (target, pname, param))
+TRACKED_FUNC(texParameterfv,			STATECATEGORY_MASK(STATECATEGORY_TEXTURE),				(GLenum target, GLenum pname, const GLfloat *params), (target, pname, params))
+TRACKED_FUNC(texParameteri,				STATECATEGORY_MASK(STATECATEGORY_TEXTURE),				(GLenum target, GLenum pname, GLint param), (target, pname, param))
+TRACKED_FUNC(texParameteriv,			STATECATEGORY_MASK(STATECATEGORY_TEXTURE),				(GLenum target, GLenum pname, const GLint *params), (target, pname, params))
+TRACKED_FUNC(texImage1D,				STATECATEGORY_MASK(STATECATEGORY_TEXTURE),				(GLenum target, GLint level, GLint internalformat, GLsizei width, GLint border, GLenum format, GLenum type, const void *pixels), (target, level, internalformat, width, border, format, type, pixels))
+TRACKED_FUNC(texImage2D,				STATECATEGORY_MASK(STATECATEGORY_TEXTURE),				(GLenum target, GLint level, GLint internalformat, GLsizei width, GLsizei height, GLint border, GLenum format, GLenum type, const void *pixels), (target, level, internalformat, width, height, border, format, type, pixels))
+TRACKED_FUNC(texImage2DMultisample,		STATECATEGORY_MASK(STATECATEGORY_TEXTURE),				(GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height, GLboolean fixedsamplelocations), (target, samples, internalformat, width, height, fixedsamplelocations))
+TRACKED_FUNC(texImage3DMultisample,		STATECATEGORY_MASK(STATECATEGORY_TEXTURE),				(GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth, GLboolean fixedsamplelocations), (target, samples, internalformat, width, height, depth, fixedsamplelocations))
+TRACKED_FUNC(texImage3D,				STATECATEGORY_MASK(STATECATEGORY_TEXTURE),				(GLenum target, GLint level, GLint internalformat, GLsizei width, GLsizei height, GLsizei depth, GLint border, GLenum format, GLenum type, const void *pixels), (target, level, internalformat, width, height, depth, border, format, type, pixels))
+TRACKED_FUNC(texImage3DOES,				STATECATEGORY_MASK(STATECATEGORY_TEXTURE),				(GLenum target, GLint level, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth, GLint border, GLenum format, GLenum type, const void *pixels), (target, level, internalformat, width, height, depth, border, format, type, pixels))
+TRACKED_FUNC(texStorage1D,				STATECATEGORY_MASK(STATECATEGORY_TEXTURE),				(GLenum target, GLsizei levels, GLenum internalformat, GLsizei width), (target, levels, internalformat, width))
+TRACKED_FUNC(texStorage2D,				STATECATEGORY_MASK(STATECATEGORY_TEXTURE),				(GLenum target, GLsizei levels, GLenum internalformat, GLsizei width, GLsizei height), (target, levels, internalformat, width, height))
+TRACKED_FUNC(texStorage2DMultisample,	STATECATEGORY_MASK(STATECATEGORY_TEXTURE),				(GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height, GLboolean fixedsamplelocations), (target, samples, internalformat, width, height, fixedsamplelocations))
+TRACKED_FUNC(texStorage3D,				STATECATEGORY_MASK(STATECATEGORY_TEXTURE),				(GLenum target, GLsizei levels, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth), (target, levels, internalformat, width, height, depth))
+TRACKED_FUNC(texStorage3DMultisample,	STATECATEGORY_MASK(STATECATEGORY_TEXTURE),				(GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth, GLboolean fixedsamplelocations), (target, samples, internalformat, width, height, depth, fixedsamplelocations))
+TRACKED_FUNC(compressedTexImage1D,		STATECATEGORY_MASK(STATECATEGORY_TEXTURE),				(GLenum target, GLint level, GLenum internalformat, GLsizei width, GLint border, GLsizei imageSize, const void *data), (target, level, internalformat, width, border, imageSize, data))
+TRACKED_FUNC(compressedTexImage2D,		STATECATEGORY_MASK(STATECATEGORY_TEXTURE),				(GLenum target, GLint level, GLenum internalformat, GLsizei width, GLsizei height, GLint border, GLsizei imageSize, const void *data), (target, level, internalformat, width, height, border, imageSize, data))
+TRACKED_FUNC(compressedTexImage3D,		STATECATEGORY_MASK(STATECATEGORY_TEXTURE),				(GLenum target, GLint level, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth, GLint border, GLsizei imageSize, const void *data), (target, level, internalformat, width, height, depth, border, imageSize, data))
+TRACKED_FUNC(compressedTexImage3DOES,	STATECATEGORY_MASK(STATECATEGORY_TEXTURE),				(GLenum target, GLint level, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth, GLint border, GLsizei imageSize, const void *data), (target, level, internalformat, width, height, depth, border, imageSize, data))
+TRACKED_FUNC(copyTexImage1D,			STATECATEGORY_MASK(STATECATEGORY_TEXTURE),				(GLenum target, GLint level, GLenum internalformat, GLint x, GLint y, GLsizei width, GLint border), (target, level, internalformat, x, y, width, border))
+TRACKED_FUNC(copyTexImage2D,			STATECATEGORY_MASK(STATECATEGORY_TEXTURE),				(GLenum target, GLint level, GLenum internalformat, GLint x, GLint y, GLsizei width, GLsizei height, GLint border), (target, level, internalformat, x, y, width, height, border))
+TRACKED_FUNC(texBuffer,					STATECATEGORY_MASK(STATECATEGORY_TEXTURE),				(GLenum target, GLenum internalformat, GLuint buffer), (target, internalformat, buffer))
+TRACKED_FUNC(texBufferRange,			STATECATEGORY_MASK(STATECATEGORY_TEXTURE),				(GLenum target, GLenum internalformat, GLuint buffer, GLintptr offset, GLsizeiptr size), (target, internalformat, buffer, offset, size))
+TRACKED_FUNC(generateMipmap,			STATECATEGORY_MASK(STATECATEGORY_TEXTURE),				(GLenum target), (target))
+TRACKED_FUNC(bindSampler,				STATECATEGORY_MASK(STATECATEGORY_TEXTURE),				(GLuint unit, GLuint sampler), (unit, sampler))
+TRACKED_FUNC(bindSamplers,				STATECATEGORY_MASK(STATECATEGORY_TEXTURE),				(GLuint first, GLsizei count, const GLuint *samplers), (first, count, samplers))
+
+TRACKED_FUNC(scissor,					STATECATEGORY_MASK(STATECATEGORY_PIXEL_OPERATIONS),		(GLint x, GLint y, GLsizei width, GLsizei height), (x, y, width, height))
+TRACKED_FUNC(stencilFunc,				STATECATEGORY_MASK(STATECATEGORY_PIXEL_OPERATIONS),		(GLenum func, GLint ref, GLuint mask), (func, ref, mask))
+TRACKED_FUNC(stencilFuncSeparate,		STATECATEGORY_MASK(STATECATEGORY_PIXEL_OPERATIONS),		(GLenum face, GLenum func, GLint ref, GLuint mask), (face, func, ref, mask))
+TRACKED_FUNC(stencilOp,					STATECATEGORY_MASK(STATECATEGORY_PIXEL_OPERATIONS),		(GLenum fail, GLenum zfail, GLenum zpass), (fail, zfail, zpass))
+TRACKED_FUNC(stencilOpSeparate,			STATECATEGORY_MASK(STATECATEGORY_PIXEL_OPERATIONS),		(GLenum face, GLenum sfail, GLenum dpfail, GLenum dppass), (face, sfail, dpfail, dppass))
+TRACKED_FUNC(depthFunc,					STATECATEGORY_MASK(STATECATEGORY_PIXEL_OPERATIONS),		(GLenum func), (func))
+TRACKED_FUNC(blendColor,				STATECATEGORY_MASK(STATECATEGORY_PIXEL_OPERATIONS),		(GLfloat red, GLfloat green, GLfloat blue, GLfloat alpha), (red, green, blue, alpha))
+TRACKED_FUNC(blendEquation,				STATECATEGORY_MASK(STATECATEGORY_PIXEL_OPERATIONS),		(GLenum mode), (mode))
+TRACKED_FUNC(blendEquationSeparate,		STATECATEGORY_MASK(STATECATEGORY_PIXEL_OPERATIONS),		(GLenum modeRGB, GLenum modeAlpha), (modeRGB, modeAlpha))
+TRACKED_FUNC(blendEquationSeparatei,	STATECATEGORY_MASK(STATECATEGORY_PIXEL_OPERATIONS),		(GLuint buf, GLenum modeRGB, GLenum modeAlpha), (buf, modeRGB, modeAlpha))
+TRACKED_FUNC(blendEquationi,			STATECATEGORY_MASK(STATECATEGORY_PIXEL_OPERATIONS),		(GLuint buf, GLenum mode), (buf, mode))
+TRACKED_FUNC(blendFunc,					STATECATEGORY_MASK(STATECATEGORY_PIXEL_OPERATIONS),		(GLenum sfactor, GLenum dfactor), (sfactor, dfactor))
+TRACKED_FUNC(blendFuncSeparate,			STATECATEGORY_MASK(STATECATEGORY_PIXEL_OPERATIONS),		(GLenum sfactorRGB, GLenum dfactorRGB, GLenum sfactorAlpha, GLenum dfactorAlpha), (sfactorRGB, dfactorRGB, sfactorAlpha, dfactorAlpha))
+TRACKED_FUNC(blendFuncSeparatei,		STATECATEGORY_MASK(STATECATEGORY_PIXEL_OPERATIONS),		(GLuint buf, GLenum srcRGB, GLenum dstRGB, GLenum srcAlpha, GLenum dstAlpha), (buf, srcRGB, dstRGB, srcAlpha, dstAlpha))
+TRACKED_FUNC(blendFunci,				STATECATEGORY_MASK(STATECATEGORY_PIXEL_OPERATIONS),		(GLuint buf, GLenum src, GLenum dst), (buf, src, dst))
+TRACKED_FUNC(colorMaski,				STATECATEGORY_MASK(STATECATEGORY_PIXEL_OPERATIONS),		(GLuint index, GLboolean r, GLboolean g, GLboolean b, GLboolean a), (index, r, g, b, a))
+TRACKED_FUNC(logicOp,					STATECATEGORY_MASK(STATECATEGORY_PIXEL_OPERATIONS),		(GLenum opcode), (opcode))
+
+TRACKED_FUNC(colorMask,					STATECATEGORY_MASK(STATECATEGORY_FRAMEBUFFER_CONTROL),	(GLboolean red, GLboolean green, GLboolean blue, GLboolean alpha), (red, green, blue, alpha))
+TRACKED_FUNC(depthMask,					STATECATEGORY_MASK(STATECATEGORY_FRAMEBUFFER_CONTROL),	(GLboolean flag), (flag))
+TRACKED_FUNC(stencilMask,				STATECATEGORY_MASK(STATECATEGORY_FRAMEBUFFER_CONTROL),	(GLuint mask), (mask))
+TRACKED_FUNC(stencilMaskSeparate,		STATECATEGORY_MASK(STATECATEGORY_FRAMEBUFFER_CONTROL),	(GLenum face, GLuint mask), (face, mask))
+TRACKED_FUNC(clearColor,				STATECATEGORY_MASK(STATECATEGORY_FRAMEBUFFER_CONTROL),	(GLfloat red, GLfloat green, GLfloat blue, GLfloat alpha), (red, green, blue, alpha))
+TRACKED_FUNC(clearDepth,				STATECATEGORY_MASK(STATECATEGORY_FRAMEBUFFER_CONTROL),	(GLdouble depth), (depth))
+TRACKED_FUNC(clearDepthf,				STATECATEGORY_MASK(STATECATEGORY_FRAMEBUFFER_CONTROL),	(GLfloat d), (d))
+TRACKED_FUNC(clearStencil,				STATECATEGORY_MASK(STATECATEGORY_FRAMEBUFFER_CONTROL),	(GLint s), (s))
+
+TRACKED_FUNC(bindFramebuffer,			STATECATEGORY_MASK(STATECATEGORY_FRAMEBUFFER),			(GLenum target, GLuint framebuffer), (target, framebuffer))
+TRACKED_FUNC(drawBuffer,				STATECATEGORY_MASK(STATECATEGORY_FRAMEBUFFER),			(GLenum buf), (buf))
+TRACKED_FUNC(drawBuffers,				STATECATEGORY_MASK(STATECATEGORY_FRAMEBUFFER),			(GLsizei n, const GLenum *bufs), (n, bufs))
+TRACKED_FUNC(readBuffer,				STATECATEGORY_MASK(STATECATEGORY_FRAMEBUFFER),			(GLenum src), (src))
+TRACKED_FUNC(framebufferParameteri,		STATECATEGORY_MASK(STATECATEGORY_FRAMEBUFFER),			(GLenum target, GLenum pname, GLint param), (target, pname, param))
+TRACKED_FUNC(namedFramebufferDrawBuffer,	STATECATEGORY_MASK(STATECATEGORY_FRAMEBUFFER),		(GLuint framebuffer, GLenum buf), (framebuffer, buf))
+TRACKED_FUNC(namedFramebufferDrawBuffers,	STATECATEGORY_MASK(STATECATEGORY_FRAMEBUFFER),		(GLuint framebuffer, GLsizei n, const GLenum *bufs), (framebuffer, n, bufs))
+TRACKED_FUNC(namedFramebufferReadBuffer,	STATECATEGORY_MASK(STATECATEGORY_FRAMEBUFFER),		(GLuint framebuffer, GLenum src), (framebuffer, src))
+
+TRACKED_FUNC(bindRenderbuffer,			STATECATEGORY_MASK(STATECATEGORY_RENDERBUFFER),			(GLenum target, GLuint renderbuffer), (target, renderbuffer))
+
+TRACKED_FUNC(pixelStorei,				STATECATEGORY_MASK(STATECATEGORY_PIXEL_TRANSFER),		(GLenum pname, GLint param), (pname, param))
+
+TRACKED_FUNC(useProgram,				STATECATEGORY_MASK(STATECATEGORY_PROGRAM),				(GLuint program), (program))
+TRACKED_FUNC(bindProgramPipeline,		STATECATEGORY_MASK(STATECATEGORY_PROGRAM),				(GLuint pipeline), (pipeline))
+
+TRACKED_FUNC(vertexAttrib1d,			STATECATEGORY_MASK(STATECATEGORY_VERTEX_SHADER),		(GLuint index, GLdouble x), (index, x))
+TRACKED_FUNC(vertexAttrib1dv,			STATECATEGORY_MASK(STATECATEGORY_VERTEX_SHADER),		(GLuint index, const GLdouble *v), (index, v))
+TRACKED_FUNC(vertexAttrib1f,			STATECATEGORY_MASK(STATECATEGORY_VERTEX_SHADER),		(GLuint index, GLfloat x), (index, x))
+TRACKED_FUNC(vertexAttrib1fv,			STATECATEGORY_MASK(STATECATEGORY_VERTEX_SHADER),		(GLuint index, const GLfloat *v), (index, v))
+TRACKED_FUNC(vertexAttrib1s,			STATECATEGORY_MASK(STATECATEGORY_VERTEX_SHADER),		(GLuint index, GLshort x), (index, x))
+TRACKED_FUNC(vertexAttrib1sv,			STATECATEGORY_MASK(STATECATEGORY_VERTEX_SHADER),		(GLuint index, const GLshort *v), (index, v))
+TRACKED_FUNC(vertexAttrib2d,			STATECATEGORY_MASK(STATECATEGORY_VERTEX_SHADER),		(GLuint index, GLdouble x, GLdouble y), (index, x, y))
+TRACKED_FUNC(vertexAttrib2dv,			STATECATEGORY_MASK(STATECATEGORY_VERTEX_SHADER),		(GLuint index, const GLdouble *v), (index, v))
+TRACKED_FUNC(vertexAttrib2f,			STATECATEGORY_MASK(STATECATEGORY_VERTEX_SHADER),		(GLuint index, GLfloat x, GLfloat y), (index, x, y))
+TRACKED_FUNC(vertexAttrib2fv,			STATECATEGORY_MASK(STATECATEGORY_VERTEX_SHADER),		(GLuint index, const GLfloat *v), (index, v))
+TRACKED_FUNC(vertexAttrib2s,			STATECATEGORY_MASK(STATECATEGORY_VERTEX_SHADER),		(GLuint index, GLshort x, GLshort y), (index, x, y))
+TRACKED_FUNC(vertexAttrib2sv,			STATECATEGORY_MASK(STATECATEGORY_VERTEX_SHADER),		(GLuint index, const GLshort *v), (index, v))
+TRACKED_FUNC(vertexAttrib3d,			STATECATEGORY_MASK(STATECATEGORY_VERTEX_SHADER),		(GLuint index, GLdouble x, GLdouble y, GLdouble z), (index, x, y, z))
+TRACKED_FUNC(vertexAttrib3dv,			STATECATEGORY_MASK(STATECATEGORY_VERTEX_SHADER),		(GLuint index, const GLdouble *v), (index, v))
+TRACKED_FUNC(vertexAttrib3f,			STATECATEGORY_MASK(STATECATEGORY_VERTEX_SHADER),		(GLuint index, GLfloat x, GLfloat y, GLfloat z), (index, x, y, z))
+TRACKED_FUNC(vertexAttrib3fv,			STATECATEGORY_MASK(STATECATEGORY_VERTEX_SHADER),		(GLuint index, const GLfloat *v), (index, v))
+TRACKED_FUNC(vertexAttrib3s,			STATECATEGORY_MASK(STATECATEGORY_VERTEX_SHADER),		(GLuint index, GLshort x, GLshort y, GLshort z), (index, x, y, z))
+TRACKED_FUNC(vertexAttrib3sv,			STATECATEGORY_MASK(STATECATEGORY_VERTEX_SHADER),		(GLuint index, const GLshort *v), (index, v))
+TRACKED_FUNC(vertexAttrib4Nbv,			STATECATEGORY_MASK(STATECATEGORY_VERTEX_SHADER),		(GLuint index, const GLbyte *v), (index, v))
+TRACKED_FUNC(vertexAttrib4Niv,			STATECATEGORY_MASK(STATECATEGORY_VERTEX_SHADER),		(GLuint index, const GLint *v), (index, v))
+TRACKED_FUNC(vertexAttrib4Nsv,			STATECATEGORY_MASK(STATECATEGORY_VERTEX_SHADER),		(GLuint index, const GLshort *v), (index, v))
+TRACKED_FUNC(vertexAttrib4Nub,			STATECATEGORY_MASK(STATECATEGORY_VERTEX_SHADER),		(GLuint index, GLubyte x, GLubyte y, GLubyte z, GLubyte w), (index, x, y, z, w))
+TRACKED_FUNC(vertexAttrib4Nubv,			STATECATEGORY_MASK(STATECATEGORY_VERTEX_SHADER),		(GLuint index, const GLubyte *v), (index, v))
+TRACKED_FUNC(vertexAttrib4Nuiv,			STATECATEGORY_MASK(STATECATEGORY_VERTEX_SHADER),		(GLuint index, const GLuint *v), (index, v))
+TRACKED_FUNC(vertexAttrib4Nusv,			STATECATEGORY_MASK(STATECATEGORY_VERTEX_SHADER),		(GLuint index, const GLushort *v), (index, v))
+TRACKED_FUNC(vertexAttrib4bv,			STATECATEGORY_MASK(STATECATEGORY_VERTEX_SHADER),		(GLuint index, const GLbyte *v), (index, v))
+TRACKED_FUNC(vertexAttrib4d,			STATECATEGORY_MASK(STATECATEGORY_VERTEX_SHADER),		(GLuint index, GLdouble x, GLdouble y, GLdouble z, GLdouble w), (index, x, y, z, w))
+TRACKED_FUNC(vertexAttrib4dv,			STATECATEGORY_MASK(STATECATEGORY_VERTEX_SHADER),		(GLuint index, const GLdouble *v), (index, v))
+TRACKED_FUNC(vertexAttrib4f,			STATECATEGORY_MASK(STATECATEGORY_VERTEX_SHADER),		(GLuint index, GLfloat x, GLfloat y, GLfloat z, GLfloat w), (index, x, y, z, w))
+TRACKED_FUNC(vertexAttrib4fv,			STATECATEGORY_MASK(STATECATEGORY_VERTEX_SHADER),		(GLuint index, const GLfloat *v), (index, v))
+TRACKED_FUNC(vertexAttrib4iv,			STATECATEGORY_MASK(STATECATEGORY_VERTEX_SHADER),		(GLuint index, const GLint *v), (index, v))
+TRACKED_FUNC(vertexAttrib4s,			STATECATEGORY_MASK(STATECATEGORY_VERTEX_SHADER),		(GLuint index, GLshort x, GLshort y, GLshort z, GLshort w), (index, x, y, z, w))
+TRACKED_FUNC(vertexAttrib4sv,			STATECATEGORY_MASK(STATECATEGORY_VERTEX_SHADER),		(GLuint index, const GLshort *v), (index, v))
+TRACKED_FUNC(vertexAttrib4ubv,			STATECATEGORY_MASK(STATECATEGORY_VERTEX_SHADER),		(GLuint index, const GLubyte *v), (index, v))
+TRACKED_FUNC(vertexAttrib4uiv,			STATECATEGORY_MASK(STATECATEGORY_VERTEX_SHADER),		(GLuint index, const GLuint *v), (index, v))
+TRACKED_FUNC(vertexAttrib4usv,			STATECATEGORY_MASK(STATECATEGORY_VERTEX_SHADER),		(GLuint index, const GLushort *v), (index, v))
+TRACKED_FUNC(vertexAttribI1i,			STATECATEGORY_MASK(STATECATEGORY_VERTEX_SHADER),		(GLuint index, GLint x), (index, x))
+TRACKED_FUNC(vertexAttribI1iv,			STATECATEGORY_MASK(STATECATEGORY_VERTEX_SHADER),		(GLuint index, const GLint *v), (index, v))
+TRACKED_FUNC(vertexAttribI1ui,			STATECATEGORY_MASK(STATECATEGORY_VERTEX_SHADER),		(GLuint index, GLuint x), (index, x))
+TRACKED_FUNC(vertexAttribI1uiv,			STATECATEGORY_MASK(STATECATEGORY_VERTEX_SHADER),		(GLuint index, const GLuint *v), (index, v))
+TRACKED_FUNC(vertexAttribI2i,			STATECATEGORY_MASK(STATECATEGORY_VERTEX_SHADER),		(GLuint index, GLint x, GLint y), (index, x, y))
+TRACKED_FUNC(vertexAttribI2iv,			STATECATEGORY_MASK(STATECATEGORY_VERTEX_SHADER),		(GLuint index, const GLint *v), (index, v))
+TRACKED_FUNC(vertexAttribI2ui,			STATECATEGORY_MASK(STATECATEGORY_VERTEX_SHADER),		(GLuint index, GLuint x, GLuint y), (index, x, y))
+TRACKED_FUNC(vertexAttribI2uiv,			STATECATEGORY_MASK(STATECATEGORY_VERTEX_SHADER),		(GLuint index, const GLuint *v), (index, v))
+TRACKED_FUNC(vertexAttribI3i,			STATECATEGORY_MASK(STATECATEGORY_VERTEX_SHADER),		(GLuint index, GLint x, GLint y, GLint z), (index, x, y, z))
+TRACKED_FUNC(vertexAttribI3iv,			STATECATEGORY_MASK(STATECATEGORY_VERTEX_SHADER),		(GLuint index, const GLint *v), (index, v))
+TRACKED_FUNC(vertexAttribI3ui,			STATECATEGORY_MASK(STATECATEGORY_VERTEX_SHADER),		(GLuint index, GLuint x, GLuint y, GLuint z), (index, x, y, z))
+TRACKED_FUNC(vertexAttribI3uiv,			STATECATEGORY_MASK(STATECATEGORY_VERTEX_SHADER),		(GLuint index, const GLuint *v), (index, v))
+TRACKED_FUNC(vertexAttribI4bv,			STATECATEGORY_MASK(STATECATEGORY_VERTEX_SHADER),		(GLuint index, const GLbyte *v), (index, v))
+TRACKED_FUNC(vertexAttribI4i,			STATECATEGORY_MASK(STATECATEGORY_VERTEX_SHADER),		(GLuint index, GLint x, GLint y, GLint z, GLint w), (index, x, y, z, w))
+TRACKED_FUNC(vertexAttribI4iv,			STATECATEGORY_MASK(STATECATEGORY_VERTEX_SHADER),		(GLuint index, const GLint *v), (index, v))
+TRACKED_FUNC(vertexAttribI4sv,			STATECATEGORY_MASK(STATECATEGORY_VERTEX_SHADER),		(GLuint index, const GLshort *v), (index, v))
+TRACKED_FUNC(vertexAttribI4ubv,			STATECATEGORY_MASK(STATECATEGORY_VERTEX_SHADER),		(GLuint index, const GLubyte *v), (index, v))
+TRACKED_FUNC(vertexAttribI4ui,			STATECATEGORY_MASK(STATECATEGORY_VERTEX_SHADER),		(GLuint index, GLuint x, GLuint y, GLuint z, GLuint w), (index, x, y, z, w))
+TRACKED_FUNC(vertexAttribI4uiv,			STATECATEGORY_MASK(STATECATEGORY_VERTEX_SHADER),		(GLuint index, const GLuint *v), (index, v))
+TRACKED_FUNC(vertexAttribI4usv,			STATECATEGORY_MASK(STATECATEGORY_VERTEX_SHADER),		(GLuint index, const GLushort *v), (index, v))
+TRACKED_FUNC(vertexAttribL1d,			STATECATEGORY_MASK(STATECATEGORY_VERTEX_SHADER),		(GLuint index, GLdouble x), (index, x))
+TRACKED_FUNC(vertexAttribL1dv,			STATECATEGORY_MASK(STATECATEGORY_VERTEX_SHADER),		(GLuint index, const GLdouble *v), (index, v))
+TRACKED_FUNC(vertexAttribL2d,			STATECATEGORY_MASK(STATECATEGORY_VERTEX_SHADER),		(GLuint index, GLdouble x, GLdouble y), (index, x, y))
+TRACKED_FUNC(vertexAttribL2dv,			STATECATEGORY_MASK(STATECATEGORY_VERTEX_SHADER),		(GLuint index, const GLdouble *v), (index, v))
+TRACKED_FUNC(vertexAttribL3d,			STATECATEGORY_MASK(STATECATEGORY_VERTEX_SHADER),		(GLuint index, GLdouble x, GLdouble y, GLdouble z), (index, x, y, z))
+TRACKED_FUNC(vertexAttribL3dv,			STATECATEGORY_MASK(STATECATEGORY_VERTEX_SHADER),		(GLuint index, const GLdouble *v), (index, v))
+TRACKED_FUNC(vertexAttribL4d,			STATECATEGORY_MASK(STATECATEGORY_VERTEX_SHADER),		(GLuint index, GLdouble x, GLdouble y, GLdouble z, GLdouble w), (index, x, y, z, w))
+TRACKED_FUNC(vertexAttribL4dv,			STATECATEGORY_MASK(STATECATEGORY_VERTEX_SHADER),		(GLuint index, const GLdouble *v), (index, v))
+TRACKED_FUNC(vertexAttribP1ui,			STATECATEGORY_MASK(STATECATEGORY_VERTEX_SHADER),		(GLuint index, GLenum type, GLboolean normalized, GLuint value), (index, type, normalized, value))
+TRACKED_FUNC(vertexAttribP1uiv,			STATECATEGORY_MASK(STATECATEGORY_VERTEX_SHADER),		(GLuint index, GLenum type, GLboolean normalized, const GLuint *value), (index, type, normalized, value))
+TRACKED_FUNC(vertexAttribP2ui,			STATECATEGORY_MASK(STATECATEGORY_VERTEX_SHADER),		(GLuint index, GLenum type, GLboolean normalized, GLuint value), (index, type, normalized, value))
+TRACKED_FUNC(vertexAttribP2uiv,			STATECATEGORY_MASK(STATECATEGORY_VERTEX_SHADER),		(GLuint index, GLenum type, GLboolean normalized, const GLuint *value), (index, type, normalized, value))
+TRACKED_FUNC(vertexAttribP3ui,			STATECATEGORY_MASK(STATECATEGORY_VERTEX_SHADER),		(GLuint index, GLenum type, GLboolean normalized, GLuint value), (index, type, normalized, value))
+TRACKED_FUNC(vertexAttribP3uiv,			STATECATEGORY_MASK(STATECATEGORY_VERTEX_SHADER),		(GLuint index, GLenum type, GLboolean normalized, const GLuint *value), (index, type, normalized, value))
+TRACKED_FUNC(vertexAttribP4ui,			STATECATEGORY_MASK(STATECATEGORY_VERTEX_SHADER),		(GLuint index, GLenum type, GLboolean normalized, GLuint value), (index, type, normalized, value))
+TRACKED_FUNC(vertexAttribP4uiv,			STATECATEGORY_MASK(STATECATEGORY_VERTEX_SHADER),		(GLuint index, GLenum type, GLboolean normalized, const GLuint *value), (index, type, normalized, value))
+
+TRACKED_FUNC(beginTransformFeedback,	STATECATEGORY_MASK(STATECATEGORY_TRANSFORM_FEEDBACK),	(GLenum primitiveMode), (primitiveMode))
+
+TRACKED_FUNC(beginQuery,				STATECATEGORY_MASK(STATECATEGORY_QUERY),				(GLenum target, GLuint id), (target, id))
+
+TRACKED_FUNC(hint,						STATECATEGORY_MASK(STATECATEGORY_HINT),					(GLenum target, GLenum mode), (target, mode))
+
+TRACKED_FUNC(bindImageTexture,			STATECATEGORY_MASK(STATECATEGORY_IMAGE),				(GLuint unit, GLuint texture, GLint level, GLboolean layered, GLint layer, GLenum access, GLenum format), (unit, texture, level, layered, layer, access, format))
+TRACKED_FUNC(bindImageTextures,			STATECATEGORY_MASK(STATECATEGORY_IMAGE),				(GLuint first, GLsizei count, const GLuint *textures), (first, count, textures))
+
+TRACKED_FUNC(minSampleShading,			STATECATEGORY_MASK(STATECATEGORY_SAMPLE_SHADING),		(GLfloat value), (value))
+
+TRACKED_FUNC(debugMessageControl,		STATECATEGORY_MASK(STATECATEGORY_DEBUG),				(GLenum source, GLenum type, GLenum severity, GLsizei count, const GLuint *ids, GLboolean enabled), (source, type, severity, count, ids, enabled))
+TRACKED_FUNC(debugMessageCallback,		STATECATEGORY_MASK(STATECATEGORY_DEBUG),				(GLDEBUGPROC callback, const void *userParam), (callback, userParam))
+TRACKED_FUNC(pushDebugGroup,			STATECATEGORY_MASK(STATECATEGORY_DEBUG),				(GLenum source, GLuint id, GLsizei length, const GLchar *message), (source, id, length, message))
+
+TRACKED_FUNC(primitiveBoundingBox,		STATECATEGORY_MASK(STATECATEGORY_PRIMITIVE),			(GLfloat minX, GLfloat minY, GLfloat minZ, GLfloat minW, GLfloat maxX, GLfloat maxY, GLfloat maxZ, GLfloat maxW), (minX, minY, minZ, minW, maxX, maxY, maxZ, maxW))
+TRACKED_FUNC(patchParameteri,			STATECATEGORY_MASK(STATECATEGORY_PRIMITIVE),			(GLenum pname, GLint value), (pname, value))
+TRACKED_FUNC(patchParameterfv,			STATECATEGORY_MASK(STATECATEGORY_PRIMITIVE),			(GLenum pname, const GLfloat *values), (pname, values))
+
+#undef TRACKED_FUNC
+
+} // thunk
+
+void initTrackedFunctions (glw::Functions* dst)
+{
+	// Only replace entry points that are present so that null checks still work
+#define INSTALL_TRACKED_FUNC(NAME) do { if (dst->NAME) dst->NAME = thunk::NAME; } while (deGetFalse())
+
+	INSTALL_TRACKED_FUNC(enable);
+	INSTALL_TRACKED_FUNC(disable);
+	INSTALL_TRACKED_FUNC(enablei);
+	INSTALL_TRACKED_FUNC(disablei);
+	INSTALL_TRACKED_FUNC(bindBuffer);
+	INSTALL_TRACKED_FUNC(bindBufferBase);
+	INSTALL_TRACKED_FUNC(bindBufferRange);
+	INSTALL_TRACKED_FUNC(bindBuffersBase);
+	INSTALL_TRACKED_FUNC(bindBuffersRange);
+	INSTALL_TRACKED_FUNC(bindVertexArray);
+	INSTALL_TRACKED_FUNC(enableVertexAttribArray);
+	INSTALL_TRACKED_FUNC(disableVertexAttribArray);
+	INSTALL_TRACKED_FUNC(vertexAttribPointer);
+	INSTALL_TRACKED_FUNC(vertexAttribIPointer);
+	INSTALL_TRACKED_FUNC(vertexAttribLPointer);
+	INSTALL_TRACKED_FUNC(vertexAttribDivisor);
+	INSTALL_TRACKED_FUNC(vertexAttribFormat);
+	INSTALL_TRACKED_FUNC(vertexAttribIFormat);
+	INSTALL_TRACKED_FUNC(vertexAttribLFormat);
+	INSTALL_TRACKED_FUNC(vertexAttribBinding);
+	INSTALL_TRACKED_FUNC(bindVertexBuffer);
+	INSTALL_TRACKED_FUNC(bindVertexBuffers);
+	INSTALL_TRACKED_FUNC(vertexBindingDivisor);
+	INSTALL_TRACKED_FUNC(primitiveRestartIndex);
+	INSTALL_TRACKED_FUNC(enableVertexArrayAttrib);
+	INSTALL_TRACKED_FUNC(disableVertexArrayAttrib);
+	INSTALL_TRACKED_FUNC(vertexArrayAttribBinding);
+	INSTALL_TRACKED_FUNC(vertexArrayAttribFormat);
+	INSTALL_TRACKED_FUNC(vertexArrayAttribIFormat);
+	INSTALL_TRACKED_FUNC(vertexArrayAttribLFormat);
+	INSTALL_TRACKED_FUNC(vertexArrayBindingDivisor);
+	INSTALL_TRACKED_FUNC(vertexArrayElementBuffer);
+	INSTALL_TRACKED_FUNC(vertexArrayVertexBuffer);
+	INSTALL_TRACKED_FUNC(vertexArrayVertexBuffers);
+	INSTALL_TRACKED_FUNC(viewport);
+	INSTALL_TRACKED_FUNC(depthRange);
+	INSTALL_TRACKED_FUNC(depthRangef);
+	INSTALL_TRACKED_FUNC(bindTransformFeedback);
+	INSTALL_TRACKED_FUNC(lineWidth);
+	INSTALL_TRACKED_FUNC(cullFace);
+	INSTALL_TRACKED_FUNC(frontFace);
+	INSTALL_TRACKED_FUNC(polygonOffset);
+	INSTALL_TRACKED_FUNC(pointSize);
+	INSTALL_TRACKED_FUNC(pointParameterf);
+	INSTALL_TRACKED_FUNC(pointParameterfv);
+	INSTALL_TRACKED_FUNC(pointParameteri);
+	INSTALL_TRACKED_FUNC(pointParameteriv);
+	INSTALL_TRACKED_FUNC(provokingVertex);
+	INSTALL_TRACKED_FUNC(clampColor);
+	INSTALL_TRACKED_FUNC(sampleCoverage);
+	INSTALL_TRACKED_FUNC(sampleMaski);
+	INSTALL_TRACKED_FUNC(activeTexture);
+	INSTALL_TRACKED_FUNC(bindTexture);
+	INSTALL_TRACKED_FUNC(bindTextureUnit);
+	INSTALL_TRACKED_FUNC(bindTextures);
+	INSTALL_TRACKED_FUNC(texParameterIiv);
+	INSTALL_TRACKED_FUNC(texParameterIuiv);
+	INSTALL_TRACKED_FUNC(texParameterf);
+	INSTALL_TRACKED_FUNC(texParameterfv);
+	INSTALL_TRACKED_FUNC(texParameteri);
+	INSTALL_TRACKED_FUNC(texParameteriv);
+	INSTALL_TRACKED_FUNC(texImage1D);
+	INSTALL_TRACKED_FUNC(texImage2D);
+	INSTALL_TRACKED_FUNC(texImage2DMultisample);
+	INSTALL_TRACKED_FUNC(texImage3DMultisample);
+	INSTALL_TRACKED_FUNC(texImage3D);
+	INSTALL_TRACKED_FUNC(texImage3DOES);
+	INSTALL_TRACKED_FUNC(texStorage1D);
+	INSTALL_TRACKED_FUNC(texStorage2D);
+	INSTALL_TRACKED_FUNC(texStorage2DMultisample);
+	INSTALL_TRACKED_FUNC(texStorage3D);
+	INSTALL_TRACKED_FUNC(texStorage3DMultisample);
+	INSTALL_TRACKED_FUNC(compressedTexImage1D);
+	INSTALL_TRACKED_FUNC(compressedTexImage2D);
+	INSTALL_TRACKED_FUNC(compressedTexImage3D);
+	INSTALL_TRACKED_FUNC(compressedTexImage3DOES);
+	INSTALL_TRACKED_FUNC(copyTexImage1D);
+	INSTALL_TRACKED_FUNC(copyTexImage2D);
+	INSTALL_TRACKED_FUNC(texBuffer);
+	INSTALL_TRACKED_FUNC(texBufferRange);
+	INSTALL_TRACKED_FUNC(generateMipmap);
+	INSTALL_TRACKED_FUNC(bindSampler);
+	INSTALL_TRACKED_FUNC(bindSamplers);
+	INSTALL_TRACKED_FUNC(scissor);
+	INSTALL_TRACKED_FUNC(stencilFunc);
+	INSTALL_TRACKED_FUNC(stencilFuncSeparate);
+	INSTALL_TRACKED_FUNC(stencilOp);
+	INSTALL_TRACKED_FUNC(stencilOpSeparate);
+	INSTALL_TRACKED_FUNC(depthFunc);
+	INSTALL_TRACKED_FUNC(blendColor);
+	INSTALL_TRACKED_FUNC(blendEquation);
+	INSTALL_TRACKED_FUNC(blendEquationSeparate);
+	INSTALL_TRACKED_FUNC(blendEquationSeparatei);
+	INSTALL_TRACKED_FUNC(blendEquationi);
+	INSTALL_TRACKED_FUNC(blendFunc);
+	INSTALL_TRACKED_FUNC(blendFuncSeparate);
+	INSTALL_TRACKED_FUNC(blendFuncSeparatei);
+	INSTALL_TRACKED_FUNC(blendFunci);
+	INSTALL_TRACKED_FUNC(colorMaski);
+	INSTALL_TRACKED_FUNC(logicOp);
+	INSTALL_TRACKED_FUNC(colorMask);
+	INSTALL_TRACKED_FUNC(depthMask);
+	INSTALL_TRACKED_FUNC(stencilMask);
+	INSTALL_TRACKED_FUNC(stencilMaskSeparate);
+	INSTALL_TRACKED_FUNC(clearColor);
+	INSTALL_TRACKED_FUNC(clearDepth);
+	INSTALL_TRACKED_FUNC(clearDepthf);
+	INSTALL_TRACKED_FUNC(clearStencil);
+	INSTALL_TRACKED_FUNC(bindFramebuffer);
+	INSTALL_TRACKED_FUNC(drawBuffer);
+	INSTALL_TRACKED_FUNC(drawBuffers);
+	INSTALL_TRACKED_FUNC(readBuffer);
+	INSTALL_TRACKED_FUNC(framebufferParameteri);
+	INSTALL_TRACKED_FUNC(namedFramebufferDrawBuffer);
+	INSTALL_TRACKED_FUNC(namedFramebufferDrawBuffers);
+	INSTALL_TRACKED_FUNC(namedFramebufferReadBuffer);
+	INSTALL_TRACKED_FUNC(bindRenderbuffer);
+	INSTALL_TRACKED_FUNC(pixelStorei);
+	INSTALL_TRACKED_FUNC(useProgram);
+	INSTALL_TRACKED_FUNC(bindProgramPipeline);
+	INSTALL_TRACKED_FUNC(vertexAttrib1d);
+	INSTALL_TRACKED_FUNC(vertexAttrib1dv);
+	INSTALL_TRACKED_FUNC(vertexAttrib1f);
+	INSTALL_TRACKED_FUNC(vertexAttrib1fv);
+	INSTALL_TRACKED_FUNC(vertexAttrib1s);
+	INSTALL_TRACKED_FUNC(vertexAttrib1sv);
+	INSTALL_TRACKED_FUNC(vertexAttrib2d);
+	INSTALL_TRACKED_FUNC(vertexAttrib2dv);
+	INSTALL_TRACKED_FUNC(vertexAttrib2f);
+	INSTALL_TRACKED_FUNC(vertexAttrib2fv);
+	INSTALL_TRACKED_FUNC(vertexAttrib2s);
+	INSTALL_TRACKED_FUNC(vertexAttrib2sv);
+	INSTALL_TRACKED_FUNC(vertexAttrib3d);
+	INSTALL_TRACKED_FUNC(vertexAttrib3dv);
+	INSTALL_TRACKED_FUNC(vertexAttrib3f);
+	INSTALL_TRACKED_FUNC(vertexAttrib3fv);
+	INSTALL_TRACKED_FUNC(vertexAttrib3s);
+	INSTALL_TRACKED_FUNC(vertexAttrib3sv);
+	INSTALL_TRACKED_FUNC(vertexAttrib4Nbv);
+	INSTALL_TRACKED_FUNC(vertexAttrib4Niv);
+	INSTALL_TRACKED_FUNC(vertexAttrib4Nsv);
+	INSTALL_TRACKED_FUNC(vertexAttrib4Nub);
+	INSTALL_TRACKED_FUNC(vertexAttrib4Nubv);
+	INSTALL_TRACKED_FUNC(vertexAttrib4Nuiv);
+	INSTALL_TRACKED_FUNC(vertexAttrib4Nusv);
+	INSTALL_TRACKED_FUNC(vertexAttrib4bv);
+	INSTALL_TRACKED_FUNC(vertexAttrib4d);
+	INSTALL_TRACKED_FUNC(vertexAttrib4dv);
+	INSTALL_TRACKED_FUNC(vertexAttrib4f);
+	INSTALL_TRACKED_FUNC(vertexAttrib4fv);
+	INSTALL_TRACKED_FUNC(vertexAttrib4iv);
+	INSTALL_TRACKED_FUNC(vertexAttrib4s);
+	INSTALL_TRACKED_FUNC(vertexAttrib4sv);
+	INSTALL_TRACKED_FUNC(vertexAttrib4ubv);
+	INSTALL_TRACKED_FUNC(vertexAttrib4uiv);
+	INSTALL_TRACKED_FUNC(vertexAttrib4usv);
+	INSTALL_TRACKED_FUNC(vertexAttribI1i);
+	INSTALL_TRACKED_FUNC(vertexAttribI1iv);
+	INSTALL_TRACKED_FUNC(vertexAttribI1ui);
+	INSTALL_TRACKED_FUNC(vertexAttribI1uiv);
+	INSTALL_TRACKED_FUNC(vertexAttribI2i);
+	INSTALL_TRACKED_FUNC(vertexAttribI2iv);
+	INSTALL_TRACKED_FUNC(vertexAttribI2ui);
+	INSTALL_TRACKED_FUNC(vertexAttribI2uiv);
+	INSTALL_TRACKED_FUNC(vertexAttribI3i);
+	INSTALL_TRACKED_FUNC(vertexAttribI3iv);
+	INSTALL_TRACKED_FUNC(vertexAttribI3ui);
+	INSTALL_TRACKED_FUNC(vertexAttribI3uiv);
+	INSTALL_TRACKED_FUNC(vertexAttribI4bv);
+	INSTALL_TRACKED_FUNC(vertexAttribI4i);
+	INSTALL_TRACKED_FUNC(vertexAttribI4iv);
+	INSTALL_TRACKED_FUNC(vertexAttribI4sv);
+	INSTALL_TRACKED_FUNC(vertexAttribI4ubv);
+	INSTALL_TRACKED_FUNC(vertexAttribI4ui);
+	INSTALL_TRACKED_FUNC(vertexAttribI4uiv);
+	INSTALL_TRACKED_FUNC(vertexAttribI4usv);
+	INSTALL_TRACKED_FUNC(vertexAttribL1d);
+	INSTALL_TRACKED_FUNC(vertexAttribL1dv);
+	INSTALL_TRACKED_FUNC(vertexAttribL2d);
+	INSTALL_TRACKED_FUNC(vertexAttribL2dv);
+	INSTALL_TRACKED_FUNC(vertexAttribL3d);
+	INSTALL_TRACKED_FUNC(vertexAttribL3dv);
+	INSTALL_TRACKED_FUNC(vertexAttribL4d);
+	INSTALL_TRACKED_FUNC(vertexAttribL4dv);
+	INSTALL_TRACKED_FUNC(vertexAttribP1ui);
+	INSTALL_TRACKED_FUNC(vertexAttribP1uiv);
+	INSTALL_TRACKED_FUNC(vertexAttribP2ui);
+	INSTALL_TRACKED_FUNC(vertexAttribP2uiv);
+	INSTALL_TRACKED_FUNC(vertexAttribP3ui);
+	INSTALL_TRACKED_FUNC(vertexAttribP3uiv);
+	INSTALL_TRACKED_FUNC(vertexAttribP4ui);
+	INSTALL_TRACKED_FUNC(vertexAttribP4uiv);
+	INSTALL_TRACKED_FUNC(beginTransformFeedback);
+	INSTALL_TRACKED_FUNC(beginQuery);
+	INSTALL_TRACKED_FUNC(hint);
+	INSTALL_TRACKED_FUNC(bindImageTexture);
+	INSTALL_TRACKED_FUNC(bindImageTextures);
+	INSTALL_TRACKED_FUNC(minSampleShading);
+	INSTALL_TRACKED_FUNC(debugMessageControl);
+	INSTALL_TRACKED_FUNC(debugMessageCallback);
+	INSTALL_TRACKED_FUNC(pushDebugGroup);
+	INSTALL_TRACKED_FUNC(primitiveBoundingBox);
+	INSTALL_TRACKED_FUNC(patchParameteri);
+	INSTALL_TRACKED_FUNC(patchParameterfv);
+
+#undef INSTALL_TRACKED_FUNC
+}
+
+} // anonymous
+
+StateTrackingRenderContext::StateTrackingRenderContext (RenderContext* context, bool verify)
+	: m_context		(context)
+	, m_verify		(verify)
+	, m_functions	(context->getFunctions())
+	, m_dirtyMask	(STATECATEGORY_MASK_ALL)
+{
+	TCU_CHECK_INTERNAL(isAvailable());
+
+	initTrackedFunctions(&m_functions);
+
+	s_trackingContext	= this;
+	s_baseFunctions		= &m_context->getFunctions();
+}
+
+StateTrackingRenderContext::~StateTrackingRenderContext (void)
+{
+	DE_ASSERT(s_trackingContext == this);
+
+	s_trackingContext	= DE_NULL;
+	s_baseFunctions		= DE_NULL;
+
+	delete m_context;
+}
+
+glw::GenericFuncType StateTrackingRenderContext::getProcAddress (const char* name) const
+{
+	// Calls through the returned pointer are not tracked
+	markDirty(STATECATEGORY_MASK_ALL);
+
+	return m_context->getProcAddress(name);
+}
+
+void StateTrackingRenderContext::resetState (const ContextInfo& ctxInfo) const
+{
+	const deUint32 dirtyMask = m_dirtyMask;
+
+	// If the reset fails half-way, everything needs to be reset next time
+	m_dirtyMask = STATECATEGORY_MASK_ALL;
+
+	// Reset through the wrapped context so that the reset itself is not tracked
+	if (m_verify)
+		resetAndVerifyState(*m_context, ctxInfo, dirtyMask);
+	else
+		glu::resetState(*m_context, ctxInfo, dirtyMask);
+
+	m_dirtyMask = 0;
+}
+
+bool StateTrackingRenderContext::isAvailable (void)
+{
+	return s_trackingContext == DE_NULL;
+}
+
+} // glu
@@ -0,0 +1,86 @@
+#ifndef _GLUSTATETRACKINGRENDERCONTEXT_HPP
+#define _GLUSTATETRACKINGRENDERCONTEXT_HPP
+/*-------------------------------------------------------------------------
+ * drawElements Quality Program OpenGL ES Utilities
+ * ------------------------------------------------
+ *
+ * Copyright 2019 The Android Open Source Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ *//*!
+ * \file
+ * \brief Context wrapper that tracks which state categories are modified.
+ *//*--------------------------------------------------------------------*/
+
+#include "gluDefs.hpp"
+#include "gluRenderContext.hpp"
+#include "glwFunctions.hpp"
+
+namespace glu
+{
+
+class ContextInfo;
+
+/*--------------------------------------------------------------------*//*!
+ * \brief Context wrapper that records modified state categories
+ *
+ * getFunctions() returns a copy of the wrapped context's function table
+ * where entry points that modify state reset by resetState() first mark
+ * the corresponding StateCategory as dirty. resetState() then only
+ * restores the dirty categories.
+ *
+ * Entry points obtained through getProcAddress() cannot be tracked, so
+ * calling it marks all state as dirty.
+ *
+ * The entry points use a process-wide pointer to find the wrapper, so
+ * only one StateTrackingRenderContext may exist at a time.
+ *//*--------------------------------------------------------------------*/
+class StateTrackingRenderContext : public RenderContext
+{
+public:
+	//! Takes ownership of context. If verify is set, resetState() checks that untracked state was not modified.
+										StateTrackingRenderContext	(RenderContext* context, bool verify);
+	virtual								~StateTrackingRenderContext	(void);
+
+	virtual ContextType					getType						(void) const { return m_context->getType();					}
+	virtual const glw::Functions&		getFunctions				(void) const { return m_functions;							}
+	virtual const tcu::RenderTarget&	getRenderTarget				(void) const { return m_context->getRenderTarget();			}
+	virtual void						postIterate					(void)		 { m_context->postIterate();					}
+	virtual deUint32					getDefaultFramebuffer		(void) const { return m_context->getDefaultFramebuffer();	}
+	virtual glw::GenericFuncType		getProcAddress				(const char* name) const;
+	virtual void						makeCurrent					(void)		 { m_context->makeCurrent();					}
+
+	//! Categories modified since the last reset
+	deUint32							getDirtyMask				(void) const { return m_dirtyMask;							}
+	void								markDirty					(deUint32 categoryMask) const { m_dirtyMask |= categoryMask;	}
+
+	//! Restore dirty state categories. Called by glu::resetState().
+	void								resetState					(const ContextInfo& ctxInfo) const;
+
+	//! True if no other StateTrackingRenderContext exists
+	static bool							isAvailable					(void);
+
+private:
+										StateTrackingRenderContext	(const StateTrackingRenderContext&);
+	StateTrackingRenderContext&			operator=					(const StateTrackingRenderContext&);
+
+	RenderContext* const				m_context;
+	const bool							m_verify;
+	glw::Functions						m_functions;
+	mutable deUint32					m_dirtyMask;	//!< Modified through the const function table
+};
+
+} // glu
+
+#endif // _GLUSTATETRACKINGRENDERCONTEXT_HPP
@@ -32,6 +32,7 @@
 
 #include "deMath.h"
 #include "deStringUtil.hpp"
+#include "deParallelFor.hpp"
 
 #include <string>
 
@@ -1221,16 +1222,16 @@ void computeQuadTexCoordCubeArray (std::vector<float>& dst, tcu::CubeFace face,
 
 // Texture result verification
 
-//! Verifies texture lookup results and returns number of failed pixels.
-int computeTextureLookupDiff (const tcu::ConstPixelBufferAccess&	result,
-							  const tcu::ConstPixelBufferAccess&	reference,
-							  const tcu::PixelBufferAccess&			errorMask,
-							  const tcu::Texture1DView&				baseView,
-							  const float*							texCoord,
-							  const ReferenceParams&				sampleParams,
-							  const tcu::LookupPrecision&			lookupPrec,
-							  const tcu::LodPrecision&				lodPrec,
-							  qpWatchDog*							watchDog)
+static int computeLookupDiffRows (const tcu::ConstPixelBufferAccess&	result,
+								  const tcu::ConstPixelBufferAccess&	reference,
+								  const tcu::PixelBufferAccess&			errorMask,
+								  const tcu::Texture1DView&				baseView,
+								  const float*							texCoord,
+								  const ReferenceParams&				sampleParams,
+								  const tcu::LookupPrecision&			lookupPrec,
+								  const tcu::LodPrecision&				lodPrec,
+								  const tcu::IVec2&						rows,
+								  qpWatchDog*							watchDog)
 {
 	DE_ASSERT(result.getWidth() == reference.getWidth() && result.getHeight() == reference.getHeight());
 	DE_ASSERT(result.getWidth() == errorMask.getWidth() && result.getHeight() == errorMask.getHeight());
@@ -1261,9 +1262,7 @@ int computeTextureLookupDiff (const tcu::ConstPixelBufferAccess&	result,
 		tcu::Vec2( 0, +1),
 	};
 
-	tcu::clear(errorMask, tcu::RGBA::green().toVec());
-
-	for (int py = 0; py < result.getHeight(); py++)
+	for (int py = rows.x(); py < rows.y(); py++)
 	{
 		// Ugly hack, validation can take way too long at the moment.
 		if (watchDog)
@@ -1325,15 +1324,16 @@ int computeTextureLookupDiff (const tcu::ConstPixelBufferAccess&	result,
 	return numFailed;
 }
 
-int computeTextureLookupDiff (const tcu::ConstPixelBufferAccess&	result,
-							  const tcu::ConstPixelBufferAccess&	reference,
-							  const tcu::PixelBufferAccess&			errorMask,
-							  const tcu::Texture2DView&				baseView,
-							  const float*							texCoord,
-							  const ReferenceParams&				sampleParams,
-							  const tcu::LookupPrecision&			lookupPrec,
-							  const tcu::LodPrecision&				lodPrec,
-							  qpWatchDog*							watchDog)
+static int computeLookupDiffRows (const tcu::ConstPixelBufferAccess&	result,
+								  const tcu::ConstPixelBufferAccess&	reference,
+								  const tcu::PixelBufferAccess&			errorMask,
+								  const tcu::Texture2DView&				baseView,
+								  const float*							texCoord,
+								  const ReferenceParams&				sampleParams,
+								  const tcu::LookupPrecision&			lookupPrec,
+								  const tcu::LodPrecision&				lodPrec,
+								  const tcu::IVec2&						rows,
+								  qpWatchDog*							watchDog)
 {
 	DE_ASSERT(result.getWidth() == reference.getWidth() && result.getHeight() == reference.getHeight());
 	DE_ASSERT(result.getWidth() == errorMask.getWidth() && result.getHeight() == errorMask.getHeight());
@@ -1368,9 +1368,7 @@ int computeTextureLookupDiff (const tcu::ConstPixelBufferAccess&	result,
 		tcu::Vec2( 0, +1),
 	};
 
-	tcu::clear(errorMask, tcu::RGBA::green().toVec());
-
-	for (int py = 0; py < result.getHeight(); py++)
+	for (int py = rows.x(); py < rows.y(); py++)
 	{
 		// Ugly hack, validation can take way too long at the moment.
 		if (watchDog)
@@ -1523,16 +1521,16 @@ bool verifyTextureResult (tcu::TestContext&						testCtx,
 	return numFailedPixels == 0;
 }
 
-//! Verifies texture lookup results and returns number of failed pixels.
-int computeTextureLookupDiff (const tcu::ConstPixelBufferAccess&	result,
-							  const tcu::ConstPixelBufferAccess&	reference,
-							  const tcu::PixelBufferAccess&			errorMask,
-							  const tcu::TextureCubeView&			baseView,
-							  const float*							texCoord,
-							  const ReferenceParams&				sampleParams,
-							  const tcu::LookupPrecision&			lookupPrec,
-							  const tcu::LodPrecision&				lodPrec,
-							  qpWatchDog*							watchDog)
+static int computeLookupDiffRows (const tcu::ConstPixelBufferAccess&	result,
+								  const tcu::ConstPixelBufferAccess&	reference,
+								  const tcu::PixelBufferAccess&			errorMask,
+								  const tcu::TextureCubeView&			baseView,
+								  const float*							texCoord,
+								  const ReferenceParams&				sampleParams,
+								  const tcu::LookupPrecision&			lookupPrec,
+								  const tcu::LodPrecision&				lodPrec,
+								  const tcu::IVec2&						rows,
+								  qpWatchDog*							watchDog)
 {
 	DE_ASSERT(result.getWidth() == reference.getWidth() && result.getHeight() == reference.getHeight());
 	DE_ASSERT(result.getWidth() == errorMask.getWidth() && result.getHeight() == errorMask.getHeight());
@@ -1575,9 +1573,7 @@ int computeTextureLookupDiff (const tcu::ConstPixelBufferAccess&	result,
 		tcu::Vec2(+1, +1),
 	};
 
-	tcu::clear(errorMask, tcu::RGBA::green().toVec());
-
-	for (int py = 0; py < result.getHeight(); py++)
+	for (int py = rows.x(); py < rows.y(); py++)
 	{
 		// Ugly hack, validation can take way too long at the moment.
 		if (watchDog)
@@ -1703,16 +1699,16 @@ bool verifyTextureResult (tcu::TestContext&						testCtx,
 	return numFailedPixels == 0;
 }
 
-//! Verifies texture lookup results and returns number of failed pixels.
-int computeTextureLookupDiff (const tcu::ConstPixelBufferAccess&	result,
-							  const tcu::ConstPixelBufferAccess&	reference,
-							  const tcu::PixelBufferAccess&			errorMask,
-							  const tcu::Texture3DView&				baseView,
-							  const float*							texCoord,
-							  const ReferenceParams&				sampleParams,
-							  const tcu::LookupPrecision&			lookupPrec,
-							  const tcu::LodPrecision&				lodPrec,
-							  qpWatchDog*							watchDog)
+static int computeLookupDiffRows (const tcu::ConstPixelBufferAccess&	result,
+								  const tcu::ConstPixelBufferAccess&	reference,
+								  const tcu::PixelBufferAccess&			errorMask,
+								  const tcu::Texture3DView&				baseView,
+								  const float*							texCoord,
+								  const ReferenceParams&				sampleParams,
+								  const tcu::LookupPrecision&			lookupPrec,
+								  const tcu::LodPrecision&				lodPrec,
+								  const tcu::IVec2&						rows,
+								  qpWatchDog*							watchDog)
 {
 	DE_ASSERT(result.getWidth() == reference.getWidth() && result.getHeight() == reference.getHeight());
 	DE_ASSERT(result.getWidth() == errorMask.getWidth() && result.getHeight() == errorMask.getHeight());
@@ -1749,9 +1745,7 @@ int computeTextureLookupDiff (const tcu::ConstPixelBufferAccess&	result,
 		tcu::Vec2( 0, +1),
 	};
 
-	tcu::clear(errorMask, tcu::RGBA::green().toVec());
-
-	for (int py = 0; py < result.getHeight(); py++)
+	for (int py = rows.x(); py < rows.y(); py++)
 	{
 		// Ugly hack, validation can take way too long at the moment.
 		if (watchDog)
@@ -1874,16 +1868,16 @@ bool verifyTextureResult (tcu::TestContext&						testCtx,
 	return numFailedPixels == 0;
 }
 
-//! Verifies texture lookup results and returns number of failed pixels.
-int computeTextureLookupDiff (const tcu::ConstPixelBufferAccess&	result,
-							  const tcu::ConstPixelBufferAccess&	reference,
-							  const tcu::PixelBufferAccess&			errorMask,
-							  const tcu::Texture1DArrayView&		baseView,
-							  const float*							texCoord,
-							  const ReferenceParams&				sampleParams,
-							  const tcu::LookupPrecision&			lookupPrec,
-							  const tcu::LodPrecision&				lodPrec,
-							  qpWatchDog*							watchDog)
+static int computeLookupDiffRows (const tcu::ConstPixelBufferAccess&	result,
+								  const tcu::ConstPixelBufferAccess&	reference,
+								  const tcu::PixelBufferAccess&			errorMask,
+								  const tcu::Texture1DArrayView&		baseView,
+								  const float*							texCoord,
+								  const ReferenceParams&				sampleParams,
+								  const tcu::LookupPrecision&			lookupPrec,
+								  const tcu::LodPrecision&				lodPrec,
+								  const tcu::IVec2&						rows,
+								  qpWatchDog*							watchDog)
 {
 	DE_ASSERT(result.getWidth() == reference.getWidth() && result.getHeight() == reference.getHeight());
 	DE_ASSERT(result.getWidth() == errorMask.getWidth() && result.getHeight() == errorMask.getHeight());
@@ -1916,9 +1910,7 @@ int computeTextureLookupDiff (const tcu::ConstPixelBufferAccess&	result,
 		tcu::Vec2( 0, +1),
 	};
 
-	tcu::clear(errorMask, tcu::RGBA::green().toVec());
-
-	for (int py = 0; py < result.getHeight(); py++)
+	for (int py = rows.x(); py < rows.y(); py++)
 	{
 		// Ugly hack, validation can take way too long at the moment.
 		if (watchDog)
@@ -1981,16 +1973,16 @@ int computeTextureLookupDiff (const tcu::ConstPixelBufferAccess&	result,
 	return numFailed;
 }
 
-//! Verifies texture lookup results and returns number of failed pixels.
-int computeTextureLookupDiff (const tcu::ConstPixelBufferAccess&	result,
-							  const tcu::ConstPixelBufferAccess&	reference,
-							  const tcu::PixelBufferAccess&			errorMask,
-							  const tcu::Texture2DArrayView&		baseView,
-							  const float*							texCoord,
-							  const ReferenceParams&				sampleParams,
-							  const tcu::LookupPrecision&			lookupPrec,
-							  const tcu::LodPrecision&				lodPrec,
-							  qpWatchDog*							watchDog)
+static int computeLookupDiffRows (const tcu::ConstPixelBufferAccess&	result,
+								  const tcu::ConstPixelBufferAccess&	reference,
+								  const tcu::PixelBufferAccess&			errorMask,
+								  const tcu::Texture2DArrayView&		baseView,
+								  const float*							texCoord,
+								  const ReferenceParams&				sampleParams,
+								  const tcu::LookupPrecision&			lookupPrec,
+								  const tcu::LodPrecision&				lodPrec,
+								  const tcu::IVec2&						rows,
+								  qpWatchDog*							watchDog)
 {
 	DE_ASSERT(result.getWidth() == reference.getWidth() && result.getHeight() == reference.getHeight());
 	DE_ASSERT(result.getWidth() == errorMask.getWidth() && result.getHeight() == errorMask.getHeight());
@@ -2025,9 +2017,7 @@ int computeTextureLookupDiff (const tcu::ConstPixelBufferAccess&	result,
 		tcu::Vec2( 0, +1),
 	};
 
-	tcu::clear(errorMask, tcu::RGBA::green().toVec());
-
-	for (int py = 0; py < result.getHeight(); py++)
+	for (int py = rows.x(); py < rows.y(); py++)
 	{
 		// Ugly hack, validation can take way too long at the moment.
 		if (watchDog)
@@ -2167,17 +2157,17 @@ bool verifyTextureResult (tcu::TestContext&						testCtx,
 	return numFailedPixels == 0;
 }
 
-//! Verifies texture lookup results and returns number of failed pixels.
-int computeTextureLookupDiff (const tcu::ConstPixelBufferAccess&	result,
-							  const tcu::ConstPixelBufferAccess&	reference,
-							  const tcu::PixelBufferAccess&			errorMask,
-							  const tcu::TextureCubeArrayView&		baseView,
-							  const float*							texCoord,
-							  const ReferenceParams&				sampleParams,
-							  const tcu::LookupPrecision&			lookupPrec,
-							  const tcu::IVec4&						coordBits,
-							  const tcu::LodPrecision&				lodPrec,
-							  qpWatchDog*							watchDog)
+static int computeLookupDiffRows (const tcu::ConstPixelBufferAccess&	result,
+								  const tcu::ConstPixelBufferAccess&	reference,
+								  const tcu::PixelBufferAccess&			errorMask,
+								  const tcu::TextureCubeArrayView&		baseView,
+								  const float*							texCoord,
+								  const ReferenceParams&				sampleParams,
+								  const tcu::LookupPrecision&			lookupPrec,
+								  const tcu::IVec4&						coordBits,
+								  const tcu::LodPrecision&				lodPrec,
+								  const tcu::IVec2&						rows,
+								  qpWatchDog*							watchDog)
 {
 	DE_ASSERT(result.getWidth() == reference.getWidth() && result.getHeight() == reference.getHeight());
 	DE_ASSERT(result.getWidth() == errorMask.getWidth() && result.getHeight() == errorMask.getHeight());
@@ -2222,9 +2212,7 @@ int computeTextureLookupDiff (const tcu::ConstPixelBufferAccess&	result,
 		tcu::Vec2(+1, +1),
 	};
 
-	tcu::clear(errorMask, tcu::RGBA::green().toVec());
-
-	for (int py = 0; py < result.getHeight(); py++)
+	for (int py = rows.x(); py < rows.y(); py++)
 	{
 		// Ugly hack, validation can take way too long at the moment.
 		if (watchDog)
@@ -2315,6 +2303,215 @@ int computeTextureLookupDiff (const tcu::ConstPixelBufferAccess&	result,
 	return numFailed;
 }
 
+// Parallel texture lookup verification
+
+enum
+{
+	LOOKUP_DIFF_CHUNK_ROWS	= 4		//!< Result rows verified per parallelFor() chunk
+};
+
+/*--------------------------------------------------------------------*//*!
+ * \brief Verify result rows in parallel
+ *
+ * Rows are independent: each pixel only writes its own error mask pixel,
+ * and the expensive per-pixel lookup verification does not touch shared
+ * state. Failure counts are stored per chunk and summed afterwards.
+ *//*--------------------------------------------------------------------*/
+template<typename TextureViewType>
+class LookupDiffTask : public de::RangeTask
+{
+public:
+	LookupDiffTask (const tcu::ConstPixelBufferAccess&	result,
+					const tcu::ConstPixelBufferAccess&	reference,
+					const tcu::PixelBufferAccess&		errorMask,
+					const TextureViewType&				baseView,
+					const float*						texCoord,
+					const ReferenceParams&				sampleParams,
+					const tcu::LookupPrecision&			lookupPrec,
+					const tcu::LodPrecision&			lodPrec,
+					qpWatchDog*							watchDog)
+		: m_result				(result)
+		, m_reference			(reference)
+		, m_errorMask			(errorMask)
+		, m_baseView			(baseView)
+		, m_texCoord			(texCoord)
+		, m_sampleParams		(sampleParams)
+		, m_lookupPrec			(lookupPrec)
+		, m_coordBits			(0)
+		, m_lodPrec				(lodPrec)
+		, m_watchDog			(watchDog)
+		, m_numFailedPerChunk	(errorMask.getHeight(), 0)
+	{
+	}
+
+	LookupDiffTask (const tcu::ConstPixelBufferAccess&	result,
+					const tcu::ConstPixelBufferAccess&	reference,
+					const tcu::PixelBufferAccess&		errorMask,
+					const TextureViewType&				baseView,
+					const float*						texCoord,
+					const ReferenceParams&				sampleParams,
+					const tcu::LookupPrecision&			lookupPrec,
+					const tcu::IVec4&					coordBits,
+					const tcu::LodPrecision&			lodPrec,
+					qpWatchDog*							watchDog)
+		: m_result				(result)
+		, m_reference			(reference)
+		, m_errorMask			(errorMask)
+		, m_baseView			(baseView)
+		, m_texCoord			(texCoord)
+		, m_sampleParams		(sampleParams)
+		, m_lookupPrec			(lookupPrec)
+		, m_coordBits			(coordBits)
+		, m_lodPrec				(lodPrec)
+		, m_watchDog			(watchDog)
+		, m_numFailedPerChunk	(errorMask.getHeight(), 0)
+	{
+	}
+
+	//! Verifies all rows and returns number of failed pixels
+	int execute (void)
+	{
+		int numFailed = 0;
+
+		tcu::clear(m_errorMask, tcu::RGBA::green().toVec());
+
+		de::parallelFor(0, m_errorMask.getHeight(), LOOKUP_DIFF_CHUNK_ROWS, *this);
+
+		for (size_t ndx = 0; ndx < m_numFailedPerChunk.size(); ndx++)
+			numFailed += m_numFailedPerChunk[ndx];
+
+		return numFailed;
+	}
+
+	void run (int begin, int end)
+	{
+		// Chunks are disjoint, so each writes to a separate slot
+		m_numFailedPerChunk[begin] = verifyRows(tcu::IVec2(begin, end));
+	}
+
+private:
+	int verifyRows (const tcu::IVec2& rows) const
+	{
+		return computeLookupDiffRows(m_result, m_reference, m_errorMask, m_baseView, m_texCoord, m_sampleParams, m_lookupPrec, m_lodPrec, rows, m_watchDog);
+	}
+
+	const tcu::ConstPixelBufferAccess&	m_result;
+	const tcu::ConstPixelBufferAccess&	m_reference;
+	const tcu::PixelBufferAccess&		m_errorMask;
+	const TextureViewType&				m_baseView;
+	const float* const					m_texCoord;
+	const ReferenceParams&				m_sampleParams;
+	const tcu::LookupPrecision&			m_lookupPrec;
+	const tcu::IVec4					m_coordBits;		//!< Only used for cube map arrays
+	const tcu::LodPrecision&			m_lodPrec;
+	qpWatchDog* const					m_watchDog;
+	std::vector<int>					m_numFailedPerChunk;
+};
+
+template<>
+int LookupDiffTask<tcu::TextureCubeArrayView>::verifyRows (const tcu::IVec2& rows) const
+{
+	return computeLookupDiffRows(m_result, m_reference, m_errorMask, m_baseView, m_texCoord, m_sampleParams, m_lookupPrec, m_coordBits, m_lodPrec, rows, m_watchDog);
+}
+
+//! Verifies texture lookup results and returns number of failed pixels.
+int computeTextureLookupDiff (const tcu::ConstPixelBufferAccess&	result,
+							  const tcu::ConstPixelBufferAccess&	reference,
+							  const tcu::PixelBufferAccess&			errorMask,
+							  const tcu::Texture1DView&				baseView,
+							  const float*							texCoord,
+							  const ReferenceParams&				sampleParams,
+							  const tcu::LookupPrecision&			lookupPrec,
+							  const tcu::LodPrecision&				lodPrec,
+							  qpWatchDog*							watchDog)
+{
+	return LookupDiffTask<tcu::Texture1DView>(result, reference, errorMask, baseView, texCoord, sampleParams, lookupPrec, lodPrec, watchDog).execute();
+}
+
+int computeTextureLookupDiff (const tcu::ConstPixelBufferAccess&	result,
+							  const tcu::ConstPixelBufferAccess&	reference,
+							  const tcu::PixelBufferAccess&			errorMask,
+							  const tcu::Texture2DView&				baseView,
+							  const float*							texCoord,
+							  const ReferenceParams&				sampleParams,
+							  const tcu::LookupPrecision&			lookupPrec,
+							  const tcu::LodPrecision&				lodPrec,
+							  qpWatchDog*							watchDog)
+{
+	return LookupDiffTask<tcu::Texture2DView>(result, reference, errorMask, baseView, texCoord, sampleParams, lookupPrec, lodPrec, watchDog).execute();
+}
+
+//! Verifies texture lookup results and returns number of failed pixels.
+int computeTextureLookupDiff (const tcu::ConstPixelBufferAccess&	result,
+							  const tcu::ConstPixelBufferAccess&	reference,
+							  const tcu::PixelBufferAccess&			errorMask,
+							  const tcu::TextureCubeView&			baseView,
+							  const float*							texCoord,
+							  const ReferenceParams&				sampleParams,
+							  const tcu::LookupPrecision&			lookupPrec,
+							  const tcu::LodPrecision&				lodPrec,
+							  qpWatchDog*							watchDog)
+{
+	return LookupDiffTask<tcu::TextureCubeView>(result, reference, errorMask, baseView, texCoord, sampleParams, lookupPrec, lodPrec, watchDog).execute();
+}
+
+//! Verifies texture lookup results and returns number of failed pixels.
+int computeTextureLookupDiff (const tcu::ConstPixelBufferAccess&	result,
+							  const tcu::ConstPixelBufferAccess&	reference,
+							  const tcu::PixelBufferAccess&			errorMask,
+							  const tcu::Texture3DView&				baseView,
+							  const float*							texCoord,
+							  const ReferenceParams&				sampleParams,
+							  const tcu::LookupPrecision&			lookupPrec,
+							  const tcu::LodPrecision&				lodPrec,
+							  qpWatchDog*							watchDog)
+{
+	return LookupDiffTask<tcu::Texture3DView>(result, reference, errorMask, baseView, texCoord, sampleParams, lookupPrec, lodPrec, watchDog).execute();
+}
+
+//! Verifies texture lookup results and returns number of failed pixels.
+int computeTextureLookupDiff (const tcu::ConstPixelBufferAccess&	result,
+							  const tcu::ConstPixelBufferAccess&	reference,
+							  const tcu::PixelBufferAccess&			errorMask,
+							  const tcu::Texture1DArrayView&		baseView,
+							  const float*							texCoord,
+							  const ReferenceParams&				sampleParams,
+							  const tcu::LookupPrecision&			lookupPrec,
+							  const tcu::LodPrecision&				lodPrec,
+							  qpWatchDog*							watchDog)
+{
+	return LookupDiffTask<tcu::Texture1DArrayView>(result, reference, errorMask, baseView, texCoord, sampleParams, lookupPrec, lodPrec, watchDog).execute();
+}
+
+//! Verifies texture lookup results and returns number of failed pixels.
+int computeTextureLookupDiff (const tcu::ConstPixelBufferAccess&	result,
+							  const tcu::ConstPixelBufferAccess&	reference,
+							  const tcu::PixelBufferAccess&			errorMask,
+							  const tcu::Texture2DArrayView&		baseView,
+							  const float*							texCoord,
+							  const ReferenceParams&				sampleParams,
+							  const tcu::LookupPrecision&			lookupPrec,
+							  const tcu::LodPrecision&				lodPrec,
+							  qpWatchDog*							watchDog)
+{
+	return LookupDiffTask<tcu::Texture2DArrayView>(result, reference, errorMask, baseView, texCoord, sampleParams, lookupPrec, lodPrec, watchDog).execute();
+}
+
+//! Verifies texture lookup results and returns number of failed pixels.
+int computeTextureLookupDiff (const tcu::ConstPixelBufferAccess&	result,
+							  const tcu::ConstPixelBufferAccess&	reference,
+							  const tcu::PixelBufferAccess&			errorMask,
+							  const tcu::TextureCubeArrayView&		baseView,
+							  const float*							texCoord,
+							  const ReferenceParams&				sampleParams,
+							  const tcu::LookupPrecision&			lookupPrec,
+							  const tcu::IVec4&						coordBits,
+							  const tcu::LodPrecision&				lodPrec,
+							  qpWatchDog*							watchDog)
+{
+	return LookupDiffTask<tcu::TextureCubeArrayView>(result, reference, errorMask, baseView, texCoord, sampleParams, lookupPrec, coordBits, lodPrec, watchDog).execute();
+}
+
 bool verifyTextureResult (tcu::TestContext&						testCtx,
 						  const tcu::ConstPixelBufferAccess&	result,
 						  const tcu::TextureCubeArrayView&		src,
@@ -245,6 +245,7 @@ ReferenceContextLimits::ReferenceContextLimits (const glu::RenderContext& render
 	, maxRenderbufferSize		(0)
 	, maxVertexAttribs			(0)
 	, subpixelBits				(0)
+	, numRasterThreads			(1)
 {
 	const glw::Functions& gl = renderCtx.getFunctions();
 
@@ -4294,6 +4295,8 @@ void ReferenceContext::drawWithReference (const rr::PrimitiveList& primitives, i
 													 (m_currentProgram->m_program->m_hasGeometryShader) ? (m_currentProgram->m_program->getGeometryShader()) : (DE_NULL));
 	rr::RenderState						state		((rr::ViewportState)(colorBuf0), m_limits.subpixelBits);
 
+	state.numRasterThreads = m_limits.numRasterThreads;
+
 	const rr::Renderer					referenceRenderer;
 	std::vector<rr::VertexAttrib>		vertexAttribs;
 
@@ -564,6 +564,7 @@ struct ReferenceContextLimits
 		, maxRenderbufferSize		(2048)
 		, maxVertexAttribs			(16)
 		, subpixelBits				(rr::RenderState::DEFAULT_SUBPIXEL_BITS)
+		, numRasterThreads			(1)
 	{
 	}
 
@@ -581,6 +582,7 @@ struct ReferenceContextLimits
 	int							maxRenderbufferSize;
 	int							maxVertexAttribs;
 	int							subpixelBits;
+	int							numRasterThreads;	//!< See rr::RenderState::numRasterThreads. Shader programs must be thread-safe if greater than 1.
 
 	// Both variants are needed since there are glGetString() and glGetStringi()
 	std::vector<std::string>	extensionList;
@@ -43,6 +43,8 @@
 #if (DE_OS == DE_OS_WIN32)
 #	include <windows.h>
 #	include <io.h>
+#else
+#	include <unistd.h>
 #endif
 
 #if defined(DE_DEBUG)
@@ -376,6 +378,232 @@ qpTestLog* qpTestLog_createFileLog (const char* fileName, deUint32 flags)
 	return log;
 }
 
+/*--------------------------------------------------------------------*//*!
+ * \brief Create a logger instance that buffers cases in a temporary file
+ *
+ * No session header is written to a buffer log. Completed cases are
+ * copied into another log with qpTestLog_appendBufferLog(). Pass
+ * QP_TEST_LOG_NO_FLUSH unless the buffer is read by another process
+ * while it is being written.
+ *
+ * \param flags Logging flags
+ * \return qpTestLog instance, or DE_NULL if cannot create temporary file
+ *//*--------------------------------------------------------------------*/
+qpTestLog* qpTestLog_createBufferLog (deUint32 flags)
+{
+	qpTestLog* log = (qpTestLog*)deCalloc(sizeof(qpTestLog));
+	if (!log)
+		return DE_NULL;
+
+#if defined(DE_DEBUG)
+	ContainerStack_reset(&log->containerStack);
+#endif
+
+	log->outputFile = tmpfile();
+	if (!log->outputFile)
+	{
+		qpPrintf("ERROR: Unable to create temporary test log file.\n");
+		qpTestLog_destroy(log);
+		return DE_NULL;
+	}
+
+	log->flags			= flags;
+	log->writer			= qpXmlWriter_createFileWriter(log->outputFile, 0, !(flags & QP_TEST_LOG_NO_FLUSH));
+	log->lock			= deMutex_create(DE_NULL);
+	log->isSessionOpen	= DE_FALSE;
+	log->isCaseOpen		= DE_FALSE;
+
+	if (!log->writer || !log->lock)
+	{
+		qpPrintf("ERROR: Unable to create buffer log.\n");
+		qpTestLog_destroy(log);
+		return DE_NULL;
+	}
+
+	return log;
+}
+
+/* Copy everything written to bufferLog to the end of log. Caller holds both locks. */
+static deBool copyBufferLog (qpTestLog* log, qpTestLog* bufferLog)
+{
+	deUint8	buffer[64*1024];
+	deBool	isOk	= DE_TRUE;
+
+	qpXmlWriter_flush(bufferLog->writer);
+	qpXmlWriter_flush(log->writer);
+
+	if (fflush(bufferLog->outputFile) != 0 || fseek(bufferLog->outputFile, 0, SEEK_SET) != 0)
+		isOk = DE_FALSE;
+
+	while (isOk)
+	{
+		const size_t numRead = fread(&buffer[0], 1, sizeof(buffer), bufferLog->outputFile);
+
+		if (numRead > 0 && fwrite(&buffer[0], 1, numRead, log->outputFile) != numRead)
+			isOk = DE_FALSE;
+
+		if (numRead < sizeof(buffer))
+		{
+			if (ferror(bufferLog->outputFile))
+				isOk = DE_FALSE;
+			break;
+		}
+	}
+
+	/* Keep appending to the end of the buffer. */
+	if (fseek(bufferLog->outputFile, 0, SEEK_END) != 0)
+		isOk = DE_FALSE;
+
+	return isOk;
+}
+
+/*--------------------------------------------------------------------*//*!
+ * \brief Append contents of a buffer log
+ *
+ * Copies everything written to bufferLog since its creation or last
+ * qpTestLog_clearBufferLog() into log. Neither log may have a case open.
+ *
+ * \param log qpTestLog instance
+ * \param bufferLog Log created with qpTestLog_createBufferLog()
+ * \return true if ok, false otherwise
+ *//*--------------------------------------------------------------------*/
+deBool qpTestLog_appendBufferLog (qpTestLog* log, qpTestLog* bufferLog)
+{
+	deBool isOk;
+
+	DE_ASSERT(log && bufferLog && log != bufferLog);
+	DE_ASSERT(!bufferLog->isSessionOpen);
+
+	deMutex_lock(bufferLog->lock);
+	deMutex_lock(log->lock);
+
+	DE_ASSERT(!log->isCaseOpen && !bufferLog->isCaseOpen);
+
+	isOk = copyBufferLog(log, bufferLog);
+
+	if (isOk && !(log->flags & QP_TEST_LOG_NO_FLUSH))
+		qpTestLog_flushFile(log);
+
+	if (!isOk)
+		qpPrintf("qpTestLog_appendBufferLog(): Copying buffered log failed\n");
+
+	deMutex_unlock(log->lock);
+	deMutex_unlock(bufferLog->lock);
+
+	return isOk;
+}
+
+/*--------------------------------------------------------------------*//*!
+ * \brief Append an unfinished case from a buffer log and terminate it
+ *
+ * Used for cases whose process was terminated while the case was being
+ * written into bufferLog by another process. bufferLog must contain
+ * nothing but the start of a single case. The partial case is copied
+ * into log and terminated as with qpTestLog_terminateCase().
+ *
+ * \param log qpTestLog instance
+ * \param bufferLog Log created with qpTestLog_createBufferLog()
+ * \param result Result code, only Crash and Timeout are allowed.
+ * \return true if ok, false otherwise
+ *//*--------------------------------------------------------------------*/
+deBool qpTestLog_appendTerminatedCase (qpTestLog* log, qpTestLog* bufferLog, qpTestResult result)
+{
+	const char*	resultStr	= QP_LOOKUP_STRING(s_qpTestResultMap, result);
+	deBool		isOk;
+
+	DE_ASSERT(log && bufferLog && log != bufferLog);
+	DE_ASSERT(result == QP_TEST_RESULT_CRASH || result == QP_TEST_RESULT_TIMEOUT);
+
+	deMutex_lock(bufferLog->lock);
+	deMutex_lock(log->lock);
+
+	DE_ASSERT(!log->isCaseOpen);
+
+	isOk = copyBufferLog(log, bufferLog);
+
+	if (isOk)
+	{
+		fprintf(log->outputFile, "\n#terminateTestCaseResult %s\n", resultStr);
+		qpTestLog_flushFile(log);
+	}
+	else
+		qpPrintf("qpTestLog_appendTerminatedCase(): Copying buffered log failed\n");
+
+	deMutex_unlock(log->lock);
+	deMutex_unlock(bufferLog->lock);
+
+	return isOk;
+}
+
+/*--------------------------------------------------------------------*//*!
+ * \brief Discard contents of a buffer log
+ *
+ * Truncates the temporary file, so that a process sharing the buffer
+ * log sees the truncation as well. No case may be open.
+ *
+ * \param bufferLog Log created with qpTestLog_createBufferLog()
+ * \return true if ok, false otherwise
+ *//*--------------------------------------------------------------------*/
+deBool qpTestLog_clearBufferLog (qpTestLog* bufferLog)
+{
+	deBool isOk = DE_TRUE;
+
+	DE_ASSERT(bufferLog && !bufferLog->isSessionOpen);
+
+	deMutex_lock(bufferLog->lock);
+
+	DE_ASSERT(!bufferLog->isCaseOpen);
+
+	qpXmlWriter_flush(bufferLog->writer);
+
+	if (fflush(bufferLog->outputFile) != 0)
+		isOk = DE_FALSE;
+
+#if (DE_OS == DE_OS_WIN32)
+	if (isOk && _chsize(_fileno(bufferLog->outputFile), 0) != 0)
+		isOk = DE_FALSE;
+#else
+	if (isOk && ftruncate(fileno(bufferLog->outputFile), 0) != 0)
+		isOk = DE_FALSE;
+#endif
+
+	if (isOk && fseek(bufferLog->outputFile, 0, SEEK_SET) != 0)
+		isOk = DE_FALSE;
+
+	if (!isOk)
+		qpPrintf("qpTestLog_clearBufferLog(): Truncating buffered log failed\n");
+
+	deMutex_unlock(bufferLog->lock);
+
+	return isOk;
+}
+
+/*--------------------------------------------------------------------*//*!
+ * \brief Check if anything has been written to a buffer log
+ *
+ * Also sees data written by other processes sharing the buffer log.
+ *
+ * \param bufferLog Log created with qpTestLog_createBufferLog()
+ * \return true if buffer log is empty
+ *//*--------------------------------------------------------------------*/
+deBool qpTestLog_isBufferLogEmpty (qpTestLog* bufferLog)
+{
+	deBool isEmpty;
+
+	DE_ASSERT(bufferLog && !bufferLog->isSessionOpen);
+
+	deMutex_lock(bufferLog->lock);
+
+	qpXmlWriter_flush(bufferLog->writer);
+	fflush(bufferLog->outputFile);
+
+	isEmpty = fseek(bufferLog->outputFile, 0, SEEK_END) == 0 && ftell(bufferLog->outputFile) == 0;
+
+	deMutex_unlock(bufferLog->lock);
+
+	return isEmpty;
+}
+
 /*--------------------------------------------------------------------*//*!
  * \brief Destroy a logger instance
  * \param a	qpTestLog instance
@@ -556,8 +784,8 @@ deBool qpTestLog_terminateCase (qpTestLog* log, qpTestResult result)
 		return DE_FALSE; /* Soft error. This is called from error handler. */
 	}
 
-	/* Flush XML and write #terminateTestCaseResult. */
-	qpXmlWriter_flush(log->writer);
+	/* Flush XML and write #terminateTestCaseResult. Log can be used for further cases. */
+	qpXmlWriter_abortDocument(log->writer);
 	fprintf(log->outputFile, "\n#terminateTestCaseResult %s\n", resultStr);
 	qpTestLog_flushFile(log);
 
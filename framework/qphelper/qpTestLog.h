@@ -189,8 +189,14 @@ typedef struct qpEglConfigInfo_s
 
 
 qpTestLog*		qpTestLog_createFileLog			(const char* fileName, deUint32 flags);
+qpTestLog*		qpTestLog_createBufferLog		(deUint32 flags);
 void			qpTestLog_destroy				(qpTestLog* log);
 
+deBool			qpTestLog_appendBufferLog		(qpTestLog* log, qpTestLog* bufferLog);
+deBool			qpTestLog_appendTerminatedCase	(qpTestLog* log, qpTestLog* bufferLog, qpTestResult result);
+deBool			qpTestLog_clearBufferLog		(qpTestLog* bufferLog);
+deBool			qpTestLog_isBufferLogEmpty		(qpTestLog* bufferLog);
+
 deBool			qpTestLog_startCase				(qpTestLog* log, const char* testCasePath, qpTestCaseType testCaseType);
 deBool			qpTestLog_endCase				(qpTestLog* log, qpTestResult result, const char* description);
 
@@ -24,8 +24,11 @@
 #include "qpWatchDog.h"
 
 #include "deThread.h"
+#include "deAtomic.h"
+#include "deSemaphore.h"
 #include "deClock.h"
 #include "deMemory.h"
+#include "deInt32.h"
 
 #include <stdio.h>
 
@@ -45,18 +48,33 @@ typedef enum Status_e
 
 struct qpWatchDog_s
 {
-	qpWatchDogFunc		timeOutFunc;
-	void*				timeOutUserPtr;
-	int					totalTimeLimit;			/* Total test case time limit in seconds	*/
-	int					intervalTimeLimit;		/* Iteration length limit in seconds		*/
+	qpWatchDogFunc			timeOutFunc;
+	void*					timeOutUserPtr;
+	int						defaultTotalTimeLimit;		/* Limits given to qpWatchDog_create()		*/
+	int						defaultIntervalTimeLimit;
+	volatile int			totalTimeLimit;				/* Total test case time limit in seconds	*/
+	volatile int			intervalTimeLimit;			/* Iteration length limit in seconds		*/
 
-	volatile deUint64	resetTime;
-	volatile deUint64	lastTouchTime;
+	volatile deUint64		resetTime;
+	volatile deUint64		lastTouchTime;
 
-	deThread			watchDogThread;
-	volatile Status		status;
+	/* Touch statistics, updated with atomics. Intervals are in microseconds, clamped to 32 bits. */
+	volatile deUint32		numTouches;
+	volatile deUint32		lastTouchInterval;
+	volatile deUint32		maxTouchInterval;
+	volatile deUint32		touchIntervalHistogram[QP_WATCHDOG_NUM_TOUCH_INTERVAL_BUCKETS];
+
+	deSemaphore				wakeUp;						/* Signaled when deadlines may have moved earlier or thread must stop */
+	deThread				watchDogThread;
+	volatile Status			status;
 };
 
+static deUint64 getDeadline (deUint64 startTime, int limitSecs)
+{
+	/* Limit is exceeded once number of whole seconds passed is greater than limit. */
+	return startTime + (deUint64)(limitSecs + 1) * 1000000ull;
+}
+
 static void watchDogThreadFunc (void* arg)
 {
 	qpWatchDog* dog = (qpWatchDog*)arg;
@@ -66,26 +84,33 @@ static void watchDogThreadFunc (void* arg)
 
 	while (dog->status == STATUS_THREAD_RUNNING)
 	{
-		deUint64	curTime					= deGetMicroseconds();
-		int			totalSecondsPassed		= (int)((curTime - dog->resetTime) / 1000000ull);
-		int			secondsSinceLastTouch	= (int)((curTime - dog->lastTouchTime) / 1000000ull);
-		deBool		overIntervalLimit		= secondsSinceLastTouch > dog->intervalTimeLimit;
-		deBool		overTotalLimit			= totalSecondsPassed > dog->totalTimeLimit;
+		/* \note Times are read before current time, so that they are never later than it. */
+		const deUint64	totalDeadline		= getDeadline(dog->resetTime, dog->totalTimeLimit);
+		const deUint64	intervalDeadline	= getDeadline(dog->lastTouchTime, dog->intervalTimeLimit);
+		const deUint64	curTime				= deGetMicroseconds();
+		const deBool	overIntervalLimit	= curTime >= intervalDeadline;
+		const deBool	overTotalLimit		= curTime >= totalDeadline;
 
 		if (overIntervalLimit || overTotalLimit)
 		{
-		    qpTimeoutReason reason = overTotalLimit ? QP_TIMEOUT_REASON_TOTAL_LIMIT : QP_TIMEOUT_REASON_INTERVAL_LIMIT;
+			qpTimeoutReason reason = overTotalLimit ? QP_TIMEOUT_REASON_TOTAL_LIMIT : QP_TIMEOUT_REASON_INTERVAL_LIMIT;
 			DBGPRINT(("watchDogThreadFunc(): call timeout func\n"));
 			dog->timeOutFunc(dog, dog->timeOutUserPtr, reason);
 			break;
 		}
 
-		deSleep(100);
+		/* Sleep until next deadline. Touches only move deadlines later, so they don't need to wake the thread. */
+		deSemaphore_timedDecrement(dog->wakeUp, deMinu64(totalDeadline, intervalDeadline) - curTime);
 	}
 
 	DBGPRINT(("watchDogThreadFunc(): stop\n"));
 }
 
+static void qpWatchDog_wakeUp (qpWatchDog* dog)
+{
+	deSemaphore_increment(dog->wakeUp);
+}
+
 qpWatchDog* qpWatchDog_create (qpWatchDogFunc timeOutFunc, void* userPtr, int totalTimeLimitSecs, int intervalTimeLimitSecs)
 {
 	/* Allocate & initialize. */
@@ -98,12 +123,20 @@ qpWatchDog* qpWatchDog_create (qpWatchDogFunc timeOutFunc, void* userPtr, int to
 
 	DBGPRINT(("qpWatchDog::create(%ds, %ds)\n", totalTimeLimitSecs, intervalTimeLimitSecs));
 
-	dog->timeOutFunc		= timeOutFunc;
-	dog->timeOutUserPtr		= userPtr;
-	dog->totalTimeLimit		= totalTimeLimitSecs;
-	dog->intervalTimeLimit	= intervalTimeLimitSecs;
+	dog->timeOutFunc				= timeOutFunc;
+	dog->timeOutUserPtr				= userPtr;
+	dog->defaultTotalTimeLimit		= totalTimeLimitSecs;
+	dog->defaultIntervalTimeLimit	= intervalTimeLimitSecs;
+
+	dog->wakeUp						= deSemaphore_create(0, DE_NULL);
+
+	if (!dog->wakeUp)
+	{
+		deFree(dog);
+		return DE_NULL;
+	}
 
-	/* Reset (sets time values). */
+	/* Reset (sets time values and limits). */
 	qpWatchDog_reset(dog);
 
 	/* Initialize watchdog thread. */
@@ -111,6 +144,7 @@ qpWatchDog* qpWatchDog_create (qpWatchDogFunc timeOutFunc, void* userPtr, int to
 	dog->watchDogThread = deThread_create(watchDogThreadFunc, dog, DE_NULL);
 	if (!dog->watchDogThread)
 	{
+		deSemaphore_destroy(dog->wakeUp);
 		deFree(dog);
 		return DE_NULL;
 	}
@@ -120,13 +154,31 @@ qpWatchDog* qpWatchDog_create (qpWatchDogFunc timeOutFunc, void* userPtr, int to
 
 void qpWatchDog_reset (qpWatchDog* dog)
 {
-	deUint64 curTime = deGetMicroseconds();
+	deUint64	curTime			= deGetMicroseconds();
+	deBool		limitsShrink;
+	int			bucketNdx;
 
 	DE_ASSERT(dog);
 	DBGPRINT(("qpWatchDog::reset()\n"));
 
+	/* \note Limits overridden with qpWatchDog_setTimeLimits() may be longer than the defaults. */
+	limitsShrink			= dog->totalTimeLimit > dog->defaultTotalTimeLimit || dog->intervalTimeLimit > dog->defaultIntervalTimeLimit;
+
 	dog->resetTime			= curTime;
 	dog->lastTouchTime		= curTime;
+	dog->totalTimeLimit		= dog->defaultTotalTimeLimit;
+	dog->intervalTimeLimit	= dog->defaultIntervalTimeLimit;
+
+	dog->numTouches			= 0;
+	dog->lastTouchInterval	= 0;
+	dog->maxTouchInterval	= 0;
+
+	for (bucketNdx = 0; bucketNdx < QP_WATCHDOG_NUM_TOUCH_INTERVAL_BUCKETS; bucketNdx++)
+		dog->touchIntervalHistogram[bucketNdx] = 0;
+
+	/* Deadlines may have moved earlier. The thread is not running yet when called from qpWatchDog_create(). */
+	if (limitsShrink)
+		qpWatchDog_wakeUp(dog);
 }
 
 void qpWatchDog_destroy (qpWatchDog* dog)
@@ -136,16 +188,96 @@ void qpWatchDog_destroy (qpWatchDog* dog)
 
 	/* Finish the watchdog thread. */
 	dog->status = STATUS_STOP_THREAD;
+	qpWatchDog_wakeUp(dog);
 	deThread_join(dog->watchDogThread);
 	deThread_destroy(dog->watchDogThread);
 
+	deSemaphore_destroy(dog->wakeUp);
+
 	DBGPRINT(("qpWatchDog::destroy() finished\n"));
 	deFree(dog);
 }
 
+static int getTouchIntervalBucket (deUint64 intervalUs)
+{
+	const deUint64 intervalMs = intervalUs / 1000u;
+
+	if (intervalMs == 0)
+		return 0;
+	else if (intervalMs >= (1u << (QP_WATCHDOG_NUM_TOUCH_INTERVAL_BUCKETS-2)))
+		return QP_WATCHDOG_NUM_TOUCH_INTERVAL_BUCKETS-1;
+	else
+		return deLog2Floor32((deInt32)intervalMs) + 1;
+}
+
 void qpWatchDog_touch (qpWatchDog* dog)
 {
+	deUint64	curTime;
+	deUint64	prevTouchTime;
+	deUint64	interval;
+	deUint32	interval32;
+	deUint32	maxInterval;
+
 	DE_ASSERT(dog);
 	DBGPRINT(("qpWatchDog::touch()\n"));
-	dog->lastTouchTime = deGetMicroseconds();
+
+	/* \note Touches may come from several threads (e.g. parallelFor() workers), so another thread may have stored a
+	 *		 later touch time after curTime was read. Such overlapping touches count as zero intervals and don't move
+	 *		 the last touch time backwards. */
+	curTime				= deGetMicroseconds();
+	prevTouchTime		= dog->lastTouchTime;
+	interval			= curTime > prevTouchTime ? curTime - prevTouchTime : 0;
+	interval32			= (deUint32)deMinu64(interval, 0xffffffffu);
+
+	if (curTime > prevTouchTime)
+		dog->lastTouchTime = curTime;
+
+	deAtomicIncrementUint32(&dog->numTouches);
+	deAtomicIncrementUint32(&dog->touchIntervalHistogram[getTouchIntervalBucket(interval)]);
+	dog->lastTouchInterval = interval32;
+
+	maxInterval = dog->maxTouchInterval;
+	while (interval32 > maxInterval)
+	{
+		const deUint32 prevMax = deAtomicCompareExchangeUint32(&dog->maxTouchInterval, maxInterval, interval32);
+
+		if (prevMax == maxInterval)
+			break;
+
+		maxInterval = prevMax;
+	}
+}
+
+void qpWatchDog_setTimeLimits (qpWatchDog* dog, int totalTimeLimitSecs, int intervalTimeLimitSecs)
+{
+	DE_ASSERT(dog);
+	DE_ASSERT((totalTimeLimitSecs >= 0) && (intervalTimeLimitSecs >= 0));
+	DBGPRINT(("qpWatchDog::setTimeLimits(%ds, %ds)\n", totalTimeLimitSecs, intervalTimeLimitSecs));
+
+	dog->totalTimeLimit		= totalTimeLimitSecs > 0 ? totalTimeLimitSecs : dog->defaultTotalTimeLimit;
+	dog->intervalTimeLimit	= intervalTimeLimitSecs > 0 ? intervalTimeLimitSecs : dog->defaultIntervalTimeLimit;
+
+	/* Deadlines may have moved earlier. */
+	qpWatchDog_wakeUp(dog);
+}
+
+int qpWatchDog_getIntervalTimeLimit (const qpWatchDog* dog)
+{
+	DE_ASSERT(dog);
+	return dog->intervalTimeLimit;
+}
+
+void qpWatchDog_getTouchStats (qpWatchDog* dog, qpWatchDogTouchStats* stats)
+{
+	int bucketNdx;
+
+	DE_ASSERT(dog && stats);
+
+	/* Counters are read one at a time, so a snapshot taken during touches may be slightly inconsistent. */
+	stats->numTouches	= (int)dog->numTouches;
+	stats->lastInterval	= dog->lastTouchInterval;
+	stats->maxInterval	= dog->maxTouchInterval;
+
+	for (bucketNdx = 0; bucketNdx < QP_WATCHDOG_NUM_TOUCH_INTERVAL_BUCKETS; bucketNdx++)
+		stats->intervalHistogram[bucketNdx] = (int)dog->touchIntervalHistogram[bucketNdx];
 }
@@ -37,12 +37,39 @@ typedef enum qpTimeoutReason_e
 
 typedef void		(*qpWatchDogFunc)		(qpWatchDog* dog, void* userPtr, qpTimeoutReason reason);
 
+enum
+{
+	QP_WATCHDOG_NUM_TOUCH_INTERVAL_BUCKETS = 16
+};
+
+/*--------------------------------------------------------------------*//*!
+ * \brief Statistics of touch intervals since last reset
+ *
+ * Interval is time from previous touch, or from reset for the first touch.
+ * Histogram bucket 0 counts intervals shorter than 1ms, bucket N intervals
+ * of [2^(N-1), 2^N) ms. Last bucket also counts all longer intervals.
+ * Interval lengths saturate at 2^32-1 us.
+ *//*--------------------------------------------------------------------*/
+typedef struct qpWatchDogTouchStats_s
+{
+	int			numTouches;
+	deUint64	lastInterval;											/* Microseconds */
+	deUint64	maxInterval;											/* Microseconds */
+	int			intervalHistogram[QP_WATCHDOG_NUM_TOUCH_INTERVAL_BUCKETS];
+} qpWatchDogTouchStats;
+
 DE_BEGIN_EXTERN_C
 
-qpWatchDog*		qpWatchDog_create		(qpWatchDogFunc watchDogFunc, void* userPtr, int totalTimeLimitSecs, int intervalTimeLimitSecs);
-void			qpWatchDog_destroy		(qpWatchDog* dog);
-void			qpWatchDog_reset		(qpWatchDog* dog);
-void			qpWatchDog_touch		(qpWatchDog* dog);
+qpWatchDog*		qpWatchDog_create				(qpWatchDogFunc watchDogFunc, void* userPtr, int totalTimeLimitSecs, int intervalTimeLimitSecs);
+void			qpWatchDog_destroy				(qpWatchDog* dog);
+void			qpWatchDog_reset				(qpWatchDog* dog);
+void			qpWatchDog_touch				(qpWatchDog* dog);
+
+/* Override time limits until next reset. Zero limit keeps limit given to qpWatchDog_create(). */
+void			qpWatchDog_setTimeLimits		(qpWatchDog* dog, int totalTimeLimitSecs, int intervalTimeLimitSecs);
+int				qpWatchDog_getIntervalTimeLimit	(const qpWatchDog* dog);
+
+void			qpWatchDog_getTouchStats		(qpWatchDog* dog, qpWatchDogTouchStats* stats);
 
 DE_END_EXTERN_C
 
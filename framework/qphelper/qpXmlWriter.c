@@ -185,6 +185,14 @@ deBool qpXmlWriter_endDocument (qpXmlWriter* writer)
 	return DE_TRUE;
 }
 
+void qpXmlWriter_abortDocument (qpXmlWriter* writer)
+{
+	DE_ASSERT(writer);
+	closePending(writer);
+	writer->xmlIsWriting			= DE_FALSE;
+	writer->xmlElementDepth			= 0;
+}
+
 deBool qpXmlWriter_writeString (qpXmlWriter* writer, const char* str)
 {
 	if (writer->xmlPrevIsStartElement)
@@ -116,6 +116,12 @@ deBool			qpXmlWriter_startDocument (qpXmlWriter* writer);
  *//*--------------------------------------------------------------------*/
 deBool			qpXmlWriter_endDocument (qpXmlWriter* writer);
 
+/*--------------------------------------------------------------------*//*!
+ * \brief Abandon XML document without closing open elements
+ * \param writer qpXmlWriter instance
+ *//*--------------------------------------------------------------------*/
+void			qpXmlWriter_abortDocument (qpXmlWriter* writer);
+
 /*--------------------------------------------------------------------*//*!
  * \brief Start XML element
  * \param writer qpXmlWriter instance
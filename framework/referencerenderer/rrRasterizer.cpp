@@ -534,6 +534,23 @@ void TriangleRasterizer::init (const tcu::Vec4& v0, const tcu::Vec4& v1, const t
 	m_curPos = m_bboxMin;
 }
 
+/*--------------------------------------------------------------------*//*!
+ * \brief Skip quads that do not touch rows [rows.x(), rows.y())
+ *
+ * Quads keep the same alignment as without the restriction, so packets
+ * on the first and last row may still contain fragments outside rows.
+ * Must be called after init() and before rasterize().
+ *//*--------------------------------------------------------------------*/
+void TriangleRasterizer::restrictToRows (const tcu::IVec2& rows)
+{
+	DE_ASSERT(m_curPos == m_bboxMin);
+
+	if (rows.x() > m_bboxMin.y())
+		m_curPos.y() = m_bboxMin.y() + ((rows.x() - m_bboxMin.y()) & ~1);
+
+	m_bboxMax.y() = de::min(m_bboxMax.y(), rows.y() - 1);
+}
+
 void TriangleRasterizer::rasterizeSingleSample (FragmentPacket* const fragmentPackets, float* const depthValues, const int maxFragmentPackets, int& numPacketsRasterized)
 {
 	DE_ASSERT(maxFragmentPackets > 0);
@@ -132,6 +132,7 @@ public:
 
 	// Following functions are only available after init()
 	FaceType				getVisibleFace			(void) const { return m_face; }
+	void					restrictToRows			(const tcu::IVec2& rows);
 	void					rasterize				(FragmentPacket* const fragmentPackets, float* const depthValues, const int maxFragmentPackets, int& numPacketsRasterized);
 
 private:
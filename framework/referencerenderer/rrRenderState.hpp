@@ -374,6 +374,7 @@ struct RenderState
 		, viewport					(viewport_)
 		, viewportOrientation		(viewportOrientation_)
 		, subpixelBits              (subpixelBits_)
+		, numRasterThreads			(1)
 	{
 		rasterization.viewportOrientation = viewportOrientation;
 	}
@@ -393,6 +394,9 @@ struct RenderState
 	RestartState				restart;
 	ViewportOrientation			viewportOrientation;
 	const int					subpixelBits;
+
+	//! Max number of row bands rasterized and shaded in parallel. Fragment shader must be thread-safe if greater than 1.
+	int							numRasterThreads;
 };
 
 } // rr
@@ -29,6 +29,7 @@
 #include "rrFragmentOperations.hpp"
 #include "rrRasterizer.hpp"
 #include "deMemory.h"
+#include "deParallelFor.hpp"
 
 #include <set>
 
@@ -1095,21 +1096,67 @@ void writeFragmentPackets (const RenderState&					state,
 	}
 }
 
+/*--------------------------------------------------------------------*//*!
+ * \brief Remove fragments outside rows [rows.x(), rows.y()) from packets
+ *
+ * Used when render target rows are split between threads. Packets keep
+ * their position so that quads, and thus derivatives, are the same as
+ * when rasterizing without the split.
+ *
+ * \return Number of packets left
+ *//*--------------------------------------------------------------------*/
+int cullPacketsOutsideRows (FragmentPacket* packets, float* depthValues, int numPackets, int numSamples, const tcu::IVec2& rows)
+{
+	const int	numDepthValues	= 4*numSamples;
+	int			numLeft			= 0;
+
+	for (int packetNdx = 0; packetNdx < numPackets; ++packetNdx)
+	{
+		FragmentPacket& packet = packets[packetNdx];
+
+		for (int yo = 0; yo < 2; yo++)
+		{
+			if (!de::inBounds(packet.position.y() + yo, rows.x(), rows.y()))
+				packet.coverage &= ~(getCoverageFragmentSampleBits(numSamples, 0, yo) | getCoverageFragmentSampleBits(numSamples, 1, yo));
+		}
+
+		if (packet.coverage == 0)
+			continue;
+
+		if (numLeft != packetNdx)
+		{
+			packets[numLeft] = packet;
+
+			if (depthValues)
+				deMemcpy(&depthValues[numLeft*numDepthValues], &depthValues[packetNdx*numDepthValues], sizeof(float)*numDepthValues);
+		}
+
+		numLeft += 1;
+	}
+
+	return numLeft;
+}
+
 void rasterizePrimitive (const RenderState&					state,
 						 const RenderTarget&				renderTarget,
 						 const Program&						program,
 						 const pa::Triangle&				triangle,
 						 const tcu::IVec4&					renderTargetRect,
+						 const tcu::IVec2&					rows,
 						 RasterizationInternalBuffers&		buffers)
 {
 	const int			numSamples		= renderTarget.getNumSamples();
 	const float			depthClampMin	= de::min(state.viewport.zn, state.viewport.zf);
 	const float			depthClampMax	= de::max(state.viewport.zn, state.viewport.zf);
+	const bool			cullRows		= rows.x() > renderTargetRect.y() || rows.y() < renderTargetRect.y() + renderTargetRect.w();
 	TriangleRasterizer	rasterizer		(renderTargetRect, numSamples, state.rasterization, state.subpixelBits);
 	float				depthOffset		= 0.0f;
 
 	rasterizer.init(triangle.v0->position, triangle.v1->position, triangle.v2->position);
 
+	if (cullRows)
+		rasterizer.restrictToRows(rows);
+
 	// Culling
 	const FaceType visibleFace = rasterizer.getVisibleFace();
 	if ((state.cullMode == CULLMODE_FRONT	&& visibleFace == FACETYPE_FRONT) ||
@@ -1143,6 +1190,14 @@ void rasterizePrimitive (const RenderState&					state,
 		if (!numRasterizedPackets)
 			break; // Rasterization finished.
 
+		if (cullRows)
+		{
+			numRasterizedPackets = cullPacketsOutsideRows(&buffers.fragmentPackets[0], buffers.fragmentDepthBuffer, numRasterizedPackets, numSamples, rows);
+
+			if (!numRasterizedPackets)
+				continue;
+		}
+
 		// Polygon offset
 		if (buffers.fragmentDepthBuffer && state.fragOps.polygonOffsetEnabled)
 			for (int sampleNdx = 0; sampleNdx < numRasterizedPackets * 4 * numSamples; ++sampleNdx)
@@ -1168,12 +1223,14 @@ void rasterizePrimitive (const RenderState&					state,
 						 const Program&						program,
 						 const pa::Line&					line,
 						 const tcu::IVec4&					renderTargetRect,
+						 const tcu::IVec2&					rows,
 						 RasterizationInternalBuffers&		buffers)
 {
 	const int					numSamples			= renderTarget.getNumSamples();
 	const float					depthClampMin		= de::min(state.viewport.zn, state.viewport.zf);
 	const float					depthClampMax		= de::max(state.viewport.zn, state.viewport.zf);
 	const bool					msaa				= numSamples > 1;
+	const bool					cullRows			= rows.x() > renderTargetRect.y() || rows.y() < renderTargetRect.y() + renderTargetRect.w();
 	FragmentShadingContext		shadingContext		(line.v0->outputs, line.v1->outputs, DE_NULL, &buffers.shaderOutputs[0], buffers.fragmentDepthBuffer, line.v1->primitiveID, (int)program.fragmentShader->getOutputs().size(), numSamples, FACETYPE_FRONT);
 	SingleSampleLineRasterizer	aliasedRasterizer	(renderTargetRect, state.subpixelBits);
 	MultiSampleLineRasterizer	msaaRasterizer		(numSamples, renderTargetRect, state.subpixelBits);
@@ -1201,6 +1258,14 @@ void rasterizePrimitive (const RenderState&					state,
 		if (!numRasterizedPackets)
 			break; // Rasterization finished.
 
+		if (cullRows)
+		{
+			numRasterizedPackets = cullPacketsOutsideRows(&buffers.fragmentPackets[0], buffers.fragmentDepthBuffer, numRasterizedPackets, numSamples, rows);
+
+			if (!numRasterizedPackets)
+				continue;
+		}
+
 		// Shade
 
 		program.fragmentShader->shadeFragments(&buffers.fragmentPackets[0], numRasterizedPackets, shadingContext);
@@ -1221,11 +1286,13 @@ void rasterizePrimitive (const RenderState&					state,
 						 const Program&						program,
 						 const pa::Point&					point,
 						 const tcu::IVec4&					renderTargetRect,
+						 const tcu::IVec2&					rows,
 						 RasterizationInternalBuffers&		buffers)
 {
 	const int			numSamples		= renderTarget.getNumSamples();
 	const float			depthClampMin	= de::min(state.viewport.zn, state.viewport.zf);
 	const float			depthClampMax	= de::max(state.viewport.zn, state.viewport.zf);
+	const bool			cullRows		= rows.x() > renderTargetRect.y() || rows.y() < renderTargetRect.y() + renderTargetRect.w();
 	TriangleRasterizer	rasterizer1		(renderTargetRect, numSamples, state.rasterization, state.subpixelBits);
 	TriangleRasterizer	rasterizer2		(renderTargetRect, numSamples, state.rasterization, state.subpixelBits);
 
@@ -1239,6 +1306,12 @@ void rasterizePrimitive (const RenderState&					state,
 	rasterizer1.init(w0, w1, w2);
 	rasterizer2.init(w0, w2, w3);
 
+	if (cullRows)
+	{
+		rasterizer1.restrictToRows(rows);
+		rasterizer2.restrictToRows(rows);
+	}
+
 	// Shading context
 	FragmentShadingContext shadingContext(point.v0->outputs, DE_NULL, DE_NULL, &buffers.shaderOutputs[0], buffers.fragmentDepthBuffer, point.v0->primitiveID, (int)program.fragmentShader->getOutputs().size(), numSamples, FACETYPE_FRONT);
 
@@ -1266,6 +1339,14 @@ void rasterizePrimitive (const RenderState&					state,
 		if (!numRasterizedPackets)
 			break; // Rasterization finished.
 
+		if (cullRows)
+		{
+			numRasterizedPackets = cullPacketsOutsideRows(&buffers.fragmentPackets[0], buffers.fragmentDepthBuffer, numRasterizedPackets, numSamples, rows);
+
+			if (!numRasterizedPackets)
+				continue;
+		}
+
 		// Shade
 
 		program.fragmentShader->shadeFragments(&buffers.fragmentPackets[0], numRasterizedPackets, shadingContext);
@@ -1281,19 +1362,50 @@ void rasterizePrimitive (const RenderState&					state,
 	}
 }
 
+// Conservative bounds of rows a primitive can produce fragments on, used to skip primitives outside a band
+
+bool isPrimitiveOutsideRows (const RenderState& state, const pa::Triangle& triangle, const tcu::IVec2& rows)
+{
+	DE_UNREF(state);
+
+	const float minY = de::min(de::min(triangle.v0->position.y(), triangle.v1->position.y()), triangle.v2->position.y()) - 1.0f;
+	const float maxY = de::max(de::max(triangle.v0->position.y(), triangle.v1->position.y()), triangle.v2->position.y()) + 1.0f;
+
+	return maxY < (float)rows.x() || minY >= (float)rows.y();
+}
+
+bool isPrimitiveOutsideRows (const RenderState& state, const pa::Line& line, const tcu::IVec2& rows)
+{
+	const float margin	= de::max(state.line.lineWidth, 1.0f) + 1.0f;
+	const float minY	= de::min(line.v0->position.y(), line.v1->position.y()) - margin;
+	const float maxY	= de::max(line.v0->position.y(), line.v1->position.y()) + margin;
+
+	return maxY < (float)rows.x() || minY >= (float)rows.y();
+}
+
+bool isPrimitiveOutsideRows (const RenderState& state, const pa::Point& point, const tcu::IVec2& rows)
+{
+	DE_UNREF(state);
+
+	const float margin	= point.v0->pointSize / 2.0f + 1.0f;
+	const float minY	= point.v0->position.y() - margin;
+	const float maxY	= point.v0->position.y() + margin;
+
+	return maxY < (float)rows.x() || minY >= (float)rows.y();
+}
+
 template <typename ContainerType>
-void rasterize (const RenderState&					state,
-				const RenderTarget&					renderTarget,
-				const Program&						program,
-				const ContainerType&				list)
+void rasterizeRows (const RenderState&					state,
+					const RenderTarget&					renderTarget,
+					const Program&						program,
+					const ContainerType&				list,
+					const tcu::IVec4&					renderTargetRect,
+					const tcu::IVec2&					rows)
 {
 	const int						numSamples			= renderTarget.getNumSamples();
 	const int						numFragmentOutputs	= (int)program.fragmentShader->getOutputs().size();
 	const size_t					maxFragmentPackets	= 128;
-
-	const tcu::IVec4				viewportRect		= tcu::IVec4(state.viewport.rect.left, state.viewport.rect.bottom, state.viewport.rect.width, state.viewport.rect.height);
-	const tcu::IVec4				bufferRect			= getBufferSize(renderTarget.getColorBuffer(0));
-	const tcu::IVec4				renderTargetRect	= rectIntersection(viewportRect, bufferRect);
+	const bool						cullPrimitives		= rows.x() > renderTargetRect.y() || rows.y() < renderTargetRect.y() + renderTargetRect.w();
 
 	// shared buffers for all primitives
 	std::vector<FragmentPacket>		fragmentPackets		(maxFragmentPackets);
@@ -1319,7 +1431,75 @@ void rasterize (const RenderState&					state,
 
 	// rasterize
 	for (typename ContainerType::const_iterator it = list.begin(); it != list.end(); ++it)
-		rasterizePrimitive(state, renderTarget, program, *it, renderTargetRect, buffers);
+	{
+		if (cullPrimitives && isPrimitiveOutsideRows(state, *it, rows))
+			continue;
+
+		rasterizePrimitive(state, renderTarget, program, *it, renderTargetRect, rows, buffers);
+	}
+}
+
+template <typename ContainerType>
+class RasterizeRowsTask : public de::RangeTask
+{
+public:
+	RasterizeRowsTask (const RenderState& state, const RenderTarget& renderTarget, const Program& program, const ContainerType& list, const tcu::IVec4& renderTargetRect, int numBands)
+		: m_state				(state)
+		, m_renderTarget		(renderTarget)
+		, m_program				(program)
+		, m_list				(list)
+		, m_renderTargetRect	(renderTargetRect)
+		, m_numBands			(numBands)
+	{
+	}
+
+	void run (int begin, int end)
+	{
+		for (int bandNdx = begin; bandNdx < end; bandNdx++)
+			rasterizeRows(m_state, m_renderTarget, m_program, m_list, m_renderTargetRect, getBandRows(bandNdx));
+	}
+
+private:
+	tcu::IVec2 getBandRows (int bandNdx) const
+	{
+		const int y0		= m_renderTargetRect.y();
+		const int height	= m_renderTargetRect.w();
+
+		return tcu::IVec2(y0 + (height*bandNdx)/m_numBands, y0 + (height*(bandNdx+1))/m_numBands);
+	}
+
+	const RenderState&		m_state;
+	const RenderTarget&		m_renderTarget;
+	const Program&			m_program;
+	const ContainerType&	m_list;
+	const tcu::IVec4		m_renderTargetRect;
+	const int				m_numBands;
+};
+
+template <typename ContainerType>
+void rasterize (const RenderState&					state,
+				const RenderTarget&					renderTarget,
+				const Program&						program,
+				const ContainerType&				list)
+{
+	// Bands smaller than this are not worth the fixed cost of a thread
+	const int						minBandRows			= 16;
+
+	const tcu::IVec4				viewportRect		= tcu::IVec4(state.viewport.rect.left, state.viewport.rect.bottom, state.viewport.rect.width, state.viewport.rect.height);
+	const tcu::IVec4				bufferRect			= getBufferSize(renderTarget.getColorBuffer(0));
+	const tcu::IVec4				renderTargetRect	= rectIntersection(viewportRect, bufferRect);
+	// Number of bands depends only on state, parallelFor() distributes bands over threads it has available
+	const int						numBands			= de::clamp(renderTargetRect.w() / minBandRows, 1, de::max(state.numRasterThreads, 1));
+
+	if (numBands > 1 && !list.empty())
+	{
+		// Each band processes all primitives in order, so per-pixel results do not depend on the number of bands
+		RasterizeRowsTask<ContainerType> task (state, renderTarget, program, list, renderTargetRect, numBands);
+
+		de::parallelFor(0, numBands, 1, task);
+	}
+	else
+		rasterizeRows(state, renderTarget, program, list, renderTargetRect, tcu::IVec2(renderTargetRect.y(), renderTargetRect.y() + renderTargetRect.w()));
 }
 
 /*--------------------------------------------------------------------*//*!
@@ -28,6 +28,7 @@
 #include "gluShaderUtil.hpp"
 #include "gluShaderProgram.hpp"
 #include "gluTextureUtil.hpp"
+#include "gluPixelTransfer.hpp"
 #include "gluStrUtil.hpp"
 #include "tcuTestLog.hpp"
 #include "tcuTexture.hpp"
@@ -816,20 +817,17 @@ FragmentOutputCase::IterateResult FragmentOutputCase::iterate (void)
 	gl.drawElements(GL_TRIANGLES, numIndices, GL_UNSIGNED_SHORT, &indices[0]);
 	GLU_EXPECT_NO_ERROR(gl.getError(), "glDrawElements");
 
-	// Read all attachment points.
+	// Start reading all attachment points. Reference images are rendered while the reads are in flight.
+	glu::AsyncPixelReader pixelReader (m_context.getRenderContext(), de::max(numAttachments, 1));
+
 	for (int ndx = 0; ndx < numAttachments; ndx++)
 	{
-		const glu::TransferFormat		transferFmt			= glu::getTransferFormat(attachments[ndx].readFormat);
-		void*							dst					= &attachments[ndx].renderedData[0];
 		const int						attachmentW			= m_fboSpec[ndx].width;
 		const int						attachmentH			= m_fboSpec[ndx].height;
-		const int						numValidChannels	= attachments[ndx].numWrittenChannels;
 		const tcu::PixelBufferAccess	rendered			(attachments[ndx].readFormat, attachmentW, attachmentH, 1, deAlign32(attachments[ndx].readFormat.getPixelSize()*attachmentW, readAlignment), 0, &attachments[ndx].renderedData[0]);
 
 		gl.readBuffer(GL_COLOR_ATTACHMENT0+ndx);
-		gl.readPixels(0, 0, minBufSize.x(), minBufSize.y(), transferFmt.format, transferFmt.dataType, dst);
-
-		clearUndefined(rendered, numValidChannels);
+		pixelReader.read(0, 0, tcu::getSubregion(rendered, 0, 0, minBufSize.x(), minBufSize.y()));
 	}
 
 	// Render reference images.
@@ -869,6 +867,19 @@ FragmentOutputCase::IterateResult FragmentOutputCase::iterate (void)
 		}
 	}
 
+	// Complete reads.
+	pixelReader.finish();
+
+	for (int ndx = 0; ndx < numAttachments; ndx++)
+	{
+		const int						attachmentW			= m_fboSpec[ndx].width;
+		const int						attachmentH			= m_fboSpec[ndx].height;
+		const int						numValidChannels	= attachments[ndx].numWrittenChannels;
+		const tcu::PixelBufferAccess	rendered			(attachments[ndx].readFormat, attachmentW, attachmentH, 1, deAlign32(attachments[ndx].readFormat.getPixelSize()*attachmentW, readAlignment), 0, &attachments[ndx].renderedData[0]);
+
+		clearUndefined(rendered, numValidChannels);
+	}
+
 	// Compare all images.
 	bool allLevelsOk = true;
 	for (int attachNdx = 0; attachNdx < numAttachments; attachNdx++)
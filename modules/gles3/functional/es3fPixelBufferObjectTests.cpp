@@ -32,9 +32,11 @@
 #include "gluTextureUtil.hpp"
 #include "gluPixelTransfer.hpp"
 #include "gluShaderProgram.hpp"
+#include "gluRenderContext.hpp"
 
 #include "deRandom.hpp"
 #include "deString.h"
+#include "deStringUtil.hpp"
 
 #include <string>
 #include <sstream>
@@ -595,6 +597,92 @@ TestCase::IterateResult ReadPixelsTest::iterate(void)
 	}
 }
 
+class AsyncReadPixelsTest : public TestCase
+{
+public:
+					AsyncReadPixelsTest			(Context& context, const char* name, const char* description, int numFrames, int maxPendingReads);
+
+	IterateResult	iterate						(void);
+
+private:
+	const int		m_numFrames;
+	const int		m_maxPendingReads;
+};
+
+AsyncReadPixelsTest::AsyncReadPixelsTest (Context& context, const char* name, const char* description, int numFrames, int maxPendingReads)
+	: TestCase				(context, name, description)
+	, m_numFrames			(numFrames)
+	, m_maxPendingReads		(maxPendingReads)
+{
+}
+
+TestCase::IterateResult AsyncReadPixelsTest::iterate (void)
+{
+	const glu::RenderContext&		renderCtx	= m_context.getRenderContext();
+	const int						width		= de::min(m_context.getRenderTarget().getWidth(), 64);
+	const int						height		= de::min(m_context.getRenderTarget().getHeight(), 64);
+	const tcu::TextureFormat		format		(tcu::TextureFormat::RGBA, tcu::TextureFormat::UNORM_INT8);
+	de::Random						rnd			(deStringHash(getName()));
+	std::vector<tcu::TextureLevel>	results		(m_numFrames);
+	std::vector<tcu::TextureLevel>	references	(m_numFrames);
+	bool							isOk		= true;
+
+	m_testCtx.getLog() << tcu::TestLog::Message << "Reading " << m_numFrames << " frames through " << m_maxPendingReads << " pixel pack buffers, "
+					   << "comparing to synchronous reads of the same frames" << tcu::TestLog::EndMessage;
+
+	{
+		glu::AsyncPixelReader reader (renderCtx, m_maxPendingReads);
+
+		TCU_CHECK(reader.isAsync());
+
+		GLU_CHECK_CALL(glBindFramebuffer(GL_FRAMEBUFFER, renderCtx.getDefaultFramebuffer()));
+
+		for (int frameNdx = 0; frameNdx < m_numFrames; frameNdx++)
+		{
+			const int	clearX		= rnd.getInt(0, width-1);
+			const int	clearY		= rnd.getInt(0, height-1);
+
+			results[frameNdx].setStorage(format, width, height);
+			references[frameNdx].setStorage(format, width, height);
+
+			// Frame contents differ so that a read returning data of another frame is detected
+			GLU_CHECK_CALL(glDisable(GL_SCISSOR_TEST));
+			GLU_CHECK_CALL(glClearColor(rnd.getFloat(), rnd.getFloat(), rnd.getFloat(), 1.0f));
+			GLU_CHECK_CALL(glClear(GL_COLOR_BUFFER_BIT));
+			GLU_CHECK_CALL(glEnable(GL_SCISSOR_TEST));
+			GLU_CHECK_CALL(glScissor(clearX, clearY, width-clearX, height-clearY));
+			GLU_CHECK_CALL(glClearColor(rnd.getFloat(), rnd.getFloat(), rnd.getFloat(), 1.0f));
+			GLU_CHECK_CALL(glClear(GL_COLOR_BUFFER_BIT));
+			GLU_CHECK_CALL(glDisable(GL_SCISSOR_TEST));
+
+			reader.read(0, 0, results[frameNdx].getAccess());
+			glu::readPixels(renderCtx, 0, 0, references[frameNdx].getAccess());
+
+			if (frameNdx % 2 == 1)
+				reader.poll();
+		}
+
+		reader.finish();
+		TCU_CHECK(reader.getNumPendingReads() == 0);
+	}
+
+	for (int frameNdx = 0; frameNdx < m_numFrames; frameNdx++)
+	{
+		const string name = "Frame" + de::toString(frameNdx);
+
+		if (!tcu::intThresholdCompare(m_testCtx.getLog(), name.c_str(), ("Asynchronous and synchronous read of frame " + de::toString(frameNdx)).c_str(),
+									  references[frameNdx].getAccess(), results[frameNdx].getAccess(), tcu::UVec4(0), tcu::COMPARE_LOG_ON_ERROR))
+			isOk = false;
+	}
+
+	if (isOk)
+		m_testCtx.setTestResult(QP_TEST_RESULT_PASS, "Pass");
+	else
+		m_testCtx.setTestResult(QP_TEST_RESULT_FAIL, "Asynchronous read result differs from synchronous read");
+
+	return STOP;
+}
+
 } // anonymous
 
 PixelBufferObjectTests::PixelBufferObjectTests (Context& context)
@@ -724,6 +812,13 @@ void PixelBufferObjectTests::init (void)
 	}
 
 	addChild(renderbufferGroup);
+
+	TestCaseGroup* asyncGroup = new TestCaseGroup(m_context, "async", "Tests for asynchronous reads with glu::AsyncPixelReader");
+
+	asyncGroup->addChild(new AsyncReadPixelsTest(m_context, "single_buffer",	"Reads through a single pixel pack buffer",					6, 1));
+	asyncGroup->addChild(new AsyncReadPixelsTest(m_context, "three_buffers",	"Reads through three pixel pack buffers, reused round robin",	8, 3));
+
+	addChild(asyncGroup);
 }
 
 } // Functional
@@ -28,8 +28,14 @@
 #include "tcuTextureUtil.hpp"
 #include "tcuTestLog.hpp"
 #include "tcuRenderTarget.hpp"
+#include "tcuFormatUtil.hpp"
 #include "gluPixelTransfer.hpp"
 #include "gluStateReset.hpp"
+#include "gluStateTrackingRenderContext.hpp"
+#include "gluObjectWrapper.hpp"
+#include "gluContextInfo.hpp"
+#include "glwFunctions.hpp"
+#include "glwEnums.hpp"
 
 #include "glw.h"
 
@@ -77,6 +83,144 @@ TestCase::IterateResult StateResetCase::iterate (void)
 	return TestCase::STOP;
 }
 
+class TrackedStateResetCase : public TestCase
+{
+public:
+										TrackedStateResetCase	(Context& context);
+	virtual								~TrackedStateResetCase	(void);
+	virtual TestCase::IterateResult		iterate					(void);
+
+private:
+	enum StateChange
+	{
+		STATECHANGE_ENABLE_CULL_FACE = 0,
+		STATECHANGE_BIND_TEXTURE,
+		STATECHANGE_BIND_SAMPLER,
+		STATECHANGE_VERTEX_ATTRIB_DIVISOR,
+		STATECHANGE_PIXEL_STORE,
+		STATECHANGE_COLOR_MASK,
+		STATECHANGE_BIND_UNIFORM_BUFFER,
+		STATECHANGE_BIND_TRANSFORM_FEEDBACK_BUFFER,
+		STATECHANGE_BIND_VERTEX_BUFFER,			//!< ES 3.1
+		STATECHANGE_BIND_IMAGE_TEXTURE,			//!< ES 3.1
+
+		STATECHANGE_LAST
+	};
+
+	static const char*					getStateChangeName		(StateChange change);
+	void								applyStateChange		(StateChange change, deUint32 buffer, deUint32 texture, deUint32 sampler) const;
+};
+
+TrackedStateResetCase::TrackedStateResetCase (Context& context)
+	: TestCase(context, "tracked_state_reset", "Reset of tracked state categories matches full reset")
+{
+}
+
+TrackedStateResetCase::~TrackedStateResetCase (void)
+{
+}
+
+const char* TrackedStateResetCase::getStateChangeName (StateChange change)
+{
+	static const char* const s_names[] =
+	{
+		"glEnable(GL_CULL_FACE)",
+		"glBindTexture()",
+		"glBindSampler()",
+		"glVertexAttribDivisor()",
+		"glPixelStorei()",
+		"glColorMask()",
+		"glBindBufferBase(GL_UNIFORM_BUFFER)",
+		"glBindBufferRange(GL_TRANSFORM_FEEDBACK_BUFFER)",
+		"glBindVertexBuffer()",
+		"glBindImageTexture()",
+	};
+
+	DE_STATIC_ASSERT(DE_LENGTH_OF_ARRAY(s_names) == STATECHANGE_LAST);
+
+	return s_names[change];
+}
+
+void TrackedStateResetCase::applyStateChange (StateChange change, deUint32 buffer, deUint32 texture, deUint32 sampler) const
+{
+	const glw::Functions& gl = m_context.getRenderContext().getFunctions();
+
+	switch (change)
+	{
+		case STATECHANGE_ENABLE_CULL_FACE:					gl.enable(GL_CULL_FACE);											break;
+		case STATECHANGE_BIND_TEXTURE:						gl.activeTexture(GL_TEXTURE1); gl.bindTexture(GL_TEXTURE_2D, texture);	break;
+		case STATECHANGE_BIND_SAMPLER:						gl.bindSampler(1, sampler);											break;
+		case STATECHANGE_VERTEX_ATTRIB_DIVISOR:				gl.vertexAttribDivisor(0, 1);										break;
+		case STATECHANGE_PIXEL_STORE:						gl.pixelStorei(GL_PACK_ALIGNMENT, 1);								break;
+		case STATECHANGE_COLOR_MASK:						gl.colorMask(GL_TRUE, GL_FALSE, GL_TRUE, GL_FALSE);				break;
+		case STATECHANGE_BIND_UNIFORM_BUFFER:				gl.bindBufferBase(GL_UNIFORM_BUFFER, 0, buffer);					break;
+		case STATECHANGE_BIND_TRANSFORM_FEEDBACK_BUFFER:	gl.bindBufferRange(GL_TRANSFORM_FEEDBACK_BUFFER, 0, buffer, 0, 16);	break;
+		case STATECHANGE_BIND_VERTEX_BUFFER:				gl.bindVertexBuffer(0, buffer, 0, 16);								break;
+		case STATECHANGE_BIND_IMAGE_TEXTURE:				gl.bindImageTexture(0, texture, 0, GL_FALSE, 0, GL_READ_ONLY, GL_RGBA8);	break;
+		default:
+			DE_ASSERT(false);
+	}
+
+	GLU_EXPECT_NO_ERROR(gl.getError(), getStateChangeName(change));
+}
+
+TestCase::IterateResult TrackedStateResetCase::iterate (void)
+{
+	const glu::RenderContext&				renderCtx	= m_context.getRenderContext();
+	const glu::StateTrackingRenderContext*	trackingCtx	= dynamic_cast<const glu::StateTrackingRenderContext*>(&renderCtx);
+	const glw::Functions&					gl			= renderCtx.getFunctions();
+	const bool								isES31		= glu::contextSupports(renderCtx.getType(), glu::ApiType::es(3,1));
+	TestLog&								log			= m_testCtx.getLog();
+	const glu::Buffer						buffer		(renderCtx);
+	const glu::Texture						texture		(renderCtx);
+	const glu::Sampler						sampler		(renderCtx);
+	bool									allOk		= true;
+
+	if (!trackingCtx)
+		throw tcu::NotSupportedError("State changes are not tracked, run with --deqp-gl-state-reset=tracked or verify");
+
+	gl.bindBuffer(GL_ARRAY_BUFFER, *buffer);
+	gl.bufferData(GL_ARRAY_BUFFER, 64, DE_NULL, GL_STATIC_DRAW);
+	gl.bindTexture(GL_TEXTURE_2D, *texture);
+	gl.texStorage2D(GL_TEXTURE_2D, 1, GL_RGBA8, 4, 4);
+	GLU_EXPECT_NO_ERROR(gl.getError(), "Object setup failed");
+
+	for (int changeNdx = 0; changeNdx < STATECHANGE_LAST; changeNdx++)
+	{
+		const StateChange	change		= (StateChange)changeNdx;
+
+		if (!isES31 && (change == STATECHANGE_BIND_VERTEX_BUFFER || change == STATECHANGE_BIND_IMAGE_TEXTURE))
+			continue;
+
+		trackingCtx->resetState(m_context.getContextInfo());
+		applyStateChange(change, *buffer, *texture, *sampler);
+
+		{
+			const deUint32	dirtyMask	= trackingCtx->getDirtyMask();
+
+			log << TestLog::Message << getStateChangeName(change) << ": dirty state mask " << tcu::toHex(dirtyMask) << TestLog::EndMessage;
+
+			// Resetting only the dirty categories must give the same state as a full reset
+			try
+			{
+				glu::resetAndVerifyState(renderCtx, m_context.getContextInfo(), dirtyMask);
+			}
+			catch (const tcu::InternalError& e)
+			{
+				log << TestLog::Message << "ERROR: " << e.what() << TestLog::EndMessage;
+				allOk = false;
+			}
+		}
+	}
+
+	// Leave the context clean for the next case
+	trackingCtx->resetState(m_context.getContextInfo());
+
+	m_testCtx.setTestResult(allOk ? QP_TEST_RESULT_PASS	: QP_TEST_RESULT_FAIL,
+							allOk ? "Pass"				: "Untracked state change");
+	return TestCase::STOP;
+}
+
 class ClearColorCase : public TestCase
 {
 public:
@@ -277,6 +421,7 @@ PrerequisiteTests::~PrerequisiteTests (void)
 void PrerequisiteTests::init (void)
 {
 	addChild(new StateResetCase(m_context));
+	addChild(new TrackedStateResetCase(m_context));
 	addChild(new ClearColorCase(m_context));
 	addChild(new ReadPixelsCase(m_context));
 }
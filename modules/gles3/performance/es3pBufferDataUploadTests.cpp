@@ -28,6 +28,7 @@
 #include "tcuSurface.hpp"
 #include "tcuCPUWarmup.hpp"
 #include "tcuRenderTarget.hpp"
+#include "tcuStatistics.hpp"
 #include "gluRenderContext.hpp"
 #include "gluShaderProgram.hpp"
 #include "gluStrUtil.hpp"
@@ -645,25 +646,6 @@ static void busyWait (int microseconds)
 	*tcu::warmupCPUInternal::g_dummy.m_v = dummy;
 }
 
-// Sample from given values using linear interpolation at a given position as if values were laid to range [0, 1]
-template <typename T>
-static float linearSample (const std::vector<T>& values, float position)
-{
-	DE_ASSERT(position >= 0.0f);
-	DE_ASSERT(position <= 1.0f);
-
-	const float	floatNdx			= (float)(values.size() - 1) * position;
-	const int	lowerNdx			= (int)deFloatFloor(floatNdx);
-	const int	higherNdx			= lowerNdx + 1;
-	const float	interpolationFactor = floatNdx - (float)lowerNdx;
-
-	DE_ASSERT(lowerNdx >= 0 && lowerNdx < (int)values.size());
-	DE_ASSERT(higherNdx >= 0 && higherNdx < (int)values.size());
-	DE_ASSERT(interpolationFactor >= 0 && interpolationFactor < 1.0f);
-
-	return tcu::mix((float)values[lowerNdx], (float)values[higherNdx], interpolationFactor);
-}
-
 template <typename T>
 SingleOperationStatistics calculateSingleOperationStatistics (const std::vector<T>& samples, deUint64 T::SampleType::*target)
 {
@@ -677,9 +659,9 @@ SingleOperationStatistics calculateSingleOperationStatistics (const std::vector<
 
 	stats.minTime			= (float)values.front();
 	stats.maxTime			= (float)values.back();
-	stats.medianTime		= linearSample(values, 0.5f);
-	stats.min2DecileTime	= linearSample(values, 0.1f);
-	stats.max9DecileTime	= linearSample(values, 0.9f);
+	stats.medianTime		= tcu::linearSample(values, 0.5f);
+	stats.min2DecileTime	= tcu::linearSample(values, 0.1f);
+	stats.max9DecileTime	= tcu::linearSample(values, 0.9f);
 
 	return stats;
 }
@@ -704,7 +686,7 @@ void calculateBasicStatistics (StatisticsType& stats, const LineParametersWithCo
 
 		std::sort(processingRates.begin(), processingRates.end());
 
-		stats.medianRate = linearSample(processingRates, 0.5f);
+		stats.medianRate = tcu::linearSample(processingRates, 0.5f);
 	}
 
 	// results compared to the approximation
@@ -720,8 +702,8 @@ void calculateBasicStatistics (StatisticsType& stats, const LineParametersWithCo
 		std::sort(timeDiffs.begin(), timeDiffs.end());
 
 		stats.maxDiffTime			= timeDiffs.back();
-		stats.maxDiff9DecileTime	= linearSample(timeDiffs, 0.9f);
-		stats.medianDiffTime		= linearSample(timeDiffs, 0.5f);
+		stats.maxDiff9DecileTime	= tcu::linearSample(timeDiffs, 0.9f);
+		stats.medianDiffTime		= tcu::linearSample(timeDiffs, 0.5f);
 	}
 
 	// relative comparison to the approximation
@@ -744,8 +726,8 @@ void calculateBasicStatistics (StatisticsType& stats, const LineParametersWithCo
 		std::sort(relativeDiffs.begin(), relativeDiffs.end());
 
 		stats.maxRelDiffTime		= relativeDiffs.back();
-		stats.max9DecileRelDiffTime	= linearSample(relativeDiffs, 0.9f);
-		stats.medianRelDiffTime		= linearSample(relativeDiffs, 0.5f);
+		stats.max9DecileRelDiffTime	= tcu::linearSample(relativeDiffs, 0.9f);
+		stats.medianRelDiffTime		= tcu::linearSample(relativeDiffs, 0.5f);
 	}
 
 	// values calculated using sorted timings
@@ -754,9 +736,9 @@ void calculateBasicStatistics (StatisticsType& stats, const LineParametersWithCo
 
 	stats.result.minTime = (float)values.front();
 	stats.result.maxTime = (float)values.back();
-	stats.result.medianTime = linearSample(values, 0.5f);
-	stats.result.min2DecileTime = linearSample(values, 0.1f);
-	stats.result.max9DecileTime = linearSample(values, 0.9f);
+	stats.result.medianTime = tcu::linearSample(values, 0.5f);
+	stats.result.min2DecileTime = tcu::linearSample(values, 0.1f);
+	stats.result.max9DecileTime = tcu::linearSample(values, 0.9f);
 }
 
 template <typename StatisticsType, typename SampleType>
@@ -4681,9 +4663,9 @@ void ReferenceReadPixelsTimeCase::logAndSetTestResult (void)
 		float limit60Up;
 
 		std::sort(m_samples.begin(), m_samples.end());
-		median		= linearSample(m_samples, 0.5f);
-		limit60Low	= linearSample(m_samples, 0.2f);
-		limit60Up	= linearSample(m_samples, 0.8f);
+		median		= tcu::linearSample(m_samples, 0.5f);
+		limit60Low	= tcu::linearSample(m_samples, 0.2f);
+		limit60Up	= tcu::linearSample(m_samples, 0.8f);
 
 		m_testCtx.getLog()
 			<< tcu::TestLog::Float("Median", "Median", "us", QP_KEY_TAG_TIME, median)
@@ -6115,8 +6097,8 @@ int UploadWaitDrawCase::findStabilizationSample (deUint64 (UploadWaitDrawCase::R
 						<< tcu::TestLog::Message
 						<< description << ": Samples with swap count " << sampleNdx << " and " << cmpTargetDistribution << " do not seem to have the same distribution:\n"
 						<< "\tDifference in standard deviations: " << result.standardDeviations << "\n"
-						<< "\tSwap count " << sampleNdx << " median: " << linearSample(sampleObservations[sampleNdx], 0.5f) << "\n"
-						<< "\tSwap count " << cmpTargetDistribution << " median: " << linearSample(sampleObservations[cmpTargetDistribution], 0.5f) << "\n"
+						<< "\tSwap count " << sampleNdx << " median: " << tcu::linearSample(sampleObservations[sampleNdx], 0.5f) << "\n"
+						<< "\tSwap count " << cmpTargetDistribution << " median: " << tcu::linearSample(sampleObservations[cmpTargetDistribution], 0.5f) << "\n"
 						<< tcu::TestLog::EndMessage;
 					return -1;
 				}
@@ -6127,8 +6109,8 @@ int UploadWaitDrawCase::findStabilizationSample (deUint64 (UploadWaitDrawCase::R
 						<< description << ": Samples with swap count " << sampleNdx << " and " << cmpTargetDistribution << " do not seem to have the same distribution:\n"
 						<< "\tSamples with swap count " << sampleNdx << " are not part of the tail of stable results.\n"
 						<< "\tDifference in standard deviations: " << result.standardDeviations << "\n"
-						<< "\tSwap count " << sampleNdx << " median: " << linearSample(sampleObservations[sampleNdx], 0.5f) << "\n"
-						<< "\tSwap count " << cmpTargetDistribution << " median: " << linearSample(sampleObservations[cmpTargetDistribution], 0.5f) << "\n"
+						<< "\tSwap count " << sampleNdx << " median: " << tcu::linearSample(sampleObservations[sampleNdx], 0.5f) << "\n"
+						<< "\tSwap count " << cmpTargetDistribution << " median: " << tcu::linearSample(sampleObservations[cmpTargetDistribution], 0.5f) << "\n"
 						<< tcu::TestLog::EndMessage;
 
 					return sampleNdx+1;
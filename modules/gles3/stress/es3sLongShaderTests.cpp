@@ -357,6 +357,9 @@ public:
 
 	void					verify							(const glu::ShaderProgram& program);
 
+	//! Compiling the longest shaders is a single blocking call that may exceed the default interval limit
+	int						getIntervalTimeLimit			(void) const { return 120; }
+
 private:
 	const glu::ShaderType	m_shaderType;
 	const deUint32			m_flags;
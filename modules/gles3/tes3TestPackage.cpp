@@ -30,6 +30,7 @@
 #include "tcuTestLog.hpp"
 #include "gluRenderContext.hpp"
 #include "gluStateReset.hpp"
+#include "gluCallTrace.hpp"
 #include "glwFunctions.hpp"
 #include "glwEnums.hpp"
 
@@ -50,10 +51,12 @@ public:
 
 private:
 	TestPackage&					m_testPackage;
+	glu::TestCaseCallTrace			m_callTrace;		//!< Calls written into log if case fails
 };
 
 TestCaseWrapper::TestCaseWrapper (TestPackage& package)
-	: m_testPackage(package)
+	: m_testPackage	(package)
+	, m_callTrace	(package.getTestContext())
 {
 }
 
@@ -63,12 +66,12 @@ TestCaseWrapper::~TestCaseWrapper (void)
 
 void TestCaseWrapper::init (tcu::TestCase* testCase, const std::string&)
 {
-	testCase->init();
+	m_callTrace.initCase(testCase);
 }
 
 void TestCaseWrapper::deinit (tcu::TestCase* testCase)
 {
-	testCase->deinit();
+	m_callTrace.deinitCase(testCase);
 
 	DE_ASSERT(m_testPackage.getContext());
 	glu::resetState(m_testPackage.getContext()->getRenderContext(), m_testPackage.getContext()->getContextInfo());
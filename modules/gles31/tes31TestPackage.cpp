@@ -26,6 +26,7 @@
 #include "es31fFunctionalTests.hpp"
 #include "es31sStressTests.hpp"
 #include "gluStateReset.hpp"
+#include "gluCallTrace.hpp"
 #include "gluRenderContext.hpp"
 #include "tcuTestLog.hpp"
 
@@ -46,10 +47,12 @@ public:
 
 private:
 	TestPackage&					m_testPackage;
+	glu::TestCaseCallTrace			m_callTrace;		//!< Calls written into log if case fails
 };
 
 TestCaseWrapper::TestCaseWrapper (TestPackage& package)
-	: m_testPackage(package)
+	: m_testPackage	(package)
+	, m_callTrace	(package.getTestContext())
 {
 }
 
@@ -59,12 +62,12 @@ TestCaseWrapper::~TestCaseWrapper (void)
 
 void TestCaseWrapper::init (tcu::TestCase* testCase, const std::string&)
 {
-	testCase->init();
+	m_callTrace.initCase(testCase);
 }
 
 void TestCaseWrapper::deinit (tcu::TestCase* testCase)
 {
-	testCase->deinit();
+	m_callTrace.deinitCase(testCase);
 
 	DE_ASSERT(m_testPackage.getContext());
 	glu::resetState(m_testPackage.getContext()->getRenderContext(), m_testPackage.getContext()->getContextInfo());
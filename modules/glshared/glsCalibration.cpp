@@ -24,6 +24,7 @@
 #include "glsCalibration.hpp"
 #include "tcuTestLog.hpp"
 #include "tcuVectorUtil.hpp"
+#include "tcuStatistics.hpp"
 #include "deStringUtil.hpp"
 #include "deMath.h"
 #include "deClock.h"
@@ -43,47 +44,16 @@ namespace deqp
 namespace gls
 {
 
-// Reorders input arbitrarily, linear complexity and no allocations
-template<typename T>
-float destructiveMedian (vector<T>& data)
-{
-	const typename vector<T>::iterator mid = data.begin()+data.size()/2;
-
-	std::nth_element(data.begin(), mid, data.end());
-
-	if (data.size()%2 == 0) // Even number of elements, need average of two centermost elements
-		return (*mid + *std::max_element(data.begin(), mid))*0.5f; // Data is partially sorted around mid, mid is half an item after center
-	else
-		return *mid;
-}
-
 LineParameters theilSenLinearRegression (const std::vector<tcu::Vec2>& dataPoints)
 {
-	const float		epsilon					= 1e-6f;
-
 	const int		numDataPoints			= (int)dataPoints.size();
-	vector<float>	pairwiseCoefficients;
 	vector<float>	pointwiseOffsets;
 	LineParameters	result					(0.0f, 0.0f);
 
-	// Compute the pairwise coefficients.
-	for (int i = 0; i < numDataPoints; i++)
-	{
-		const Vec2& ptA = dataPoints[i];
-
-		for (int j = 0; j < i; j++)
-		{
-			const Vec2& ptB = dataPoints[j];
-
-			if (de::abs(ptA.x() - ptB.x()) > epsilon)
-				pairwiseCoefficients.push_back((ptA.y() - ptB.y()) / (ptA.x() - ptB.x()));
-		}
-	}
-
 	// Find the median of the pairwise coefficients.
 	// \note If there are no data point pairs with differing x values, the coefficient variable will stay zero as initialized.
-	if (!pairwiseCoefficients.empty())
-		result.coefficient = destructiveMedian(pairwiseCoefficients);
+	if (tcu::countPairwiseSlopes(dataPoints) > 0)
+		result.coefficient = tcu::medianPairwiseSlope(dataPoints);
 
 	// Compute the offsets corresponding to the median coefficient, for all data points.
 	for (int i = 0; i < numDataPoints; i++)
@@ -92,29 +62,45 @@ LineParameters theilSenLinearRegression (const std::vector<tcu::Vec2>& dataPoint
 	// Find the median of the offsets.
 	// \note If there are no data points, the offset variable will stay zero as initialized.
 	if (!pointwiseOffsets.empty())
-		result.offset = destructiveMedian(pointwiseOffsets);
+		result.offset = tcu::destructiveMedian(pointwiseOffsets);
 
 	return result;
 }
 
-// Sample from given values using linear interpolation at a given position as if values were laid to range [0, 1]
-template <typename T>
-static float linearSample (const std::vector<T>& values, float position)
+LineParametersWithConfidence theilSenLinearRegression (const std::vector<tcu::Vec2>& dataPoints, float reportedConfidence)
 {
-	DE_ASSERT(position >= 0.0f);
-	DE_ASSERT(position <= 1.0f);
+	DE_ASSERT(!dataPoints.empty());
 
-	const int	maxNdx				= (int)values.size() - 1;
-	const float	floatNdx			= (float)maxNdx * position;
-	const int	lowerNdx			= (int)deFloatFloor(floatNdx);
-	const int	higherNdx			= lowerNdx + (lowerNdx == maxNdx ? 0 : 1); // Use only last element if position is 1.0
-	const float	interpolationFactor = floatNdx - (float)lowerNdx;
+	const int						numDataPoints		= (int)dataPoints.size();
+	vector<float>					pointwiseOffsets;
+	LineParametersWithConfidence	result;
 
-	DE_ASSERT(lowerNdx >= 0 && lowerNdx < (int)values.size());
-	DE_ASSERT(higherNdx >= 0 && higherNdx < (int)values.size());
-	DE_ASSERT(interpolationFactor >= 0 && interpolationFactor < 1.0f);
+	result.coefficient					= 0.0f;
+	result.coefficientConfidenceLower	= 0.0f;
+	result.coefficientConfidenceUpper	= 0.0f;
+	result.confidence					= reportedConfidence;
 
-	return tcu::mix((float)values[lowerNdx], (float)values[higherNdx], interpolationFactor);
+	if (tcu::countPairwiseSlopes(dataPoints) > 0)
+	{
+		const tcu::ConfidenceInterval coefficientInterval = tcu::medianPairwiseSlopeConfidenceInterval(dataPoints, reportedConfidence);
+
+		result.coefficient					= tcu::medianPairwiseSlope(dataPoints);
+		result.coefficientConfidenceLower	= coefficientInterval.lower;
+		result.coefficientConfidenceUpper	= coefficientInterval.upper;
+	}
+
+	for (int i = 0; i < numDataPoints; i++)
+		pointwiseOffsets.push_back(dataPoints[i].y() - result.coefficient*dataPoints[i].x());
+
+	{
+		const tcu::ConfidenceInterval offsetInterval = tcu::medianConfidenceInterval(pointwiseOffsets, reportedConfidence);
+
+		result.offset					= tcu::median(pointwiseOffsets);
+		result.offsetConfidenceLower	= offsetInterval.lower;
+		result.offsetConfidenceUpper	= offsetInterval.upper;
+	}
+
+	return result;
 }
 
 LineParametersWithConfidence theilSenSiegelLinearRegression (const std::vector<tcu::Vec2>& dataPoints, float reportedConfidence)
@@ -146,14 +132,14 @@ LineParametersWithConfidence theilSenSiegelLinearRegression (const std::vector<t
 		}
 
 		// Add median of slopes through point i
-		medianSlopes.push_back(destructiveMedian(slopes));
+		medianSlopes.push_back(tcu::destructiveMedian(slopes));
 	}
 
 	DE_ASSERT(!medianSlopes.empty());
 
 	// Find the median of the pairwise coefficients.
 	std::sort(medianSlopes.begin(), medianSlopes.end());
-	result.coefficient = linearSample(medianSlopes, 0.5f);
+	result.coefficient = tcu::linearSample(medianSlopes, 0.5f);
 
 	// Compute the offsets corresponding to the median coefficient, for all data points.
 	for (int i = 0; i < numDataPoints; i++)
@@ -161,14 +147,14 @@ LineParametersWithConfidence theilSenSiegelLinearRegression (const std::vector<t
 
 	// Find the median of the offsets.
 	std::sort(pointwiseOffsets.begin(), pointwiseOffsets.end());
-	result.offset = linearSample(pointwiseOffsets, 0.5f);
+	result.offset = tcu::linearSample(pointwiseOffsets, 0.5f);
 
 	// calculate confidence intervals
-	result.coefficientConfidenceLower = linearSample(medianSlopes, 0.5f - reportedConfidence*0.5f);
-	result.coefficientConfidenceUpper = linearSample(medianSlopes, 0.5f + reportedConfidence*0.5f);
+	result.coefficientConfidenceLower = tcu::linearSample(medianSlopes, 0.5f - reportedConfidence*0.5f);
+	result.coefficientConfidenceUpper = tcu::linearSample(medianSlopes, 0.5f + reportedConfidence*0.5f);
 
-	result.offsetConfidenceLower = linearSample(pointwiseOffsets, 0.5f - reportedConfidence*0.5f);
-	result.offsetConfidenceUpper = linearSample(pointwiseOffsets, 0.5f + reportedConfidence*0.5f);
+	result.offsetConfidenceLower = tcu::linearSample(pointwiseOffsets, 0.5f - reportedConfidence*0.5f);
+	result.offsetConfidenceUpper = tcu::linearSample(pointwiseOffsets, 0.5f + reportedConfidence*0.5f);
 
 	result.confidence = reportedConfidence;
 
@@ -230,7 +216,8 @@ void TheilSenCalibrator::clear (void)
 {
 	m_measureState.clear();
 	m_calibrateIterations.clear();
-	m_state = INTERNALSTATE_CALIBRATING;
+	m_frameTimeEstimate	= LineParametersWithConfidence();
+	m_state				= INTERNALSTATE_CALIBRATING;
 }
 
 void TheilSenCalibrator::clear (const CalibratorParameters& params)
@@ -358,13 +345,19 @@ void TheilSenCalibrator::recomputeParameters (void)
 			if (numIterations == 1)
 				dataPoints.push_back(Vec2(0.0f, 0.0f)); // If there's just one measurement so far, this will help in getting the next estimate.
 
+			// Estimate and its confidence intervals are kept for logging, call count is solved from the point estimate.
+			if (!dataPoints.empty())
+				m_frameTimeEstimate = theilSenLinearRegression(dataPoints, 0.6f);
+			else
+				m_frameTimeEstimate = LineParametersWithConfidence();
+
 			{
-				const float				targetFrameTimeUs	= m_params.targetFrameTimeUs;
-				const float				coeffEpsilon		= 0.001f; // Coefficient must be large enough (and positive) to be considered sensible.
+				const float								targetFrameTimeUs	= m_params.targetFrameTimeUs;
+				const float								coeffEpsilon		= 0.001f; // Coefficient must be large enough (and positive) to be considered sensible.
 
-				const LineParameters	estimatorLine		= theilSenLinearRegression(dataPoints);
+				const LineParametersWithConfidence&		estimatorLine		= m_frameTimeEstimate;
 
-				int						prevMaxCalls		= 0;
+				int										prevMaxCalls		= 0;
 
 				// Find the maximum of the past call counts.
 				for (int i = 0; i < numIterations; i++)
@@ -408,6 +401,31 @@ void logCalibrationInfo (tcu::TestLog& log, const TheilSenCalibrator& calibrator
 								<< de::floatToString(calibrateIterations[iterNdx].frameTime, 2) << " us ("
 								<< de::floatToString(1000000.0f / calibrateIterations[iterNdx].frameTime, 2) << " fps)" << TestLog::EndMessage;
 	}
+
+	{
+		const LineParametersWithConfidence& estimate = calibrator.getFrameTimeEstimate();
+
+		if (estimate.confidence > 0.0f)
+			log << TestLog::Message << "Frame time estimate: " << de::floatToString(estimate.offset, 2) << " us + " << de::floatToString(estimate.coefficient, 2) << " us/call, "
+									<< de::floatToString(estimate.confidence*100.0f, 0) << "% confidence intervals: offset ["
+									<< de::floatToString(estimate.offsetConfidenceLower, 2) << ", " << de::floatToString(estimate.offsetConfidenceUpper, 2) << "] us, coefficient ["
+									<< de::floatToString(estimate.coefficientConfidenceLower, 2) << ", " << de::floatToString(estimate.coefficientConfidenceUpper, 2) << "] us/call"
+									<< TestLog::EndMessage;
+	}
+
+	// Spread of measured frame times, robust to occasional outlier frames
+	if (!calibrator.getMeasureState().frameTimes.empty())
+	{
+		const std::vector<deUint64>&	frameTimes		= calibrator.getMeasureState().frameTimes;
+		const std::vector<float>		frameTimesUs	(frameTimes.begin(), frameTimes.end());
+		const tcu::ConfidenceInterval	medianInterval	= tcu::bootstrapMedianConfidenceInterval(frameTimesUs, 0.95f, 1000, 1u);
+
+		log << TestLog::Message << "Measured frame time: median " << de::floatToString(tcu::median(frameTimesUs), 2) << " us"
+								<< ", median absolute deviation " << de::floatToString(tcu::medianAbsoluteDeviation(frameTimesUs), 2) << " us"
+								<< ", 95% confidence interval of median [" << de::floatToString(medianInterval.lower, 2) << ", " << de::floatToString(medianInterval.upper, 2) << "] us"
+								<< TestLog::EndMessage;
+	}
+
 	log << TestLog::Integer("CallCount",	"Calibrated call count",	"",	QP_KEY_TAG_NONE, calibrator.getMeasureState().numDrawCalls)
 		<< TestLog::Integer("FrameCount",	"Calibrated frame count",	"", QP_KEY_TAG_NONE, (int)calibrator.getMeasureState().frameTimes.size());
 	log << TestLog::EndSection;
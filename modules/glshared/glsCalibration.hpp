@@ -45,7 +45,8 @@ struct LineParameters
 };
 
 // Basic Theil-Sen linear estimate. Calculates median of all possible slope coefficients through two of the data points
-// and median of offsets corresponding with the median slope
+// and median of offsets corresponding with the median slope. Slopes are selected in O(n log n) expected time without
+// enumerating all pairs, pairs of points with equal x coordinates are ignored.
 LineParameters theilSenLinearRegression (const std::vector<tcu::Vec2>& dataPoints);
 
 struct LineParametersWithConfidence
@@ -59,8 +60,23 @@ struct LineParametersWithConfidence
 	float coefficientConfidenceLower;
 
 	float confidence;
+
+	LineParametersWithConfidence (void)
+		: offset						(0.0f)
+		, offsetConfidenceUpper			(0.0f)
+		, offsetConfidenceLower			(0.0f)
+		, coefficient					(0.0f)
+		, coefficientConfidenceUpper	(0.0f)
+		, coefficientConfidenceLower	(0.0f)
+		, confidence					(0.0f)
+	{
+	}
 };
 
+// Theil-Sen estimate with confidence intervals. Slope interval is computed from ranks of pairwise slopes and offset interval
+// from order statistics of offsets, both for the given confidence level in range (0, 1).
+LineParametersWithConfidence theilSenLinearRegression (const std::vector<tcu::Vec2>& dataPoints, float reportedConfidence);
+
 // Median-of-medians version of Theil-Sen estimate. Calculates median of medians of slopes through a point and all other points.
 // Confidence interval is given as the range that contains the given fraction of all slopes/offsets
 LineParametersWithConfidence theilSenSiegelLinearRegression (const std::vector<tcu::Vec2>& dataPoints, float reportedConfidence);
@@ -164,6 +180,9 @@ public:
 	const MeasureState&						getMeasureState			(void) const { return m_measureState;			}
 	const std::vector<CalibrateIteration>&	getCalibrationInfo		(void) const { return m_calibrateIterations;	}
 
+	//! Frame time (us) as a function of call count, estimated from calibrate iterations. Confidence is zero if there is no estimate.
+	const LineParametersWithConfidence&		getFrameTimeEstimate	(void) const { return m_frameTimeEstimate;		}
+
 private:
 	enum InternalState
 	{
@@ -180,6 +199,7 @@ private:
 	MeasureState							m_measureState;
 
 	std::vector<CalibrateIteration>			m_calibrateIterations;
+	LineParametersWithConfidence			m_frameTimeEstimate;
 };
 
 void logCalibrationInfo (tcu::TestLog& log, const TheilSenCalibrator& calibrator);
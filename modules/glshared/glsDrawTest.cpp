@@ -30,6 +30,7 @@
 #include "deFloat16.h"
 #include "deUniquePtr.hpp"
 #include "deArrayUtil.hpp"
+#include "deParallelFor.hpp"
 
 #include "tcuTestLog.hpp"
 #include "tcuPixelFormat.hpp"
@@ -3124,6 +3125,9 @@ void DrawTest::init (void)
 	else
 		DE_FATAL("Unknown context type");
 
+	// Reference shader programs are stateless, so reference rendering can be split between threads
+	limits.numRasterThreads = de::getParallelForNumThreads();
+
 	m_refBuffers	= new sglr::ReferenceContextBuffers(m_renderCtx.getRenderTarget().getPixelFormat(), 0, 0, renderTargetWidth, renderTargetHeight, renderTargetSamples);
 	m_refContext	= new sglr::ReferenceContext(limits, m_refBuffers->getColorbuffer(), m_refBuffers->getDepthbuffer(), m_refBuffers->getStencilbuffer());
 
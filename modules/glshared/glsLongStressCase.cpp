@@ -1235,6 +1235,12 @@ void LongStressCase::init (void)
 		m_debugInfoRenderer = new DebugInfoRenderer(m_renderCtx);
 }
 
+int LongStressCase::getTotalTimeLimit (void) const
+{
+	// Iteration counts given with --deqp-test-iteration-count are used for soak testing and may run for hours
+	return m_testCtx.getCommandLine().getTestIterationCount() != 0 ? 24*60*60 : 0;
+}
+
 void LongStressCase::deinit (void)
 {
 	m_programResources.clear();
@@ -291,6 +291,8 @@ public:
 
 	IterateResult											iterate								(void);
 
+	int														getTotalTimeLimit					(void) const;
+
 private:
 															LongStressCase						(const LongStressCase&);
 	LongStressCase&											operator=							(const LongStressCase&);
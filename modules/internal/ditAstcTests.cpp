@@ -45,6 +45,7 @@ public:
 								AstcCase		(tcu::TestContext& testCtx, CompressedTexFormat format);
 
 	IterateResult				iterate			(void);
+	bool						isThreadSafe	(void) const { return true; }
 
 private:
 	const CompressedTexFormat	m_format;
@@ -92,6 +93,35 @@ void verifyBlocksValid (CompressedTexFormat format, TexDecompressionParams::Astc
 	}
 }
 
+//! Verify that decompressing blocks as a single multi-row image matches decompressing each block separately
+void verifyImageDecompress (CompressedTexFormat format, TexDecompressionParams::AstcMode mode, size_t numBlocks, const deUint8* data)
+{
+	const int						numBlocksX				= 16;
+	const int						numBlocksY				= (int)numBlocks / numBlocksX;
+	const IVec3						blockPixelSize			= getBlockPixelSize(format);
+	const TexDecompressionParams	decompressionParams		(mode);
+	const TextureFormat				uncompressedFormat		= getUncompressedFormat(format);
+	const int						rowSize					= blockPixelSize.x()*uncompressedFormat.getPixelSize();
+	TextureLevel					image					(uncompressedFormat, blockPixelSize.x()*numBlocksX, blockPixelSize.y()*numBlocksY);
+	TextureLevel					block					(uncompressedFormat, blockPixelSize.x(), blockPixelSize.y());
+
+	decompress(image.getAccess(), format, data, decompressionParams);
+
+	for (int blockY = 0; blockY < numBlocksY; blockY++)
+	for (int blockX = 0; blockX < numBlocksX; blockX++)
+	{
+		decompress(block.getAccess(), format, data + (blockY*numBlocksX + blockX)*astc::BLOCK_SIZE_BYTES, decompressionParams);
+
+		for (int y = 0; y < blockPixelSize.y(); y++)
+		{
+			const void* const imagePtr = image.getAccess().getPixelPtr(blockX*blockPixelSize.x(), blockY*blockPixelSize.y() + y);
+
+			if (deMemCmp(imagePtr, block.getAccess().getPixelPtr(0, y), rowSize) != 0)
+				TCU_FAIL("Decompressed image doesn't match separately decompressed blocks");
+		}
+	}
+}
+
 inline size_t getNumBlocksFromBytes (size_t numBytes)
 {
 	TCU_CHECK(numBytes % astc::BLOCK_SIZE_BYTES == 0);
@@ -174,6 +204,7 @@ AstcCase::IterateResult AstcCase::iterate (void)
 		testDecompress(m_format, numBlocks, &generatedData[0]);
 
 		verifyBlocksValid(m_format, mode, numBlocks, &generatedData[0]);
+		verifyImageDecompress(m_format, mode, numBlocks, &generatedData[0]);
 	}
 
 	m_testCtx.setTestResult(QP_TEST_RESULT_PASS, "All checks passed");
@@ -61,6 +61,7 @@
 #include "deArrayBuffer.hpp"
 #include "deStringUtil.hpp"
 #include "deSpinBarrier.hpp"
+#include "deParallelFor.hpp"
 #include "deSTLUtil.hpp"
 #include "deAppendList.hpp"
 
@@ -192,6 +193,7 @@ public:
 		addChild(new SelfCheckCase(m_testCtx, "spin_barrier",				"de::SpinBarrier_selfTest()",			de::SpinBarrier_selfTest));
 		addChild(new SelfCheckCase(m_testCtx, "stl_util",					"de::STLUtil_selfTest()",				de::STLUtil_selfTest));
 		addChild(new SelfCheckCase(m_testCtx, "append_list",				"de::AppendList_selfTest()",			de::AppendList_selfTest));
+		addChild(new SelfCheckCase(m_testCtx, "parallel_for",				"de::ParallelFor_selfTest()",			de::ParallelFor_selfTest));
 	}
 };
 
@@ -28,8 +28,17 @@
 
 #include "tcuFloatFormat.hpp"
 #include "tcuEither.hpp"
+#include "tcuStringTemplate.hpp"
+#include "tcuCaseIndex.hpp"
+#include "tcuTextureDataCache.hpp"
+#include "tcuStatistics.hpp"
 #include "tcuTestLog.hpp"
 #include "tcuCommandLine.hpp"
+#include "tcuImageIO.hpp"
+#include "tcuResource.hpp"
+
+#include "gluCallTrace.hpp"
+#include "gluShaderLibraryBinary.hpp"
 
 #include "rrRenderer.hpp"
 #include "tcuTextureUtil.hpp"
@@ -676,6 +685,11 @@ public:
 		m_testCtx.setTestResult(QP_TEST_RESULT_PASS, "All iterations passed");
 	}
 
+	bool isThreadSafe (void) const
+	{
+		return true;
+	}
+
 	IterateResult iterate (void)
 	{
 		{
@@ -880,6 +894,199 @@ protected:
 	vector<SubCase>::const_iterator	m_caseIter;
 };
 
+class ParallelRowsVertexShader : public rr::VertexShader
+{
+public:
+	ParallelRowsVertexShader (void)
+		: rr::VertexShader(2, 1)
+	{
+		m_inputs[0].type	= rr::GENERICVECTYPE_FLOAT;
+		m_inputs[1].type	= rr::GENERICVECTYPE_FLOAT;
+		m_outputs[0].type	= rr::GENERICVECTYPE_FLOAT;
+	}
+
+	void shadeVertices (const rr::VertexAttrib* inputs, rr::VertexPacket* const* packets, const int numPackets) const
+	{
+		for (int packetNdx = 0; packetNdx < numPackets; packetNdx++)
+		{
+			rr::readVertexAttrib(packets[packetNdx]->position, inputs[0], packets[packetNdx]->instanceNdx, packets[packetNdx]->vertexNdx);
+			packets[packetNdx]->outputs[0]	= rr::readVertexAttribFloat(inputs[1], packets[packetNdx]->instanceNdx, packets[packetNdx]->vertexNdx);
+			packets[packetNdx]->pointSize	= 5.0f;
+		}
+	}
+};
+
+//! Uses derivatives, so that results depend on quads being the same as in single-threaded rendering
+class ParallelRowsFragmentShader : public rr::FragmentShader
+{
+public:
+	ParallelRowsFragmentShader (void)
+		: rr::FragmentShader(1, 1)
+	{
+		m_inputs[0].type	= rr::GENERICVECTYPE_FLOAT;
+		m_outputs[0].type	= rr::GENERICVECTYPE_FLOAT;
+	}
+
+	void shadeFragments (rr::FragmentPacket* packets, const int numPackets, const rr::FragmentShadingContext& context) const
+	{
+		for (int packetNdx = 0; packetNdx < numPackets; packetNdx++)
+		{
+			tcu::Vec4 dFdx[4];
+			tcu::Vec4 dFdy[4];
+
+			rr::dFdxVarying(dFdx, packets[packetNdx], context, 0);
+			rr::dFdyVarying(dFdy, packets[packetNdx], context, 0);
+
+			for (int fragNdx = 0; fragNdx < rr::NUM_FRAGMENTS_PER_PACKET; fragNdx++)
+			{
+				const tcu::Vec4 color = rr::readVarying<float>(packets[packetNdx], context, 0, fragNdx);
+				rr::writeFragmentOutput(context, packetNdx, fragNdx, 0, color + 8.0f*(tcu::abs(dFdx[fragNdx]) + tcu::abs(dFdy[fragNdx])));
+			}
+		}
+	}
+};
+
+class ParallelRowsTest : public tcu::TestCase
+{
+public:
+	ParallelRowsTest (tcu::TestContext& testCtx)
+		: tcu::TestCase(testCtx, "parallel_rows", "Rendering in parallel row bands matches single-threaded rendering")
+	{
+	}
+
+	bool isThreadSafe (void) const
+	{
+		return true;
+	}
+
+	IterateResult iterate (void)
+	{
+		const rr::PrimitiveType	primitiveTypes[]	= { rr::PRIMITIVETYPE_TRIANGLES, rr::PRIMITIVETYPE_LINES, rr::PRIMITIVETYPE_POINTS };
+		const char* const		primitiveNames[]	= { "triangles", "lines", "points" };
+		const int				sampleCounts[]		= { 1, 4 };
+		const int				bandCounts[]		= { 2, 3, 8 };
+		const tcu::IVec2		size				(97, 131);
+		int						numFailed			= 0;
+
+		for (int primNdx = 0; primNdx < DE_LENGTH_OF_ARRAY(primitiveTypes); primNdx++)
+		for (int samplesNdx = 0; samplesNdx < DE_LENGTH_OF_ARRAY(sampleCounts); samplesNdx++)
+		{
+			const rr::PrimitiveType	primitiveType	= primitiveTypes[primNdx];
+			const int				numSamples		= sampleCounts[samplesNdx];
+			const int				numVertices		= primitiveType == rr::PRIMITIVETYPE_TRIANGLES ? 3*40 : primitiveType == rr::PRIMITIVETYPE_LINES ? 2*60 : 60;
+			de::Random				rnd				(0x7134 ^ (primNdx << 8) ^ numSamples);
+			vector<tcu::Vec4>		positions		(numVertices);
+			vector<tcu::Vec4>		colors			(numVertices);
+			tcu::TextureLevel		refColor		(colorFormat(), numSamples, size.x(), size.y());
+			tcu::TextureLevel		refDepthStencil	(depthStencilFormat(), numSamples, size.x(), size.y());
+
+			// Primitives overlap, cross band boundaries and get clipped
+			for (int vtxNdx = 0; vtxNdx < numVertices; vtxNdx++)
+			{
+				positions[vtxNdx]	= tcu::Vec4(rnd.getFloat(-1.2f, 1.2f), rnd.getFloat(-1.2f, 1.2f), rnd.getFloat(-0.9f, 0.9f), 1.0f);
+				colors[vtxNdx]		= tcu::Vec4(rnd.getFloat(), rnd.getFloat(), rnd.getFloat(), rnd.getFloat(0.25f, 0.75f));
+			}
+
+			render(primitiveType, positions, colors, 1, refColor, refDepthStencil);
+
+			for (int bandsNdx = 0; bandsNdx < DE_LENGTH_OF_ARRAY(bandCounts); bandsNdx++)
+			{
+				const int			numBands		= bandCounts[bandsNdx];
+				tcu::TextureLevel	color			(colorFormat(), numSamples, size.x(), size.y());
+				tcu::TextureLevel	depthStencil	(depthStencilFormat(), numSamples, size.x(), size.y());
+
+				render(primitiveType, positions, colors, numBands, color, depthStencil);
+
+				{
+					const bool	colorMatch	= deMemCmp(color.getAccess().getDataPtr(), refColor.getAccess().getDataPtr(), getDataSize(refColor)) == 0;
+					const bool	dsMatch		= depthStencilEqual(depthStencil.getAccess(), refDepthStencil.getAccess());
+
+					m_testCtx.getLog() << TestLog::Message
+									   << primitiveNames[primNdx] << ", " << numSamples << " samples, " << numBands << " bands: "
+									   << (colorMatch && dsMatch ? "bit-exact" : "FAIL: results differ from single-threaded rendering")
+									   << TestLog::EndMessage;
+
+					if (!colorMatch || !dsMatch)
+						numFailed += 1;
+				}
+			}
+		}
+
+		if (numFailed == 0)
+			m_testCtx.setTestResult(QP_TEST_RESULT_PASS, "Pass");
+		else
+			m_testCtx.setTestResult(QP_TEST_RESULT_FAIL, "Parallel rendering does not match single-threaded rendering");
+
+		return STOP;
+	}
+
+private:
+	static tcu::TextureFormat colorFormat (void)
+	{
+		return tcu::TextureFormat(tcu::TextureFormat::RGBA, tcu::TextureFormat::UNORM_INT8);
+	}
+
+	static tcu::TextureFormat depthStencilFormat (void)
+	{
+		return tcu::TextureFormat(tcu::TextureFormat::DS, tcu::TextureFormat::FLOAT_UNSIGNED_INT_24_8_REV);
+	}
+
+	static size_t getDataSize (const tcu::TextureLevel& level)
+	{
+		return (size_t)level.getFormat().getPixelSize() * level.getWidth() * level.getHeight() * level.getDepth();
+	}
+
+	//! Compare depth and stencil values, packed format has undefined padding bits
+	static bool depthStencilEqual (const tcu::ConstPixelBufferAccess& a, const tcu::ConstPixelBufferAccess& b)
+	{
+		for (int z = 0; z < a.getDepth(); z++)
+		for (int y = 0; y < a.getHeight(); y++)
+		for (int x = 0; x < a.getWidth(); x++)
+		{
+			if (a.getPixDepth(x, y, z) != b.getPixDepth(x, y, z) || a.getPixStencil(x, y, z) != b.getPixStencil(x, y, z))
+				return false;
+		}
+
+		return true;
+	}
+
+	void render (rr::PrimitiveType primitiveType, const vector<tcu::Vec4>& positions, const vector<tcu::Vec4>& colors, int numBands, tcu::TextureLevel& color, tcu::TextureLevel& depthStencil) const
+	{
+		const ParallelRowsVertexShader			vtxShader;
+		const ParallelRowsFragmentShader		fragShader;
+		const rr::Program						program			(&vtxShader, &fragShader);
+		const rr::MultisamplePixelBufferAccess	colorAccess		= rr::MultisamplePixelBufferAccess::fromMultisampleAccess(color.getAccess());
+		const rr::MultisamplePixelBufferAccess	dsAccess		= rr::MultisamplePixelBufferAccess::fromMultisampleAccess(depthStencil.getAccess());
+		const rr::RenderTarget					renderTarget	(colorAccess, dsAccess, dsAccess);
+		const rr::VertexAttrib					vertexAttribs[]	=
+		{
+			rr::VertexAttrib(rr::VERTEXATTRIBTYPE_FLOAT, 4, 0, 0, &positions[0]),
+			rr::VertexAttrib(rr::VERTEXATTRIBTYPE_FLOAT, 4, 0, 0, &colors[0])
+		};
+		rr::RenderState							state			((rr::ViewportState(colorAccess)), rr::RenderState::DEFAULT_SUBPIXEL_BITS);
+		const rr::Renderer						renderer;
+
+		tcu::clear			(color.getAccess(), tcu::Vec4(0.0f, 0.0f, 0.0f, 1.0f));
+		tcu::clearDepth		(depthStencil.getAccess(), 1.0f);
+		tcu::clearStencil	(depthStencil.getAccess(), 0);
+
+		state.numRasterThreads									= numBands;
+		state.line.lineWidth									= 3.0f;
+		state.fragOps.depthTestEnabled							= true;
+		state.fragOps.depthFunc									= rr::TESTFUNC_LEQUAL;
+		state.fragOps.stencilTestEnabled						= true;
+		state.fragOps.stencilStates[rr::FACETYPE_BACK].func		= rr::TESTFUNC_ALWAYS;
+		state.fragOps.stencilStates[rr::FACETYPE_BACK].dpPass	= rr::STENCILOP_INCR;
+		state.fragOps.stencilStates[rr::FACETYPE_FRONT]			= state.fragOps.stencilStates[rr::FACETYPE_BACK];
+		state.fragOps.blendMode									= rr::BLENDMODE_STANDARD;
+		state.fragOps.blendRGBState.srcFunc						= rr::BLENDFUNC_SRC_ALPHA;
+		state.fragOps.blendRGBState.dstFunc						= rr::BLENDFUNC_ONE_MINUS_SRC_ALPHA;
+		state.fragOps.blendAState								= state.fragOps.blendRGBState;
+
+		renderer.draw(rr::DrawCommand(state, renderTarget, program, DE_LENGTH_OF_ARRAY(vertexAttribs), vertexAttribs, rr::PrimitiveList(primitiveType, (int)positions.size(), 0)));
+	}
+};
+
 class CommonFrameworkTests : public tcu::TestCaseGroup
 {
 public:
@@ -894,6 +1101,35 @@ public:
 								   tcu::FloatFormat_selfTest));
 		addChild(new SelfCheckCase(m_testCtx, "either","tcu::Either_selfTest()",
 								   tcu::Either_selfTest));
+		addChild(new SelfCheckCase(m_testCtx, "string_template","tcu::StringTemplate_selfTest()",
+								   tcu::StringTemplate_selfTest));
+		addChild(new SelfCheckCase(m_testCtx, "case_index","tcu::CaseIndex_selfTest()",
+								   tcu::CaseIndex_selfTest));
+		addChild(new SelfCheckCase(m_testCtx, "texture_data_cache","tcu::TextureDataCache_selfTest()",
+								   tcu::TextureDataCache_selfTest));
+		addChild(new SelfCheckCase(m_testCtx, "statistics","tcu::Statistics_selfTest()",
+								   tcu::Statistics_selfTest));
+		addChild(new SelfCheckCase(m_testCtx, "image_io","tcu::ImageIO_selfTest()",
+								   tcu::ImageIO_selfTest));
+		addChild(new SelfCheckCase(m_testCtx, "file_resource","tcu::FileResource_selfTest()",
+								   tcu::FileResource_selfTest));
+	}
+};
+
+class OpenGLUtilTests : public tcu::TestCaseGroup
+{
+public:
+	OpenGLUtilTests (tcu::TestContext& testCtx)
+		: tcu::TestCaseGroup(testCtx, "opengl", "Tests for the OpenGL utility framework")
+	{
+	}
+
+	void init (void)
+	{
+		addChild(new SelfCheckCase(m_testCtx, "call_trace","glu::CallTrace_selfTest()",
+								   glu::CallTrace_selfTest));
+		addChild(new SelfCheckCase(m_testCtx, "shader_library_binary","glu::sl::ShaderLibraryBinary_selfTest()",
+								   glu::sl::ShaderLibraryBinary_selfTest));
 	}
 };
 
@@ -908,6 +1144,7 @@ public:
 	void init (void)
 	{
 		addChild(new ConstantInterpolationTest(m_testCtx));
+		addChild(new ParallelRowsTest(m_testCtx));
 	}
 };
 
@@ -925,6 +1162,7 @@ FrameworkTests::~FrameworkTests (void)
 void FrameworkTests::init (void)
 {
 	addChild(new CommonFrameworkTests	(m_testCtx));
+	addChild(new OpenGLUtilTests		(m_testCtx));
 	addChild(new CaseListParserTests	(m_testCtx));
 	addChild(new ReferenceRendererTests	(m_testCtx));
 	addChild(createTextureFormatTests	(m_testCtx));
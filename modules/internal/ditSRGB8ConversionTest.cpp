@@ -65,6 +65,11 @@ public:
 	{
 	}
 
+	bool isThreadSafe (void) const
+	{
+		return true;
+	}
+
 	IterateResult iterate (void)
 	{
 		bool			isOk	= true;
@@ -48,6 +48,11 @@ public:
 	{
 	}
 
+	bool isThreadSafe (void) const
+	{
+		return true;
+	}
+
 	IterateResult iterate (void)
 	{
 		TestLog&			log		= m_testCtx.getLog();
@@ -80,6 +85,11 @@ public:
 	{
 	}
 
+	bool isThreadSafe (void) const
+	{
+		return true;
+	}
+
 	IterateResult iterate (void)
 	{
 		TestLog&			log			= m_testCtx.getLog();
@@ -47,6 +47,11 @@ public:
 		return STOP;
 	}
 
+	bool isThreadSafe (void) const
+	{
+		return true;
+	}
+
 private:
 	Function m_function;
 };
@@ -23,8 +23,21 @@
 
 #include "ditTestLogTests.hpp"
 #include "tcuTestLog.hpp"
+#include "tcuTestPackage.hpp"
+#include "tcuCommandLine.hpp"
+#include "tcuForkSessionExecutor.hpp"
+#include "qpTestLog.h"
+#include "deFile.h"
+#include "deStringUtil.hpp"
 
 #include <limits>
+#include <fstream>
+#include <sstream>
+
+#if (DE_OS == DE_OS_UNIX) || (DE_OS == DE_OS_OSX) || (DE_OS == DE_OS_ANDROID) || (DE_OS == DE_OS_QNX)
+#	include <signal.h>
+#	include <unistd.h>
+#endif
 
 namespace dit
 {
@@ -36,6 +49,114 @@ using tcu::TestLog;
 //  - nested element cases (sections, image sets)
 //  - parse results and verify
 
+namespace
+{
+
+size_t countOccurrences (const std::string& str, const char* pattern)
+{
+	size_t	count	= 0;
+	size_t	pos		= str.find(pattern);
+
+	while (pos != std::string::npos)
+	{
+		count	+= 1;
+		pos		 = str.find(pattern, pos+1);
+	}
+
+	return count;
+}
+
+std::string readFile (const char* filename)
+{
+	std::ifstream		file	(filename, std::ios_base::binary);
+	std::ostringstream	str;
+
+	str << file.rdbuf();
+
+	return str.str();
+}
+
+// Forked session with one crashing and one timing out case. Batches have
+// multiple cases, and the terminated cases are in the middle of their batches.
+enum
+{
+	FORK_SESSION_NUM_CASES		= 40,
+	FORK_SESSION_CRASH_NDX		= 11,
+	FORK_SESSION_TIMEOUT_NDX	= 22
+};
+
+std::string getForkSessionCasePath (int ndx)
+{
+	return "fork_selftest.case_" + de::toString(ndx);
+}
+
+class ForkSessionTestCase : public tcu::TestCase
+{
+public:
+	ForkSessionTestCase (tcu::TestContext& testCtx, int ndx)
+		: TestCase	(testCtx, ("case_" + de::toString(ndx)).c_str(), "")
+		, m_ndx		(ndx)
+	{
+	}
+
+	IterateResult iterate (void)
+	{
+		m_testCtx.getLog() << TestLog::Message << "Partial log of case " << m_ndx << TestLog::EndMessage;
+
+#if (DE_OS == DE_OS_UNIX) || (DE_OS == DE_OS_OSX) || (DE_OS == DE_OS_ANDROID) || (DE_OS == DE_OS_QNX)
+		// Killed without running crash handlers, which would write to the log of this session
+		if (m_ndx == FORK_SESSION_CRASH_NDX)
+			kill(getpid(), SIGKILL);
+		else if (m_ndx == FORK_SESSION_TIMEOUT_NDX)
+			_exit(tcu::ForkSessionExecutor::WORKER_EXIT_TIMEOUT);
+#endif
+
+		m_testCtx.setTestResult(QP_TEST_RESULT_PASS, "Pass");
+		return STOP;
+	}
+
+private:
+	const int m_ndx;
+};
+
+const char* const FORK_SESSION_COUNTER_NAME = "Selftest cases deinitialized";
+
+class ForkSessionTestCaseExecutor : public tcu::TestCaseExecutor
+{
+public:
+	ForkSessionTestCaseExecutor (void) : m_numDeinit(0) {}
+
+	void							init				(tcu::TestCase* testCase, const std::string&)	{ testCase->init();										}
+	void							deinit				(tcu::TestCase* testCase)						{ testCase->deinit(); m_numDeinit += 1;					}
+	tcu::TestNode::IterateResult	iterate				(tcu::TestCase* testCase)						{ return testCase->iterate();							}
+	void							addSessionCounters	(tcu::SessionCounters& counters) const			{ counters[FORK_SESSION_COUNTER_NAME] += m_numDeinit;	}
+
+private:
+	int								m_numDeinit;
+};
+
+class ForkSessionTestPackage : public tcu::TestPackage
+{
+public:
+	ForkSessionTestPackage (tcu::TestContext& testCtx)
+		: tcu::TestPackage(testCtx, "fork_selftest", "Forked session self-test")
+	{
+	}
+
+	void init (void)
+	{
+		for (int ndx = 0; ndx < FORK_SESSION_NUM_CASES; ndx++)
+			addChild(new ForkSessionTestCase(m_testCtx, ndx));
+	}
+
+	tcu::TestCaseExecutor* createExecutor (void) const
+	{
+		return new ForkSessionTestCaseExecutor();
+	}
+};
+
+} // anonymous
+
 class BasicSampleListCase : public tcu::TestCase
 {
 public:
@@ -69,6 +190,175 @@ public:
 	}
 };
 
+class BufferLogCase : public tcu::TestCase
+{
+public:
+	BufferLogCase (tcu::TestContext& testCtx)
+		: TestCase(testCtx, "buffer_log", "Cases written to buffer logs are appended in order")
+	{
+	}
+
+	IterateResult iterate (void)
+	{
+		const char* const	filename	= "buffer-log-selftest.qpa";
+		// Larger than the copy buffer of qpTestLog_appendBufferLog()
+		const std::string	longValue	(100*1024, 'x');
+		std::string			contents;
+
+		{
+			qpTestLog* const	fileLog		= qpTestLog_createFileLog(filename, 0);
+			qpTestLog* const	bufferA		= qpTestLog_createBufferLog(0);
+			qpTestLog* const	bufferB		= qpTestLog_createBufferLog(0);
+			bool				isOk		= fileLog && bufferA && bufferB;
+
+			if (isOk)
+			{
+				// Write cases out of order to two buffers
+				writeCase(bufferA, "pkg.a", "first", QP_TEST_RESULT_PASS);
+				writeCase(bufferB, "pkg.b", longValue.c_str(), QP_TEST_RESULT_FAIL);
+				writeCase(bufferA, "pkg.c", "second", QP_TEST_RESULT_PASS);
+
+				isOk = qpTestLog_appendBufferLog(fileLog, bufferB) == DE_TRUE &&
+					   qpTestLog_appendBufferLog(fileLog, bufferA) == DE_TRUE;
+			}
+
+			if (bufferB)	qpTestLog_destroy(bufferB);
+			if (bufferA)	qpTestLog_destroy(bufferA);
+			if (fileLog)	qpTestLog_destroy(fileLog);
+
+			if (!isOk)
+			{
+				deDeleteFile(filename);
+				TCU_FAIL("Failed to create or append buffer logs");
+			}
+		}
+
+		contents = readFile(filename);
+		deDeleteFile(filename);
+
+		{
+			const size_t	posB		= contents.find("#beginTestCaseResult pkg.b");
+			const size_t	posA		= contents.find("#beginTestCaseResult pkg.a");
+			const size_t	posC		= contents.find("#beginTestCaseResult pkg.c");
+			const size_t	posLong		= contents.find(longValue);
+			const size_t	numCases	= countOccurrences(contents, "#endTestCaseResult");
+
+			m_testCtx.getLog() << TestLog::Message << "Appended log is " << contents.size() << " bytes, contains " << numCases << " cases" << TestLog::EndMessage;
+
+			if (posB == std::string::npos || posA == std::string::npos || posC == std::string::npos || posLong == std::string::npos)
+				m_testCtx.setTestResult(QP_TEST_RESULT_FAIL, "Buffered case missing from appended log");
+			else if (!(posB < posLong && posLong < posA && posA < posC))
+				m_testCtx.setTestResult(QP_TEST_RESULT_FAIL, "Buffered cases appended in wrong order");
+			else if (numCases != 3)
+				m_testCtx.setTestResult(QP_TEST_RESULT_FAIL, "Wrong number of cases in appended log");
+			else
+				m_testCtx.setTestResult(QP_TEST_RESULT_PASS, "Pass");
+		}
+
+		return STOP;
+	}
+
+private:
+	static void writeCase (qpTestLog* log, const char* path, const char* value, qpTestResult result)
+	{
+		qpTestLog_startCase(log, path, QP_TEST_CASE_TYPE_SELF_VALIDATE);
+		qpTestLog_writeText(log, "Value", "Value", QP_KEY_TAG_NONE, value);
+		qpTestLog_endCase(log, result, "Result");
+	}
+};
+
+class ForkSessionCase : public tcu::TestCase
+{
+public:
+	ForkSessionCase (tcu::TestContext& testCtx)
+		: TestCase(testCtx, "fork_session", "Crashed and timed out cases in forked workers keep partial logs")
+	{
+	}
+
+	IterateResult iterate (void)
+	{
+		const char* const		filename	= "fork-session-selftest.qpa";
+		const int				numCases	= FORK_SESSION_NUM_CASES;
+		tcu::TestRunStatus		status;
+		tcu::SessionCounters	counters;
+		std::string				contents;
+
+		if (!tcu::ForkSessionExecutor::isSupported())
+			throw tcu::NotSupportedError("Forked worker processes are not supported on this platform");
+
+		{
+			const tcu::CommandLine			cmdLine		("deqp --deqp-case=fork_selftest.*");
+			TestLog							log			(filename);
+			tcu::TestContext				testCtx		(m_testCtx.getPlatform(), m_testCtx.getRootArchive(), log, cmdLine, DE_NULL);
+			std::vector<tcu::TestNode*>		packages;
+
+			packages.push_back(new ForkSessionTestPackage(testCtx));
+
+			{
+				tcu::TestPackageRoot		root		(testCtx, packages);
+				tcu::ForkSessionExecutor	executor	(root, testCtx, 1);
+
+				while (executor.iterate())
+					m_testCtx.touchWatchdog();
+
+				status		= executor.getStatus();
+				counters	= executor.getSessionCounters();
+			}
+		}
+
+		contents = readFile(filename);
+		deDeleteFile(filename);
+
+		m_testCtx.getLog() << TestLog::Message << "Executed " << status.numExecuted << " cases, " << status.numPassed << " passed, " << status.numFailed << " failed" << TestLog::EndMessage;
+
+		if (!status.isComplete || status.numExecuted != numCases || status.numPassed != numCases - 2 || status.numFailed != 2)
+			m_testCtx.setTestResult(QP_TEST_RESULT_FAIL, "Wrong session status");
+		else if (countOccurrences(contents, "#beginTestCaseResult") != (size_t)numCases || countOccurrences(contents, "#endTestCaseResult") != (size_t)numCases - 2)
+			m_testCtx.setTestResult(QP_TEST_RESULT_FAIL, "Wrong number of cases in log");
+		else if (!isInCaseOrder(contents))
+			m_testCtx.setTestResult(QP_TEST_RESULT_FAIL, "Cases logged in wrong order");
+		else if (!isTerminated(contents, FORK_SESSION_CRASH_NDX, "Crash") || !isTerminated(contents, FORK_SESSION_TIMEOUT_NDX, "Timeout"))
+			m_testCtx.setTestResult(QP_TEST_RESULT_FAIL, "Partial log of terminated case missing");
+		else if (countOccurrences(contents, "#beginTestsCasesTime") != 1 || contents.find("Name=\"fork_selftest\"") == std::string::npos)
+			m_testCtx.setTestResult(QP_TEST_RESULT_FAIL, "Expected one merged cases time block");
+		else if (counters.size() != 1 || counters[FORK_SESSION_COUNTER_NAME] <= 0 || counters[FORK_SESSION_COUNTER_NAME] > numCases - 2)
+			m_testCtx.setTestResult(QP_TEST_RESULT_FAIL, "Session counters of workers not merged");
+		else
+			m_testCtx.setTestResult(QP_TEST_RESULT_PASS, "Pass");
+
+		return STOP;
+	}
+
+private:
+	static bool isInCaseOrder (const std::string& contents)
+	{
+		size_t prevPos = 0;
+
+		for (int ndx = 0; ndx < FORK_SESSION_NUM_CASES; ndx++)
+		{
+			const size_t pos = contents.find("#beginTestCaseResult " + getForkSessionCasePath(ndx) + "\n");
+
+			if (pos == std::string::npos || pos < prevPos)
+				return false;
+
+			prevPos = pos;
+		}
+
+		return true;
+	}
+
+	//! Partial log of the case must be followed by the termination before the next case starts
+	static bool isTerminated (const std::string& contents, int ndx, const char* result)
+	{
+		const size_t	begin		= contents.find("#beginTestCaseResult " + getForkSessionCasePath(ndx) + "\n");
+		const size_t	message		= contents.find("<Text>Partial log of case " + de::toString(ndx), begin);
+		const size_t	terminate	= contents.find(std::string("#terminateTestCaseResult ") + result, begin);
+		const size_t	next		= contents.find("#beginTestCaseResult " + getForkSessionCasePath(ndx + 1) + "\n", begin);
+
+		return begin != std::string::npos && next != std::string::npos && message < terminate && terminate < next;
+	}
+};
+
 TestLogTests::TestLogTests (tcu::TestContext& testCtx)
 	: TestCaseGroup(testCtx, "testlog", "Test Log Tests")
 {
@@ -81,6 +371,8 @@ TestLogTests::~TestLogTests (void)
 void TestLogTests::init (void)
 {
 	addChild(new BasicSampleListCase(m_testCtx));
+	addChild(new BufferLogCase		(m_testCtx));
+	addChild(new ForkSessionCase	(m_testCtx));
 }
 
 } // dit
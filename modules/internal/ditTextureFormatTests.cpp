@@ -1377,6 +1377,11 @@ public:
 		DE_ASSERT(isValid(format));
 	}
 
+	bool isThreadSafe (void) const
+	{
+		return true;
+	}
+
 protected:
 	template<typename T>
 	void verifyRead (const ConstPixelBufferAccess& src)
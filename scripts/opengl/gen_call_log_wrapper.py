@@ -21,6 +21,7 @@
 #-------------------------------------------------------------------------
 
 from src_util import *
+from gen_str_util import BITFIELD_GROUPS
 import re
 
 class LogSpec:
@@ -29,8 +30,15 @@ class LogSpec:
 		self.argOutPrints	= argOutPrints
 		self.returnPrint	= returnPrint
 
+class EnumPrint:
+	def __init__ (self, group):
+		self.group = group
+
+	def __call__ (self, name):
+		return "get%sStr(%s)" % (self.group, name)
+
 def enum (group):
-	return lambda name: "get%sStr(%s)" % (group, name)
+	return EnumPrint(group)
 
 def pointer (size):
 	return lambda name: "getPointerStr(%s, %s)" % (name, size)
@@ -52,6 +60,9 @@ def fnPointer (name):
 
 stringVal = lambda name: "getStringStr(%s)" % name
 
+# Must match glu::CallTrace::MAX_ARGS
+CALL_TRACE_MAX_ARGS = 17
+
 # Special rules for printing call arguments
 CALL_LOG_SPECS = {
 	"glActiveTexture":						LogSpec({0: textureUnit}),
@@ -380,6 +391,70 @@ def getVarDefaultPrint (type, varName):
 	else:
 		return varName
 
+def getTraceInfoName (funcName):
+	return "s_%sTraceInfo" % funcName
+
+def getTraceValueType (type):
+	if type == 'void':
+		return 'v'
+	elif '*' in type or type in ['GLsync', 'GLDEBUGPROC', 'GLeglImageOES']:
+		return 'p'
+	elif type == 'GLfloat':
+		return 'f'
+	elif type in ['GLdouble', 'GLclampd']:
+		return 'd'
+	elif type == 'GLboolean':
+		return 'b'
+	elif type in ['GLenum', 'GLbitfield', 'GLubyte']:
+		return 'x'
+	elif type in ['GLuint', 'GLuint64']:
+		return 'u'
+	elif type in ['GLint', 'GLsizei', 'GLintptr', 'GLsizeiptr', 'GLshort']:
+		return 'i'
+	else:
+		raise Exception("Unknown trace value type %s" % type)
+
+def getTraceEnumName (valuePrint):
+	# Bitfields have no name lookup; they are traced as hex values
+	bitfieldGroups = set(group for group, values in BITFIELD_GROUPS)
+	if isinstance(valuePrint, EnumPrint) and not valuePrint.group in bitfieldGroups:
+		return "get%sName" % valuePrint.group
+	else:
+		return None
+
+def commandTraceInfoDefs (command):
+	try:
+		logSpec = CALL_LOG_SPECS[command.name]
+	except KeyError:
+		logSpec = None
+
+	if len(command.params) > CALL_TRACE_MAX_ARGS:
+		raise Exception("Too many arguments for call trace in %s" % command.name)
+
+	signature	= "".join(getTraceValueType(t) for t in [command.type] + [p.type for p in command.params])
+	enumNames	= [None] * (len(command.params) + 1)
+	defs		= []
+
+	if logSpec:
+		enumNames[0] = getTraceEnumName(logSpec.returnPrint)
+		for paramNdx, valuePrint in logSpec.argInPrints.items():
+			enumNames[paramNdx + 1] = getTraceEnumName(valuePrint)
+
+	if any(enumNames):
+		enumArrayName = "s_%sTraceEnums" % command.name
+		defs.append("static const CallTrace::GetEnumNameFunc\t%s[]\t= { %s };" % (enumArrayName, ", ".join(n if n else "DE_NULL" for n in enumNames)))
+	else:
+		enumArrayName = "DE_NULL"
+
+	defs.append("static const CallTrace::FuncInfo\t%s\t= { \"%s\", \"%s\", %d, %s };" % (getTraceInfoName(command.name), command.name, signature, len(command.params), enumArrayName))
+	return defs
+
+def genCallTraceInfos (iface):
+	lines = []
+	for command in iface.commands:
+		lines += commandTraceInfoDefs(command)
+	writeInlFile(os.path.join(OPENGL_DIR, "gluCallLogWrapperTrace.inl"), indentLines(lines))
+
 def commandLogWrapperMemberDef (command):
 	src = ""
 	try:
@@ -406,6 +481,16 @@ def commandLogWrapperMemberDef (command):
 	src += "\tif (m_enableLog)\n"
 	src += "\t\tm_log << TestLog::Message << %s;\n" % " << ".join(callPrintItems)
 
+	# Record call to trace
+	src += "\tif (m_callTrace)\n"
+	if len(command.params) > 0:
+		src += "\t{\n"
+		src += "\t\tconst deUint64 traceArgs[] = { %s };\n" % ", ".join("CallTrace::pack(%s)" % p.name for p in command.params)
+		src += "\t\tm_callTrace->record(%s, traceArgs);\n" % getTraceInfoName(command.name)
+		src += "\t}\n"
+	else:
+		src += "\t\tm_callTrace->record(%s, DE_NULL);\n" % getTraceInfoName(command.name)
+
 	callStr = "m_gl.%s(%s)" % (getFunctionMemberName(command.name), ", ".join([p.name for p in command.params]))
 
 	isVoid	= command.type == 'void'
@@ -444,6 +529,8 @@ def commandLogWrapperMemberDef (command):
 
 		src += "\tif (m_enableLog)\n"
 		src += "\t\tm_log << TestLog::Message << \"// \" << %s << \" returned\" << TestLog::EndMessage;\n" % returnPrint
+		src += "\tif (m_callTrace)\n"
+		src += "\t\tm_callTrace->setReturnValue(CallTrace::pack(returnValue));\n"
 		src += "\treturn returnValue;\n"
 
 	src += "}"
@@ -452,6 +539,7 @@ def commandLogWrapperMemberDef (command):
 def genCallLogWrapper (iface):
 	genCommandList(iface, commandLogWrapperMemberDecl, OPENGL_DIR, "gluCallLogWrapperApi.inl", True)
 	genCommandList(iface, commandLogWrapperMemberDef, OPENGL_DIR, "gluCallLogWrapper.inl", False)
+	genCallTraceInfos(iface)
 
 if __name__ == "__main__":
 	genCallLogWrapper(getHybridInterface())